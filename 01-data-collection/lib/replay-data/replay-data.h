@@ -0,0 +1,202 @@
+/**
+ * Columnar loader for recorded IMU readings.
+ *
+ * Memory-maps one or more CSV recordings (timestamp, accX, accY, accZ, gyrX,
+ * gyrY, gyrZ plus any extra columns, in any order) and parses them into a
+ * structure of arrays: one contiguous float column per channel. The files are
+ * scanned for line endings first so that every column is allocated once, at
+ * its final size, before any parsing happens. Columns are cache-line aligned.
+ *
+ * Recordings can also be stored in a compact binary format (see
+ * ReplayBinHeader below, usually with the .imub extension), which is detected
+ * by its magic number. A single float32 recording is replayed straight from
+ * the memory map without copying; anything else is copied or converted into
+ * the columns. Use saveBinary() (or the csv2imub tool) to convert a CSV.
+ *
+ * ReplayStream reads the same files on a background thread instead, keeping
+ * only a sliding window of rows in memory, so recordings of any length can be
+ * replayed with constant memory use.
+ *
+ * License: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REPLAY_DATA_H
+#define REPLAY_DATA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Number of channels stored for each reading
+#define REPLAY_NUM_COLUMNS      7
+
+// Binary recording format
+#define REPLAY_BIN_MAGIC                "IMUB"
+#define REPLAY_BIN_VERSION              1
+#define REPLAY_BIN_ALIGN                64      // Alignment of each column (bytes)
+#define REPLAY_BIN_NAME_LEN             16
+#define REPLAY_BIN_LABEL_LEN            24
+#define REPLAY_BIN_FLAG_UNIFORM_TIME    0x0001  // Timestamps are not stored
+
+// Streaming settings
+#define REPLAY_STREAM_WINDOW_ROWS       65536   // Rows kept in memory
+#define REPLAY_STREAM_BATCH_ROWS        1024    // Rows read before publishing
+
+// Sample formats for the channel columns in a binary recording
+enum ReplayBinFormat {
+    REPLAY_BIN_FLOAT32 = 0,             // 4-byte IEEE floats (lossless)
+    REPLAY_BIN_INT16 = 1                // value = (raw * scale) + offset
+};
+
+// Binary recording layout (all fields little-endian):
+//  ReplayBinHeader
+//  ReplayBinChannel x num_channels
+//  padding up to header_size
+//  one column per channel, each padded to a multiple of REPLAY_BIN_ALIGN bytes
+// If REPLAY_BIN_FLAG_UNIFORM_TIME is set, there is no timestamp channel and
+// timestamp i is time_start_ms + (i * time_step_ms).
+struct ReplayBinHeader {
+    char magic[4];                      // REPLAY_BIN_MAGIC
+    uint16_t version;                   // REPLAY_BIN_VERSION
+    uint16_t flags;                     // REPLAY_BIN_FLAG_*
+    uint32_t header_size;               // Offset of the first column (bytes)
+    uint32_t sample_format;             // ReplayBinFormat
+    uint32_t num_channels;              // Number of stored columns
+    float sample_rate_hz;               // Sampling rate of the recording
+    float time_start_ms;                // First timestamp
+    float time_step_ms;                 // Sampling period
+    uint64_t num_frames;                // Readings in each column
+    char label[REPLAY_BIN_LABEL_LEN];   // Class label (NUL-terminated)
+};
+
+// Description of one stored column
+struct ReplayBinChannel {
+    char name[REPLAY_BIN_NAME_LEN];     // Same names as the CSV header
+    double scale;                       // Only used for REPLAY_BIN_INT16
+    double offset;                      // Only used for REPLAY_BIN_INT16
+};
+
+class ReplayData {
+    public:
+        // Column order (matches the order of the CSV header names below)
+        enum Column {
+            TIME = 0,
+            ACC_X,
+            ACC_Y,
+            ACC_Z,
+            GYR_X,
+            GYR_Y,
+            GYR_Z
+        };
+
+        ReplayData();
+        ~ReplayData();
+
+        // Replace the current readings with the rows of all the given files
+        // (in order). Returns 0 on success, -1 on failure (see error()).
+        int load(char **paths, int num_paths);
+        void clear();
+
+        // Write the current readings as a binary recording. Returns 0 on
+        // success, -1 on failure (see error()).
+        int saveBinary(const char *path, int sample_format, const char *label);
+
+        size_t size() const { return count; }
+        bool empty() const { return count == 0; }
+        float *column(int col) { return columns[col]; }
+        const float *column(int col) const { return columns[col]; }
+        const char *error() const { return error_msg; }
+    private:
+        ReplayData(const ReplayData&);
+        ReplayData& operator=(const ReplayData&);
+
+        int reserve(size_t rows, int num_columns);
+        int parseCsv(const char *path, const char *data, size_t len);
+        int parseBinary(const char *path, const char *data, size_t len);
+        int mapBinary(const char *path, const char *data, size_t len);
+        int checkBinary(const char *path, const char *data, size_t len);
+        void releaseMap();
+        void setError(const char *msg, const char *path);
+
+        void *zero_copy_map = 0;
+        float *block = 0;
+        float *columns[REPLAY_NUM_COLUMNS] = {0};
+        size_t count = 0;
+        size_t capacity = 0;
+        char error_msg[256] = {0};
+};
+
+class ReplayStream {
+    public:
+        ReplayStream();
+        ~ReplayStream();
+
+        // Start reading the rows of all the given files (in order) on a
+        // background thread. Waits for the first two rows so that
+        // sampleRate() is known. Returns 0 on success, -1 on failure (see
+        // error()).
+        int open(char **paths, int num_paths, 
+                size_t window_rows = REPLAY_STREAM_WINDOW_ROWS);
+        void close();
+
+        // Copy row idx (timestamp and the six axes, in ReplayData::Column
+        // order) into row, waiting for the reader if needed. Rows more than a
+        // quarter of the window behind the last one read are released, so
+        // idx should only move forward. Returns 1 if there are more rows
+        // after this one, 0 if this is the last row (idx past the end gives
+        // the last row), or -1 if there are no rows.
+        int read(size_t idx, float *row);
+
+        // Difference between the first two timestamps (0 if only one row)
+        float sampleRate() const { return sample_rate; }
+        bool isOpen() const { return ring != 0; }
+        const char *error() const { return error_msg; }
+    private:
+        ReplayStream(const ReplayStream&);
+        ReplayStream& operator=(const ReplayStream&);
+
+        void readerMain();
+        int streamCsv(const char *path, char *data, size_t len);
+        int streamBinary(const char *path, char *data, size_t len);
+        float *nextSlot();
+        void setError(const char *msg, const char *path);
+
+        // Set by open() and only read afterwards
+        char **paths = 0;
+        int num_paths = 0;
+        float *ring = 0;
+        size_t window = 0;
+        float sample_rate = 0.0f;
+
+        // Only used by the reader thread
+        size_t written = 0;
+        size_t write_limit = 0;
+
+        // Shared between the reader and read()
+        std::thread reader;
+        std::mutex lock;
+        std::condition_variable rows_ready;
+        std::condition_variable space_ready;
+        size_t produced = 0;
+        size_t oldest = 0;
+        bool end_of_stream = false;
+        bool closing = false;
+        char error_msg[256] = {0};
+};
+
+#endif // REPLAY_DATA_H
@@ -1,7 +1,8 @@
 /**
  * Main application entrypoint for the sequential inferencing assignment
  *
- * Reads CSV files from tests/ and constructs a vector of raw readings. The 
+ * Reads CSV files from tests/ (or binary .imub recordings made from them with
+ * csv2imub) into columns of raw readings (replay-data.h). The 
  * student implements setup() and loop() functions in submission.cpp. The IMU
  * object can read from a virtual accelerometer and gyroscope, which pull
  * values from the CSV files.
@@ -17,26 +18,30 @@
 
 #include <stdio.h>
 #include <cstdlib>
-#include <array>
 
-#include "csv.h"
+#include "replay-data.h"
 #include "time-emulator.h"
 #include "imu-emulator.h"
+#include "replay-index.h"
 #include "submission.h"
 
 // Declare our helper functions
+void buildReadingIndex();
 int findClosestIdx(unsigned long time_ms);
 int readAccelerometerCallback(float& x, float& y, float& z);
 int readGyroscopeCallback(float& x, float& y, float& z);
 
-// Vector of raw readings to be supplied to the user via callbacks
-static std::vector<std::array<float, 7>> raw_readings;
+// Columns of raw readings to be supplied to the user via callbacks
+static ReplayData raw_readings;
+
+// Lookup table for finding the reading closest to a given timestamp
+static ReplayIndex reading_index;
 
 // Current timestamp (milliseconds) of user's IMU readings (used in callbacks)
 static unsigned long first_reading_timestamp = 0;
 static bool is_first_reading = true;
 
-// How the arrays in the raw readings vector are indexed
+// How the columns of raw readings are indexed
 enum VectorIDXs {
     TIME_IDX = 0,
     ACC_X_IDX,
@@ -54,9 +59,7 @@ enum VectorIDXs {
 // Main function to call setup and loop
 int main(int argc, char **argv) {
 
-    float timestamp, accX, accY, accZ, gyrX, gyrY, gyrZ;
-    std::array<float, 7> reading;
-    
+    float *timestamps;
     float sample_rate = 0.0;
     int reading_idx = 0;
 
@@ -76,53 +79,29 @@ int main(int argc, char **argv) {
     // Loop through all files provided as arguments
     for (int file_idx = 1; file_idx < argc; file_idx++) {
 
-        // Clear the raw readings vector
-        raw_readings.clear();
-
-        // Read CSV header
-        io::CSVReader<7> csv_reader(argv[file_idx]);
-        csv_reader.read_header( io::ignore_extra_column, 
-                                "timestamp", 
-                                "accX", 
-                                "accY",
-                                "accZ",
-                                "gyrX",
-                                "gyrY",
-                                "gyrZ");
-
-        // Construct vector of raw values from CSV file
-        while (csv_reader.read_row( timestamp, 
-                                    accX, 
-                                    accY, 
-                                    accZ, 
-                                    gyrX, 
-                                    gyrY, 
-                                    gyrZ)) {
-
-            // Calculate sample rate (and use that instead of what's in CSV)
+        // Load columns of raw values from CSV file
+        if (raw_readings.load(&argv[file_idx], 1) != 0) {
+            printf("ERROR: %s\r\n", raw_readings.error());
+            return 1;
+        }
+
+        // Calculate sample rate (and use that instead of what's in CSV)
+        timestamps = raw_readings.column(TIME_IDX);
+        for (size_t i = 0; i < raw_readings.size(); i++) {
             if (reading_idx == 0) {
-                sample_rate = timestamp;
+                sample_rate = timestamps[i];
             } else if (reading_idx == 1) {
-                sample_rate = timestamp - sample_rate;
+                sample_rate = timestamps[i] - sample_rate;
             }
-            timestamp = sample_rate * raw_readings.size();
-
-            // Read values into array
-            reading[TIME_IDX] = timestamp;
-            reading[ACC_X_IDX] = accX;
-            reading[ACC_Y_IDX] = accY;
-            reading[ACC_Z_IDX] = accZ;
-            reading[GYR_X_IDX] = gyrX;
-            reading[GYR_Y_IDX] = gyrY;
-            reading[GYR_Z_IDX] = gyrZ;
-
-            // Push array onto vector
-            raw_readings.push_back(reading);
+            timestamps[i] = sample_rate * i;
 
             // Increment our index
             reading_idx++;
         }
 
+        // Index the timestamps so the callbacks don't have to scan every reading
+        buildReadingIndex();
+
         // Reset timestamp readings for callbacks
         first_reading_timestamp = 0;
         is_first_reading = true;
@@ -142,7 +121,7 @@ int main(int argc, char **argv) {
 // Read accelerometer callback function
 int readAccelerometerCallback(float& x, float& y, float& z) {
 
-    // Return 0's if the readings vector is empty
+    // Return 0's if there are no readings
     if (raw_readings.empty()) {
         x = 0.0;
         y = 0.0;
@@ -162,9 +141,9 @@ int readAccelerometerCallback(float& x, float& y, float& z) {
     int closest_time_idx = findClosestIdx(elapsed);
 
     // Assign values from the row closest to the requested elapsed timestamp
-    x = raw_readings[closest_time_idx][ACC_X_IDX];
-    y = raw_readings[closest_time_idx][ACC_Y_IDX];
-    z = raw_readings[closest_time_idx][ACC_Z_IDX];
+    x = raw_readings.column(ACC_X_IDX)[closest_time_idx];
+    y = raw_readings.column(ACC_Y_IDX)[closest_time_idx];
+    z = raw_readings.column(ACC_Z_IDX)[closest_time_idx];
 
     return 1;
 }
@@ -172,7 +151,7 @@ int readAccelerometerCallback(float& x, float& y, float& z) {
 // Read gyroscope callback function
 int readGyroscopeCallback(float& x, float& y, float& z) {
 
-    // Return 0's if the readings vector is empty
+    // Return 0's if there are no readings
     if (raw_readings.empty()) {
         x = 0.0;
         y = 0.0;
@@ -192,29 +171,20 @@ int readGyroscopeCallback(float& x, float& y, float& z) {
     int closest_time_idx = findClosestIdx(elapsed);
 
     // Assign values from the row closest to the requested elapsed timestamp
-    x = raw_readings[closest_time_idx][GYR_X_IDX];
-    y = raw_readings[closest_time_idx][GYR_Y_IDX];
-    z = raw_readings[closest_time_idx][GYR_Z_IDX];
+    x = raw_readings.column(GYR_X_IDX)[closest_time_idx];
+    y = raw_readings.column(GYR_Y_IDX)[closest_time_idx];
+    z = raw_readings.column(GYR_Z_IDX)[closest_time_idx];
 
     return 1;
 }
 
-// Get closest reading from vector of readings
-int findClosestIdx(unsigned long time_ms) {
+// Index the timestamps of the raw readings (call after they change)
+void buildReadingIndex() {
+    reading_index.build(raw_readings.column(TIME_IDX), raw_readings.size());
+}
 
-    unsigned long closest_time = raw_readings[0][TIME_IDX];
-    int closest_time_idx = 0;
-    unsigned long num;
-
-    // Loop through timestamps in vector to find closest
-    for (long unsigned int i = 0; i < raw_readings.size(); i++) {
-        num = raw_readings[i][TIME_IDX];
-        if (abs((long long)time_ms - (long long)num) < 
-            abs((long long)time_ms - (long long)closest_time)) {
-                closest_time = num;
-                closest_time_idx = i;
-        }
-    }
+// Get index of the closest reading
+int findClosestIdx(unsigned long time_ms) {
 
-    return closest_time_idx;
+    return (int)reading_index.findClosest(time_ms);
 }
\ No newline at end of file
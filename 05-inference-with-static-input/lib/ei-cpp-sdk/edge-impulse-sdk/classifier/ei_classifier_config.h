@@ -69,6 +69,30 @@
     #endif // ESP32 check
 #endif
 
+// SSE4.2 / AVX2+FMA / AVX-512 float kernels on x86 hosts, picked at runtime
+// (see tensorflow/lite/micro/kernels/float_simd.h)
+#ifndef EI_CLASSIFIER_TFLITE_ENABLE_X86_SIMD
+    #if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+        #define EI_CLASSIFIER_TFLITE_ENABLE_X86_SIMD    1
+    #else
+        #define EI_CLASSIFIER_TFLITE_ENABLE_X86_SIMD    0
+    #endif
+#endif // EI_CLASSIFIER_TFLITE_ENABLE_X86_SIMD
+
+// Run classification models on the int8 quantized copy of the EON model
+// (see tflite-model/trained_model_int8.h) instead of the float one
+#ifndef EI_CLASSIFIER_TFLITE_USE_INT8_MODEL
+#define EI_CLASSIFIER_TFLITE_USE_INT8_MODEL     0
+#endif // EI_CLASSIFIER_TFLITE_USE_INT8_MODEL
+
+// Keep the prepared model, its arena, the impulse and the features matrices
+// from one inference to the next instead of setting them up and freeing them
+// every time (run_classifier_deinit() frees them). The features matrices are
+// shared, so only classify from one thread at a time.
+#ifndef EI_CLASSIFIER_KEEP_WARM
+#define EI_CLASSIFIER_KEEP_WARM                 0
+#endif // EI_CLASSIFIER_KEEP_WARM
+
 // no include checks in the compiler? then just include metadata and then ops_define (optional if on EON model)
 #ifndef __has_include
     #include "model-parameters/model_metadata.h"
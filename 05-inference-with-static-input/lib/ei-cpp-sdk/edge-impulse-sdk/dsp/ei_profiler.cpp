@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2022 EdgeImpulse Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an "AS
+ * IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ei_profiler.h"
+
+#if EI_PROFILER_ENABLED
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <mutex>
+#include <unistd.h>
+
+std::atomic<bool> ei_profiler_recording(false);
+
+namespace {
+
+typedef struct {
+    const char *name;
+    uint64_t start_ns;      // Monotonic clock
+    uint64_t dur_ns;
+    uint64_t cpu_start_ns;  // Thread CPU time
+    uint64_t cpu_dur_ns;
+    uint64_t id;            // Flow arrows only
+    char phase;             // 'X' span, 's' and 'f' start and end of an arrow
+} profiler_event_t;
+
+// One per thread that records or is named. Only the thread writes its
+// events; count is how many it has written since the last start.
+typedef struct profiler_thread {
+    profiler_event_t *events;
+    std::atomic<uint64_t> count;
+    const char *name;
+    int tid;
+    struct profiler_thread *next;
+} profiler_thread_t;
+
+// Every thread's buffer (kept until the process ends, so that threads that
+// have finished are still in the trace)
+std::mutex threads_lock;
+profiler_thread_t *threads = nullptr;
+int num_threads = 0;
+uint64_t origin_ns = 0;
+
+thread_local profiler_thread_t *this_thread = nullptr;
+
+profiler_thread_t *get_thread() {
+
+    if (this_thread != nullptr) {
+        return this_thread;
+    }
+
+    profiler_thread_t *thread = new profiler_thread_t();
+    thread->events = nullptr;
+    thread->count = 0;
+    thread->name = nullptr;
+
+    std::lock_guard<std::mutex> lock(threads_lock);
+    thread->tid = ++num_threads;
+    thread->next = threads;
+    threads = thread;
+    this_thread = thread;
+
+    return thread;
+}
+
+void record(const profiler_event_t &event) {
+
+    profiler_thread_t *thread = get_thread();
+
+    if (thread->events == nullptr) {
+        thread->events = (profiler_event_t *)calloc(EI_PROFILER_EVENTS_PER_THREAD,
+                                                    sizeof(profiler_event_t));
+        if (thread->events == nullptr) {
+            return;
+        }
+    }
+
+    uint64_t n = thread->count.load(std::memory_order_relaxed);
+    thread->events[n % EI_PROFILER_EVENTS_PER_THREAD] = event;
+    thread->count.store(n + 1, std::memory_order_release);
+}
+
+// Names are static strings from the code, but might still need escaping
+void write_json_string(FILE *file, const char *str) {
+
+    fputc('"', file);
+    for (; *str != '\0'; str++) {
+        if ((*str == '"') || (*str == '\\')) {
+            fputc('\\', file);
+            fputc(*str, file);
+        } else if ((unsigned char)*str < 0x20) {
+            fprintf(file, "\\u%04x", (unsigned char)*str);
+        } else {
+            fputc(*str, file);
+        }
+    }
+    fputc('"', file);
+}
+
+} // namespace
+
+void ei_profiler_start() {
+
+    std::lock_guard<std::mutex> lock(threads_lock);
+    for (profiler_thread_t *thread = threads; thread != nullptr; thread = thread->next) {
+        thread->count.store(0, std::memory_order_relaxed);
+    }
+    origin_ns = ei_profiler_now_ns();
+    ei_profiler_recording.store(true);
+}
+
+void ei_profiler_stop() {
+    ei_profiler_recording.store(false);
+}
+
+void ei_profiler_set_thread_name(const char *name) {
+    get_thread()->name = name;
+}
+
+void ei_profiler_record_span(const char *name, uint64_t start_ns, uint64_t cpu_start_ns) {
+
+    profiler_event_t event;
+
+    event.name = name;
+    event.start_ns = start_ns;
+    event.dur_ns = ei_profiler_now_ns() - start_ns;
+    event.cpu_start_ns = cpu_start_ns;
+    event.cpu_dur_ns = ei_profiler_thread_cpu_ns() - cpu_start_ns;
+    event.id = 0;
+    event.phase = 'X';
+    record(event);
+}
+
+void ei_profiler_record_flow(const char *name, uint64_t id, bool end) {
+
+    profiler_event_t event;
+
+    event.name = name;
+    event.start_ns = ei_profiler_now_ns();
+    event.dur_ns = 0;
+    event.cpu_start_ns = 0;
+    event.cpu_dur_ns = 0;
+    event.id = id;
+    event.phase = end ? 'f' : 's';
+    record(event);
+}
+
+int ei_profiler_write_chrome_trace(const char *path) {
+
+    FILE *file;
+    uint64_t count, first, overwritten = 0;
+    bool comma = false;
+    int pid = (int)getpid();
+
+    file = fopen(path, "w");
+    if (file == NULL) {
+        return -1;
+    }
+
+    std::lock_guard<std::mutex> lock(threads_lock);
+    fprintf(file, "{\"traceEvents\":[\n");
+    for (profiler_thread_t *thread = threads; thread != nullptr; thread = thread->next) {
+
+        // Thread names are metadata events
+        if (thread->name != nullptr) {
+            fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,"
+                    "\"tid\":%d,\"args\":{\"name\":", comma ? ",\n" : "", pid,
+                    thread->tid);
+            write_json_string(file, thread->name);
+            fprintf(file, "}}");
+            comma = true;
+        }
+
+        // Oldest event first (timestamps are in microseconds since the start)
+        count = thread->count.load(std::memory_order_acquire);
+        if ((thread->events == nullptr) || (count == 0)) {
+            continue;
+        }
+        first = (count > EI_PROFILER_EVENTS_PER_THREAD) ?
+                count - EI_PROFILER_EVENTS_PER_THREAD : 0;
+        overwritten += first;
+        for (uint64_t n = first; n < count; n++) {
+            const profiler_event_t &event = thread->events[n % EI_PROFILER_EVENTS_PER_THREAD];
+            double ts_us = (double)(int64_t)(event.start_ns - origin_ns) / 1000.0;
+
+            fprintf(file, "%s{\"name\":", comma ? ",\n" : "");
+            write_json_string(file, event.name);
+            fprintf(file, ",\"cat\":\"ei\",\"ph\":\"%c\",\"pid\":%d,\"tid\":%d,"
+                    "\"ts\":%.3f", event.phase, pid, thread->tid, ts_us);
+            if (event.phase == 'X') {
+                fprintf(file, ",\"dur\":%.3f,\"tts\":%.3f,\"tdur\":%.3f",
+                        event.dur_ns / 1000.0, event.cpu_start_ns / 1000.0,
+                        event.cpu_dur_ns / 1000.0);
+            } else {
+                fprintf(file, ",\"id\":%llu%s", (unsigned long long)event.id,
+                        (event.phase == 'f') ? ",\"bp\":\"e\"" : "");
+            }
+            fprintf(file, "}");
+            comma = true;
+        }
+    }
+    fprintf(file, "\n],\"displayTimeUnit\":\"ns\",\"otherData\":"
+            "{\"overwritten_events\":%llu}}\n", (unsigned long long)overwritten);
+
+    if (fclose(file) != 0) {
+        return -1;
+    }
+
+    return 0;
+}
+
+#endif // EI_PROFILER_ENABLED
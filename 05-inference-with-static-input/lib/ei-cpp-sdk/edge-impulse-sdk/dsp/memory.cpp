@@ -15,7 +15,118 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <stdint.h>
+#include <string.h>
 #include "memory.hpp"
 
 size_t ei_memory_in_use = 0;
 size_t ei_memory_peak_use = 0;
+
+#if defined(__linux__) || defined(__APPLE__) || defined(_WIN32)
+#define EI_DSP_THREAD_LOCAL thread_local
+#else
+#define EI_DSP_THREAD_LOCAL
+#endif
+
+namespace ei {
+
+namespace {
+
+typedef struct {
+    void *allocation;       // What ei_calloc() returned
+    uint8_t *buffer;        // Aligned start of the workspace
+    size_t size;
+    size_t used;
+    size_t needed;          // Used, plus what went to the heap for lack of room
+    size_t peak;
+    bool active;
+} workspace_t;
+
+EI_DSP_THREAD_LOCAL workspace_t workspace = { NULL, NULL, 0, 0, 0, 0, false };
+
+size_t workspace_align(size_t bytes) {
+    return (bytes + EI_DSP_WORKSPACE_ALIGN - 1) & ~((size_t)EI_DSP_WORKSPACE_ALIGN - 1);
+}
+
+} // namespace
+
+bool ei_dsp_workspace_reserve(size_t bytes) {
+    bytes = workspace_align(bytes);
+    if ((bytes <= workspace.size) || (workspace.used != 0)) {
+        return true;
+    }
+
+    void *allocation = ei_calloc(bytes + EI_DSP_WORKSPACE_ALIGN - 1, 1);
+    if (!allocation) {
+        return false;
+    }
+    ei_free(workspace.allocation);
+    workspace.allocation = allocation;
+    workspace.buffer = (uint8_t *)workspace_align((uintptr_t)allocation);
+    workspace.size = bytes;
+    return true;
+}
+
+void ei_dsp_workspace_begin() {
+    workspace.active = true;
+}
+
+void ei_dsp_workspace_end() {
+    workspace.active = false;
+}
+
+void ei_dsp_workspace_reset() {
+    size_t needed = workspace.needed;
+
+    workspace.used = 0;
+    workspace.needed = 0;
+    if (needed > workspace.size) {
+        ei_dsp_workspace_reserve(needed);
+    }
+}
+
+void ei_dsp_workspace_release() {
+    ei_free(workspace.allocation);
+    workspace.allocation = NULL;
+    workspace.buffer = NULL;
+    workspace.size = 0;
+    workspace.used = 0;
+    workspace.needed = 0;
+    workspace.active = false;
+}
+
+void *ei_dsp_workspace_calloc(size_t bytes) {
+    size_t aligned = workspace_align(bytes);
+
+    if (workspace.active && (bytes != 0)) {
+        workspace.needed += aligned;
+        if (workspace.needed > workspace.peak) {
+            workspace.peak = workspace.needed;
+        }
+        if (workspace.used + aligned <= workspace.size) {
+            uint8_t *ptr = workspace.buffer + workspace.used;
+            workspace.used += aligned;
+            memset(ptr, 0, bytes);
+            return ptr;
+        }
+    }
+    return ei_calloc(bytes, 1);
+}
+
+void ei_dsp_workspace_free(void *ptr) {
+    if (((uint8_t *)ptr >= workspace.buffer) &&
+            ((uint8_t *)ptr < workspace.buffer + workspace.size)) {
+        return;
+    }
+    ei_free(ptr);
+}
+
+size_t ei_dsp_workspace_size() {
+    return workspace.size;
+}
+
+size_t ei_dsp_workspace_peak() {
+    return workspace.peak;
+}
+
+} // namespace ei
@@ -31,6 +31,7 @@
 #include "config.hpp"
 
 #include "../porting/ei_classifier_porting.h"
+#include "ei_dsp_workspace.h"
 
 #if EIDSP_TRACK_ALLOCATIONS
 #include "memory.hpp"
@@ -91,7 +92,7 @@ typedef struct ei_matrix {
             buffer_managed_by_me = false;
         }
         else {
-            buffer = (float*)ei_calloc(n_rows * n_cols * sizeof(float), 1);
+            buffer = (float*)ei_dsp_workspace_calloc(n_rows * n_cols * sizeof(float));
             buffer_managed_by_me = true;
         }
         rows = n_rows;
@@ -116,7 +117,7 @@ typedef struct ei_matrix {
 
     ~ei_matrix() {
         if (buffer && buffer_managed_by_me) {
-            ei_free(buffer);
+            ei_dsp_workspace_free(buffer);
 
 #if EIDSP_TRACK_ALLOCATIONS
             if (_fn) {
@@ -188,7 +189,7 @@ typedef struct ei_matrix_i8 {
             buffer_managed_by_me = false;
         }
         else {
-            buffer = (int8_t*)ei_calloc(n_rows * n_cols * sizeof(int8_t), 1);
+            buffer = (int8_t*)ei_dsp_workspace_calloc(n_rows * n_cols * sizeof(int8_t));
             buffer_managed_by_me = true;
         }
         rows = n_rows;
@@ -213,7 +214,7 @@ typedef struct ei_matrix_i8 {
 
     ~ei_matrix_i8() {
         if (buffer && buffer_managed_by_me) {
-            ei_free(buffer);
+            ei_dsp_workspace_free(buffer);
 
 #if EIDSP_TRACK_ALLOCATIONS
             if (_fn) {
@@ -284,7 +285,7 @@ typedef struct ei_matrix_i32 {
             buffer_managed_by_me = false;
         }
         else {
-            buffer = (int32_t*)ei_calloc(n_rows * n_cols * sizeof(int32_t), 1);
+            buffer = (int32_t*)ei_dsp_workspace_calloc(n_rows * n_cols * sizeof(int32_t));
             buffer_managed_by_me = true;
         }
         rows = n_rows;
@@ -309,7 +310,7 @@ typedef struct ei_matrix_i32 {
 
     ~ei_matrix_i32() {
         if (buffer && buffer_managed_by_me) {
-            ei_free(buffer);
+            ei_dsp_workspace_free(buffer);
 
 #if EIDSP_TRACK_ALLOCATIONS
             if (_fn) {
@@ -391,7 +392,7 @@ typedef struct ei_quantized_matrix {
             buffer_managed_by_me = false;
         }
         else {
-            buffer = (uint8_t*)ei_calloc(n_rows * n_cols * sizeof(uint8_t), 1);
+            buffer = (uint8_t*)ei_dsp_workspace_calloc(n_rows * n_cols * sizeof(uint8_t));
             buffer_managed_by_me = true;
         }
         rows = n_rows;
@@ -416,7 +417,7 @@ typedef struct ei_quantized_matrix {
 
     ~ei_quantized_matrix() {
         if (buffer && buffer_managed_by_me) {
-            ei_free(buffer);
+            ei_dsp_workspace_free(buffer);
 
 #if EIDSP_TRACK_ALLOCATIONS
             if (_fn) {
@@ -480,6 +481,23 @@ typedef struct ei_signal_t {
 #endif // EIDSP_SIGNAL_C_FN_POINTER == 1
 
     size_t total_length;
+
+    /**
+     * Optional: the signal's samples in memory, as up to two contiguous
+     * segments (the second one is for a ring buffer that wraps around).
+     * When span[0] is set, numpy::signal_read() copies straight from the
+     * segments instead of calling get_data, and blocks can read in place.
+     * Set by numpy::signal_from_buffer() and numpy::signal_from_ring().
+     * Setting get_data by hand doesn't clear them: call
+     * numpy::signal_clear_span() too when reusing a signal.
+     */
+#ifdef __cplusplus
+    const float *span[2] = { nullptr, nullptr };
+    size_t span_length[2] = { 0, 0 };
+#else
+    const float *span[2];
+    size_t span_length[2];
+#endif // __cplusplus
 } signal_t;
 
 #ifdef __cplusplus
@@ -0,0 +1,78 @@
+/* Float fully connected and softmax kernels with runtime SIMD dispatch.
+
+On x86 hosts (EI_CLASSIFIER_TFLITE_ENABLE_X86_SIMD == 1) the best of SSE4.2,
+AVX2+FMA and AVX-512 that the CPU and OS support is picked the first time a
+kernel runs (cpuid, via __builtin_cpu_supports). Each variant is compiled with
+a target attribute, so the rest of the library needs no -m flags and the
+binary still runs on CPUs without them. Elsewhere, or on CPUs without SSE4.2,
+the portable kernels run, which give exactly the same results as
+reference_ops::FullyConnected() and reference_ops::Softmax().
+
+The SIMD kernels sum in a different order than the reference kernels, and
+softmax uses a polynomial exp(), so their results are within a few ULP of the
+reference rather than bit-identical. Every output is computed the same way no
+matter how many rows are passed in one call, so running rows one at a time
+or as a batch gives identical results at any one level.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_KERNELS_FLOAT_SIMD_H_
+#define TENSORFLOW_LITE_MICRO_KERNELS_FLOAT_SIMD_H_
+
+namespace tflite {
+namespace float_simd {
+
+// Kernel variants, from slowest to fastest
+enum SimdLevel {
+  kSimdPortable = 0,
+  kSimdSse42,
+  kSimdAvx2Fma,
+  kSimdAvx512,
+  kSimdLevelCount
+};
+
+// The best level this CPU supports, and the level the kernels use (the best
+// one unless changed with SetSimdLevel()).
+SimdLevel DetectedSimdLevel();
+SimdLevel GetSimdLevel();
+
+// Makes the kernels use the given level, or the best supported one below it.
+// Returns the level now in use. Meant for tests and benchmarks: don't call it
+// while kernels are running on other threads.
+SimdLevel SetSimdLevel(SimdLevel level);
+
+const char* SimdLevelName(SimdLevel level);
+
+// output[r][o] = clamp(sum_d input[r][d] * weights[o][d] + bias[o]) for rows
+// rows of depth inputs and outputs outputs (bias may be null).
+void FullyConnected(const float* input, int rows, int depth,
+                    const float* weights, const float* bias, int outputs,
+                    float activation_min, float activation_max,
+                    float* output);
+
+// output[o] += sum_d input[d] * weights[d][o] for depth inputs and outputs
+// outputs. The weights are stored the other way round from FullyConnected(),
+// which suits layers with few inputs and many outputs: every output is a
+// vector lane, so no sums have to be added across lanes.
+void MultiplyAccumulate(const float* input, int depth, const float* weights,
+                        int outputs, float* output);
+
+// Softmax over each of rows rows of depth values.
+void Softmax(const float* input, int rows, int depth, float beta,
+             float* output);
+
+}  // namespace float_simd
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_KERNELS_FLOAT_SIMD_H_
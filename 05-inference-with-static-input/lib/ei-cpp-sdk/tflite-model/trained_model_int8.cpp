@@ -0,0 +1,90 @@
+/**
+ * Int8 per-channel quantized copy of the compiled model
+ *
+ * License: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/float_simd.h"
+#include "edge-impulse-sdk/porting/ei_classifier_porting.h"
+#include "edge-impulse-sdk/dsp/ei_profiler.h"
+#include "tflite-model/trained_model_compiled.h"
+#include "tflite-model/trained_model_int8.h"
+
+// One scratch buffer per thread where the platform has thread-local storage
+#if defined(__linux__) || defined(__APPLE__) || defined(_WIN32)
+#define EI_MODEL_THREAD_LOCAL thread_local
+#else
+#define EI_MODEL_THREAD_LOCAL
+#endif
+
+using namespace tflite;
+
+namespace {
+
+// Allocated on the first call and kept until trained_model_int8_reset()
+EI_MODEL_THREAD_LOCAL int8_t *scratch = NULL;
+
+} // namespace
+
+TfLiteStatus trained_model_int8_invoke_batch(const float *input, float *output, size_t batch_size) {
+  EI_PROFILER_SCOPE("invoke int8");
+  const trained_model_int8_t &model = trained_model_int8;
+  const int input_size = model.layers[0].depth;
+  const int output_size = model.layers[model.layer_count - 1].outputs;
+
+  // Two tiles of the widest layer; each layer reads one and writes the other
+  int width = input_size;
+  for (size_t i = 0; i < model.layer_count; ++i) {
+    width = std::max(width, model.layers[i].outputs);
+  }
+  if (!scratch) {
+    scratch = (int8_t *)ei_malloc(2 * (size_t)width * TRAINED_MODEL_BATCH_TILE);
+    if (!scratch) {
+      ei_printf("ERR: failed to allocate batch buffers\n");
+      return kTfLiteError;
+    }
+  }
+
+  for (size_t row = 0; row < batch_size; row += TRAINED_MODEL_BATCH_TILE) {
+    int rows = (int)std::min((size_t)TRAINED_MODEL_BATCH_TILE, batch_size - row);
+    int8_t *in = scratch;
+    int8_t *out = scratch + (size_t)width * TRAINED_MODEL_BATCH_TILE;
+
+    int8_simd::Quantize(input + row * input_size, rows * input_size,
+                        model.input_scale, model.input_zero_point, in);
+
+    for (size_t i = 0; i < model.layer_count; ++i) {
+      EI_PROFILER_SCOPE("FULLY_CONNECTED int8");
+      int8_simd::FullyConnected(model.layers[i], in, rows, out);
+      std::swap(in, out);
+    }
+
+    // Softmax runs in place on the dequantized outputs
+    float *y = output + row * output_size;
+    for (int i = 0; i < rows * output_size; ++i) {
+      y[i] = (in[i] - model.output_zero_point) * model.output_scale;
+    }
+    EI_PROFILER_SCOPE("SOFTMAX");
+    float_simd::Softmax(y, rows, output_size, model.softmax_beta, y);
+  }
+
+  return kTfLiteOk;
+}
+
+void trained_model_int8_reset() {
+  ei_free(scratch);
+  scratch = NULL;
+}
@@ -0,0 +1,63 @@
+/**
+ * Int8 per-channel quantized copy of the compiled model
+ *
+ * The parameters (trained_model_int8_data.cpp) are generated from the float
+ * model by tools/quantize_model.cpp, which calibrates the activation ranges on
+ * recordings. Weights are symmetric int8 with one scale per output channel,
+ * activations are asymmetric int8 with one scale per tensor (the TFLite int8
+ * scheme), and the layers run on the int8 kernels in
+ * edge-impulse-sdk/tensorflow/lite/micro/kernels/int8_simd.h.
+ *
+ * The model takes and returns the same float rows as the compiled model: the
+ * input is quantized on the way in, and the last layer's outputs are
+ * dequantized and put through a float softmax.
+ *
+ * License: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef trained_model_INT8_H
+#define trained_model_INT8_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "edge-impulse-sdk/tensorflow/lite/c/common.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/int8_simd.h"
+
+// A chain of quantized fully connected layers followed by a softmax
+typedef struct {
+  float input_scale;                  // Quantization of the model input
+  int32_t input_zero_point;
+  float output_scale;                 // Quantization of the last layer's output
+  int32_t output_zero_point;
+  float softmax_beta;
+  size_t layer_count;
+  const tflite::int8_simd::FullyConnectedParams *layers;
+} trained_model_int8_t;
+
+// The generated parameters
+extern const trained_model_int8_t trained_model_int8;
+
+// Runs inference on batch_size inputs at once, like
+// trained_model_invoke_batch(): input holds one float row per input and
+// output gets one row of probabilities per input. Safe to call from any
+// number of threads at the same time on platforms with thread-local storage.
+// The first call on a thread allocates its scratch buffers, and later calls
+// reuse them.
+TfLiteStatus trained_model_int8_invoke_batch(const float *input, float *output, size_t batch_size);
+// Frees this thread's scratch buffers (the next call allocates them again).
+void trained_model_int8_reset();
+
+#endif // trained_model_INT8_H
@@ -49,6 +49,26 @@ static float *ei_dsp_cont_current_frame = nullptr;
 static size_t ei_dsp_cont_current_frame_size = 0;
 static int ei_dsp_cont_current_frame_ix = 0;
 
+// statistics of one axis over one slice, for continuous flatten; slices are
+// merged with the pairwise formulas for central moments (Pebay, 2008), which
+// don't lose precision like power sums do
+typedef struct {
+    double count;
+    double mean;
+    double m2;      // sums of (x - mean)^n
+    double m3;
+    double m4;
+    double sum_squares;
+    float min;
+    float max;
+} ei_dsp_flatten_moments_t;
+
+// the last EI_CLASSIFIER_SLICES_PER_MODEL_WINDOW slices' statistics, per axis
+static ei_dsp_flatten_moments_t *ei_dsp_cont_flatten_slices = nullptr;
+static size_t ei_dsp_cont_flatten_axes = 0;
+static int ei_dsp_cont_flatten_slice_ix = 0;
+static int ei_dsp_cont_flatten_slice_count = 0;
+
 __attribute__((unused)) int extract_spectral_analysis_features(
     signal_t *signal,
     matrix_t *output_matrix,
@@ -63,7 +83,10 @@ __attribute__((unused)) int extract_spectral_analysis_features(
         EIDSP_ERR(EIDSP_OUT_OF_MEM);
     }
 
-    signal->get_data(0, signal->total_length, input_matrix.buffer);
+    int ret = numpy::signal_read(signal, 0, input_matrix.rows * input_matrix.cols, input_matrix.buffer);
+    if (ret != EIDSP_OK) {
+        EIDSP_ERR(ret);
+    }
 
 #if EI_DSP_PARAMS_SPECTRAL_ANALYSIS_ANALYSIS_TYPE_WAVELET || EI_DSP_PARAMS_ALL
     if (strcmp(config->analysis_type, "Wavelet") == 0) {
@@ -111,19 +134,6 @@ __attribute__((unused)) int extract_spectral_analysis_features(
 __attribute__((unused)) int extract_raw_features(signal_t *signal, matrix_t *output_matrix, void *config_ptr, const float frequency) {
     ei_dsp_config_raw_t config = *((ei_dsp_config_raw_t*)config_ptr);
 
-    // input matrix from the raw signal
-    matrix_t input_matrix(signal->total_length / config.axes, config.axes);
-    if (!input_matrix.buffer) {
-        EIDSP_ERR(EIDSP_OUT_OF_MEM);
-    }
-    signal->get_data(0, signal->total_length, input_matrix.buffer);
-
-    // scale the signal
-    int ret = numpy::scale(&input_matrix, config.scale_axes);
-    if (ret != EIDSP_OK) {
-        EIDSP_ERR(ret);
-    }
-
     // Because of rounding errors during re-sampling the output size of the block might be
     // smaller than the input of the block. Make sure we don't write outside of the bounds
     // of the array:
@@ -133,7 +143,60 @@ __attribute__((unused)) int extract_raw_features(signal_t *signal, matrix_t *out
         els_to_copy = output_matrix->rows * output_matrix->cols;
     }
 
-    memcpy(output_matrix->buffer, input_matrix.buffer, els_to_copy * sizeof(float));
+    // read the signal straight into the output matrix and scale it there
+    matrix_t output_matrix_used(1, els_to_copy, output_matrix->buffer);
+    int ret = numpy::signal_read(signal, 0, els_to_copy, output_matrix_used.buffer);
+    if (ret != EIDSP_OK) {
+        EIDSP_ERR(ret);
+    }
+
+    ret = numpy::scale(&output_matrix_used, config.scale_axes);
+    if (ret != EIDSP_OK) {
+        EIDSP_ERR(ret);
+    }
+
+    return EIDSP_OK;
+}
+
+/**
+ * Raw features for continuous classification. Raw features are the scaled
+ * readings themselves, so the window's features are rolled back by one slice
+ * and only the new slice is scaled into the end of the matrix.
+ */
+__attribute__((unused)) int extract_raw_per_slice_features(signal_t *signal, matrix_t *output_matrix, void *config_ptr, const float frequency, matrix_size_t *matrix_size_out) {
+    ei_dsp_config_raw_t config = *((ei_dsp_config_raw_t*)config_ptr);
+
+    size_t output_size = output_matrix->rows * output_matrix->cols;
+
+    // a slice longer than the window only leaves its last readings
+    size_t els_to_copy = signal->total_length;
+    size_t offset_in_signal = 0;
+    if (els_to_copy > output_size) {
+        offset_in_signal = els_to_copy - output_size;
+        els_to_copy = output_size;
+    }
+
+    // we roll the output matrix back so we have room at the end...
+    int ret = numpy::roll(output_matrix->buffer, output_size, -(int)els_to_copy);
+    if (ret != EIDSP_OK) {
+        EIDSP_ERR(ret);
+    }
+
+    matrix_t output_matrix_slice(els_to_copy / config.axes, config.axes,
+        output_matrix->buffer + (output_size - els_to_copy));
+    ret = numpy::signal_read(signal, offset_in_signal, els_to_copy, output_matrix_slice.buffer);
+    if (ret != EIDSP_OK) {
+        EIDSP_ERR(ret);
+    }
+
+    // scale the signal
+    ret = numpy::scale(&output_matrix_slice, config.scale_axes);
+    if (ret != EIDSP_OK) {
+        EIDSP_ERR(ret);
+    }
+
+    matrix_size_out->rows = output_matrix_slice.rows;
+    matrix_size_out->cols = output_matrix_slice.cols;
 
     return EIDSP_OK;
 }
@@ -162,7 +225,10 @@ __attribute__((unused)) int extract_flatten_features(signal_t *signal, matrix_t
     if (!input_matrix.buffer) {
         EIDSP_ERR(EIDSP_OUT_OF_MEM);
     }
-    signal->get_data(0, signal->total_length, input_matrix.buffer);
+    ret = numpy::signal_read(signal, 0, input_matrix.rows * input_matrix.cols, input_matrix.buffer);
+    if (ret != EIDSP_OK) {
+        EIDSP_ERR(ret);
+    }
 
     // scale the signal
     ret = numpy::scale(&input_matrix, config.scale_axes);
@@ -240,6 +306,187 @@ __attribute__((unused)) int extract_flatten_features(signal_t *signal, matrix_t
     return EIDSP_OK;
 }
 
+/**
+ * Flatten features for continuous classification. The statistics of every
+ * slice are kept (per axis) for EI_CLASSIFIER_SLICES_PER_MODEL_WINDOW slices,
+ * so only the new slice's readings are visited and the window's statistics
+ * are merged from the slices. Results match extract_flatten_features() up
+ * to rounding. Features are only reported as written once the window is full.
+ */
+__attribute__((unused)) int extract_flatten_per_slice_features(signal_t *signal, matrix_t *output_matrix, void *config_ptr, const float frequency, matrix_size_t *matrix_size_out) {
+    ei_dsp_config_flatten_t config = *((ei_dsp_config_flatten_t*)config_ptr);
+    const int slices = EI_CLASSIFIER_SLICES_PER_MODEL_WINDOW;
+
+    uint32_t expected_matrix_size = 0;
+    if (config.average) expected_matrix_size += config.axes;
+    if (config.minimum) expected_matrix_size += config.axes;
+    if (config.maximum) expected_matrix_size += config.axes;
+    if (config.rms) expected_matrix_size += config.axes;
+    if (config.stdev) expected_matrix_size += config.axes;
+    if (config.skewness) expected_matrix_size += config.axes;
+    if (config.kurtosis) expected_matrix_size += config.axes;
+
+    if (output_matrix->rows * output_matrix->cols != expected_matrix_size) {
+        EIDSP_ERR(EIDSP_MATRIX_SIZE_MISMATCH);
+    }
+
+    if (signal->total_length < (size_t)config.axes) {
+        EIDSP_ERR(EIDSP_PARAMETER_INVALID);
+    }
+
+    int ret;
+
+    // have slice statistics, but for another number of axes? then free
+    if (ei_dsp_cont_flatten_slices && ei_dsp_cont_flatten_axes != (size_t)config.axes) {
+        ei_free(ei_dsp_cont_flatten_slices);
+        ei_dsp_cont_flatten_slices = nullptr;
+    }
+
+    if (!ei_dsp_cont_flatten_slices) {
+        ei_dsp_cont_flatten_slices = (ei_dsp_flatten_moments_t*)ei_calloc(
+            slices * config.axes * sizeof(ei_dsp_flatten_moments_t), 1);
+        if (!ei_dsp_cont_flatten_slices) {
+            EIDSP_ERR(EIDSP_OUT_OF_MEM);
+        }
+        ei_dsp_cont_flatten_axes = config.axes;
+        ei_dsp_cont_flatten_slice_ix = 0;
+        ei_dsp_cont_flatten_slice_count = 0;
+    }
+
+    // input matrix from the raw signal
+    matrix_t input_matrix(signal->total_length / config.axes, config.axes);
+    if (!input_matrix.buffer) {
+        EIDSP_ERR(EIDSP_OUT_OF_MEM);
+    }
+    ret = numpy::signal_read(signal, 0, input_matrix.rows * input_matrix.cols, input_matrix.buffer);
+    if (ret != EIDSP_OK) {
+        EIDSP_ERR(ret);
+    }
+
+    // scale the signal
+    ret = numpy::scale(&input_matrix, config.scale_axes);
+    if (ret != EIDSP_OK) {
+        ei_printf("ERR: Failed to scale signal (%d)\n", ret);
+        EIDSP_ERR(ret);
+    }
+
+    // statistics of the new slice replace those of the oldest one
+    ei_dsp_flatten_moments_t *slice_moments =
+        &ei_dsp_cont_flatten_slices[ei_dsp_cont_flatten_slice_ix * config.axes];
+
+    for (size_t axis = 0; axis < input_matrix.cols; axis++) {
+        ei_dsp_flatten_moments_t *m = &slice_moments[axis];
+        double sum = 0.0;
+
+        m->min = FLT_MAX;
+        m->max = -FLT_MAX;
+        m->sum_squares = 0.0;
+        for (size_t row = 0; row < input_matrix.rows; row++) {
+            float v = input_matrix.buffer[(row * input_matrix.cols) + axis];
+            sum += v;
+            m->sum_squares += (double)v * v;
+            if (v < m->min) m->min = v;
+            if (v > m->max) m->max = v;
+        }
+        m->count = input_matrix.rows;
+        m->mean = sum / m->count;
+
+        m->m2 = 0.0;
+        m->m3 = 0.0;
+        m->m4 = 0.0;
+        for (size_t row = 0; row < input_matrix.rows; row++) {
+            double diff = input_matrix.buffer[(row * input_matrix.cols) + axis] - m->mean;
+            double square_diff = diff * diff;
+            m->m2 += square_diff;
+            m->m3 += square_diff * diff;
+            m->m4 += square_diff * square_diff;
+        }
+    }
+
+    ei_dsp_cont_flatten_slice_ix = (ei_dsp_cont_flatten_slice_ix + 1) % slices;
+    if (ei_dsp_cont_flatten_slice_count < slices) {
+        ei_dsp_cont_flatten_slice_count++;
+    }
+
+    size_t out_matrix_ix = 0;
+
+    for (int axis = 0; axis < config.axes; axis++) {
+
+        // merge the slices in the window, oldest first
+        ei_dsp_flatten_moments_t w = { 0 };
+        w.min = FLT_MAX;
+        w.max = -FLT_MAX;
+        for (int i = 0; i < ei_dsp_cont_flatten_slice_count; i++) {
+            int slice_ix = (ei_dsp_cont_flatten_slice_ix + slices - ei_dsp_cont_flatten_slice_count + i) % slices;
+            const ei_dsp_flatten_moments_t *b = &ei_dsp_cont_flatten_slices[(slice_ix * config.axes) + axis];
+
+            double n = w.count + b->count;
+            double delta = b->mean - w.mean;
+            double delta_n = delta / n;
+            double term = delta * delta_n * w.count * b->count;
+
+            w.m4 += b->m4 + term * delta_n * delta_n * ((w.count * w.count) - (w.count * b->count) + (b->count * b->count)) +
+                6.0 * delta_n * delta_n * ((w.count * w.count * b->m2) + (b->count * b->count * w.m2)) +
+                4.0 * delta_n * ((w.count * b->m3) - (b->count * w.m3));
+            w.m3 += b->m3 + term * delta_n * (w.count - b->count) +
+                3.0 * delta_n * ((w.count * b->m2) - (b->count * w.m2));
+            w.m2 += b->m2 + term;
+            w.mean += delta_n * b->count;
+            w.count = n;
+            w.sum_squares += b->sum_squares;
+            if (b->min < w.min) w.min = b->min;
+            if (b->max > w.max) w.max = b->max;
+        }
+
+        double variance = w.m2 / w.count;
+
+        if (config.average) {
+            output_matrix->buffer[out_matrix_ix++] = (float)w.mean;
+        }
+
+        if (config.minimum) {
+            output_matrix->buffer[out_matrix_ix++] = w.min;
+        }
+
+        if (config.maximum) {
+            output_matrix->buffer[out_matrix_ix++] = w.max;
+        }
+
+        if (config.rms) {
+            output_matrix->buffer[out_matrix_ix++] = (float)sqrt(w.sum_squares / w.count);
+        }
+
+        if (config.stdev) {
+            output_matrix->buffer[out_matrix_ix++] = (float)sqrt(variance);
+        }
+
+        if (config.skewness) {
+            double m_2 = sqrt(variance * variance * variance);
+            output_matrix->buffer[out_matrix_ix++] = (m_2 == 0.0) ? 0.0f : (float)((w.m3 / w.count) / m_2);
+        }
+
+        if (config.kurtosis) {
+            double m_2 = variance * variance;
+            output_matrix->buffer[out_matrix_ix++] = (m_2 == 0.0) ? -3.0f : (float)(((w.m4 / w.count) / m_2) - 3.0);
+        }
+    }
+
+    // flatten again
+    output_matrix->cols = output_matrix->rows * output_matrix->cols;
+    output_matrix->rows = 1;
+
+    if (ei_dsp_cont_flatten_slice_count < slices) {
+        matrix_size_out->rows = 0;
+        matrix_size_out->cols = 0;
+    }
+    else {
+        matrix_size_out->rows = 1;
+        matrix_size_out->cols = output_matrix->cols;
+    }
+
+    return EIDSP_OK;
+}
+
 static class speechpy::processing::preemphasis *preemphasis;
 static int preemphasized_audio_signal_get_data(size_t offset, size_t length, float *out_ptr) {
     return preemphasis->get_data(offset, length, out_ptr);
@@ -269,6 +516,7 @@ __attribute__((unused)) int extract_mfcc_features(signal_t *signal, matrix_t *ou
     signal_t preemphasized_audio_signal;
     preemphasized_audio_signal.total_length = signal->total_length;
     preemphasized_audio_signal.get_data = &preemphasized_audio_signal_get_data;
+    numpy::signal_clear_span(&preemphasized_audio_signal);
 
     // calculate the size of the MFCC matrix
     matrix_size_t out_matrix_size =
@@ -378,6 +626,7 @@ __attribute__((unused)) int extract_mfcc_per_slice_features(signal_t *signal, ma
     signal_t preemphasized_audio_signal;
     preemphasized_audio_signal.total_length = signal->total_length;
     preemphasized_audio_signal.get_data = &preemphasized_audio_signal_get_data;
+    numpy::signal_clear_span(&preemphasized_audio_signal);
 
     // Go from the time (e.g. 0.25 seconds to number of frames based on freq)
     const size_t frame_length_values = frequency * config.frame_length;
@@ -814,6 +1063,7 @@ __attribute__((unused)) int extract_mfe_features(signal_t *signal, matrix_t *out
 
         preemphasized_audio_signal.total_length = signal->total_length;
         preemphasized_audio_signal.get_data = signal->get_data;
+        numpy::signal_copy_span(&preemphasized_audio_signal, signal);
     }
     else {
         // preemphasis class to preprocess the audio...
@@ -822,6 +1072,7 @@ __attribute__((unused)) int extract_mfe_features(signal_t *signal, matrix_t *out
 
         preemphasized_audio_signal.total_length = signal->total_length;
         preemphasized_audio_signal.get_data = &preemphasized_audio_signal_get_data;
+        numpy::signal_clear_span(&preemphasized_audio_signal);
     }
 
     // calculate the size of the MFE matrix
@@ -975,6 +1226,7 @@ __attribute__((unused)) int extract_mfe_per_slice_features(signal_t *signal, mat
         preemphasis = nullptr;
         preemphasized_audio_signal.total_length = signal->total_length;
         preemphasized_audio_signal.get_data = signal->get_data;
+        numpy::signal_copy_span(&preemphasized_audio_signal, signal);
     }
     else {
         // preemphasis class to preprocess the audio...
@@ -982,6 +1234,7 @@ __attribute__((unused)) int extract_mfe_per_slice_features(signal_t *signal, mat
         preemphasis = pre;
         preemphasized_audio_signal.total_length = signal->total_length;
         preemphasized_audio_signal.get_data = &preemphasized_audio_signal_get_data;
+        numpy::signal_clear_span(&preemphasized_audio_signal);
     }
 
     // Go from the time (e.g. 0.25 seconds to number of frames based on freq)
@@ -1374,6 +1627,23 @@ __attribute__((unused)) int ei_dsp_clear_continuous_audio_state() {
     return EIDSP_OK;
 }
 
+/**
+ * Clear all state regarding continuous flatten (the per-slice moments). Invoke this function
+ * after the continuous loop ends.
+ */
+__attribute__((unused)) int ei_dsp_clear_continuous_flatten_state() {
+    if (ei_dsp_cont_flatten_slices) {
+        ei_free(ei_dsp_cont_flatten_slices);
+    }
+
+    ei_dsp_cont_flatten_slices = nullptr;
+    ei_dsp_cont_flatten_axes = 0;
+    ei_dsp_cont_flatten_slice_ix = 0;
+    ei_dsp_cont_flatten_slice_count = 0;
+
+    return EIDSP_OK;
+}
+
 /**
  * @brief      Calculates the cepstral mean and variable normalization.
  *
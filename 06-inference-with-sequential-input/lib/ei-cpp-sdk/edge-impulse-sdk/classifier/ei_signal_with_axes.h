@@ -19,6 +19,7 @@
 #define _EI_CLASSIFIER_SIGNAL_WITH_AXES_H_
 
 #include "edge-impulse-sdk/dsp/numpy_types.h"
+#include "edge-impulse-sdk/dsp/numpy.hpp"
 #include "edge-impulse-sdk/dsp/returntypes.hpp"
 #include "edge-impulse-sdk/classifier/ei_model_types.h"
 
@@ -47,6 +48,7 @@ public:
             return this->get_data(offset, length, out_ptr);
         };
 #endif
+        numpy::signal_clear_span(&wrapped_signal);
         return &wrapped_signal;
     }
 
@@ -28,9 +28,14 @@
 #include "edge-impulse-sdk/tensorflow/lite/c/common.h"
 #include "edge-impulse-sdk/tensorflow/lite/kernels/internal/tensor_ctypes.h"
 #include "tflite-model/trained_model_compiled.h"
+#if EI_CLASSIFIER_TFLITE_USE_INT8_MODEL == 1
+#include "tflite-model/trained_model_int8.h"
+#endif
 #include "edge-impulse-sdk/classifier/ei_aligned_malloc.h"
+#include "edge-impulse-sdk/classifier/ei_classifier_config.h"
 #include "edge-impulse-sdk/classifier/ei_fill_result_struct.h"
 #include "edge-impulse-sdk/classifier/ei_model_types.h"
+#include "edge-impulse-sdk/dsp/ei_profiler.h"
 
 #if defined(EI_CLASSIFIER_ENABLE_DETECTION_POSTPROCESS_OP)
 namespace tflite {
@@ -66,9 +71,16 @@ static EI_IMPULSE_ERROR inference_tflite_setup(const ei_impulse_t *impulse, uint
     TfLiteTensor** output_scores,
     ei_unique_ptr_t& p_tensor_arena) {
 
+    EI_PROFILER_SCOPE("nn setup");
+
     *ctx_start_us = ei_read_timer_us();
 
+#if EI_CLASSIFIER_KEEP_WARM
+    // Set up on the first inference, then kept until inference_tflite_release()
+    TfLiteStatus init_status = trained_model_init_once(ei_aligned_calloc);
+#else
     TfLiteStatus init_status = trained_model_init(ei_aligned_calloc);
+#endif
     if (init_status != kTfLiteOk) {
         ei_printf("Failed to allocate TFLite arena (error code %d)\n", init_status);
         return EI_IMPULSE_TFLITE_ARENA_ALLOC_FAILED;
@@ -193,7 +205,9 @@ static EI_IMPULSE_ERROR inference_tflite_run(const ei_impulse_t *impulse,
         }
     }
 
+#if !EI_CLASSIFIER_KEEP_WARM
     trained_model_reset(ei_aligned_free);
+#endif
 
     if (fill_res != EI_IMPULSE_OK) {
         return fill_res;
@@ -207,6 +221,27 @@ static EI_IMPULSE_ERROR inference_tflite_run(const ei_impulse_t *impulse,
 }
 
 
+/**
+ * Free the model kept warm between inferences (EI_CLASSIFIER_KEEP_WARM), if
+ * it is set up, and the int8 model's scratch buffers
+ */
+__attribute__((unused)) static void inference_tflite_release() {
+#if EI_CLASSIFIER_KEEP_WARM
+    trained_model_reset(ei_aligned_free);
+#endif
+#if EI_CLASSIFIER_TFLITE_USE_INT8_MODEL == 1
+    trained_model_int8_reset();
+#endif
+}
+
+#if EI_CLASSIFIER_TFLITE_USE_INT8_MODEL == 1
+EI_IMPULSE_ERROR run_nn_inference_batch(
+    const ei_impulse_t *impulse,
+    ei::matrix_t *fmatrix,
+    ei_impulse_result_t *results,
+    bool debug);
+#endif
+
 /**
  * @brief      Do neural network inferencing over the processed feature matrix
  *
@@ -222,6 +257,13 @@ EI_IMPULSE_ERROR run_nn_inference(
     ei_impulse_result_t *result,
     bool debug = false)
 {
+#if EI_CLASSIFIER_TFLITE_USE_INT8_MODEL == 1
+    // The int8 model only has the batch entry point; one row is a batch of one
+    if (!impulse->object_detection) {
+        return run_nn_inference_batch(impulse, fmatrix, result, debug);
+    }
+#endif
+
     TfLiteTensor* input;
     TfLiteTensor* output;
     TfLiteTensor* output_scores;
@@ -245,6 +287,16 @@ EI_IMPULSE_ERROR run_nn_inference(
 
     switch (input->type) {
         case kTfLiteFloat32: {
+            // The model reads the features where they are when they fill the
+            // whole input tensor
+            if ((fmatrix->rows * fmatrix->cols * sizeof(float) == input->bytes) &&
+                (trained_model_set_input_data(0, fmatrix->buffer) == kTfLiteOk)) {
+                break;
+            }
+#if EI_CLASSIFIER_KEEP_WARM
+            // A warm model may still point at an earlier features matrix
+            trained_model_set_input_data(0, nullptr);
+#endif
             for (size_t ix = 0; ix < fmatrix->rows * fmatrix->cols; ix++) {
                 input->data.f[ix] = fmatrix->buffer[ix];
             }
@@ -282,6 +334,61 @@ EI_IMPULSE_ERROR run_nn_inference(
     return EI_IMPULSE_OK;
 }
 
+/**
+ * @brief      Do neural network inferencing over a batch of feature rows at once
+ *             (float classification models only)
+ *
+ * @param      fmatrix  Processed matrix, one row of features per result
+ * @param      results  Output classifier results, one per row of fmatrix
+ * @param[in]  debug    Debug output enable
+ *
+ * @return     The ei impulse error.
+ */
+EI_IMPULSE_ERROR run_nn_inference_batch(
+    const ei_impulse_t *impulse,
+    ei::matrix_t *fmatrix,
+    ei_impulse_result_t *results,
+    bool debug = false)
+{
+    uint64_t ctx_start_us = ei_read_timer_us();
+
+    ei::matrix_t outputs(fmatrix->rows, impulse->label_count);
+    if (!outputs.buffer) {
+        return EI_IMPULSE_ALLOC_FAILED;
+    }
+
+#if EI_CLASSIFIER_TFLITE_USE_INT8_MODEL == 1
+    TfLiteStatus status = trained_model_int8_invoke_batch(fmatrix->buffer, outputs.buffer, fmatrix->rows);
+#else
+    TfLiteStatus status = trained_model_invoke_batch(fmatrix->buffer, outputs.buffer, fmatrix->rows);
+#endif
+    if (status != kTfLiteOk) {
+        return EI_IMPULSE_TFLITE_ERROR;
+    }
+
+    // Every row gets its share of the time the batch took
+    uint64_t classification_us = (ei_read_timer_us() - ctx_start_us) / fmatrix->rows;
+
+    for (size_t row = 0; row < fmatrix->rows; row++) {
+        ei_impulse_result_t *result = &results[row];
+
+        result->timing.classification_us = classification_us;
+        result->timing.classification = (int)(classification_us / 1000);
+
+        if (debug) {
+            ei_printf("Predictions (time: %d ms.):\n", result->timing.classification);
+        }
+
+        EI_IMPULSE_ERROR fill_res = fill_result_struct_f32(impulse, result,
+            outputs.buffer + (row * impulse->label_count), debug);
+        if (fill_res != EI_IMPULSE_OK) {
+            return fill_res;
+        }
+    }
+
+    return EI_IMPULSE_OK;
+}
+
 #if EI_CLASSIFIER_TFLITE_INPUT_QUANTIZED == 1
 /**
  * Special function to run the classifier on images, only works on TFLite models (either interpreter or EON or for tensaiflow)
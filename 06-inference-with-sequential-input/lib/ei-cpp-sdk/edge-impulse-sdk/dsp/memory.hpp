@@ -24,6 +24,7 @@
 #include "../porting/ei_classifier_porting.h"
 #include "edge-impulse-sdk/classifier/ei_aligned_malloc.h"
 #include "config.hpp"
+#include "ei_dsp_workspace.h"
 
 extern size_t ei_memory_in_use;
 extern size_t ei_memory_peak_use;
@@ -120,9 +121,9 @@ namespace ei {
     #define ei_dsp_register_matrix_alloc(...) (void)0
     #define ei_dsp_register_free(...) (void)0
     #define ei_dsp_register_matrix_free(...) (void)0
-    #define ei_dsp_malloc ei_malloc
-    #define ei_dsp_calloc ei_calloc
-    #define ei_dsp_free(ptr, size) ei_free(ptr)
+    #define ei_dsp_malloc(size) ei::ei_dsp_workspace_calloc(size)
+    #define ei_dsp_calloc(num, size) ei::ei_dsp_workspace_calloc((num) * (size))
+    #define ei_dsp_free(ptr, size) ei::ei_dsp_workspace_free(ptr)
     #define EI_DSP_MATRIX(name, ...) matrix_t name(__VA_ARGS__); if (!name.buffer) { EIDSP_ERR(EIDSP_OUT_OF_MEM); }
     #define EI_DSP_MATRIX_B(name, ...) matrix_t name(__VA_ARGS__); if (!name.buffer) { EIDSP_ERR(EIDSP_OUT_OF_MEM); }
     #define EI_DSP_QUANTIZED_MATRIX(name, ...) quantized_matrix_t name(__VA_ARGS__); if (!name.buffer) { EIDSP_ERR(EIDSP_OUT_OF_MEM); }
@@ -139,7 +140,7 @@ public:
      * @param size The size of the memory block, in bytes.
      */
     static void *ei_wrapped_malloc(const char *fn, const char *file, int line, size_t size) {
-        void *ptr = ei_malloc(size);
+        void *ptr = ei_dsp_workspace_calloc(size);
         if (ptr) {
             ei_dsp_register_alloc_internal(fn, file, line, size, ptr);
         }
@@ -153,7 +154,7 @@ public:
      * @param size Size of each element
      */
     static void *ei_wrapped_calloc(const char *fn, const char *file, int line, size_t num, size_t size) {
-        void *ptr = ei_calloc(num, size);
+        void *ptr = ei_dsp_workspace_calloc(num * size);
         if (ptr) {
             ei_dsp_register_alloc_internal(fn, file, line, num * size, ptr);
         }
@@ -166,7 +167,7 @@ public:
      * @param size Size of the block of memory previously allocated.
      */
     static void ei_wrapped_free(const char *fn, const char *file, int line, void *ptr, size_t size) {
-        ei_free(ptr);
+        ei_dsp_workspace_free(ptr);
         ei_dsp_register_free_internal(fn, file, line, size, ptr);
     }
 };
@@ -1547,10 +1547,93 @@ public:
             return numpy::signal_get_data(data, offset, length, out_ptr);
         };
 #endif
+        signal->span[0] = data;
+        signal->span_length[0] = data_size;
+        signal->span[1] = nullptr;
+        signal->span_length[1] = 0;
         return EIDSP_OK;
     }
 
+    /**
+     * Create a signal structure from a ring buffer that wraps around: the
+     * signal is first_size samples at first followed by second_size samples
+     * at second (the start of the ring buffer). Nothing is copied.
+     * get_data reads the segments through the signal, so keep the signal
+     * structure itself alive (and in place) as well as the buffer.
+     * @param first Oldest samples, up to the end of the ring buffer
+     * @param first_size Number of samples at first
+     * @param second Newest samples, from the start of the ring buffer
+     * @param second_size Number of samples at second (can be 0)
+     * @param signal Output signal
+     * @returns EIDSP_OK if ok
+     */
+    static int signal_from_ring(const float *first, size_t first_size,
+                                const float *second, size_t second_size,
+                                signal_t *signal)
+    {
+        signal->total_length = first_size + second_size;
+        signal->span[0] = first;
+        signal->span_length[0] = first_size;
+        signal->span[1] = (second_size > 0) ? second : nullptr;
+        signal->span_length[1] = second_size;
+#ifdef __MBED__
+        signal->get_data = mbed::callback(&numpy::signal_get_span_data, signal);
+#else
+        signal->get_data = [signal](size_t offset, size_t length, float *out_ptr) {
+            return numpy::signal_get_span_data(signal, offset, length, out_ptr);
+        };
 #endif
+        return EIDSP_OK;
+    }
+
+#endif
+
+    /**
+     * Copy part of a signal to a buffer: straight from its segments in
+     * memory when it has them (see signal_t::span), through get_data
+     * otherwise.
+     * @param signal Signal
+     * @param offset Offset in the signal
+     * @param length Number of samples to copy
+     * @param out_ptr Output buffer (length samples)
+     * @returns EIDSP_OK if ok
+     */
+    static int signal_read(signal_t *signal, size_t offset, size_t length, float *out_ptr)
+    {
+        if (signal->span[0]) {
+            return signal_get_span_data(signal, offset, length, out_ptr);
+        }
+        return signal->get_data(offset, length, out_ptr);
+    }
+
+    /**
+     * Forget a signal's segments in memory, so that numpy::signal_read()
+     * goes through get_data. Call this after setting get_data by hand on a
+     * signal that might have had segments (e.g. one that is reused after
+     * numpy::signal_from_buffer()), or the old segments would still be read.
+     * @param signal Signal
+     */
+    static void signal_clear_span(signal_t *signal)
+    {
+        signal->span[0] = nullptr;
+        signal->span_length[0] = 0;
+        signal->span[1] = nullptr;
+        signal->span_length[1] = 0;
+    }
+
+    /**
+     * Copy a signal's segments in memory (if any) to another signal that
+     * reads the same samples.
+     * @param signal Signal to set
+     * @param from Signal with the same samples
+     */
+    static void signal_copy_span(signal_t *signal, const signal_t *from)
+    {
+        for (int ix = 0; ix < 2; ix++) {
+            signal->span[ix] = from->span[ix];
+            signal->span_length[ix] = from->span_length[ix];
+        }
+    }
 
 #if defined ( __GNUC__ )
 #pragma GCC diagnostic push
@@ -1812,6 +1895,32 @@ public:
         return 0;
     }
 
+    static int signal_get_span_data(const signal_t *signal, size_t offset, size_t length, float *out_ptr)
+    {
+        if (offset + length > signal->span_length[0] + signal->span_length[1]) {
+            EIDSP_ERR(EIDSP_OUT_OF_BOUNDS);
+        }
+
+        // part in the first segment, then the rest from the second one
+        if (offset < signal->span_length[0]) {
+            size_t first_length = signal->span_length[0] - offset;
+            if (first_length > length) {
+                first_length = length;
+            }
+            memcpy(out_ptr, signal->span[0] + offset, first_length * sizeof(float));
+            out_ptr += first_length;
+            length -= first_length;
+            offset = 0;
+        }
+        else {
+            offset -= signal->span_length[0];
+        }
+        if (length > 0) {
+            memcpy(out_ptr, signal->span[1] + offset, length * sizeof(float));
+        }
+        return 0;
+    }
+
     static int signal_get_data_i16(int16_t *in_buffer, size_t offset, size_t length, int16_t *out_ptr)
     {
         memcpy(out_ptr, in_buffer + offset, length * sizeof(int16_t));
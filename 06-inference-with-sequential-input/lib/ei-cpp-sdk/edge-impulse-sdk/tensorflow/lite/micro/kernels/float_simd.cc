@@ -0,0 +1,972 @@
+/* Float fully connected and softmax kernels with runtime SIMD dispatch.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "../../../../classifier/ei_classifier_config.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/float_simd.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+
+#if EI_CLASSIFIER_TFLITE_ENABLE_X86_SIMD == 1
+#include <immintrin.h>
+#endif
+
+// Fully unroll the small fixed-size loops of the blocked kernels (even at
+// -Os), so that their running sums stay in registers
+#if defined(__clang__)
+#define FLOAT_SIMD_UNROLL _Pragma("unroll")
+#elif defined(__GNUC__) && (__GNUC__ >= 8)
+#define FLOAT_SIMD_UNROLL _Pragma("GCC unroll 16")
+#else
+#define FLOAT_SIMD_UNROLL
+#endif
+
+// Helpers are always inlined, so that the SIMD kernels never call out to
+// code compiled for another instruction set
+#if defined(__GNUC__)
+#define FLOAT_SIMD_INLINE inline __attribute__((always_inline))
+#else
+#define FLOAT_SIMD_INLINE inline
+#endif
+
+namespace tflite {
+namespace float_simd {
+namespace {
+
+typedef void (*FullyConnectedBlockFn)(const float* input, int depth,
+                                      const float* weights, const float* bias,
+                                      int outputs, float activation_min,
+                                      float activation_max, float* output);
+
+// Output range of the activation, same as the reference kernel
+FLOAT_SIMD_INLINE float Activation(float x, float activation_min,
+                                   float activation_max) {
+  return std::min(std::max(x, activation_min), activation_max);
+}
+
+// Runs a fully connected layer as blocks of up to ROWS rows by 4 outputs
+// (and single rows or outputs at the edges). Each block loads every input and
+// weight value once and uses it for a whole row or column of the block.
+template <int ROWS>
+void FullyConnectedBlocks(const float* input, int rows, int depth,
+                          const float* weights, const float* bias, int outputs,
+                          float activation_min, float activation_max,
+                          float* output, FullyConnectedBlockFn block_4x4,
+                          FullyConnectedBlockFn block_1x4,
+                          FullyConnectedBlockFn block_4x1,
+                          FullyConnectedBlockFn block_1x1) {
+  int o = 0;
+  for (; o + 4 <= outputs; o += 4) {
+    const float* w = weights + o * depth;
+    const float* b = bias ? bias + o : nullptr;
+    int r = 0;
+    for (; r + ROWS <= rows; r += ROWS) {
+      block_4x4(input + r * depth, depth, w, b, outputs, activation_min,
+                activation_max, output + r * outputs + o);
+    }
+    for (; r < rows; ++r) {
+      block_1x4(input + r * depth, depth, w, b, outputs, activation_min,
+                activation_max, output + r * outputs + o);
+    }
+  }
+  for (; o < outputs; ++o) {
+    const float* w = weights + o * depth;
+    const float* b = bias ? bias + o : nullptr;
+    int r = 0;
+    for (; r + ROWS <= rows; r += ROWS) {
+      block_4x1(input + r * depth, depth, w, b, outputs, activation_min,
+                activation_max, output + r * outputs + o);
+    }
+    for (; r < rows; ++r) {
+      block_1x1(input + r * depth, depth, w, b, outputs, activation_min,
+                activation_max, output + r * outputs + o);
+    }
+  }
+}
+
+/* Portable kernels -------------------------------------------------------- */
+
+// Sums in the same order as reference_ops::FullyConnected()
+template <int ROWS, int OUTS>
+void PortableBlock(const float* input, int depth, const float* weights,
+                   const float* bias, int outputs, float activation_min,
+                   float activation_max, float* output) {
+  float total[ROWS][OUTS] = {};
+
+  for (int d = 0; d < depth; ++d) {
+    FLOAT_SIMD_UNROLL
+    for (int r = 0; r < ROWS; ++r) {
+      FLOAT_SIMD_UNROLL
+      for (int o = 0; o < OUTS; ++o) {
+        total[r][o] += input[r * depth + d] * weights[o * depth + d];
+      }
+    }
+  }
+  for (int r = 0; r < ROWS; ++r) {
+    for (int o = 0; o < OUTS; ++o) {
+      float bias_value = bias ? bias[o] : 0.0f;
+      output[r * outputs + o] =
+          Activation(total[r][o] + bias_value, activation_min, activation_max);
+    }
+  }
+}
+
+void PortableFullyConnected(const float* input, int rows, int depth,
+                            const float* weights, const float* bias,
+                            int outputs, float activation_min,
+                            float activation_max, float* output) {
+  FullyConnectedBlocks<4>(input, rows, depth, weights, bias, outputs,
+                          activation_min, activation_max, output,
+                          PortableBlock<4, 4>, PortableBlock<1, 4>,
+                          PortableBlock<4, 1>, PortableBlock<1, 1>);
+}
+
+// Same steps as reference_ops::Softmax()
+void PortableSoftmax(const float* input, int rows, int depth, float beta,
+                     float* output) {
+  for (int r = 0; r < rows; ++r) {
+    const float* x = input + r * depth;
+    float* y = output + r * depth;
+    float max = std::numeric_limits<float>::lowest();
+    for (int c = 0; c < depth; ++c) {
+      max = std::max(max, x[c]);
+    }
+    float sum = 0.f;
+    for (int c = 0; c < depth; ++c) {
+      y[c] = std::exp((x[c] - max) * beta);
+      sum += y[c];
+    }
+    for (int c = 0; c < depth; ++c) {
+      y[c] = y[c] / sum;
+    }
+  }
+}
+
+void PortableMultiplyAccumulate(const float* input, int depth,
+                                const float* weights, int outputs,
+                                float* output) {
+  for (int d = 0; d < depth; ++d) {
+    const float x = input[d];
+    const float* w = weights + d * outputs;
+    for (int o = 0; o < outputs; ++o) {
+      output[o] += x * w[o];
+    }
+  }
+}
+
+#if EI_CLASSIFIER_TFLITE_ENABLE_X86_SIMD == 1
+
+// exp() by range reduction to [-ln2/2, ln2/2] and a degree 6 polynomial
+// (the Cephes expf() coefficients), within 2 ULP of std::exp(). Inputs below
+// kExpMin (where the result would be denormal) give 0, and inputs are
+// clamped to kExpMax (softmax only ever passes values <= 0).
+constexpr float kExpMin = -87.33654f;
+constexpr float kExpMax = 88.0f;
+constexpr float kLog2e = 1.44269504088896341f;
+constexpr float kLn2Hi = 0.693359375f;
+constexpr float kLn2Lo = -2.12194440e-4f;
+constexpr float kExpP0 = 1.9875691500e-4f;
+constexpr float kExpP1 = 1.3981999507e-3f;
+constexpr float kExpP2 = 8.3334519073e-3f;
+constexpr float kExpP3 = 4.1665795894e-2f;
+constexpr float kExpP4 = 1.6666665459e-1f;
+constexpr float kExpP5 = 5.0000001201e-1f;
+
+/* SSE4.2 kernels (4 lanes) ------------------------------------------------ */
+
+#define FLOAT_SIMD_TARGET_SSE42 __attribute__((target("sse4.2")))
+
+FLOAT_SIMD_TARGET_SSE42 FLOAT_SIMD_INLINE float HorizontalSumSse42(__m128 v) {
+  __m128 s = _mm_add_ps(v, _mm_movehl_ps(v, v));
+  s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+  return _mm_cvtss_f32(s);
+}
+
+// The tail of each sum (depth % 4) is added one product at a time
+template <int ROWS, int OUTS>
+FLOAT_SIMD_TARGET_SSE42 void Sse42Block(const float* input, int depth,
+                                        const float* weights,
+                                        const float* bias, int outputs,
+                                        float activation_min,
+                                        float activation_max, float* output) {
+  __m128 acc[ROWS][OUTS];
+  FLOAT_SIMD_UNROLL
+  for (int r = 0; r < ROWS; ++r) {
+    FLOAT_SIMD_UNROLL
+    for (int o = 0; o < OUTS; ++o) {
+      acc[r][o] = _mm_setzero_ps();
+    }
+  }
+
+  int d = 0;
+  for (; d + 4 <= depth; d += 4) {
+    __m128 w[OUTS];
+    FLOAT_SIMD_UNROLL
+    for (int o = 0; o < OUTS; ++o) {
+      w[o] = _mm_loadu_ps(weights + o * depth + d);
+    }
+    FLOAT_SIMD_UNROLL
+    for (int r = 0; r < ROWS; ++r) {
+      __m128 x = _mm_loadu_ps(input + r * depth + d);
+      FLOAT_SIMD_UNROLL
+      for (int o = 0; o < OUTS; ++o) {
+        acc[r][o] = _mm_add_ps(acc[r][o], _mm_mul_ps(x, w[o]));
+      }
+    }
+  }
+
+  FLOAT_SIMD_UNROLL
+  for (int r = 0; r < ROWS; ++r) {
+    FLOAT_SIMD_UNROLL
+    for (int o = 0; o < OUTS; ++o) {
+      float total = HorizontalSumSse42(acc[r][o]);
+      for (int t = d; t < depth; ++t) {
+        total += input[r * depth + t] * weights[o * depth + t];
+      }
+      float bias_value = bias ? bias[o] : 0.0f;
+      output[r * outputs + o] =
+          Activation(total + bias_value, activation_min, activation_max);
+    }
+  }
+}
+
+FLOAT_SIMD_TARGET_SSE42 FLOAT_SIMD_INLINE __m128 ExpSse42(__m128 x) {
+  __m128 underflow = _mm_cmplt_ps(x, _mm_set1_ps(kExpMin));
+  x = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(kExpMin)), _mm_set1_ps(kExpMax));
+  __m128 n = _mm_round_ps(_mm_mul_ps(x, _mm_set1_ps(kLog2e)),
+                          _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+  __m128 r = _mm_sub_ps(x, _mm_mul_ps(n, _mm_set1_ps(kLn2Hi)));
+  r = _mm_sub_ps(r, _mm_mul_ps(n, _mm_set1_ps(kLn2Lo)));
+  __m128 p = _mm_set1_ps(kExpP0);
+  p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(kExpP1));
+  p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(kExpP2));
+  p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(kExpP3));
+  p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(kExpP4));
+  p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(kExpP5));
+  p = _mm_add_ps(_mm_mul_ps(p, _mm_mul_ps(r, r)), r);
+  p = _mm_add_ps(p, _mm_set1_ps(1.0f));
+  __m128i e = _mm_slli_epi32(
+      _mm_add_epi32(_mm_cvtps_epi32(n), _mm_set1_epi32(127)), 23);
+  __m128 y = _mm_mul_ps(p, _mm_castsi128_ps(e));
+  return _mm_blendv_ps(y, _mm_setzero_ps(), underflow);
+}
+
+// Partial vectors go through a padded copy: padding lanes hold the lowest
+// float, whose exp() is 0, so they add nothing to the sum
+FLOAT_SIMD_TARGET_SSE42 void Sse42Softmax(const float* input, int rows,
+                                          int depth, float beta,
+                                          float* output) {
+  for (int r = 0; r < rows; ++r) {
+    const float* x = input + r * depth;
+    float* y = output + r * depth;
+    float max = std::numeric_limits<float>::lowest();
+    for (int c = 0; c < depth; ++c) {
+      max = std::max(max, x[c]);
+    }
+    __m128 vmax = _mm_set1_ps(max);
+    __m128 vbeta = _mm_set1_ps(beta);
+    __m128 vsum = _mm_setzero_ps();
+    for (int c = 0; c < depth; c += 4) {
+      int n = std::min(4, depth - c);
+      float in[4], out[4];
+      for (int i = 0; i < 4; ++i) {
+        in[i] = (i < n) ? x[c + i] : std::numeric_limits<float>::lowest();
+      }
+      __m128 t = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(in), vmax), vbeta);
+      __m128 e = ExpSse42(t);
+      vsum = _mm_add_ps(vsum, e);
+      _mm_storeu_ps(out, e);
+      for (int i = 0; i < n; ++i) {
+        y[c + i] = out[i];
+      }
+    }
+    float sum = HorizontalSumSse42(vsum);
+    for (int c = 0; c < depth; ++c) {
+      y[c] = y[c] / sum;
+    }
+  }
+}
+
+// Runs down the depth for VECS vectors of outputs at a time, so the sums
+// stay in registers and never need a horizontal add. Even and odd inputs go
+// into separate sums, so that there are enough independent additions to
+// hide their latency.
+template <int VECS>
+FLOAT_SIMD_TARGET_SSE42 FLOAT_SIMD_INLINE void Sse42MultiplyAccumulateChunk(
+    const float* input, int depth, const float* weights, int outputs,
+    float* output) {
+  __m128 acc[2][VECS];
+  FLOAT_SIMD_UNROLL
+  for (int v = 0; v < VECS; ++v) {
+    acc[0][v] = _mm_loadu_ps(output + v * 4);
+    acc[1][v] = _mm_setzero_ps();
+  }
+  int d = 0;
+  for (; d + 2 <= depth; d += 2) {
+    FLOAT_SIMD_UNROLL
+    for (int k = 0; k < 2; ++k) {
+      const __m128 x = _mm_set1_ps(input[d + k]);
+      const float* w = weights + (d + k) * outputs;
+      FLOAT_SIMD_UNROLL
+      for (int v = 0; v < VECS; ++v) {
+        acc[k][v] = _mm_add_ps(acc[k][v],
+                               _mm_mul_ps(x, _mm_loadu_ps(w + v * 4)));
+      }
+    }
+  }
+  if (d < depth) {
+    const __m128 x = _mm_set1_ps(input[d]);
+    const float* w = weights + d * outputs;
+    FLOAT_SIMD_UNROLL
+    for (int v = 0; v < VECS; ++v) {
+      acc[0][v] = _mm_add_ps(acc[0][v], _mm_mul_ps(x, _mm_loadu_ps(w + v * 4)));
+    }
+  }
+  FLOAT_SIMD_UNROLL
+  for (int v = 0; v < VECS; ++v) {
+    _mm_storeu_ps(output + v * 4, _mm_add_ps(acc[0][v], acc[1][v]));
+  }
+}
+
+// The last outputs % 4 are done one at a time
+FLOAT_SIMD_TARGET_SSE42 void Sse42MultiplyAccumulate(const float* input,
+                                                     int depth,
+                                                     const float* weights,
+                                                     int outputs,
+                                                     float* output) {
+  int o = 0;
+  for (; o + 16 <= outputs; o += 16) {
+    Sse42MultiplyAccumulateChunk<4>(input, depth, weights + o, outputs,
+                                    output + o);
+  }
+  for (; o + 4 <= outputs; o += 4) {
+    Sse42MultiplyAccumulateChunk<1>(input, depth, weights + o, outputs,
+                                    output + o);
+  }
+  for (; o < outputs; ++o) {
+    for (int d = 0; d < depth; ++d) {
+      output[o] += input[d] * weights[d * outputs + o];
+    }
+  }
+}
+
+void Sse42FullyConnected(const float* input, int rows, int depth,
+                         const float* weights, const float* bias, int outputs,
+                         float activation_min, float activation_max,
+                         float* output) {
+  FullyConnectedBlocks<2>(input, rows, depth, weights, bias, outputs,
+                          activation_min, activation_max, output,
+                          Sse42Block<2, 4>, Sse42Block<1, 4>, Sse42Block<2, 1>,
+                          Sse42Block<1, 1>);
+}
+
+/* AVX2 + FMA kernels (8 lanes) -------------------------------------------- */
+
+// The rest of the library is SSE code, so every AVX kernel clears the upper
+// register halves before it returns to avoid AVX-SSE transition stalls
+#define FLOAT_SIMD_TARGET_AVX2 __attribute__((target("avx2,fma")))
+
+FLOAT_SIMD_TARGET_AVX2 FLOAT_SIMD_INLINE float HorizontalSumAvx2(__m256 v) {
+  __m128 s = _mm_add_ps(_mm256_castps256_ps128(v),
+                        _mm256_extractf128_ps(v, 1));
+  s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+  s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+  return _mm_cvtss_f32(s);
+}
+
+// Mask with the first n (0-8) lanes set
+FLOAT_SIMD_TARGET_AVX2 FLOAT_SIMD_INLINE __m256i TailMaskAvx2(int n) {
+  return _mm256_cmpgt_epi32(_mm256_set1_epi32(n),
+                            _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+}
+
+// The tail of each sum (depth % 8) is one more masked vector step
+template <int ROWS, int OUTS>
+FLOAT_SIMD_TARGET_AVX2 void Avx2Block(const float* input, int depth,
+                                      const float* weights, const float* bias,
+                                      int outputs, float activation_min,
+                                      float activation_max, float* output) {
+  __m256 acc[ROWS][OUTS];
+  FLOAT_SIMD_UNROLL
+  for (int r = 0; r < ROWS; ++r) {
+    FLOAT_SIMD_UNROLL
+    for (int o = 0; o < OUTS; ++o) {
+      acc[r][o] = _mm256_setzero_ps();
+    }
+  }
+
+  int d = 0;
+  for (; d + 8 <= depth; d += 8) {
+    __m256 w[OUTS];
+    FLOAT_SIMD_UNROLL
+    for (int o = 0; o < OUTS; ++o) {
+      w[o] = _mm256_loadu_ps(weights + o * depth + d);
+    }
+    FLOAT_SIMD_UNROLL
+    for (int r = 0; r < ROWS; ++r) {
+      __m256 x = _mm256_loadu_ps(input + r * depth + d);
+      FLOAT_SIMD_UNROLL
+      for (int o = 0; o < OUTS; ++o) {
+        acc[r][o] = _mm256_fmadd_ps(x, w[o], acc[r][o]);
+      }
+    }
+  }
+  if (d < depth) {
+    __m256i mask = TailMaskAvx2(depth - d);
+    __m256 w[OUTS];
+    FLOAT_SIMD_UNROLL
+    for (int o = 0; o < OUTS; ++o) {
+      w[o] = _mm256_maskload_ps(weights + o * depth + d, mask);
+    }
+    FLOAT_SIMD_UNROLL
+    for (int r = 0; r < ROWS; ++r) {
+      __m256 x = _mm256_maskload_ps(input + r * depth + d, mask);
+      FLOAT_SIMD_UNROLL
+      for (int o = 0; o < OUTS; ++o) {
+        acc[r][o] = _mm256_fmadd_ps(x, w[o], acc[r][o]);
+      }
+    }
+  }
+
+  FLOAT_SIMD_UNROLL
+  for (int r = 0; r < ROWS; ++r) {
+    FLOAT_SIMD_UNROLL
+    for (int o = 0; o < OUTS; ++o) {
+      float bias_value = bias ? bias[o] : 0.0f;
+      output[r * outputs + o] = Activation(
+          HorizontalSumAvx2(acc[r][o]) + bias_value, activation_min,
+          activation_max);
+    }
+  }
+  _mm256_zeroupper();
+}
+
+FLOAT_SIMD_TARGET_AVX2 FLOAT_SIMD_INLINE __m256 ExpAvx2(__m256 x) {
+  __m256 underflow = _mm256_cmp_ps(x, _mm256_set1_ps(kExpMin), _CMP_LT_OQ);
+  x = _mm256_min_ps(_mm256_max_ps(x, _mm256_set1_ps(kExpMin)),
+                    _mm256_set1_ps(kExpMax));
+  __m256 n = _mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(kLog2e)),
+                             _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+  __m256 r = _mm256_fnmadd_ps(n, _mm256_set1_ps(kLn2Hi), x);
+  r = _mm256_fnmadd_ps(n, _mm256_set1_ps(kLn2Lo), r);
+  __m256 p = _mm256_set1_ps(kExpP0);
+  p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(kExpP1));
+  p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(kExpP2));
+  p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(kExpP3));
+  p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(kExpP4));
+  p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(kExpP5));
+  p = _mm256_fmadd_ps(p, _mm256_mul_ps(r, r), r);
+  p = _mm256_add_ps(p, _mm256_set1_ps(1.0f));
+  __m256i e = _mm256_slli_epi32(
+      _mm256_add_epi32(_mm256_cvtps_epi32(n), _mm256_set1_epi32(127)), 23);
+  __m256 y = _mm256_mul_ps(p, _mm256_castsi256_ps(e));
+  return _mm256_blendv_ps(y, _mm256_setzero_ps(), underflow);
+}
+
+// Masked-off lanes are loaded as the lowest float, whose exp() is 0
+FLOAT_SIMD_TARGET_AVX2 void Avx2Softmax(const float* input, int rows,
+                                        int depth, float beta, float* output) {
+  __m256 lowest = _mm256_set1_ps(std::numeric_limits<float>::lowest());
+  for (int r = 0; r < rows; ++r) {
+    const float* x = input + r * depth;
+    float* y = output + r * depth;
+    float max = std::numeric_limits<float>::lowest();
+    for (int c = 0; c < depth; ++c) {
+      max = std::max(max, x[c]);
+    }
+    __m256 vmax = _mm256_set1_ps(max);
+    __m256 vbeta = _mm256_set1_ps(beta);
+    __m256 vsum = _mm256_setzero_ps();
+    for (int c = 0; c < depth; c += 8) {
+      __m256i mask = TailMaskAvx2(std::min(8, depth - c));
+      __m256 v = _mm256_blendv_ps(lowest, _mm256_maskload_ps(x + c, mask),
+                                  _mm256_castsi256_ps(mask));
+      __m256 e = ExpAvx2(_mm256_mul_ps(_mm256_sub_ps(v, vmax), vbeta));
+      vsum = _mm256_add_ps(vsum, e);
+      _mm256_maskstore_ps(y + c, mask, e);
+    }
+    float sum = HorizontalSumAvx2(vsum);
+    for (int c = 0; c < depth; ++c) {
+      y[c] = y[c] / sum;
+    }
+  }
+  _mm256_zeroupper();
+}
+
+// Like the SSE4.2 version. The last vector only covers the first n (1-8)
+// of its outputs.
+template <int VECS>
+FLOAT_SIMD_TARGET_AVX2 FLOAT_SIMD_INLINE void Avx2MultiplyAccumulateChunk(
+    const float* input, int depth, const float* weights, int outputs, int n,
+    float* output) {
+  const __m256i mask = TailMaskAvx2(n);
+  float* last = output + (VECS - 1) * 8;
+  __m256 acc[2][VECS];
+  FLOAT_SIMD_UNROLL
+  for (int v = 0; v < VECS - 1; ++v) {
+    acc[0][v] = _mm256_loadu_ps(output + v * 8);
+  }
+  acc[0][VECS - 1] = _mm256_maskload_ps(last, mask);
+  FLOAT_SIMD_UNROLL
+  for (int v = 0; v < VECS; ++v) {
+    acc[1][v] = _mm256_setzero_ps();
+  }
+
+  int d = 0;
+  for (; d + 2 <= depth; d += 2) {
+    FLOAT_SIMD_UNROLL
+    for (int k = 0; k < 2; ++k) {
+      const __m256 x = _mm256_set1_ps(input[d + k]);
+      const float* w = weights + (d + k) * outputs;
+      FLOAT_SIMD_UNROLL
+      for (int v = 0; v < VECS - 1; ++v) {
+        acc[k][v] = _mm256_fmadd_ps(x, _mm256_loadu_ps(w + v * 8), acc[k][v]);
+      }
+      acc[k][VECS - 1] = _mm256_fmadd_ps(
+          x, _mm256_maskload_ps(w + (VECS - 1) * 8, mask), acc[k][VECS - 1]);
+    }
+  }
+  if (d < depth) {
+    const __m256 x = _mm256_set1_ps(input[d]);
+    const float* w = weights + d * outputs;
+    FLOAT_SIMD_UNROLL
+    for (int v = 0; v < VECS - 1; ++v) {
+      acc[0][v] = _mm256_fmadd_ps(x, _mm256_loadu_ps(w + v * 8), acc[0][v]);
+    }
+    acc[0][VECS - 1] = _mm256_fmadd_ps(
+        x, _mm256_maskload_ps(w + (VECS - 1) * 8, mask), acc[0][VECS - 1]);
+  }
+
+  FLOAT_SIMD_UNROLL
+  for (int v = 0; v < VECS - 1; ++v) {
+    _mm256_storeu_ps(output + v * 8, _mm256_add_ps(acc[0][v], acc[1][v]));
+  }
+  _mm256_maskstore_ps(last, mask,
+                      _mm256_add_ps(acc[0][VECS - 1], acc[1][VECS - 1]));
+}
+
+FLOAT_SIMD_TARGET_AVX2 void Avx2MultiplyAccumulate(const float* input,
+                                                   int depth,
+                                                   const float* weights,
+                                                   int outputs,
+                                                   float* output) {
+  int o = 0;
+  for (; o + 32 <= outputs; o += 32) {
+    Avx2MultiplyAccumulateChunk<4>(input, depth, weights + o, outputs, 8,
+                                   output + o);
+  }
+  const int left = outputs - o;
+  const int n = left - ((left - 1) / 8) * 8;
+  switch ((left + 7) / 8) {
+    case 1:
+      Avx2MultiplyAccumulateChunk<1>(input, depth, weights + o, outputs, n,
+                                     output + o);
+      break;
+    case 2:
+      Avx2MultiplyAccumulateChunk<2>(input, depth, weights + o, outputs, n,
+                                     output + o);
+      break;
+    case 3:
+      Avx2MultiplyAccumulateChunk<3>(input, depth, weights + o, outputs, n,
+                                     output + o);
+      break;
+    default:
+      break;
+  }
+  _mm256_zeroupper();
+}
+
+void Avx2FullyConnected(const float* input, int rows, int depth,
+                        const float* weights, const float* bias, int outputs,
+                        float activation_min, float activation_max,
+                        float* output) {
+  FullyConnectedBlocks<2>(input, rows, depth, weights, bias, outputs,
+                          activation_min, activation_max, output,
+                          Avx2Block<2, 4>, Avx2Block<1, 4>, Avx2Block<2, 1>,
+                          Avx2Block<1, 1>);
+}
+
+/* AVX-512 kernels (16 lanes) ---------------------------------------------- */
+
+// GCC 12 warns about the deliberately undefined registers that some AVX-512
+// intrinsics start from
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+#define FLOAT_SIMD_TARGET_AVX512 __attribute__((target("avx512f")))
+
+FLOAT_SIMD_TARGET_AVX512 FLOAT_SIMD_INLINE float HorizontalSumAvx512(__m512 v) {
+  __m256 h = _mm256_add_ps(_mm512_castps512_ps256(v),
+                           _mm256_castpd_ps(_mm512_extractf64x4_pd(
+                               _mm512_castps_pd(v), 1)));
+  __m128 s = _mm_add_ps(_mm256_castps256_ps128(h),
+                        _mm256_extractf128_ps(h, 1));
+  s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+  s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+  return _mm_cvtss_f32(s);
+}
+
+// The tail of each sum (depth % 16) is one more masked vector step
+template <int ROWS, int OUTS>
+FLOAT_SIMD_TARGET_AVX512 void Avx512Block(const float* input, int depth,
+                                          const float* weights,
+                                          const float* bias, int outputs,
+                                          float activation_min,
+                                          float activation_max,
+                                          float* output) {
+  __m512 acc[ROWS][OUTS];
+  FLOAT_SIMD_UNROLL
+  for (int r = 0; r < ROWS; ++r) {
+    FLOAT_SIMD_UNROLL
+    for (int o = 0; o < OUTS; ++o) {
+      acc[r][o] = _mm512_setzero_ps();
+    }
+  }
+
+  int d = 0;
+  for (; d + 16 <= depth; d += 16) {
+    __m512 w[OUTS];
+    FLOAT_SIMD_UNROLL
+    for (int o = 0; o < OUTS; ++o) {
+      w[o] = _mm512_loadu_ps(weights + o * depth + d);
+    }
+    FLOAT_SIMD_UNROLL
+    for (int r = 0; r < ROWS; ++r) {
+      __m512 x = _mm512_loadu_ps(input + r * depth + d);
+      FLOAT_SIMD_UNROLL
+      for (int o = 0; o < OUTS; ++o) {
+        acc[r][o] = _mm512_fmadd_ps(x, w[o], acc[r][o]);
+      }
+    }
+  }
+  if (d < depth) {
+    __mmask16 mask = (__mmask16)((1u << (depth - d)) - 1);
+    __m512 w[OUTS];
+    FLOAT_SIMD_UNROLL
+    for (int o = 0; o < OUTS; ++o) {
+      w[o] = _mm512_maskz_loadu_ps(mask, weights + o * depth + d);
+    }
+    FLOAT_SIMD_UNROLL
+    for (int r = 0; r < ROWS; ++r) {
+      __m512 x = _mm512_maskz_loadu_ps(mask, input + r * depth + d);
+      FLOAT_SIMD_UNROLL
+      for (int o = 0; o < OUTS; ++o) {
+        acc[r][o] = _mm512_fmadd_ps(x, w[o], acc[r][o]);
+      }
+    }
+  }
+
+  FLOAT_SIMD_UNROLL
+  for (int r = 0; r < ROWS; ++r) {
+    FLOAT_SIMD_UNROLL
+    for (int o = 0; o < OUTS; ++o) {
+      float bias_value = bias ? bias[o] : 0.0f;
+      output[r * outputs + o] = Activation(
+          HorizontalSumAvx512(acc[r][o]) + bias_value, activation_min,
+          activation_max);
+    }
+  }
+  _mm256_zeroupper();
+}
+
+FLOAT_SIMD_TARGET_AVX512 FLOAT_SIMD_INLINE __m512 ExpAvx512(__m512 x) {
+  __mmask16 underflow = _mm512_cmp_ps_mask(x, _mm512_set1_ps(kExpMin),
+                                           _CMP_LT_OQ);
+  x = _mm512_min_ps(_mm512_max_ps(x, _mm512_set1_ps(kExpMin)),
+                    _mm512_set1_ps(kExpMax));
+  __m512 n = _mm512_roundscale_ps(_mm512_mul_ps(x, _mm512_set1_ps(kLog2e)),
+                                  _MM_FROUND_TO_NEAREST_INT |
+                                      _MM_FROUND_NO_EXC);
+  __m512 r = _mm512_fnmadd_ps(n, _mm512_set1_ps(kLn2Hi), x);
+  r = _mm512_fnmadd_ps(n, _mm512_set1_ps(kLn2Lo), r);
+  __m512 p = _mm512_set1_ps(kExpP0);
+  p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(kExpP1));
+  p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(kExpP2));
+  p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(kExpP3));
+  p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(kExpP4));
+  p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(kExpP5));
+  p = _mm512_fmadd_ps(p, _mm512_mul_ps(r, r), r);
+  p = _mm512_add_ps(p, _mm512_set1_ps(1.0f));
+  __m512i e = _mm512_slli_epi32(
+      _mm512_add_epi32(_mm512_cvtps_epi32(n), _mm512_set1_epi32(127)), 23);
+  __m512 y = _mm512_mul_ps(p, _mm512_castsi512_ps(e));
+  return _mm512_mask_mov_ps(y, underflow, _mm512_setzero_ps());
+}
+
+// Masked-off lanes are set to the lowest float, whose exp() is 0
+FLOAT_SIMD_TARGET_AVX512 void Avx512Softmax(const float* input, int rows,
+                                            int depth, float beta,
+                                            float* output) {
+  __m512 lowest = _mm512_set1_ps(std::numeric_limits<float>::lowest());
+  for (int r = 0; r < rows; ++r) {
+    const float* x = input + r * depth;
+    float* y = output + r * depth;
+    float max = std::numeric_limits<float>::lowest();
+    for (int c = 0; c < depth; ++c) {
+      max = std::max(max, x[c]);
+    }
+    __m512 vmax = _mm512_set1_ps(max);
+    __m512 vbeta = _mm512_set1_ps(beta);
+    __m512 vsum = _mm512_setzero_ps();
+    for (int c = 0; c < depth; c += 16) {
+      int n = std::min(16, depth - c);
+      __mmask16 mask = (__mmask16)((1u << n) - 1);
+      __m512 v = _mm512_mask_loadu_ps(lowest, mask, x + c);
+      __m512 e = ExpAvx512(_mm512_mul_ps(_mm512_sub_ps(v, vmax), vbeta));
+      vsum = _mm512_add_ps(vsum, e);
+      _mm512_mask_storeu_ps(y + c, mask, e);
+    }
+    float sum = HorizontalSumAvx512(vsum);
+    for (int c = 0; c < depth; ++c) {
+      y[c] = y[c] / sum;
+    }
+  }
+  _mm256_zeroupper();
+}
+
+// Like the AVX2 version, with 16 lanes and up to 8 vectors (the sums of a
+// model's layer usually fit in one pass)
+template <int VECS>
+FLOAT_SIMD_TARGET_AVX512 FLOAT_SIMD_INLINE void Avx512MultiplyAccumulateChunk(
+    const float* input, int depth, const float* weights, int outputs, int n,
+    float* output) {
+  const __mmask16 mask = (__mmask16)((1u << n) - 1);
+  float* last = output + (VECS - 1) * 16;
+  __m512 acc[2][VECS];
+  FLOAT_SIMD_UNROLL
+  for (int v = 0; v < VECS - 1; ++v) {
+    acc[0][v] = _mm512_loadu_ps(output + v * 16);
+  }
+  acc[0][VECS - 1] = _mm512_maskz_loadu_ps(mask, last);
+  FLOAT_SIMD_UNROLL
+  for (int v = 0; v < VECS; ++v) {
+    acc[1][v] = _mm512_setzero_ps();
+  }
+
+  int d = 0;
+  for (; d + 2 <= depth; d += 2) {
+    FLOAT_SIMD_UNROLL
+    for (int k = 0; k < 2; ++k) {
+      const __m512 x = _mm512_set1_ps(input[d + k]);
+      const float* w = weights + (d + k) * outputs;
+      FLOAT_SIMD_UNROLL
+      for (int v = 0; v < VECS - 1; ++v) {
+        acc[k][v] = _mm512_fmadd_ps(x, _mm512_loadu_ps(w + v * 16), acc[k][v]);
+      }
+      acc[k][VECS - 1] = _mm512_fmadd_ps(
+          x, _mm512_maskz_loadu_ps(mask, w + (VECS - 1) * 16),
+          acc[k][VECS - 1]);
+    }
+  }
+  if (d < depth) {
+    const __m512 x = _mm512_set1_ps(input[d]);
+    const float* w = weights + d * outputs;
+    FLOAT_SIMD_UNROLL
+    for (int v = 0; v < VECS - 1; ++v) {
+      acc[0][v] = _mm512_fmadd_ps(x, _mm512_loadu_ps(w + v * 16), acc[0][v]);
+    }
+    acc[0][VECS - 1] = _mm512_fmadd_ps(
+        x, _mm512_maskz_loadu_ps(mask, w + (VECS - 1) * 16),
+        acc[0][VECS - 1]);
+  }
+
+  FLOAT_SIMD_UNROLL
+  for (int v = 0; v < VECS - 1; ++v) {
+    _mm512_storeu_ps(output + v * 16, _mm512_add_ps(acc[0][v], acc[1][v]));
+  }
+  _mm512_mask_storeu_ps(last, mask,
+                        _mm512_add_ps(acc[0][VECS - 1], acc[1][VECS - 1]));
+}
+
+FLOAT_SIMD_TARGET_AVX512 void Avx512MultiplyAccumulate(const float* input,
+                                                       int depth,
+                                                       const float* weights,
+                                                       int outputs,
+                                                       float* output) {
+  int o = 0;
+  for (; o + 128 <= outputs; o += 128) {
+    Avx512MultiplyAccumulateChunk<8>(input, depth, weights + o, outputs, 16,
+                                     output + o);
+  }
+  const int left = outputs - o;
+  const int n = left - ((left - 1) / 16) * 16;
+  switch ((left + 15) / 16) {
+    case 1:
+      Avx512MultiplyAccumulateChunk<1>(input, depth, weights + o, outputs, n,
+                                       output + o);
+      break;
+    case 2:
+      Avx512MultiplyAccumulateChunk<2>(input, depth, weights + o, outputs, n,
+                                       output + o);
+      break;
+    case 3:
+      Avx512MultiplyAccumulateChunk<3>(input, depth, weights + o, outputs, n,
+                                       output + o);
+      break;
+    case 4:
+      Avx512MultiplyAccumulateChunk<4>(input, depth, weights + o, outputs, n,
+                                       output + o);
+      break;
+    case 5:
+      Avx512MultiplyAccumulateChunk<5>(input, depth, weights + o, outputs, n,
+                                       output + o);
+      break;
+    case 6:
+      Avx512MultiplyAccumulateChunk<6>(input, depth, weights + o, outputs, n,
+                                       output + o);
+      break;
+    case 7:
+      Avx512MultiplyAccumulateChunk<7>(input, depth, weights + o, outputs, n,
+                                       output + o);
+      break;
+    default:
+      break;
+  }
+  _mm256_zeroupper();
+}
+
+void Avx512FullyConnected(const float* input, int rows, int depth,
+                          const float* weights, const float* bias, int outputs,
+                          float activation_min, float activation_max,
+                          float* output) {
+  FullyConnectedBlocks<4>(input, rows, depth, weights, bias, outputs,
+                          activation_min, activation_max, output,
+                          Avx512Block<4, 4>, Avx512Block<1, 4>,
+                          Avx512Block<4, 1>, Avx512Block<1, 1>);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif  // EI_CLASSIFIER_TFLITE_ENABLE_X86_SIMD == 1
+
+/* Dispatch ---------------------------------------------------------------- */
+
+typedef void (*FullyConnectedFn)(const float*, int, int, const float*,
+                                 const float*, int, float, float, float*);
+typedef void (*MultiplyAccumulateFn)(const float*, int, const float*, int,
+                                     float*);
+typedef void (*SoftmaxFn)(const float*, int, int, float, float*);
+
+struct Kernels {
+  FullyConnectedFn fully_connected;
+  MultiplyAccumulateFn multiply_accumulate;
+  SoftmaxFn softmax;
+};
+
+const Kernels kKernels[kSimdLevelCount] = {
+    {PortableFullyConnected, PortableMultiplyAccumulate, PortableSoftmax},
+#if EI_CLASSIFIER_TFLITE_ENABLE_X86_SIMD == 1
+    {Sse42FullyConnected, Sse42MultiplyAccumulate, Sse42Softmax},
+    {Avx2FullyConnected, Avx2MultiplyAccumulate, Avx2Softmax},
+    {Avx512FullyConnected, Avx512MultiplyAccumulate, Avx512Softmax},
+#else
+    {PortableFullyConnected, PortableMultiplyAccumulate, PortableSoftmax},
+    {PortableFullyConnected, PortableMultiplyAccumulate, PortableSoftmax},
+    {PortableFullyConnected, PortableMultiplyAccumulate, PortableSoftmax},
+#endif
+};
+
+// Level in use (-1 until the first kernel runs)
+std::atomic<int> current_level(-1);
+
+SimdLevel Detect() {
+#if EI_CLASSIFIER_TFLITE_ENABLE_X86_SIMD == 1
+  // Also checks that the OS saves the wider registers (XGETBV)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) {
+    return kSimdAvx512;
+  }
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+    return kSimdAvx2Fma;
+  }
+  if (__builtin_cpu_supports("sse4.2")) {
+    return kSimdSse42;
+  }
+#endif
+  return kSimdPortable;
+}
+
+inline const Kernels& CurrentKernels() {
+  int level = current_level.load(std::memory_order_relaxed);
+  if (level < 0) {
+    level = DetectedSimdLevel();
+    current_level.store(level, std::memory_order_relaxed);
+  }
+  return kKernels[level];
+}
+
+}  // namespace
+
+SimdLevel DetectedSimdLevel() {
+  static const SimdLevel detected = Detect();
+  return detected;
+}
+
+SimdLevel GetSimdLevel() {
+  CurrentKernels();
+  return static_cast<SimdLevel>(current_level.load(std::memory_order_relaxed));
+}
+
+SimdLevel SetSimdLevel(SimdLevel level) {
+  SimdLevel best = DetectedSimdLevel();
+  if (level < kSimdPortable || level > best) {
+    level = best;
+  }
+  current_level.store(level, std::memory_order_relaxed);
+  return level;
+}
+
+const char* SimdLevelName(SimdLevel level) {
+  switch (level) {
+    case kSimdPortable:
+      return "portable";
+    case kSimdSse42:
+      return "sse4.2";
+    case kSimdAvx2Fma:
+      return "avx2+fma";
+    case kSimdAvx512:
+      return "avx512";
+    default:
+      return "unknown";
+  }
+}
+
+void FullyConnected(const float* input, int rows, int depth,
+                    const float* weights, const float* bias, int outputs,
+                    float activation_min, float activation_max,
+                    float* output) {
+  CurrentKernels().fully_connected(input, rows, depth, weights, bias, outputs,
+                                   activation_min, activation_max, output);
+}
+
+void MultiplyAccumulate(const float* input, int depth, const float* weights,
+                        int outputs, float* output) {
+  CurrentKernels().multiply_accumulate(input, depth, weights, outputs, output);
+}
+
+void Softmax(const float* input, int rows, int depth, float beta,
+             float* output) {
+  CurrentKernels().softmax(input, rows, depth, beta, output);
+}
+
+}  // namespace float_simd
+}  // namespace tflite
@@ -1352,6 +1352,7 @@ limitations under the License.
 #include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/fully_connected.h"
 #include "edge-impulse-sdk/tensorflow/lite/kernels/internal/tensor_ctypes.h"
 #include "edge-impulse-sdk/tensorflow/lite/kernels/kernel_util.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/float_simd.h"
 #include "edge-impulse-sdk/tensorflow/lite/micro/kernels/kernel_util.h"
 
 namespace tflite {
@@ -1417,15 +1418,23 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
       return kTfLiteError;
       #endif
 
-      tflite::reference_ops::FullyConnected(
-          FullyConnectedParamsFloat(params->activation),
-          tflite::micro::GetTensorShape(input),
+      // Same shapes as reference_ops::FullyConnected(), run by the SIMD
+      // kernels where the CPU has them (see float_simd.h)
+      const FullyConnectedParams op_params =
+          FullyConnectedParamsFloat(params->activation);
+      const RuntimeShape filter_shape = tflite::micro::GetTensorShape(filter);
+      const RuntimeShape output_shape = tflite::micro::GetTensorShape(output);
+      const int output_dims_count = output_shape.DimensionsCount();
+      const int filter_dims_count = filter_shape.DimensionsCount();
+      tflite::float_simd::FullyConnected(
           tflite::micro::GetTensorData<float>(input),
-          tflite::micro::GetTensorShape(filter),
+          FlatSizeSkipDim(output_shape, output_dims_count - 1),
+          filter_shape.Dims(filter_dims_count - 1),
           tflite::micro::GetTensorData<float>(filter),
-          tflite::micro::GetTensorShape(bias),
-          tflite::micro::GetTensorData<float>(bias),
-          tflite::micro::GetTensorShape(output),
+          bias != nullptr ? tflite::micro::GetTensorData<float>(bias) : nullptr,
+          MatchingDim(filter_shape, filter_dims_count - 2, output_shape,
+                      output_dims_count - 1),
+          op_params.float_activation_min, op_params.float_activation_max,
           tflite::micro::GetTensorData<float>(output));
       break;
     }
@@ -0,0 +1,544 @@
+/* Per-channel quantized int8 fully connected kernel with runtime SIMD
+dispatch.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "../../../../classifier/ei_classifier_config.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/common.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/int8_simd.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+#if EI_CLASSIFIER_TFLITE_ENABLE_X86_SIMD == 1
+#include <immintrin.h>
+#endif
+
+// AVX-VNNI (the 256-bit VEX encoding, without AVX-512) needs GCC 11 or
+// clang 12. Older compilers use the AVX2 kernel on those CPUs instead.
+#if EI_CLASSIFIER_TFLITE_ENABLE_X86_SIMD == 1 && \
+    ((defined(__clang__) && __clang_major__ >= 12) || \
+     (!defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 11))
+#define INT8_SIMD_HAVE_AVXVNNI 1
+#else
+#define INT8_SIMD_HAVE_AVXVNNI 0
+#endif
+
+// Fully unroll the small fixed-size loops of the blocked kernels (even at
+// -Os), so that their running sums stay in registers
+#if defined(__clang__)
+#define INT8_SIMD_UNROLL _Pragma("unroll")
+#elif defined(__GNUC__) && (__GNUC__ >= 8)
+#define INT8_SIMD_UNROLL _Pragma("GCC unroll 16")
+#else
+#define INT8_SIMD_UNROLL
+#endif
+
+#if defined(__GNUC__)
+#define INT8_SIMD_INLINE inline __attribute__((always_inline))
+#else
+#define INT8_SIMD_INLINE inline
+#endif
+
+namespace tflite {
+namespace int8_simd {
+namespace {
+
+// Computes the dot products of up to ROWS input rows with 4 weight rows
+// (dots[r * 4 + o]). Kernels that add a bias to every input first (to make
+// them unsigned) include it in the dot products.
+typedef void (*DotBlockFn)(const int8_t* input, int depth,
+                           const int8_t* weights, int32_t* dots);
+
+// Runs the layer as blocks of up to ROWS rows by 4 outputs (and single rows
+// or outputs at the edges), then requantizes every dot product.
+// input_bias is what the block kernels added to each input.
+template <int ROWS>
+void FullyConnectedBlocks(const FullyConnectedParams& params,
+                          const int8_t* input, int rows, int8_t* output,
+                          int32_t input_bias, DotBlockFn block_4x4,
+                          DotBlockFn block_1x4, DotBlockFn block_4x1,
+                          DotBlockFn block_1x1) {
+  const int depth = params.depth;
+  const int outputs = params.outputs;
+  int32_t dots[ROWS * 4];
+
+  for (int o = 0; o < outputs;) {
+    const int outs = (o + 4 <= outputs) ? 4 : 1;
+    const int8_t* w = params.weights + o * depth;
+    for (int r = 0; r < rows;) {
+      const int block_rows = (r + ROWS <= rows) ? ROWS : 1;
+      if (outs == 4) {
+        (block_rows == ROWS ? block_4x4 : block_1x4)(input + r * depth, depth,
+                                                     w, dots);
+      } else {
+        (block_rows == ROWS ? block_4x1 : block_1x1)(input + r * depth, depth,
+                                                     w, dots);
+      }
+
+      // sum((x + input_bias) * w) + (input_offset - input_bias) * sum(w)
+      // = sum((x + input_offset) * w)
+      for (int br = 0; br < block_rows; ++br) {
+        for (int bo = 0; bo < outs; ++bo) {
+          const int c = o + bo;
+          int32_t acc = dots[br * 4 + bo] +
+                        (params.input_offset - input_bias) *
+                            params.weight_sums[c];
+          if (params.bias) {
+            acc += params.bias[c];
+          }
+          acc = MultiplyByQuantizedMultiplier(
+              acc, params.output_multiplier[c], params.output_shift[c]);
+          acc += params.output_offset;
+          acc = std::max(acc, params.activation_min);
+          acc = std::min(acc, params.activation_max);
+          output[(r + br) * outputs + c] = static_cast<int8_t>(acc);
+        }
+      }
+      r += block_rows;
+    }
+    o += outs;
+  }
+}
+
+/* Portable kernel --------------------------------------------------------- */
+
+template <int ROWS, int OUTS>
+void PortableBlock(const int8_t* input, int depth, const int8_t* weights,
+                   int32_t* dots) {
+  int32_t total[ROWS][OUTS] = {};
+
+  for (int d = 0; d < depth; ++d) {
+    INT8_SIMD_UNROLL
+    for (int r = 0; r < ROWS; ++r) {
+      INT8_SIMD_UNROLL
+      for (int o = 0; o < OUTS; ++o) {
+        total[r][o] += static_cast<int32_t>(input[r * depth + d]) *
+                       static_cast<int32_t>(weights[o * depth + d]);
+      }
+    }
+  }
+  for (int r = 0; r < ROWS; ++r) {
+    for (int o = 0; o < OUTS; ++o) {
+      dots[r * 4 + o] = total[r][o];
+    }
+  }
+}
+
+void PortableFullyConnected(const FullyConnectedParams& params,
+                            const int8_t* input, int rows, int8_t* output) {
+  FullyConnectedBlocks<4>(params, input, rows, output, 0, PortableBlock<4, 4>,
+                          PortableBlock<1, 4>, PortableBlock<4, 1>,
+                          PortableBlock<1, 1>);
+}
+
+INT8_SIMD_INLINE int8_t QuantizeOne(float x, float inverse_scale,
+                                    float zero_point) {
+  // Clamped as a float, so that out of range values can't overflow
+  float q = std::nearbyint(x * inverse_scale) + zero_point;
+  q = std::min(std::max(q, -128.0f), 127.0f);
+  return static_cast<int8_t>(q);
+}
+
+void PortableQuantize(const float* input, int size, float inverse_scale,
+                      float zero_point, int8_t* output) {
+  for (int i = 0; i < size; ++i) {
+    output[i] = QuantizeOne(input[i], inverse_scale, zero_point);
+  }
+}
+
+#if EI_CLASSIFIER_TFLITE_ENABLE_X86_SIMD == 1
+
+/* AVX2 kernel (16 products per step) -------------------------------------- */
+
+// The rest of the library is SSE code, so every AVX kernel clears the upper
+// register halves before it returns to avoid AVX-SSE transition stalls
+#define INT8_SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+
+INT8_SIMD_TARGET_AVX2 INT8_SIMD_INLINE int32_t HorizontalSumAvx2(__m256i v) {
+  __m128i s = _mm_add_epi32(_mm256_castsi256_si128(v),
+                            _mm256_extracti128_si256(v, 1));
+  s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(1, 0, 3, 2)));
+  s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtsi128_si32(s);
+}
+
+// Widens to 16 bits and multiplies pairs with vpmaddwd (vpmaddubsw would
+// saturate). The tail of each sum (depth % 16) is added one product at a time.
+template <int ROWS, int OUTS>
+INT8_SIMD_TARGET_AVX2 void Avx2Block(const int8_t* input, int depth,
+                                     const int8_t* weights, int32_t* dots) {
+  __m256i acc[ROWS][OUTS];
+  INT8_SIMD_UNROLL
+  for (int r = 0; r < ROWS; ++r) {
+    INT8_SIMD_UNROLL
+    for (int o = 0; o < OUTS; ++o) {
+      acc[r][o] = _mm256_setzero_si256();
+    }
+  }
+
+  int d = 0;
+  for (; d + 16 <= depth; d += 16) {
+    __m256i w[OUTS];
+    INT8_SIMD_UNROLL
+    for (int o = 0; o < OUTS; ++o) {
+      w[o] = _mm256_cvtepi8_epi16(_mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(weights + o * depth + d)));
+    }
+    INT8_SIMD_UNROLL
+    for (int r = 0; r < ROWS; ++r) {
+      __m256i x = _mm256_cvtepi8_epi16(_mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(input + r * depth + d)));
+      INT8_SIMD_UNROLL
+      for (int o = 0; o < OUTS; ++o) {
+        acc[r][o] = _mm256_add_epi32(acc[r][o], _mm256_madd_epi16(x, w[o]));
+      }
+    }
+  }
+
+  INT8_SIMD_UNROLL
+  for (int r = 0; r < ROWS; ++r) {
+    INT8_SIMD_UNROLL
+    for (int o = 0; o < OUTS; ++o) {
+      int32_t total = HorizontalSumAvx2(acc[r][o]);
+      for (int t = d; t < depth; ++t) {
+        total += static_cast<int32_t>(input[r * depth + t]) *
+                 static_cast<int32_t>(weights[o * depth + t]);
+      }
+      dots[r * 4 + o] = total;
+    }
+  }
+  _mm256_zeroupper();
+}
+
+void Avx2FullyConnected(const FullyConnectedParams& params,
+                        const int8_t* input, int rows, int8_t* output) {
+  FullyConnectedBlocks<2>(params, input, rows, output, 0, Avx2Block<2, 4>,
+                          Avx2Block<1, 4>, Avx2Block<2, 1>, Avx2Block<1, 1>);
+}
+
+// Same steps as QuantizeOne(), 8 values at a time (vroundps uses the
+// current rounding mode, like nearbyint)
+INT8_SIMD_TARGET_AVX2 void Avx2Quantize(const float* input, int size,
+                                        float inverse_scale, float zero_point,
+                                        int8_t* output) {
+  const __m256 scale = _mm256_set1_ps(inverse_scale);
+  const __m256 offset = _mm256_set1_ps(zero_point);
+  const __m256 low = _mm256_set1_ps(-128.0f);
+  const __m256 high = _mm256_set1_ps(127.0f);
+
+  int i = 0;
+  for (; i + 8 <= size; i += 8) {
+    __m256 q = _mm256_round_ps(
+        _mm256_mul_ps(_mm256_loadu_ps(input + i), scale),
+        _MM_FROUND_CUR_DIRECTION);
+    q = _mm256_min_ps(_mm256_max_ps(_mm256_add_ps(q, offset), low), high);
+    __m256i q32 = _mm256_cvttps_epi32(q);
+    __m128i q16 = _mm_packs_epi32(_mm256_castsi256_si128(q32),
+                                  _mm256_extracti128_si256(q32, 1));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(output + i),
+                     _mm_packs_epi16(q16, q16));
+  }
+  _mm256_zeroupper();
+  for (; i < size; ++i) {
+    output[i] = QuantizeOne(input[i], inverse_scale, zero_point);
+  }
+}
+
+/* AVX-VNNI kernel (32 products per step) ---------------------------------- */
+
+#if INT8_SIMD_HAVE_AVXVNNI
+
+#define INT8_SIMD_TARGET_AVXVNNI __attribute__((target("avx2,avxvnni")))
+
+// Inputs are flipped to unsigned (x ^ 0x80 == x + 128) for vpdpbusd. The tail
+// of each sum (depth % 32) is added one product at a time.
+template <int ROWS, int OUTS>
+INT8_SIMD_TARGET_AVXVNNI void AvxVnniBlock(const int8_t* input, int depth,
+                                           const int8_t* weights,
+                                           int32_t* dots) {
+  const __m256i flip = _mm256_set1_epi8(static_cast<char>(0x80));
+  __m256i acc[ROWS][OUTS];
+  INT8_SIMD_UNROLL
+  for (int r = 0; r < ROWS; ++r) {
+    INT8_SIMD_UNROLL
+    for (int o = 0; o < OUTS; ++o) {
+      acc[r][o] = _mm256_setzero_si256();
+    }
+  }
+
+  int d = 0;
+  for (; d + 32 <= depth; d += 32) {
+    __m256i w[OUTS];
+    INT8_SIMD_UNROLL
+    for (int o = 0; o < OUTS; ++o) {
+      w[o] = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(weights + o * depth + d));
+    }
+    INT8_SIMD_UNROLL
+    for (int r = 0; r < ROWS; ++r) {
+      __m256i x = _mm256_xor_si256(
+          _mm256_loadu_si256(
+              reinterpret_cast<const __m256i*>(input + r * depth + d)),
+          flip);
+      INT8_SIMD_UNROLL
+      for (int o = 0; o < OUTS; ++o) {
+        acc[r][o] = _mm256_dpbusd_avx_epi32(acc[r][o], x, w[o]);
+      }
+    }
+  }
+
+  INT8_SIMD_UNROLL
+  for (int r = 0; r < ROWS; ++r) {
+    INT8_SIMD_UNROLL
+    for (int o = 0; o < OUTS; ++o) {
+      int32_t total = HorizontalSumAvx2(acc[r][o]);
+      for (int t = d; t < depth; ++t) {
+        total += (static_cast<int32_t>(input[r * depth + t]) + 128) *
+                 static_cast<int32_t>(weights[o * depth + t]);
+      }
+      dots[r * 4 + o] = total;
+    }
+  }
+  _mm256_zeroupper();
+}
+
+void AvxVnniFullyConnected(const FullyConnectedParams& params,
+                           const int8_t* input, int rows, int8_t* output) {
+  FullyConnectedBlocks<2>(params, input, rows, output, 128,
+                          AvxVnniBlock<2, 4>, AvxVnniBlock<1, 4>,
+                          AvxVnniBlock<2, 1>, AvxVnniBlock<1, 1>);
+}
+
+#endif  // INT8_SIMD_HAVE_AVXVNNI
+
+/* AVX-512 VNNI kernel (64 products per step) ------------------------------ */
+
+// GCC 12 warns about the deliberately undefined registers that some AVX-512
+// intrinsics start from
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+#define INT8_SIMD_TARGET_AVX512VNNI \
+  __attribute__((target("avx512f,avx512bw,avx512vnni")))
+
+// Inputs are flipped to unsigned like in the AVX-VNNI kernel. The tail of
+// each sum (depth % 64) is one more masked step: masked-off weights load as
+// 0, so the flipped inputs next to them add nothing.
+template <int ROWS, int OUTS>
+INT8_SIMD_TARGET_AVX512VNNI void Avx512VnniBlock(const int8_t* input,
+                                                 int depth,
+                                                 const int8_t* weights,
+                                                 int32_t* dots) {
+  const __m512i flip = _mm512_set1_epi8(static_cast<char>(0x80));
+  __m512i acc[ROWS][OUTS];
+  INT8_SIMD_UNROLL
+  for (int r = 0; r < ROWS; ++r) {
+    INT8_SIMD_UNROLL
+    for (int o = 0; o < OUTS; ++o) {
+      acc[r][o] = _mm512_setzero_si512();
+    }
+  }
+
+  int d = 0;
+  for (; d + 64 <= depth; d += 64) {
+    __m512i w[OUTS];
+    INT8_SIMD_UNROLL
+    for (int o = 0; o < OUTS; ++o) {
+      w[o] = _mm512_loadu_si512(weights + o * depth + d);
+    }
+    INT8_SIMD_UNROLL
+    for (int r = 0; r < ROWS; ++r) {
+      __m512i x = _mm512_xor_si512(_mm512_loadu_si512(input + r * depth + d),
+                                   flip);
+      INT8_SIMD_UNROLL
+      for (int o = 0; o < OUTS; ++o) {
+        acc[r][o] = _mm512_dpbusd_epi32(acc[r][o], x, w[o]);
+      }
+    }
+  }
+  if (d < depth) {
+    __mmask64 mask = (static_cast<__mmask64>(1) << (depth - d)) - 1;
+    __m512i w[OUTS];
+    INT8_SIMD_UNROLL
+    for (int o = 0; o < OUTS; ++o) {
+      w[o] = _mm512_maskz_loadu_epi8(mask, weights + o * depth + d);
+    }
+    INT8_SIMD_UNROLL
+    for (int r = 0; r < ROWS; ++r) {
+      __m512i x = _mm512_xor_si512(
+          _mm512_maskz_loadu_epi8(mask, input + r * depth + d), flip);
+      INT8_SIMD_UNROLL
+      for (int o = 0; o < OUTS; ++o) {
+        acc[r][o] = _mm512_dpbusd_epi32(acc[r][o], x, w[o]);
+      }
+    }
+  }
+
+  INT8_SIMD_UNROLL
+  for (int r = 0; r < ROWS; ++r) {
+    INT8_SIMD_UNROLL
+    for (int o = 0; o < OUTS; ++o) {
+      dots[r * 4 + o] = _mm512_reduce_add_epi32(acc[r][o]);
+    }
+  }
+  _mm256_zeroupper();
+}
+
+void Avx512VnniFullyConnected(const FullyConnectedParams& params,
+                              const int8_t* input, int rows, int8_t* output) {
+  FullyConnectedBlocks<4>(params, input, rows, output, 128,
+                          Avx512VnniBlock<4, 4>, Avx512VnniBlock<1, 4>,
+                          Avx512VnniBlock<4, 1>, Avx512VnniBlock<1, 1>);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif  // EI_CLASSIFIER_TFLITE_ENABLE_X86_SIMD == 1
+
+/* Dispatch ---------------------------------------------------------------- */
+
+typedef void (*FullyConnectedFn)(const FullyConnectedParams&, const int8_t*,
+                                 int, int8_t*);
+
+const FullyConnectedFn kKernels[kSimdLevelCount] = {
+    PortableFullyConnected,
+#if EI_CLASSIFIER_TFLITE_ENABLE_X86_SIMD == 1
+    Avx2FullyConnected,
+#if INT8_SIMD_HAVE_AVXVNNI
+    AvxVnniFullyConnected,
+#else
+    Avx2FullyConnected,
+#endif
+    Avx512VnniFullyConnected,
+#else
+    PortableFullyConnected,
+    PortableFullyConnected,
+    PortableFullyConnected,
+#endif
+};
+
+typedef void (*QuantizeFn)(const float*, int, float, float, int8_t*);
+
+// The VNNI levels have nothing faster for this than AVX2
+const QuantizeFn kQuantizers[kSimdLevelCount] = {
+    PortableQuantize,
+#if EI_CLASSIFIER_TFLITE_ENABLE_X86_SIMD == 1
+    Avx2Quantize,
+    Avx2Quantize,
+    Avx2Quantize,
+#else
+    PortableQuantize,
+    PortableQuantize,
+    PortableQuantize,
+#endif
+};
+
+// Level in use (-1 until the first kernel runs)
+std::atomic<int> current_level(-1);
+
+SimdLevel Detect() {
+#if EI_CLASSIFIER_TFLITE_ENABLE_X86_SIMD == 1
+  // Also checks that the OS saves the wider registers (XGETBV)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512vnni") &&
+      __builtin_cpu_supports("avx512bw")) {
+    return kSimdAvx512Vnni;
+  }
+#if INT8_SIMD_HAVE_AVXVNNI
+  if (__builtin_cpu_supports("avxvnni")) {
+    return kSimdAvxVnni;
+  }
+#endif
+  if (__builtin_cpu_supports("avx2")) {
+    return kSimdAvx2;
+  }
+#endif
+  return kSimdPortable;
+}
+
+inline int CurrentLevel() {
+  int level = current_level.load(std::memory_order_relaxed);
+  if (level < 0) {
+    level = DetectedSimdLevel();
+    current_level.store(level, std::memory_order_relaxed);
+  }
+  return level;
+}
+
+}  // namespace
+
+SimdLevel DetectedSimdLevel() {
+  static const SimdLevel detected = Detect();
+  return detected;
+}
+
+SimdLevel GetSimdLevel() {
+  return static_cast<SimdLevel>(CurrentLevel());
+}
+
+SimdLevel SetSimdLevel(SimdLevel level) {
+  SimdLevel best = DetectedSimdLevel();
+  if (level < kSimdPortable || level > best) {
+    level = best;
+  }
+  current_level.store(level, std::memory_order_relaxed);
+  return level;
+}
+
+const char* SimdLevelName(SimdLevel level) {
+  switch (level) {
+    case kSimdPortable:
+      return "portable";
+    case kSimdAvx2:
+      return "avx2";
+    case kSimdAvxVnni:
+      return "avx-vnni";
+    case kSimdAvx512Vnni:
+      return "avx512-vnni";
+    default:
+      return "unknown";
+  }
+}
+
+void WeightSums(const int8_t* weights, int depth, int outputs,
+                int32_t* weight_sums) {
+  for (int o = 0; o < outputs; ++o) {
+    int32_t sum = 0;
+    for (int d = 0; d < depth; ++d) {
+      sum += weights[o * depth + d];
+    }
+    weight_sums[o] = sum;
+  }
+}
+
+void FullyConnected(const FullyConnectedParams& params, const int8_t* input,
+                    int rows, int8_t* output) {
+  kKernels[CurrentLevel()](params, input, rows, output);
+}
+
+void Quantize(const float* input, int size, float scale, int32_t zero_point,
+              int8_t* output) {
+  kQuantizers[CurrentLevel()](input, size, 1.0f / scale,
+                              static_cast<float>(zero_point), output);
+}
+
+}  // namespace int8_simd
+}  // namespace tflite
@@ -450,6 +450,7 @@ limitations under the License.
 #include "edge-impulse-sdk/tensorflow/lite/kernels/internal/tensor_ctypes.h"
 #include "edge-impulse-sdk/tensorflow/lite/kernels/kernel_util.h"
 #include "edge-impulse-sdk/tensorflow/lite/kernels/op_macros.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/float_simd.h"
 #include "edge-impulse-sdk/tensorflow/lite/micro/kernels/kernel_util.h"
 
 namespace tflite {
@@ -495,10 +496,16 @@ TfLiteStatus SoftmaxEval(TfLiteContext* context, TfLiteNode* node) {
       return kTfLiteError;
       #endif
 
-      tflite::reference_ops::Softmax(
-          op_data, tflite::micro::GetTensorShape(input),
+      // Same shapes as reference_ops::Softmax(), run by the SIMD kernels
+      // where the CPU has them (see float_simd.h)
+      const RuntimeShape input_shape = tflite::micro::GetTensorShape(input);
+      const RuntimeShape output_shape = tflite::micro::GetTensorShape(output);
+      const int trailing_dim = input_shape.DimensionsCount() - 1;
+      tflite::float_simd::Softmax(
           tflite::micro::GetTensorData<float>(input),
-          tflite::micro::GetTensorShape(output),
+          MatchingFlatSizeSkipDim(input_shape, trailing_dim, output_shape),
+          MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim),
+          static_cast<float>(op_data.beta),
           tflite::micro::GetTensorData<float>(output));
       return kTfLiteOk;
     }
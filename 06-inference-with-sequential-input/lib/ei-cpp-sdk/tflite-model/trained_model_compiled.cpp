@@ -22,10 +22,16 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <limits>
 #include "edge-impulse-sdk/tensorflow/lite/c/builtin_op_data.h"
 #include "edge-impulse-sdk/tensorflow/lite/c/common.h"
 #include "edge-impulse-sdk/tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/float_simd.h"
 #include "edge-impulse-sdk/porting/ei_classifier_porting.h"
+#include "edge-impulse-sdk/dsp/ei_profiler.h"
+#include "tflite-model/trained_model_compiled.h"
 
 #if EI_CLASSIFIER_PRINT_STATE
 #if defined(__cplusplus) && EI_C_LINKAGE == 1
@@ -45,13 +51,17 @@ extern void ei_printf(const char *format, ...);
 #define ALIGN(X) __align(X)
 #endif
 
-#ifndef EI_MAX_SCRATCH_BUFFER_COUNT
-#define EI_MAX_SCRATCH_BUFFER_COUNT 4
-#endif // EI_MAX_SCRATCH_BUFFER_COUNT
-
-#ifndef EI_MAX_OVERFLOW_BUFFER_COUNT
-#define EI_MAX_OVERFLOW_BUFFER_COUNT 10
-#endif // EI_MAX_OVERFLOW_BUFFER_COUNT
+// The functions without a context use a default context and arena, one per
+// thread where the platform has thread-local storage. An arena placed in a
+// named section can't be thread-local, so those builds get one of each per
+// process.
+#if (defined(__linux__) || defined(__APPLE__) || defined(_WIN32)) && \
+    !defined(EI_CLASSIFIER_ALLOCATION_STATIC_HIMAX) && \
+    !defined(EI_CLASSIFIER_ALLOCATION_STATIC_HIMAX_GNU)
+#define EI_MODEL_THREAD_LOCAL thread_local
+#else
+#define EI_MODEL_THREAD_LOCAL
+#endif
 
 using namespace tflite;
 using namespace tflite::ops;
@@ -59,10 +69,10 @@ using namespace tflite::ops::micro;
 
 namespace {
 
-constexpr int kTensorArenaSize = 4112;
+constexpr int kTensorArenaSize = TRAINED_MODEL_ARENA_SIZE;
 
 #if defined(EI_CLASSIFIER_ALLOCATION_STATIC)
-uint8_t tensor_arena[kTensorArenaSize] ALIGN(16);
+EI_MODEL_THREAD_LOCAL uint8_t tensor_arena[kTensorArenaSize] ALIGN(16);
 #elif defined(EI_CLASSIFIER_ALLOCATION_STATIC_HIMAX)
 #pragma Bss(".tensor_arena")
 uint8_t tensor_arena[kTensorArenaSize] ALIGN(16);
@@ -71,11 +81,11 @@ uint8_t tensor_arena[kTensorArenaSize] ALIGN(16);
 uint8_t tensor_arena[kTensorArenaSize] ALIGN(16) __attribute__((section(".tensor_arena")));
 #else
 #define EI_CLASSIFIER_ALLOCATION_HEAP 1
-uint8_t* tensor_arena = NULL;
+EI_MODEL_THREAD_LOCAL uint8_t* tensor_arena = NULL;
 #endif
 
-static uint8_t* tensor_boundary;
-static uint8_t* current_location;
+EI_MODEL_THREAD_LOCAL trained_model_ctx_t default_ctx;
+EI_MODEL_THREAD_LOCAL bool default_ctx_ready = false;
 
 template <int SZ, class T> struct TfArray {
   int sz; T elem[SZ];
@@ -96,11 +106,17 @@ struct NodeInfo_t { // subset of TfLiteNode used for initialization from constan
   used_operators_e used_op_index;
 };
 
-TfLiteContext ctx{};
-TfLiteTensor tflTensors[11];
-TfLiteEvalTensor tflEvalTensors[11];
-TfLiteRegistration registrations[OP_LAST];
-TfLiteNode tflNodes[4];
+// Kernels are looked up once and shared by every context
+const TfLiteRegistration *GetRegistrations() {
+  static const struct Registrations {
+    TfLiteRegistration ops[OP_LAST];
+    Registrations() {
+      ops[OP_FULLY_CONNECTED] = Register_FULLY_CONNECTED();
+      ops[OP_SOFTMAX] = Register_SOFTMAX();
+    }
+  } registrations;
+  return registrations.ops;
+}
 
 const TfArray<2, int> tensor_dimension0 = { 2, { 1,900 } };
 const ALIGN(16) float tensor_data1[5] = { 0.5593298077583313, -0.89282739162445068, -0.0055895969271659851, 0.13593842089176178, 0.20730917155742645, };
@@ -260,30 +276,41 @@ const TfLiteSoftmaxParams opdata3 = { 1 };
 const TfArray<1, int> inputs3 = { 1, { 9 } };
 const TfArray<1, int> outputs3 = { 1, { 10 } };
 const TensorInfo_t tensorData[] = {
-  { kTfLiteArenaRw, tensor_arena + 0, (TfLiteIntArray*)&tensor_dimension0, 3600, },
+  { kTfLiteArenaRw, (void*)0, (TfLiteIntArray*)&tensor_dimension0, 3600, },
   { kTfLiteMmapRo, (void*)tensor_data1, (TfLiteIntArray*)&tensor_dimension1, 20, },
   { kTfLiteMmapRo, (void*)tensor_data2, (TfLiteIntArray*)&tensor_dimension2, 160, },
   { kTfLiteMmapRo, (void*)tensor_data3, (TfLiteIntArray*)&tensor_dimension3, 320, },
   { kTfLiteMmapRo, (void*)tensor_data4, (TfLiteIntArray*)&tensor_dimension4, 288000, },
   { kTfLiteMmapRo, (void*)tensor_data5, (TfLiteIntArray*)&tensor_dimension5, 12800, },
   { kTfLiteMmapRo, (void*)tensor_data6, (TfLiteIntArray*)&tensor_dimension6, 800, },
-  { kTfLiteArenaRw, tensor_arena + 3600, (TfLiteIntArray*)&tensor_dimension7, 320, },
-  { kTfLiteArenaRw, tensor_arena + 0, (TfLiteIntArray*)&tensor_dimension8, 160, },
-  { kTfLiteArenaRw, tensor_arena + 160, (TfLiteIntArray*)&tensor_dimension9, 20, },
-  { kTfLiteArenaRw, tensor_arena + 0, (TfLiteIntArray*)&tensor_dimension10, 20, },
+  { kTfLiteArenaRw, (void*)3600, (TfLiteIntArray*)&tensor_dimension7, 320, },
+  { kTfLiteArenaRw, (void*)0, (TfLiteIntArray*)&tensor_dimension8, 160, },
+  { kTfLiteArenaRw, (void*)160, (TfLiteIntArray*)&tensor_dimension9, 20, },
+  { kTfLiteArenaRw, (void*)0, (TfLiteIntArray*)&tensor_dimension10, 20, },
 };const NodeInfo_t nodeData[] = {
   { (TfLiteIntArray*)&inputs0, (TfLiteIntArray*)&outputs0, const_cast<void*>(static_cast<const void*>(&opdata0)), OP_FULLY_CONNECTED, },
   { (TfLiteIntArray*)&inputs1, (TfLiteIntArray*)&outputs1, const_cast<void*>(static_cast<const void*>(&opdata1)), OP_FULLY_CONNECTED, },
   { (TfLiteIntArray*)&inputs2, (TfLiteIntArray*)&outputs2, const_cast<void*>(static_cast<const void*>(&opdata2)), OP_FULLY_CONNECTED, },
   { (TfLiteIntArray*)&inputs3, (TfLiteIntArray*)&outputs3, const_cast<void*>(static_cast<const void*>(&opdata3)), OP_SOFTMAX, },
 };
-static void* overflow_buffers[EI_MAX_OVERFLOW_BUFFER_COUNT];
-static size_t overflow_buffers_ix = 0;
+// Span names of the nodes in traces (see ei_profiler.h)
+const char *const nodeNames[] = {
+  "node 0 FULLY_CONNECTED",
+  "node 1 FULLY_CONNECTED",
+  "node 2 FULLY_CONNECTED",
+  "node 3 SOFTMAX",
+};
+// The model context that owns a TfLiteContext
+static trained_model_ctx_t *GetModelCtx(const struct TfLiteContext* ctx) {
+  return (trained_model_ctx_t *)ctx->impl_;
+}
+
 static void * AllocatePersistentBuffer(struct TfLiteContext* ctx,
                                        size_t bytes) {
+  trained_model_ctx_t *mctx = GetModelCtx(ctx);
   void *ptr;
-  if (current_location - bytes < tensor_boundary) {
-    if (overflow_buffers_ix > EI_MAX_OVERFLOW_BUFFER_COUNT - 1) {
+  if (mctx->current_location - bytes < mctx->tensor_boundary) {
+    if (mctx->overflow_buffers_ix > EI_MAX_OVERFLOW_BUFFER_COUNT - 1) {
       ei_printf("ERR: Failed to allocate persistent buffer of size %d, does not fit in tensor arena and reached EI_MAX_OVERFLOW_BUFFER_COUNT\n",
         (int)bytes);
       return NULL;
@@ -296,145 +323,224 @@ static void * AllocatePersistentBuffer(struct TfLiteContext* ctx,
       ei_printf("ERR: Failed to allocate persistent buffer of size %d\n", (int)bytes);
       return NULL;
     }
-    overflow_buffers[overflow_buffers_ix++] = ptr;
+    mctx->overflow_buffers[mctx->overflow_buffers_ix++] = ptr;
     return ptr;
   }
 
-  current_location -= bytes;
+  mctx->current_location -= bytes;
 
-  ptr = current_location;
+  ptr = mctx->current_location;
   memset(ptr, 0, bytes);
 
   return ptr;
 }
-typedef struct {
-  size_t bytes;
-  void *ptr;
-} scratch_buffer_t;
-static scratch_buffer_t scratch_buffers[EI_MAX_SCRATCH_BUFFER_COUNT];
-static size_t scratch_buffers_ix = 0;
 
 static TfLiteStatus RequestScratchBufferInArena(struct TfLiteContext* ctx, size_t bytes,
                                                 int* buffer_idx) {
-  if (scratch_buffers_ix > EI_MAX_SCRATCH_BUFFER_COUNT - 1) {
+  trained_model_ctx_t *mctx = GetModelCtx(ctx);
+  if (mctx->scratch_buffers_ix > EI_MAX_SCRATCH_BUFFER_COUNT - 1) {
     ei_printf("ERR: Failed to allocate scratch buffer of size %d, reached EI_MAX_SCRATCH_BUFFER_COUNT\n",
       (int)bytes);
     return kTfLiteError;
   }
 
-  scratch_buffer_t b;
-  b.bytes = bytes;
-
-  b.ptr = AllocatePersistentBuffer(ctx, b.bytes);
-  if (!b.ptr) {
+  void *ptr = AllocatePersistentBuffer(ctx, bytes);
+  if (!ptr) {
     ei_printf("ERR: Failed to allocate scratch buffer of size %d\n",
       (int)bytes);
     return kTfLiteError;
   }
 
-  scratch_buffers[scratch_buffers_ix] = b;
-  *buffer_idx = scratch_buffers_ix;
+  mctx->scratch_buffers[mctx->scratch_buffers_ix] = ptr;
+  *buffer_idx = mctx->scratch_buffers_ix;
 
-  scratch_buffers_ix++;
+  mctx->scratch_buffers_ix++;
 
   return kTfLiteOk;
 }
 
 static void* GetScratchBuffer(struct TfLiteContext* ctx, int buffer_idx) {
-  if (buffer_idx > (int)scratch_buffers_ix) {
+  trained_model_ctx_t *mctx = GetModelCtx(ctx);
+  if (buffer_idx > (int)mctx->scratch_buffers_ix) {
     return NULL;
   }
-  return scratch_buffers[buffer_idx].ptr;
+  return mctx->scratch_buffers[buffer_idx];
 }
 
 static TfLiteTensor* GetTensor(const struct TfLiteContext* context,
                                int tensor_idx) {
-  return &tflTensors[tensor_idx];
+  return &GetModelCtx(context)->tensors[tensor_idx];
 }
 
 static TfLiteEvalTensor* GetEvalTensor(const struct TfLiteContext* context,
                                        int tensor_idx) {
-  return &tflEvalTensors[tensor_idx];
+  return &GetModelCtx(context)->eval_tensors[tensor_idx];
+}
+
+#if EI_CLASSIFIER_PRINT_STATE
+static void PrintTensors(trained_model_ctx_t *mctx, const TfLiteIntArray *indices) {
+  for (int ix = 0; ix < indices->size; ix++) {
+    const TfLiteTensor *t = &mctx->tensors[indices->data[ix]];
+
+    if (t->type == kTfLiteInt8) {
+      int8_t* data = (int8_t*)t->data.data;
+      ei_printf("        %d (%zu bytes, ptr=%p, alloc_type=%d, type=%d): ", ix, t->bytes, data, (int)t->allocation_type, (int)t->type);
+      for (size_t jx = 0; jx < t->bytes; jx++) {
+        ei_printf("%d ", data[jx]);
+      }
+    }
+    else {
+      float* data = (float*)t->data.data;
+      ei_printf("        %d (%zu bytes, ptr=%p, alloc_type=%d, type=%d): ", ix, t->bytes, data, (int)t->allocation_type, (int)t->type);
+      for (size_t jx = 0; jx < t->bytes / 4; jx++) {
+        ei_printf("%f ", data[jx]);
+      }
+    }
+    ei_printf("\n");
+  }
+}
+#endif // EI_CLASSIFIER_PRINT_STATE
+
+// Output range of a fused activation
+static TfLiteStatus ActivationRange(TfLiteFusedActivation activation, float *act_min, float *act_max) {
+  switch (activation) {
+    case kTfLiteActNone:
+      *act_min = std::numeric_limits<float>::lowest();
+      *act_max = std::numeric_limits<float>::max();
+      return kTfLiteOk;
+    case kTfLiteActRelu:
+      *act_min = 0.0f;
+      *act_max = std::numeric_limits<float>::max();
+      return kTfLiteOk;
+    case kTfLiteActReluN1To1:
+      *act_min = -1.0f;
+      *act_max = 1.0f;
+      return kTfLiteOk;
+    case kTfLiteActRelu6:
+      *act_min = 0.0f;
+      *act_max = 6.0f;
+      return kTfLiteOk;
+    default:
+      return kTfLiteError;
+  }
+}
+
+// Runs nodes first_node and up over rows rows, with every tensor at data[i]
+// (rows of row_floats[i] floats)
+static TfLiteStatus RunNodes(float *const *data, const size_t *row_floats, int rows, size_t first_node) {
+  TfLiteStatus status = kTfLiteOk;
+
+  for (size_t n = first_node; n < TRAINED_MODEL_NODE_COUNT && status == kTfLiteOk; ++n) {
+    EI_PROFILER_SCOPE(nodeNames[n]);
+    const TfLiteIntArray *inputs = nodeData[n].inputs;
+    int out_ix = nodeData[n].outputs->data[0];
+
+    switch (nodeData[n].used_op_index) {
+      case OP_FULLY_CONNECTED: {
+        const TfLiteFullyConnectedParams *params = (const TfLiteFullyConnectedParams *)nodeData[n].builtin_data;
+        const TfLiteIntArray *weights_dims = tensorData[inputs->data[1]].dims;
+        const float *bias = (inputs->size > 2 && inputs->data[2] >= 0) ? data[inputs->data[2]] : nullptr;
+        float act_min, act_max;
+        status = ActivationRange(params->activation, &act_min, &act_max);
+        if (status == kTfLiteOk) {
+          float_simd::FullyConnected(data[inputs->data[0]], rows, weights_dims->data[1],
+                                     data[inputs->data[1]], bias, weights_dims->data[0],
+                                     act_min, act_max, data[out_ix]);
+        }
+        break;
+      }
+      case OP_SOFTMAX: {
+        const TfLiteSoftmaxParams *params = (const TfLiteSoftmaxParams *)nodeData[n].builtin_data;
+        float_simd::Softmax(data[inputs->data[0]], rows, (int)row_floats[out_ix], params->beta, data[out_ix]);
+        break;
+      }
+      default:
+        status = kTfLiteError;
+        break;
+    }
+  }
+
+  return status;
 }
 
 } // namespace
 
-TfLiteStatus trained_model_init( void*(*alloc_fnc)(size_t,size_t) ) {
-#ifdef EI_CLASSIFIER_ALLOCATION_HEAP
-  tensor_arena = (uint8_t*) alloc_fnc(16, kTensorArenaSize);
-  if (!tensor_arena) {
-    ei_printf("ERR: failed to allocate tensor arena\n");
+TfLiteStatus trained_model_ctx_init(trained_model_ctx_t *mctx, uint8_t *arena, size_t arena_size) {
+  const TfLiteRegistration *registrations = GetRegistrations();
+
+  if (!arena || arena_size < (size_t)kTensorArenaSize || ((uintptr_t)arena % 16) != 0) {
+    ei_printf("ERR: tensor arena must be at least %d bytes and 16-byte aligned\n", kTensorArenaSize);
     return kTfLiteError;
   }
-#else
-  memset(tensor_arena, 0, kTensorArenaSize);
-#endif
-  tensor_boundary = tensor_arena;
-  current_location = tensor_arena + kTensorArenaSize;
+  memset(arena, 0, kTensorArenaSize);
+  mctx->arena = arena;
+  mctx->tensor_boundary = arena;
+  mctx->current_location = arena + kTensorArenaSize;
+  mctx->scratch_buffers_ix = 0;
+  mctx->overflow_buffers_ix = 0;
+
+  TfLiteContext &ctx = mctx->ctx;
+  memset(&ctx, 0, sizeof(ctx));
+  ctx.impl_ = mctx;
   ctx.AllocatePersistentBuffer = &AllocatePersistentBuffer;
   ctx.RequestScratchBufferInArena = &RequestScratchBufferInArena;
   ctx.GetScratchBuffer = &GetScratchBuffer;
   ctx.GetTensor = &GetTensor;
   ctx.GetEvalTensor = &GetEvalTensor;
-  ctx.tensors = tflTensors;
-  ctx.tensors_size = 11;
-  for (size_t i = 0; i < 11; ++i) {
-    tflTensors[i].type = kTfLiteFloat32;
-    tflEvalTensors[i].type = kTfLiteFloat32;
-    tflTensors[i].is_variable = 0;
-
-#if defined(EI_CLASSIFIER_ALLOCATION_HEAP)
-    tflTensors[i].allocation_type = tensorData[i].allocation_type;
-#else
-    tflTensors[i].allocation_type = (tensor_arena <= tensorData[i].data && tensorData[i].data < tensor_arena + kTensorArenaSize) ? kTfLiteArenaRw : kTfLiteMmapRo;
-#endif
-    tflTensors[i].bytes = tensorData[i].bytes;
-    tflTensors[i].dims = tensorData[i].dims;
-    tflEvalTensors[i].dims = tensorData[i].dims;
-
-#if defined(EI_CLASSIFIER_ALLOCATION_HEAP)
-    if(tflTensors[i].allocation_type == kTfLiteArenaRw){
-      uint8_t* start = (uint8_t*) ((uintptr_t)tensorData[i].data + (uintptr_t) tensor_arena);
-
-     tflTensors[i].data.data =  start;
-     tflEvalTensors[i].data.data =  start;
+  ctx.tensors = mctx->tensors;
+  ctx.tensors_size = TRAINED_MODEL_TENSOR_COUNT;
+  for (size_t i = 0; i < TRAINED_MODEL_TENSOR_COUNT; ++i) {
+    TfLiteTensor &tensor = mctx->tensors[i];
+    TfLiteEvalTensor &eval_tensor = mctx->eval_tensors[i];
+    memset(&tensor, 0, sizeof(tensor));
+    memset(&eval_tensor, 0, sizeof(eval_tensor));
+    tensor.type = kTfLiteFloat32;
+    eval_tensor.type = kTfLiteFloat32;
+    tensor.is_variable = 0;
+    tensor.allocation_type = tensorData[i].allocation_type;
+    tensor.bytes = tensorData[i].bytes;
+    tensor.dims = tensorData[i].dims;
+    eval_tensor.dims = tensorData[i].dims;
+
+    // Activations are offsets into this context's arena; weights are shared
+    if (tensor.allocation_type == kTfLiteArenaRw) {
+      uint8_t* start = arena + (uintptr_t)tensorData[i].data;
+
+      tensor.data.data = start;
+      eval_tensor.data.data = start;
     }
     else {
-       tflTensors[i].data.data = tensorData[i].data;
-       tflEvalTensors[i].data.data = tensorData[i].data;
+      tensor.data.data = tensorData[i].data;
+      eval_tensor.data.data = tensorData[i].data;
     }
-#else
-    tflTensors[i].data.data = tensorData[i].data;
-    tflEvalTensors[i].data.data = tensorData[i].data;
-#endif // EI_CLASSIFIER_ALLOCATION_HEAP
-    tflTensors[i].quantization.type = kTfLiteNoQuantization;
-    if (tflTensors[i].allocation_type == kTfLiteArenaRw) {
-      auto data_end_ptr = (uint8_t*)tflTensors[i].data.data + tensorData[i].bytes;
-      if (data_end_ptr > tensor_boundary) {
-        tensor_boundary = data_end_ptr;
+    tensor.quantization.type = kTfLiteNoQuantization;
+    if (tensor.allocation_type == kTfLiteArenaRw) {
+      auto data_end_ptr = (uint8_t*)tensor.data.data + tensorData[i].bytes;
+      if (data_end_ptr > mctx->tensor_boundary) {
+        mctx->tensor_boundary = data_end_ptr;
       }
     }
   }
-  if (tensor_boundary > current_location /* end of arena size */) {
+  if (mctx->tensor_boundary > mctx->current_location /* end of arena size */) {
     ei_printf("ERR: tensor arena is too small, does not fit model - even without scratch buffers\n");
     return kTfLiteError;
   }
-  registrations[OP_FULLY_CONNECTED] = Register_FULLY_CONNECTED();
-  registrations[OP_SOFTMAX] = Register_SOFTMAX();
-
-  for (size_t i = 0; i < 4; ++i) {
-    tflNodes[i].inputs = nodeData[i].inputs;
-    tflNodes[i].outputs = nodeData[i].outputs;
-    tflNodes[i].builtin_data = nodeData[i].builtin_data;
-tflNodes[i].custom_initial_data = nullptr;
-      tflNodes[i].custom_initial_data_size = 0;
-if (registrations[nodeData[i].used_op_index].init) {
-      tflNodes[i].user_data = registrations[nodeData[i].used_op_index].init(&ctx, (const char*)tflNodes[i].builtin_data, 0);
+
+  for (size_t i = 0; i < TRAINED_MODEL_NODE_COUNT; ++i) {
+    TfLiteNode &node = mctx->nodes[i];
+    memset(&node, 0, sizeof(node));
+    node.inputs = nodeData[i].inputs;
+    node.outputs = nodeData[i].outputs;
+    node.builtin_data = nodeData[i].builtin_data;
+    node.custom_initial_data = nullptr;
+    node.custom_initial_data_size = 0;
+    if (registrations[nodeData[i].used_op_index].init) {
+      node.user_data = registrations[nodeData[i].used_op_index].init(&ctx, (const char*)node.builtin_data, 0);
     }
   }
-  for (size_t i = 0; i < 4; ++i) {
+  for (size_t i = 0; i < TRAINED_MODEL_NODE_COUNT; ++i) {
     if (registrations[nodeData[i].used_op_index].prepare) {
-      TfLiteStatus status = registrations[nodeData[i].used_op_index].prepare(&ctx, &tflNodes[i]);
+      TfLiteStatus status = registrations[nodeData[i].used_op_index].prepare(&ctx, &mctx->nodes[i]);
       if (status != kTfLiteOk) {
         return status;
       }
@@ -446,99 +552,348 @@ if (registrations[nodeData[i].used_op_index].init) {
 static const int inTensorIndices[] = {
   0, 
 };
-TfLiteTensor* trained_model_input(int index) {
-  return &ctx.tensors[inTensorIndices[index]];
+TfLiteTensor* trained_model_ctx_input(trained_model_ctx_t *mctx, int index) {
+  return &mctx->tensors[inTensorIndices[index]];
+}
+
+TfLiteStatus trained_model_ctx_set_input_data(trained_model_ctx_t *mctx, int index, void *data) {
+  const TensorInfo_t &info = tensorData[inTensorIndices[index]];
+  if (!data) {
+    // Back to the tensor's own place in the arena
+    if (info.allocation_type != kTfLiteArenaRw) {
+      return kTfLiteError;
+    }
+    data = mctx->arena + (uintptr_t)info.data;
+  }
+  // Kernels read the eval tensors, so both have to point at the data
+  mctx->tensors[inTensorIndices[index]].data.data = data;
+  mctx->eval_tensors[inTensorIndices[index]].data.data = data;
+  return kTfLiteOk;
 }
 
 static const int outTensorIndices[] = {
   10, 
 };
-TfLiteTensor* trained_model_output(int index) {
-  return &ctx.tensors[outTensorIndices[index]];
+TfLiteTensor* trained_model_ctx_output(trained_model_ctx_t *mctx, int index) {
+  return &mctx->tensors[outTensorIndices[index]];
 }
 
-TfLiteStatus trained_model_invoke() {
-  for (size_t i = 0; i < 4; ++i) {
-    TfLiteStatus status = registrations[nodeData[i].used_op_index].invoke(&ctx, &tflNodes[i]);
+TfLiteStatus trained_model_ctx_invoke(trained_model_ctx_t *mctx) {
+  EI_PROFILER_SCOPE("invoke");
+  const TfLiteRegistration *registrations = GetRegistrations();
+
+  for (size_t i = 0; i < TRAINED_MODEL_NODE_COUNT; ++i) {
+    EiProfilerScope node_span(nodeNames[i]);
+    TfLiteStatus status = registrations[nodeData[i].used_op_index].invoke(&mctx->ctx, &mctx->nodes[i]);
 
 #if EI_CLASSIFIER_PRINT_STATE
     ei_printf("layer %lu\n", i);
     ei_printf("    inputs:\n");
-    for (size_t ix = 0; ix < tflNodes[i].inputs->size; ix++) {
-      auto d = tensorData[tflNodes[i].inputs->data[ix]];
+    PrintTensors(mctx, mctx->nodes[i].inputs);
+    ei_printf("\n");
 
-      size_t data_ptr = (size_t)d.data;
+    ei_printf("    outputs:\n");
+    PrintTensors(mctx, mctx->nodes[i].outputs);
+    ei_printf("\n");
+#endif // EI_CLASSIFIER_PRINT_STATE
 
-      if (d.allocation_type == kTfLiteArenaRw) {
-        data_ptr = (size_t)tensor_arena + data_ptr;
-      }
+    if (status != kTfLiteOk) {
+      return status;
+    }
+  }
+  return kTfLiteOk;
+}
 
-      if (d.type == TfLiteType::kTfLiteInt8) {
-        int8_t* data = (int8_t*)data_ptr;
-        ei_printf("        %lu (%zu bytes, ptr=%p, alloc_type=%d, type=%d): ", ix, d.bytes, data, (int)d.allocation_type, (int)d.type);
-        for (size_t jx = 0; jx < d.bytes; jx++) {
-          ei_printf("%d ", data[jx]);
-        }
+TfLiteStatus trained_model_ctx_reset(trained_model_ctx_t *mctx) {
+  // scratch buffers are allocated within the arena, so just reset the counter so memory can be reused
+  mctx->scratch_buffers_ix = 0;
+
+  // overflow buffers are on the heap, so free them first
+  for (size_t ix = 0; ix < mctx->overflow_buffers_ix; ix++) {
+    ei_free(mctx->overflow_buffers[ix]);
+  }
+  mctx->overflow_buffers_ix = 0;
+  return kTfLiteOk;
+}
+
+TfLiteStatus trained_model_invoke_batch(const float *input, float *output, size_t batch_size) {
+  float *data[TRAINED_MODEL_TENSOR_COUNT];
+  size_t row_floats[TRAINED_MODEL_TENSOR_COUNT];
+  size_t scratch_floats = 0;
+  TfLiteStatus status = kTfLiteOk;
+  EI_PROFILER_SCOPE("invoke batch");
+
+  // Every activation gets room for a tile of rows (the inputs and outputs
+  // are read and written in place)
+  for (size_t i = 0; i < TRAINED_MODEL_TENSOR_COUNT; ++i) {
+    row_floats[i] = tensorData[i].bytes / sizeof(float);
+    if (tensorData[i].allocation_type == kTfLiteArenaRw &&
+        (int)i != inTensorIndices[0] && (int)i != outTensorIndices[0]) {
+      scratch_floats += row_floats[i] * TRAINED_MODEL_BATCH_TILE;
+    }
+  }
+  float *scratch = (float *)ei_malloc(scratch_floats * sizeof(float));
+  if (!scratch) {
+    ei_printf("ERR: failed to allocate batch buffers\n");
+    return kTfLiteError;
+  }
+
+  for (size_t row = 0; row < batch_size && status == kTfLiteOk; row += TRAINED_MODEL_BATCH_TILE) {
+    int rows = (int)std::min((size_t)TRAINED_MODEL_BATCH_TILE, batch_size - row);
+
+    float *next = scratch;
+    for (size_t i = 0; i < TRAINED_MODEL_TENSOR_COUNT; ++i) {
+      if ((int)i == inTensorIndices[0]) {
+        data[i] = const_cast<float *>(input) + row * row_floats[i];
+      }
+      else if ((int)i == outTensorIndices[0]) {
+        data[i] = output + row * row_floats[i];
+      }
+      else if (tensorData[i].allocation_type == kTfLiteArenaRw) {
+        data[i] = next;
+        next += row_floats[i] * TRAINED_MODEL_BATCH_TILE;
       }
       else {
-        float* data = (float*)data_ptr;
-        ei_printf("        %lu (%zu bytes, ptr=%p, alloc_type=%d, type=%d): ", ix, d.bytes, data, (int)d.allocation_type, (int)d.type);
-        for (size_t jx = 0; jx < d.bytes / 4; jx++) {
-          ei_printf("%f ", data[jx]);
-        }
+        data[i] = (float *)tensorData[i].data;
       }
-      ei_printf("\n");
     }
-    ei_printf("\n");
 
-    ei_printf("    outputs:\n");
-    for (size_t ix = 0; ix < tflNodes[i].outputs->size; ix++) {
-      auto d = tensorData[tflNodes[i].outputs->data[ix]];
+    status = RunNodes(data, row_floats, rows, 0);
+  }
 
-      size_t data_ptr = (size_t)d.data;
+  ei_free(scratch);
+  return status;
+}
 
-      if (d.allocation_type == kTfLiteArenaRw) {
-        data_ptr = (size_t)tensor_arena + data_ptr;
-      }
+TfLiteStatus trained_model_sliding_init(trained_model_sliding_t *sw, int slices) {
+  memset(sw, 0, sizeof(*sw));
 
-      if (d.type == TfLiteType::kTfLiteInt8) {
-        int8_t* data = (int8_t*)data_ptr;
-        ei_printf("        %lu (%zu bytes, ptr=%p, alloc_type=%d, type=%d): ", ix, d.bytes, data, (int)d.allocation_type, (int)d.type);
-        for (size_t jx = 0; jx < d.bytes; jx++) {
-          ei_printf("%d ", data[jx]);
-        }
-      }
-      else {
-        float* data = (float*)data_ptr;
-        ei_printf("        %lu (%zu bytes, ptr=%p, alloc_type=%d, type=%d): ", ix, d.bytes, data, (int)d.allocation_type, (int)d.type);
-        for (size_t jx = 0; jx < d.bytes / 4; jx++) {
-          ei_printf("%f ", data[jx]);
-        }
+  // The first node has to be a fully connected layer on the model input
+  const NodeInfo_t &first = nodeData[0];
+  if (first.used_op_index != OP_FULLY_CONNECTED || first.inputs->data[0] != inTensorIndices[0]) {
+    ei_printf("ERR: sliding window needs a fully connected first layer\n");
+    return kTfLiteError;
+  }
+  const TfLiteIntArray *weights_dims = tensorData[first.inputs->data[1]].dims;
+  const int units = weights_dims->data[0];
+  const int depth = weights_dims->data[1];
+  if (slices < 1 || depth % slices != 0) {
+    ei_printf("ERR: %d inputs can't be split into %d slices\n", depth, slices);
+    return kTfLiteError;
+  }
+
+  sw->slices = slices;
+  sw->slice_size = depth / slices;
+  sw->units = units;
+
+  // Room for the activations of one row, except for the model input (which
+  // is never needed) and output (which goes to the caller)
+  size_t scratch_floats = 0;
+  for (size_t i = 0; i < TRAINED_MODEL_TENSOR_COUNT; ++i) {
+    sw->row_floats[i] = tensorData[i].bytes / sizeof(float);
+    if (tensorData[i].allocation_type == kTfLiteArenaRw &&
+        (int)i != inTensorIndices[0] && (int)i != outTensorIndices[0]) {
+      scratch_floats += sw->row_floats[i];
+    }
+  }
+
+  const size_t block_floats = (size_t)units * sw->slice_size;
+  sw->weights = (float *)ei_malloc(block_floats * slices * sizeof(float));
+  sw->pending = (float *)ei_calloc((size_t)units * slices, sizeof(float));
+  sw->last_slice = (float *)ei_malloc(sw->slice_size * sizeof(float));
+  sw->activations = (float *)ei_malloc(scratch_floats * sizeof(float));
+  if (!sw->weights || !sw->pending || !sw->last_slice || !sw->activations) {
+    ei_printf("ERR: failed to allocate sliding window buffers\n");
+    trained_model_sliding_free(sw);
+    return kTfLiteError;
+  }
+
+  // Split the first layer's weights by slice position: block p holds the
+  // columns that multiply the slice in position p of the window, transposed
+  // for float_simd::MultiplyAccumulate()
+  const float *weights = (const float *)tensorData[first.inputs->data[1]].data;
+  for (int p = 0; p < slices; ++p) {
+    for (int d = 0; d < sw->slice_size; ++d) {
+      for (int o = 0; o < units; ++o) {
+        sw->weights[p * block_floats + (size_t)d * units + o] =
+            weights[(size_t)o * depth + (size_t)p * sw->slice_size + d];
       }
-      ei_printf("\n");
     }
-    ei_printf("\n");
-#endif // EI_CLASSIFIER_PRINT_STATE
+  }
 
-    if (status != kTfLiteOk) {
-      return status;
+  float *next = sw->activations;
+  for (size_t i = 0; i < TRAINED_MODEL_TENSOR_COUNT; ++i) {
+    if ((int)i == inTensorIndices[0] || (int)i == outTensorIndices[0]) {
+      sw->data[i] = nullptr;
+    }
+    else if (tensorData[i].allocation_type == kTfLiteArenaRw) {
+      sw->data[i] = next;
+      next += sw->row_floats[i];
+    }
+    else {
+      sw->data[i] = (float *)tensorData[i].data;
     }
   }
+
+  sw->advanced = true;
   return kTfLiteOk;
 }
 
-TfLiteStatus trained_model_reset( void (*free_fnc)(void* ptr) ) {
+TfLiteStatus trained_model_sliding_fold_input(trained_model_sliding_t *sw, const float *scale,
+                                              const float *offset, int channels) {
+  if (channels < 1 || sw->slice_size % channels != 0) {
+    ei_printf("ERR: slices of %d inputs aren't whole readings of %d channels\n", sw->slice_size, channels);
+    return kTfLiteError;
+  }
+  if (!sw->offsets) {
+    sw->offsets = (float *)ei_calloc((size_t)sw->units * sw->slices, sizeof(float));
+    if (!sw->offsets) {
+      ei_printf("ERR: failed to allocate sliding window buffers\n");
+      return kTfLiteError;
+    }
+  }
+
+  // w * (x * scale + offset) = (w * scale) * x + w * offset: the weights are
+  // scaled, and each position's share of the offsets goes into the window
+  // along with the slice (not into the bias, so that missing slices still
+  // count as zeros)
+  const int units = sw->units;
+  const size_t block_floats = (size_t)units * sw->slice_size;
+  for (int p = 0; p < sw->slices; ++p) {
+    float *weights = &sw->weights[p * block_floats];
+    float *offsets = &sw->offsets[p * units];
+    for (int d = 0; d < sw->slice_size; ++d) {
+      const int c = d % channels;
+      for (int o = 0; o < units; ++o) {
+        offsets[o] += weights[(size_t)d * units + o] * offset[c];
+        weights[(size_t)d * units + o] *= scale[c];
+      }
+    }
+  }
+  return kTfLiteOk;
+}
+
+void trained_model_sliding_advance(trained_model_sliding_t *sw) {
+  if (sw->advanced) {
+    return;
+  }
+  sw->advanced = true;
+  EI_PROFILER_SCOPE("sliding advance");
+
+  // The slice is in position p of the window that ends slices - 1 - p
+  // slices after the one it ended (slot done)
+  const int slices = sw->slices;
+  const int units = sw->units;
+  const size_t block_floats = (size_t)units * sw->slice_size;
+  const int done = (sw->next + slices - 1) % slices;
+  for (int p = 0; p < slices - 1; ++p) {
+    float *sums = &sw->pending[((done + slices - 1 - p) % slices) * units];
+    float_simd::MultiplyAccumulate(sw->last_slice, sw->slice_size, &sw->weights[p * block_floats],
+                                   units, sums);
+    if (sw->offsets) {
+      for (int o = 0; o < units; ++o) {
+        sums[o] += sw->offsets[p * units + o];
+      }
+    }
+  }
+}
+
+TfLiteStatus trained_model_sliding_push(trained_model_sliding_t *sw, const float *slice, float *output) {
+  EI_PROFILER_SCOPE("sliding push");
+  const NodeInfo_t &first = nodeData[0];
+  const int units = sw->units;
+
+  // The previous slice still has to go into the windows after this one
+  trained_model_sliding_advance(sw);
+
+  // The new slice's share of the first node
+  EiProfilerScope first_span(nodeNames[0]);
+
+  // Finish the window with the new slice's share, then the bias and the
+  // activation of the first layer
+  float act_min, act_max;
+  const TfLiteFullyConnectedParams *params = (const TfLiteFullyConnectedParams *)first.builtin_data;
+  if (ActivationRange(params->activation, &act_min, &act_max) != kTfLiteOk) {
+    return kTfLiteError;
+  }
+  const size_t block_floats = (size_t)units * sw->slice_size;
+  float *sums = &sw->pending[sw->next * units];
+  float_simd::MultiplyAccumulate(slice, sw->slice_size, &sw->weights[(sw->slices - 1) * block_floats],
+                                 units, sums);
+  const float *offsets = sw->offsets ? &sw->offsets[(sw->slices - 1) * units] : nullptr;
+
+  const float *bias = (first.inputs->size > 2 && first.inputs->data[2] >= 0) ?
+                      sw->data[first.inputs->data[2]] : nullptr;
+  float *layer_out = sw->data[first.outputs->data[0]];
+  for (int o = 0; o < units; ++o) {
+    float value = sums[o] + (offsets ? offsets[o] : 0.0f) + (bias ? bias[o] : 0.0f);
+    layer_out[o] = std::min(std::max(value, act_min), act_max);
+    sums[o] = 0.0f;
+  }
+
+  memcpy(sw->last_slice, slice, sw->slice_size * sizeof(float));
+  sw->advanced = false;
+  sw->next = (sw->next + 1) % sw->slices;
+  first_span.end();
+
+  sw->data[outTensorIndices[0]] = output;
+  TfLiteStatus status = RunNodes(sw->data, sw->row_floats, 1, 1);
+  sw->data[outTensorIndices[0]] = nullptr;
+  return status;
+}
+
+void trained_model_sliding_free(trained_model_sliding_t *sw) {
+  ei_free(sw->weights);
+  ei_free(sw->offsets);
+  ei_free(sw->pending);
+  ei_free(sw->last_slice);
+  ei_free(sw->activations);
+  memset(sw, 0, sizeof(*sw));
+}
+
+TfLiteStatus trained_model_init( void*(*alloc_fnc)(size_t,size_t) ) {
 #ifdef EI_CLASSIFIER_ALLOCATION_HEAP
-  free_fnc(tensor_arena);
+  tensor_arena = (uint8_t*) alloc_fnc(16, kTensorArenaSize);
+  if (!tensor_arena) {
+    ei_printf("ERR: failed to allocate tensor arena\n");
+    return kTfLiteError;
+  }
 #endif
+  TfLiteStatus status = trained_model_ctx_init(&default_ctx, tensor_arena, kTensorArenaSize);
+  default_ctx_ready = (status == kTfLiteOk);
+  return status;
+}
 
-  // scratch buffers are allocated within the arena, so just reset the counter so memory can be reused
-  scratch_buffers_ix = 0;
+TfLiteStatus trained_model_init_once( void*(*alloc_fnc)(size_t,size_t) ) {
+  if (default_ctx_ready) {
+    return kTfLiteOk;
+  }
+  return trained_model_init(alloc_fnc);
+}
 
-  // overflow buffers are on the heap, so free them first
-  for (size_t ix = 0; ix < overflow_buffers_ix; ix++) {
-    ei_free(overflow_buffers[ix]);
+TfLiteTensor* trained_model_input(int index) {
+  return trained_model_ctx_input(&default_ctx, index);
+}
+
+TfLiteTensor* trained_model_output(int index) {
+  return trained_model_ctx_output(&default_ctx, index);
+}
+
+TfLiteStatus trained_model_set_input_data(int index, void *data) {
+  return trained_model_ctx_set_input_data(&default_ctx, index, data);
+}
+
+TfLiteStatus trained_model_invoke() {
+  return trained_model_ctx_invoke(&default_ctx);
+}
+
+TfLiteStatus trained_model_reset( void (*free_fnc)(void* ptr) ) {
+  default_ctx_ready = false;
+#ifdef EI_CLASSIFIER_ALLOCATION_HEAP
+  if (tensor_arena) {
+    free_fnc(tensor_arena);
+    tensor_arena = NULL;
   }
-  overflow_buffers_ix = 0;
-  return kTfLiteOk;
+#endif
+  return trained_model_ctx_reset(&default_ctx);
 }
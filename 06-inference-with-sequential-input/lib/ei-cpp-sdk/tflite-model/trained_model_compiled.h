@@ -25,12 +25,136 @@
 
 #include "edge-impulse-sdk/tensorflow/lite/c/common.h"
 
+#ifndef EI_MAX_SCRATCH_BUFFER_COUNT
+#define EI_MAX_SCRATCH_BUFFER_COUNT 4
+#endif // EI_MAX_SCRATCH_BUFFER_COUNT
+
+#ifndef EI_MAX_OVERFLOW_BUFFER_COUNT
+#define EI_MAX_OVERFLOW_BUFFER_COUNT 10
+#endif // EI_MAX_OVERFLOW_BUFFER_COUNT
+
+// Size of the model, and the smallest arena a context can run in (bytes)
+#define TRAINED_MODEL_TENSOR_COUNT 11
+#define TRAINED_MODEL_NODE_COUNT 4
+#define TRAINED_MODEL_ARENA_SIZE 4112
+
+// Rows run through the model together by trained_model_invoke_batch()
+#ifndef TRAINED_MODEL_BATCH_TILE
+#define TRAINED_MODEL_BATCH_TILE 32
+#endif // TRAINED_MODEL_BATCH_TILE
+
+// Everything one running copy of the model needs. The weights are shared
+// (read-only) by every context, so any number of contexts can be invoked at
+// the same time from different threads, each with its own arena.
+typedef struct {
+  TfLiteContext ctx;
+  TfLiteTensor tensors[TRAINED_MODEL_TENSOR_COUNT];
+  TfLiteEvalTensor eval_tensors[TRAINED_MODEL_TENSOR_COUNT];
+  TfLiteNode nodes[TRAINED_MODEL_NODE_COUNT];
+  uint8_t *arena;
+  uint8_t *tensor_boundary;
+  uint8_t *current_location;
+  void *scratch_buffers[EI_MAX_SCRATCH_BUFFER_COUNT];
+  size_t scratch_buffers_ix;
+  void *overflow_buffers[EI_MAX_OVERFLOW_BUFFER_COUNT];
+  size_t overflow_buffers_ix;
+} trained_model_ctx_t;
+
+// Sets up a context in a caller-owned arena (at least TRAINED_MODEL_ARENA_SIZE
+// bytes, 16-byte aligned) with init and prepare steps.
+TfLiteStatus trained_model_ctx_init(trained_model_ctx_t *mctx, uint8_t *arena, size_t arena_size);
+// Returns the context's input or output tensor with the given index.
+TfLiteTensor *trained_model_ctx_input(trained_model_ctx_t *mctx, int index);
+TfLiteTensor *trained_model_ctx_output(trained_model_ctx_t *mctx, int index);
+// Points the context's input tensor with the given index at data (at least
+// the tensor's size), so that the next invoke reads it from there instead of
+// from the arena, or back at the arena if data is null. Lasts until the
+// context is set up again.
+TfLiteStatus trained_model_ctx_set_input_data(trained_model_ctx_t *mctx, int index, void *data);
+// Runs inference in the context.
+TfLiteStatus trained_model_ctx_invoke(trained_model_ctx_t *mctx);
+// Frees memory the context allocated outside its arena (the arena stays with
+// the caller).
+TfLiteStatus trained_model_ctx_reset(trained_model_ctx_t *mctx);
+
+// Runs inference on batch_size inputs at once without a context. input holds
+// one row per input (rows of trained_model_ctx_input()'s size) and output gets
+// one row per input. Each layer runs as a matrix-matrix product over tiles of
+// TRAINED_MODEL_BATCH_TILE rows, so the weights are read once per tile rather
+// than once per input; the results are the same as invoking each input alone.
+// Safe to call from any number of threads at the same time.
+TfLiteStatus trained_model_invoke_batch(const float *input, float *output, size_t batch_size);
+
+// Runs the model over a window that slides by one slice at a time: the model
+// input is split into `slices` equal slices, oldest first, and every push
+// gives the output for the window that ends with the new slice (the window
+// starts out as zeros).
+//
+// The first layer is split by slice position, and every slice's share of
+// each window it will be part of is kept in a running sum, so a slice's
+// inputs are multiplied by each weight once. That's the same work per slice
+// as invoking the whole window, but only 1/slices of the first layer (plus
+// the layers after it) stands between a new slice and its output: the rest
+// (the new slice's share of later windows) is done by
+// trained_model_sliding_advance(), which can run while waiting for the next
+// slice. The results match invoking each window up to rounding (the sums are
+// added up in a different order).
+typedef struct {
+  int slices;                                     // Slices per window
+  int slice_size;                                 // Inputs per slice
+  int units;                                      // Outputs of the first layer
+  int next;                                       // Slot of the window the next slice ends
+  bool advanced;                                  // Last slice is in the later windows
+  float *weights;                                 // First layer, [slices][slice_size][units]
+  float *offsets;                                 // Folded input offsets, [slices][units] (or null)
+  float *pending;                                 // First layer sums of the windows, [slices][units]
+  float *last_slice;                              // Copy of the last slice pushed
+  float *activations;                             // The other layers' activations
+  float *data[TRAINED_MODEL_TENSOR_COUNT];        // Where each tensor lives
+  size_t row_floats[TRAINED_MODEL_TENSOR_COUNT];  // Size of each tensor
+} trained_model_sliding_t;
+
+// Sets up a sliding window of `slices` slices. Fails if the model doesn't
+// start with a fully connected layer or its input can't be split evenly.
+TfLiteStatus trained_model_sliding_init(trained_model_sliding_t *sw, int slices);
+// Folds a per-channel affine transform of the inputs into the first layer,
+// so that slices can be pushed in the units the transform starts from: the
+// model then sees x * scale[c] + offset[c] for input x of channel c (inputs
+// are interleaved, channel = index % channels). The window still starts out
+// as zeros in the model's units. Call before the first push. Fails if the
+// slices aren't whole readings.
+TfLiteStatus trained_model_sliding_fold_input(trained_model_sliding_t *sw, const float *scale,
+                                              const float *offset, int channels);
+// Adds a slice of trained_model_sliding_t::slice_size inputs and writes the
+// output of the window that ends with it.
+TfLiteStatus trained_model_sliding_push(trained_model_sliding_t *sw, const float *slice, float *output);
+// Adds the last slice to the later windows, if it isn't already in them
+// (trained_model_sliding_push() does it first otherwise).
+void trained_model_sliding_advance(trained_model_sliding_t *sw);
+// Frees the sliding window's buffers.
+void trained_model_sliding_free(trained_model_sliding_t *sw);
+
+// The functions below use a default context and arena, one per thread on
+// platforms with thread-local storage, also when the arena is statically
+// allocated (EI_CLASSIFIER_ALLOCATION_STATIC): each thread then has its own
+// static arena. Otherwise, and with an arena in a named section
+// (EI_CLASSIFIER_ALLOCATION_STATIC_HIMAX*), there is one of each per process
+// and only one thread at a time may use them; give each thread its own
+// context with trained_model_ctx_init() instead.
+
 // Sets up the model with init and prepare steps.
 TfLiteStatus trained_model_init( void*(*alloc_fnc)(size_t,size_t) );
+// Sets up the model like trained_model_init(), unless it's already set up
+// and hasn't been reset since: the prepared graph and the arena are kept
+// for the next inference.
+TfLiteStatus trained_model_init_once( void*(*alloc_fnc)(size_t,size_t) );
 // Returns the input tensor with the given index.
 TfLiteTensor *trained_model_input(int index);
 // Returns the output tensor with the given index.
 TfLiteTensor *trained_model_output(int index);
+// Points the input tensor with the given index at data (or back at the arena
+// if data is null) until the next init.
+TfLiteStatus trained_model_set_input_data(int index, void *data);
 // Runs inference for the model.
 TfLiteStatus trained_model_invoke();
 //Frees memory allocated
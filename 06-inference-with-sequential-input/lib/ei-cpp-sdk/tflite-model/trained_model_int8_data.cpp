@@ -0,0 +1,2477 @@
+/* Generated by tools/quantize_model.cpp from the float model in
+ * trained_model_compiled.cpp, calibrated on 55 windows from 10
+ * recording(s). Do not edit: regenerate with make quantize.
+ *
+ * License: Apache-2.0
+ */
+
+#include "tflite-model/trained_model_int8.h"
+
+#if defined __GNUC__
+#define ALIGN(X) __attribute__((aligned(X)))
+#elif defined _MSC_VER
+#define ALIGN(X) __declspec(align(X))
+#elif defined __TASKING__
+#define ALIGN(X) __align(X)
+#endif
+
+namespace {
+
+const ALIGN(16) int8_t layer0_weights[72000] = {
+  -30, -77, -65, -47, 80, 32, -30, -78, -16, -37, 55, -12, -24, -80, -1, -18, 9, 16, -1, -28, 28, -22, 24, 24, 0, -64, 9, -16, 12, 34, 22, -17,
+  48, -17, 6, 23, 1, -42, 31, -7, 7, -12, -41, -54, 28, 0, 31, -6, -38, -36, -10, 2, 23, 15, -4, -3, 16, 17, 46, 28, -2, 11, 10, -9,
+  26, 19, 15, -30, -24, 14, -6, -16, 22, -44, 8, -57, 2, 11, 42, -29, 16, -15, 19, 13, 33, 24, -46, -60, 26, 45, 4, -23, -48, -97, 6, -3,
+  9, -10, 10, -55, 8, 31, -2, 0, -17, -37, 13, 16, -13, 3, -9, -9, -7, -5, 1, 4, 0, -25, 31, 15, 35, -37, -7, -2, 56, 53, -4, 32,
+  -1, 41, 54, 26, 2, -25, -5, 57, 34, -7, 47, 26, 33, 60, 31, 1, 30, 46, 6, 42, 60, 38, -16, 25, 48, 30, 6, 51, -7, -17, -18, 8,
+  10, 10, 7, 33, -22, 9, 47, 25, -25, 29, -15, 21, 18, 11, -14, 39, 34, 10, -6, 31, -18, 18, -36, 35, -26, -1, -32, -34, 26, -8, -24, 6,
+  -15, -20, 33, 0, -37, 37, -42, -36, -1, 16, 23, 30, -12, -4, 3, 22, 0, -2, -59, 14, -5, 51, 28, 39, -59, -36, -15, 15, -16, 20, -4, -42,
+  16, 27, 39, -2, -76, -37, 14, 40, 27, 29, -54, -26, -25, -4, 48, 10, -1, -5, -35, 41, 17, 30, -41, -6, 15, -8, 13, 61, -33, -13, -2, 1,
+  6, 16, -35, -23, -16, 23, -11, 19, -10, 9, -47, -8, -8, 26, -58, 12, -57, 1, -51, 23, -28, 18, -50, 27, -18, 17, -19, -27, -33, 19, -42, 13,
+  4, -50, 1, 37, -27, 50, -21, -1, 1, 21, 15, 18, -15, -28, -14, 69, 22, -3, -52, 3, -85, 40, 7, 36, -2, -1, -15, 24, 19, 28, -13, -36,
+  -72, -21, -32, -18, -9, 6, -8, -22, 3, 18, 3, -22, 11, 18, 3, 61, -31, -11, -26, 76, 8, 16, -60, -2, -19, 65, 16, 35, -26, 52, 0, 15,
+  9, 1, -46, 3, -37, 36, -19, 25, -45, -10, -30, 42, 11, -41, -38, 7, 6, 11, -5, 36, -12, 9, 36, -36, -38, -20, -10, -22, -4, -25, -19, 26,
+  -14, 49, 18, -21, 27, -20, -43, -7, -15, -45, -23, -15, -7, -12, -8, -80, 4, 32, -19, 56, -44, -64, 42, 14, -8, 4, -51, -65, 20, -17, -2, -11,
+  -40, 2, 19, -21, -11, 40, -1, 12, -16, -10, -23, 12, 4, 16, -62, -13, -40, 23, 20, -11, -16, 7, -1, 40, 24, -9, -14, 5, -16, 18, -26, -44,
+  -35, -23, -28, 40, 13, -23, -64, 19, -30, 8, 29, 30, -36, -20, -1, 41, 24, -16, -20, 13, -42, 2, 6, -8, -25, -16, -44, 38, 24, -14, -36, -39,
+  -25, 13, 11, 7, -26, -12, -39, -21, -16, -27, -45, -26, -15, -35, 40, 32, -65, -20, -34, 18, 35, -10, -11, -31, 13, 20, 48, -45, -67, -21, 23, 13,
+  22, -34, -59, -37, -37, -14, -3, 22, -37, 16, -7, 3, -29, -12, -20, 6, -27, 7, -16, -6, -12, 12, -28, -7, -28, -8, -27, -14, -51, -29, -19, 18,
+  -61, -28, 11, -14, 33, -17, -88, 0, -35, 29, -19, -45, -71, -1, 1, -4, -25, 0, -61, -23, 8, 9, -2, -54, -34, -29, -5, -31, 5, -37, -36, 27,
+  -34, 20, 43, -64, -30, 22, 0, -4, 47, -31, -37, -16, -2, 21, -1, -37, 31, -37, -20, -21, 28, -23, -33, -12, -47, 14, -5, -75, -11, -47, -43, 23,
+  36, -86, -46, -71, -18, -24, 15, -61, -17, -21, 21, 21, 24, -53, -45, -46, 10, -48, 67, -22, -32, -51, 47, -68, 23, -40, -35, -18, 33, -4, 9, -7,
+  -34, -48, 39, -35, 2, -54, -26, -1, 16, -25, 21, -47, 12, -4, 63, -41, 12, -18, 10, -16, 7, -56, -5, 25, -30, -73, 15, -50, 53, 30, -92, -46,
+  -11, -37, 0, 17, -38, -24, 1, -36, 8, -41, -21, -19, -36, -31, 51, -5, -60, 15, 1, -43, 4, -42, -32, 2, 12, -20, -32, -1, -11, -8, -23, -38,
+  39, -15, -23, 21, -23, -8, 26, 5, 13, 12, -81, -12, -17, -26, -35, 20, 66, -25, -89, 8, 50, -9, 84, -58, -19, -39, 23, -15, 49, -30, 4, -19,
+  -28, -28, 77, -33, -22, -5, -1, 23, 41, 6, 21, 53, -21, -11, -10, -26, 38, 13, -24, 9, 3, -63, 34, 62, -42, 12, 67, -27, 15, 7, -5, -1,
+  87, -18, 10, 38, 3, -4, 21, -23, 37, 5, -31, -3, 37, 6, -12, 8, -27, -28, -10, -18, -1, 3, -11, 15, 25, 16, 49, 36, -23, -10, 34, 3,
+  34, -18, -47, 24, 17, 14, 40, 5, -36, 37, 14, 6, -10, 2, 29, 32, 15, -29, -26, -23, 2, -8, -54, 24, -15, -17, -20, -14, -23, -18, -2, -68,
+  3, 2, -22, 33, 15, -45, 20, -15, -28, 50, 39, -76, 24, 30, -16, 14, -4, -49, 20, 11, -48, 8, 21, -16, -23, -1, -56, 11, 8, -28, -24, -13,
+  -47, -32, 6, 40, -24, 15, -2, 1, -4, 26, -17, -14, -27, 19, -48, 42, 16, -3, -83, -4, -43, 82, 29, -5, -84, 34, -94, 71, -15, 7, -127, 34,
+  -32, 93, -33, 1, 43, 10, -63, -93, -52, -1, 40, -5, -89, -89, -45, -35, 9, -27, -89, -17, -42, 14, -6, -39, -18, -52, -57, -71, 31, -23, -68, -35,
+  -33, -72, 39, 20, -15, -48, -39, -2, -11, 17, -51, -39, -71, -40, 51, 32, -26, 6, -89, 12, 1, -37, 5, 26, -79, -12, 54, -6, -14, -4, -62, -18,
+  34, -22, -22, -22, -78, 13, 14, 12, -24, 41, -25, 7, 14, 33, -16, 42, -34, 8, 6, 2, 44, -18, -39, -45, -52, 40, 56, 36, 29, -72, 8, -41,
+  35, 67, -9, -71, -48, -9, 9, 21, -4, 12, -13, -19, 40, 13, 16, 7, -53, -10, 47, -22, -8, -40, -13, 26, -51, 44, -10, -22, -33, -28, 39, 14,
+  -23, 36, 4, 12, 59, -21, 3, -49, 0, 20, 11, 45, -64, -47, -7, -6, -12, 44, -53, -15, -34, -13, 20, 12, -55, -84, -20, -58, 22, 36, -30, -6,
+  -51, -57, 50, 3, -58, -20, 4, -11, 30, 2, -91, 9, -30, -25, 12, 0, 3, 19, 27, 25, 0, 1, 32, -27, -112, -50, 13, -64, -30, -42, -114, -35,
+  -50, 5, 35, -45, -106, -70, -26, 39, -47, -5, -110, -86, 3, 1, -37, -47, -71, -24, -4, 9, -33, -29, -88, -45, -25, -23, -40, -74, -66, -89, 34, -21,
+  -18, -21, -5, -64, -7, -25, 24, -70, -33, -56, -3, 69, 9, -73, -41, -72, -15, 66, 96, -27, -34, -68, -55, 13, 96, -44, -38, -55, -41, 77, 71, -32,
+  -43, -86, -19, 29, 48, -64, -30, -6, 26, 57, 7, -17, 35, -13, 12, 61, 9, -94, -40, -22, -24, 19, 18, -41, -56, -9, 35, 63, -1, -36, 19, -19,
+  70, 70, -13, -53, 16, -34, 78, 67, 13, -30, -17, -17, 66, 28, 35, 26, -20, -81, 32, 48, -1, -9, -6, -14, 2, 8, 22, 6, 40, 8, -33, -37,
+  46, -5, -20, -78, -17, 40, 52, -29, 64, -18, 45, 20, -42, 16, 1, -3, 7, 37, -37, 13, 9, 30, -19, 26, -14, 14, 57, 8, -29, 35, -43, 26,
+  -8, -50, -46, 58, -43, -38, 62, -53, 9, 20, 23, 42, -10, -26, -3, 48, 20, 25, 49, 9, -42, 43, 27, 2, 30, 38, -36, 52, 44, -7, -3, 12,
+  -65, 20, -52, 56, 10, 13, -21, 75, -35, 17, 38, 9, 7, 62, -46, 14, 74, 6, -58, 104, -33, -20, 118, 27, -56, 66, 0, 30, 68, -13, -59, 88,
+  -10, 52, 73, 29, -19, -14, 14, 50, 67, -20, -6, -4, -21, -16, 58, -15, -36, -13, -10, -12, 29, -27, -23, -12, 18, 38, 87, 6, -2, -47, 4, 4,
+  36, -6, 61, -40, -63, 58, 38, -6, -41, 38, 34, 15, 20, 7, -17, -44, 20, 9, -7, -11, -3, -58, 7, -32, 28, 53, -39, 42, 43, -14, 30, -25,
+  -52, 40, -26, -67, -3, -69, -12, 42, -7, -24, 52, -46, -63, 107, -33, 0, 38, 14, -36, 76, 12, 6, 21, 22, -34, 125, -48, 11, -35, 11, -50, 71,
+  -55, 33, 30, 13, -21, 101, -34, 40, 6, -10, -1, -11, 4, 19, 17, 15, 26, -15, -77, -7, -8, 15, 35, 38, -61, 11, -18, 29, -8, -20, -66, 2,
+  -19, 71, 8, -27, -35, -3, 28, 99, -7, 39, -51, 43, 19, 22, -49, 66, -72, 1, 42, -30, -48, 30, -43, -15, 16, 50, 38, -36, -91, -20, 18, 55,
+  61, -66, -126, -43, -9, 15, -11, -19, -127, -65, -48, 89, 53, 8, -63, -49, -53, 61, 43, -18, -101, -80, -74, 39, 25, -55, -113, -36, -69, 41, -32, -48,
+  -79, -39, -31, 84, 10, 0, -31, -34, 1, 14, -26, -46, 8, 6, -21, 57, 18, -3, 14, -68, -46, 34, 5, -47, -48, -52, -72, 35, -59, -33, -16, -25,
+  9, 24, 17, -19, -23, -77, -56, 8, 46, -13, -55, -37, -34, -18, -35, -34, -48, -53, -28, 1, -24, -15, -52, -20, -3, 15, 14, 28, 34, 12, -4, 29,
+  10, -67, 31, 42, -42, 54, 35, 1, 42, 6, -18, 12, -1, -13, -2, 22, -31, 71, -25, -38, 12, 15, 2, 26, 21, 3, -7, -23, -20, -9, -13, 59,
+  15, -22, -21, -28, 37, -20, -43, -32, -3, -16, 89, 66, -25, 32, -18, -20, 85, 60, 21, -34, -10, -23, 68, -10, -25, -31, -18, 45, 15, -11, -17, -55,
+  -28, -23, -1, 19, 50, -47, -43, -53, 42, 48, 7, -33, -1, 7, 18, 40, 25, -19, -15, -3, -13, 57, 14, 30, -42, -13, 2, -14, 49, 5, -3, 1,
+  49, 67, 26, -79, -75, -5, 86, 37, 7, -46, 7, 12, 29, 67, 12, -16, 5, -52, 58, 37, 64, -35, -30, 27, -20, -26, -3, 13, 17, 31, -27, -57,
+  52, -19, 13, -3, -52, 27, 19, -31, 11, 2, 12, 12, -29, -40, -25, 36, 64, 5, -42, -1, 44, 51, 36, -28, -46, -47, 48, 0, -21, -29, 46, -89,
+  -16, -53, 26, -20, 84, -70, 12, -5, 11, -29, 26, -28, 22, -19, 18, -16, 23, -23, 0, 13, 42, 18, 58, -40, 31, -13, 32, 38, 69, -3, -14, 19,
+  23, 22, 58, 21, -4, 22, -44, -22, 93, 25, 36, 9, 1, -63, 65, 24, -10, -23, -1, -40, 16, 53, 47, -25, -13, -81, 36, -10, 46, 45, -3, -1,
+  51, 58, 60, -26, 1, -4, 113, 43, 15, 0, -7, 2, -84, 68, 1, 9, -21, 27, 10, 21, 70, 32, 45, 10, 8, 35, 18, -17, 27, 13, -29, -70,
+  71, -73, 26, -45, 9, -2, 73, -78, -42, -56, -12, -20, 52, -62, -46, -31, -7, 25, 13, 18, -43, -37, -77, 48, 15, -15, 47, -19, -26, 29, 25, -2,
+  21, -42, -29, 6, 18, -3, 43, -71, 21, -4, 6, -28, -22, 16, 4, -37, 26, 25, 31, -39, 6, 7, 41, -43, -47, -46, 50, -17, -5, -34, -11, -97,
+  24, 63, 32, -48, -11, -81, 73, 10, 50, 39, 15, -36, 69, 18, 10, 7, -13, -5, 31, 21, 21, -36, 13, 10, 42, 32, -25, 11, -16, -7, -9, 67,
+  1, -31, -31, 13, 4, 76, -19, 56, -36, 25, -10, 44, 0, 49, 32, 1, 31, 25, 18, 5, -29, -11, 35, 23, -50, 51, 41, -17, 69, 37, -41, 78,
+  -10, 35, 55, 79, -76, -13, 63, 74, -6, 90, -53, 5, -17, 44, 56, 127, -55, 25, -21, -19, 45, 103, -109, 82, 57, -36, 51, 113, 12, -70, 12, -23,
+  12, 58, 56, -27, 71, 18, 13, 52, 15, -47, 41, -37, -7, 71, -47, -35, -9, -16, 29, 57, 21, -6, 48, -8, 49, 90, 25, -19, -14, -28, 9, 65,
+  -42, 14, 12, 6, -9, 39, -1, 2, -25, -3, 45, 79, -15, -38, 29, -25, 52, 64, -40, -24, 15, -13, 3, 122, 34, -15, -35, -27, 71, 104, -38, 59,
+  21, 22, -25, 78, 14, 1, -4, -18, 7, 100, 44, 38, 16, -48, -9, 61, -1, -26, 42, -28, -25, 94, -21, -21, -12, -1, 0, 86, 18, 33, -16, 62,
+  3, 27, 5, -32, -17, 22, 33, 64, 7, 40, 60, -15, 49, 67, -31, -26, -48, -60, 60, 48, 59, -17, -46, -29, -7, 17, 50, -14, -10, -3, 45, 72,
+  51, 37, 19, 40, 3, 26, 9, 35, -11, 21, 51, 72, -24, 39, -27, 38, -35, 26, -32, 21, 26, -25, -26, 50, -10, 61, -6, 48, 35, 108, -13, 34,
+  -12, 69, 19, 61, -70, 13, -18, 17, 51, 34, -114, 36, -11, 25, -1, 75, -71, 29, -6, 47, -4, 17, -35, -36, -7, -26, 50, 28, -31, -15, -21, -15,
+  5, 75, -7, -44, -42, 6, 31, 43, -92, -22, -25, 4, 26, 43, -56, -48, 38, 51, 11, 65, -27, 4, -16, 80, 28, 91, -40, 92, -32, -1, 26, 66,
+  -6, 43, 24, -9, 29, 22, 23, -7, -4, 53, 1, 64, -7, -8, 15, -12, 34, 70, -55, 35, -61, 60, -5, 36, -38, 71, -9, 43, 11, -6, -14, 12,
+  40, 47, 1, 71, -21, 13, 30, -1, 24, 24, -43, -42, 41, 10, -12, -5, 2, -75, 1, 11, -35, -4, 5, -40, -37, -20, 3, 28, -67, -68, 39, -13,
+  50, 36, -54, -10, 11, -42, -21, 54, -87, 15, 15, 6, 38, 40, -38, -24, -38, 2, -59, 5, 5, -19, -19, 20, -34, 39, 37, -8, 2, -22, -36, 21,
+  25, 72, 22, -61, -47, 44, 58, 19, -23, -43, -40, 28, -20, 75, -30, 38, 28, 37, -10, 13, -2, 23, -44, -25, 35, -28, -38, 63, -37, 51, -27, 39,
+  -55, -16, -25, 39, 32, 5, -2, -23, -31, 20, -5, 34, 19, -15, -29, -5, -22, 50, -27, 56, -59, -38, -8, 15, -6, -1, -20, -5, -24, -44, -16, -9,
+  -39, -36, 12, -47, 33, 28, -71, 0, -16, 25, 54, 26, 12, 1, 53, 31, -2, 63, -27, 3, 55, -33, 43, 79, 43, -6, 36, 7, 51, 27, -22, 36,
+  -20, 32, 19, 73, 1, 41, 14, 1, 34, 12, 4, 23, -9, -3, -13, 17, -61, 23, 8, 43, -73, 2, -53, 30, -72, -8, 20, 2, -54, -24, 10, -15,
+  -4, 46, -87, -58, -3, -79, 71, -47, -22, 19, -38, 8, 4, -73, -22, -21, -57, 21, 12, -38, -43, -5, 14, 50, 54, -20, -12, -32, -26, -45, -20, 48,
+  -40, -63, 14, -26, 18, 11, -13, -3, -17, 17, -62, -17, -72, 18, 12, -18, 10, 16, -45, -2, -16, 18, -24, 23, -109, 12, 11, 10, -19, 32, -58, -45,
+  18, 18, 64, 13, -101, 4, -22, 9, -15, -16, -86, -69, -53, -13, 6, -33, -3, -70, -102, 26, 48, 21, -34, -32, 37, -32, -49, 55, -7, -36, 82, -15,
+  6, -8, 20, -67, 41, 36, -4, -13, -14, 12, 49, -25, -13, 19, 1, -10, -21, -57, -20, -17, -34, -63, 14, -29, -48, 32, -50, -71, 10, -87, 29, -18,
+  -10, -32, -20, 0, -26, -65, -29, -30, 36, -12, -21, -24, 10, 3, -44, 2, -24, -10, -38, -10, 12, 11, -44, -17, -13, -3, -38, -27, 17, -21, 34, -54,
+  30, 18, -34, -34, 18, 1, -33, -38, 36, 2, -33, -13, -33, -14, 29, 13, 15, -69, -31, -53, 22, 1, 32, -39, -6, -41, 11, 31, -12, -14, -17, -26,
+  -25, 32, -39, -13, -17, -55, -36, -13, -19, -74, 29, -25, -13, -36, -112, -77, -10, 12, 17, -20, -79, 5, 26, 13, -56, 1, -91, -73, 4, -44, 5, 14,
+  -59, -69, 11, 12, -11, -50, -60, -81, -5, -15, -27, -30, -30, -103, -24, 63, -43, 2, -39, -73, 17, -17, 9, 95, -56, -103, 5, 67, -39, 60, -82, -75,
+  -7, 30, -33, 58, -38, -118, -42, -3, 1, 78, -32, -122, -68, 14, 14, 34, -45, 9, -38, 22, 19, 36, -36, 12, -17, -9, 43, -9, -53, 1, -27, -20,
+  46, 33, 3, 19, -40, 7, 28, 33, -24, 15, -4, 5, -6, 53, 7, 13, -34, 27, 34, 22, -19, 27, 9, -33, 11, 46, -33, -7, -1, 11, 10, 20,
+  -16, 10, -38, -7, -7, 45, -17, 19, -28, 24, -9, 10, -1, 22, -30, -23, 11, 51, 1, 24, -25, 18, 27, 59, -2, -1, 8, 9, -8, 7, -28, -28,
+  8, 0, 45, 30, -24, -10, 12, -1, 17, 17, 9, -39, 40, 19, -3, 15, -7, -52, 17, 18, 4, -31, 1, -50, 41, -35, 27, -32, 44, -27, -16, -20,
+  7, -22, 51, -79, 0, 14, -12, 12, 26, -46, -21, -4, -56, 15, -6, -65, 7, -35, -3, -29, 33, -46, 15, 2, -19, -36, 15, -15, 8, -7, -34, -16,
+  -22, -18, 7, 24, -10, -15, -41, -20, -3, 13, -5, -36, -5, -6, 16, -19, 8, -12, -41, -1, 6, -31, -13, -40, -24, 17, 7, -40, -1, 17, -49, -28,
+  -45, 8, -66, 27, -34, 16, -31, 4, -56, 7, -31, 33, -59, 9, -31, 35, -31, 1, 1, 33, -64, 37, 18, 26, -18, -3, -8, 0, -19, 11, -29, -17,
+  -15, 32, -18, -35, -7, -4, -5, 12, -14, -29, -43, -24, -49, 21, 11, 15, -12, -61, -7, 21, -8, 18, -48, -44, -24, 16, -5, -36, -8, -53, -19, 48,
+  -8, -33, -59, -72, -46, 49, 3, 21, -1, -75, 5, 1, -1, 14, -1, -59, -28, -18, 27, 14, -27, -89, 2, -9, -5, -7, -34, -25, -2, 37, 16, 47,
+  5, -24, 33, 7, -16, 66, 25, -6, -22, -23, 39, 27, -13, -61, -37, 5, 58, 45, 25, -34, -25, 1, 47, 7, 1, -26, -26, -35, 58, 4, 6, -36,
+  -14, -27, 37, -13, 8, -37, -19, -18, -10, 5, 26, -11, -54, 41, 25, 6, -35, -23, -19, 43, -6, 4, 18, 13, -19, 13, 0, 2, -7, 9, 12, 9,
+  12, 60, 11, 16, -11, 23, 1, 47, -14, -2, -3, 15, 21, 48, -50, 22, 4, 1, -25, 24, -2, 26, -2, 15, -11, 30, -17, -11, -11, -9, 23, -20,
+  -24, -15, -24, 5, 10, -8, -6, -29, -31, 40, 54, 27, -15, -26, -35, 18, 2, -7, -10, -9, -12, 56, 48, 24, -22, 27, -17, 60, 50, -16, -36, -10,
+  -59, 49, 54, -20, 13, -31, -74, 39, -1, 27, -6, 2, -27, 10, 31, 41, -6, -9, -48, 37, 21, -7, -21, 20, -66, 20, -1, -4, -36, 22, -60, 17,
+  -15, 53, -10, 69, -1, 17, 30, 21, 14, 37, -48, -12, 47, -12, 9, 74, -58, -2, -13, 28, 1, 38, -27, -15, 36, 5, 12, 11, -41, -14, -12, 8,
+  -20, 2, -50, 3, -6, 17, -30, -12, -68, 14, 11, -11, -26, 19, -92, 4, 18, 4, -21, 24, -127, 20, -23, 42, 21, 51, -50, 0, -39, -7, 14, 58,
+  -47, -22, -16, 9, 1, 20, -50, -8, -54, -1, -17, 33, -60, -3, -46, -7, -7, 31, -75, 52, -39, 22, -28, 6, -71, 48, -36, 19, -38, -16, -85, 1,
+  -54, -6, -37, 22, -79, -13, -6, 24, 13, 42, -93, 6, -36, 17, -10, 51, -94, -3, -65, -35, -5, 13, -58, 0, -65, -8, 15, -13, -112, -5, -31, -24,
+  -23, -7, -67, -20, -18, -3, -41, -4, -49, -48, -50, 14, -3, -31, -33, -39, -48, -33, -33, 3, -29, -15, -29, 22, -4, 7, -34, -1, -46, -45, 26, -22,
+  -22, -68, -23, -23, 18, -20, -31, -35, -12, -47, 8, 18, -6, -39, 0, -46, 9, -30, -52, -49, -14, -70, -15, -13, -21, -14, -23, -45, -6, -34, -18, -34,
+  -12, -49, -24, -7, -49, -8, -49, -26, -15, 9, -46, -37, -4, -45, -9, 3, -57, 8, -10, -26, 25, 13, -12, 16, -49, -49, -2, 20, -48, -17, -20, -55,
+  2, -2, -13, 1, -8, -75, -15, -17, -33, 7, -21, -71, -35, -22, -39, -30, -46, -50, -33, 20, 9, -3, -5, -51, -23, 16, 8, -35, -21, -43, -34, 39,
+  -13, 23, -11, -24, -34, 8, -3, 15, -4, -42, -29, 9, -44, -26, 21, -14, -36, 30, -28, -2, -1, -40, -31, 13, -43, 25, -28, -79, 18, 35, 53, 37,
+  16, -49, 9, 3, 32, 9, -18, -31, 5, 13, 46, 39, -17, -69, 46, -5, 42, -10, -4, -33, 0, -20, -16, 18, 13, -42, 18, 8, -2, 34, 14, -12,
+  -6, -9, 15, 25, 20, -20, 36, 4, 18, 44, -19, -27, 2, 29, 9, -6, -15, -45, 20, 21, -15, 32, -31, 4, 8, 12, -23, 36, -15, -49, -4, -13,
+  9, 29, -34, -64, -8, -24, -6, 14, 7, -59, -40, 14, 25, -7, 19, -60, 7, 18, 14, -30, -10, -43, -5, 29, 18, -46, -5, -14, -16, 13, 30, -26,
+  17, -14, -37, -2, 21, -17, 6, -16, -7, 18, 20, -40, 20, -28, 17, 35, -16, -40, 57, 1, 6, 22, 11, -43, 22, -55, 29, -13, 6, -18, 41, 3,
+  -28, -11, -31, -31, 35, -20, -9, 12, 4, -20, 11, 5, 10, -22, -11, -41, 29, -8, -5, 16, -31, -19, 29, 4, 3, 16, -22, -31, 63, 19, 14, 18,
+  26, 18, 60, -7, 10, 31, 28, -4, 18, 39, 11, 21, 11, 7, 29, 35, -19, -19, 0, 11, 4, -13, -41, 39, -31, 46, 27, -53, -6, 14, 10, -41,
+  50, -28, -31, 30, -21, 10, -45, -3, -77, -3, -16, -48, -37, 4, -65, 34, -13, -29, -30, -27, -37, 16, -28, -61, 13, -60, -8, -20, -8, -49, -15, -22,
+  -36, -54, -53, -85, 32, -91, 1, -52, -59, -44, 34, -87, -19, -84, -39, -43, -21, -53, -16, -19, -51, -97, -53, -55, -60, 0, -10, -79, -14, -35, -34, -32,
+  -17, -2, -55, -27, 18, 9, -18, -2, 4, -4, 27, 23, 39, 3, 27, -63, -26, -56, -23, -79, -9, -36, -41, 35, 1, -84, 25, -31, 38, 13, -21, -98,
+  46, 0, -13, -30, 12, -107, -39, 3, 9, 20, -30, -70, -42, -47, 50, 14, -21, -84, 23, -13, 45, 38, -44, -40, -53, -3, 0, 12, 48, -29, -33, 42,
+  12, 0, 45, -43, -57, 14, 4, 33, 4, -63, 17, -48, -15, 10, 15, -106, -23, -6, -15, 21, 20, 2, -63, 12, 8, -7, 20, 23, -48, -30, 49, 30,
+  -15, 59, -5, -41, -47, 23, 87, -18, 61, 38, -1, 12, 59, -2, 61, 16, -28, 51, 29, 11, 46, -1, 8, 2, -3, 16, 58, 1, -19, 24, -28, -10,
+  30, 25, -1, 26, 23, -57, 44, 35, 15, 61, 13, -18, -23, 15, -57, 4, 66, -24, -5, -25, -23, 35, -5, 3, -17, -10, -27, 56, 43, -23, 6, -92,
+  -77, -1, 46, -64, 4, -40, 16, -9, 42, -32, -15, -67, 13, 25, -1, -64, 16, -34, 12, -43, -49, -56, 60, -16, -24, -62, -25, -10, 20, -54, -50, -63,
+  -12, 47, 46, -38, -30, 22, 16, 50, 67, -30, 14, 28, -10, 47, 68, -62, -2, 8, -22, 32, 6, -14, 13, 61, -8, 65, 31, -34, 46, 1, -31, 45,
+  37, -20, -15, 50, -31, 58, 50, -21, -24, -33, 22, 42, -29, -24, -39, -40, 36, 10, 20, -35, -6, -28, 31, 22, 7, -17, 17, -66, 21, 22, 12, -53,
+  -23, -14, 40, 81, 3, -18, -10, -41, 95, 10, 14, 27, 4, -59, 127, -5, 9, 31, 50, -47, 80, 42, 31, -18, 45, 7, 94, 12, 86, -2, 30, 19,
+  35, 4, 57, 52, 43, 29, 14, 43, 25, -5, 25, 38, 79, -5, 35, -6, 68, 48, 50, 14, 31, 70, -12, -11, 55, 38, 8, 19, -27, 60, 16, -12,
+  90, 37, -13, -5, -20, -9, 7, 50, -27, -8, -8, -20, 43, 0, 49, 67, 9, 8, 55, -11, 38, 29, 19, 9, 36, -4, 25, 23, 14, -74, 66, -25,
+  49, 27, -31, -35, 52, -30, 15, 94, -49, -23, 90, -37, 5, 111, -41, -125, -5, -39, 0, 15, -46, -49, 57, -29, 38, 9, -16, 5, -2, 24, 16, 12,
+  -49, 34, 11, -53, 13, -3, -3, 5, 3, -24, -29, -11, -56, 65, 26, -66, 36, 3, 13, 41, 15, 3, -17, -38, -15, 15, 34, -51, 40, 34, 1, 78,
+  36, -4, -26, 41, -22, 57, 38, -53, 57, -47, -64, 16, 85, -69, 40, -29, 0, -20, 81, -75, -11, -42, 6, -17, 42, 3, -38, -49, 26, 4, 29, -38,
+  22, -21, -22, 13, -9, 13, 33, -28, 48, 17, 67, -24, 0, -42, -38, -26, 43, -12, -64, -56, -23, 8, 66, 25, -55, -58, 13, 28, 31, -32, -53, -53,
+  31, 15, 21, 62, 8, 14, -43, -10, 10, 49, 20, -23, -18, 28, -8, -22, 31, 1, -14, 25, 43, -8, -60, 7, -71, 1, -17, -2, 19, 39, -74, 21,
+  -13, 17, 7, 43, -33, 22, -18, -33, -30, -12, -66, 29, -33, -21, -32, 0, -50, 27, 0, 52, 24, 45, -65, 28, 27, 5, -12, 31, -51, 17, 16, 5,
+  -29, -12, -4, -4, -10, 27, 32, 10, -48, -13, -36, 49, 37, 67, 1, -42, -4, -11, -35, 30, 10, -7, 12, -31, -44, -11, 9, -70, -32, 33, -18, 7,
+  20, -57, -20, 15, 26, 33, -5, -54, -25, 12, 25, -2, -52, -47, -8, 39, -23, 38, -71, 14, 23, -33, 34, 37, -28, 35, -8, 31, -21, -6, -14, -54,
+  15, -18, 44, -35, -75, -41, -10, -25, 26, 10, -78, -25, -26, -29, 52, -12, -43, -31, 21, 53, 51, 21, -46, 31, 16, 5, -22, 3, -4, 33, -32, 52,
+  8, 11, -54, -50, -30, 0, 32, -35, -34, -35, -85, -29, 2, -14, 21, -1, -96, 26, -14, -19, 15, 6, -61, 54, -8, 6, 56, 5, -77, 43, -50, -28,
+  -9, -55, -54, 80, 9, -5, 47, 5, 21, -2, 53, -5, -18, -11, -5, -3, 7, 17, 58, -64, 16, 16, 55, 32, 23, -17, -33, -7, 36, -5, 31, -28,
+  -15, -26, 80, -8, -22, -23, 0, 15, 64, 39, -66, -69, 59, 49, 40, 50, -57, -29, 9, 37, -9, 6, -97, -37, 16, -52, 21, -31, -40, -31, -2, -70,
+  -23, 25, -111, -7, -55, -15, -20, -26, -4, 49, -42, 9, -23, -21, -11, -4, -78, 30, -44, -10, 8, 35, -47, 33, -6, -29, 48, 31, -15, -41, 5, -57,
+  11, 38, -34, 29, -41, -9, 64, 0, -39, -11, -47, 14, 40, 33, -38, -7, 18, -4, -10, 56, 12, -38, -40, -30, 17, 35, 22, -43, 19, -25, -20, 21,
+  -47, -7, 15, -3, -31, 2, -33, -17, -19, 4, 45, 27, 7, -24, -16, 30, 35, 23, -59, -13, -19, -32, -19, 121, -24, -14, -67, -15, -12, 68, -5, -15,
+  -44, -56, 4, 56, 0, 1, -53, -23, -44, 110, -36, -34, 8, -13, 21, 36, 13, 2, -69, 12, -19, 6, -31, -17, -10, -6, -33, 47, -34, -19, -66, 51,
+  28, 54, -27, -9, -59, 40, -24, 110, -71, -46, -30, 39, -8, 68, -55, -4, 10, 58, 59, 91, -12, -30, -28, 44, -1, 54, 7, -9, 1, -25, 2, 63,
+  11, -20, -20, 42, 30, 127, -39, -4, 11, 62, 1, 62, -12, -8, 6, 26, 23, 32, -57, -1, -5, 25, -30, 7, -44, -13, -21, -33, 30, 51, -47, -42,
+  54, 12, -2, -3, -33, 43, 72, -48, -9, 14, -41, -9, 34, -17, 66, 52, -7, -28, 31, -8, -4, 13, -55, -23, 75, -71, -17, 90, -20, -21, 22, -18,
+  -10, 31, -72, -24, 24, 1, -1, 7, -54, -42, 30, -5, 25, -12, -9, -8, 62, 39, 19, 25, -36, 20, 87, 11, -16, -26, 20, -50, 79, -42, -46, 22,
+  -96, -40, 53, -60, 28, -28, -93, -28, -26, 34, -37, -31, -36, -3, -61, 52, -36, 13, -32, -74, 4, 42, -6, 11, 2, -48, 32, 61, -46, 56, -60, -58,
+  20, 41, -48, 30, 9, -61, -25, -46, -7, 42, -37, -10, -6, 17, -43, 17, -56, -35, -10, 21, 16, -41, -3, -62, 22, -3, 1, -57, 17, 1, -9, -21,
+  18, -13, -8, -54, 11, -41, 18, -56, 0, -50, 4, -48, 31, -6, 37, -35, 17, -75, -30, -5, 21, -45, 28, -80, -81, -5, 19, -1, 26, -80, -6, -45,
+  19, -3, 35, 10, -45, -43, -50, -11, 44, 21, 40, -46, -39, -42, 10, 4, 21, -86, 35, -37, 42, -40, -48, 6, -9, 28, -5, -68, -11, -32, -14, -18,
+  0, -56, -17, 14, -39, -31, 3, -42, 28, -35, 10, -39, 19, -55, 37, -5, -2, -29, 37, -52, -34, -46, -1, -25, -23, -30, -17, 17, 37, 5, -43, -34,
+  -21, -20, 49, -25, -14, -1, 5, 23, 70, -15, 9, -32, -41, -13, 47, 37, -33, -71, -4, -26, 62, -8, -83, 4, -32, 2, 21, 34, -23, -60, -22, -41,
+  43, 9, -71, -13, 17, -56, 64, -10, -63, -16, -45, -45, 58, 44, 2, -59, -3, -54, 73, 46, -13, -26, 4, 53, 25, 26, -19, -73, 10, 90, 56, 56,
+  -12, -88, 2, 45, -4, 70, 42, 13, 26, 73, 80, 49, 43, -56, -45, 1, 28, 31, 30, -13, -23, -29, 5, 63, -13, -44, -25, -23, 30, 80, 23, -11,
+  -24, -6, 4, 67, 11, -37, 0, -51, 21, 34, -12, 1, -50, -21, 48, 57, 42, 39, 11, -36, 75, 24, -32, 45, 45, 57, 20, -24, 11, -5, 73, 114,
+  49, -57, -38, -26, 61, 115, 14, -49, -28, -79, 2, 94, 27, 32, -45, -35, 40, 94, 13, -24, -49, -26, -29, 33, 71, 32, 23, -36, -49, 19, 8, 54,
+  4, -14, 18, -45, 30, 86, -36, -4, 3, -68, 26, 26, 31, 10, 32, 34, 25, 64, -1, 54, -34, 23, -5, 75, 3, 42, -32, 69, 4, 43, 6, 43,
+  15, 55, 17, 30, 5, 13, -60, 87, 33, 42, -34, -18, -13, 7, 37, 34, -7, 17, 14, 57, -40, 66, 21, 12, -22, 35, 12, 54, 1, 50, 20, 55,
+  -17, 46, -19, -19, 32, -2, -38, 33, -9, 22, -11, 11, -27, 77, -37, 7, 33, 16, -44, 64, -22, -26, 17, -7, 1, 57, 15, 39, 22, 5, 21, 36,
+  13, 27, 34, -1, -35, 11, 56, -21, 38, -33, 30, 13, 18, 39, -22, -2, 23, 55, 49, 31, 16, -5, -5, 5, -34, 46, -31, 29, -7, 40, -33, 62,
+  16, 29, -59, 17, -31, -3, 12, 23, -66, 28, 3, 41, -21, 43, -58, 10, -18, -13, 35, 63, -57, 5, 27, 20, 70, -61, -25, -3, 3, 60, 50, -21,
+  -34, -14, -65, 17, -13, 31, 27, -25, -12, -10, 34, -12, -8, 44, 5, 9, 26, 4, -61, 27, 0, 18, 30, 85, -54, -35, 19, 11, -40, 50, -20, -32,
+  -20, -15, 21, 55, -21, -12, 32, 3, 4, 8, -2, -13, -28, 6, 19, -35, 17, 13, 32, 32, 45, -76, 23, 40, -34, 80, -24, -28, -24, -18, 2, 83,
+  16, -16, 11, -18, -27, 14, 33, -57, -24, 33, -13, 29, 80, -54, -46, -5, -24, 56, 7, -14, 2, 59, -32, 61, 13, 11, -53, -16, 0, -3, 34, -19,
+  10, 18, -27, 26, 96, -7, 16, -46, 18, -25, 35, -50, -46, -10, -29, 3, 1, -73, -26, -67, 43, -47, -5, -93, 12, -105, -25, 1, 23, -86, 7, -97,
+  0, -21, 54, -67, -50, -76, 21, 55, 59, -26, -47, -15, -19, 36, 35, -56, -65, -57, -49, 19, 66, 34, -58, 5, -4, -8, 37, 40, -53, -4, 15, -27,
+  -38, 27, -29, -50, -24, 11, -10, 3, -67, -55, -25, -10, 32, 2, -40, 7, 2, -2, 14, -44, -59, 21, -12, -2, 60, -41, -23, -1, -12, 19, 11, -34,
+  -13, 8, 39, 22, 6, -75, -22, 0, 36, 8, 18, 20, -18, -40, 60, -5, -42, -2, -1, -52, 5, -30, -52, 21, -14, -58, -11, -2, -22, -77, -21, -7,
+  20, -32, 18, -60, -20, -44, -25, -21, -29, -51, -14, -30, -26, -33, -28, -8, 21, -64, -1, -1, -15, -33, 46, -99, -35, -17, 24, -21, -42, 36, 14, 24,
+  15, 57, 0, 21, 20, 43, 12, 77, -48, -7, -15, 6, 45, 69, 24, 7, 24, 18, 10, 4, 11, -32, 34, -43, 14, 17, -50, 15, 48, 29, 39, -4,
+  -50, 34, -33, -49, -11, 19, -9, -39, -35, -35, -11, -74, 31, -52, -31, -69, 25, -7, 33, -41, -18, -18, -20, 13, 41, -2, 22, -4, 11, 4, 30, -56,
+  24, 1, 17, -24, -8, -6, -11, -6, -23, -45, -21, -51, -22, -32, -5, 12, -50, -23, -13, -41, -13, 12, 41, -41, -9, -10, 4, 25, -3, -39, -8, -10,
+  -41, 13, -60, -33, -4, -37, -42, -83, -62, 6, 16, 48, -25, -13, -57, -58, 31, 18, -7, -37, -97, -10, -13, 1, -14, -73, -38, -3, -45, -27, -23, 22,
+  -25, -28, -19, 34, -23, -13, -69, -15, -2, 17, 12, 22, -18, 25, -41, 1, -32, 36, -40, -9, 19, 11, -27, 5, -8, -6, -8, 43, 75, 5, -70, -27,
+  -35, 50, 58, 7, -70, 34, -10, 11, 69, 37, 6, 10, 61, 125, -7, -6, -70, -44, 10, 124, -34, 58, -14, -15, 44, 102, -33, 51, -39, -20, 53, 91,
+  16, 36, -66, 18, 51, 50, 5, -29, -13, -24, 22, 98, -1, 17, -15, 17, 17, 41, -75, -13, -31, 33, -46, 73, 3, -24, -38, -21, -3, 50, -82, 33,
+  -7, -41, -30, 97, -84, 5, -24, 7, 29, 39, -58, -22, -89, -61, -32, 9, 3, 19, -44, -26, 2, 17, 49, -38, -26, -30, 10, 29, -13, 34, -14, -37,
+  -37, 23, -4, -33, 16, 3, -52, -25, -2, -27, 19, -62, -1, -12, -18, -2, -42, 16, -16, 59, -63, 35, -42, -1, -34, 32, -23, -32, -11, -59, 7, 76,
+  4, -4, 6, 8, -13, 83, -43, -18, -42, -26, -31, 2, -53, -25, -64, 26, -62, 58, -52, -49, 7, -15, -28, 93, 1, 3, -36, -19, 28, 108, 2, -45,
+  -8, 9, 35, 83, -7, 12, -15, -36, 56, 5, -12, 16, -24, -2, -16, -12, 21, 59, -92, -10, 87, 66, 82, 16, -49, -27, 18, 108, 10, -30, -14, 21,
+  39, 111, 10, -11, -52, -23, 83, 36, 46, 32, -1, 48, 36, 127, 26, 30, -31, 50, 45, 29, 26, 21, 4, 3, 32, 71, -50, 20, -62, -11, 73, 71,
+  -15, -72, 6, 25, -7, 97, -54, -91, -65, 12, 10, 67, 3, -61, -43, 22, 23, 71, -36, -50, -56, 12, 1, 85, -57, -8, -57, -15, 44, 52, -21, -25,
+  -91, 47, 46, 47, -15, -12, -64, -18, 18, 36, -52, 56, -104, 48, 35, 78, -54, 39, -47, 0, 75, 75, 6, -22, -63, 21, 70, 50, -15, 26, -53, 24,
+  -16, 117, -46, -17, -53, 40, 70, 61, 11, 45, -20, 11, 22, 43, 35, 1, -67, -56, 49, 74, -15, 25, -51, -9, 30, 97, -18, 20, 3, -69, 6, 82,
+  -53, -29, -16, -57, -10, 34, -63, -43, -40, -39, 17, 34, -81, -19, -32, -57, 62, 31, 7, -49, -51, -2, -19, 28, 29, -72, -33, 7, 4, 40, 3, -26,
+  -23, -37, -28, 51, -37, 17, -31, 40, -1, 68, 43, 32, -15, -42, -17, 26, -20, 37, 15, -28, -4, 61, -84, 38, -39, 10, -4, 12, 10, -4, 15, -15,
+  23, 3, -68, 56, -25, -23, -5, 77, -42, 13, 26, -4, 0, 61, -7, 4, -12, 33, -74, 12, -25, -21, 61, 51, -66, 71, -62, -46, 21, 37, -4, 33,
+  -28, -35, 18, -23, -19, 81, -67, 21, 16, -8, -61, 57, -33, 38, -20, 33, -15, 0, -12, 42, 39, -8, 2, 28, -24, 16, 5, -15, -34, 64, -60, -18,
+  -3, 17, 35, 42, -9, -30, 52, -22, 52, 88, -60, 11, -12, -39, 35, 48, 17, -81, 24, -40, -29, 42, -63, -51, 10, -31, 21, -1, -16, 24, 48, 32,
+  -53, 49, -79, -15, 7, -18, -41, 61, 18, 14, -10, -24, -8, 35, 1, 66, 0, 1, -48, 42, 23, -12, 5, 49, 6, 104, 23, -28, 9, 21, -13, 45,
+  18, 8, -51, 40, 32, 47, 16, -40, 9, 14, 40, 29, -32, -6, 8, 16, -33, 10, 36, -37, -6, -16, -30, 14, 57, -11, 12, 8, 65, 29, 15, -1,
+  22, 2, 82, 37, -45, -19, 69, 14, -86, -67, -51, 35, 56, -38, -60, -10, -14, -6, 33, -15, -26, -53, 55, 15, -6, -42, -11, -17, -40, -15, 13, -30,
+  -79, 18, 12, -46, -5, -33, -36, -9, 9, -78, 44, 41, -19, 32, -5, -25, 58, -2, -22, -26, 22, -96, 22, 62, 41, 51, 42, -10, -30, 37, 24, 55,
+  13, 18, -10, -26, 10, -5, -8, 12, 10, 20, -23, 57, -12, 19, -11, -53, -25, 58, -3, 44, -42, -5, -28, 8, -21, 12, -48, -33, 40, 45, 38, -50,
+  -27, -22, -26, 65, 34, -1, -45, 15, -26, 49, -19, -81, -34, -32, -30, 26, 17, -18, 33, 13, 25, -6, -52, -43, -31, -34, 30, 67, -49, 47, -45, -45,
+  -9, 61, 1, 3, 26, 41, 14, 15, -40, 33, 17, -13, 41, -15, -54, -58, -57, 70, 5, 4, 8, -27, -21, 26, -14, 29, -27, -21, -22, 82, -18, 60,
+  -4, -42, -10, 40, -1, -18, -13, -63, -36, 38, 12, 5, -40, -40, -72, 35, -21, -36, -8, -83, -82, 6, 44, -6, 40, -38, -87, 24, -7, -108, -8, 8,
+  37, 6, -2, -52, -68, -12, 19, -6, 21, -78, -6, 28, -53, 44, 10, -55, 42, 0, -52, -37, -10, -119, 20, 57, -1, 3, 44, -108, 28, -13, -5, -12,
+  42, -39, 67, 52, -19, -11, 8, -31, 101, 11, -9, 52, 38, -21, 19, -2, -12, -13, 100, 26, 65, 61, 45, -25, 13, 16, 61, 40, 19, 28, 90, -72,
+  74, 32, 48, 15, 24, -51, 32, 9, -8, 40, 37, -115, -12, -29, 3, -31, 39, -108, 10, -67, 42, -5, -15, -64, -12, -28, 36, 16, 1, -38, 42, -39,
+  63, 74, 0, -24, 60, -14, 24, 97, 17, -19, -36, -4, -13, 31, 29, -20, -55, -72, 70, 50, 3, 16, -32, -70, 52, 70, -16, -47, 11, 41, -19, 74,
+  6, 52, -30, -9, 19, 43, -14, 20, 23, 39, 36, 74, -4, 36, 18, -45, -1, -10, -47, -17, 22, 26, 31, 27, -14, 28, 53, 44, 25, 56, 34, 15,
+  48, 46, -19, 90, -24, 17, 9, 35, -5, 87, -36, 27, 82, -10, -34, 49, -9, 56, 1, 46, 28, 6, -74, -32, -3, 51, -16, -27, -32, 4, 1, -24,
+  -43, -44, -44, -75, -60, 35, 51, -24, -78, -26, 35, 15, 43, -7, -75, -35, -40, 14, -29, 2, -58, -20, -17, 63, 33, 12, -122, -48, -69, 18, 53, 3,
+  -127, 13, -66, -13, 5, 4, -68, -21, -44, 69, 39, 67, -60, -23, -33, 36, 63, 41, -13, 39, -33, 14, 50, 51, -30, -9, -57, 37, 38, 0, -23, 62,
+  -25, -16, -26, 62, -28, -13, -35, -13, -27, 24, -74, 40, -91, 13, -17, 38, 0, -4, -50, 46, -21, 9, -56, -43, -56, -29, -16, 13, 22, -23, -99, -31,
+  43, 35, -11, 21, -34, 21, 4, 53, 45, 25, -112, -5, 49, -1, 47, -26, -71, 20, 40, 17, 63, -21, -27, 26, -4, -1, -13, -35, -64, 67, -36, 50,
+  12, 61, -84, 22, -60, 6, 34, 41, -46, 91, 3, 47, -56, -8, -5, 60, 24, 28, -54, 39, -22, 36, -22, 70, -68, 103, -25, 99, 29, 24, -77, 113,
+  -28, 75, 26, -51, -12, 69, -18, 23, 0, -11, 3, 65, -13, 32, 42, 18, -34, 41, -12, 38, 10, 8, -23, -6, -7, 31, -6, -37, 6, -24, -80, 38,
+  14, -1, -38, 1, -42, 1, -24, 13, -67, -46, -100, 5, -14, -8, -44, -35, -108, 4, 39, -28, -32, 29, -97, 27, -4, 32, -56, -47, -54, 21, -24, -32,
+  -36, -21, -78, 35, 3, 7, -11, -15, -69, 45, -5, 5, -92, 40, -50, 40, -4, -45, -72, 33, 12, -14, -90, -3, -56, 70, -2, 19, -36, -44, -34, 11,
+  -52, 47, -25, -47, -97, -43, -48, -2, -78, -45, -48, 51, -34, -27, -52, -56, 5, 34, -46, -71, -81, -43, -60, -18, -28, -61, -37, -76, -87, -27, -80, -9,
+  -26, -36, -87, 53, -113, 30, -81, -108, -32, 27, 5, -5, -62, -61, -63, -21, -3, -44, -126, -123, -49, 15, 20, -20, -34, -91, -49, -42, -31, -39, -100, -26,
+  -52, 4, -74, -66, -21, -66, -46, 36, -67, -77, -57, -36, -47, 10, -45, -59, -58, -42, -23, -21, -32, 9, -107, -20, 26, -56, -44, 37, -24, -60, -26, -10,
+  -47, 19, -69, -85, -38, -29, -32, -7, -48, -39, 7, 10, -26, 10, -33, -6, 3, -29, -100, -45, -91, -30, -6, -43, -46, 47, -22, -26, -1, 16, 15, -8,
+  -15, -47, -34, -54, -67, -2, 22, -59, -1, -44, -49, 14, 18, -26, -22, -22, -23, -4, -25, -69, -29, -4, -17, -39, -42, -87, 18, -32, -62, 30, -4, -32,
+  -37, -15, -44, -34, -19, -11, 24, -37, -10, -57, -12, -94, -58, -76, -26, -57, -19, -21, 17, -16, 3, -105, -39, 21, 2, -48, -33, -88, -48, 3, -43, 44,
+  54, -70, 38, -58, -27, 27, 71, -72, -52, 4, 4, 15, 54, -3, 0, -50, 4, -44, 1, -40, -44, -93, -21, -68, -4, 22, -24, -105, -13, -55, 21, -36,
+  -50, -75, -71, -8, -29, 10, -64, -39, -18, -73, 8, -9, -46, -25, -64, -18, -45, 27, -7, -5, -58, -52, 7, 5, -4, -83, -40, 47, -81, 23, -67, -12,
+  -20, 19, -26, -26, -1, -69, -74, -25, -47, 18, -48, -32, 71, 10, -48, -77, -50, 4, 3, 65, 30, -10, -17, -11, 38, 16, 28, 30, -36, -4, 66, 33,
+  18, 0, -20, 15, 45, 41, -11, -1, -59, 28, -53, 58, 43, 57, -53, -34, 52, 1, -12, 78, -64, -23, 39, 8, 40, -1, -49, 35, 25, 34, 8, 55,
+  -36, 16, -2, 35, -34, -53, -30, 3, 10, 29, -6, 5, -22, -31, 49, 61, 33, 51, 28, -29, 16, 31, 4, -5, 15, -71, 44, 33, -19, 54, -55, -45,
+  53, 3, 43, 47, -3, -92, 13, 12, 15, -15, -12, -75, -57, -20, 23, 10, 18, 21, 22, -17, 38, -69, 49, -62, 9, -45, -9, -2, -12, -50, -53, -20,
+  -14, -12, 36, -17, 35, 34, 40, -44, -22, -25, 22, 32, -9, -2, -5, 5, 31, 21, -12, -34, 36, -30, -26, 32, -43, 29, 11, 4, 30, -26, 20, -17,
+  -17, -33, 2, -21, -18, -28, 3, -6, 52, 16, 19, -55, 19, 6, -52, -39, 70, -50, -4, -21, -38, -57, 9, -11, 30, 8, -62, 20, 30, 11, 86, -20,
+  55, -5, 59, 14, 8, -55, 27, 10, 15, 19, 37, -57, 12, -22, -23, 12, 59, -41, 48, 3, -15, 33, 24, -68, -17, 17, -22, -1, -41, 7, 17, -1,
+  36, 7, 10, 20, 36, -8, 38, -33, -10, 13, -16, -10, 5, 31, 51, 52, 11, 12, 29, 16, -5, 23, 25, 10, -32, -27, 30, -4, 49, 13, 22, -43,
+  15, -36, 37, 19, -11, -33, -31, 8, -2, 6, 59, -24, 7, 9, -18, 10, 27, -7, -38, 12, -29, 20, 7, -11, -45, -14, -24, -5, -27, 6, 14, 16,
+  16, -22, 44, 0, 16, -5, 37, 18, -7, -19, 35, -41, 42, -23, 4, -2, 32, -11, 19, -11, -39, 13, 41, -10, -11, 0, -14, 14, 7, -39, 5, 28,
+  43, -56, 22, -32, 2, 5, -14, 4, 1, 45, 24, -25, -23, -27, -12, -23, 6, -8, -26, -1, 53, -23, -13, -24, -26, -7, 44, 10, -73, 24, -61, 13,
+  -2, -14, -49, 47, -10, -13, -22, 7, -46, 9, 1, 10, 50, -14, -56, 26, 15, 28, 54, -30, 22, 22, 56, -11, -4, 0, -11, -21, 48, -20, 13, -56,
+  11, -9, 41, 48, -27, 17, -9, -8, 47, 46, -19, -36, -22, -11, 7, 53, -41, 1, -30, 32, -4, -19, 10, -27, 31, 16, 39, -34, 22, -15, -30, 23,
+  -9, 20, 32, 30, 6, 63, -26, -15, -16, -15, -43, 31, 1, 14, 16, 28, -40, -12, 29, -27, 52, 18, 21, 15, 11, -51, -38, -38, 11, 70, 46, 3,
+  -40, 20, 8, 60, -1, -9, 18, 4, -18, 47, 35, -24, -9, 43, 35, 5, -22, -38, 20, -43, -7, 44, -27, -18, 2, -3, -23, 42, -15, -9, -4, -45,
+  24, -1, -20, -8, 12, 11, -42, 5, -48, -24, -3, 29, -26, 57, -5, -37, -19, 1, -15, -34, 15, -26, 14, -2, -23, 54, 24, -4, -3, -9, 4, 73,
+  -22, 70, -37, 61, 6, -2, -37, 29, -6, -43, 9, -45, -33, 2, 45, 28, 16, -5, 6, -4, 20, 12, -13, -57, -11, 19, 22, -54, 53, -54, 7, 30,
+  4, 28, 10, -26, -4, -19, 8, 36, 31, -26, -6, 53, -65, -37, -17, -23, -5, 43, -31, -51, 19, 37, -58, 53, 33, -53, 32, -33, 10, -5, 27, -45,
+  30, -49, -32, 63, -40, 49, -30, 34, -39, 41, -13, -24, -40, -40, -66, 26, -52, 34, -13, 25, 2, 6, -16, -27, -36, -35, 47, -16, -26, 36, -22, 6,
+  4, -29, 15, 29, -15, -48, 86, -5, -36, -21, 35, -22, 18, -29, 18, 19, 33, -12, 40, 20, 59, 2, -27, -9, 29, -29, 52, -54, 23, -29, 20, -75,
+  -11, 16, -6, -78, 84, -18, 25, 35, 6, -66, 73, 44, 10, 79, 1, -54, 77, 23, 17, 36, -50, -9, 34, 15, 22, 56, -30, 15, 40, 17, -7, -5,
+  -7, 4, 93, 43, 37, -44, -67, 2, 127, 95, 7, 0, -26, -14, 47, 36, 64, -17, -84, 42, 51, 43, 79, -7, -46, -7, -7, -12, 53, 2, -11, 32,
+  51, 14, 61, 10, -83, -8, 0, -41, 36, -56, -42, 8, 42, -23, -4, 8, 17, 34, -8, -37, 14, -33, -23, 29, -6, 22, 3, -43, 2, 42, -7, 33,
+  37, 1, 17, -1, 1, -6, -18, 9, 3, 49, -78, -32, 27, -17, 33, 10, -61, -47, 48, -50, 4, -16, -83, 17, 53, -38, 48, -2, -18, -7, 12, -19,
+  14, -12, -13, 16, 8, -91, 49, -24, -43, -18, -1, -76, 86, -73, -37, 6, 3, -78, 50, -50, -67, 55, 45, -37, 90, -4, -26, 23, 39, 31, 50, -33,
+  -74, 44, 39, 37, 66, -34, -23, 62, 30, 25, 95, -34, -83, 51, -9, 40, 50, -30, -45, -35, -2, 22, 13, -18, -33, -10, 16, -9, 40, 39, -45, 18,
+  9, 9, 6, -31, -40, 23, -8, 8, 35, -18, 0, 18, -46, -57, 8, -64, -6, 2, -94, -10, 67, -40, 47, -12, -36, -32, 29, -32, -16, -22, -17, 22,
+  13, 18, 3, 42, 11, 24, 61, -15, -34, 43, -23, 39, 24, -25, 12, -45, -36, 43, 104, -39, -22, -37, 13, 31, 60, -26, -40, -33, -4, 17, 98, -72,
+  33, 23, -22, 31, 93, -39, 3, -6, -25, 26, 61, 4, 64, -6, -68, 25, 7, 30, -20, 49, -54, 21, 2, 44, -15, -13, -40, -35, -15, -6, -30, 2,
+  -61, -6, -11, -4, -21, -57, 10, -16, -11, -30, -48, -45, -18, 25, 32, -2, -10, -15, 9, 33, 34, -24, 6, 38, -7, 3, -6, -74, -22, -53, -26, 1,
+  -37, -55, -14, -17, -40, -4, 10, 33, -19, 26, -44, 53, 35, 20, 15, -33, -13, -5, -22, 62, 57, -7, -60, -14, 37, -10, -8, -51, 6, -1, 26, -13,
+  -10, 22, 20, 19, 18, 6, 35, 14, -11, 14, 30, -30, 59, -46, 44, -30, -13, -15, 25, 1, 18, -2, -30, -38, -20, -53, -2, -7, -11, 6, -15, -25,
+  -45, -65, 28, -12, -35, 42, -23, -45, -28, 11, 40, 29, -1, -3, 16, 4, -36, 27, 11, 6, 23, 35, 23, 54, -61, -11, -13, 25, -30, 10, -19, 4,
+  23, -20, -33, -58, -67, -34, -54, 7, 23, 3, -71, -16, 7, -24, -2, -70, -50, 17, -14, 0, -33, -48, -70, -38, 9, 62, -9, -102, -89, -51, 14, 47,
+  73, -70, -55, -36, -1, -59, 52, -98, 99, -52, 29, 33, 30, -67, 52, -45, -2, 0, 6, -76, 113, -22, -8, 58, 20, -80, 95, -31, 12, 43, 3, -53,
+  86, -17, 5, 56, 9, 8, 53, -45, -6, 30, 0, -62, 87, -100, 9, 16, 31, -73, 53, -100, -2, -24, -26, -38, 62, -116, 4, -34, 45, -93, 8, -84,
+  8, -73, 26, -53, 25, -96, 17, -16, 36, -66, 67, -61, 8, 1, 28, -90, 72, -32, -13, 32, 1, -85, 77, 9, 33, -14, 15, -96, 61, -4, -25, -57,
+  -19, -67, 92, -27, 13, 20, 19, -73, 84, -11, -20, -14, -10, -92, 101, -22, -22, 8, 14, -105, 99, 17, 5, -30, 27, -98, 81, 12, 7, -56, -11, -77,
+  61, 39, -3, -7, -16, -22, 49, 5, -7, -18, -4, -17, 22, 67, -25, 17, 36, 28, 22, 38, -5, 5, 22, -14, 35, 8, 10, 4, 16, -51, 43, -19,
+  -37, -63, 40, 2, 70, -1, 22, -62, -23, -27, 35, 20, -20, -35, -8, -9, 39, 11, 63, -52, -27, 67, 22, 35, -52, -32, -28, -33, 33, 34, -84, -7,
+  36, 14, -30, -29, -62, -15, -18, 14, 18, 3, -33, -60, 9, 12, -25, 3, 6, 8, 9, 2, 0, 15, 13, -43, 34, 54, 9, -3, 10, -60, -12, 75,
+  16, -13, 3, -65, -13, 62, 32, -24, -5, -6, -11, 49, 25, 16, 69, -17, 18, 16, 18, 19, 63, -46, 57, -16, -30, 22, 88, -23, 38, -12, 32, -20,
+  86, -39, 40, -56, 34, 11, 81, -12, -33, -20, 45, 37, 27, -32, 10, 66, 9, 27, 37, -30, -27, 28, -33, -25, 34, 32, -26, 41, -12, 45, 43, -17,
+  2, 17, -68, 6, -1, 28, 10, 91, -58, 9, 34, 1, 18, 29, -34, 3, -38, 12, 47, 35, 12, 23, 8, 55, -15, 28, -24, 26, -28, 60, -43, -10,
+  16, 40, 26, 33, -13, 6, 32, 47, -48, -21, -37, -59, 19, -37, -27, 23, -59, 19, 28, -7, -3, -6, -59, -2, 37, -2, -80, 6, -17, 20, 6, -15,
+  -39, 42, 2, 3, 12, 30, -25, 22, 18, 42, -9, -31, -46, 8, 41, -5, -33, 8, -80, -16, -39, -3, 46, -17, 1, -20, -10, 6, -24, 4, -35, -14,
+  -18, 12, -17, -24, 6, -47, 32, -6, -4, -16, -11, 16, 9, -30, -12, 22, -8, 16, -45, 38, 40, 9, -44, 17, -14, 8, -35, -6, -8, -7, -1, 59,
+  -33, -20, -4, -5, -32, 50, -50, 1, -28, -45, 14, -1, -37, -45, -53, 0, 20, 7, -37, 8, -62, 10, 7, -3, -28, -49, -13, 9, -9, 47, -40, 21,
+  -5, -12, -37, 25, -23, 32, 47, 37, -35, -76, -12, 15, 37, 28, -60, -96, 37, 19, 44, -2, -2, -23, -47, -14, 33, 14, -24, -33, 0, -43, 6, -41,
+  12, -62, -5, -32, -20, -8, -18, -91, 8, 4, 11, 30, 7, -124, 15, 50, 37, 45, -46, -127, -10, 69, 10, 49, -8, -88, -27, 26, 17, 51, -34, -2,
+  -25, 0, 16, 53, 4, -5, 12, -55, 42, 2, -6, 49, -65, -61, -6, -18, 16, 41, 0, -49, 13, -2, 32, -25, -53, -1, 35, -25, -32, -67, -11, -36,
+  44, -25, 16, -84, -24, 19, -4, 10, -11, -92, -1, 24, -27, 27, -4, -7, 7, 15, -42, 40, 33, -47, 23, -14, -25, 31, -15, -61, 4, 15, -61, 9,
+  20, -81, 33, 39, -9, 55, 21, -29, 13, 22, -23, 40, 37, -97, -5, -1, -45, 3, 42, -104, -10, -4, -43, 73, 55, -8, -6, -38, -16, 17, 31, -19,
+  -1, 37, 14, 25, -3, 32, -31, 6, -55, 41, -23, 8, -32, 14, -1, 44, -11, 12, -21, 10, 0, -7, -14, -51, -22, 33, -23, -16, -43, -2, -1, 7,
+  21, -13, -11, 72, 9, 10, -12, 8, -33, 38, -10, -2, -18, 1, -6, 19, -50, -2, 11, -53, -27, -11, -49, -14, 21, 6, -18, -35, -62, 40, -39, -56,
+  5, -7, -12, 8, -18, -51, 36, 58, -44, 25, 23, -25, -17, 38, -30, 8, -31, -47, -2, 24, -50, 1, 45, -49, -16, 19, -25, -4, 15, -3, -38, -17,
+  -4, 40, 55, -31, -24, -10, -42, -10, 66, 32, -54, 31, -25, 32, 6, 68, -18, 29, -32, 48, -45, -13, 47, -34, -37, 37, 0, -61, 8, -3, 0, 13,
+  16, 17, 15, 16, -45, 66, -3, 34, 61, 9, -1, 87, -8, -5, 65, -4, -36, 48, -6, 62, 42, 33, -23, 59, 2, 1, -15, -17, -20, 42, 61, 35,
+  35, 26, -9, 37, 36, 4, 74, 36, -74, 19, 40, 28, 31, 13, -22, 21, 36, 27, 64, 26, -61, 26, 17, 83, 23, -14, -53, 20, 62, 58, -19, -13,
+  -40, -68, 13, 46, -72, 1, 44, -33, -7, 21, -17, -16, -49, -62, 27, -32, -37, 21, -10, -12, 35, 3, -40, 25, -79, -17, 3, 7, -32, -10, -45, 5,
+  -18, -53, 10, -15, 7, -53, 46, -34, 42, -39, 34, 0, -4, -46, 21, -19, -17, -32, -7, -24, 2, 25, 38, 0, -15, -53, 38, 21, 56, 10, -37, -10,
+  12, -18, 64, 5, 5, -35, -18, -1, 42, 10, 13, 17, -47, -19, 43, 16, -51, -3, 0, -32, -16, 16, -1, -19, -21, -57, 16, 10, -63, 6, 4, -8,
+  19, 9, -9, -18, -2, -37, 13, 2, -69, 42, -37, 86, -8, -11, -54, 19, -65, 52, -20, 25, -36, -28, -16, 23, -39, -35, -25, -39, 9, 1, 5, 8,
+  26, -50, -49, 58, -32, -33, 12, -13, -34, 7, -3, 8, -5, -72, -66, -8, 23, 16, 6, -68, -28, 19, -23, 11, -37, -44, -27, -11, -6, 4, 4, -39,
+  -33, 1, -46, 28, 11, 13, 16, -12, -17, 4, 36, -23, -25, 33, -42, 30, 36, -20, -21, -16, -59, 9, -19, 9, -25, -17, 0, -33, 56, -12, 48, -53,
+  25, -2, 45, -8, 4, -37, -7, -22, -6, 40, -17, -74, 31, -29, 27, 1, -3, -58, 15, -24, 35, 35, -30, -85, 53, -12, 9, 7, -10, -55, 56, -19,
+  10, -18, -39, -62, 33, -65, 35, 8, 13, 10, 42, -40, -35, 7, -44, 25, 20, -4, 5, 29, 5, 12, 47, 13, -25, 23, -39, -44, 20, -15, -11, -5,
+  -6, -46, 8, -46, 29, 47, -26, 10, -38, -53, 7, 1, -37, -18, -21, -54, 0, 39, 9, -45, 6, -36, 28, -40, 3, -32, -11, -88, -21, -8, -63, -27,
+  15, -54, -42, -80, -76, -59, 15, -23, -60, -70, -38, -52, 7, -46, -55, -25, -51, -22, 27, -3, -5, -30, -5, -16, 44, -8, -48, -75, -21, -52, -8, -44,
+  13, -42, -46, -42, -2, 21, -5, -27, -57, -66, 40, -9, -19, -11, -34, -35, 3, 24, -46, -4, 10, -40, -32, 22, -17, 6, 9, -64, -14, -3, 4, 4,
+  -29, -55, -21, -50, -51, -11, -27, -62, -21, -43, -28, -40, 22, -12, 4, -57, -21, -15, -14, -63, -11, -34, -31, -31, -30, -8, -9, -32, -44, 13, -39, -49,
+  28, -28, -32, -53, 4, 36, -33, -32, -18, -28, -49, -22, -22, -7, 6, -28, -33, 32, -16, -39, 3, 10, 2, 13, 18, -32, 48, -4, 17, 3, -27, -11,
+  -16, 36, 18, -19, -29, -9, -9, 38, 14, -27, 32, -3, -11, -10, -50, -53, 28, 19, 4, 38, 0, -48, 64, -36, 7, 24, -49, -68, 41, -40, 48, 29,
+  -47, -24, -3, -15, 16, -11, -34, -73, 53, 3, -6, 1, -17, -58, -25, -28, -18, -33, 4, -43, 5, -35, -1, 16, -41, -63, -31, -63, 13, -45, 14, -59,
+  28, -48, -8, -42, -59, 5, 21, -23, 25, -5, -43, -25, -12, 24, 18, 33, -37, 13, 34, 37, -29, 41, -61, 29, 8, 23, -26, 13, -11, -23, 46, 37,
+  3, 6, -43, -45, 36, -32, 29, -26, -51, 21, 43, 19, -20, -28, -62, 3, 57, -59, -10, -49, -39, -10, 56, -58, -30, 6, -11, -13, 2, 9, 30, -9,
+  -27, 31, 46, 18, 29, -4, -89, -26, 45, 3, -26, -13, -57, -37, -39, -34, -48, 16, -32, -28, 5, 36, -52, 4, -49, 24, 5, -32, -23, 6, -38, 45,
+  -9, -3, 15, -7, -56, -4, 20, 15, -19, -4, -21, 8, -9, 16, -31, -43, -64, -14, 25, -13, -35, -33, 6, -42, -21, -45, -11, -40, -6, -50, 2, -31,
+  22, -27, -10, -30, 62, -15, -26, -76, -70, -30, -1, -10, 14, -42, -25, -76, 29, -34, 32, -32, -68, -24, 12, 36, 36, -22, -95, -4, 51, 3, 12, -35,
+  -58, -66, 11, -8, 17, -4, -59, 9, -14, 18, 30, -9, -93, -55, -29, 25, -5, -33, -36, 13, -36, 41, 28, -44, -14, 2, 28, -16, 26, 3, -69, -61,
+  -20, 1, 11, -22, -18, -66, 39, 13, 24, -32, -10, 8, 26, -24, 16, -38, -93, -22, -40, 29, 18, 5, -77, 29, 0, 19, -41, -36, -38, -44, -1, 9,
+  -35, 2, 3, -45, -21, 12, 20, 6, -54, -16, 12, -5, -32, -32, -29, -52, 31, -19, -5, -32, -20, -55, 47, 15, 5, -6, -28, -79, 41, 10, -49, -51,
+  -27, -47, 8, -15, -27, -40, -97, -86, 9, 16, -8, -8, -92, -65, 5, -7, -46, -14, -23, -20, 13, 18, -16, -27, 2, -39, -48, -2, -22, -20, -62, 37,
+  27, 33, -62, 36, -19, 2, -4, 26, -49, -19, -19, 10, -30, -35, -11, -29, -66, -16, 26, 30, -29, 19, -66, 13, 57, -6, -12, -8, -95, 35, 63, -18,
+  -20, -9, -73, 19, -12, -15, -55, 21, -106, -22, 43, -52, -50, -36, -112, -17, 58, -14, -74, -14, -93, 26, 16, -9, 5, 4, -49, 14, 50, -27, 13, -20,
+  -43, 50, 35, -33, -31, 4, 24, 39, -28, 5, -46, -21, -9, -5, 1, -3, 10, -40, -56, 36, 14, -17, -32, -37, 8, 0, 14, -22, -9, -16, -6, -16,
+  -18, 23, -47, -53, 20, 5, 8, -15, -12, -93, 30, 24, -42, -10, -9, -69, 53, 29, -11, 25, 6, -38, 32, 41, 12, -6, -15, -36, 11, 36, 31, 49,
+  -40, -66, 4, 2, -4, 31, -5, -69, 6, 14, -34, 26, 2, -27, 17, -22, 3, 68, -37, -50, 17, -36, 4, 28, -6, -60, -42, -54, -51, 30, -46, 3,
+  -40, -56, -21, 60, 18, -48, 24, 10, -29, 55, 5, -9, -14, 18, -39, 41, 17, -26, 14, -7, -49, 28, 26, -12, -9, -4, -98, 87, 13, -5, 9, -12,
+  -76, 73, 45, 20, -21, 29, -50, 51, -1, 65, 21, 22, -55, 68, 46, 44, -6, 0, -91, 33, 35, 49, -4, -28, -75, 32, -11, 47, -27, -78, -127, 7,
+  -36, 6, -27, -73, -98, 6, -34, -16, -8, -49, -89, -2, -30, -2, 8, 16, -19, 5, -36, -26, -38, 49, -51, -53, -57, 44, 27, 12, -34, -8, -41, -23,
+  -35, 28, -53, -11, -20, -25, 13, 45, -61, -35, -7, 62, -25, 32, -33, 5, -25, 20, -45, 26, -64, 5, 24, 8, -48, 15, -15, -53, 34, 0, -24, -39,
+  -3, -80, -10, 22, 20, -34, -24, -66, 25, -9, -18, 7, -64, -67, 30, 43, 15, -4, -62, -37, 51, -8, 21, -27, -44, -22, 38, -14, -36, -91, -28, 13,
+  11, 8, 28, -46, 9, 11, 2, 13, 41, -67, -20, -60, 54, 46, 32, -111, 21, -32, -2, 44, -11, -81, 30, -45, 1, 34, 57, -98, 33, 21, -36, -4,
+  -28, -25, 16, -27, 8, 61, -14, -24, 74, -51, 35, 15, 24, 11, 31, 3, -19, -19, 34, -10, -7, -50, 31, 27, 38, -5, -19, -33, 8, 24, 12, 13,
+  6, -45, -3, -23, -10, -65, 42, -12, -13, 2, 23, -62, -3, -34, 53, -48, 46, -61, 23, -70, 8, -36, -15, -33, -2, -45, -6, 3, 38, 1, -9, -11,
+  61, -50, -114, -86, -72, -8, 14, -8, -81, -11, -31, 1, 2, -6, -95, -25, -72, -63, 0, -37, -79, -69, -50, -60, 37, -14, -25, -100, 7, -49, -6, -77,
+  1, -48, -33, -3, -26, -88, -28, -42, 18, -15, 6, -80, -22, 13, 3, -33, -16, -36, -13, -36, -10, -25, 26, -66, -8, -7, 13, -17, 10, -48, -25, -17,
+  -7, -48, 45, -6, -37, -55, 39, -26, 56, -36, -55, -88, 27, 9, -9, 7, -60, -38, 25, -1, 4, 0, -97, -54, 9, -50, 3, -58, -83, -42, 6, -16,
+  20, -30, -84, 36, -26, -9, -29, -12, -35, 11, -27, 18, -37, 15, 18, 75, -42, 27, 23, 21, -45, 18, -4, -24, 33, -44, -35, 32, 8, -33, -34, 30,
+  -51, -22, 28, 46, -8, -1, -50, 8, -21, -20, -14, -41, -123, 40, 34, -23, -4, -9, -79, 46, 12, -28, -38, -9, -105, 8, 38, -2, -38, 11, -54, 57,
+  45, 24, 36, -16, -64, 30, -29, -10, 35, 41, -53, 26, 34, -11, 16, 35, -108, 86, -18, 66, -25, 1, -50, 83, -47, 10, 1, 33, -46, 10, 21, 64,
+  6, -23, -80, 73, -14, 7, 45, -28, -52, 43, 22, 14, 34, -34, -3, -51, -39, 22, 27, -14, 7, -71, 28, -46, 38, -1, 9, -27, -6, 14, 46, -37,
+  -62, -35, 22, -34, 69, 36, -57, 28, 12, -22, 17, 41, -58, -26, -50, 8, -1, -12, 1, 38, 4, 42, 1, -20, -23, 30, -12, 29, 25, -27, 39, 2,
+  17, -47, -15, -63, 0, 8, -22, 18, -6, -5, 2, -44, 71, -58, 58, 32, -16, -19, 22, -10, 49, 46, -30, 57, 9, -12, 23, 8, -29, 59, 46, -11,
+  -19, 28, -59, 40, 35, -27, 23, 23, -10, 79, -3, -42, 1, 9, -35, 39, -31, 29, 24, 27, -27, -25, -36, -10, -1, -14, 20, 5, 35, 11, 22, 18,
+  19, -33, 14, -26, 39, -37, -12, -9, 1, -26, -1, -28, 15, 91, 38, -3, 48, -52, -70, 80, 27, -32, 78, -21, -52, 78, -8, -32, 28, -49, -47, 52,
+  45, -17, 38, -26, -30, 68, 12, 32, 51, 9, -28, 55, 8, 33, 81, -36, -58, 112, -61, -19, 55, -2, -28, 83, -58, -14, 53, 44, 19, 36, -72, 22,
+  48, 26, 28, 99, -12, -8, 49, -7, -15, 80, -16, 43, 45, 53, 17, 66, -27, -22, 53, -10, -20, 59, -6, -46, 51, 51, -30, 49, 14, -63, 25, 41,
+  -29, -5, -2, -41, 47, 42, -25, -31, 14, -72, 68, 56, 32, 19, -30, -64, 48, 71, 12, 16, -13, -56, 42, 1, 24, -41, 37, -44, 40, 10, -16, -8,
+  -28, -92, 64, 11, -11, -19, 33, -88, -14, 15, -20, -5, 62, -96, 44, 40, 32, 11, 51, -83, -3, 3, 7, 3, 77, -59, 32, -4, 11, -43, 46, -47,
+  1, 26, 22, -1, 69, -56, -34, 10, -24, 9, 62, -53, -51, 27, 25, 6, 45, -13, 13, 39, -30, -5, 53, -70, 23, -24, -23, -56, 48, -50, -1, 50,
+  -24, -14, 15, -56, -43, 31, -66, -27, 31, -51, 4, -3, -6, 6, 75, -52, -32, 50, -46, -21, 62, -24, -46, 127, -81, 7, 56, -5, -13, 50, 73, -44,
+  18, -16, -5, -12, 51, -53, 54, 25, 7, 51, 71, -16, 60, -63, 27, 23, -23, 54, 28, -12, -19, -19, 43, -19, 80, -39, 48, 20, 6, -73, 90, -22,
+  36, 2, 5, -32, 87, -15, 36, 19, -22, 39, 54, -27, 46, 37, 50, 54, -11, -17, 56, 43, 27, 19, 1, 17, 47, 21, 1, 36, 90, 2, -6, -26,
+  -13, 45, 37, -25, 50, -16, -37, 49, 18, -42, 1, -18, -3, -9, 22, -12, -27, -31, 44, -13, 29, -14, 7, -20, 13, -41, 70, 52, 10, 63, 15, -19,
+  62, 28, -20, 16, 55, -11, 27, 14, 11, 0, 32, -5, 46, 36, -15, 19, -31, -27, 3, 25, 38, 29, -52, 5, 54, 34, 23, 0, -18, -56, 33, 6,
+  48, -23, 25, -48, 32, 15, -8, -26, 14, 39, -22, 17, 37, 46, -39, 47, 12, 34, 15, -18, -31, -22, 24, 18, -20, -10, -48, -1, 2, 58, -11, 15,
+  -16, 9, -10, 39, 7, -21, -53, 10, 11, 34, 62, -36, 18, 38, 8, 2, -9, 71, 63, -74, 11, -104, -48, 72, 11, -50, -8, -61, -21, 26, 31, -35,
+  -15, -15, -17, 30, -6, 2, -36, -98, -74, 60, -23, 65, -27, -41, -23, 31, -35, 43, 5, -20, 31, 110, 3, 82, 2, -69, 40, 77, -46, 21, -25, -7,
+  75, 14, 29, -29, -16, -12, 37, -2, 6, -61, 68, -89, -36, -33, -31, -49, -37, 3, 16, -45, 6, -14, -8, -27, 10, 5, 19, -47, -51, -21, 16, 79,
+  -22, -49, -18, -38, -65, 83, 49, -26, -60, -71, -51, -7, 9, -47, 16, -13, -19, 49, 17, -6, 6, 28, -20, 20, 30, -59, 4, 37, 4, 69, 40, 17,
+  41, -21, 3, 44, 27, -22, -27, -30, -29, -26, 37, 7, -19, 21, -46, 0, 69, -55, 33, -72, -3, -16, -17, -58, 70, -29, -32, -11, -29, 24, 35, -59,
+  -34, -11, 10, 51, -28, -65, -9, -49, -33, 59, 15, -13, -26, -2, 22, -7, 8, -38, -7, -12, -7, 52, 40, 17, 16, -17, 11, 59, -17, -26, 64, -23,
+  13, 62, -15, -43, -26, 52, -31, 59, 59, -22, -113, -14, -70, 77, 62, 3, -62, 8, -4, 43, -10, 24, -110, 4, -11, 57, 34, -19, -42, -29, -12, 30,
+  36, -50, -70, -21, 8, -17, -13, -13, -80, -31, 41, -74, -9, -18, -4, 80, 57, 47, -12, 37, 41, 38, 53, 7, -47, 5, -46, 30, 38, 37, 16, -49,
+  -9, -2, -14, 60, -1, -7, 6, -14, 33, 68, -9, -55, -28, -36, -25, 43, -2, 1, -33, -48, 41, 80, 20, -3, -28, -23, 25, 72, 35, 44, -43, -43,
+  63, 42, 28, 32, -5, 0, 27, 75, -10, 0, -9, -13, 54, 64, 44, 31, -55, 11, -5, 25, 13, -9, -6, -36, -28, 67, -25, -62, -7, 34, -10, 55,
+  -26, -43, -72, 14, -16, 44, 7, -14, -75, -85, 14, 88, 76, -1, -37, -30, 15, 67, 30, 17, -15, -14, -7, 19, 32, -60, -57, -62, 36, 35, -3, -28,
+  -56, -16, 56, 31, -53, -77, 5, -7, 9, 8, 17, -55, -81, -26, -22, 47, 10, 16, 3, -38, -1, 6, -8, 58, -30, -49, -27, -17, 27, 46, -62, -9,
+  -8, -28, 111, 28, -27, -20, -6, 4, 108, 24, 9, -33, -55, 4, 1, -32, 7, -34, 21, 43, 18, -1, 31, 11, -7, 13, 73, -78, 24, 2, 37, 69,
+  37, -18, 13, -18, -13, 21, 67, -72, -66, -78, -48, 90, -1, -14, -66, -29, 17, -4, 36, -4, 27, -15, -26, -9, 24, -13, -46, -46, 32, -35, 1, -30,
+  -5, 32, -32, 26, -25, -35, 38, 13, -27, -15, -53, 14, -18, 47, 5, -37, -88, 3, 16, -2, -22, 6, 33, -10, 11, 37, -38, -28, -36, -19, 55, 14,
+  19, -76, 53, -18, 50, 22, -64, -67, 29, -22, 51, 12, -53, -24, 43, -30, -1, -15, 45, 20, 29, 16, 38, -40, 7, -15, 57, -14, 6, -31, 33, 19,
+  -17, 40, 8, -48, 17, 60, -6, -9, 39, -40, -13, 58, 15, 51, 76, -50, 6, 45, -17, 43, 105, -4, -55, 80, -13, 26, 87, -11, -27, 65, -62, -42,
+  17, -25, -42, 27, -59, 5, 16, -42, -28, 64, -13, -51, 37, -45, 4, 4, -28, 1, 7, -56, -18, 37, -29, -41, 98, -32, -62, 87, -30, -45, 109, -25,
+  -42, 63, -22, -6, 45, -8, -10, 103, -34, -34, 73, 19, -22, 3, -42, 7, 98, 36, -45, -9, 17, -46, 61, -25, -54, 20, -24, -32, 93, 10, -41, -27,
+  32, 8, 63, 11, -13, 29, 3, -53, 20, -52, 8, -37, -24, 15, 34, 6, -25, -76, -21, 61, 77, 15, 12, -23, -31, -8, 61, 73, -74, -92, 12, 43,
+  59, 63, -84, -86, -3, 7, 30, 45, -71, -98, -84, 102, 49, 32, -67, -36, -63, 56, 40, 23, -14, -79, -72, 78, 14, 50, -46, -114, -112, 3, 53, 2,
+  1, -45, -64, 45, -15, 13, 6, -79, -119, -6, 10, 67, -13, -38, -36, 11, 20, 43, -60, -12, -48, 18, -13, 20, -45, -53, -39, 55, -52, 20, 26, -78,
+  -48, 51, -25, 9, -15, -4, 0, 6, -11, -23, -70, -48, -100, 37, -29, -24, -33, -78, -52, 41, 0, 46, -61, -16, -81, 28, 39, 3, -27, -2, -127, 7,
+  -3, -47, -58, -1, -78, -25, 68, 21, -2, -73, -93, -8, 6, 18, -37, -50, -92, 30, 66, 70, -20, 30, -3, -20, 58, 79, -17, 11, 17, -10, 25, 44,
+  -71, -52, -41, -43, -31, 45, -23, -12, -24, 31, -11, 29, -30, -18, -83, -5, -10, 98, -5, 25, -76, -31, -22, 84, -42, 47, -69, -7, 44, 45, -18, 11,
+  -23, -65, -47, 11, -40, -17, -38, -28, -8, -4, -30, 1, -63, 9, -30, -38, -23, -54, 22, 12, -70, -20, -69, -37, -37, 12, -4, 23, 40, -21, -18, 29,
+  16, 49, -20, -15, -59, 31, 17, 45, 29, 24, -49, 47, -64, -38, 17, 28, -73, 10, -45, 53, 3, 88, -11, 69, -42, 10, -20, 34, -34, -4, -60, -18,
+  1, 97, -36, 13, -45, 16, 27, 119, 10, 58, 15, -7, 10, 35, 35, 26, -66, 6, 59, 77, 17, -9, -21, -84, 40, 32, 83, -27, 10, -26, 83, 18,
+  31, -85, 15, -56, 87, 77, 20, -34, -43, -27, 104, 35, 33, -34, 26, -17, 96, 103, 82, -51, -72, 22, 0, -4, 12, -79, -112, 54, 0, 12, 22, -47,
+  -72, 29, -2, -8, 30, -57, -63, 42, -10, 36, 2, -46, -36, -16, -26, -14, 58, -36, -89, 2, -17, 65, 9, 35, -39, 64, -78, 61, 27, -34, -37, 31,
+  4, 60, -7, 24, -9, 30, -11, 72, 22, 23, -47, 31, 13, 17, -22, 36, -38, 54, 42, 41, -13, -1, -40, -17, -13, 38, 34, 12, -49, 36, -27, -4,
+  -3, -12, 9, -18, -9, -15, 34, 37, 31, -10, -49, 16, -35, 44, 32, -22, -2, -23, 0, 44, -40, -38, 14, -23, -27, 8, -34, -15, 38, -42, 25, -7,
+  -5, -46, -33, -12, 42, 46, -6, -28, 15, -32, 32, 58, -16, 13, 13, -26, 20, 13, 28, -17, -5, 31, 19, -6, 60, -20, 15, -2, 0, 4, 4, 24,
+  50, 18, -18, 53, 29, -39, 51, -4, 6, 50, 48, -13, 6, 1, -29, 1, 36, -15, 24, -36, -43, 48, 35, -2, 43, -31, -3, 21, 85, -2, 21, 3,
+  -27, 9, 89, -7, 24, 24, 5, 9, -96, -26, -60, 58, -52, 23, -127, 25, -93, 55, -86, -7, -111, -65, -81, 100, -71, 5, -84, -45, -90, 39, -47, -19,
+  -104, -14, -49, 55, -45, 3, -32, -36, -80, 60, -47, -30, -20, -1, -99, 47, -42, 53, -61, 8, -15, 2, -30, 37, -8, -6, -59, 91, -12, -10, -22, 0,
+  -62, 74, -45, 62, 25, -5, -21, 61, 9, -21, -31, 14, -13, 45, 3, -25, 11, -18, -68, -7, -19, -8, -22, 18, -11, 56, 33, 6, -41, -7, -71, 0,
+  6, 47, -12, -10, -59, 60, 25, 33, 24, 9, -50, 32, -21, 50, 50, 5, -47, 60, 9, -8, -4, -8, -17, 26, 6, 12, 6, 12, -8, 30, -16, -6,
+  45, 14, -19, -3, 0, 4, -39, 21, 17, 63, -19, 0, -19, 9, -29, 4, -25, 15, -65, -6, -28, 55, -4, -38, -41, -24, -45, 26, -27, 37, -21, 55,
+  -61, -5, 33, -16, -45, 50, -85, 34, -37, 36, -24, 15, -72, 45, -21, 44, -23, 10, -51, 44, 10, -43, -25, -5, -81, 73, -16, 20, -38, 72, -85, 31,
+  -38, 8, -37, 59, -26, 43, -74, -35, 12, 17, -50, 100, -52, -13, -14, 35, -13, 26, -76, -44, -8, 41, -7, 10, -9, -54, 5, 40, -45, -2, -18, -32,
+  39, 54, -50, 33, -7, -6, -15, 31, -61, -7, -1, -38, 68, -26, -36, 16, -21, -3, 6, 41, -4, 40, 36, 26, 7, -28, -64, 80, -50, 17, -7, -8,
+  11, 58, -6, 3, 55, 46, 1, 80, -42, -33, 4, 18, -8, 59, 22, 5, 43, 20, -43, 104, 21, -36, -11, 25, -17, 53, -33, 52, -25, 41, 31, 28,
+  -41, -10, 8, 44, 20, -2, 30, 54, 5, 23, 30, 26, 43, 45, 20, 49, -28, -46, 10, 58, 4, 56, 4, 8, 43, 6, -46, 6, -19, -53, 42, -15,
+  -41, 44, -50, -78, -5, -32, -51, -3, 10, -67, -22, -59, -23, 30, -25, -77, -33, -53, 10, 46, -7, -20, 14, -29, 20, 10, 70, -32, 16, 12, 41, 81,
+  48, -41, -25, -41, 20, 91, 51, -33, -7, 5, -15, 19, 19, -47, 33, -12, -12, 11, 13, -79, 56, -52, -6, 56, -7, -30, 83, -56, -41, 17, 17, -38,
+  62, -78, -6, -11, -5, -42, 8, -28, -68, -13, -38, 3, 41, -16, -16, 31, -16, -36, 45, 0, -50, 48, 19, -40, 68, 15, -14, -21, 39, -19, 4, -33,
+  -74, -2, -13, 9, -7, 20, -89, 26, 16, -80, 63, -37, -98, -10, 1, -33, 46, -46, -48, -12, 58, -57, 14, -7, -75, 31, -7, -53, -1, 26, -94, -8,
+  -32, -10, 82, 10, -39, 3, -62, 7, 83, -13, -69, -26, -42, -43, 77, 28, -7, 4, -5, -13, 43, 3, 18, -12, -11, 14, 28, -34, -45, -43, -39, -13,
+  59, 57, -46, -9, -49, 33, 53, 46, -69, 24, -70, 2, 28, 54, 4, 7, -44, -5, 50, 13, -16, -43, -68, -20, 26, 13, -37, 18, -39, -74, -6, 64,
+  -12, 46, 1, -60, 33, 73, -29, 9, 8, -17, 21, 52, -33, -16, -18, 16, 22, 21, -41, 15, -52, -42, 5, 58, -44, 63, -52, 8, 10, 44, -64, 24,
+  -39, -15, 15, 98, -26, 14, 24, -29, 40, 92, 17, -39, -4, 29, 20, 116, 26, -21, -9, 35, -36, 114, 23, 10, 27, 75, -3, 68, 10, -44, 4, 50,
+  -30, 31, 16, -21, -45, 13, 6, 63, 17, 15, -9, 38, 21, 14, -20, -5, 12, 52, 12, 45, -8, 12, 10, 26, -15, 59, 51, -33, 3, 41, -25, 72,
+  22, 46, -23, -4, -73, 79, -4, 6, 58, 40, -28, 27, -16, -27, -18, 80, -81, -3, 37, 4, -11, 35, -33, 1, 36, 11, 63, 36, -41, -5, -8, 86,
+  17, 40, -60, 57, 25, 91, 15, 78, -18, 38, -18, 49, 69, 44, -51, 0, -25, 31, 25, 53, -22, -18, -2, -20, 40, -15, -37, 9, -40, 20, -4, 22,
+  9, 4, 1, 20, 58, -17, -28, 56, -26, 18, -10, 31, -7, 8, 4, -19, 24, 31, -4, 74, -49, -40, 14, 6, 18, 13, -73, 20, 1, 44, -23, 44,
+  -37, -14, -17, 47, -58, 57, -56, 23, -17, 18, 12, 87, -81, 7, 36, 35, -22, 92, 3, -3, 37, 54, -30, 60, 56, 27, 13, -46, -16, 31, 99, 8,
+  46, 21, 28, 4, 77, 56, -12, -41, 0, -20, 62, 76, 17, -13, 14, 43, -72, 8, -43, 39, 57, 21, 15, -17, -29, 0, 1, 31, 15, 56, -11, -46,
+  77, 57, 7, 24, -19, 29, 73, -10, -26, 58, -10, 50, 39, -12, -4, 36, -56, -29, 95, 44, 25, 29, 5, -4, 63, -69, -53, 19, -26, -1, -4, -1,
+  -48, -30, 22, 18, -33, -22, -62, -16, 40, 15, 45, -49, -10, 63, 10, -37, 31, 24, -71, 64, -42, 45, 38, -1, -55, 67, 32, 3, 22, -43, -29, 42,
+  15, 4, 32, -29, -27, -28, -18, -10, -30, -18, -3, -4, 23, 47, 2, -57, 28, -42, 4, -9, -29, -23, -8, -37, -13, -43, 22, -1, 4, -53, -24, -42,
+  -21, -27, -36, -31, 25, -31, 37, -46, 3, -22, 10, -11, 16, -22, 12, -11, 16, 36, -1, 11, -48, 47, -21, 13, 65, 42, 14, 44, -6, -11, 19, -38,
+  -3, -10, -37, -21, 5, 36, -29, 46, -75, -44, 13, -28, 43, 7, 79, 60, -39, -68, 42, 10, 19, -4, -7, -71, 14, -1, 80, 25, 22, 6, -39, 6,
+  73, -34, -36, -4, 0, 33, 50, 40, -11, -43, -37, -42, 52, 7, 3, -32, -10, -47, 75, 24, 28, -46, 26, -16, 51, 21, 45, 30, 1, -15, 1, -13,
+  23, 20, 16, 29, -28, -44, 16, -33, -18, -40, 18, -63, -21, -35, -8, -1, -36, -9, -2, -32, -31, -39, 45, -41, -21, -12, 21, 41, 56, 24, -67, 63,
+  6, 47, 50, 25, -7, 19, 14, -39, 14, -37, -15, 6, -10, -50, -39, -11, -13, 4, -10, 12, -33, -16, -17, -7, 7, -37, -36, -42, 11, 3, -36, 23,
+  -26, 18, -13, -4, -49, -15, -43, -3, -45, 16, 6, 14, 6, 18, -41, 8, -9, -17, 0, 2, 16, -21, -8, -30, -16, -18, 19, -53, -14, 11, 46, 22,
+  -41, -50, -42, -40, 49, 17, -50, -43, 8, 20, 11, 49, -7, 10, 36, 2, 2, -7, -89, -35, 42, -44, 12, 20, -29, -32, -1, -52, 36, 36, -70, 8,
+  30, -41, 79, -44, 1, -70, 65, -56, -8, 2, -12, -69, 96, -10, 43, -50, -13, -44, 100, -24, 15, -17, -19, -42, 96, 60, -20, 45, 4, -5, 95, -3,
+  16, 55, -4, -2, 68, -8, 25, -22, -36, -7, 91, 44, 5, 47, -7, 2, 5, -1, 33, 35, -57, -59, 49, -43, -3, -15, -57, -57, 68, -34, -58, -51,
+  -10, 0, 127, -21, -60, -11, -37, -30, 107, -31, -14, -26, -50, -67, 84, 56, -7, -2, -105, -39, 91, 25, -53, -39, -109, 1, 60, -70, -6, 41, -38, 6,
+  77, -18, 18, 24, -47, -16, 119, -60, 0, 53, 6, -18, 59, -1, 70, 23, -1, -22, 92, -30, 58, 40, -11, -76, 85, -77, 46, 25, 3, -83, 16, -104,
+  1, -20, -22, -59, 22, -99, 8, 18, -31, -23, 34, -93, -6, -35, -33, -22, 41, -80, -22, -52, -55, -11, 0, -12, 29, -22, -35, 68, -32, -15, 50, -66,
+  -63, 28, -37, -26, 34, 4, -62, -25, 13, 18, 74, 46, -86, 43, 24, 16, 29, 52, -52, 57, -27, 49, 4, 58, -72, 37, -10, -33, 4, -14, -96, -23,
+  -13, -8, 52, -25, -35, -34, -45, -9, 52, 32, -31, -26, 14, -21, 49, 19, -23, -8, 29, -28, 39, -13, -66, -42, 31, 21, 82, 5, -27, -36, 36, 68,
+  -11, 0, 50, 36, -52, 60, 20, 7, 53, 41, -46, 13, 28, 37, 31, 18, 14, 26, 26, 6, 15, 62, 38, -3, 46, 70, 43, 51, 46, 70, -25, 17,
+  16, 13, -9, 40, -23, 9, 59, -9, -6, -4, 38, 44, 69, 7, 13, -10, -29, -23, 18, 18, -30, 28, 27, -51, 39, 36, -10, 72, 2, -11, 9, 31,
+  -13, 69, 4, -54, -9, -6, -51, -9, 15, -35, -9, -53, 17, 7, -24, -55, 50, 21, -24, 9, 48, -25, -7, -34, 21, -3, -4, -18, 31, -34, 6, 46,
+  -11, 0, -44, 21, -9, 9, 3, -29, -17, 48, 45, 41, 64, -34, -5, -2, -11, 38, 27, -63, 3, 16, 65, -47, 79, -13, 52, 11, 35, -38, 70, 6,
+  8, 15, 48, -25, 39, -43, -13, -39, 34, -20, -35, 21, 2, -66, -5, -24, -64, 25, 12, -51, -17, -36, -1, 15, 17, -24, -24, -53, -78, 0, -49, -9,
+  55, -8, 7, -33, 0, 27, 24, 32, -31, 39, -45, 11, 10, 9, -57, 18, -8, 46, -42, 59, -55, -1, 35, -8, -44, -1, -14, 31, 15, 38, -34, 73,
+  -1, 44, 18, 5, 22, 4, -40, 16, 33, -19, -48, 62, 2, 57, -16, 34, -40, 17, 14, -20, 11, -23, -20, 20, -50, -15, 59, -24, -18, -5, -27, 47,
+  -16, 51, 45, 24, -35, 50, 27, -51, -40, 8, -39, 34, -11, -32, 6, -16, -28, 26, -5, -35, -38, 5, 3, -55, 6, -7, -22, -14, -36, -54, -28, 27,
+  -12, -27, -18, -6, 8, -5, 14, 31, 0, 9, -19, 39, -56, 17, -1, -67, -58, -9, 35, -8, 50, -44, -2, -11, -7, -1, 42, -69, -13, 46, 6, 51,
+  -9, -49, -12, -1, -13, 76, -33, -53, 22, 25, -11, 16, 21, -22, 21, 0, -8, 14, -2, -79, 58, 36, -41, 63, -47, -21, 15, 2, -43, -52, -55, -10,
+  -44, -39, -32, -56, -75, -17, 6, -62, -19, -45, -33, 19, -36, -73, 11, -60, -14, -25, -14, -27, -9, -44, -12, -7, -94, -49, 12, 18, -31, -58, -46, -69,
+  -3, 60, 34, 1, -98, -47, -25, 18, 19, -12, -43, -98, 50, 8, -20, -25, -89, -61, 42, 52, -8, -8, -24, -18, 22, 48, 73, -34, -68, -56, 41, 29,
+  20, 27, -13, -55, 18, -33, 32, 44, 44, -29, -23, -23, -24, 7, -33, -28, 2, 3, 6, -61, -34, -26, 25, 0, 20, -63, 11, -45, 32, 34, 18, -21,
+  -27, -31, -16, -25, -15, -26, 27, -72, -45, -65, -9, -62, -16, -47, -42, -53, -23, -44, 3, -47, -51, -5, 24, -28, -3, -91, 12, -86, -22, 34, 40, -87,
+  0, -78, 15, -39, -9, -66, -6, -27, -22, -19, -4, -43, -24, -37, -4, -32, 34, 18, 47, -5, 32, 17, 46, 21, 0, -6, 26, -16, -21, 49, -5, -9,
+  22, -5, 33, 11, 20, 11, 5, -43, 26, 28, 26, -14, 27, -10, -52, -20, -32, -43, -41, 39, -26, 51, 13, -10, -21, 2, -8, 18, -17, 26, -25, -13,
+  -18, -26, 54, -2, -14, 28, -36, 2, 0, 40, 13, 66, 5, -18, 7, 5, -43, 12, -12, 17, 53, -32, -35, 29, 55, 18, 3, -2, -39, -25, 22, 24,
+  -17, 0, -71, -23, -8, -22, -6, -26, -30, -62, 40, -28, 4, -69, -9, -40, 45, -13, 36, -9, 22, -46, 14, 36, 40, 20, -31, 7, 37, 14, 16, -31,
+  -35, -7, -19, 9, 28, -36, 29, -13, 31, 23, -1, -21, -15, 33, -4, -9, 21, -17, 7, 32, -14, 52, 0, -5, -32, 3, 35, -19, 30, 2, -33, 24,
+  19, 13, 44, -58, -42, 24, 13, -37, -19, -21, -26, 14, 14, 17, 41, -4, -4, 50, -18, 56, -27, -20, -39, 20, -17, 21, 13, -52, -29, 32, 44, 78,
+  68, 22, -31, 36, 24, 34, 15, 10, 12, 44, 43, 82, 79, 10, 29, 1, 51, 61, -2, -40, 15, 18, 20, 21, 3, -9, -20, 20, 53, 55, 13, -86,
+  -38, 39, 71, 40, 24, -67, -37, -27, 108, -4, -4, -95, -10, 10, 65, 44, -27, -107, -56, -22, 81, 41, -24, -61, -4, 57, 11, 68, -13, -10, -53, 86,
+  33, 54, 33, -38, -25, 78, 19, 47, -28, -71, 29, 20, 11, 37, 37, -44, 34, 74, 62, 66, -23, -81, 36, 14, 29, 78, 22, -91, 29, -4, 48, 37,
+  -3, -22, -50, -5, 49, 62, -16, -35, 36, -19, -4, 80, -63, -6, -39, 10, 13, 18, 4, -51, 12, 2, 56, 44, 13, -15, 15, -11, 32, 61, 38, 28,
+  15, 25, 63, 61, -37, -30, 63, 67, 36, 60, -9, -4, -4, 86, 15, 62, -20, -40, -5, 3, 67, 46, -7, -15, 12, 33, 60, 58, -52, -29, -25, 9,
+  15, 20, -59, -9, -28, 65, 26, 36, -25, -2, -32, 41, 43, 59, -21, -24, -17, 49, 55, 42, -8, -14, -7, 29, 51, 26, -44, 33, -8, 9, 18, 39,
+  -31, 61, 5, 13, 56, 98, 0, 38, -36, 80, 12, 72, -48, 8, 0, 90, -21, 12, -37, 13, -20, 32, -6, 21, -29, 15, 24, 75, -2, 8, -69, 8,
+  17, 58, 66, 43, -40, -23, 48, 14, 45, 23, -103, -5, 19, 41, 50, -20, -38, -23, -25, 53, 41, -5, -42, -26, 51, 61, 26, 40, -89, -41, -17, 43,
+  42, 30, -50, 2, -35, 24, 50, 26, 11, -19, 13, -12, 7, 70, 8, 7, 18, -14, 43, 69, 22, 60, -7, -3, 3, 71, -57, 19, -6, 14, -48, 80,
+  -70, -21, 7, 31, -8, 52, -29, 14, -42, 35, -55, 35, -72, 17, 12, 82, 5, -7, -30, -32, 28, 76, -7, 46, -42, 3, 46, 27, -18, -13, -21, 34,
+  6, 7, -37, -14, -4, 72, -6, 42, -22, 33, 3, 26, -21, 59, 27, -5, -46, 43, -57, 93, -3, -20, -26, -19, -47, 49, -27, -34, -46, 26, -87, 103,
+  -47, 7, 15, 18, -5, 36, -51, 2, -25, 54, -7, 42, -34, 31, -70, 77, -30, -18, -45, 55, 2, 95, -45, 26, -40, -8, -14, 32, -68, -34, -39, 54,
+  -45, 122, -53, 15, -52, -3, -49, 77, -57, 20, -12, -68, 5, 93, 83, -30, -27, 17, -58, 72, 12, 43, -12, 51, -75, 65, 21, -10, -16, 28, -2, 35,
+  19, 6, 22, -19, -17, 39, 75, -20, 11, 23, -6, -23, 55, -86, -20, -50, -22, 33, 16, -44, 16, 45, 2, 17, 30, -47, -21, 2, -60, 23, -31, -72,
+  9, 4, -8, 20, -13, -43, -50, -14, -61, 39, 45, -64, -32, 2, -6, -19, -3, -56, 19, -17, -52, -25, 10, -35, -49, 5, 13, 25, 53, -57, 3, -34,
+  -11, -16, 5, -27, -48, 11, -56, -28, 1, -27, 2, 32, 29, -48, 44, 45, -46, 6, 22, -27, -15, 21, -59, -9, -26, 43, 32, 10, -29, 1, -52, 32,
+  20, -42, -72, 16, -38, -20, -6, -16, -42, -52, 16, 17, 5, 14, -90, -6, 35, -42, -6, 31, -31, -22, 25, 18, 28, -21, -88, -37, 15, 44, 33, 21,
+  -111, -96, 28, -26, -3, 16, -39, -100, 22, -18, 4, 65, -101, -62, 18, 76, -28, 71, -40, -53, -23, 22, 10, 24, -34, -93, -18, 25, -25, -17, -25, -127,
+  -23, -60, -28, -28, 0, -11, 18, -13, -27, -6, -18, 31, 30, -31, -50, -20, -35, 19, 18, -5, 2, -5, -22, 33, 60, -3, 2, -15, -55, -25, -7, 31,
+  -31, -66, -48, 6, 32, 13, -39, -48, -20, -24, 21, 7, -14, -57, -57, -22, 1, -14, 30, -50, -25, -65, -21, 20, -25, -51, -11, -43, 30, 1, 18, -51,
+  -62, -19, 22, -25, -8, -68, 12, 3, 12, 40, -31, -81, -33, 3, 21, 27, -10, -87, -14, -8, -13, -34, -27, -74, -33, -8, 0, -1, -19, -127, -17, -15,
+  -10, -9, -23, -75, -2, -24, -19, 17, 29, -35, -43, -28, 4, 29, 30, -83, 28, 4, -16, -15, 21, -66, -9, 18, 28, 25, -12, -37, -17, -13, 22, 9,
+  40, 2, -39, 10, -21, 17, 21, -52, -46, -5, -14, -15, 32, 17, -50, -38, -2, -18, 28, 8, 6, 7, -1, -44, 34, -34, -4, 10, 35, -10, 12, 6,
+  -48, -26, -17, -2, 1, 0, -1, -46, -3, 18, 28, 39, -32, -10, 20, -16, 29, 30, 2, -7, 0, 8, -28, 48, -34, -19, -22, -11, 1, 43, 4, -10,
+  -21, -6, -35, 43, -15, -8, -44, -41, 7, 63, -37, -26, -3, -2, 20, 36, -3, -48, -61, -51, 3, 11, 15, -41, -14, -40, 6, 25, 47, -34, -81, -43,
+  14, 11, -4, -59, -31, -22, -13, -20, 45, -34, -43, -93, 4, -32, 15, 13, 7, -25, -27, 10, 5, -31, 4, -37, 7, 4, 63, -38, 12, -20, -20, -7,
+  63, -31, 16, -44, -7, 50, -5, 7, 9, -15, -14, 61, 9, -27, 16, -20, -34, 104, 19, -40, 3, 16, -6, 100, -17, -29, -25, -36, 7, 88, -5, -9,
+  -7, -27, 61, 103, -1, -24, 17, -79, 62, 77, -25, -7, -14, -31, 14, 19, 8, -2, -20, -2, 17, -9, -19, -13, -28, -19, -20, 42, 23, -26, 1, -66,
+  -4, 32, 8, -10, 5, -73, -6, 24, 53, 25, -23, 4, -10, 46, -6, 7, -5, 19, 25, 11, -11, 23, -15, 8, -8, 78, 1, -24, 14, -5, 11, 77,
+  25, -31, 34, 4, -21, 55, 38, 20, -21, -41, -60, 48, 14, 35, -50, 3, -31, 42, 27, -12, -2, 14, -44, 3, 58, -22, -11, -21, -33, -52, -13, -33,
+  -6, -5, 18, -41, -18, -12, -26, -17, -20, -13, -13, -36, -47, -1, -34, -38, -11, -10, -25, 22, -25, 7, 3, 8, 11, -15, -47, -16, 33, 19, 38, -37,
+  -31, -9, 16, 4, -12, 2, -26, 35, -8, -5, 2, -2, -23, 18, 34, 38, 38, -9, 35, -2, -8, 9, 34, -52, -21, 48, 1, 6, 50, -19, -15, 4,
+  29, 35, 15, -2, -19, 41, 10, -26, -28, 45, -27, 28, -16, -10, -33, -4, -24, 14, -20, -25, -26, 53, -44, 45, -50, -27, 2, -8, -43, 24, -5, 27,
+  -9, -3, -28, 76, -53, -36, 3, -17, -42, 73, -10, -6, 3, -28, -34, 61, 18, 13, -37, 12, -12, 41, -19, -1, -17, -27, -3, 51, -33, -28, 14, -11,
+  -27, 41, -27, -13, -28, 20, -35, 26, -10, -41, 12, 51, -10, 39, -58, -28, 13, 24, -10, 25, -18, -19, 24, 30, -29, 37, -64, -10, 9, 47, -6, 9,
+  -19, -26, -20, 76, 7, 14, -35, 1, -16, 69, -44, 14, -44, -3, 9, 11, 0, 44, -71, -43, 4, 56, -1, 6, -33, -43, -28, 16, -31, 18, -42, 6,
+  7, 25, -14, 18, -34, -41, -17, 52, 5, 23, -49, -43, -31, 72, -5, -19, -17, 0, 10, 25, 36, 5, -45, -51, 20, 18, -4, -3, -34, -46, -34, 23,
+  -20, -2, -34, -59, -10, 17, 25, -53, -16, -54, -30, 55, 2, 0, 7, -22, -37, 36, -13, -30, 10, -6, 13, 45, 20, 12, -31, -7, 35, 29, 39, -3,
+  11, -40, -17, 13, 11, 6, 36, -53, 21, 8, -13, 70, -3, 7, 18, 35, -24, 12, 7, -11, 28, 21, -33, 10, -14, 18, 32, 65, -3, 18, 25, -18,
+  20, 70, 8, -13, 20, -22, 43, 35, -27, -11, 16, 22, -21, 20, -7, -13, 30, -33, 0, 76, -29, -29, 13, -37, 3, 73, 17, -37, 32, -27, -23, 70,
+  6, -14, 53, 6, 21, 72, 21, -18, 42, 12, 7, 61, 2, 37, 68, -19, -1, -24, 61, 2, 39, -9, 22, 9, 55, -65, 47, 14, -15, 15, 21, -54,
+  53, -7, -12, -40, 19, -18, 50, -40, -5, -3, 15, 21, 45, -26, -2, -25, 36, -28, 66, -1, 43, 8, 15, -17, 61, -5, -1, -5, -1, -18, 59, -41,
+  -22, 52, 58, 16, -9, 6, -9, 4, 19, 23, 33, -44, 4, -13, 58, 28, 12, -16, 19, -20, 31, -7, 10, 22, -12, -24, 29, 11, 1, -36, 7, 50,
+  -15, -29, 38, 5, 48, -4, 16, -33, 24, -3, -6, 51, -3, -43, -17, -16, 38, 60, 4, -46, -3, 20, 14, 36, 55, -50, 24, -12, 1, 39, 4, -72,
+  55, -5, 20, 11, 18, -55, 76, -20, 44, -45, -21, -53, 82, -2, 34, -10, 5, -81, 54, -26, 19, 0, 0, -58, 70, 21, 10, -55, 4, -66, 30, 5,
+  -52, -10, -9, -55, 40, -31, -34, -28, -8, -67, 73, 27, -31, -29, -56, -64, 23, 17, -26, -41, -16, -61, 26, 25, -55, -28, 16, -13, 25, 23, -15, -15,
+  -30, -3, 86, 22, -87, 36, -31, -54, 71, -88, -31, 12, 6, -1, 14, 4, -38, -47, -1, -3, 71, -31, -68, -65, 41, 23, -3, -36, -12, 12, 32, 2,
+  50, 16, -49, -23, 15, 76, 6, 37, -22, -21, 15, 38, 30, 29, -50, -67, 11, 13, -22, 33, -58, -72, 25, -7, -25, 38, -55, -31, 43, 67, 26, 30,
+  -7, -45, -14, 36, 62, 5, 50, -29, -36, 3, 48, 49, -34, -13, -59, 30, 92, 29, -29, -3, 8, -27, 91, 64, -5, 10, -3, -55, 84, 70, -28, -7,
+  -40, -88, -16, 31, 8, 42, 2, -63, -1, -6, -46, 21, 29, -68, 10, 19, 31, 46, 39, -37, 7, 82, 31, 39, -10, -107, 39, 27, 4, 40, 25, -110,
+  -21, 53, 74, -6, 37, -11, 19, 32, 16, 40, 2, -23, 0, 20, 57, -30, 44, -36, 14, 57, 81, -2, 21, 30, 13, -19, 31, -36, 38, -34, 29, -4,
+  73, -8, 11, -4, 14, 11, 23, -28, 48, 2, -86, -11, 82, -7, 87, 27, -8, -32, 79, -93, 64, 3, -61, -9, -24, -27, 9, 2, 11, 34, 28, -45,
+  -55, 9, -30, 6, -29, -52, -17, 10, -38, -7, -6, 2, 17, -36, -29, 2, 38, -71, -17, 32, -4, 40, 15, -72, 27, 46, -70, -5, -20, -6, -34, 23,
+  -29, 47, 22, -61, 49, -23, -30, -6, 43, -39, 11, 20, -55, 7, 59, -48, 12, 32, -7, -31, 55, -15, 69, 58, -85, -15, 21, -45, 7, 32, -19, 5,
+  56, 11, -10, -2, 30, -9, 81, 37, 41, -14, 21, 42, 53, 34, 14, 15, -27, 22, 27, 54, 29, 3, -51, -46, 2, 10, 14, -54, -9, 16, 7, 50,
+  -5, -52, -35, -37, 57, 34, -31, -2, -33, 33, 12, 40, 53, 46, 4, 35, -21, 26, -4, -23, 63, 7, -25, 58, 4, 32, 14, 52, -15, 29, -36, 17,
+  20, -16, -10, 62, -112, 0, 49, -4, -12, 1, -115, -3, 76, -27, 11, -26, -76, -35, 7, 6, -5, -16, -63, -25, 55, -63, -17, -43, -86, -11, -8, -54,
+  -89, -41, -28, -53, -37, -35, -58, -20, -50, 17, -30, -1, -42, -90, -34, -19, -9, -31, -82, -66, -47, -25, 26, -65, -34, -59, -9, 30, 46, -1, -28, -38,
+  -75, 14, 27, -38, -62, -62, -25, 78, 8, -59, -65, -16, -13, 14, -2, -62, -13, -59, -21, 71, -60, -2, -36, -37, 24, 8, 3, -5, -44, -26, -67, 31,
+  17, -12, -29, -9, -55, 49, -13, -18, -72, -58, 10, 16, -42, -7, 1, -10, 32, 25, 2, -34, -54, -8, -19, -44, -5, -4, -42, -36, -71, 7, 25, -59,
+  32, 11, -59, -57, 91, -62, 21, 57, -51, 8, -27, 68, 54, 32, -85, -1, 16, 52, 37, -13, -29, 26, -40, 69, 24, -24, 14, 67, -92, 42, -16, -26,
+  9, 66, -80, 78, 43, -2, 39, 57, -20, 86, -34, 21, 44, 76, -27, 99, 8, 31, 0, 62, -58, 127, 13, 70, -2, 44, -2, 77, 52, 75, 49, 29,
+  -35, 42, 34, 59, -7, 35, -6, -8, 23, 22, 5, -33, -39, -14, 55, 1, -14, 22, -15, 64, 28, -8, 22, -17, 12, 45, 31, 35, 3, -40, -14, -9,
+  27, 1, 47, 24, -5, -9, 19, -22, 5, -17, -57, -13, -22, 4, 40, -2, -67, 22, -15, 8, 40, 13, -1, 48, -6, 54, 16, 44, -54, 34, 8, 32,
+  -9, 9, 6, -38, 30, 44, 9, -24, -93, -63, 5, 5, 17, -13, -46, -27, 9, 41, 34, -16, -19, -69, -8, -29, 8, -38, -47, -20, -53, -37, 38, -6,
+  -19, -3, -8, 47, 76, -51, -31, -23, -49, 2, 12, -13, -1, -42, 15, 39, 38, -92, -6, -19, 44, 17, 59, -82, -4, -25, -16, 17, 39, -35, -68, 12,
+  -2, 25, 0, -59, -45, -20, -41, 13, 51, -43, 5, 4, -33, 63, 4, -96, -52, 8, -39, -3, 58, -112, -64, -1, 6, -2, -10, -127, -55, 11, -48, 25,
+  14, -60, -41, -12, -23, 33, 3, -38, 17, -46, 7, 51, 27, -1, 58, -30, 7, -5, -9, -12, 56, 44, -28, -9, -21, -8, 40, -18, -10, 2, -8, 40,
+  -6, 3, -3, -22, 33, 36, 4, -14, 13, 2, -50, 41, -20, 31, -17, -12, -16, 90, -56, 7, -69, -28, -6, -13, 3, -10, -48, -44, -18, -2, -7, -8,
+  -61, -41, -24, 1, -7, 1, 16, -21, -4, 17, 13, 7, 5, -45, 8, 14, 31, -1, 1, -30, -6, 13, -12, 29, 13, -17, -31, -15, 45, -5, 10, 0,
+  16, -40, -8, -16, 0, 5, -18, -33, -17, 26, -39, 48, 33, -20, 23, 47, 37, 63, -6, 19, -4, 57, 51, 33, 2, 48, -43, -5, 43, 4, -28, 36,
+  -32, 25, 6, 51, 19, 62, -22, 38, 11, -3, -13, -32, -24, 37, 20, 26, 22, -4, -54, 9, 39, 36, 36, 22, -8, 29, -57, 38, 25, -28, -28, -18,
+  3, 45, -46, -66, 16, -49, 10, 7, -5, -26, 24, -30, -3, -13, -11, -71, 25, 18, -32, 42, 5, -66, -36, 25, 55, 27, 28, 8, -5, 35, 9, 17,
+  34, 56, -8, -11, -49, -18, 45, 6, -16, 31, -13, 27, 11, 9, -35, 73, -28, 17, 27, 40, -18, 15, -2, 17, 21, -11, -26, -24, 31, -24, 42, 1,
+  63, 30, 37, -29, 35, -67, 28, 12, -81, 52, 48, 34, -47, -6, -72, 53, 82, 29, -45, 29, -24, 31, 49, 16, 2, -46, -53, 15, -1, -46, -48, -30,
+  -21, -6, -2, 6, 17, -3, -24, 85, 1, -39, -57, -14, 20, 5, 42, -55, 2, -56, -9, 62, 67, -59, -65, -55, -40, 0, 12, -14, -32, -62, -34, -25,
+  17, -17, 22, -10, 72, -10, 29, -33, -69, -63, 20, -26, 0, 4, -27, 34, 47, 18, 41, -20, -57, 16, -14, 28, -20, 2, -11, 9, 17, 14, 30, -35,
+  26, 22, 19, -31, 30, -46, -29, 17, 32, 14, -58, -48, -17, -13, 49, 52, 23, -10, -67, 3, 40, 16, 54, 36, -64, 23, -26, 47, -9, 19, -63, 12,
+  -42, 67, 59, 56, -23, -25, 11, -11, 89, 0, -8, -92, 8, -43, 73, 33, -18, -36, 20, -55, 39, -12, -17, -54, 37, 3, 50, 47, -14, -48, 44, 16,
+  21, 69, -16, -17, -9, 2, 100, 45, -15, -7, 50, -9, 67, 25, -15, -29, 22, 20, 29, 56, -3, -45, -7, -2, 46, 64, 57, 1, -89, -35, -1, 16,
+  -34, -65, -81, -8, -75, 98, 35, -20, -44, 21, -56, 72, -3, -19, -31, -40, -42, 46, -44, -7, 1, 21, 27, 22, -31, -63, 10, -46, 23, -1, 12, -24,
+  -3, 1, -55, 32, -1, -6, -43, 61, -46, 21, 7, -28, 64, 52, -54, 4, -30, -26, -28, 18, -5, 3, -60, 6, -10, -3, -15, 16, -25, -26, -1, 1,
+  -3, -86, -35, -47, 56, -31, -5, 1, 7, -7, 12, 50, -2, 2, 35, 4, 45, 68, 25, -12, 30, -23, 57, 33, -38, -71, -3, -26, 22, 9, -80, -66,
+  12, 2, 29, 43, -44, -39, -59, -21, 34, 18, -31, -69, -60, -38, 41, 95, 18, -35, -15, -26, -45, 73, 6, -49, -47, -56, -7, 25, -7, -57, -12, -26,
+  1, 70, 47, 9, 20, -45, -50, 21, -25, 81, 1, -58, 34, 29, 16, 59, -17, -43, 21, 11, 46, 21, 2, -88, 37, 9, -29, 47, 25, -81, -9, 29,
+  3, -3, -1, -37, 20, 25, 22, 2, 55, -44, 2, 84, -12, 4, 49, 40, 30, 58, -64, 75, 76, -19, 42, 65, -58, 46, -20, 23, 2, 35, -35, 74,
+  -30, -33, -25, 6, -39, -17, -20, 20, 36, 53, -44, 19, 17, -43, -14, 29, -62, -4, 15, -33, 44, 64, -10, -25, -49, 5, 36, 61, -65, -38, -21, 41,
+  46, 111, 9, 19, -48, -29, 42, 101, 0, -17, -33, 9, -39, 41, 5, -18, -52, 31, 9, 90, -78, 8, 14, 16, 51, 64, -74, 62, -20, 46, -4, 41,
+  0, 40, -22, 40, 12, 45, -56, 127, -56, -26, -56, 73, 2, 21, -35, 29, -51, 58, -65, -8, -29, 30, -25, 5, -63, -9, 6, 42, 17, 48, -52, -25,
+  38, -25, 7, 31, -83, -28, 37, -8, 6, 25, -41, -20, 7, 55, -42, 66, -47, 34, -30, -38, -30, 31, -9, -31, -20, 39, -45, 54, -19, 75, 29, -21,
+  42, 30, -62, 30, -2, 15, -23, 11, 30, 19, 43, -21, 21, 12, -7, 21, 1, -44, 2, 66, 26, 41, 67, -42, 78, -13, -27, -28, 1, -38, 92, 0,
+  5, -20, 54, -96, 46, -38, -42, -38, 2, -59, 28, -18, 3, 71, 33, 3, 34, -58, -42, 6, 104, 11, 0, -28, -10, 24, 122, 31, 56, -12, -62, -23,
+  56, -22, 50, 36, -69, -11, 109, 31, 37, -15, -67, 19, 53, -28, 6, 34, -83, 11, 53, 31, 51, 35, -18, 11, 48, 3, 36, 24, -25, 48, -10, 45,
+  24, 3, -12, 37, 35, -2, 46, -34, -13, 59, 48, -11, -6, -34, 43, 7, 96, -18, 69, 15, 3, 74, 46, 45, 71, 26, 14, 34, 63, 24, 9, -13,
+  5, -53, 91, 38, 22, -6, 12, -45, 125, -34, 86, -32, -23, -32, 81, 20, 84, 15, -58, -34, 86, 24, 27, -41, -12, 30, 124, 38, 70, -37, 11, 30,
+  122, 48, 25, 60, -65, 20, 83, 67, 61, 12, -14, 3, 113, 13, 24, 30, -1, -28, 44, 48, 94, 7, 28, 30, 100, -17, 33, 22, -65, 26, 43, 39,
+  59, 12, -41, 15, 40, 6, 69, -12, -14, -33, 62, 64, 32, -2, -101, -6, 75, 64, 66, 39, -87, -28, 35, 70, -39, -17, 74, 3, 6, 56, -43, -37,
+  52, -14, -16, 33, -39, -50, 88, 17, 18, 51, -28, 6, -4, 80, 45, 56, 39, 7, -26, -16, 18, 45, 14, -18, -42, -100, 80, -19, 30, -58, -6, -108,
+  22, 36, 49, -7, 15, -45, 38, -7, 11, 9, 6, 8, -62, -6, 19, 7, 17, -10, -39, -16, -22, 16, 56, 43, -8, -8, -18, -4, 39, 60, -18, 48,
+  27, 11, -19, 64, -35, -3, -21, 21, -7, 12, -18, 48, 17, 4, -22, 7, -15, 62, 26, 83, 6, -58, -44, 12, -24, 62, -13, -33, -37, 48, 37, 84,
+  -41, -33, -39, -3, 21, 61, -7, -15, -38, 7, -8, 36, -53, -48, 25, 56, -7, 21, -10, -64, -18, 73, 17, 11, -64, -51, -31, 63, -35, 54, -7, -17,
+  -24, 100, -16, 22, -18, -39, -29, 68, -16, -1, 21, -41, -71, 28, -21, 31, -40, -84, -21, 24, 1, -41, -31, 7, -53, 42, 9, 1, 16, -67, -32, -11,
+  -6, -70, 18, 25, 33, 37, 40, -57, -5, 44, -28, -33, -60, 22, 54, -3, 9, 3, -11, -24, 45, 38, -29, -15, -58, -4, 37, 26, -28, 9, -37, 24,
+  1, -15, -43, 9, -26, -13, 26, 17, 33, -34, -27, 16, 40, 7, -25, -41, -6, -37, -25, -2, -51, -47, 14, 27, 3, 34, -20, -23, -18, 37, 13, 36,
+  -16, 31, -35, -24, 32, -17, 12, 29, 16, 19, -30, 10, 9, 17, -22, 10, -22, 34, -26, -40, 26, -43, 6, 34, -58, -44, -16, -13, 12, 13, 10, -44,
+  -8, -15, -13, 27, -11, -70, 21, 3, -17, 8, -40, 5, 11, -30, -26, 26, 20, -20, 46, -27, -3, 22, -6, -23, -9, 10, 23, 10, -2, -18, 42, -16,
+  -17, -57, -9, 4, 58, 14, 20, -17, 13, 28, 67, 7, 26, -34, -2, -17, 35, -22, 30, -71, 24, -18, -18, 2, -20, -4, 4, -53, 49, -13, 55, -39,
+  28, -5, 41, 9, -10, -31, 18, -42, 52, -21, 9, -35, 10, 27, 22, 32, -8, -21, 10, 40, 45, 33, 8, 2, -13, 22, 22, 31, -12, 6, -46, 22,
+  127, -20, -18, -63, -27, -17, 80, -22, -75, -41, -71, 37, 80, 36, -20, 9, -40, 17, 33, -14, 0, -17, -116, 30, 98, -4, 9, -12, -56, 33, 64, -27,
+  -15, -32, -44, -3, 106, 12, -21, 18, -38, 45, 95, -10, -101, 9, -59, 40, 58, -10, -67, -17, -119, 30, 18, 40, -41, 29, -103, -5, 52, -18, -71, 31,
+  -76, -5, -2, -16, -80, 14, -85, 24, 47, 14, -8, 1, -119, 0, 18, -8, -58, -5, -71, 35, 55, 35, -90, -37, -8, -13, 24, -12, -103, 0, -13, -22,
+  -16, 5, -73, -49, -15, 37, 34, -42, -90, -20, -66, 6, -45, -26, -58, -42, -90, 0, 4, 14, -59, -27, -6, -21, -40, 4, -62, 2, -22, 24, -58, -47,
+  -14, -17, -40, 0, -78, 11, -57, 53, -34, 17, -61, -31, -1, 53, -66, -16, -2, -23, -15, 8, -49, 6, -7, -10, -53, -13, -69, -1, -4, 27, 6, 26,
+  0, 5, -53, -13, -68, -5, -54, -42, -25, -26, -26, 33, 11, -29, 15, 20, -35, 9, 8, -50, -45, -9, -83, -16, -9, 7, -10, 22, -50, -7, -29, -49,
+  -29, -23, -58, 3, -10, 0, -4, 30, -37, 14, -24, -72, -39, -5, -7, 30, 1, -71, -17, -21, -12, -7, -28, -10, -33, 41, -2, -12, -10, -54, -40, 21,
+  32, 34, -37, -27, 20, 55, -25, 41, -29, 20, -42, 27, -18, 19, 27, -51, -3, 36, 5, 3, 16, -29, -50, 11, 12, -15, -8, -30, -29, 49, -48, -32,
+  47, -32, -22, 26, -19, 23, 12, -32, -10, -4, -36, 13, -23, -31, -28, 14, 45, -53, 16, -50, -2, 59, 66, -64, 38, -52, -5, 43, 60, -53, 8, -14,
+  -50, 23, 76, -3, -13, -6, -59, 14, 46, -16, -29, -7, -17, -18, 2, -2, 33, -12, -66, 52, -12, -42, 48, 14, -55, 33, 28, -47, 9, -42, -45, 4,
+  19, -38, 52, -17, -15, 16, 10, -6, 20, -44, -27, -36, 10, 34, 9, 9, -3, -3, 11, 20, -7, -32, -33, -1, 15, -5, 3, 0, -39, 14, 45, -21,
+  -32, -75, -41, -52, 50, 34, 47, -66, 1, -56, 71, 26, 38, -13, -47, -4, 29, 7, -5, 6, -2, -45, 31, 56, 67, -14, 18, -10, 23, 41, 27, -47,
+  -28, -18, 29, 86, 46, 19, -1, -6, 34, 17, 7, 13, 37, 5, 51, 16, 21, -42, -7, -18, 57, 43, 1, -34, 46, 30, 73, 37, 41, -33, -33, -46,
+  54, 73, 35, -43, -37, -19, 30, 56, 34, 2, 24, -58, 24, 58, 16, -6, -40, -51, 29, 35, 6, -44, 10, -12, 72, 33, -9, 10, -34, 0, 1, 33,
+  62, 9, -36, 38, -5, 17, 86, 24, -19, 34, -10, 77, 63, -41, -31, -22, 7, 30, 25, -50, -2, -12, 4, 3, 53, -19, 20, -78, 14, 53, 56, 20,
+  -12, -60, 30, -33, 81, -39, 62, -21, 25, -60, 80, -3, 39, 14, 17, 13, 84, 9, 0, -24, 2, 18, 21, -1, -1, -46, 0, -13, 59, 38, -1, 14,
+  18, 28, 75, -21, 35, -6, -46, 63, 36, 6, 27, 1, -42, 66, 39, 16, -13, -26, -38, 27, 27, 39, 64, -34, 4, -41, -6, 49, 3, 8, 28, -87,
+  0, 61, 13, 32, -25, -59, 56, 15, -1, 21, -54, -81, -14, 21, 32, 17, -44, -36, 0, -14, -11, -39, -30, -85, 27, 4, 29, 39, -49, -64, 3, 21,
+  -4, -11, 6, -18, -44, -14, 36, 18, -50, -12, 16, 26, -13, 56, -23, -10, -33, 27, -5, 53, -20, 58, -11, 29, 31, 18, -57, -37, 10, 22, -41, -17,
+  -62, -16, 37, -27, -43, 10, -9, -44, -36, 7, 3, 14, -16, -38, -8, 7, -28, -34, -1, 19, 22, 44, -22, 22, 14, 12, -35, 24, 21, -7, 20, -10,
+  -53, -37, 20, -49, 36, -49, -56, -20, -36, -27, 58, 6, -10, 7, 2, -40, 58, -22, 6, 40, -17, -15, -4, 30, 52, 36, -53, -27, 36, 36, 58, 19,
+  -23, 2, -15, 64, 76, 5, 6, 4, 19, 34, 62, -19, 19, 18, 23, 53, 38, -73, -26, -53, 82, 16, 9, -27, 25, -4, 63, -13, 91, -48, 76, 18,
+  60, -11, 105, -12, 13, 3, 98, 46, 84, -64, 71, 10, 89, -16, 123, -56, 45, 31, 9, -24, -85, -47, 40, 11, 37, -7, 1, 4, 70, 47, -28, -49,
+  -45, -58, 52, 41, 0, 4, -3, -9, 35, -42, -54, 11, -56, -31, 57, -81, -51, -17, -8, -32, 71, -4, 14, 5, -57, -49, 57, 14, 14, -29, -83, 29,
+  35, 13, -33, -3, -75, -3, 7, -51, -10, -10, -8, 32, -4, 13, 57, -37, -26, 19, 29, -8, -22, -30, 29, 38, 2, 30, 22, -15, -26, 11, -36, -12,
+  39, 23, -13, 37, -50, -28, 16, -25, -68, 12, -8, 15, 64, 12, -38, 56, -38, -2, 63, -23, -1, 48, 30, -53, -25, -6, 59, -20, -45, -8, -32, 71,
+  5, -37, -50, -51, -47, 70, 12, -18, 8, -23, 30, -3, -41, -15, 37, -18, 22, -60, -17, -50, -6, -43, 20, -30, 14, 34, -72, -4, 21, -60, 26, -16,
+  -51, 21, 0, -77, 22, 11, -39, 11, 33, -17, 52, 42, -58, -3, 4, -39, 38, 42, -59, 47, 2, -45, -16, 29, -10, 1, -24, -27, 46, 27, -101, 62,
+  6, 26, -34, 51, -55, -18, 89, 36, 30, -19, -50, 25, 51, 3, 39, 9, -38, -51, 12, -9, 62, -30, -45, 10, 39, -20, 59, -11, -51, 21, -15, -4,
+  40, 33, -70, -36, 51, -13, -8, 41, -45, 18, 71, 22, 24, -13, -36, -9, 30, -42, 13, 52, -4, 0, 44, 42, 56, 32, -50, 36, -4, 9, 55, 57,
+  8, 38, 73, -5, 28, 20, -35, 15, -24, -22, 38, 8, 1, -13, -18, 18, 9, 23, -10, -20, -8, -23, -46, 11, 3, 29, 35, 15, -9, -18, -6, -25,
+  68, 11, 23, 19, 4, 10, 48, 13, -2, 39, -34, -37, 33, 23, -18, 0, -10, 21, -1, 15, 6, 44, -18, 13, -33, -11, 66, 11, 21, 14, -42, 23,
+  57, -9, 16, -28, 51, -22, 7, -56, 65, -72, -12, -39, 25, -4, 19, 15, 32, -35, -48, 2, 7, 10, 40, -10, 0, 9, 70, 9, 42, -22, 7, 21,
+  76, 19, 48, -76, 18, 15, 70, -13, -29, -79, -23, -11, 2, 3, -12, -64, -7, -15, 7, -9, -8, -2, -35, -36, 30, 34, -14, 42, -12, -47, 49, 17,
+  -23, -3, -17, -47, 60, -12, 38, 41, 14, -33, 69, 11, 10, 30, 4, -55, 32, 31, 28, 34, -35, 34, 54, -19, -45, 96, -16, 7, 52, 60, -9, 73,
+  -11, 38, 51, 38, -68, 43, -77, -32, 109, -5, -42, 51, -21, 26, 68, 41, -71, -6, -108, -14, 17, -23, -42, 4, -51, -56, 37, 34, -38, 9, -40, -62,
+  35, -28, -14, -13, -34, 18, 15, -1, 31, 37, -74, -31, 2, -34, 40, 31, -56, -60, 127, -3, 8, -33, -2, 13, 95, -68, 4, -40, -43, -28, 83, -11,
+  2, -91, -18, 0, 111, -54, -11, -76, 7, -3, 44, -51, -4, -51, -13, -8, 11, -92, -41, 58, 14, -22, 3, -77, 5, 20, -52, 21, 19, -23, -45, 22,
+  -66, -51, 9, -36, 13, 57, -29, -12, -29, -51, 12, -13, -48, 23, 13, -9, -47, 7, -8, 47, -5, -12, -23, -46, 2, -15, 1, -30, -33, -34, -20, -14,
+  38, -20, 10, -32, -53, 6, -14, 17, 41, 0, -24, -39, 21, -20, 35, 38, 38, 10, -29, 25, -13, 9, 39, 16, -20, 34, -10, 27, 52, 30, -32, -43,
+  1, 32, 20, -11, -73, 20, -35, -9, -30, -2, -14, 12, 31, -15, 22, 15, -99, 6, -22, 17, 13, -13, -36, -26, 14, -1, -26, 13, -8, -32, 35, -56,
+  33, 20, -61, -12, 17, -45, 68, 39, -41, 52, 4, -6, 7, -42, -36, -14, -10, 16, -13, -12, -81, 52, -27, -4, 0, 46, -40, -5, -5, -19, 22, 11,
+  -17, 33, 0, -50, -3, 34, -76, 60, -21, -7, -11, -21, -83, 36, 4, 17, 8, 33, -89, 46, 7, -40, 11, 36, -84, 68, -49, -53, 45, 47, -79, -10,
+  -44, 11, 48, -9, -21, -41, -33, 59, 17, -42, -33, -14, 20, 0, 45, -27, 14, 38, -65, 15, 44, -21, 27, 5, -40, 9, 24, -32, -32, 18, 5, -18,
+  33, 35, 3, 37, -4, 27, 6, 39, 49, 16, -55, -45, 23, -5, 53, 18, -40, -22, 63, -30, 20, 83, -16, -8, 48, 26, 14, 82, 0, 41, 31, -30,
+  -88, -18, -15, -13, -33, -25, -39, 45, -20, -34, -4, -42, -20, 25, 6, -54, 1, 23, -33, 50, -39, -79, 19, -57, -11, 79, 17, -27, -12, -46, -28, 82,
+  -8, -33, 23, -1, -77, 12, -17, 60, -24, 15, -73, 96, -53, -18, 16, 9, -23, 49, 4, 40, -19, -22, -18, 9, -73, 23, 18, -94, -55, -18, -48, 74,
+  -36, -29, 14, 29, 23, -31, -46, -40, -25, -14, -38, -7, 15, -95, -25, -29, -20, -2, -26, -8, 17, -38, -16, 37, 28, -54, 10, -16, 15, 86, -36, -58,
+  -4, -15, 34, 85, -36, -20, 19, -35, 12, 2, 13, -50, 47, -57, -3, 33, -16, -21, 9, -6, 3, -12, -8, -71, -33, -19, 29, 43, 48, -36, 12, -22,
+  -11, -42, -3, -25, 35, -1, 57, 34, 37, -48, 19, -16, -36, 26, 16, -67, 44, 8, 21, 27, -13, -50, 45, -24, -29, -7, 44, -81, 27, -7, 41, 33,
+  -4, -110, 73, 2, 35, -17, 30, -79, 42, -24, 61, -22, -2, -120, 66, -74, 53, 36, 98, -86, -35, 31, 44, -76, -50, -89, -89, 0, -3, 30, -18, -98,
+  -77, -21, 67, -10, -48, -59, -68, -24, -6, -6, -89, -71, -22, 55, 84, -22, -67, -88, -41, -49, 8, -2, 4, -23, -20, 11, 59, -7, -65, -38, 47, -54,
+  24, 25, 29, -100, 57, -52, -19, -35, 39, -43, -26, -89, 54, 3, -24, -76, -30, -52, 66, 2, -4, -19, 42, -8, -13, -61, -52, -67, -18, -24, -11, -9,
+  38, -45, -4, -32, 7, -34, 72, -11, -17, 16, -5, -49, -8, -20, 65, -47, 3, -9, 20, 37, 44, 27, 31, -34, -3, -60, 62, -8, -27, -11, 27, -38,
+  -11, 58, 8, -88, 16, 14, 46, -28, -6, 5, -13, -53, 11, -15, 49, -32, 25, 5, 51, -42, 14, -75, 49, -11, 68, -22, 63, 10, 68, -57, -3, 16,
+  8, 53, 49, -34, 56, 30, 14, -45, 75, -47, 29, -24, 5, -49, 110, -28, 23, -20, 6, -19, 18, -68, 46, 21, -4, -36, 87, 18, 16, -58, 29, -5,
+  69, -49, 26, 15, -22, 16, -19, -69, -24, -55, 42, -46, -10, -47, -55, 27, 35, -16, 85, 1, -13, -29, 5, 4, 56, -30, -65, 26, -18, -61, 49, 9,
+  -87, 72, -44, -56, 59, 46, -61, 40, -5, -30, 54, 45, -14, 32, -43, 40, 29, -53, -47, 64, -46, -6, -67, 33, -12, 38, -8, 14, -15, -6, -56, 29,
+  25, -58, -24, 1, -18, -59, 7, -74, 24, -29, -2, -117, 28, -31, 21, -8, -10, -60, 7, -17, -11, -55, -36, -67, -47, -53, 50, -25, -36, -82, 40, 14,
+  -9, -11, 24, -93, 13, 29, -13, -42, 8, -78, -43, 64, -27, 59, 53, -67, 25, 89, -59, 5, 1, -5, -6, 54, -1, 39, 24, -52, 48, 15, -41, -18,
+  6, -3, 22, -22, -9, 12, 32, 44, 1, -6, -82, 17, 31, 9, -11, 33, -47, 63, -13, 96, 59, 29, -14, 57, -22, 36, 20, -15, -33, -27, 32, 79,
+  -39, -48, 25, -37, -21, -16, 43, -22, 58, -35, 51, 51, 36, 4, 17, 15, 3, 80, -40, -53, 14, -43, -37, 1, 19, -11, 4, -46, 21, 1, -3, -3,
+  65, -72, 19, -35, -25, -2, 55, -35, 16, 33, -86, -80, -13, 2, -17, -30, -72, 22, -27, -47, -9, -28, -1, 16, -91, 28, 4, -27, 30, -29, -37, 15,
+  37, -34, 9, -27, -14, -4, -59, 31, 56, -17, -9, -48, 7, 6, -6, 43, -55, -31, 19, -12, -35, -39, 20, -59, -20, 27, 13, -5, 21, -41, 2, 24,
+  13, -10, -28, -67, -27, 57, 16, -16, 67, -66, -15, 22, -23, -9, 48, 1, -5, 74, -6, 18, 61, 19, 71, 67, -31, 0, 26, 2, 57, 6, -51, -29,
+  -34, -2, 32, 39, -46, -34, 45, 36, 59, 53, -108, -9, 43, 4, 69, 54, -89, 21, 53, -76, 73, 17, -46, 29, -42, -25, 49, -48, -54, 41, 5, -74,
+  87, -26, -68, 45, 43, -10, 71, -50, -90, 27, -22, -53, 19, 12, -39, 91, 62, -10, -43, -66, -32, -3, 9, -19, 25, -19, 33, 35, -33, -53, 11, -91,
+  16, 18, -19, 23, -43, -97, 59, 32, 39, 43, -86, -39, -5, -51, -31, 27, -89, -52, 47, 31, -14, 1, -26, -100, 51, 17, -52, 37, -114, -59, 20, -54,
+  -18, 68, -47, -47, 55, 26, -17, 104, 3, -35, 22, 41, -44, 43, -60, 69, 17, 54, 35, 125, -67, 9, 10, 90, 5, 57, -18, -19, 4, -28, 8, 65,
+  -59, -25, -19, 50, -73, 80, -27, 55, 9, 16, -60, -9, -53, 15, -49, 61, -2, 86, -33, 107, -44, 48, 14, 127, 27, 85, -85, -24, 26, 53, -20, 95,
+  6, -58, 29, 52, 29, 108, -43, -45, -8, 33, 33, 23, -29, 18, 2, 43, 71, 104, -11, -49, -47, -41, 61, 65, -57, -6, -57, -7, 7, 9, 39, -15,
+  -45, -5, -17, -25, 11, -48, 7, -7, -31, -73, 16, -15, -4, -34, 20, 9, 46, -54, 13, 47, 13, -8, -22, -33, 11, 34, -50, 49, -31, -21, 3, 21,
+  -9, -3, 39, -11, -63, 0, -47, 77, 28, -8, -106, 62, 43, -17, 12, -6, -15, 61, -29, -1, 51, 6, -20, 48, 12, -39, 43, 7, -82, 35, 47, 9,
+  23, -15, -23, -21, -11, -86, 21, 25, -53, 13, 32, -34, 5, -14, 32, 29, 60, 37, 29, 46, -2, -7, 5, -4, -54, -40, 6, 7, -27, -56, -10, -30,
+  3, 2, -9, -67, -48, -4, 35, -27, 44, -76, 15, -7, 36, -52, 50, -62, -7, -27, -62, -2, 27, -58, 10, 24, -92, -5, 67, -75, 61, 16, -1, 18,
+  -7, -9, 28, 27, -57, -3, -2, -24, -25, 51, -50, 37, 56, -26, -47, -41, -9, 58, 27, 8, -26, -18, -69, 12, 58, 7, -1, 37, -34, 50, -27, -5,
+  -50, -20, -7, -15, 43, 111, -7, -17, -69, 10, 6, 88, -30, 45, -83, 43, -20, 29, 51, 11, -33, 8, 36, 62, 9, 33, -26, -4, 44, 83, 7, -15,
+  -88, -16, -3, 123, -14, 39, -72, 65, -18, 90, 76, 56, -5, -22, -3, 69, 25, 83, 38, -21, -46, 48, 15, -3, -40, 13, 13, 7, 47, -15, 55, -37,
+  -24, 33, 63, 44, 36, -25, -43, -2, 35, -5, 18, -84, 3, -44, 50, 66, -21, -59, -18, -11, 6, 17, -54, -22, -55, 0, 7, -17, 17, -10, 10, -18,
+  8, 18, 11, 10, -52, -9, 5, -21, -24, 46, 21, 20, -26, 66, 8, -14, -52, 18, 29, -5, -26, -48, 17, -32, -20, 47, -24, -33, -45, -6, -13, -20,
+  -2, 9, 3, -6, -6, 13, -6, -41, -30, -6, -31, -14, 35, 10, -10, -86, -18, 46, 26, -22, 29, -69, -28, -16, 3, -31, -25, -22, -38, 12, 31, 1,
+  -38, -21, 17, -33, -54, -37, 22, -13, 20, -17, -33, -20, 17, -10, 20, -34, 20, -34, -36, -21, 18, -38, 11, 16, -43, -59, 43, 6, 0, -53, -49, -34,
+  1, 11, 4, -17, -11, -6, 51, 35, -22, 30, 14, -39, 1, -60, 40, -11, 22, -34, -18, -40, -6, -33, -30, -7, 20, -70, 41, 34, -18, -5, 71, -9,
+  -25, 35, -37, 12, 46, -16, 15, 31, -15, 12, 24, 15, -16, 17, 4, 21, 42, 28, 23, 12, 51, -11, 26, 33, 26, -39, 54, 10, 59, 28, 39, -5,
+  67, 22, 25, 11, 6, 49, 7, 57, -8, -46, 62, 38, -28, -107, 53, -35, -42, -28, -28, -96, 17, -82, -23, 46, -27, -38, -15, -30, 5, 28, -31, -71,
+  11, -68, -43, -29, 13, -47, -20, -35, 11, -7, -41, -56, 5, 34, -14, -20, -13, -54, -47, 28, -63, -18, 3, -83, 28, 12, -31, -27, 26, -57, 14, 21,
+  -12, -24, -31, -35, -12, -25, -46, -27, -10, -59, -14, -43, 25, -49, 15, -43, 10, -95, -45, 16, -40, -34, -3, -29, 7, -8, 7, -17, 41, -16, -36, 46,
+  -16, -55, 33, -10, 26, 4, 20, -79, -8, -31, 18, 22, 17, -43, 12, -21, 25, 45, 35, -17, -22, 41, -14, -21, 20, -16, -22, 21, -2, -2, -42, -39,
+  40, 20, 8, 11, -8, -31, -54, -31, -20, 7, -5, -49, -34, 10, -3, -40, -3, -23, 14, 26, -49, 33, -18, -18, 25, -23, -23, -2, -16, -16, -18, 29,
+  -13, 23, -64, -16, -6, 84, -20, 0, -71, -47, 34, 127, 3, -19, -38, -60, 15, 39, -6, -1, -43, -102, -14, 26, -6, -26, 8, -65, -27, 0, -28, -22,
+  -17, -51, -5, 34, -28, 3, 7, -60, 12, 56, -12, 10, -6, -46, 12, 79, 3, 21, -4, 10, -2, 24, 15, -31, -8, -50, 10, -9, -38, 18, 4, -10,
+  -40, -26, -11, -41, -23, -39, -8, -33, -43, -27, 20, -4, 32, -15, -24, -3, 18, -63, 39, -29, -11, -60, 1, -8, -17, 10, -41, -29, 5, -49, 8, -43,
+  -28, -13, 36, -46, -2, 15, 34, -7, 7, -64, -19, 7, 26, -21, 17, -18, -34, -26, -2, -26, 0, 10, -2, 1, -57, -59, 3, -49, 1, -16, -44, 48,
+  -1, -54, 23, 42, 27, 29, 11, -17, 46, 40, -16, 15, 5, 17, 57, 25, 12, 52, -24, -13, 26, 14, -54, 14, -22, -54, 38, 44, -28, -23, 19, -45,
+  9, 36, -9, -2, -24, -58, -28, 6, 4, 44, -13, -49, 3, 37, -43, 13, 34, -20, 34, 5, 16, -24, 32, -81, 28, -63, -13, 42, 21, -71, 8, 6,
+  11, 4, -37, -34, 19, 1, -9, 61, -30, 19, 5, 35, -21, 25, -18, 28, -20, 42, -60, -8, -35, 21, 8, -53, -74, -7, -70, -44, -22, -19, -28, 12,
+  8, 11, -38, -35, -69, 1, -14, -70, -51, -4, -51, -7, -26, -45, -64, -22, -44, 7, -32, -60, -17, -39, -47, -30, -39, -1, 2, -30, 4, -8, -31, -33,
+  4, -46, -38, 26, -27, -44, 20, 22, 13, -33, -22, -31, 8, 54, -31, -5, -47, -57, 20, 32, 31, 37, 4, -6, 30, -13, -41, -12, -40, 6, -8, 28,
+  11, 51, -22, 7, -29, 13, 24, 40, -10, -23, -30, 51, -50, 25, -59, -16, -18, 35, 30, -11, 23, -43, -51, -11, 3, -45, 14, 19, -39, 40, -31, -26,
+  -39, -53, -5, 19, -17, -32, -6, -31, 31, 43, -7, -37, 0, -22, -15, 16, 25, 3, 0, -3, -12, 28, 7, 24, -42, -17, -15, -19, 42, 19, -34, -12,
+  30, -15, 5, -6, -32, -51, -11, 37, -3, -15, -43, -28, 29, 72, 37, -36, -11, -48, 59, 39, 27, 8, -26, -25, 32, 37, -32, 2, -6, 9, 44, 51,
+  -62, 22, 26, 2, 56, 81, 14, 13, -24, 27, 49, 3, -18, -2, 8, 63, 18, 1, 23, 28, 51, 27, 78, 25, -15, 50, 5, 0, 36, -34, 4, 13,
+  -6, 17, 29, 43, 37, -2, 47, -22, 1, -4, 11, 43, 33, -50, -5, 51, 66, 24, 54, 8, -39, 54, 45, 13, 46, -10, -67, 22, 20, 41, -2, -23,
+  -13, 16, 61, 50, -12, -45, -34, 3, 26, -16, -9, -60, -14, 1, 29, -8, 15, 1, -26, 18, 32, 14, 3, -24, 35, -12, -21, -1, 35, -27, -9, -45,
+  14, -21, -11, 2, 19, -21, 5, -8, -21, -15, 13, -50, 16, 22, 28, -17, 21, 13, 47, 16, 50, -29, 17, -26, -18, -55, -5, -34, -25, 32, 37, -68,
+  37, -42, 34, -15, 32, -35, 1, 1, 22, -18, -24, 7, -39, 18, 58, -44, 2, -19, -5, -20, 9, 2, 13, -43, -7, -27, 71, -43, 9, -51, -2, 29,
+  53, -6, 2, -67, 25, -9, 28, -6, 69, -6, -24, -22, -8, -19, 8, 8, 0, 35, 18, 11, 46, 6, 9, 3, 14, 72, 0, -43, -84, -2, -14, 127,
+  126, 35, -23, -12, -81, 102, 93, 30, -18, 19, -29, 68, 80, 67, -55, 0, -45, 124, 25, 76, -33, -31, 5, 48, 14, 59, -70, -25, -20, 80, 24, 67,
+  8, -10, -34, 57, 43, 12, 4, 15, -10, 76, 35, -4, -7, -23, -34, 94, 0, -14, -23, -69, 0, 113, -40, -11, -29, -64, 37, 67, 0, 79, 31, -52,
+  31, 95, -3, 13, 14, 14, -61, 39, -36, 65, 3, -22, -39, 43, -35, 65, -43, 39, -14, 101, -9, 73, 17, 21, -16, 51, -20, 33, -28, -12, -12, 34,
+  -13, 67, -1, 22, 79, 44, -46, 56, -32, 28, 23, 2, 28, 79, 49, 34, 5, -20, 28, 36, 51, -22, 50, -54, -3, 65, 27, 45, 5, -35, -3, 68,
+  10, -8, -20, 13, 21, 16, 12, 21, 17, 46, 18, -14, -33, -14, 9, -3, -6, -4, 29, -10, 44, 87, -67, -25, 55, -8, 0, 17, -32, 54, 41, 36,
+  42, 79, -22, -36, 81, 17, 42, -1, -99, 25, 43, 13, 73, -45, -117, 44, 34, 18, -62, -74, -34, -31, 35, 19, -10, -29, -33, -25, -15, -12, 15, -6,
+  -45, -33, 26, 43, -48, -91, 8, -46, 36, -3, -12, -80, 41, -46, 20, -6, 19, -67, -11, -41, 8, 48, -3, -88, -51, -1, 0, -25, 18, -79, 9, -54,
+  -29, -10, 50, -54, -54, -19, 20, -14, -6, -9, -26, -21, 7, 12, 76, -24, -45, -12, 26, -19, 27, -40, 0, -47, -2, 70, -34, -46, 56, -58, -23, 59,
+  -31, -46, 9, -70, -13, 34, -11, -56, 5, -59, -38, 1, -53, -10, -35, -25, 4, 6, -32, 44, -58, -47, -34, -7, 19, 8, -9, -53, -48, -24, -6, -20,
+  -10, -17, 2, -2, -49, 23, -17, 0, 7, -8, -38, 2, -33, 31, -16, 5, -49, -16, 22, -30, 14, 21, -19, 12, -52, 0, -27, 14, -50, -7, 35, -2,
+  26, 12, -45, -13, 38, -13, -19, -35, -51, -18, 29, 13, 38, 32, -35, -18, -42, -38, 31, 34, -48, 6, 1, 36, -8, -39, -62, -9, -14, 1, -43, 41,
+  -4, -23, -12, -28, 14, 22, 10, -33, 51, 22, -21, -22, -31, -24, 17, -35, -10, 43, -13, -47, -15, -14, 30, 7, -52, -9, 5, 32, 26, -46, -20, -46,
+  -24, -25, -1, -15, 22, -9, 23, 2, -38, -60, -15, -17, -2, -59, -8, -18, 10, -83, 2, -31, -4, -33, -74, -37, 43, 25, -21, 15, -3, -89, 56, 1,
+  40, -37, -73, -60, 50, 37, -16, 8, 0, -73, 46, 33, -21, -65, -7, -40, 63, 10, -27, -57, -5, -90, 113, 46, 47, -63, -43, -78, 80, 42, -9, -18,
+  -26, 34, -95, -37, 27, -28, 16, 105, -48, -31, 4, -10, 23, 23, -92, -38, 14, 36, 62, 48, 1, -3, -55, 4, 47, 43, -4, -19, 10, -13, 17, 42,
+  -47, -3, -47, 47, -8, 48, -69, -19, 13, 25, 0, 63, -58, -56, 22, 14, -9, 50, -44, -22, -24, -20, 47, 29, -63, -47, 38, -28, 44, 58, -1, -37,
+  -5, 35, -30, 6, 42, -48, -7, 5, -2, -60, 0, 1, 29, -11, -38, -11, 33, 17, 6, -35, -38, 27, 9, 18, 36, 7, -22, 13, 2, 42, 20, 5,
+  20, 59, -9, -22, -13, 53, -26, 83, 22, 53, 6, 67, 31, 26, -10, 42, 8, 42, 5, 89, 23, 38, 5, 14, 32, 72, 6, 20, -20, -14, 8, 61,
+  -7, 14, -18, 39, -38, 70, 15, -1, 18, 29, -23, -31, -30, 10, -23, 18, 21, -13, -9, -12, -8, -25, -10, -79, -11, -38, 30, -3, 40, -77, -12, -7,
+  3, 30, -32, -29, -53, 3, -30, 15, 29, -97, 7, 36, 57, -15, 18, -61, 28, 0, 36, -7, -19, -7, -33, -50, 41, -56, 55, -30, 22, -62, 18, 5,
+  40, -85, 19, -36, -5, -5, -21, -113, 68, -8, 10, -67, 7, -80, 95, -15, -23, -48, 11, -92, 14, 8, 35, -17, 61, -42, 55, -27, -8, -61, 47, -102,
+  8, -4, -4, -42, 65, -27, 38, -26, -50, -75, 63, -61, 72, 5, -39, 13, 42, -57, 43, 38, -14, -29, 48, 6, 71, 27, -3, -34, -16, 12, 22, -16,
+  -27, 36, 59, 63, 37, -29, -93, 60, 16, 52, 34, 58, -38, -8, 74, -7, 23, 54, -21, -30, -4, -34, 43, 38, -41, 14, -8, -58, 19, 91, 6, -7,
+  15, -46, 27, 27, -16, 19, 48, 49, 51, 24, -22, 2, 35, 53, 2, 54, -17, 24, 7, 38, 16, 56, 0, 42, 29, 28, 34, 14, -17, 17, -32, -11,
+  -5, 18, -26, -18, 36, 2, 23, 6, 39, 12, -7, -33, 4, -24, -21, 26, 16, -35, 43, 59, 23, -38, 15, 52, 14, 42, 40, 41, -48, 59, -53, 21,
+  23, 25, -61, 40, -43, 76, 9, 37, 22, 38, -25, 40, 14, -39, 23, 87, -38, 73, -31, 26, 12, 41, -30, 32, -24, 2, 57, 44, -9, 68, -37, 26,
+  -11, -16, -35, 89, 3, 38, 26, 10, -22, 32, 26, -23, -7, -35, -2, 27, 43, 19, 67, 66, -17, 45, -31, 31, 64, -7, -61, 51, 43, -11, -1, 74,
+  -18, 60, 14, -19, -49, 41, -37, 52, -1, 31, -66, 60, -44, -7, -12, -16, -38, 23, 7, 77, 38, 5, -13, -10, -38, 23, 23, -5, -31, 3, -33, 15,
+  -54, 49, 3, -35, 16, 1, -83, 0, -2, 11, -9, 20, -40, -11, -49, -2, 14, -16, -35, 18, 6, 5, 44, -2, 2, -10, 3, 26, 50, 50, -43, 64,
+  8, 17, -27, 57, -16, -11, -28, -20, 33, 26, -34, 22, -36, 50, -52, 34, -1, 27, 43, -8, -24, 16, 16, 15, -14, 30, -26, 59, 12, -11, -8, 61,
+  -28, 66, -8, -44, 21, 69, 0, 7, -7, -23, -28, 80, 0, 30, -3, -5, -2, 72, 39, -16, 7, 5, -17, 70, -18, 4, 28, -2, -10, 15, -1, 49,
+  -2, -19, -31, 26, 13, 33, 5, 13, 5, -8, 5, 57, 22, -43, 16, 28, 21, 10, -33, -29, 3, 36, 27, 32, -57, 24, 3, -8, -22, 32, 6, -10,
+  -44, 92, 37, 34, -58, -17, 24, 105, 25, -10, -1, -21, -6, 87, 0, 1, -12, 8, -41, 44, -20, 34, 55, 1, 23, 111, -12, 33, 9, -29, 53, 77,
+  6, -25, 34, -23, 42, 48, 26, 33, 7, 16, 33, 73, 5, -20, 67, 30, 28, 115, -24, 27, -108, 72, -55, 97, 10, 73, -119, 55, -55, 29, -7, 61,
+  -100, 15, -26, 61, -71, 6, -7, -10, -4, 10, -37, 46, -22, -3, -42, 40, -46, -14, -64, 20, -22, -33, -51, 28, -12, 46, -23, -50, 11, -22, -7, 10,
+  -6, 2, 11, 34, -2, -25, -12, -8, -57, -20, -15, 13, -13, 14, -15, -31, 14, -19, 34, 49, 16, 21, 25, 1, 29, -53, -33, 20, -3, 0, -19, -74,
+  5, 48, 51, -32, -4, -85, 30, 36, 37, -15, 2, -93, 47, -37, -49, -67, -38, -75, 25, 8, 22, -28, -25, -73, 15, -35, -18, 9, -10, -44, 13, 41,
+  -4, 0, 24, -80, 4, 33, -31, 34, -27, -76, 9, 32, -65, -23, 16, -108, -14, 25, -9, 24, 29, -55, 34, -29, -14, -22, -68, -72, 25, -19, -45, -37,
+  23, -10, -67, 21, -37, 35, -17, -90, -47, 63, -21, 12, 36, -19, -36, 63, -84, -16, 24, -34, -11, 54, -9, 36, 8, -36, 11, 77, -52, -2, -12, -34,
+  -52, 34, -56, 18, 8, 51, -5, 30, 10, 23, -63, 78, 11, 18, 2, 80, -45, 51, -57, 34, -60, 26, -55, -12, -9, 30, -65, 1, 15, 0, -73, -13,
+  -37, -64, -28, -53, -50, 9, 16, -38, -9, -18, -48, -10, 25, -24, -11, -68, -35, 42, -4, -36, 26, -4, 0, 71, 10, 48, 8, 1, -15, 49, 5, 23,
+  15, 20, -15, 46, -41, 34, 7, 9, -43, 41, 22, -11, 1, 19, -9, 7, -7, -54, -4, -34, -35, 61, -31, 16, -21, -18, -21, -14, 6, -58, 25, -30,
+  8, 65, -5, -54, -54, 74, -48, -25, -41, -35, 20, 65, -8, -23, -3, -12, -18, 6, -83, -51, -40, 9, 2, 69, -64, -4, -47, -32, -44, 40, -10, 49,
+  -8, 39, -33, 65, -54, -4, -6, 41, 35, 46, -42, 11, -25, 4, -32, 55, -4, -15, -25, 8, 23, 62, 8, 14, 22, -17, -45, 52, 9, 21, -6, -32,
+  -41, 52, -21, -1, 49, -13, -61, 84, -3, 22, 2, -47, -16, 3, -48, 29, -20, -19, -46, 33, -60, 34, -1, 3, 0, 73, -9, -15, -13, -23, -26, 51,
+  -35, 39, 21, -49, -37, -26, 31, 71, -61, 5, -14, 24, -40, 56, -26, -3, -15, 40, 43, 67, 24, 37, -54, 50, 12, 26, 28, 73, -18, 42, 19, 1,
+  -21, 12, -50, 31, 20, 54, -43, -25, 7, 76, -8, 3, 32, 5, 5, 30, 4, 34, -17, 2, -5, -26, -55, -21, -6, -27, 28, -49, 9, 36, 8, 2,
+  -19, -27, 22, 29, 14, 4, -27, -57, 22, 48, -18, -33, 17, -5, -18, 15, 29, 33, -60, -38, -10, 55, 9, -32, -30, -14, 17, 103, 8, 46, -46, -25,
+  -35, 80, 59, 14, -67, -7, -29, 105, -8, -18, -9, -4, 51, 111, -28, 18, -45, -18, 12, 116, 43, -3, -31, 23, -22, 33, 20, -14, -24, 28, -54, 86,
+  -17, 37, -80, -28, -6, 94, -3, 15, -69, -52, -51, 14, -50, 26, -72, 1, -61, 87, 3, 20, -33, -17, -37, 35, 7, 3, -49, 22, -51, 13, -25, 19,
+  -56, -9, -50, 45, -4, 41, -16, -73, -71, 50, -6, 17, -87, -58, -83, 100, -28, -6, 15, -44, 1, 127, 61, 20, -11, -43, -54, 117, 54, 32, 8, -73,
+  -51, 53, 11, 1, -27, -14, -70, 16, -18, 19, 15, -70, -11, -13, 8, 28, -18, -27, -21, -17, -19, 26, -68, -87, -17, 50, 36, 0, 11, -50, -85, 11,
+  5, -35, -36, 20, -1, 15, 80, -15, 21, 20, -66, 15, 30, -5, -16, 9, -31, 35, 17, 30, -3, 4, -27, -1, 8, 36, -34, 9, -48, 33, 45, 21,
+  10, 1, -4, 14, -7, 35, -11, 47, -77, 22, 10, 73, 3, -21, -12, 54, 15, 72, 11, 42, -46, -26, 16, 19, -27, 41, -75, -26, -37, -9, -28, -11,
+  -44, 5, -25, 25, -7, -3, -4, 6, -23, 13, 2, 2, -11, 38, -9, 26, 59, -3, -15, 86, -26, 37, 41, 44, -28, 56, -57, 7, 13, 27, 4, 45,
+  -43, 37, 17, 7, 9, -30, -66, -42, 27, 39, 56, -2, -32, -20, 51, 12, 49, -2, -70, 12, 67, 68, 13, -6, -25, -52, 49, 67, 45, 21, 8, -21,
+  93, 65, 20, -30, -6, -3, -76, 6, 13, -56, 36, -5, 15, 42, 0, 28, 14, -29, -29, 28, -25, -34, -17, 33, 6, 63, -33, 2, 67, -34, -27, 18,
+  -34, -35, 14, 0, 40, -8, -17, -12, 63, -41, 43, -23, -18, 25, -20, -2, 0, 21, -1, -34, 52, -3, -32, -22, -21, -67, -6, -21, 42, 15, -35, -71,
+  64, -44, 4, 15, -14, 7, 12, -75, 22, -2, -38, -10, 41, -73, -35, 24, 3, -39, -9, -54, -40, -31, -37, 35, 43, -31, -12, -63, 29, -6, 8, 0,
+  -4, 19, -12, 60, -15, -21, -26, -5, 26, 3, -17, -3, 5, 19, -3, 21, 40, -16, -10, -34, -43, 6, -18, -30, -12, 18, 15, 49, 23, -37, -5, -1,
+  -21, 18, -1, 35, -55, 34, -9, 25, 28, -16, 30, 17, -39, 35, 40, -5, 10, 18, -22, 51, -12, 11, -9, 2, 14, 48, -7, 3, 26, 25, 41, 67,
+  -29, 44, 33, -26, -13, -16, -25, 12, -2, -3, 60, 32, -27, -29, -19, -18, 77, -7, -30, 40, -19, -79, 63, 3, -23, -29, -53, 21, -18, 51, -30, -21,
+  -39, -26, -54, -6, -67, -24, -19, -22, -16, 64, -43, -14, -30, -39, -3, 26, -82, -14, -34, 1, 8, 51, -27, -30, -78, 61, -21, 36, -63, 20, -18, -15,
+  33, 40, -111, 40, -116, -29, 24, 24, -48, 10, -53, 6, 41, 58, -36, -17, -76, -2, 60, 56, -41, 5, -96, 18, 3, 34, -27, 23, -59, 42, 2, 9,
+  -20, 19, -79, 38, -3, 44, -34, -18, -40, 26, 5, 77, -26, 64, -92, 6, 23, 69, -7, 62, -96, -30, 21, 40, -12, 38, -109, -20, 10, 38, -10, 30,
+  -119, -27, 10, -34, 12, 27, -64, 8, 30, 6, -20, -19, -99, -55, -25, -26, -5, 17, -87, -38, -6, 2, -42, 36, -38, -5, -40, -6, 14, -14, -86, -40,
+  -29, 25, -68, -15, -30, -94, 22, 28, -64, 18, 1, -69, -47, -8, -56, 55, -57, 3, -16, 23, -33, 15, -70, -22, 8, -2, -43, -16, -25, 2, 34, 38,
+  -82, 60, -92, -51, 19, -31, -32, 19, -112, -20, -37, -19, -20, -27, -29, -28, -40, -31, -15, -74, -11, 8, 13, -17, -78, -66, -12, -23, -53, -9, -32, -44,
+  22, -25, 27, -34, -50, -59, 19, 20, -8, 31, -23, 13, -27, 54, 0, -8, -18, -30, 54, 19, -19, 59, 21, -31, 11, -4, -21, -9, -15, -74, 51, 36,
+  36, 37, 24, -60, 0, -6, 23, -17, -56, -26, -19, 5, 17, 12, 6, -84, 32, -16, 43, -45, 18, -73, 22, -44, -5, -25, 15, -55, 11, -21, 73, -42,
+  25, -87, -21, -44, 64, 8, 9, -119, 41, 18, 34, -19, -21, -61, -23, 37, 10, -7, 46, -62, 42, -22, -6, -7, -38, -51, 39, -50, -22, 25, 17, -21,
+  -3, 40, -31, 79, -15, 34, -38, 51, -25, 45, 9, -27, -39, 88, 19, 2, 12, -42, -57, 30, -36, -24, 51, -23, 15, 27, 12, 39, -49, -49, -41, -58,
+  -32, 58, 39, -7, 1, -21, 3, 96, 35, -30, -38, -34, 29, 66, -3, -51, 29, -16, -21, 83, -8, 13, -27, -9, 29, 52, -35, 63, -20, 46, 66, 78,
+  14, -29, -7, 18, 12, 6, -39, 25, 8, 27, 52, 24, -5, 18, 0, -18, 14, 25, -33, -51, -11, 37, 51, -37, -67, -81, -30, 14, -21, -49, -62, -85,
+  -63, 77, 20, -20, -38, 14, -47, 45, 2, 41, 5, -8, 17, 57, 14, 30, -16, 8, -27, 76, 39, 34, -15, -37, -15, 98, 64, 70, -37, 41, -56, 57,
+  13, 54, -7, -3, -80, 59, 48, 55, -52, 4, -8, 49, 24, 10, 20, 16, -80, 19, 44, 61, -39, 43, -41, -84, -34, -9, -39, 105, -15, -18, 16, -12,
+  -37, 123, -45, -57, -6, -8, -62, 71, -55, -71, -47, 9, 7, 44, -56, -65, -6, 36, -2, 51, -74, -26, -34, 8, -81, 13, -61, 11, -12, -23, -97, 83,
+  -66, 48, -1, -40, -46, 52, -102, -13, -65, -80, -107, -21, -13, 18, -76, -35, -64, 60, -66, 20, -37, 49, -78, 38, -84, 16, -33, -20, -95, 88, -40, 33,
+  -53, 21, -44, 50, -69, -35, 10, 16, -90, 54, -55, 1, -13, -52, -33, 49, -76, -16, -49, -67, 53, 90, 37, 41, -66, -51, -24, 53, -28, 43, -51, -7,
+  21, 34, 38, 5, -41, -57, -17, 16, -19, -34, -68, -2, -50, 9, -20, 35, -15, -17, 0, -8, -11, 19, -52, -2, 13, 0, -8, 42, -39, -27, 14, 22,
+  11, 11, -50, -36, -19, 18, -3, 48, -32, -6, -22, 15, -38, -49, -35, -41, -41, 6, -14, -1, -34, -32, -11, -18, 9, -38, -58, -56, -49, -1, -11, -13,
+  -72, -89, 14, -24, -8, 20, -53, -112, 19, -57, 31, 51, -12, -111, -17, 2, 26, -16, -51, -61, 4, -6, 0, -27, -24, -30, -49, -72, 19, -64, -41, -71,
+  17, 24, 25, -31, -92, -12, -35, 49, 26, -39, -94, -52, 26, 2, -21, -41, -51, -40, 19, 45, 0, 20, -89, -91, -34, 33, 7, -27, -113, -55, -25, 14,
+  15, 0, -81, -58, -27, -8, 42, -11, -84, -127, 23, -14, 20, -8, -38, -74, 19, -49, 49, 2, -91, -49, -15, -34, 15, 32, -65, -97, 30, 32, -28, 65,
+  4, -112, -37, 37, 61, 20, 6, -116, 93, -7, 86, -31, 70, -45, 33, -28, 20, 70, 59, -33, 38, -43, 25, 15, 1, -34, 26, -10, 5, 1, 15, 20,
+  -41, -50, -27, 2, 16, -79, 5, -57, 8, 1, -77, -43, 41, -33, 59, 23, 13, -33, 22, -49, 62, -47, 50, 1, -29, -11, 53, 34, 102, 46, 30, -4,
+  -61, -62, 80, 8, 24, -26, -63, -67, 53, 16, 35, -41, -44, -29, 37, 15, 43, 22, 18, 35, 30, 28, 24, -19, 4, 62, -13, -41, 18, -67, -16, 67,
+  -16, -44, 17, -13, 23, 25, -10, -35, 52, 26, -6, -5, -10, 28, -7, -19, -33, -3, -31, -5, -6, 26, -65, 49, -36, -6, -22, 31, -123, 39, 26, -64,
+  37, 28, -54, -61, -23, -26, 27, -42, 3, -43, -23, -49, -25, 24, -32, -65, -7, 19, -43, 35, -64, 26, -18, -74, 35, 25, -27, -32, 21, -45, 40, 17,
+  -73, 16, 19, -77, 22, 30, -35, -35, 41, 17, -25, 22, 46, -7, -38, -22, -22, -22, 56, -15, -10, 21, 10, -1, 3, -17, -6, -81, 45, 9, 25, 1,
+  -54, -38, 23, -66, 36, -38, -15, -21, -1, -108, -9, 1, 30, 43, 6, -52, -1, -41, -56, 41, -12, 8, -41, -41, -57, 32, -15, -34, -19, 16, -22, -12,
+  36, -25, 63, -9, -63, 28, 8, -24, 4, 2, -62, -7, 87, 21, -25, -61, -24, 62, -14, -5, 4, -13, 24, -19, 21, 29, 23, -24, -6, 29, 31, -34,
+  -12, -5, -4, -21, -19, -60, 5, 9, 28, 80, -70, -31, 21, -9, -40, 59, -30, -12, -26, -13, 2, -11, 1, 2, 37, -57, 59, 6, 1, -69, -52, 21,
+  55, 7, -1, -1, 4, 31, 9, -27, -24, -16, 28, -19, 52, 3, -59, 58, 49, 14, -2, 46, -78, 1, 26, -28, 14, 34, -8, -40, 35, 13, 72, -10,
+  -67, 70, -37, -35, 65, -13, -71, 23, -48, 12, 25, -24, -68, -49, 23, -1, -46, -6, -95, -79, 31, 66, -7, -69, -47, 9, 27, 47, -69, -21, -104, -53,
+  38, 62, 4, -28, -46, -12, 86, 33, -74, -13, -85, 8, 30, 1, -2, 30, -79, 25, 48, -12, 11, -31, 8, -44, 18, -14, -6, -18, -76, -1, 33, 65,
+  -18, -30, -1, -31, -45, 42, -5, -13, -46, 30, 35, 85, 24, 40, -15, 101, 36, 68, -56, 36, -65, 67, 17, 76, -14, -69, -82, -15, -22, 21, -20, 11,
+  -71, 38, -31, 16, -25, -49, -99, -10, 15, 23, -71, -52, -35, -51, -37, 41, -2, -32, -6, -88, -59, 62, -19, -20, -78, -22, -56, 14, 52, -64, 6, -25,
+  -20, -4, -28, -78, -81, 44, 19, -14, -48, -94, -84, -39, -2, -31, 106, 11, -74, -69, 25, 47, 109, -8, -58, -33, 43, -14, 57, 49, -12, -47, -12, 23,
+  17, -20, -28, -48, 48, 46, 41, -50, -75, -80, 107, 8, -8, -54, -44, -90, 74, 121, 56, -27, -70, -115, -19, 127, -2, -7, -54, -31, -12, 58, 47, 21,
+  4, -64, 39, 22, 81, -17, -45, -69, -45, 11, 21, 1, -36, -110, 47, 33, 35, -77, -14, -104, -33, 0, -47, -54, -76, -2, 61, 37, 9, 12, -46, -4,
+  7, 89, 21, 38, -73, -3, 70, 1, -26, -36, -44, -4, -6, -27, -37, -11, -37, -33, 77, 14, -49, -66, -18, -104, 33, -76, -17, 36, -46, -47, -41, 16,
+  -28, -59, -29, -99, 4, 14, 12, 29, -31, -15, -52, -29, -1, 6, -5, -31, -31, -65, 19, -75, -9, -64, -25, -38, 16, 16, 21, -56, 26, -11, 37, 28,
+  -36, -112, 19, 33, -33, -24, 5, -55, 11, 21, -52, 38, -45, 4, 68, 57, -27, 17, 34, 39, -31, 62, -23, 36, 25, 24, -27, 72, -14, -19, -60, 4,
+  37, 22, 14, -3, 14, 2, -9, 36, 38, -2, -22, -41, 14, -7, 33, 6, -72, -27, -24, -25, -62, -19, -15, -46, 62, 31, -17, -48, -45, -51, 74, 40,
+  7, 8, 62, -23, 47, -21, 49, -34, 15, 47, 74, 9, 12, 28, -22, 13, 34, 31, 35, -35, -26, -14, 77, 21, 77, -26, -29, 39, 16, 22, 49, 24,
+  69, -5, 22, 7, 22, -55, 76, -51, 55, 66, -11, -22, 99, 16, 53, 15, -29, -4, 20, -90, -4, 14, -47, -76, -38, 10, 18, -40, -57, -64, -45, -8,
+  -52, 39, -23, -68, 10, -42, 14, 15, -49, -55, -7, 9, -31, -45, 2, 32, -46, 20, 9, -14, -25, -46, 8, 41, 2, -16, -43, -24, 27, 28, -23, 54,
+  -81, 23, 34, 30, -34, -29, -51, -29, -7, 40, -68, 13, -42, 7, 37, 43, -33, 53, -63, 7, -4, -7, -19, 97, -6, 33, 47, 21, 35, 95, -26, 52,
+  97, 39, -4, 2, 17, -22, 26, 3, 24, 50, 36, 39, 55, -26, -21, -15, -25, 27, 40, -8, 13, 40, -14, 29, 63, -56, 28, -27, 30, -11, 69, 25,
+  1, 6, 12, 35, 40, 52, 11, 26, 38, 19, 53, -54, -40, 9, 18, -3, 16, 24, 8, 36, -20, -58, 9, 42, -9, 0, 7, 31, 10, -47, -35, -38,
+  -32, 41, -34, 25, -18, -59, -7, 46, -44, -48, -6, -24, 3, -40, 0, 8, 9, -80, 12, 27, -50, 6, 14, -26, -27, -47, -54, 18, 51, -43, -6, 5,
+  -17, 36, 46, 9, -2, -28, 19, 50, 98, -5, -63, 22, -14, 56, -64, 48, -33, 28, -75, 46, -51, 63, -32, 94, -37, 66, 1, 74, 23, 34, 7, 25,
+  -14, 73, 51, 6, -31, 11, -47, 66, -10, 68, 27, 54, -17, 60, -22, 26, 16, 46, -12, 58, -6, -12, -7, -14, -8, 45, -65, -23, 37, -19, 50, -16,
+  -19, 26, 17, 25, 25, 25, -5, 1, 66, -23, -5, -7, 8, 64, 13, -13, 40, 36, 1, 59, 72, 4, -27, 48, -13, 61, 26, 2, -1, 14, -11, 27,
+  27, -44, -37, -15, 19, 39, 6, -19, 34, -23, -24, 58, 12, 42, -23, 42, -32, 70, 22, 68, -7, 39, 17, 62, -28, 71, 70, 28, 7, -18, 24, -8,
+  0, 59, -33, 46, -6, 47, -7, 8, 27, 14, -37, 41, 40, 50, -22, -3, -53, -4, -9, 66, -23, -34, 15, -46, -5, -6, 4, -34, 8, 4, 16, 30,
+  -21, -52, -19, -60, -22, 34, -68, 16, -25, -5, 41, 48, -66, -19, 12, 54, -7, 47, -25, -1, -60, 36, 39, 50, 13, 37, 11, 21, -4, 16, -30, 39,
+  12, 1, -68, 34, -38, 45, -26, 30, -77, -56, -117, 13, -16, 16, -68, -26, -97, -18, -26, 22, -81, -58, -59, -3, -23, -41, -27, -32, -71, 16, 6, -33,
+  -50, -11, -58, 22, 20, -18, -82, -25, -44, -37, -7, -24, -94, -49, -22, -2, -10, -33, -38, 7, -7, 24, 56, -31, -39, 19, -34, -21, 44, -16, -34, -44,
+  -42, 32, 22, -22, -68, -53, -36, -22, 2, -20, -23, -36, 26, -16, 10, 10, -33, -73, 2, 18, -1, -13, -78, -30, -11, -22, 33, 24, -38, 5, 14, -16,
+  14, 13, -8, -27, 12, 28, 58, -16, -32, -8, -34, -9, 41, -9, 3, -50, -2, -22, 45, 21, -62, -45, -10, -27, -22, 13, -41, 39, 29, -84, 1, -13,
+  -38, 17, -5, -16, 20, -43, -19, 1, 21, 3, 18, 40, 15, 13, -4, -42, -5, 65, -29, -17, -23, -56, 7, 47, 20, -45, 17, 20, -21, 82, -41, 2,
+  -19, -34, -32, 27, -45, -41, -26, -16, -16, 43, -47, -70, -27, -10, 41, 34, -46, -5, 28, 22, 57, 40, -21, -37, -34, 1, 18, 21, -9, -46, 24, -63,
+  5, 40, 3, 25, -6, -54, -18, 20, -74, -42, -38, -29, 23, 39, -53, -58, 2, -78, 62, -19, -16, -90, 2, -35, -1, -37, -6, -30, 17, -2, 17, -31,
+  -45, -63, 20, 25, -10, -17, -14, -29, -35, -18, -7, 28, -23, -12, -77, 16, 12, 27, 25, -55, 9, 15, 2, -18, -1, -15, 1, 61, -10, 50, -10, 11,
+  -49, 40, -38, 27, 37, 10, -27, 34, 29, 1, -30, 62, -40, 62, 45, -4, -70, -54, 26, -41, 16, -47, -51, -54, -4, -36, 52, -37, -60, -2, -21, 14,
+  5, -17, -82, -51, 36, 39, 28, 23, -102, -35, 4, 51, 39, 27, -71, -47, 54, 2, -22, -9, -99, -71, 39, 34, 28, -77, -101, -39, 27, -46, 54, -92,
+  -119, -25, 30, 46, 14, -29, -80, -39, 0, -8, 2, -62, -28, -11, -12, 47, 10, -40, -29, -84, -42, 9, -5, -22, -52, -23, 15, 14, -22, 4, -12, -58,
+  6, 1, 11, -26, -70, -23, 57, 9, 13, 5, -94, 14, 69, 43, 47, -3, -107, -33, -11, -14, 4, -8, -127, -7, 7, 26, 45, -3, -107, 23, -10, 19,
+  17, -25, -43, -46, 20, -28, 58, 34, -71, -18, -59, 34, 36, -32, -73, -56, -4, 50, 48, 6, -86, -17, -10, -25, 81, 48, -81, -33, -54, 42, 68, 21,
+  -58, 7, -63, 22, 26, 43, 26, -11, -78, 37, 59, 17, -15, 14, -90, 21, 39, -19, -11, 59, -54, -24, 43, 3, -9, 79, -18, 3, 51, 33, -28, 40,
+  -30, -34, 59, 9, -45, 24, 15, 7, 8, 9, -17, 61, 19, -21, 15, -37, 7, 84, 14, 25, 32, -4, -64, 42, 25, 2, 21, 41, -78, 70, 33, 67,
+  9, -31, -16, 51, -8, 70, 40, 15, -16, 19, -2, 67, -37, 30, -65, 54, -38, 39, -25, 31, 5, 70, -7, 4, 11, 27, -52, 72, -9, -23, 24, 47,
+  -99, 66, -29, 44, 23, 60, -105, -4, 8, 33, -9, -18, -75, 48, 2, 23, -4, 20, -110, 105, 8, -17, 42, 38, -111, 75, 7, 27, -10, 2, 5, 58,
+  -21, 62, 25, -18, 65, 29, -15, 5, 37, 31, 44, 62, -23, -8, -30, -3, 16, 77, -32, -5, 10, 27, -10, 2, -36, -21, 5, -34, -10, -15, -4, 28,
+  7, -14, 10, -10, -28, -38, 26, -45, -5, 27, -23, -19, 20, -41, -5, 52, -13, 24, 35, -31, 34, 77, -62, 58, 8, 37, 77, 68, 5, 14, 12, 28,
+  7, 74, -57, 19, 44, 3, 55, 79, 31, -7, 58, 13, 59, 75, 26, 23, -4, 24, -26, 92, -9, -41, -24, 75, -40, 17, 7, -28, -5, 30, 28, 15,
+  21, -35, 47, 16, 5, 121, 3, 2, -15, 2, -27, 64, -11, 8, 18, -42, -34, 100, 47, -11, -5, 3, 39, 39, 39, 51, 24, 23, 48, 27, -23, 25,
+  -14, -6, -22, 44, 7, 89, -46, 19, -27, 61, 6, 16, 3, -37, -62, 40, -31, 75, 21, -56, -20, 29, -12, 35, -26, -17, 46, 74, -14, 34, -5, -44,
+  58, 103, -12, 22, 23, -37, 27, 107, -43, -13, -27, -47, 25, 126, -17, -15, -46, -3, -49, -15, 34, -88, -36, -30, -2, 15, -24, -60, -29, -57, 4, 42,
+  26, -88, -16, 3, -14, 12, -36, -31, -102, 21, 30, 20, -49, -52, -59, -43, 48, 29, -15, -39, -40, -47, -4, 41, -28, 16, -59, -8, 33, 58, -9, 8,
+  -60, -66, 13, 40, 22, 24, -32, 11, -2, 49, 32, -34, -42, -40, -30, 21, 1, -10, 17, -1, -45, 28, -10, 13, -30, 3, 2, -32, -20, -14, -23, -9,
+  -51, -9, -1, -6, 43, 35, 11, 49, -21, 15, 36, 1, -41, 15, 6, 5, -36, -2, 2, 17, -23, -11, -7, 22, -43, -12, -36, 33, 54, 73, 8, -30,
+  21, 35, -9, 55, -39, -7, -12, -10, 12, 47, 21, -19, 22, 12, 40, -36, -26, -17, 1, 60, 46, -3, -35, -29, -28, 9, -18, 52, -20, -41, -57, 40,
+  22, 22, 45, -35, -2, -3, 22, 17, 19, 7, 22, 21, 64, -23, 11, 11, 8, 15, 67, 41, -21, -9, 13, -37, 64, -13, 15, -52, 17, -32, 32, -22,
+  48, 6, -36, 3, -66, 0, 46, -58, -41, -34, -76, 23, 5, 16, -31, -2, -19, -35, -6, 57, -42, 40, -51, 0, -3, 28, 2, 58, -9, 9, 25, -42,
+  23, -14, -27, 27, 12, -12, 3, -40, -2, 21, 64, -14, -34, 0, 10, 3, 34, -46, -55, 7, 12, -7, 51, -54, -45, -13, -26, -17, -6, 2, -24, -26,
+  -3, -56, -26, -31, 1, -21, -21, -20, 37, -12, -25, -31, 4, 29, 4, -11, -12, -38, -6, 10, -25, -75, 4, 23, -2, 9, 38, -17, 21, -4, 46, -12,
+  14, 26, 6, -35, 28, 16, 1, 5, -20, -42, 35, -40, -86, 7, -33, -67, 14, -49, -85, 53, 22, -67, -21, -35, -16, 6, -41, -36, 3, -30, -12, 29,
+  -24, 8, -20, -21, -23, -5, -81, 38, 6, 44, -50, 1, -88, 30, -53, 4, -52, -6, -79, 36, -41, 17, -37, -14, -86, -43, -65, 44, -2, 4, -13, -40,
+  -18, -32, 10, 0, -10, 6, -55, 22, 15, 18, 22, 34, -41, -8, -9, -41, -20, -29, -27, 42, 42, -4, 17, -12, -24, 11, 39, -35, 19, 37, -20, 21,
+  -42, 21, -8, 13, -18, 28, -8, 30, -22, -6, -75, 9, -43, -2, 11, 8, -43, 70, -25, 37, -1, 46, 12, 61, -6, -4, 27, 2, 30, 3, -17, 34,
+  19, -12, -29, -7, -41, -24, -3, -12, -24, 13, -85, -15, 31, 1, 40, -12, -70, -22, 12, -23, 23, -38, -60, 27, -6, 17, 5, -48, -11, -3, -12, -1,
+  17, -24, -17, -15, 19, 27, -22, 21, -42, -24, 0, -19, -14, 19, -18, -12, 43, -34, 38, 38, -26, -34, 37, 2, 49, 17, -24, 13, -18, -49, 40, -18,
+  -6, 73, -35, 22, -8, -40, 27, 56, 37, -1, -13, -38, -26, 29, 34, -38, 17, -29, 24, 39, 32, -48, -38, -70, 33, 36, -9, -33, -22, 11, 34, 10,
+  4, 17, -40, 3, 27, 35, 5, 26, 8, -26, -28, 79, -35, 47, -45, -65, -27, 52, -11, 10, 23, -33, -1, 46, 4, -12, -51, -50, 33, 30, -38, -19,
+  -31, -8, 48, 9, -47, 5, -33, -72, 11, -52, -63, 11, 0, -29, -5, -57, -12, 25, 16, -6, 44, -66, 16, 55, 27, -25, 13, -35, -6, 65, -9, 32,
+  51, -49, 24, 15, -22, 20, 37, -67, -29, 44, -28, 31, 16, -26, 7, 3, -31, 27, -5, -79, -30, -7, 0, 15, -36, -51, -16, -13, -29, 40, 2, -46,
+  -35, -44, -41, 47, -20, -85, -8, -3, 20, 53, -7, -9, 20, 0, 47, 61, -41, 2, 8, -39, 15, 75, -72, -20, -9, 5, 39, 50, -42, -34, 17, -16,
+  28, 22, -81, -50, -47, 2, -10, 78, -27, 20, -10, 33, 29, 73, -34, 43, -10, -32, -10, 26, -14, -6, -55, 9, 17, 15, -37, 38, -2, -34, 43, -48,
+  42, 5, -22, -42, 31, -60, 54, 15, 17, 8, 16, -40, -33, 11, -34, -31, 68, -20, 22, 35, -11, -31, 59, 6, -41, 10, 4, 30, 47, 13, -32, 45,
+  1, 19, 31, 34, -2, 29, -37, 39, 60, -21, 2, 38, -12, 14, 66, -23, 11, -6, -58, 25, 27, 34, 44, 35, -29, 30, -10, 53, 68, 34, -60, -8,
+  -22, 59, 42, -26, -40, 18, 30, 28, 33, 2, -1, -40, -26, -2, 15, 34, -9, 25, -24, 54, -3, -19, -33, -6, -12, 39, 45, 6, -18, 26, 10, 75,
+  25, 7, -40, 61, 12, 108, 55, -32, 39, -49, 62, 6, 34, -25, 13, -19, 7, 18, 13, -54, 42, -58, 58, 1, -19, -37, -21, -6, 24, 37, -20, -6,
+  -16, -36, 32, 43, -45, -13, 43, -24, 30, 25, -2, 17, 8, -29, -4, 50, -23, 12, 3, 11, 37, 23, -70, -16, 23, -36, -8, 27, -57, -24, 29, -20,
+  -16, 49, -39, -29, 19, -47, -28, 31, -24, -15, 8, -27, -46, -42, -11, -42, -26, -54, 18, 0, 20, -35, -23, -35, -30, -26, -2, 35, -83, -42, -17, -74,
+  40, 13, -77, -27, 30, -110, 37, 72, -4, 43, -16, -91, -16, 51, 10, -4, 58, -98, -6, 12, -24, 44, -2, -109, -2, -20, 28, 63, 14, -69, -49, -44,
+  -66, 57, -3, -67, -32, -57, -30, 100, 23, -27, -13, -3, -106, 127, 6, -50, 60, -50, -68, 55, 17, 6, -25, 25, -8, 8, -10, 33, -41, 62, -40, -24,
+  45, 33, -26, 22, 29, 10, 17, 13, -49, 38, 8, -41, -17, -38, -29, 49, -41, -23, 38, -60, -48, -49, 8, 55, 50, -54, 24, 24, 7, -26, -17, -70,
+  -20, -68, 3, 42, 14, -34, -6, -19, 68, 50, -42, -56, 12, -53, 11, 54, 13, -21, 11, -72, 49, 2, -33, -2, 21, -82, -26, 1, 10, -7, 25, -27,
+  -14, -55, 14, 1, -19, -77, 15, 16, -20, -8, 5, -39, -17, 7, 34, -60, 31, -69, -20, -52, 62, 4, 57, -24, 8, -46, 51, -3, 46, -12, -24, 15,
+  -2, 32, -1, 18, 6, -19, -12, -26, -28, 65, -18, -38, -34, -3, -26, 7, -35, -11, 29, 4, 4, -27, 59, -27, 19, -41, 32, -45, 5, 4, 12, -19,
+  -26, -51, 28, -44, -6, 1, -24, 52, 11, 49, -45, 43, 35, 55, 45, 17, -28, 66, 22, 37, -24, 34, -45, 12, 5, -9, 15, 26, -21, 53, -38, 16,
+  46, 89, -56, 43, -7, -28, -30, -2, 117, -30, -11, -41, -22, 32, 111, -54, -12, -10, 8, 29, 119, -39, 9, -61, -21, 12, 81, -50, 24, -2, 2, 24,
+  111, -39, 24, -62, 13, -13, 89, 6, -2, -11, -24, -31, 22, -27, 26, 17, -49, 64, 40, 43, -52, -16, -29, 59, 33, -14, 26, -22, -30, 30, 31, 10,
+  -40, -58, -54, -12, 36, 6, 2, -50, -32, 53, 48, -30, -4, -44, -57, 4, 96, -36, 29, -3, -64, 23, 82, -18, 36, -74, -46, 69, 13, -51, -49, 5,
+  59, 11, 9, 36, -17, -6, 41, 9, 84, -51, -32, -44, -38, 72, 75, 2, 26, -39, -27, 36, 58, 49, 84, -19, -24, 6, 40, -19, 57, 56, 1, -11,
+  42, -8, 10, 37, -28, -5, 11, -10, -18, 17, 3, -10, -8, 1, 47, 37, 61, 31, 29, -5, -30, 65, 18, 19, 88, -15, -23, 74, 3, 53, 95, 48,
+  -7, 69, -15, 44, 94, -8, 20, -19, -17, 41, 62, 21, 32, 27, -36, 49, 41, -9, 7, -30, -28, 13, 80, -5, -43, 21, -36, 44, 48, 11, -33, -35,
+  -27, 26, 84, 22, 22, -19, 21, 50, 19, 54, -30, 10, -46, 44, 42, 5, -50, -12, -4, 56, 44, -2, -14, 24, -34, 2, 36, 0, -27, -5, -6, 30,
+  50, 79, 41, -21, 28, 10, 35, 56, 34, -18, 17, 73, 4, 13, -48, -74, 23, 39, -27, 54, -46, -10, 9, 1, 20, -13, -2, -1, -18, 50, 22, 55,
+  19, -49, -42, 71, -57, 53, -43, 3, -51, 8, -59, 31, -43, 7, 10, 56, -36, 50, -43, 71, -43, 46, 75, 21, 15, 18, -11, 59, 114, 36, -27, 1,
+  -2, 40, 44, -6, -34, 23, -11, 35, 44, -2, 6, -35, -15, 18, 8, 3, -69, -60, 31, 23, 60, 27, -23, -31, -25, -41, 54, -23, 41, -67, 25, 28,
+  69, 38, -5, -20, -51, 33, 36, -5, -3, 32, -43, 11, 12, 14, -18, -20, -23, 46, 5, -15, 12, 32, -47, 15, 57, 23, -3, 10, 10, 33, -41, 95,
+  -7, -27, 42, -14, 25, 35, 19, 5, 1, 33, -14, 102, 0, 33, 22, 16, -20, 53, -41, 9, -50, -29, -19, 45, 12, -40, -46, -52, 27, 71, -55, -7,
+  21, -16, -16, 18, -11, 11, 12, -38, -14, 33, -64, -30, 28, -28, -34, -46, -47, 30, -13, -55, -16, 16, -30, 7, 4, -64, 10, 55, -29, -40, -46, -27,
+  -38, 28, -65, 14, -12, 50, 17, 55, -69, 44, -33, 31, 10, 44, 16, 26, 0, 50, -45, 82, -30, 95, -3, 18, -14, 21, -32, 127, 7, 28, -29, 48,
+  -52, 36, -28, 26, -13, 39, -16, 45, 28, 60, -72, 41, -43, 50, 31, -20, -72, 64, -67, 11, -46, 9, -5, 31, -9, 12, 11, 49, 7, 28, -21, 2,
+  30, -33, 14, 42, -81, -44, 31, -41, 7, -28, -11, -22, -25, -7, 42, 1, -56, 17, -20, 35, 3, -29, -28, 8, 14, -3, -9, 11, -41, 9, 33, 0,
+  21, -1, 38, 13, -1, 9, -15, 34, 10, 9, 2, -31, 16, 72, 15, 17, 27, -11, 6, 75, 15, -46, 10, -36, -15, 35, -49, -56, 62, -65, -7, 20,
+  -32, 6, 99, -9, 20, 11, 39, 49, 32, -12, 18, -21, 44, -36, 67, -15, 28, 14, 31, -23, 28, -74, 38, -25, 20, -45, 9, -53, -18, 2, 22, 22,
+  37, -5, -24, -9, 45, -6, -32, -13, -47, 27, 51, 41, -32, -52, -9, 39, 59, -19, -29, 17, -14, 19, -20, 4, 42, 36, -20, -30, 18, -34, 50, 32,
+  -28, -32, -22, -16, 42, 5, -35, 6, 68, 14, -31, 47, 19, 11, 77, -17, -19, 55, -31, -38, 42, 25, 15, 37, 37, 14, 59, -12, -30, -24, -4, 25,
+  58, 17, 21, -9, -25, 25, 64, -1, 22, -16, 34, 21, 34, -20, 26, 43, 40, -6, 50, -17, -28, 1, -4, -31, -5, -6, -3, -6, 29, -48, 51, -13,
+  -24, -38, -54, 23, -16, -9, 30, 4, 10, -49, 5, -87, -42, -48, -9, -24, 37, -93, -12, -45, -62, -42, 47, -31, -13, 11, -1, -39, 39, -88, -63, -33,
+  -61, 0, 59, -35, -67, -21, -23, 16, -14, -75, -10, -65, -67, 54, 0, -19, 24, -67, 14, 9, 36, -1, 38, -40, -69, -3, 37, 24, 64, -22, -6, -50,
+  -10, -11, 27, 13, -49, -16, 21, -14, -13, -20, -19, -37, 31, 17, 15, 24, 23, -2, 21, 21, -13, 54, 16, 55, -42, -37, -11, 12, 30, 44, -32, -32,
+  -46, 56, 22, 27, -4, -9, -49, -1, 52, 45, 28, -9, -15, 3, 67, 11, 24, -18, -42, 58, 4, 23, -7, 42, -36, 28, 16, 41, 42, 33, 7, 48,
+  -32, 40, 18, -1, -19, 74, 59, 40, -21, 3, -43, 10, 26, 39, -22, 68, -4, 33, 17, 41, 5, 51, -18, 31, 34, -1, -11, -65, -85, 44, 36, 37,
+  -6, -31, -13, -3, 65, 18, 1, -57, -39, 5, 44, 0, 30, -34, -89, -65, -29, 14, -17, -10, -85, 3, 29, -27, 19, -41, -63, -78, -34, -21, -13, -4,
+  -32, -38, 33, 14, -12, 7, -39, -43, 25, -72, -29, 29, -81, -102, -7, -71, 34, -8, -23, -9, -15, -65, 40, 54, -63, -74, -14, -50, 5, 64, 29, -80,
+  -46, -9, 0, 5, -50, -35, -23, 9, 20, 54, -4, -15, 39, -66, 13, 26, -42, -32, 4, 3, -47, 8, -16, 15, 16, -35, -20, -12, 17, -24, 62, 42,
+  -46, 20, -45, 9, 49, 1, -46, 1, -19, -48, 21, -55, 13, -57, 27, -18, -25, -7, 19, -35, 0, -2, 40, -12, 46, 0, -1, 20, 36, -37, 20, -23,
+  18, 7, 11, -52, -29, -23, 46, 23, 5, -30, 31, -54, -13, 23, 15, -49, -6, -15, 32, 27, 71, 4, 4, -42, 33, 4, 20, 25, -22, -40, 73, 51,
+  29, -6, -64, -56, 27, 1, 50, 1, -59, -9, -10, 27, 68, 1, -11, -66, 63, -65, 51, 52, -48, 1, 71, -71, -1, 1, -17, 1, 45, -63, -38, -51,
+  -76, 13, -21, -82, -44, -56, -105, -2, 28, -61, 32, -29, -80, 20, 20, -20, -32, -71, -46, -36, -16, -50, 26, -91, -83, -16, 11, -50, -28, -127, -94, -89,
+  2, -44, -47, -22, -45, -7, -43, 53, -5, -71, 10, -42, -87, 62, 14, -33, -7, -78, -88, 64, -28, -29, 48, -57, -16, 32, -19, -32, 72, -45, -15, 13,
+  25, -18, 47, 67, -35, 52, -21, -61, 34, 44, -14, 19, -6, 22, 41, 31, 42, 43, -5, -17, 17, 71, -54, -13, -16, -59, -30, 67, 8, 35, 16, -26,
+  8, 117, 47, 32, -58, 6, -7, 83, -10, 32, -46, -9, -41, 69, -9, 2, -25, -31, -7, 68, -6, 31, -51, 18, -68, 69, 34, 87, -47, -40, -3, 81,
+  12, 39, -19, -29, -80, 53, 38, 78, -1, 42, -20, 14, 13, 71, -65, 48, -52, 27, 52, 74, -42, 29, -45, -7, 15, -7, 29, 91, 27, 39, -99, 0,
+  8, 96, 57, 10, -33, -46, 12, 26, 59, 2, -29, 17, -35, 88, 14, 12, 5, -6, 7, 64, 19, 87, 9, -91, -4, -1, 38, 59, 23, -5, 17, 56,
+  -5, 57, -67, -56, 21, 61, 43, 26, -1, -58, 27, 13, 14, 42, -4, -39, -23, 45, 42, 22, -3, -94, -39, 45, -4, 41, 73, -31, -28, -27, 41, 11,
+  17, -73, -37, 36, -19, 28, -9, -39, 31, -14, 17, -38, 56, -28, -1, -63, 30, -28, -7, -52, -24, -6, -13, -7, -14, -47, 14, -40, -20, -66, -15, -16,
+  31, 20, -18, -23, -10, -43, 49, 36, 13, -31, -27, -48, 24, -19, 0, -36, -21, -40, -15, -23, 48, -22, -21, 18, -25, 12, -27, -42, -7, -37, -50, 20,
+  3, -33, -27, -76, -37, 50, 13, -99, -23, -87, -81, -24, 10, -86, 36, -50, -66, -20, 56, -77, -24, -23, 1, 27, 9, -43, 34, -69, -24, 2, 2, -44,
+  29, -54, -23, 43, 30, -83, 39, -3, -54, -34, -20, -100, 17, -42, 33, 20, 6, -56, -20, -28, 31, 37, 2, -48, 47, 30, 6, 20, -1, -89, -45, -12,
+  -38, -40, -11, -28, -1, -32, 36, 26, 2, -97, -21, 8, 48, -60, 8, -64, 16, -31, 11, 7, 43, -31, 9, 58, -12, 51, -16, -9, 16, -7, 31, 39,
+  -44, -53, 58, 51, 17, 19, -3, -15, 34, -3, 47, 53, -6, 48, 26, 70, 39, 38, -48, -26, 29, 49, -2, 35, -29, 9, -11, 44, 8, 3, -27, -57,
+  30, -19, 39, 11, -52, 5, 31, 65, -29, -25, 25, -66, -28, 20, -41, 14, 46, -18, 0, 1, -16, 7, -33, 22, 38, 26, -20, 16, 29, -20, 15, 22,
+  20, -29, 5, 45, -3, 54, 18, -34, 21, 12, -32, 35, 13, -48, 0, -16, -41, 53, 41, -33, 22, 3, 21, 6, 23, -22, 20, -38, -22, 35, 46, 24,
+  30, -6, -16, 72, -22, -18, -7, -38, -29, 73, -31, 56, 29, -35, -22, 8, 14, 66, 33, -61, 38, 43, -2, 59, -33, 24, 24, 24, -44, 31, -23, -4,
+  -8, 32, -12, 27, 19, -27, 22, -31, -17, 63, 10, 8, -19, -5, -21, -11, 22, -41, -7, -48, -23, -23, 14, -36, 30, 0, 14, -1, 67, -1, 47, -24,
+  -1, 25, 19, -5, 17, -70, 23, 39, -19, -16, 17, -9, 58, 28, 44, 40, 42, -9, 46, 23, -7, 25, 42, -23, -12, 24, -5, -23, -6, -7, 29, 33,
+  1, -21, 26, -16, -12, -58, -28, -60, 4, -69, -6, -39, -22, -20, 30, -42, -34, 9, 7, 13, 12, -77, -28, 20, 14, -60, 40, -5, -13, 30, 37, -21,
+  29, -71, -47, 7, -4, 20, -6, -59, -17, 16, 17, 11, 10, -30, 5, 1, 1, 5, -40, -51, -8, -11, 30, 7, -30, 5, 3, 13, 32, 31, 12, -46,
+  9, -17, 29, 38, -16, -22, -24, -16, 12, -4, -23, -24, 15, -3, -25, 22, 11, -18, -29, -32, -17, -4, 30, -6, -10, -11, 7, -1, -7, -27, -1, -7,
+  12, 19, -25, 14, 6, 22, -17, -26, -4, -2, 22, 2, -22, -31, 0, 2, 1, 21, -18, -11, 35, 5, 3, -2, -34, -24, 5, -14, -19, 33, -9, 9,
+  -6, 1, 0, 29, -14, -19, -19, -4, 15, 10, -12, -19, 25, -26, 11, -1, -31, -35, 30, -20, 30, -7, -28, -65, -14, -23, 5, -3, -35, -67, 3, 6,
+  -18, 36, 7, -56, -40, 15, 23, 16, -17, 1, -36, -20, 39, 3, -3, -4, -34, -22, 6, 2, 30, -24, 1, 11, 22, 12, 24, -59, 20, -21, 16, 41,
+  -20, -19, 15, -11, 4, 24, 20, -40, -10, -18, 54, 49, 19, 16, 10, -35, 17, -32, 48, -37, -24, -20, -2, -20, 7, -46, 13, 17, -9, -45, 23, -36,
+  0, 3, -4, -26, 10, -7, -33, 5, 13, 6, -7, -7, -37, -21, -14, 36, 8, -51, -1, 7, 31, -7, 15, -14, -8, 27, -33, 14, 3, -33, -28, -21,
+  15, 23, 15, -43, -27, -1, -8, 24, 33, -43, -1, -27, 18, 15, 33, -38, -26, -11, -14, -23, 26, -68, -24, 0, 13, 1, 19, -72, 19, 32, -6, 34,
+  -21, -67, -4, 10, 28, 1, -15, -15, 25, -27, 48, -18, -29, -57, -15, -7, -5, 14, -25, -33, 1, 13, 26, 52, -35, 2, 8, 15, 14, 19, -50, -27,
+  -48, -6, -7, 21, -33, 28, -34, 0, 1, 39, -6, 4, -67, -28, 19, 52, 28, 2, 3, 6, 7, 22, -10, 1, -30, -9, -42, 23, -4, 42, -20, -6,
+  -5, 13, 14, -18, -27, -20, -22, 29, 27, -12, 4, -17, -6, 24, 5, 4, -12, -1, -5, 7, 46, -8, 2, -31, 22, -20, 39, 16, -14, -5, 28, -8,
+  40, 11, -3, -13, -3, -15, 21, -1, 4, -1, 29, 8, 16, -2, 5, -14, -4, 2, 22, 26, -2, 10, 8, 31, 19, 25, 19, 5, 7, -9, -30, -7,
+  2, 30, 14, 35, 19, 15, -18, 35, 31, 20, 26, -15, -24, 14, 21, 10, 7, 10, -8, 8, 6, 50, 26, 38, 26, 33, 14, 14, 27, -7, 13, 8,
+  -29, 27, -13, 25, 19, 41, -7, 45, -24, 26, 30, 21, -19, 10, 16, 2, 0, 0, -28, 28, -35, 2, 15, 14, 16, 44, -23, 6, -9, -27, -53, 6,
+  -16, 28, 8, -62, -21, 17, -44, 17, -23, -33, -19, -38, -44, 25, -26, -39, -41, -31, 12, 57, 16, -52, -44, -4, -13, 37, -9, -13, -38, -40, 32, 3,
+  15, -4, -29, -16, 35, 36, 21, 13, -43, -21, 24, -10, 42, -2, -13, -27, 17, -7, 39, -5, -22, -39, -8, -33, 60, -26, 4, -51, -49, -27, 32, 8,
+  -11, -50, -13, -33, 43, 24, -31, -43, 16, -48, 16, -16, -9, -25, 43, -45, -11, 18, -11, -22, 25, -37, 35, -11, -9, -19, 33, -24, 12, -14, -26, -27,
+  13, -32, 66, -26, -15, -13, 31, -44, 62, 11, -20, -17, -10, -46, 48, 5, -17, -14, -17, -39, 71, 25, 2, 8, -17, -28, 49, 9, 21, -20, -30, 28,
+  27, -3, 17, 5, -39, -5, 20, 38, -13, -9, -23, 4, 38, -14, 16, -28, -43, 28, -10, 18, 15, 6, -45, 23, 19, -1, 30, -25, -35, 18, 1, 26,
+  47, -16, -31, 5, -4, 28, 27, 10, -45, -39, -23, 47, 52, 3, -35, -21, -43, 20, 21, 4, -20, -67, 10, 11, -3, 11, -45, -42, -24, 0, -5, -24,
+  -14, -32, 0, 6, 15, -6, -32, 4, -17, 31, 19, -4, -7, -28, -3, 36, 20, -13, -37, 24, 7, 37, -13, -2, -42, -5, 40, 6, 0, -24, -51, 28,
+  11, 38, 17, 1, -27, -19, 18, 35, 40, -32, -45, -5, 36, 47, 26, 2, -37, 27, 48, 13, 25, -12, -76, -23, 5, 46, 48, -12, -54, 7, 22, 29,
+  34, 4, -66, 4, 5, 32, 52, 18, -37, -4, -13, 36, -21, -8, 21, -64, 10, 41, 20, 25, 24, -43, 12, 60, 35, 7, 0, -19, -17, 16, 17, -16,
+  -26, 9, 7, 54, -2, -13, -15, -18, -20, 20, 3, 20, 5, 11, -46, -4, -12, -2, 21, -16, -8, 17, 2, 9, -3, 5, -39, -16, -9, 17, 11, -5,
+  -42, -1, -12, -4, 24, 0, -25, 5, -21, 38, -1, 18, -15, 7, 13, 1, 21, -5, -41, 34, 20, 2, 16, -27, 2, 14, -31, 16, 20, -57, -29, -16,
+  -12, -10, 24, -29, -31, 11, 6, 25, -27, -32, -8, 10, 7, 0, -8, -55, -2, -14, -2, -8, -18, -13, -27, 28, 12, -28, -4, -14, -61, 18, -25, 8,
+  -21, -1, -76, 6, 2, -23, 6, 59, -71, 21, -17, -14, 10, 34, -40, 3, 13, 3, -23, 41, -47, -7, -22, -16, -1, 66, -45, 17, -31, -40, -16, 26,
+  -9, -3, -19, -45, -42, 40, -30, 10, 13, -33, 5, 41, -38, -5, 1, 18, -12, 7, -61, 6, -2, 28, 16, 35, -98, 38, -32, 28, 34, 24, -127, 0,
+  -1, 22, 23, 8, 45, -86, -30, 15, 27, -29, 39, -82, -5, 1, 5, -53, 50, -93, -16, 40, 2, 7, 14, -46, 11, 57, 42, -12, 1, -26, -16, 54,
+  5, -11, 66, -65, -11, 54, 10, 5, 73, -32, 15, -15, 24, -58, 59, -52, 14, 36, 39, -63, 60, -53, -37, -4, 25, -21, 10, -36, 26, -48, 24, -17,
+  75, -51, 35, -50, 0, -15, 39, 20, 0, -33, -48, -48, 88, -25, -22, -30, -53, -15, 20, 7, 27, -74, -5, -9, 26, 16, 2, -63, -26, -40, -3, -29,
+  -1, -47, -31, -40, 42, -4, 17, -66, 6, -35, -6, 62, 41, -32, 32, -55, 45, 67, 2, -12, 42, -48, -7, 57, 36, -17, 12, -2, 41, 71, 33, -30,
+  7, -49, -24, 77, 24, 16, 7, -29, 26, 64, -31, 1, -16, -54, -19, 2, -1, -28, -14, 5, 0, 67, 10, 22, -17, -10, 9, 44, -16, 52, 1, -7,
+  -25, 39, 7, 3, 14, -1, -12, 64, -24, 11, 37, 15, -4, 29, -1, 35, -3, 11, -22, 59, 1, -30, 19, -5, 22, -8, -1, -26, 59, -50, 64, 30,
+  -7, -63, 25, -71, 72, -7, 7, -68, 49, -54, 34, -1, 20, -35, -3, -75, 68, 1, 1, -70, -18, -7, 44, 5, -6, -84, 6, -23, 49, 66, 22, -55,
+  21, 10, -22, 71, -52, -60, 12, 27, -12, 89, -34, -30, 9, 32, 4, 55, -51, 21, 29, 29, 40, 111, -42, 46, 24, 43, 22, 49, -14, -16, -30, -31,
+  35, 6, -9, 27, 0, -37, 20, 12, -41, -25, -45, -44, -9, -1, -49, 29, 15, -28, -39, 23, -14, 39, 22, -29, 18, -10, -3, -14, 15, -14, 11, 2,
+  16, -30, -13, -38, -24, 54, 32, -25, -5, -2, 34, 10, 1, -24, -22, -24, 31, 40, 31, 6, 34, -12, -9, 27, -2, 27, 27, 27, -3, 19, -13, -9,
+  1, 40, 3, 48, 2, -17, -10, 30, -15, 26, -13, -11, 15, 10, 15, 50, 45, -33, -5, -12, 55, 33, 4, 18, -15, 23, 6, 59, -43, -3, -34, -16,
+  15, -13, -5, 17, -20, -3, -18, 34, -29, -9, 0, -28, 28, -20, -61, -55, 8, -14, 21, 18, -2, -46, -21, 4, -24, -18, -19, -30, 3, -47, -32, -11,
+  -12, 9, 6, 24, -14, 41, 10, -14, 33, 28, -4, 15, -43, -27, 46, 55, -37, 25, -32, -13, 31, 40, -4, -16, -16, 7, -14, 63, 11, 27, -31, 2,
+  36, 50, 15, 7, -32, 15, -14, -10, -12, 10, -4, 25, -2, -26, -32, 36, -83, -11, 8, 16, -17, 27, -49, 23, -34, 21, 14, 29, -75, -42, 14, 54,
+  -18, 44, 13, -9, -59, -29, -19, 0, 28, -44, -44, -50, -58, 13, -3, 20, 2, -62, -72, 40, 12, -39, -29, -37, -20, 17, -52, -6, 22, -16, 10, 35,
+  -18, 0, -24, -47, 51, 38, -10, 46, -29, -57, -21, 35, -1, 82, -22, -38, -4, 21, 43, 46, -26, -54, -37, 61, 31, 17, 26, -3, 15, 43, 9, 56,
+  -44, -15, -37, 36, 17, 58, -18, -6, -33, 0, 66, 19, -13, 5, 13, -64, 29, -5, -62, 8, 2, -24, 51, -19, 17, -30, -33, -11, 64, 36, -27, -67,
+  -31, -36, 25, 14, -16, -64, -53, -45, 41, 75, 8, -60, -10, 11, 49, 52, 9, -58, -45, -50, 79, 38, 49, -31, -69, -60, 60, 19, 44, -9, -28, -42,
+  32, 0, 53, -39, -5, 0, 11, 31, -7, -37, -30, -39, 26, 1, 47, -127, -44, -71, 33, 28, 32, -120, -15, -24, -5, -11, 44, -73, -19, -95, 11, 29,
+  11, -90, -2, -48, -15, 2, 35, -41, -50, -26, -9, 10, 50, -58, 13, -56, -37, 4, 39, -74, 10, -19, -42, -19, 16, -54, 12, -29, -34, 31, -17, 22,
+  2, -42, -32, 51, 38, -15, 12, -47, -4, 25, -21, -21, -25, -6, 20, 7, -57, 10, -24, -7, 18, 12, -19, -17, -48, -12, -31, 74, -12, 59, -59, -44,
+  14, 16, -44, 32, -16, -35, 20, 31, -30, -14, 12, -78, -35, 16, -45, 35, -6, -72, 32, 15, -70, -12, -17, -72, 28, -28, -44, -14, 12, -88, 6, -9,
+  -49, 27, -7, -69, 47, 22, -34, -54, -25, -62, 32, -26, -16, -19, -6, -68, 52, -15, -25, -78, 13, -72, 14, -30, 14, -28, 11, -35, 29, -35, -47, 3,
+  17, -64, 33, -35, 11, -42, 49, -36, 55, 2, -8, 30, 65, 32, 19, -50, 30, 12, 36, 21, 22, 10, 9, 13, 56, 3, 21, -28, 4, -22, 45, -17,
+  -3, 17, 24, 5, 28, -11, 15, -26, -2, 3, 12, 3, 26, -41, 39, -22, -35, 1, 34, 31, 48, 3, 7, -10, 40, -21, 40, -1, -31, -47, 18, 31,
+  21, -15, -32, 10, 0, 0, -35, 0, 10, -34, 51, 42, -17, -15, -16, -24, 6, -8, 9, 12, 8, -19, 21, -42, 10, -40, 41, -74, 18, -30, 56, -31,
+  51, -36, -42, -7, 13, -62, 25, -37, 4, 18, 36, -56, 30, -27, -17, -50, 3, -31, -2, -25, -23, -20, 64, 7, 5, -43, 11, 4, 0, -11, -1, 9,
+  -43, 52, 58, 27, -20, 2, -23, 46, 43, 20, -29, 46, -32, 42, 8, -27, -6, 13, -37, 16, -16, -60, -22, 60, -55, 4, -40, -1, -3, 10, -65, 65,
+  -3, -99, 60, 56, 0, -67, 7, -30, 33, -22, 32, -69, -27, -14, 27, 11, 45, -50, -5, 27, 21, 58, 16, -23, -62, 60, -18, 6, 22, -48, -53, 95,
+  -66, -28, 21, 4, -47, 75, -70, 2, 34, 8, -55, 66, -90, 57, 60, -34, -35, 19, -32, 15, 13, -61, -19, 72, -78, -18, 12, -59, -44, 8, -7, -70,
+  5, -28, -59, 7, -31, 0, 55, 35, -10, 19, -55, 27, 77, 50, -37, 27, -71, -12, 68, 47, -27, 40, -54, -44, 13, -21, -59, 43, 9, -102, -35, 6,
+  18, 83, -87, -56, 39, -1, -6, 70, -68, -87, 10, -16, 24, 38, -75, -35, -1, 53, 28, -4, -30, -56, -47, -11, -41, 47, 13, -95, -72, 4, 13, 20,
+  38, -14, -37, -12, -46, 29, 32, 9, -47, -16, -52, 5, -52, -13, -17, 35, -65, 43, -81, -13, -43, -33, 16, 112, -27, 3, 55, 4, -27, 31, -75, -25,
+  -7, 1, -2, 10, -18, -24, 50, -54, -30, -23, -58, -57, 57, -57, 45, -16, -3, -79, 115, -72, 12, -8, -23, -40, -56, -21, 18, -12, 16, -45, -90, 39,
+  -85, 36, 30, -18, -37, 34, -51, 37, -24, -31, -57, 0, -54, 38, -28, -45, -77, -21, -41, 45, -88, -44, -37, 15, 16, -20, -78, 17, 1, 69, 49, -96,
+  -25, -68, -74, 24, -27, -49, -76, -38, -39, 31, 52, -35, -68, -51, -3, 96, 41, -10, -57, -65, -6, 17, 16, -18, -25, -99, -46, 20, 37, -85, 37, -88,
+  -24, -35, -6, -48, 42, -43, -29, -36, -24, 19, 39, -25, -56, -49, 15, 1, -35, -50, -41, -78, 38, 74, 51, 20, -31, -26, -5, 109, 3, -49, -12, 5,
+  15, 67, -17, 30, -36, 15, -8, 93, 41, -24, -84, -12, 0, 87, -45, 47, -59, -29, 79, 72, -5, -26, -48, 25, 44, 70, 33, 26, -30, 25, 37, 77,
+  29, -1, -65, -39, 21, 69, 60, -43, -34, 25, -1, 55, 16, 11, -102, 0, 30, 81, 19, 23, -51, 22, -21, 70, -14, -36, -93, -57, 22, 20, 13, -48,
+  -87, -33, -26, 74, 47, 10, -2, 52, -29, 29, 23, 44, -65, 55, -39, 10, -21, -5, -13, -18, 1, -4, 15, -51, -51, 56, -33, 52, 44, -27, -66, 57,
+  8, 13, 4, -21, -56, -21, 20, 54, -1, 1, -105, -8, -45, -17, 25, -39, -63, -11, -10, 11, 49, -44, -65, -17, 8, 53, -24, -45, -50, 55, 60, 36,
+  -18, 33, -52, -31, 31, 37, 30, -40, 20, 0, 84, 26, 81, -37, 38, -40, 4, 82, 57, 3, -30, -43, 28, 87, 113, -20, 4, 15, -33, 39, 91, -31,
+  -31, -22, 14, 81, 29, 18, -48, 61, 18, 9, 27, -22, -24, 22, -20, -1, 58, 2, -6, 72, -17, -63, 69, 20, -47, 0, 16, -56, 10, -5, 4, -43,
+  7, -22, 3, 27, -49, -16, 48, -34, 58, -3, -76, -49, 3, -34, 80, 5, -76, -58, -56, -27, -7, 11, 1, 31, -57, -61, 66, 1, -58, -58, -68, -45,
+  39, -13, -29, -30, -94, -49, 35, 46, -46, -73, -69, -87, 13, -12, 27, 11, -37, -107, -12, 68, 50, 5, -17, -92, -67, 10, 64, 1, -70, -8, -1, 1,
+  17, 23, -37, -32, -1, 63, 8, -30, -82, -61, -36, 47, 80, -21, -69, -64, -49, 36, 72, -65, -70, -9, -49, 61, 40, -60, -27, -33, 13, 40, 15, -55,
+  -83, 18, -22, 21, 74, -17, -18, -35, -20, -1, 51, -52, -16, 50, -50, 55, -6, 19, -34, 60, 2, 32, 45, 53, -94, 56, 1, 76, 50, 29, -100, 5,
+  15, 38, 10, 43, -11, 61, -7, 64, 39, 50, 12, 112, 18, 60, -11, 38, -62, 82, 37, 19, 48, 38, -80, 56, 76, 32, 71, 20, 10, 30, 44, 31,
+  60, 6, -80, 24, 19, 63, 21, -13, -83, 17, -14, 50, -10, 16, 11, -19, -32, 52, 53, -29, 25, -13, 46, 63, 9, -2, 15, -43, 8, -1, -21, 34,
+  -27, -7, 15, -25, -35, 22, 3, 9, 105, 43, -30, 90, 2, -45, 53, -48, -51, -12, -36, -26, 31, -62, -32, -1, -41, -58, 21, 1, 38, 21, -45, 25,
+  39, 16, 1, -8, -21, 12, -11, 16, 38, 25, -36, 43, 17, -27, 78, 27, -16, 71, -57, 54, -3, -4, 9, 32, -36, 61, -45, 5, 34, 23, -76, 16,
+  -44, 27, 15, -17, -23, 45, 23, 19, 5, -8, -27, 52, 41, -85, 8, 2, 33, 41, -4, -94, -10, -16, 29, 26, 9, -89, -19, -7, 2, 15, -16, -73,
+  26, 55, 11, 41, -14, -70, 32, 45, -9, 29, 9, 18, 47, -19, -8, 98, -24, -8, 23, -21, -30, 21, 49, 19, 18, 29, -13, 10, 4, -32, 4, 43,
+  0, 25, 59, -36, 19, 33, 21, 31, 60, -11, 37, -17, 29, 9, 38, 60, 53, -5, 36, 52, 20, 60, -44, 31, -13, 44, 12, 76, -56, 10, 3, -8,
+  70, 82, -73, 29, -34, 22, 12, 71, -47, 38, -4, -37, 2, 2, -67, 46, -22, -6, -33, 64, -1, 55, 6, -21, -44, 16, 0, 33, -78, -10, 15, 30,
+  -53, 15, -53, -58, -57, -12, -33, -11, -27, 38, -78, 8, 27, -67, -88, -10, -42, -71, -19, -59, -103, -25, -49, -13, 14, -33, -121, 50, -3, -23, 48, 32,
+  -91, 52, -31, 31, 47, 20, -127, 89, -99, -11, -33, -21, -19, 29, -56, 4, 26, -6, -36, 3, -51, 22, 12, 21, 8, -43, -40, -9, -41, 28, -5, -41,
+  4, -25, -44, 49, 35, -9, -49, -23, 11, 15, 38, -21, -6, -6, -19, 29, -27, -65, 25, -13, 8, 10, -49, -33, 21, -21, 23, -42, -23, -42, 10, -1,
+  -19, -20, -31, -49, 34, -17, -14, -18, -34, -32, 47, 10, 39, 33, 28, 21, 29, -22, -50, -52, -6, -7, 52, -11, 28, -47, -4, -18, 40, -36, 15, -8,
+  -2, 14, 75, 13, 13, -50, 3, -20, 5, 3, 6, 5, 1, 14, 56, -7, 30, -10, -31, 17, -13, -18, 16, -34, 18, -60, 9, 49, 16, -36, 45, 10,
+  65, 12, 2, 1, 8, -32, 28, -17, -42, 43, 27, -26, -12, -40, 1, -1, -63, -48, 51, -3, -8, 12, -39, 2, 20, 26, 35, 9, 5, -25, 54, 14,
+  53, -15, -52, 6, 10, -35, -20, -15, -42, -48, 9, 6, 26, -13, 14, -32, -33, -76, 27, 12, -29, 20, -25, -26, -24, -11, -89, -15, 21, -64, -80, 18,
+  -92, 36, 2, -17, -98, -32, -99, 24, -1, -34, -82, -23, -29, -37, 7, -59, -41, -21, -17, -12, 16, -21, -59, -64, -60, 17, 2, -18, -64, -33, -41, -24,
+  8, -22, -39, -41, 13, -23, -27, -71, -50, 2, 19, -33, -35, -22, -93, 11, 11, -6, -17, -21, -85, -67, -7, -4, -22, -48, -79, -80, -12, -9, -14, -30,
+  -36, -54, 41, 50, 31, -14, -54, -88, 60, 17, 6, -63, -107, -68, -9, 2, -7, -19, -72, -72, 20, -4, 42, -83, -97, 19, -23, 29, 59, -42, -62, 50,
+  -45, 12, 67, 7, -68, 67, -14, 13, 2, 8, -79, 52, -19, 37, 4, 1, -75, 80, -44, -34, 30, 4, -70, 24, -40, 35, 32, -33, -58, 50, -14, -26,
+  8, -52, -42, -7, -20, 22, -20, -32, -57, -24, -11, 11, -39, -15, -100, -13, 4, 35, -25, 0, -82, -6, 22, -2, -4, -19, -91, 0, 68, 17, 4, 24,
+  -66, -24, 18, 35, -47, 25, -114, -38, 25, 20, 19, -19, -46, 23, 44, 8, 20, -33, -63, 33, -38, 44, -17, -9, -15, 40, -24, 48, 34, -40, -49, 40,
+  -32, -4, 5, -4, -47, 62, -25, 21, 42, -47, -45, 43, 21, 3, 59, -17, 16, 19, 36, 25, -11, -59, -4, 5, 45, 73, 41, 4, -12, 28, 4, 18,
+  60, -25, 6, -5, -1, 82, 66, 7, -40, -22, 49, 62, 8, -4, -30, 30, -17, 14, 8, -18, -35, -42, 48, 31, -7, 16, -5, -56, -16, -6, 62, -25,
+  8, -58, 6, 30, 90, -58, 18, -42, 61, 45, 12, 33, -41, 31, 2, -8, 57, 19, -34, 2, -7, 35, 71, -6, -57, 31, -13, 33, 23, -19, -43, 76,
+  46, -16, 71, 0, -29, 62, 1, -18, 41, 21, -34, 68, -13, 31, 55, -31, -77, 16, 1, 46, 23, -14, -32, 34, 32, 2, 88, 4, -87, -14, -3, -35,
+  14, 3, -62, 61, 14, -28, 42, -43, -127, 72, -22, -22, 72, -35, -105, 39, 10, 44, 26, -28, -87, 52, 3, 57, 86, -12, -88, 62, -15, 24, 50, -4,
+  -80, 15, -7, 50, 74, 11, -67, 23, -6, 20, 21, 56, 2, 19, -6, -3, 15, 10, -57, 37, -45, -35, 67, 33, 4, 37, -26, 18, 71, 11, -56, 34,
+  12, 21, 67, 45, -63, 45, -34, -37, 31, -18, -34, -1, -31, -30, 41, 38, -5, 31, 14, 6, 73, 16, -13, -27, 9, -35, 17, 2, -52, -34, 34, 5,
+  8, -17, -34, -61, -28, 1, 48, 36, -15, -42, -7, -79, 47, -5, 32, -8, -50, -35, 62, 16, 19, -17, 22, -41, 48, 17, -22, -40, 33, -31, 52, -49,
+  34, 24, 78, -102, 11, -78, 13, 43, 23, -64, -18, -59, 22, 58, 58, -37, -26, 10, 22, 2, 14, -6, 15, 3, 8, -1, 5, -2, -27, 12, -33, 58,
+  82, -58, 2, 6, 9, -28, 39, -49, -58, 10, -11, 2, 36, -40, -21, 18, 32, -7, 90, -12, 30, 29, 30, 38, 52, -53, -37, 16, -40, 19, 75, -32,
+  17, 43, -72, 53, 46, -66, 11, 67, -8, 2, 50, -50, -19, 23, -80, 60, 53, 5, 11, 46, -57, 80, 20, 2, -9, 0, 72, 4, -41, -5, 19, -36,
+  59, -76, 20, 7, -24, -11, 26, 16, 16, -21, -16, -27, 27, -60, 68, 3, -25, -8, 40, 5, 98, 12, 67, 38, -2, -28, 92, 11, 56, 9, -3, 24,
+  93, -13, 43, 24, 3, 29, 48, -31, 75, -11, -59, 42, 30, 28, 57, 24, 36, -2, 66, 5, 78, 14, 30, -43, 20, 37, 47, -13, -9, -2, 16, -16,
+  -5, 27, 29, -36, 68, -42, 22, -26, -37, 9, 41, -9, -19, -8, -41, -46, 30, 0, 39, 9, -11, -18, 74, -28, 6, -15, -30, -38, 71, 29, 44, 15,
+  -22, -62, 31, 15, 5, -53, 20, -78, 68, 35, -34, -5, 3, -96, 31, 59, -9, -1, 24, -78, 36, 44, 16, -47, 5, -35, 58, -23, -39, 4, 20, -35,
+  21, -6, -45, -56, 16, -52, 38, -43, -26, -47, 37, -16, 45, -29, -24, -22, 3, 38, 60, 0, -7, 6, -31, 38, 66, 41, 29, 14, -29, 2, 15, 27,
+  -42, -22, -34, 5, 5, 23, -55, -45, -42, 69, -16, 46, -5, 32, -41, -16, 53, 20, -63, -12, -20, 16, -27, 72, -15, 19, -40, -29, 8, 32, -55, -19,
+  32, -42, 46, 26, -36, -24, 35, 3, 35, 87, 19, 24, -20, 13, -17, 33, -16, -12, -11, 25, 3, 5, -46, -13, 12, 23, -53, 64, -5, 48, -2, 49,
+  -7, 26, 40, -20, -18, 38, -30, 6, -5, -24, 27, -5, 45, 24, 22, 31, 9, -12, 49, 50, -40, -13, -24, 0, 0, 5, 25, 5, 1, 9, 64, 71,
+  11, 8, -20, 7, 68, 68, -42, -41, -64, -8, -8, 54, -40, -16, -12, -27, 34, 33, -6, -69, -43, 67, -31, 50, -27, -24, 4, 1, -39, 39, 11, -39,
+  1, 35, 1, -17, 21, 6, 7, 20, -37, 21, 18, 8, -23, 71, 39, 4, 33, -38, -30, 102, -11, 37, -17, -9, 28, 60, -49, 61, 20, 60, 18, 48,
+  -14, -2, 55, -10, 5, 42, -2, 46, 1, 70, 83, 60, -49, 12, 28, 9, 5, 109, -21, 53, 43, 54, -26, 13, -23, 28, 12, 7, 48, -21, -12, 26,
+  -72, 34, -82, 34, 30, -10, -93, -49, -91, 19, -31, 23, -35, 44, -44, 20, 30, 32, -30, -27, -46, 17, -30, 44, 7, -58, -19, 53, 13, 6, -34, 2,
+  -50, 86, -46, 1, -39, -6, -43, 13, 33, 66, -30, -18, -81, 16, 8, 50, -21, 34, -86, 9, 19, 89, -10, 60, -109, 22, -18, 58, -62, 51, -36, 33,
+  -12, 116, -21, 40, -111, 42, -57, 102, -23, 111, -127, -57, -43, 62, -61, 89, -84, 17, -9, -7, -67, 76, -96, 12, -79, 48, -82, 3, -93, -78, -34, 9,
+  -28, -2, -104, -29, -27, 17, -26, 47, -59, 3, -55, 1, -15, -39, -52, -12, -20, 12, -21, -29, -5, -43, -50, -46, 12, 43, -73, -9, -1, -26, -43, 73,
+  -124, -53, -24, 29, -20, 43, -59, -23, -10, -44, 24, 48, -66, -36, -5, -38, -38, -16, -42, 19, -78, 31, 17, 40, -12, -31, -38, -31, 22, 3, -18, -58,
+  -41, -22, -17, 75, -31, -56, -21, -13, 19, 67, -39, -78, -52, 20, -33, 82, -26, -67, -17, 11, -2, -13, -49, -82, -66, -10, -6, -10, -32, -60, -78, -15,
+  -24, 67, -17, -75, -82, -55, 27, -9, 22, -119, -53, -57, 44, -21, -24, -103, -22, 8, 39, -37, 50, -105, -25, -17, 3, 36, -29, -109, -35, -52, 6, 17,
+  -31, -58, 38, -57, 63, 60, 16, -36, -24, -13, 15, 11, -61, -33, 41, -8, 64, -44, 6, -69, -1, -18, 38, 32, -34, -40, -5, -82, 52, -13, 27, -81,
+  23, -31, -3, -53, 10, -32, -44, -35, 68, -28, -31, -85, 32, -70, 36, -58, -38, -43, 48, -8, 23, -78, 44, -61, -6, 4, 29, -13, -17, -74, 24, -3,
+  64, -6, 20, -55, 45, -22, 3, 12, 68, -48, 19, -78, -15, -20, 39, -26, 70, -45, 60, 10, 7, -57, 54, -60, -3, -44, -3, -94, 14, -96, 35, 9,
+  -14, -98, -11, -96, -15, -11, 53, -82, -5, -32, 58, -21, 34, -99, 21, -1, 5, -5, 12, -127, 64, -25, -6, -23, 39, -36, 66, 6, 61, -55, 16, -67,
+  -2, 8, -24, -23, -18, -61, 50, -35, 7, 23, 5, -35, 49, -22, 3, -14, -1, 12, 33, 12, -17, -11, 18, 95, 66, 4, -47, 13, -9, 78, 64, -14,
+  34, 44, -12, 14, 86, 52, 18, 3, -11, 24, 83, -10, 1, -43, -43, -13, 102, 81, -2, -56, 34, 17, 61, 18, 17, -70, -5, 16, 99, 57, -57, -61,
+  30, -61, 94, 12, 13, -43, 29, -66, 66, 37, -35, -104, -12, -29, 34, -9, -25, -48, 43, 30, 24, -6, -9, 5, -21, -26, 62, 40, -66, -61, -50, 8,
+  108, 68, -19, -55, -24, 38, 107, 77, 2, 33, -30, 58, 44, 34, -28, -15, -3, 38, 16, 55, 1, -1, -18, 56, 84, 52, -17, -2, -28, 80, -14, 42,
+  -22, -1, 0, 76, 21, 50, -67, -9, -27, 40, 15, 54, -37, -30, 18, 72, 38, 4, -20, -26, 33, 28, 69, 40, -38, -2, -14, 59, 15, 23, -26, 68,
+  5, 34, -8, 10, -70, -8, 23, 69, 69, 81, -45, 28, -43, 84, 52, 54, -82, -15, -60, 77, 54, 4, -68, 72, 8, 55, 62, 35, 69, -70, 81, 0,
+  28, 71, -6, -23, 7, -31, 3, 70, 21, -43, 14, 43, 48, 83, -8, 39, 54, 38, 62, 86, 13, 41, 21, 50, 53, 79, -34, 60, 18, -23, 38, 64,
+  0, 2, 29, 27, 37, 36, -22, 21, 21, 40, 50, 70, -7, 32, 23, 33, 96, -3, -45, 0, 55, 25, 20, 24, -17, 10, -34, 39, 47, 80, 37, 23,
+  52, 63, 2, 91, -32, 48, -20, 61, 38, 99, -29, 40, 19, 22, -14, 72, 28, 48, 17, 34, 8, 13, 36, -27, 21, -39, -12, 42, -26, -12, 42, 1,
+  70, 46, -26, 34, -8, -25, 11, 87, -19, 10, -38, -27, 18, 66, 10, 42, 37, -69, 25, 97, -27, 1, -28, -94, 65, 60, 8, 40, -49, -64, -1, 68,
+  17, -2, 7, -48, -5, 43, -18, 29, -49, -6, 2, -25, -12, 58, 22, -32, 15, -21, 42, 31, -24, -44, -27, -19, -26, 65, 26, 38, 37, 32, 8, 45,
+  0, -17, 56, 36, -48, 19, -82, 4, -17, -44, -4, 49, -67, 0, 13, -9, 26, -1, 13, -25, 69, -127, -2, 32, 29, 9, 71, -70, -2, 1, -2, -1,
+  16, -44, -17, 13, 48, 29, 2, -41, -7, 45, 30, -7, -27, -44, -58, 4, -11, 25, 5, -29, -30, -7, -13, -10, 58, -72, -56, -63, 42, -16, 49, -16,
+  -10, -40, 27, 32, 27, -57, -5, -22, 16, -38, -13, 14, -30, 19, 1, -22, 22, 30, -39, 48, -1, 5, 6, 9, -3, -3, 22, 25, 2, 34, 11, -4,
+  2, 31, 20, 8, -3, 25, 16, 86, 19, -5, -13, 1, 3, 100, -12, 0, -28, -9, -1, 58, 18, -27, 45, -11, -15, 78, 25, -16, 41, 8, -45, 116,
+  -12, -33, 44, 6, -3, 97, -26, -16, -10, -41, -34, 21, -38, 0, 37, 31, 30, 71, -58, 1, 52, 47, 31, 17, -74, 20, 26, 30, -15, 20, -28, 14,
+  -3, 1, -31, 43, -20, -11, -22, 21, -26, 11, 23, -25, -8, 14, 14, -7, 27, -38, -6, 30, 2, 79, 20, -51, 21, -38, 17, 3, -23, -3, 2, -59,
+  -6, 34, 1, -41, -16, -37, 91, 40, 3, -14, -22, -11, 75, -30, 30, -38, -51, 42, 25, 12, 52, -14, -62, 45, 33, 16, 27, 32, -40, 37, -12, -24,
+  51, -1, 11, 11, -25, 14, 32, -11, -60, 30, 9, -7, 17, 8, -47, -34, 36, 11, 8, -51, 11, -47, 53, -4, 25, -26, 29, -8, 6, 38, 47, -63,
+  24, -22, -17, -17, 29, -58, -5, 0, -23, 74, 65, -20, 12, -73, -45, 66, 27, -2, -9, -46, -27, 80, -10, -53, 17, -20, -20, 29, -48, -54, 34, -34,
+  16, 10, -1, -2, 1, -36, 7, 83, -5, -22, 39, -32, -63, 29, -21, -49, -5, -55, -1, 86, -40, 0, 24, -34, 16, 69, -70, -43, 8, -39, -1, 96,
+  -3, 47, 41, -46, -35, 32, -62, 14, 4, 30, 52, 25, -73, 53, 27, 12, 58, 32, -44, 30, 36, 20, 56, -11, -51, 16, -44, -14, 10, -6, -9, 22,
+  -10, 43, 6, 10, -52, 36, -26, 3, 44, 6, 24, -2, 5, -16, 76, -6, -26, 59, 9, 60, 54, 4, 17, 25, -25, 2, 60, 25, 47, 47, -25, 68,
+  59, 5, 31, -12, 5, 38, -22, -70, 59, 36, -30, 57, 42, -83, 7, 25, -46, 80, 14, -34, 38, 7, -17, 51, 9, 36, 19, 14, -6, -11, -27, -1,
+  17, -32, -35, -23, -7, 34, 1, -63, -36, -56, -13, 6, 34, -51, -23, -64, 2, 17, -21, -94, -11, -47, -21, -18, -25, -71, 7, -14, -14, -22, 24, -18,
+  -66, -6, -40, -9, -13, 3, -8, 0, -36, -48, 25, -64, -8, -23, -7, -3, 26, -33, -49, -40, -40, 2, -9, -53, -16, -37, -59, -7, -1, -2, -19, 10,
+  -55, -16, -57, -55, -31, -24, 3, -12, -42, -57, -4, 1, -21, -4, -65, -19, 35, -19, 47, 4, -19, -25, -3, -7, 21, -3, -46, -62, -19, 11, 53, -17,
+  -50, -11, 40, 7, 20, 9, -30, -5, 7, 37, -50, 3, 44, -12, 6, 22, -26, -19, 36, -44, -15, -6, -1, -27, -39, -39, 18, -8, 29, -35, -5, 21,
+  6, -37, 34, -11, -32, -20, 22, -19, 29, -26, -16, 22, 10, 15, 4, -78, -29, 42, -42, 44, 44, -37, -9, 2, -9, 38, 46, -52, 53, -18, 4, -1,
+  -30, -79, 23, -30, 13, 10, 9, -61, 33, 0, -56, 27, -5, -45, 59, -1, 4, 20, -56, -54, 1, -30, 28, -15, -4, -7, -36, -17, 2, -14, 2, -20,
+  18, -32, -16, -10, -45, -35, -17, -20, 34, 2, 6, 19, 35, -42, 20, 59, -67, -12, -24, 2, 24, 32, -13, -1, -7, -42, -1, 37, -11, 5, -15, -33,
+  29, -13, -44, 25, 3, 6, 33, 26, -12, -26, -50, -43, 19, 24, -30, 8, -30, 5, 25, 43, -41, -49, -35, 6, -1, 23, -2, 20, -52, -56, 13, 9,
+  -1, -21, -47, -55, -31, -2, -46, -44, -53, -19, 11, -59, 11, 0, -21, -9, -5, -22, 1, 11, -67, -30, -11, -1, -8, -12, -73, 27, 27, 11, -48, 7,
+  -19, -5, 42, 15, 23, -29, -41, 41, 35, -12, 12, -11, -34, 30, 16, -16, -49, 5, -50, 2, 55, -4, 26, 4, -95, -4, 79, -8, 36, 11, -93, 35,
+  26, -1, 2, -15, -29, -18, 7, -35, 20, -17, 25, 44, -18, 20, -51, 1, -26, 39, -25, 0, -2, -8, -43, 31, -34, 26, -33, 41, -32, 32, 19, 1,
+  9, 2, -43, 45, 1, 33, -1, 28, -36, 16, 8, -19, 10, -9, 21, 11, 51, -52, 3, -36, 5, -42, 12, 6, -37, -20, -40, -11, -5, 5, 26, -27,
+  -18, -25, 50, 8, 3, -2, -26, 54, -1, 10, -41, -4, 12, 12, 59, -45, -32, 32, -1, 7, 30, -53, -72, 23, -28, 27, -11, -56, -1, 12, -49, -60,
+  7, -50, 5, -21, -15, 18, 6, 11, -22, 8, -23, -45, -25, -13, 25, -5, -33, 14, -25, -18, 62, -34, -21, -9, 10, 5, 28, 18, 1, -37, -44, 19,
+  0, 46, -9, -4, -29, 18, 42, 34, 28, 4, -21, 10, 12, 0, 38, 12, -28, 32, 12, 19, 55, -1, -1, 14, 29, -10, 41, -18, -25, 18, -8, 24,
+  -20, -48, 22, -54, -29, 9, 4, -9, 13, 5, 30, -58, -4, -47, -13, -50, 21, -30, -14, -66, -25, -10, -16, -25, -31, -44, -21, 16, -24, 7, -19, 9,
+  -38, 41, -27, 16, -93, -17, -45, -29, -37, 44, -127, -4, -33, 23, 10, 46, -85, -53, 34, -26, -2, 114, -46, -62, 49, 20, 4, 59, -45, -50, 14, 4,
+  -21, 44, -40, -69, 64, -38, 18, 9, -16, -45, 35, -53, 34, -5, 14, -61, -5, -59, -41, -14, -54, -39, -38, -17, 21, 34, -31, -2, 30, 49, 40, -5,
+  20, 42, 62, 35, 5, -36, 0, 12, 1, -58, -9, 10, 2, -21, -21, 14, 31, -1, -7, -31, -39, -33, -35, -103, -6, -51, 1, -50, 47, -30, -51, 14,
+  -39, 13, 26, -107, -4, -32, -67, -48, 63, -126, 42, 36, -38, -5, 49, -113, 2, -39, 17, 24, 47, -82, -43, 16, -43, -15, -19, -96, -37, 34, -13, 0,
+  48, -82, -26, 16, -19, -20, -31, -61, -51, 19, 20, -60, -12, -105, -45, 19, 29, -31, -31, -52, -51, 60, 51, -2, 42, -45, -35, 38, 54, 34, -4, -36,
+  -51, -5, 40, 36, 48, -7, -22, 50, -25, -20, -72, -43, -86, 67, -47, 7, -29, -80, -92, 17, -7, -34, -53, -29, -62, -3, -49, -17, -49, -57, -80, 9,
+  4, 16, -20, -53, -41, 13, -56, -18, 9, -107, -11, -18, -4, 39, -50, -51, -10, -30, -42, 54, -28, -28, -19, 11, 6, 38, 25, -20, -16, 14, 14, 2,
+  -36, -63, -89, -29, -19, 11, -43, -54, -81, -32, -24, -1, -23, -63, -17, -18, -60, -43, -45, -34, -67, 15, -59, -30, -63, 28, -11, 9, -70, -4, 4, 48,
+  -71, -11, -2, -42, 27, 4, -37, 0, -1, 45, -15, 62, -4, 25, -10, -11, -5, 48, -62, 8, -3, -35, -19, 17, -11, 14, -34, 31, 12, 6, -72, 67,
+  -42, 64, -10, -15, -39, 16, -30, -10, 67, 12, -9, 14, -47, -28, -49, -50, 39, 7, -53, -1, -31, 26, 3, -30, -53, -38, -46, -32, -57, -14, -38, 30,
+  -31, -42, -21, -2, -56, -44, -13, 40, -55, 34, -71, -50, 62, 45, -41, -25, -33, -4, 49, 60, 16, 8, -8, -49, 1, 46, -15, -32, -27, -44, -24, 38,
+  -25, -15, -62, 34, 39, 68, 25, -7, -41, 23, -34, 64, 23, 27, -15, 31, -34, 11, -2, 35, -3, 26, -39, 34, 38, 4, -55, 16, -54, 38, 4, 27,
+  -35, 52, 19, 71, 30, -13, -27, -12, 0, 66, 2, -36, -63, -8, 31, 22, 10, -14, -57, 32, -20, 58, 45, 54, -15, 30, 17, 56, 2, 43, -11, -14,
+  55, 5, -26, 14, -52, 27, 41, 33, 17, 15, -17, -8, 57, 74, 38, 3, -48, 53, 25, 14, 34, 49, 9, 33, 41, 13, -91, -4, 40, -34, 8, 22,
+  -25, -67, 9, 8, 22, -31, -54, -17, -20, -31, -27, 1, -71, 0, 16, -21, -23, 39, -4, -11, 37, -44, -31, 48, -69, 58, 4, -8, 4, 6, -40, 61,
+  14, -41, 39, -69, -38, 40, -27, -35, 38, -22, -54, 96, -4, 20, -1, 0, 4, 39, 67, 35, -19, 15, -50, 58, 11, -6, -37, 32, 3, 47, 34, -43,
+  -15, 6, 4, 53, 40, -39, 0, 45, 17, 15, 36, 3, -76, 32, 30, 64, -2, 14, -35, 32, 57, 29, 2, -58, -40, 14, 37, 32, 17, -61, -26, 21,
+  12, 44, -13, -18, -10, 14, -23, 27, 35, -58, -6, 70, -53, 28, -12, -41, -46, 79, 11, 49, 65, 32, -42, 100, -13, 6, -9, 47, -18, 26, -13, 24,
+  41, 15, -21, 59, -36, 33, 34, 22, 1, 0, -6, 6, 40, 10, 4, -6, 18, 79, 84, -53, 52, 8, -32, 60, 70, 32, -22, 53, -24, 42, 48, 23,
+  35, -18, 8, 64, 54, -26, 3, 22, -17, 79, 60, -10, 24, -65, -21, 84, 57, 4, -52, -43, 29, 66, 42, 4, -25, -39, -27, 108, 59, -12, -18, -27,
+  5, 32, -11, 34, -8, -32, -48, 54, 43, 35, 29, -41, 16, 42, -31, 57, 16, -29, 17, 30, 8, 13, -32, -6, -23, 14, -25, 35, -14, -22, -52, -9,
+  -19, 7, -25, -31, -34, 15, -17, 5, -38, -38, -64, 7, 7, -29, -75, -7, 10, -19, -13, 7, -46, -20, -28, 13, -17, -7, -5, -19, -75, 56, -10, 18,
+  -49, 13, -60, 32, 31, -21, 1, -76, -52, 47, 39, -32, 13, -30, -21, 11, 9, 34, -43, -11, 3, 27, 71, -1, -34, 47, 20, 4, 40, -2, 0, 32,
+  -56, 46, 14, 36, 13, 46, -24, 7, 43, 56, 29, -24, -16, 43, 50, 72, 11, 33, -67, -28, -56, 42, -33, 23, -61, -6, 22, 44, -29, -32, -4, -9,
+  -45, 40, -25, -31, -30, -8, 15, -22, -27, -67, 26, -29, 7, 21, -47, -66, -58, -21, -5, -52, -17, -48, -58, -37, -62, -7, -13, -28, -69, -13, -15, -23,
+  7, -27, -69, 3, 4, 34, 11, -62, -59, 44, 6, -25, -19, 20, -14, -17, 11, 0, 23, -8, 12, 19, -35, -10, -44, -49, 24, 15, -31, -45, 0, 5,
+  22, 5, -46, -18, -13, 17, 44, -22, -9, 25, 37, 40, 43, 11, 30, 8, 48, 3, 3, -22, 32, 43, 47, -18, 48, -40, -16, -12, -3, -59, 46, -11,
+  21, -28, 7, 9, 93, -70, -2, 18, 93, 28, 29, -68, -37, -14, 58, -4, 112, -97, 51, -31, 49, 40, 59, -84, 0, 35, 18, -19, 25, -127, -24, 16,
+  25, -20, -5, -74, 8, 12, 37, -26, 25, -67, -11, 11, 41, -27, 16, -87, 32, 20, 36, 10, 38, -48, -18, 27, -1, 5, 19, -81, -13, 17, 5, 28,
+  38, -83, 26, 10, 9, 0, 1, -79, 13, -1, 6, 13, 37, -56, 1, -14, -5, -7, 18, -51, 20, -23, 45, 43, 61, -25, 29, -17, -5, 51, 23, -33,
+  -7, -19, 38, 38, 42, -11, -2, -34, -16, 55, 36, 10, -18, -6, -5, 67, 61, -39, -31, -28, -28, 69, 57, -34, -20, -14, -10, 31, 45, -27, -23, -21,
+  8, 55, 72, 18, -37, -33, 14, 54, 63, 13, 11, 1, -18, 17, 58, 36, -25, -19, -41, 45, 64, -5, 7, 9, 4, 42, 16, 29, 39, 35, -19, 79,
+  19, 46, -13, 46, 22, 90, -12, -10, -5, 6, 0, 72, -5, -4, 8, -35, -29, 58, 3, 5, 12, 11, -16, 38, 13, -13, 34, 11, 15, 28, 27, -7,
+  10, 7, 9, 10, 8, 6, 56, -23, 15, 3, 42, -18, -89, -5, 49, -17, 67, -21, -44, 0, 35, 9, 26, 12, -34, -15, 28, 32, 40, 13, -19, 28,
+  36, 31, 28, 11, -19, 9, 19, 33, 9, 25, -27, -7, 20, 15, 15, 49, 4, -2, 5, 46, 20, -2, -14, 23, -6, 11, -5, 30, 20, -17, 0, 11,
+  -8, 2, 14, -1, -1, 40, -32, -18, 14, -7, 10, 3, -31, -12, 13, -37, 3, -9, 22, -3, 11, -45, 3, -26, 6, -2, -2, -8, 0, 26, -8, 13,
+  27, -31, -1, -19, -18, -13, 4, 25, 8, -7, -8, -20, 40, 15, 27, -33, -2, 10, 13, 10, -10, 4, 10, 2, 35, 28, 18, 16, 1, 17, 14, -7,
+  -6, 43, -18, 6, 8, 32, -2, 17, 6, 11, -23, -12, 17, -3, -20, -6, 21, 13, -37, 1, -16, 47, 12, 11, -42, -5, -21, -4, 35, 18, -25, -12,
+  -13, -8, 10, -14, -10, 16, -6, -44, -5, -14, -37, 6, -5, -19, -3, -32, -6, 15, 17, -6, 16, 15, -31, 33, 3, -8, -6, -16, -8, 18, -3, -3,
+  -1, -27, -13, -3, -37, -16, 12, -48, 9, 26, -27, 1, -1, -2, -24, 18, -22, -18, 7, -37, -31, 45, -24, -17, -8, -33, -29, 41, 2, 21, -16, -39,
+  2, 13, -4, -17, -22, -32, -6, 37, -3, 0, -7, -19, 18, 52, -15, 8, 3, -18, -38, 32, -14, -24, 22, 19, -22, 9, 9, -4, -24, -1, 7, 9,
+  1, 14, -7, -16, -28, -12, -29, -27, -5, 20, -9, -1, 4, -24, -12, 11, -37, -34, -27, -21, 24, -11, -58, -26, -13, 1, 19, -7, -52, -13, 42, -6,
+  -8, 28, -9, -24, 23, -12, 15, 23, -11, -26, 10, -20, -17, -6, 1, -34, 7, -4, -17, 26, -19, -34, -15, -31, 20, -4, -10, 1, -8, -29, -36, 8,
+  0, -24, 5, 25, -21, 5, -28, -30, -6, -18, 0, 15, 3, 10, 21, 29, 2, 9, 4, -23, -21, -11, -3, 42, -20, -30, -22, -5, -12, 5, 5, -43,
+  -18, -25, 5, -6, -24, -42, -4, 21, 19, -24, -8, -43, 25, -7, -6, 5, 10, -41, 20, -24, 12, 5, -21, -34, -11, 19, 10, -20, -38, -46, -22, -3,
+  18, 27, -23, 0, 2, 32, 0, -2, -23, -12, -19, -1, 7, 23, -13, -41, -42, -16, -22, 17, 16, -1, 1, -14, -37, 30, 29, 9, -35, -25, -6, -4,
+  20, 9, -35, -11, -5, -10, 14, 21, -38, -34, -6, -8, 48, -3, -21, -57, -21, -4, 52, 6, 9, -3, -20, -3, -2, 27, 13, -11, 17, -14, -6, 23,
+  -1, -9, 18, -34, 20, 5, -14, -6, 8, -3, 14, 6, -20, 19, -4, -50, 9, 5, -40, 12, -24, -45, 1, 47, -43, 10, 3, -18, 4, 50, -26, 35,
+  -9, -4, 15, 42, -11, 4, -8, 26, -2, 52, -54, 11, -4, 24, 6, 41, -64, 40, 4, 31, 13, 25, -62, 20, 10, 7, 27, 22, -19, 9, -5, 28,
+  -20, -16, -7, 31, -2, 30, -25, 19, -36, 33, -20, 0, -46, 21, -43, 14, 23, 23, -20, 5, -56, -1, 9, -6, -42, 39, -46, 26, 36, 50, -30, 30,
+  -45, 15, 57, 67, 0, -1, -51, -14, 41, 51, 15, -30, -12, -10, 22, 0, -2, -45, -33, -6, -6, 49, 5, -14, 10, -21, -16, 12, 28, -8, -4, 9,
+  17, 1, -8, -4, -23, 15, 4, 8, 32, -34, 9, -1, 3, 32, -4, 13, 6, -28, -21, 17, -9, -7, -30, -26, -21, -31, 20, 8, -10, -36, -1, -26,
+  -1, -24, -15, -11, 11, 9, -11, 9, 18, 12, -8, -3, -19, 3, -10, -23, -2, 1, -16, 2, 6, -8, -2, -14, 4, 17, -26, -14, -33, -1, 4, 21,
+  -22, 25, 5, -16, -2, 25, 3, -18, -9, -20, -12, -22, 19, -21, 1, -34, -4, -5, 17, -6, 2, -19, 10, 3, -4, -20, -34, -5, -22, 2, 16, 4,
+  5, -25, -3, 16, -19, -8, 1, 19, -8, 5, -10, -20, 3, 0, 16, 21, -8, 17, 14, 10, -1, 21, 10, 24, 9, -13, -6, 41, 2, 28, 9, -17,
+  -18, 21, -21, -11, -2, -9, 29, 3, -3, 33, -30, -3, -1, -18, -31, 11, 3, -18, 24, 18, -16, -4, 3, -17, -5, 9, 6, 4, 23, -9, 22, -33,
+  48, -14, 31, -22, -1, -27, 53, -16, -46, 13, -62, -52, 92, -46, -14, 51, 20, 14, 66, -51, 27, 51, -41, -13, 76, 25, -20, 55, 9, 0, 29, -24,
+  -36, 26, -60, 4, 31, -74, 0, -46, -58, 16, 15, -64, -38, -42, -6, -55, 10, -20, 9, -37, 4, 14, 10, -58, 28, -88, -26, -2, 25, -39, -28, -26,
+  20, -61, 0, -4, -54, -29, -68, -5, 64, 30, 10, -26, 14, 32, 14, -26, 22, -12, -39, 73, 9, -59, -53, 5, -24, -2, 10, -26, -30, -15, -4, -26,
+  42, -11, 29, 8, -4, -44, 48, -25, -28, -38, -2, -7, -3, -54, 2, 8, -66, -45, -34, -70, -2, -11, -25, -4, 9, -54, 64, -5, 22, -18, 3, 39,
+  30, 34, 20, 76, -65, 13, 58, 38, -2, 61, -62, -54, 7, -4, -16, 55, -12, -57, 16, -9, 30, 2, -1, -15, 50, -33, 37, -38, 2, 5, 16, -5,
+  -26, 51, -38, -67, 42, 36, 44, -13, -59, -11, 35, 32, 69, 1, -31, -52, -85, 12, 52, 9, 10, 2, -85, 41, -9, -48, -19, 2, -42, 39, -6, -36,
+  27, -2, -9, 29, -1, 16, 8, -6, -47, 56, 2, 2, 67, -16, -58, -20, -32, -30, 32, 39, -81, 1, 29, -43, 10, -34, -88, 42, 22, -55, -29, 17,
+  -52, -5, 51, -44, -4, 3, -64, 0, 59, 5, 23, -73, -72, -6, 45, -79, 44, -28, -52, -29, -37, -35, 71, -31, -46, 26, 5, -50, 86, 8, -44, -8,
+  -29, -42, 30, -47, -41, 33, -57, 25, 32, -70, -15, -15, -68, -23, 42, -17, 37, 12, -100, 26, -29, -9, 34, -24, -95, -11, -24, -54, -7, -36, -51, 29,
+  -64, -18, 39, -19, -2, 43, -72, -11, -26, -68, 20, -31, -29, -8, 13, -79, -16, -20, 13, -5, -14, -29, -39, -40, -32, -21, -25, -5, -31, 15, 4, -41,
+  -52, -29, -13, 0, -43, -46, -39, -61, 17, 12, -28, -31, -11, -7, -1, 13, -70, 48, -57, -58, 57, -24, -62, 47, -1, 27, 20, 14, -60, 9, -12, 30,
+  14, 39, -10, 93, -6, -5, 41, 1, -23, 89, 29, 25, 42, 38, -41, 61, -17, -23, 47, 66, 11, 75, 1, 32, -3, -15, -11, 41, 29, 63, 47, 26,
+  5, 41, 22, 16, -2, 23, -32, 11, -37, -12, -19, 65, -46, 37, -27, 7, 22, 36, -9, 35, 14, 21, 31, 12, -97, 32, 41, 14, 47, 6, -16, -9,
+  -6, 31, -9, 4, -99, 50, 7, 47, -28, -39, -29, 42, 9, -40, 36, -13, -19, 61, 23, 8, 7, -54, -27, 60, -17, 10, -42, -28, -90, 63, 41, 32,
+  -1, -65, -20, 24, 47, 67, -22, -79, -1, -31, 30, -20, -1, 27, -9, 11, 0, 3, -19, 8, -13, 4, -7, -21, -45, 11, 22, 17, -56, 43, -70, 9,
+  9, 57, -29, 28, -7, -39, -13, 37, -64, -11, 22, -25, -48, 67, -35, -22, -52, -5, -28, 16, -51, 2, -57, 45, 54, 3, 12, -45, -15, -32, 3, -21,
+  -1, 4, -73, 63, -28, -12, 36, -5, -17, 17, 22, 14, 35, -11, -30, 2, 26, -30, 3, -58, -1, 19, -23, 37, 38, -27, -21, 50, 28, 12, 34, -95,
+  -44, -2, -53, -12, 76, -19, 7, 27, -44, 18, 48, -48, 20, 5, -14, -13, 42, -23, -14, 19, -67, 31, 39, -77, -50, 29, -86, 15, 24, -24, 23, 64,
+  -105, 4, 61, -26, -3, 68, -24, -16, 63, -51, -43, -13, -50, 2, 72, 4, 3, 74, -52, 11, 18, 1, 17, 17, -56, 29, -12, -37, 52, 60, -13, 51,
+  65, 51, -27, 48, -76, 74, 56, 26, -8, 42, -1, 31, 48, 6, -53, 30, -64, 34, 26, -17, -14, -7, -32, 14, 43, 21, -25, 38, 7, 76, -29, 20,
+  -34, 0, -61, 66, -53, 49, -18, -5, -16, 37, -29, -15, 33, -31, -56, -5, -19, 21, 5, -36, -19, 22, 9, 39, -17, 18, -9, -11, -18, 34, 42, -7,
+  -40, 30, -10, 93, -48, 0, 16, -25, -42, 102, -51, 25, -22, -13, 1, 51, -14, -42, 48, -47, -45, 68, -65, -24, -6, -63, -15, -16, -48, 32, 44, -72,
+  36, 35, -50, -10, 47, -24, 13, 57, -78, 11, 27, -31, 31, 39, 32, -67, -11, -82, -52, 74, 7, -29, 25, -64, 8, 23, 26, -37, 3, -82, 1, 42,
+  44, 24, 59, -118, -5, 23, -9, 24, 56, -36, 12, -46, -41, 43, 98, -96, 35, -59, -44, 48, 7, -73, 34, -41, -24, -6, 61, -127, -22, -56, 2, 16,
+  2, -57, -56, -90, -31, 40, -12, -28, -35, -32, -15, -33, -43, 3, 2, -82, 43, -8, -45, 47, -61, -54, 54, -7, -46, 32, 2, -7, 6, 39, -12, 66,
+  -84, 4, 38, 36, 13, -11, -14, -11, 6, -12, 1, 3, -52, -32, 13, 24, 17, 33, -60, -17, -7, 0, -19, -12, -35, 17, 44, -6, -56, 12, 2, -30,
+  72, -44, -76, -9, 9, -53, 41, -68, -18, -41, 1, -65, 73, -60, -24, 34, 68, 16, 35, -10, -67, -18, 73, 7, 8, 19, -6, 35, 17, -17, -10, -7,
+  -63, 49, 64, 59, -27, 40, -73, 34, 94, -20, -25, 37, -80, 87, 80, 51, 1, -11, -35, 80, 18, -7, 11, -62, -31, 42, 48, -1, 22, -47, -67, 85,
+  -31, -20, 73, 11, -20, 70, -40, -12, 27, 3, 3, 17, 15, 28, -10, -13, 3, 58, -20, 17, -11, 7, 15, 3, -10, 33, -6, 43, -33, -15, 18, 58,
+  16, 72, -20, -27, 3, 77, 38, 36, -67, 28, 9, 86, 16, 71, -51, 36, 8, 41, 29, 51, 16, -8, -37, 35, -17, -20, 11, 23, -5, 13, -46, -43,
+  -8, -5, -9, 31, 23, 32, -20, 29, 15, 27, 21, -2, -42, 16, 9, -1, 38, -1, 11, 6, -26, -24, 10, -26, -21, 20, 14, -39, -15, -8, 29, 6,
+  -3, -23, 39, -30, -12, 39, -37, -5, 59, -64, -29, -11, -33, 7, 50, -6, -17, 43, 3, -37, 19, -32, -16, 14, -22, -2, 9, -38, -1, 13, -17, -29,
+  24, -31, 29, -4, 25, -29, -20, 9, 37, -22, -44, -47, -56, -29, 13, -23, -48, 30, 24, 23, -62, 10, 7, -50, 26, 15, -58, 45, -1, -23, -38, -2,
+  15, 36, -2, -64, 21, -35, 3, 21, 0, -29, -39, 34, -22, 81, -31, 6, 15, 3, 48, 43, -70, 31, -33, -14, -46, 70, -56, -10, -36, 12, 13, 17,
+  -72, -39, -44, 0, -48, -36, -90, -41, -53, -41, 28, -30, -41, -30, -37, -41, -24, -44, -40, -55, -14, -33, -12, 1, -49, -10, 36, -4, 4, 34, 7, -12,
+  26, -24, -22, 51, -35, 13, -36, 10, -21, -7, -28, 6, -10, -12, -2, 21, -26, 31, -22, 59, -9, -9, -2, 20, -52, 81, 15, 12, -10, -37, -42, 3,
+  13, -11, -45, -39, -37, 71, 6, 1, -23, 36, -2, 2, -7, 14, -40, 10, -15, 26, 22, 11, -39, 1, 44, 9, 5, -19, -80, 12, 71, -19, 39, -16,
+  -60, 10, 45, -51, 31, 9, -39, -28, -24, -66, 24, -3, -44, 16, 25, -60, 46, 11, -37, -51, 2, -10, 52, -38, -23, -47, -20, 12, 48, -19, -19, -71,
+  13, 0, -4, 26, -63, 13, -8, 1, -2, 6, 6, 13, -1, 35, -15, 17, -17, -40, 37, 8, -43, 38, -12, 54, -11, 50, -39, -11, -30, -21, 10, -14,
+  -2, -17, -28, 21, -57, 48, -36, -30, -9, 47, -15, 60, -8, -19, -60, 36, -27, 48, 12, -61, -34, 19, -7, 51, -53, -33, 6, -33, 13, 82, 4, -16,
+  -41, -6, -5, 45, -23, -34, -11, 0, 11, 88, 40, -62, -21, -28, 39, 95, -7, -45, 34, 27, -27, 58, 2, -11, 76, 43, -24, 116, -22, -42, 60, -2,
+  -34, 113, -13, 4, 16, -6, -31, 54, -14, -52, 5, 63, -19, -2, 43, -9, 22, 8, -46, 20, -27, -52, 53, 54, -8, 64, -2, -51, 35, 15, 70, 8,
+  -35, -44, 6, -2, 17, -3, 12, -28, 41, 7, -12, -11, 31, -80, 64, -10, 8, -42, 48, -24, 5, -13, 19, 0, 25, -57, 55, -58, -5, -55, 18, -44,
+  38, 4, 24, -62, 66, -16, 30, -26, 30, -67, 45, -22, 53, -24, -19, -61, 72, -10, 8, -80, 33, -37, 66, 8, 41, -41, 24, 28, 25, -36, 30, -35,
+  -18, 39, -23, -17, 75, 36, 45, 24, 22, -26, 32, -8, 25, 22, 39, -75, 41, -33, 50, 6, 17, -97, 35, 10, -5, -2, 32, -59, 38, -18, -14, -47,
+  19, -10, 54, 14, 17, 20, 6, -7, 50, 3, 9, 16, 58, -35, 39, -16, -20, -47, 60, -50, 31, -10, -9, 6, 40, -27, 95, -8, 18, -31, -24, -76,
+  93, -21, 53, -5, 32, -20, 34, -21, 3, -29, 48, -60, 48, 1, -32, -62, 81, -26, 0, 30, 13, -69, 50, -46, 44, 5, -24, -88, -8, -14, 34, 26,
+  -25, -85, -21, 24, 47, -37, 34, -84, -24, -15, -4, 35, -28, -98, -13, -4, -3, 38, 25, -83, 41, 0, 36, 57, -9, -44, 52, -11, -1, -33, 1, -28,
+  35, -5, 27, 7, 55, -59, 5, -1, 67, 2, 35, -48, 58, -2, 53, -1, 23, -85, 60, 52, 0, 31, 46, -40, 44, 13, 18, 37, -25, -27, 37, 21,
+  -2, -13, 15, -35, 24, 92, 52, -2, -12, -7, 63, 41, -29, -28, -3, -50, 17, 70, -50, -31, -15, -68, 16, 43, 7, 9, 3, 0, 67, 87, -43, -4,
+  19, -48, 44, 88, -92, 4, 31, -33, 77, 57, -64, -45, 31, 15, 64, 109, 21, -56, -17, 24, 21, 8, 48, -17, -11, 2, 84, -16, 52, 17, -108, 26,
+  20, 8, -1, 38, -54, 57, -15, 27, 44, 26, 3, -8, -21, 14, 47, -1, -46, 47, -74, -38, 14, 24, 29, 30, -11, 45, -7, 37, -43, 13, -38, 31,
+  -36, 87, 29, 1, -35, 34, 15, 59, -44, -32, -34, 9, -36, 58, -43, -33, 4, 24, 6, 46, 18, -51, 36, -7, -52, 45, 30, -49, 3, 37, -52, 5,
+  -36, -73, 40, 58, -18, 39, 39, 12, 21, 44, -3, 2, -13, -27, -22, -9, 24, -5, 20, -34, -7, 33, 52, -11, 15, -24, 18, 38, 16, -25, -20, 38,
+  44, 58, 53, 5, 31, -7, 40, 18, -27, -60, 17, 29, 8, -6, -16, -7, 46, -3, -11, 21, -19, -27, 47, 51, 21, 34, -34, -5, 45, 46, 24, 53,
+  -33, -59, 13, 75, 23, 32, -34, 22, 32, 58, 18, 57, 0, -28, 13, 110, 41, 15, -34, 17, 5, 60, 52, -16, -20, 23, 46, 60, 63, 55, -18, 34,
+  95, 98, 127, 65, -11, -6, 6, 11, 8, -56, -1, -10, -38, 35, -5, -17, 14, -2, -4, -16, -3, -54, 16, -1, -18, -45, 21, -52, -24, -44, -19, -37,
+  32, -48, 17, -49, 1, -38, 4, -20, -28, -3, -12, -28, 28, 1, 39, -38, -17, -68, 18, -4, -26, 2, -25, -59, 1, -52, 7, 6, 14, 16, 42, -64,
+  21, -29, -19, -3, 19, 8, 3, 14, 2, -26, 49, -21, 26, -24, 4, -35, 26, -34, 36, -8, 32, -51, 46, -15, -30, -30, 0, 2, -11, -22, -1, -46,
+  10, -37, 24, -57, -36, -14, 14, -32, 14, 10, -10, -19, -14, -1, -11, -12, -24, -21, 16, -65, -18, -6, -20, 29, -14, -50, -13, 15, -47, -25, -22, -9,
+  15, -17, -28, -18, 36, -31, -20, -5, 8, -16, 0, -33, -34, 25, 26, -8, 30, -4, -34, 33, 4, -17, 32, -28, -40, 45, 8, -18, 35, -36, -46, -18,
+  -22, 9, 1, 14, -37, -17, 3, 42, 31, -21, -10, 19, 28, 6, -5, -2, 27, 24, -4, -3, 7, -28, -10, -18, -7, -33, -82, 7, -21, 6, -16, -55,
+  -49, 9, 2, 14, -17, -25, -50, -41, -43, -6, -48, -86, -36, -46, -41, -39, -16, -40, -28, -15, 14, 39, -35, -77, -28, -43, -28, 29, -37, -6, -52, -54,
+  25, -3, -33, -42, -72, -27, -13, 28, -34, -57, -69, -50, -11, 23, -3, -16, -80, -26, -18, 9, -15, -20, -31, -18, -1, -18, -37, -26, -82, -40, -25, -12,
+  -31, -54, -70, -17, 15, 9, 6, -25, -59, -8, -9, 28, 6, -21, -35, -9, 10, 23, 11, -6, -47, -15, -26, 16, -2, -31, -48, -59, -4, -11, -18, -30,
+  -41, 6, -8, 9, -11, -38, -69, -39, -28, -25, 6, 18, -33, -2, 11, 18, -42, -26, -18, -28, -35, 24, -60, 12, -12, 18, -8, -5, -52, 36, -24, -4,
+  -2, -4, -29, 28, -18, -53, 5, -22, -9, 9, -5, -20, -15, -21, -6, 7, -25, 4, 8, -22, -1, 5, -16, -24, 21, 30, -11, 17, -32, 31, -15, -17,
+  7, -43, -52, -19, 38, -40, -30, -6, -56, -13, 38, 12, -42, 16, -62, -2, -17, 35, -14, 8, -74, 26, -23, -2, -3, -47, -15, 1, -40, -7, -18, -6,
+  -38, -9, -25, -7, -36, -3, -88, 21, 12, 37, -15, -26, -30, -31, 4, 15, -43, 3, -58, 6, 0, 27, -42, -11, -1, 27, -47, 30, -13, 0, -41, -11,
+  -11, 18, -17, -32, -40, 14, 20, -8, -34, -26, -53, 4, -18, 4, -16, -30, -23, 43, 43, -10, -27, -6, -26, -2, -2, 21, 21, 8, -40, 11, 17, -15,
+  41, -13, -61, -19, 33, 7, -35, -21, -45, -49, -49, -49, -14, -37, -57, -16, 5, -31, -51, -19, -45, -72, -10, 26, -5, 7, -26, -75, -40, 13, -22, 33,
+  -65, -51, -13, 10, 3, 5, -50, -1, -58, 1, -32, 22, -58, 13, 6, -27, -8, 5, -29, 25, -43, -49, -25, -6, -62, 23, -1, -51, -25, -1, -59, -22,
+  -23, -25, -12, -29, -81, -37, 3, -12, -14, -1, -52, -79, 1, 42, -32, -7, -6, -57, -16, 47, -46, -1, -29, -58, -39, 14, -14, 3, -55, -6, 11, 18,
+  -20, -18, -31, 34, 13, 39, -57, -4, -26, 31, 22, -6, -47, 5, -70, 38, 18, 15, 4, -27, -25, -4, 9, -16, -41, 9, -54, 29, 5, 22, -31, 23,
+  -86, -21, 15, -10, 3, 6, -54, 3, 18, -30, -33, -3, -78, -3, -23, 21, -21, -3, -44, 38, -37, -14, 6, -1, -46, 8, 4, 44, -13, 21, -67, 44,
+  17, 20, -38, 3, -36, 16, -38, 26, -30, 1, -12, 69, -57, 18, -24, 24, -10, -8, -28, 27, -22, -13, -64, 1, -21, 13, 13, -3, -14, -16, -19, -4,
+  28, 38, -52, -13, -13, 26, -21, 37, -44, 32, -29, 31, 19, 32, -22, -16, 5, 29, 3, 26, -54, 55, -16, 34, -24, 30, -77, -16, -52, 53, -23, 61,
+  -41, 21, -28, 55, -7, 16, -17, -12, -54, -5, -1, 22, -60, -38, -15, 7, 8, 33, -50, -25, -27, 42, 9, 15, -79, -7, -28, 21, 7, -2, -88, 3,
+  -12, 19, 31, 5, -78, -19, -23, 0, 26, 33, -99, 23, 0, 43, 3, 29, -127, -16, 5, 14, 2, 45, 42, 8, -23, 17, 67, -12, 26, -28, -34, 4,
+  23, 12, 24, -42, -32, 8, 3, 12, 21, -7, 10, -16, 10, 23, -16, 4, -21, -29, 41, -11, -18, 26, 33, -41, 17, -10, -30, -13, -3, 19, 28, 35,
+  -7, 12, 17, -10, 22, -3, -26, -20, -8, -17, 7, -6, 1, 18, -19, -25, 26, -5, -25, 4, -26, -11, -7, -2, 0, 27, 28, 7, -1, 18, -4, -36,
+  22, -1, -4, -8, 36, -24, 21, -2, 5, -2, -9, -64, -22, 5, 1, 17, 24, -54, 10, -5, 9, -30, 5, -37, 26, 17, 11, 15, 23, -43, -25, -27,
+  25, 15, -11, -10, 34, 0, 24, 33, 43, -3, 27, -8, -12, 51, 48, -56, 56, 31, -22, 41, -26, -19, 29, -35, 26, 23, 17, -48, 36, 17, -13, 52,
+  -32, -81, 3, -23, 10, -1, -25, -43, -28, -36, -21, -44, -33, -12, 16, -36, 13, -67, -27, -18, -6, -6, -6, -47, 35, -53, -2, -8, 15, -28, -21, -1,
+  -14, -20, -12, 8, 44, 17, -18, 44, -80, -5, 20, 36, 15, 38, -31, -9, -16, -8, -5, 74, 4, 44, 10, -27, -27, 74, -44, -12, -34, 6, -30, 77,
+  -6, 44, -33, 8, 8, 12, 14, 25, 14, 30, -27, 39, -36, 67, -21, -17, -11, -8, -1, -14, -9, 50, -52, 13, 30, -32, 27, 40, -23, 37, 0, 26,
+  -55, -40, -6, 29, 15, -15, -10, -14, -21, 24, 13, 26, 7, 44, -23, 16, 31, 40, 27, 2, -56, 53, -12, 27, -2, -29, -13, -6, 24, -15, 14, -52,
+  -27, 34, -11, 11, 6, -18, -30, 14, -11, -28, 7, 5, -41, 21, 32, -21, 42, -18, -53, 48, -4, -24, 49, -30, 0, 12, 19, 3, 23, -30, -14, 43,
+  -41, -3, 26, -52, -9, -10, 13, -5, 29, -29, -19, -20, 23, 9, 1, 8, -8, -7, -25, -17, 7, -44, -4, 17, -13, -58, -1, -21, -1, 8, -41, -15,
+  8, -16, -5, 18, -38, -13, 34, 37, -30, 9, -14, -6, -5, 35, 17, 16, -17, -15, 19, 27, 64, 59, 42, 28, 30, 48, 17, 12, -5, 11, -50, 38,
+  -28, 39, -23, -3, -68, 70, -15, 65, 8, -12, -15, 42, -18, 8, 12, -18, -80, 3, -12, -11, 25, -9, -30, 24, -8, 55, 28, 19, -42, 33, -11, 12,
+  2, -16, -56, 16, -14, -4, -24, -2, -59, 14, 32, 23, 53, 10, -63, 8, 32, 45, -20, 45, -76, -2, -1, 7, 9, 23, -92, 41, -8, -8, 13, -13,
+  -49, -16, -1, 33, 8, 26, -17, 2, -33, 6, 38, 0, -62, 7, -32, 60, -16, 28, -97, -18, -17, 9, 20, -44, -57, -47, 35, -10, -21, -57, -41, -38,
+  5, 0, -32, 3, -79, -69, 21, -32, -11, -5, -79, -19, -38, 2, -6, -5, -34, -25, 26, 16, -38, -3, -84, -25, 14, 26, -22, -15, -28, -29, 10, -39,
+  -8, -54, -32, -39, -20, -41, 10, -38, -24, -23, -21, 18, -36, -8, -15, 2, 15, 23, -19, -19, 11, -2, -24, -9, -43, -9, -47, -46, -48, 16, -13, -22,
+  2, -14, -36, 43, -35, -19, -10, -26, 34, 7, 10, -14, -30, -46, 58, -50, -31, 25, -30, -39, 4, -8, 7, 21, -25, -56, 1, -32, -33, -51, -66, -56,
+  23, -19, -57, 5, -45, -27, -37, -51, -53, -46, -65, -37, 3, 11, -55, 1, -28, -41, 24, -45, -51, -23, -21, -11, 28, 19, 18, 4, 3, -34, -24, 27,
+  11, -30, -31, 3, 37, -10, -13, -20, -22, 40, 41, -23, -37, 29, 19, -18, 2, -29, -3, -39, -20, -47, 4, -35, -27, -19, -2, -8, 42, -48, -15, -11,
+  -30, 4, 61, 19, -27, -33, 6, -6, -16, -38, -40, 35, 38, 127, 31, -28, -6, -19, 32, 70, 7, -50, -17, -5, 59, 70, 7, -38, -67, -6, -7, 58,
+  31, -42, -3, 21, -13, 72, -12, -44, -61, 12, 19, 44, 12, -45, -11, -22, 39, 42, 43, -50, 3, 9, 16, -17, 33, -24, -58, -32, 73, -23, 13, -48,
+  -45, -60, 54, 9, -2, -27, 0, 26, 49, 39, 13, -38, -29, -14, 19, -7, 13, -37, 14, 7, 72, 8, 18, -20, -26, 28, 62, -3, 43, -67, -8, 2,
+  37, 48, 12, -46, -20, -12, 20, 7, 59, -30, -5, -13, 44, 74, 104, -15, 0, 2, 28, 37, 72, -20, -27, -13, 0, 95, 33, -61, 8, -45, -21, 55,
+  83, -44, -30, -6, 17, 50, 17, -48, 23, -4, -15, 0, 43, 1, 37, -9, 6, -8, 52, 28, 57, 17, 1, 33, 37, 2, 37, 2, 39, -9, 0, 43,
+  57, -35, 42, 13, 63, 4, 27, -13, 60, -47, 24, -1, 48, -3, 14, -6, 61, 39, 52, 45, 33, 6, 56, -5, 54, 28, 12, -63, 46, 29, 12, 51,
+  29, -43, 73, -39, 43, -32, -2, -40, 20, -38, 72, 17, 2, -2, 28, 33, 86, 1, -10, -4, 104, 6, 63, 10, 9, 16, 68, 6, 23, 26, 7, -19,
+  73, -20, 61, 13, 4, -31, 91, 46, 52, 36, 32, 6, 60, 48, 33, -1, 4, -48, 71, -3, 26, 7, 38, -27, -10, 42, 52, 44, 30, 5, 40, 20,
+  77, 12, 47, -1, 18, 24, 66, -11, 22, -33, 20, 36, 8, 47, 63, -27, -9, 6, -5, 3, 39, -3, 57, 59, 17, -45, 47, -39, 58, 57, -9, -7,
+  -4, -7, 58, 60, 24, 36, 19, 19, 85, 59, 43, 3, -49, 3, 62, 85, 48, -10, -9, -22, 33, 58, 39, 41, 7, -3, -9, 50, 8, 57, -32, 11,
+  8, 34, 39, 37, 23, 8, 9, 13, 44, 65, -34, 29, -49, 57, 17, 48, 0, -35, -47, 37, 13, 60, 4, -16, -16, -40, -1, -26, 13, 21, -34, -11,
+  -20, -12, 2, -37, -11, -1, 5, -7, 11, -10, -8, 4, 27, -51, 34, -50, -31, -29, -9, -39, 7, 16, -13, 1, 45, -33, 26, -43, -25, 40, -6, -13,
+  14, -50, -61, -13, 34, 24, 24, -56, -18, -23, -18, 32, -33, -40, 25, 2, -21, -10, -27, 3, -17, 10, -28, 65, -1, 21, 8, 34, -25, 45, -32, 19,
+  -6, -19, -61, 52, 4, 11, -32, -18, -30, 26, 8, -48, -38, -26, -41, 17, 51, -35, -58, -48, -69, -29, 14, -8, 7, -68, -36, 50, 10, 15, 13, -33,
+  -61, 14, 58, -10, 25, -29, -44, -27, 41, -4, -14, -73, -27, -42, 0, 5, 91, -14, -5, 12, -8, -30, 18, -16, 38, -41, 41, -13, 9, -33, 4, -19,
+  -7, 40, 8, 0, 0, -2, 37, 9, 23, -6, 26, -20, 9, -49, -7, -20, 3, 20, 60, -51, 21, -16, -71, 37, 43, -51, 106, -17, -44, -29, 41, 35,
+  -4, -63, 17, -59, -14, 43, 48, -66, -18, -7, -23, 35, -8, -24, -59, 48, 10, 4, 45, -17, -35, 29, -39, -44, 5, 13, 51, 17, -23, 41, -5, -30,
+  10, 13, 2, 14, 49, -41, 21, 44, -16, 59, -28, -32, -8, -17, -4, 8, 38, -55, 8, 10, -83, 43, 20, -50, -5, 12, -12, -5, 33, -82, 5, 63,
+  -11, 13, 29, -57, 10, 28, -81, -33, 35, -15, 27, -49, -86, -22, -8, 21, 37, -36, 20, -4, -25, 26, 77, 39, 37, 1, -62, -3, 18, -10, 10, 68,
+  -26, -15, -29, -24, 35, 24, -36, 20, 75, -39, -16, -36, -35, 16, 10, -8, 49, -13, -50, -30, 69, -25, 16, -24, -68, -41, 5, 1, 2, 58, -75, 27,
+  -36, -88, 95, -24, 77, 43, -51, -66, 82, -32, 2, -38, -7, 10, 68, 16, 60, 7, -7, -36, 22, 7, 37, 67, -51, -19, -13, 18, 95, 74, 15, 69,
+  5, 2, 97, 33, -33, -29, -14, -15, 79, 81, -7, 5, 28, 25, 70, 74, -60, 28, 5, -49, 84, 6, -50, 23, -73, 24, 16, 10, -4, 9, 12, -56,
+  10, 60, 46, 8, -10, -20, 53, 22, 45, 3, 6, -62, 10, -55, -31, 63, -53, -53, 48, 10, 71, -2, -66, -20, 63, 2, -9, -7, -49, 11, 43, -31,
+  6, -11, -87, 22, 49, -56, 43, 36, -55, 36, 8, 18, 38, -28, 7, -19, 3, 35, 8, 22, -22, 3, -12, 3, -3, -22, 32, 51, -15, -34, 80, -50,
+  46, -42, -5, 23, 31, 1, 40, -13, -29, 18, -4, -17, -35, -2, 7, -71, 9, -83, 14, -4, 55, -48, -10, -69, 54, -27, -3, -32, 25, -21, -21, 58,
+  84, -30, 24, -14, -8, 52, 22, -23, 24, -8, 37, 55, 33, 37, 41, -28, 99, -15, 69, -7, 0, -90, 72, 77, 26, -6, -21, -53, 35, 76, -5, 58,
+  17, -86, 47, 125, -13, 65, 23, -8, 10, 54, 19, 96, 11, 0, 85, 53, 22, 60, 20, 52, 69, 62, -5, -17, 60, -25, 49, 72, 36, 55, 49, 6,
+  -45, 16, -11, -6, 62, -35, -47, 72, -43, -35, 10, -32, 60, 19, 34, -17, 66, 45, 6, -45, 4, -32, 28, 40, 15, -45, 24, 43, -11, 22, -57, -11,
+  7, 3, 9, 23, -72, -63, 48, -9, -27, 61, -80, -124, 99, -9, -4, -10, -40, -89, -22, 1, -14, 72, -27, 8, 40, 69, 2, 103, 10, 10, 47, 62,
+  0, 47, -53, 17, 79, -9, 22, 53, 58, -38, 59, 48, -8, 9, 44, 4, 24, 52, 20, 25, -45, 36, 15, -12, -8, -14, -53, 27, 2, 61, 21, 16,
+  -90, 53, 70, 11, 94, 48, -97, -28, 60, -26, 52, 31, -82, -50, 97, -37, 5, 13, -20, 29, 76, 49, 0, 65, -79, 19, 55, -10, 73, -18, -71, 76,
+  14, 35, -12, -11, -78, 13, 31, 5, 46, -2, -73, -9, -23, -21, 21, -51, -32, 69, -31, -44, 14, -23, 9, 18, 6, -35, 20, 12, -64, 73, 13, -20,
+  -42, -27, -22, -17, -26, -9, 26, 23, -5, -35, -16, 78, -31, -1, -35, -44, -36, -28, -69, -1, 5, 5, 14, 33, -65, -42, -4, -48, 12, 2, -17, -32,
+  5, -8, 25, -20, -8, -5, 31, 26, 47, 2, -66, -14, -22, 18, 10, -8, -19, -14, -21, -48, -1, 8, -22, -51, 22, 3, -32, -32, -78, 35, -4, -69,
+  -37, -37, -51, 7, -47, 18, -5, 4, -96, -20, -72, 54, 25, 18, -71, 33, -68, -40, -72, -46, -79, -63, -13, -25, -73, 14, -47, -13, -47, -47, -25, 49,
+  -102, 11, -59, 16, -47, 16, -54, 5, 12, -4, -65, 65, -23, 2, -11, 15, 46, 49, -28, 48, -10, -15, 23, 59, -64, -34, -82, -17, -17, -50, 6, 32,
+  -36, 5, -25, 8, -42, -50, -127, -44, -42, -32, 35, 0, -55, 61, -53, -54, -31, -33, -67, -2, -21, -88, 14, 34, -101, -10, -72, -15, -24, -9, -94, 15,
+  -66, -41, 1, -19, 11, 20, -54, -46, 59, -53, -41, -26, -20, -49, 12, -56, -44, -23, -38, -34, 29, -25, 31, -3, -61, -17, 2, 12, 17, -14, 13, -12,
+  -13, 46, 66, -36, -8, 19, -8, -33, 59, -90, -2, -83, 50, 1, 43, -57, -49, -77, 10, -57, 92, -94, -47, -50, -4, 20, 57, -93, 10, -22, -32, -30,
+  48, -28, 15, -26, -39, 19, 42, -118, -69, 19, 30, 38, -18, -26, -60, -41, -6, -7, -16, 1, -73, -57, 60, 11, 26, -48, -5, -15, -37, 21, 20, -55,
+  -79, -67, -10, -46, -2, -28, -63, -22, -52, -70, 7, -32, -32, -49, 30, -6, -15, 4, -22, -95, -52, -39, 29, 32, -80, -47, -25, -76, 77, -11, -54, -66,
+  -42, -7, 26, 41, -75, -74, -55, 49, 9, -44, -10, -67, 46, -1, 46, 49, -93, -61, 32, 76, 8, -37, -92, 8, -26, 18, 60, -95, -95, 20, 17, 17,
+  19, -14, -45, -77, 34, 7, 8, -48, -58, -94, 42, 16, -2, -80, -93, -49, -48, -57, 1, -65, 62, -97, 20, -24, -44, -33, 0, -30, -1, -5, -1, -19,
+  28, -79, -11, -27, 18, 0, -33, 9, 18, -54, -20, -2, -41, -58, -64, 38, -6, -23, 50, 32, -35, -24, 50, -55, -6, 70, 30, 22, 19, 26, 7, 24,
+  -38, -14, 35, 55, -5, 44, -16, 44, 14, -11, -15, 45, -60, -26, 47, 47, -19, 81, -49, 22, -6, 44, 24, 93, -30, 34, -1, 20, -59, 12, -5, 75,
+  43, 54, -30, 57, 24, 18, -12, 83, -60, 48, -40, 40, 50, 63, -98, -7, 14, 44, 50, 39, -30, 11, 48, 30, -13, 89, -44, 24, 56, 39, 57, 33,
+  -43, 25, 12, 26, 4, 21, 5, -29, -20, -19, -25, 78, -50, -13, 50, 48, 39, 2, -8, 15, 32, 23, -9, 66, -68, -21, -14, -4, 20, 16, -62, -71,
+  -37, 33, -20, 1, -50, -19, -9, 11, -22, -22, -6, -60, 23, 71, -26, 14, -7, -5, -14, 15, 7, -11, -30, -57, -24, 9, -45, -52, -37, -38, 0, -32,
+  -51, 32, -49, -114, -55, -65, -22, -29, 2, -119, -47, -85, 5, -27, -10, -116, -18, -105, -39, -15, 21, -78, 5, 2, 1, -42, -77, -27, -13, -74, 19, 0,
+  -64, -4, -12, -44, -1, -77, -123, 10, -10, -92, -38, -127, -65, 20, 28, -56, -12, -116, -35, 62, 30, -77, 3, -55, -66, 99, -27, -26, 38, -88, -53, 52,
+  7, -21, -9, -50, -72, 31, -33, -21, -9, -51, 27, 88, 4, 58, -24, -101, 57, 51, -52, 2, 18, -68, 83, 22, 20, 53, -1, -50, 84, -8, 11, -15,
+  -57, 3, 39, 23, -42, 6, 22, -54, -9, -49, 8, -38, 9, -61, 25, 16, -2, 6, -80, 33, 26, 33, 24, 33, -16, 6, -32, 19, 22, -1, -33, -4,
+  15, 37, -21, 40, 14, 33, -62, 39, -19, 59, 24, 1, 22, 67, -60, 74, 30, 18, 5, -49, 4, 57, -23, 77, -31, -25, -5, 16, 23, -23, 14, -80,
+  -2, -12, -8, -57, 44, -34, -26, -1, -5, 2, -37, -29, 25, 12, 39, 9, 34, 26, 39, -10, -4, 44, -20, 17, -21, -15, 62, 34, 26, -40, -77, -51,
+  53, 60, -35, -39, -8, -85, -31, 3, 25, -55, -29, -63, -17, -49, 19, 32, -25, -10, 37, 77, -11, 36, -54, -55, 71, 89, -22, -27, 19, -31, 55, -9,
+  -35, 53, -37, -48, 18, 70, -18, 45, -12, 14, -4, 40, 62, 9, -25, -1, -1, 46, 4, -22, -5, -48, -9, 38, 18, -23, -39, 5, 2, -42, 30, -47,
+  -75, 40, -7, -34, 102, -4, -8, 24, 5, -104, 123, -11, -14, -18, 25, -72, 80, -1, -39, 23, 49, -78, 47, 41, -49, 80, -20, -86, 34, -11, -8, 60,
+  28, 11, -33, -34, -8, 51, -18, -3, 45, -3, 4, -2, 50, -13, 37, -49, -34, 39, 23, -11, 7, 11, 13, 77, 19, -39, -39, 41, 62, 66, -34, -18,
+  -7, 19, 11, 36, -19, -36, 16, -40, 42, 90, 5, -23, 10, 15, -4, 76, -60, 14, 81, -47, 55, 86, 6, 3, 75, 16, 56, 29, -73, 40, -18, -34,
+  30, 87, -61, -6, 55, 24, 94, 81, 9, -73, 12, -3, 47, 27, -34, -44, -25, -69, 28, 48, -35, -72, -71, -72, 49, 103, 38, -48, 14, -60, 83, 52,
+  27, -19, 4, -79, 20, 6, -52, -23, -9, -58, 42, -25, 2, 34, 35, -46, 85, -60, -55, -18, -18, -44, 15, -53, -14, -47, 24, -105, 45, -3, 60, 28,
+  34, -105, 55, -85, -22, -30, 56, -104, 94, -100, 23, -24, 7, -57, 79, -39, 16, 2, -12, -36, 8, -104, -63, -14, -20, -11, 55, -120, 31, -17, -46, 6,
+  3, -60, 28, -34, -61, 2, -29, -57, 40, -29, -61, -18, 31, -84, -3, -49, -28, -32, -33, -62, 45, -12, -33, 36, 33, -33, 57, -10, 37, -30, -13, -4,
+  -14, -88, 52, -68, 18, -70, -9, -67, -36, -77, -33, -31, 43, -46, -35, -6, -8, 23, -12, -30, 12, -28, -44, 8, 36, -33, -25, 23, -35, -25, 57, -3,
+  -6, 25, 21, 14, 67, -17, -2, 52, -56, 76, 22, 8, -22, -12, -38, -2, -16, -28, 51, 17, -18, 24, 17, -63, 24, -34, -40, 77, 45, -31, 55, 42,
+  28, -45, -33, -12, -49, -37, 19, -9, 8, -60, -9, -38, -16, -40, -15, 15, 60, -1, 1, -66, 40, 46, -42, 24, 27, 4, 52, 96, -41, 25, 5, -68,
+  57, 14, -9, 21, -23, -40, 62, 41, -40, 19, 2, -5, -24, 40, 13, -30, 4, -2, 3, -45, -11, 6, 60, -13, 45, -95, 42, 66, 6, -42, 0, -75,
+  49, 44, 16, -16, 5, -93, -42, 82, -37, -28, -3, -89, 6, 42, -15, 29, 42, -54, 9, 3, 16, -20, 46, -11, 27, 17, -4, 6, 60, 16, 27, -59,
+  8, -15, 57, -48, 33, -18, -6, 16, -26, -9, -5, -29, -38, 12, 15, -6, -43, 6, 43, 43, 15, -31, -31, -58, 27, -19, 16, 10, -3, 14, 39, 12,
+  12, 14, -46, -53, 60, 27, 14, 11, -83, 4, -12, 46, -17, 72, -6, -44, -4, -22, -50, 35, -24, -25, -29, 43, -55, -44, -8, 23, -12, 74, 4, -78,
+  -5, -12, -47, 38, -41, -79, -16, -29, -36, 100, -88, -38, -35, -86, -45, 105, -43, -75, -12, -35, 42, -8, 1, 13, -1, 46, 54, 15, 16, 21, 38, -5,
+  13, -26, 59, 20, 46, -26, -2, 12, 51, -20, 39, -15, -31, 18, 35, 2, 47, 36, 28, -26, 17, 40, 19, -56, -16, -49, 1, -16, 37, -11, -1, 31,
+  -21, -10, 30, -31, 39, 41, 18, -12, 12, 28, 29, 43, -8, 10, 6, -1, 16, -1, -40, -3, -8, -45, -28, -40, 23, -57, -11, -64, -58, -6, 76, -45,
+  31, -6, -37, -104, 4, 28, -52, 0, -36, 4, 63, 59, 20, 59, -13, 14, 12, 6, -5, 8, 1, -38, 36, 33, 65, -18, 22, -43, 19, 78, 47, 9,
+  -19, -9, -19, 71, 50, -73, 34, 40, -49, 98, 39, -38, 32, 23, 21, 36, -9, -100, 43, 26, -15, 40, -55, -48, 51, -40, 4, 77, 14, -71, -24, 15,
+  13, -46, -12, 4, 29, 24, -15, -45, 19, 10, -29, 29, 1, 4, 18, -20, 14, 2, -38, 25, 2, 5, -43, -62, -9, -11, 33, -20, -26, -4, -33, -33,
+  -85, 47, 20, 41, -48, -61, -49, -28, -29, 38, 25, 13, 24, -82, 4, 92, -17, -25, 42, -31, -52, 7, 19, 15, 21, -44, -31, 0, 41, 23, 25, -5,
+  13, 2, -50, 66, 22, -60, 25, 127, -47, 29, -15, -21, -82, 106, -28, 14, 13, 13, -8, 61, 62, 37, 20, 2, -93, 1, 13, -53, 26, 37, -56, 39,
+  -15, -23, 53, -9, -79, 78, -21, -1, 81, 72, -41, 101, -20, 59, 19, -33, -78, 22, -8, 44, -44, -22, -74, 78, 14, 70, 15, 19, -71, 18, -14, 17,
+  -43, 14, -90, 35, 47, 28, -66, 34, -54, -28, 95, 24, 9, -1, -30, -12, 74, 1, 13, 35, -51, 47, 18, -6, -13, 48, -52, -31, 66, -6, -27, 41,
+  24, -43, 71, -13, 59, 37, 25, 42, 21, -32, -13, 57, 57, -49, 47, 17, 8, 86, 22, 44, 17, 4, 10, -16, -11, 5, 55, -5, 45, -12, 16, -13,
+  50, -52, 14, -33, -43, 34, 54, 18, -32, 40, -80, 65, 67, -30, -21, -28, -14, 43, -20, 82, -9, -7, -81, -38, 36, 24, -32, 17, -27, -91, 53, -9,
+  -15, -9, -88, -47, 83, 10, -25, 28, -5, 5, 47, -80, -2, 15, -10, 2, 2, -7, 21, 45, -29, -30, 18, 54, -21, -35, -14, -35, 4, -38, 40, 16,
+  -1, -2, 3, 17, -11, -2, 67, -12, 46, -11, 13, -5, 64, -58, 52, 13, -17, -25, 20, -3, 2, -34, -35, 40, 10, 33, -20, 72, -60, -54, 56, -22,
+  8, 71, -5, -45, 59, 49, -14, -41, -91, 30, 46, 25, 52, 6, -59, 8, 63, 8, 34, 15, -106, 18, 26, -11, 45, -43, 54, -42, 31, -42, 71, 40,
+  48, -35, 50, -69, -11, -1, -20, 38, -29, -22, 71, 32, -43, -55, 17, -15, 26, -25, 20, 2, -26, 23, 60, 3, 15, 12, 27, 7, 7, -13, -4, -42,
+  -38, 25, 37, 34, 0, 24, 36, -22, 46, -18, -6, 31, -11, 46, 42, -53, 16, -35, -24, 10, 57, -71, 36, 30, -1, 3, 47, 4, 1, 21, 29, -10,
+  9, 28, 16, -49, -31, -50, -24, 59, -72, -2, -7, -53, -36, 26, -25, -8, 24, -24, 23, 53, -53, 44, -2, 16, 27, -20, -30, 64, 20, 74, 102, 31,
+  -63, 54, 17, -17, 76, -28, 21, 55, -47, -6, 42, -11, -41, -1, -65, 44, 114, 10, 38, -5, 26, 72, 76, 38, 30, 6, -42, -31, -6, 20, 69, 18,
+  -12, -33, -10, -25, 108, -51, 82, -20, 22, 38, 44, 29, 9, -40, 27, 72, 21, -32, 91, 18, 36, 35, 14, -24, 6, 1, 72, 20, 23, -35, 9, 35,
+  -29, -1, -1, -22, -11, 5, 9, 3, -14, -40, 31, -30, 50, 67, -21, 2, 66, -3, 40, 15, -16, 17, -34, 0, 16, -74, 27, 15, 1, 10, 46, -31,
+  -71, 15, -43, 44, 37, -53, -30, 29, 49, -1, 16, 46, -8, -49, -11, 57, 14, -12, -93, 22, 66, 59, -18, 9, -61, -44, 33, 42, 24, -33, -46, 64,
+  11, 1, -22, -19, -39, 18, -2, 29, 37, 35, -29, 23, -28, 35, 35, -45, -60, 64, -31, 63, 83, 18, -99, 48, -40, -2, 79, -16, -32, 35, -26, 30,
+  68, -8, -44, 15, 66, -31, -127, 53, -66, 6, -8, -30, -41, 10, -92, 23, 44, -6, -67, -37, -34, -16, 24, 16, 12, -57, 6, -32, -30, 49, 42, 30,
+  -40, 26, 67, 2, -3, 51, 23, 46, 44, 6, -27, -7, 16, 12, 9, 11, 29, -41, 66, 18, 42, -24, 18, -55, 7, 11, 47, 43, -20, -12, -1, 7,
+  -28, -12, -26, 39, -7, -87, -49, 14, -22, -11, -14, -33, 35, -11, -62, -10, 84, 0, -30, -2, -59, 8, 18, -46, -9, -5, -61, -30, 40, 12, -26, -63,
+  -89, 74, 70, -17, -34, -2, -27, 23, 56, 16, -18, 51, -22, 1, 41, 29, 15, -18, -81, -2, 54, -8, -15, 6, -29, -15, -29, -22, 19, 28, -22, -46,
+  9, -7, -44, 30, -58, 14, 37, -72, 9, 39, 21, -62, -39, -12, 35, 18, 7, -80, -51, 6, -63, -41, -3, -11, -16, 18, 21, 14, 45, 65, 30, 25,
+  11, 2, 77, 18, 57, 8, 17, 39, 56, 39, 59, -39, -72, 11, 44, 42, 21, 20, 2, -22, 17, 47, 74, -51, 62, 12, -39, -12, 19, 44, 26, 31,
+  7, -35, -17, 36, 62, -55, 10, -28, 80, -67, -2, 70, -8, -50, 44, -55, -5, 38, 36, 46, 16, 10, 7, 4, -20, 51, 55, -27, -43, -25, 43, -60,
+  39, -26, -90, 79, -20, 54, 64, -2, -21, 69, 26, -22, 15, 28, -55, 49, -40, -58, 13, -38, -92, 42, 18, 13, 4, -70, -46, -13, 8, 26, -6, 18,
+  -31, 1, 20, -17, 19, -49, -42, 29, 1, -66, -18, -71, 12, 73, -10, -9, -33, 54, 7, -5, -38, -11, 9, -66, -36, 89, 35, 28, -1, -62, -40, 69,
+  -29, 50, 8, -98, -40, 45, 0, 113, 23, -44, -31, -2, -17, 18, -33, -36, 53, -13, 34, 44, 39, -78, 7, -60, -61, -47, 43, -16, 7, -16, -3, -71,
+  51, -53, 16, -8, 9, -69, -20, -76, -38, 3, 31, 13, 67, -48, -59, 16, 37, -13, 77, -63, 30, 57, 1, 16, -28, 17, -33, 15, -7, 30, -19, 28,
+  -94, -61, -58, -80, -10, -54, -48, 14, -13, -72, -94, -90, 19, 6, 77, 34, 0, -5, -54, -45, 118, -15, -41, -98, 10, 2, 84, -38, -1, -40, 21, 53,
+  26, -33, -42, 13, -77, 47, -8, 35, 50, 1, -79, 43, 46, 25, -42, -22, -88, 16, 45, -20, 10, -59, -11, 10, -21, -20, -16, 18, -64, 16, 49, -57,
+  57, 19, -4, 88, 60, -87, 50, 16, -43, 25, 38, -89, -17, 77, -17, 109, -23, 42, 30, 36, -25, 79, -46, 22, 12, -19, -49, -34, -42, -32, -12, -49,
+  -70, -28, -5, 45, 8, -21, 40, -4, -48, -15, 13, -63, -13, 12, -56, -22, 53, -88, -20, -41, 6, 21, 41, 11, 21, -53, -105, -7, 44, -67, -22, -25,
+  -50, 65, -78, 20, 35, 43, -11, 20, -11, -67, 18, -22, -61, -4, 19, -3, -7, 78, 60, 43, 8, 25, -26, 29, -16, 75, 2, -72, 18, -36, -5, 54,
+  -56, -82, -34, -46, 18, 19, -15, -92, -22, -42, 0, -28, 12, -88, 59, -12, -13, -23, 24, -25, 19, -35, -13, 7, -82, -90, -19, -8, 35, -11, 8, -91,
+  30, 31, 104, -73, 19, -64, -33, -20, -4, -38, 55, -127, 74, -37, 4, -102, -36, -22, 88, -32, 14, 17, -34, -23, 29, -26, -8, 27, 53, -19, 74, -13,
+  -14, 76, 24, -66, 2, -1, -40, 58, -60, -25, -34, -11, 34, 85, -74, 6, -9, 15, 44, 37, -37, -11, 64, -20, 77, -26, -81, -31, 60, -2, -19, -7,
+  -42, -13, 36, 29, -4, 3, 25, -59, 119, 26, -7, -31, -24, -114, 35, 66, 24, -79, -15, -87, 46, -14, -54, -5, -34, -110, 102, -55, -22, -90, 35, 43,
+  38, -92, 40, -62, 29, 47, 19, -38, 60, 23, 34, 89, 61, -65, -6, 2, -16, -12, 67, -47, 33, -41, -76, -20, 29, -17, 48, 2, -51, 23, 85, -66,
+  48, 67, -88, -58, 52, -62, 3, 57, -45, -54, 42, -49, 39, 42, -34, 10, 48, -8, 23, -61, 4, -33, 27, -15, 8, 3, -34, 14, 53, -72, -8, -51,
+  -12, -76, 100, -59, -6, 24, 87, -48, 51, -32, -56, 33, -15, -16, 123, -66, -15, -13, 36, 65, 81, -23, -58, -1, -12, -9, 113, -61, -33, -19, 42, 15,
+  120, -32, 16, -73, 62, 19, 69, 1, 17, 59, -48, 13, -26, -42, -16, 24, 19, 56, -46, 15, 49, 33, -81, 12, -3, -36, 48, 47, -76, 42, 51, -47,
+  10, -43, 39, -23, -11, -86, 41, -65, 1, 15, -30, 12, 16, 36, 5, 0, -18, 8, 23, 80, 37, 31, 45, 4, -76, 1, -43, 4, 69, 33, 7, 41,
+  -19, 77, -10, -55, -53, -6, 17, 42, -54, 30, -1, -48, -11, 65, -61, 90, 3, -11, -38, 55, -47, -8, 41, -25, -43, 28, 43, 7, 35, -70, -19, 27,
+  -45, 73, 59, -38, -87, 23, 18, 0, 51, -96, -5, -17, -14, 16, 56, -64, -31, 39, -32, 4, 19, -39, 62, 50, -2, -46, -25, -39, 35, 68, 39, 63,
+  -47, 14, -24, -3, -38, -34, 73, 50, 37, 58, -25, -52, 92, 14, -18, 27, -49, 24, 96, -28, 44, 100, -54, 44, 43, -60, 9, 109, -67, -5, -25, 48,
+  69, -22, -28, 5, 34, 27, 54, 20, 50, -23, -85, 15, -110, -113, 7, -35, -69, 15, -64, -31, -13, -21, -59, -3, -78, -36, 30, -15, -4, 14, -60, -60,
+  37, 11, -37, -5, 5, -6, -35, -44, -23, 30, -64, -44, -50, 44, 6, 12, 18, 50, -72, 60, 19, -17, 10, 28, 12, 8, 18, -9, 31, 39, -65, 32,
+  -34, -80, 4, -37, 17, 42, -51, 29, -75, 14, 6, -23, -28, -39, -24, -79, 20, 13, -7, 10, 20, 6, -7, 20, -7, -77, 63, 21, 15, -64, -2, -52,
+  30, 14, -8, 26, 12, 49, -16, -12, -83, 20, -6, 15, 59, -59, -32, -22, 19, -44, 69, -12, 13, -6, -83, -43, 16, -46, 21, 42, -7, -24, 19, -21,
+  -12, 72, -34, 67, -95, 36, 10, 34, 21, 11, 20, -40, -46, -1, -8, 2, -76, 19, 2, 23, 46, -38, -53, 56, -50, 45, 45, -4, -10, 51, 24, -10,
+  -36, -92, 31, 56, -21, 37, 44, -122, 9, -6, -79, -6, 58, -51, 8, -25, -21, 61, -45, -23, 29, 35, -3, 23, 38, -82, 84, 23, -58, 41, 9, 8,
+  57, -53, 9, 2, 6, 37, 83, 0, 18, 43, -3, 39, 72, -68, 4, 66, -2, 43, 30, -53, -29, -11, -12, 59, 65, -54, -40, -1, -6, 54, 87, -69,
+  -21, -34, -18, -13, 43, -31, 8, 26, -21, 30, 18, -55, 36, 40, 43, 47, 30, -84, 40, 41, -27, 33, -18, -79, 34, 24, 31, -20, 40, -20, 28, -38,
+  14, 16, 41, -73, 37, -36, -13, 23, -8, -49, -11, -33, -45, -19, 17, -57, 13, -27, 27, -28, -43, -9, 28, -39, 6, 43, 7, -8, -1, 16, 19, -1,
+  -22, 9, 1, 3, -30, 56, -21, 5, 34, -6, 5, 23, -58, -16, -23, -41, 55, 24, -15, -53, -9, 19, 50, 73, -23, -38, 34, -20, 17, -8, -30, 0,
+  1, -34, 28, -14, -50, -19, 31, -49, -10, -33, -48, -11, -34, -9, 18, -2, -98, 19, -6, 56, 33, -60, -87, -5, -34, 32, 18, 15, -48, -42, -10, -29,
+  3, -44, -80, 7, -16, 29, 8, 8, -64, -33, -24, -19, -16, -9, -83, 15, 30, 21, -89, -20, -68, -77, -9, 69, -64, -32, -10, -82, 24, 39, -21, -48,
+  -39, -67, 23, 44, -44, -21, -20, -52, -24, -3, -12, 42, 4, -44, 27, -24, -42, -7, -29, -79, -50, 10, -103, 20, -14, -92, -50, -2, -38, 4, -18, -45,
+  -54, -2, -19, -21, -81, -12, -17, 31, -3, 41, -46, 13, 33, 64, -22, -10, -17, -2, 11, 86, 5, 51, -11, -29, -16, 19, -28, 26, -58, -34, 2, 72,
+  -65, 30, -4, -70, 13, 37, -15, 17, 1, -56, 25, 30, -31, 2, -51, -84, 18, -15, -29, 33, -26, -66, 51, 42, -81, -10, 8, -5, -1, 33, -55, 2,
+  -39, -13, 49, 40, -10, 14, -68, -16, 54, 30, 24, -29, -88, -71, 56, -12, 10, -16, -55, -45, 55, 24, -19, -35, -1, -16, 20, -12, -6, -34, -15, 7,
+  36, 13, 25, -31, -37, -54, 57, 27, 17, -23, 25, -41, 4, 4, 11, -8, 0, 19, 68, 35, 18, 23, 17, -42, 12, 26, -32, -24, 25, -19, 36, -5,
+  -18, -17, -26, -9, -6, 3, 40, -36, -16, -35, 4, 45, -1, -13, -19, -18, 19, 21, 65, -25, -33, -72, 32, -27, 10, 30, 16, -34, 35, -39, -31, -74,
+  15, -79, 7, -56, -15, -21, 46, -62, -2, -49, -24, -8, -49, -12, 73, -18, -29, -6, -7, 17, 68, -23, -16, -39, 13, -42, 8, 28, -34, 43, -32, 31,
+  50, -4, 25, 31, -27, -12, 8, 35, -14, -10, -4, 13, 46, 2, 9, 56, -26, -28, 79, 41, -47, 60, 34, -14, 83, 0, -9, 21, -12, -47, 47, -52,
+  -34, 61, 26, -25, 26, -59, -38, 25, 26, 49, 21, 22, -56, 56, 15, 54, 43, 2, -48, 25, 18, 37, -25, -9, -60, -27, -34, 28, 16, -12, -74, -49,
+  -38, -36, -11, -4, -72, -19, -30, -17, 33, -67, -59, -31, -35, -43, 18, -84, 5, -2, 5, -40, 52, -66, -2, -38, 32, -13, 44, -44, -15, -72, 43, -36,
+  14, -72, -45, -27, 11, 27, -28, -60, -13, -15, 35, 42, 45, -63, -19, -30, 37, -16, 50, -10, -46, 28, 11, 3, 52, -49, 4, -11, -6, 4, 47, -17,
+  5, 26, 17, -2, 8, 21, -1, 41, -8, 14, 63, 13, -58, -5, 7, -17, 34, 22, -38, 60, 31, 49, 34, 1, -17, 72, 3, 18, 82, -21, -66, 41,
+  27, 47, 48, 27, -51, 83, 60, 34, 16, -3, -85, 86, 63, 25, 64, -18, -60, 51, 40, 61, 14, 15, -8, 38, -18, 50, 45, -24, -42, 2, 9, -14,
+  52, 38, -46, 53, -5, 44, 9, 36, 6, 4, 20, 5, 22, 9, -48, 3, 37, 49, 54, 67, -37, 23, 18, 1, -28, 25, -98, 10, 0, 56, -19, 11,
+  -99, 59, 61, 54, 62, 0, -112, 61, 15, 24, 44, 47, -107, 49, -2, 21, 11, 27, -114, 4, -11, 16, -3, 1, -50, 30, -50, -30, -13, 61, -70, 30,
+  17, -19, 41, -11, -80, 28, -28, 9, -16, 10, -82, 65, -12, -32, 20, 45, -7, 63, -18, 6, 53, 23, -9, 48, 9, -50, 52, 31, -30, 81, 16, 10,
+  73, -20, -49, 76, 6, -65, 25, -18, -106, 119, 1, -6, -13, -32, 48, 127, 3, 27, 17, -33, -7, 109, -15, -14, 42, -21, 33, 30, 23, 3, 50, -46,
+  55, 31, 13, 17, -25, -60, -7, -43, 5, 30, 31, -13, 38, 5, 47, -23, 45, -54, 37, -31, 60, 41, 36, -6, 26, 0, 98, 19, 4, -28, 10, 56,
+  27, -6, 57, -5, -8, 45, 58, 36, -22, 11, -4, 5, 19, -5, -11, 5, 11, 36, 17, 32, 36, -50, -15, 43, -11, 0, 16, -54, -56, 3, 9, 16,
+  -12, -63, -36, 37, 12, 27, -64, 14, -55, -2, 37, 7, -49, -40, -78, -27, 32, 30, 2, 4, -91, 25, -4, 43, -15, 44, -4, 35, 35, 35, 18, -15,
+  -37, 23, -28, -33, -40, -9, -18, -26, 11, -48, -20, -24, 26, -52, -26, -56, -54, -5, 12, -32, -7, -87, -34, 26, -4, -49, 12, -18, -42, 31, 47, -38,
+  19, -57, -11, 55, -9, -20, -45, -51, -13, 29, -4, 33, 28, -37, 2, -22, 52, 60, 30, -31, 26, 5, 25, 104, -4, -29, 23, 39, -11, 35, 66, -77,
+  16, -13, 1, -59, -11, -35, -22, -9, 30, -45, -48, 5, -30, -16, 8, -27, -62, -15, -29, 15, 10, 30, -13, -37, 22, -6, -6, 16, -16, -11, 34, -28,
+  -36, 24, -16, -16, 35, 44, -32, -5, -21, -28, -5, 1, 3, 15, -40, -27, 33, 37, 26, -3, -60, -11, 43, -1, -14, 20, 13, -32, 14, -9, -2, 5,
+  -17, -36, -26, 7, 12, -30, -14, 10, 23, 51, 9, 25, 12, 1, 2, 54, -11, 60, 22, -26, -37, 30, 22, 64, 1, -33, -36, 6, 18, 23, 4, -10,
+  -5, 11, 7, 19, 27, -17, -20, 54, 22, -2, -9, -1, -18, 24, 43, 13, 25, -15, -65, 13, 4, 13, 33, -29, -8, -15, 54, 19, -15, 43, -16, -12,
+  -1, 21, 19, 3, -37, 38, 14, 22, 20, -29, -55, 31, 7, -5, 50, -27, 23, -28, 20, -4, -9, -18, -18, 4, -12, 12, 12, 11, -11, -30, -42, -4,
+  39, 6, 14, -13, 23, -32, 12, -6, -21, 4, -33, 22, 18, 16, 61, -7, 11, -2, -8, 5, -106, -23, -31, -16, 36, 44, -127, -23, 15, 8, 37, -23,
+  -89, -25, -30, 72, 27, -30, -52, 23, -5, 79, 22, -37, -51, -16, -40, 36, -29, 14, -97, -3, 4, 27, -29, -30, -26, -39, 7, 35, 10, 8, -43, 22,
+  28, 8, 44, 25, -32, 12, 36, 54, -20, 42, -3, 8, 9, 72, 2, -48, -24, -79, 28, 23, 11, -23, 8, -23, -39, 30, 78, -11, 9, -5, -16, 82,
+  2, 45, -16, -42, 18, 98, 18, 38, -11, 13, 44, 78, 38, -22, -7, 2, -22, 47, 37, 33, -18, -9, 40, 92, 14, 1, -42, -48, 10, 67, 34, 10,
+  -39, -50, 18, 61, 36, -4, 8, -24, -7, 7, 40, -14, -34, -35, 60, -17, -19, -33, -55, -46, 27, -9, -3, 9, -60, -71, -40, 4, 59, -18, 14, -54,
+  -7, 34, 8, 15, -11, 4, 20, 74, 22, -23, 21, -17, 41, 7, 22, -16, -21, -16, -29, -2, -14, -23, -22, -75, 7, 39, 5, -47, -1, -60, -12, 68,
+  19, 14, -13, -70, -13, 22, 15, 16, 16, -5, -32, 36, 53, 5, -22, -13, -29, 23, 77, 16, -3, 22, 1, 12, 2, -31, -29, -11, -13, -7, 12, 18,
+  0, 14, 28, 3, 33, -26, 34, -15, 15, 44, 4, -27, 4, -59, -58, 9, 24, -15, 17, -37, 6, -4, 11, -15, -17, 0, -41, 21, -13, 11, -5, -19,
+  -20, 11, -8, -33, 25, -68, -40, -50, 1, -49, 8, -70, 13, -29, 13, -2, 5, -58, -35, -57, -40, -41, 8, 0, 30, -17, -30, -2, -12, 10, 29, -71,
+  -7, 22, 27, 45, 42, -27, 16, -14, 79, 36, -5, -68, 9, -63, 84, 33, 7, -29, 23, -24, 46, -8, -13, -34, 53, 0, 34, -61, -14, -29, 44, -30,
+  40, -60, 1, 11, -8, 36, 34, -24, 30, -17, 23, 69, 31, -28, 17, -14, 56, 45, 44, -29, 36, -42, 2, 35, 6, 5, 12, -25, 63, 3, 70, 22,
+  7, 44, 34, -5, 56, -34, -22, 12, -19, 6, 52, 6, -3, -24, -3, 17, 13, 24, -16, -39, -47, -23, 32, -21, -54, -36, -50, 48, 61, -26, -17, -20,
+  -42, 25, 24, -9, -6, -19, 7, 5, 54, -19, -35, -52, -10, 52, 56, 7, -4, 5, -48, 4, 24, 24, -29, 8, -29, 24, 61, 35, -31, 14, -17, 36,
+  68, 59, -20, -21, -27, 39, 23, 38, -44, -3, -84, 58, 59, 28, 8, -47, -59, 9, 25, 29, -29, 9, -44, -12, 28, 63, -5, -12, -21, -23, 32, 73,
+  -41, -39, -54, 56, 20, 64, -48, 23, -38, 35, 20, 62, -33, -13, -20, 2, 8, 23, -11, -62, -65, 17, -1, 66, -57, -14, -38, -1, 24, 36, -10, 9,
+  -96, 31, 43, 16, -38, -26, -85, 15, -13, 86, 13, -16, -74, 39, 8, 56, 0, -37, -96, -11, 29, 49, -8, 13, -51, 44, 15, 55, -14, 17, -93, 52,
+  -43, 32, 27, 20, -27, 40, -16, -4, 14, -14, -32, -25, 14, -10, -15, 27, -85, -3, -29, 41, 14, 51, -85, 4, -52, 3, 36, 47, -70, 10, -43, 13,
+  26, 31, -34, -22, -13, -24, 2, 8, -75, 24, -31, -27, 1, 58, -120, -4, -2, -26, 11, -57, -26, -53, -20, 21, 11, 14, -16, -14, -21, -49, -48, 11,
+  -15, -72, -6, 16, -52, 19, -10, -49, -23, 9, -30, 24, -19, -38, -39, -52, -5, -45, -50, -24, -47, 36, -16, -49, -69, -29, -47, -4, 38, 7, -27, -7,
+  -38, 28, 6, 2, -32, 7, -43, -2, 6, 76, 13, -48, -28, -52, 27, -3, 53, -43, 13, 12, 15, -9, 35, -50, -20, -52, -12, 5, 36, -48, 31, 19,
+  2, 18, 5, -23, 11, -17, 32, -20, 22, 32, 17, 44, 41, -5, -12, -53, 66, 19, 64, 40, -1, -37, 7, -13, 58, -6, 32, -48, 7, -29, -7, -14,
+  1, -72, 40, 6, 7, 22, 43, -49, 55, -49, 56, 3, 38, 27, 2, 34, 30, 66, -14, 27, 25, 1, 9, 35, 28, 33, 19, 25, 28, 58, 23, -1,
+  -12, 38, -41, 50, 87, -25, 11, -15, -49, 21, 52, -49, 6, 29, -43, -5, 64, -16, 47, 4, 24, -26, 17, -23, -2, -45, 33, -35, 55, -21, 30, 25,
+  83, -30, 36, 42, -13, 22, -32, -42, 77, 58, -26, -27, -27, -48, 62, 63, -22, 15, 12, 12, 79, 33, 6, 12, -25, -11, 19, 16, -14, 14, -50, -17,
+  34, 11, -31, 18, 8, -13, 77, -11, -24, 11, -58, 25, 17, 50, -42, -8, -13, -1, 20, -17, 9, -22, -31, -9, -62, 27, -27, 47, 35, 51, -22, 14,
+  -23, -11, -1, 47, -3, -11, -17, -14, 24, 81, 15, 22, 8, 30, -33, 78, -30, 18, -53, -33, 20, 27, -72, -13, 0, 15, 52, 21, -26, 4, 8, 27,
+  63, 16, -12, -39, -27, 24, 51, -1, -47, -27, -19, -6, -18, 26, 27, 6, -14, 0, 35, 8, 9, -18, 14, -42, 14, 0, -20, -13, 38, -21, 35, 16,
+  -33, -43, 21, 63, 27, -27, 12, -1, 37, 42, 2, -53, -17, -42, 9, 0, 33, -49, -1, -18, 35, -16, 28, -32, -29, -48, 70, 5, 33, 15, -49, -38,
+  16, -31, -35, 1, -35, -34, 49, -73, -29, -8, -33, -91, 54, -81, -8, -3, -65, -52, 12, -60, -25, -39, -34, -27, 2, -23, -113, -34, -87, -43, -1, -6,
+  -71, -19, -118, -46, 23, -29, -85, -80, -73, -36, 59, -32, -108, 1, -35, -22, 29, -3, -89, -71, -50, 35, 46, -21, -94, -33, -46, -41, -5, -22, -19, -22,
+  -78, -33, 3, 4, -8, 25, -73, -61, 6, 47, 42, 25, -27, -9, -1, 3, -1, -26, -10, -29, -17, -13, 36, 35, -23, -29, 3, -9, -17, 67, -10, -82,
+  -18, -12, -48, 50, 36, -56, 9, -88, -94, 47, -54, -110, -39, -6, -27, -14, -88, -99, 38, -30, 4, -42, -65, -19, 0, 42, -4, -27, -5, -58, -37, 73,
+  40, -89, 26, -46, 15, 14, -55, -31, -22, -29, 26, -84, -11, -67, 9, -103, -3, -63, -1, 1, 2, -54, -41, -33, -14, 25, -9, -40, 30, -112, 14, -23,
+  53, -50, -11, -101, 38, -43, 47, -23, 2, -86, 5, -17, -6, 26, -10, -30, -44, 0, 79, 28, -10, -29, -53, 2, 68, -11, -14, -12, -65, 60, 70, -25,
+  3, -29, -112, 28, 81, -28, -15, -84, -102, 23, -11, 30, 12, -41, -77, 53, 50, 53, -7, -1, -28, 26, 23, 67, 17, -19, -13, 46, -4, 42, 41, -7,
+  0, 68, 9, 29, 27, -8, 2, 19, 27, 63, -16, -64, -8, 15, 8, 44, 16, -88, -19, 80, 1, 42, 31, -75, 9, 82, 43, 84, -8, -23, 14, 88,
+  5, 17, 69, -41, 9, 68, -21, -19, 42, -26, -45, 75, 17, 19, 56, -54, -14, 32, 26, -30, 26, -61, -36, -25, 7, -15, 69, -10, -33, -3, 67, 29,
+  41, -84, 25, -25, 35, -22, -27, -16, 17, 88, 18, 4, 20, -40, 49, 103, 30, -14, 23, -18, 38, 88, 59, 25, 12, 22, 11, 85, 55, 11, -56, -41,
+  -45, 51, 68, -10, -38, -9, -57, 67, 25, 11, 13, -50, -39, 127, -13, 26, -4, 24, -46, 96, 51, 77, 3, -35, 18, 41, 46, 39, -29, -4, 3, 77,
+  26, 66, 1, 17, -43, 106, 1, 42, 8, 31, -49, 9, 26, 69, -8, 16, 47, 52, -13, 13, 20, 0, 44, 59, 8, 56, 30, 47, -14, -6, 36, 47,
+  21, 19, 13, 5, 10, -16, -40, 8, -2, 47, 55, 28, -48, 50, -9, 32, 30, -28, -15, 12, 25, 3, 29, -15, 15, 31, 11, -6, 32, -17, -53, 9,
+  -4, 63, -2, -17, -14, 12, 2, 16, 43, 35, 3, 6, 25, 9, 47, 47, 22, -41, 12, 7, 46, 45, 4, 20, 18, 51, 43, 82, -2, 62, 2, 79,
+  12, -1, -17, 61, -16, 98, 11, 55, 26, 66, -8, 101, -49, -31, -18, 66, -13, 27, 4, 23, -58, 27, -43, -7, 8, -21, 26, 74, -29, 11, 6, 30,
+  4, 79, -40, 29, -22, -7, -17, 63, 27, -16, -44, 28, -24, 92, 20, 7, -48, 15, -82, 87, -20, 43, -30, 36, -13, 52, -42, 59, -63, 37, 5, 72,
+  -60, 31, -27, 7, 7, 42, 8, 30, -93, 72, -44, 80, -8, 81, 3, 11, 19, 40, -48, 44, -61, -6, -35, 116, 15, 50, -43, -29, 4, 74, 17, 10,
+  -82, -36, 42, 110, 17, 18, -35, -3, 17, 87, -37, 35, -19, -61, 17, 30, 24, 26, -48, -52, -8, -22, 75, -46, -50, -37, 32, -18, 79, 15, -66, 43,
+  44, 36, 43, 15, -14, -15, -38, -9, 68, -35, -37, 17, 12, -19, 66, -79, -62, -18, 45, -39, 55, -48, -17, -37, 38, -96, 11, -79, -36, -30, 19, -35,
+  -20, -53, -20, 3, 58, -52, -23, -59, -58, -46, 59, 1, -26, -98, -21, -55, -26, -45, -11, -15, -47, 16, 23, -6, 20, -48, -16, -37, -38, 32, -18, 0,
+  -20, -15, -17, 14, 28, 48, -31, 7, 28, 1, -26, 30, 19, -15, 25, -33, -48, 10, 3, -93, 22, -61, -13, 7, -58, -56, -32, -30, 1, 11, -69, -50,
+  17, -12, 9, -39, -48, -55, -47, -20, -27, -11, -62, -80, 10, 3, 44, 19, -35, -64, 16, -42, -13, 24, -25, -34, 15, -11, -41, -2, -44, -86, 4, 21,
+  17, 36, 11, -92, -20, -2, 28, -9, -51, -57, -48, 6, -17, 22, 11, -27, -16, 56, 16, 24, -9, -15, -63, 10, 28, -6, 20, -27, -12, 54, 20, 4,
+  49, -15, -67, -19, -48, -15, 36, -75, -61, 38, 17, -5, 33, -1, -58, 81, 69, -26, 79, -29, 32, 49, -45, 43, 89, -75, 0, 47, -31, 58, 77, -33,
+  10, 19, 65, 13, -18, -3, 15, -26, -23, 35, 51, -43, -34, 7, -32, -50, 35, -43, 9, 8, 19, -35, 63, 32, 25, -41, 38, 42, 65, -64, -43, -47,
+  48, -18, 0, -59, -60, -31, -14, -94, 51, -9, 0, -68, -9, -50, 52, -67, -4, -18, 35, -71, 58, -18, -83, -55, -34, -42, -14, -73, -75, -52, -23, 23,
+  -18, -3, 31, 0, 40, 46, -22, 40, -56, -46, 16, -29, 57, -57, -24, -44, 29, 18, 3, -39, -10, -7, 24, -14, -14, -43, -26, 15, -17, -4, -18, 35,
+  27, -19, -52, -26, 4, 34, 11, 23, 34, 24, -20, 19, 55, -15, 38, -28, -49, 18, 52, 6, -10, 10, -62, 11, 4, 54, -33, -8, -47, 39, 56, -20,
+  -59, -71, 67, 23, 10, 44, -71, -23, 57, -9, 41, 18, -5, 22, -45, 30, 78, -7, 22, -11, 12, 41, 42, 25, -23, -33, 4, -31, -4, 24, 59, 9,
+  77, 31, 3, 35, 44, -10, 74, -75, -7, 29, -9, 33, 92, -10, 56, 113, 34, 49, 74, -16, -18, 81, -42, -44, 79, -18, -6, 56, 14, -56, 15, -71,
+  20, 21, -1, -12, 57, -41, -48, 12, -19, -29, -1, -49, -20, -40, -54, 30, -44, -76, -31, -66, -22, 16, -34, -60, -54, -76, -51, 27, -17, -93, -47, -24,
+  -74, -13, -25, -62, 7, -36, -19, -4, -32, -41, 13, 45, -23, 67, 55, -77, -17, -72, -53, 4, -23, 17, 44, -51, -70, -14, -83, -3, 22, -27, 9, -11,
+  -72, -29, 68, -79, -27, 35, 12, -40, 65, -31, -18, -15, 13, 59, 53, -2, -17, -15, -9, 29, 44, 1, 11, 24, 21, 29, 23, 7, 6, -13, 17, 100,
+  90, 36, 5, 86, 31, 96, 62, -18, -12, -3, -44, 96, 26, 6, 50, 59, 2, 5, -20, 15, 77, 14, 29, -5, 12, 29, -8, -26, 23, 98, -13, 42,
+  99, 0, -47, 78, 20, 48, 34, -85, 30, 81, -24, 96, 62, -55, 51, 85, 22, 50, 50, -32, 54, 64, -39, 126, 43, 15, 39, 23, -19, 84, 21, -62,
+  71, 61, -58, 61, 33, -71, 19, -19, 46, 116, 74, -10, 60, 13, -4, 120, -37, 75, 27, 18, -45, 63, -43, 16, 60, -75, 39, -43, -16, 89, 53, -59,
+  9, -30, -14, 63, 92, -76, -66, -78, -16, 27, 79, -71, -31, -22, -109, 26, 17, -93, -14, -3, -121, -13, -17, -90, 9, -7, -115, -5, -65, -31, -50, -76,
+  -110, 79, -16, -53, -6, -67, -122, -31, -47, -20, -21, -54, -20, -4, -24, -41, -2, -123, -80, -28, 38, -7, 4, -47, -2, -1, -58, -92, -35, -75, -33, 43,
+  23, -86, -86, -103, -54, -5, -13, 24, -67, -68, -73, 48, -54, -9, -80, 16, -17, -13, -59, -16, -38, 30, 28, 12, -4, 55, -31, 20, 54, -44, -5, -2,
+  51, -13, -23, -77, -50, 16, -43, -33, -36, -23, 4, 25, 4, -49, -60, 32, -87, 13, 17, -29, -41, -13, -11, -6, 82, -54, -10, 16, -7, -25, 42, 44,
+  37, -16, -89, -31, 86, -27, 0, -14, -78, -31, 11, -35, 60, -11, -21, -31, 80, 27, 57, -35, -20, 20, 16, 49, 71, -30, -33, -37, -33, 70, 59, -48,
+  -26, 21, -6, 51, -36, -38, 11, -64, 29, 34, 42, 9, -17, -10, 15, 0, 57, -5, -43, -96, 58, -40, 76, -42, 14, -12, 70, -69, -8, 7, 49, -50,
+  83, -8, 21, 84, 46, 5, -7, -16, -9, 61, 44, -52, -10, 44, -59, 48, 59, -18, 22, -17, 25, 29, -53, -30, -18, 17, 7, -28, 1, 21, -13, -53,
+  -3, 50, -86, -16, 30, -40, 12, 7, 2, 21, -20, -6, 59, -17, -20, 25, -78, -40, 68, 8, -80, 34, 22, 37, 12, -29, -5, 41, 9, 12, 1, -59,
+  -83, 18, 32, 82, 67, -12, -15, 45, 2, -2, 8, 34, 1, -38, 40, 98, -50, -28, -6, 56, -31, -4, -9, -9, 10, 5, -33, -38, 6, 36, -12, -43,
+  -56, -25, -18, 11, -6, -37, -39, -2, 20, 0, -71, 10, 18, -85, 12, 25, -70, 8, 2, -35, 16, 7, -86, -42, 14, 20, -26, -2, -56, -57, 12, 18,
+  11, 4, -26, -14, 42, 11, 31, -46, -23, 8, 12, 17, -78, -47, 6, -77, 48, 1, 16, 70, 47, -49, 51, -27, 16, 48, 2, -15, 67, -40, -16, 78,
+  25, -19, 52, -127, -62, 1, 67, -90, -19, -124, -45, -56, 59, -28, 77, -48, -94, 18, 1, -25, 23, -25, -11, -19, -15, -25, -24, -102, -2, -56, -40, 32,
+  -1, -15, 26, -38, -32, 26, -13, -56, -36, 8, 18, 0, -18, 5, -28, -65, 13, 48, -14, -43, 29, 58, -35, -73, -6, -90, -2, 12, -20, -38, 8, -4,
+  43, -81, 42, -12, -44, -79, -1, -50, -14, 15, -41, -20, -3, -18, 21, 3, 26, -31, 87, 31, -14, 2, -67, 2, 106, -38, -60, 54, -4, -22, 61, -34,
+  -40, -15, -90, 39, 49, -18, 12, 16, -73, 73, -4, -15, 3, 87, -48, 47, -9, 11, 15, 22, -13, 116, 63, -24, 11, 33, -5, 89, -46, -61, -65, -16,
+  32, 56, 52, 7, -29, 37, -34, 32, 19, -4, -44, -24, 57, -5, -2, -11, -51, 33, 49, -35, 41, 48, -93, -22, 49, 43, -41, 25, 0, -29, 48, -40,
+  28, 43, -30, -62, 40, 2, -21, 2, -15, -68, 88, -58, 56, 0, -16, -8, 38, -27, 14, -2, -9, -64, 31, 4, -6, -60, -54, -20, -16, 38, 16, -3,
+  -113, -1, 34, -19, 15, 10, -44, 18, -15, 56, 37, -48, 1, -59, 77, 13, 72, -8, -35, -40, 34, -21, -13, 9, -38, -31, -9, -39, -14, 28, -40, 9,
+  -13, -42, 76, 12, -35, 46, 1, -4, 62, 17, -33, -46, 46, -20, 58, 17, -25, 5, 10, -80, 26, 58, 3, -74, 35, -84, -1, 31, 16, -46, 8, -69,
+  39, 47, 13, -15, -16, -21, 56, 38, 19, -16, -12, -25, 46, 33, -10, -45, 37, -6, 63, 47, 6, -7, 28, 11, 31, 20, -6, 47, -37, -31, 28, 39,
+  51, -12, -6, -25, 9, 13, 72, 62, -26, -18, -8, 67, 57, -2, 17, -38, 8, 32, 10, 37, -38, 31, 25, 36, 10, 41, -90, 1, -5, 4, -5, 3,
+  67, -48, -34, 53, -38, 40, 60, 15, 44, 11, -31, 16, 30, -24, 31, 40, -44, -8, 64, -18, 15, 47, 26, -4, 59, -41, 47, 9, 15, -6, -9, -52,
+  -5, 63, -6, 56, -25, -32, -62, -13, -12, 43, 42, -65, -43, -2, 17, 51, -30, 8, -15, 9, 45, 61, -32, -33, 11, 18, 54, 23, -37, 2, 0, 47,
+  -21, 104, 24, -40, -44, 59, 23, 47, 23, 25, -56, 110, -13, 127, -29, 28, -43, 62, -48, 92, -8, 31, 24, 84, 21, 54, -26, -59, -49, 58, 35, 99,
+  -13, 1, 40, 102, -7, 35, -49, -47, 17, 107, 37, 68, -40, -5, -29, 28, 71, 59, 4, 4, -28, 34, 52, 35, -20, 17, -60, 11, 13, 44, -13, -38,
+  -6, 48, 24, 86, 28, 24, -13, 39, 42, 35, 8, -24, 1, 59, 69, 70, -8, 11, -18, 9, 14, 8, 55, -17, -15, -6, -18, 35, 2, 48, 37, 39,
+  3, 22, -16, 21, 22, -23, 23, 97, -42, 18, 7, 30, 37, 90, -110, 50, 3, 25, 64, 16, -42, 52, -31, -9, 47, 37, -62, 21, -24, -15, 62, -1,
+  -55, -13, -31, -3, 7, 46, -45, 27, -22, 5, 40, 39, -50, 59, -12, 63, -6, 60, -40, 32, 0, 34, 27, 39, -68, 37, -4, 84, -44, 92, -12, 32,
+  -42, 33, -4, 79, -39, -30, -7, 72, 30, -10, 9, -23, -15, 71, -44, 77, -33, 6, -9, 46, -43, -2, -35, 101, -29, 11, 14, 0, -5, 110, -47, 32,
+  -46, 59, -31, 97, -44, 69, -33, 62, -22, 59, 2, 6, -3, 80, -68, 14, -1, 37, 2, 26, 11, 45, 23, 81, -9, 17, -77, 35, 33, 6, -47, -7,
+  -11, 3, 9, 20, -32, 30, -23, 6, -21, -14, -12, 21, -30, 54, 0, 41, 39, 55, 5, 84, -61, -12, -63, 9, -10, 2, 7, 20, -60, 8, -2, 10,
+  14, 19, 12, 46, 33, 51, -14, 10, -46, 55, 13, 46, 2, 58, -47, -12, 39, 31, -50, 72, -66, -8, 41, 37, -2, 27, -29, -6, -3, 35, -29, 38,
+  -6, -6, -15, 3, -63, 36, -8, -22, 9, 43, -49, 6, -105, -6, 15, -18, 45, -5, -100, 37, -9, 84, 65, 3, -14, -37, 15, 32, 30, 38, -9, 37,
+  25, 20, 50, -55, -40, -24, 22, -4, 3, -18, -55, 22, 74, 18, 15, -70, 16, -8, 61, 9, -35, -40, 26, 5, 92, 17, -31, -9, 81, -26, 81, -9,
+  23, 27, -8, 22, 32, -5, 21, -9, 47, -26, 61, 6, 38, -2, -63, -5, 34, -18, 47, -48, -23, 0, 32, 44, -16, -63, -26, -11, 52, -19, -14, 1,
+  -2, -50, 54, -52, 84, -54, -55, -11, 93, -46, 80, -24, -7, -11, 66, -13, 73, -21, 15, 29, 31, -28, 25, -46, 50, 15, 61, -37, -3, -74, -11, -18,
+  32, 15, 51, -18, -39, -29, 30, 12, -28, -2, 10, 22, 45, -80, -9, -40, -48, 37, 50, 8, 21, 23, -32, 48, -33, -71, 0, -10, 9, 70, 16, -69,
+  -9, -44, 11, 45, 9, -2, -51, 26, -38, 57, -23, 12, 9, -29, 9, 19, -22, 22, 30, -11, 77, 13, -83, -18, 27, -5, 80, 34, 114, -5, -37, -55,
+  48, -35, 61, -87, -35, -13, 88, -2, 1, -25, -46, -11, 87, 4, 47, -19, -40, 23, 1, 10, -20, -23, 35, 21, -15, 43, -16, 5, 48, 17, -1, -2,
+  -40, -5, 21, 36, 15, 31, -34, 17, -5, -10, 58, 37, 45, 62, 29, -9, 67, 11, 66, 5, -27, 29, 74, -7, -7, 17, 14, 68, 8, -17, 29, 24,
+  4, -2, 31, 36, -5, 47, 20, 36, -18, -11, -55, -16, -4, 27, 3, 82, -42, -14, 53, -7, 77, 15, -57, 28, 1, 54, 77, -11, -38, -3, 13, 17,
+  67, 66, 1, -14, -18, -38, 13, 48, 7, 5, 23, -59, 44, 52, -59, 44, 9, -41, 33, 53, -20, 1, 14, -75, 20, 56, -12, 7, 34, -61, -53, -11,
+  -31, 9, 46, -20, -45, 39, -72, 14, 48, -44, 18, -29, 7, 10, 2, 15, -7, -6, -45, 64, 6, 4, -66, 9, -71, 57, 8, 39, 21, 23, -108, 4,
+  -2, 43, -2, -41, -55, 51, -32, 9, -4, 14, -116, 48, -4, -29, 22, 6, 22, 40, -34, 67, -76, 82, -19, 60, -61, -2, -8, 48, -25, 46, -7, 40,
+  32, -25, -53, -27, 4, 0, 33, 1, -46, -32, -21, -16, 0, 17, -20, -23, -34, 29, 12, 33, -54, 9, 9, -19, 18, 38, -45, -6, 23, -12, 26, -15,
+  -10, -11, 3, -7, 32, 48, -18, -25, -44, -33, -21, 31, -79, 35, 5, -41, -26, 20, -40, 20, 16, -36, 20, -16, -14, 25, 3, -45, -17, 7, -58, -45,
+  39, 6, -24, 30, -38, 17, 40, -5, -13, -33, 17, -17, 63, 2, 2, -1, 49, -13, 63, 1, 27, -45, 52, -29, 3, 39, 0, -37, 39, 8, 29, 16,
+  25, 13, 38, 16, -20, 90, 14, 14, 25, 24, 16, 81, -26, -27, 34, -44, -26, 41, 19, -84, 65, -67, 40, 2, 13, -30, 55, -36, 2, -8, 6, -12,
+  19, -31, 45, 22, -27, -14, 17, -6, 1, 1, -8, -14, 31, 36, 25, 60, -35, 6, 9, 24, -19, 1, -8, 34, 37, -1, -19, 8, -14, 44, -18, 51,
+  20, -26, -14, 41, 127, 3, -5, 19, -25, -16, 110, -26, 53, -22, -20, 31, 53, 5, -22, -36, 31, -20, 55, -27, -20, -45, -15, -35, 42, 30, 29, 9,
+  11, -18, 56, -6, -41, -32, -41, 20, 47, 22, 15, -33, -20, 36, 40, 15, 6, -23, 12, 7, 39, 3, -6, -26, -6, -28, 9, 18, -29, -68, -32, 25,
+  20, 32, 43, 10, 1, 56, 10, 23, 15, -17, -19, -2, -30, -28, 28, 11, -17, 39, 6, -17, 36, -6, -50, 22, -16, 8, 24, 7, -1, 14, 13, -8,
+  27, -21, 14, 18, -12, -32, 21, 48, 11, 74, -39, 48, 77, 33, -19, 28, 17, 21, 27, -15, -17, 42, -19, -22, 9, 6, 43, 31, -19, -22, 47, 71,
+  9, 8, 36, 0, 53, 32, 27, 47, -8, -63, 30, 61, -5, 5, 31, -29, 29, 49, 17, -9, -2, -60, 35, 34, -17, 61, -23, 16, 37, 12, 34, 20,
+  14, -5, 5, 16, 33, 44, 40, 11, -23, -4, -1, 2, 24, -47, -14, 15, -17, 13, 0, -49, 30, 23, -21, 32, 3, -32, 33, 15, 43, 32, 10, 20,
+  -28, 2, 18, 21, -10, 25, 18, 2, 26, 25, 20, 51, 3, -14, 43, -10, -40, 52, -24, -2, -43, 13, -9, 45, -13, 11, -37, -33, 12, 81, -2, -26,
+  -52, 21, -5, 82, 31, -29, -33, -5, -7, 36, 24, 22, -28, 32, 26, 10, 31, -17, 22, -11, 10, 67, -33, -1, -12, -12, -21, 25, 8, 38, -7, 9,
+  -10, 41, -38, 39, -24, 0, -24, 27, -13, 32, -28, 18, -23, 39, 13, -8, -37, 27, 20, 0, 13, 64, -28, 29, 22, 9, -11, 46, 38, -1, 65, 8,
+  16, 24, 3, 10, -5, 9, 6, -18, -28, -29, -8, -11, 26, -62, 26, 7, 11, 24, 11, -44, 11, -16, 4, 30, -41, -48, -24, -30, 14, 33, 11, 10,
+  11, -10, 46, 22, -14, 6, -4, 15, 28, -1, 29, 21, -35, 43, -38, 10, 42, 56, -29, 17, 16, 58, 25, 43, -1, 56, 25, 25, -21, 26, -16, 14,
+  -42, 28, 29, 11, -27, -17, -1, 26, -1, -30, -54, 17, 37, 54, 17, 37, -50, 16, 37, 21, 60, -1, 4, 37, 10, 58, -14, -10, -28, 12, 0, 30,
+  -25, -10, 12, 0, -8, -5, 23, 4, 17, 8, -10, 42, 49, -6, -17, 18, -2, -26, 47, 18, 14, 27, -14, 48, 53, -9, 29, -17, 20, 16, 3, -1,
+  10, -22, 25, 9, 18, 27, 29, 35, 9, 9, 11, 38, 0, 36, -34, -6, 0, 14, 17, -6, -15, 2, -5, 45, -7, -47, -10, -11, 23, 73, -13, -25,
+  -25, 17, 28, 100, -18, -28, -40, -3, 49, 78, 10, -41, -56, 5, 42, 50, 28, -18, -11, 25, 16, 20, 11, 24, 15, 10, -21, 29, 49, -26, 0, -13,
+  -28, 34, 1, -10, -5, 12, 1, 21, -25, 13, 32, 38, 41, 23, -20, 26, 5, -6, -13, 20, 17, 14, 20, 12, -1, -10, 4, 1, -14, -23, 13, -21,
+  1, 7, -48, 15, 66, -14, -8, -8, 17, 42, 21, 18, 11, 49, -62, -2, 66, 7, 18, -18, -40, 20, 56, -41, 7, -49, -74, -42, 57, -14, 80, -25,
+  55, 25, 11, -20, 13, -45, 76, -9, 6, -59, 42, -24, 30, -17, 26, -35, -8, -24, 4, -8, -10, 23, 16, -62, 0, 25, -11, 29, -33, -39, -35, -25,
+  -19, 26, -26, -29, -17, -15, 30, 43, 26, 8, -15, 59, -19, 33, 7, -12, 15, 13, 2, -16, 61, 4, 17, 1, -40, 17, 13, 24, -41, 21, -1, 15,
+  28, -2, 0, 13, 44, 26, 33, 15, -26, -49, 29, 36, 26, 55, -33, 8, 44, 26, -5, -2, -13, -3, 53, 58, 35, 14, -32, 16, 61, 44, -11, -2,
+  -3, -38, 64, 91, 64, 15, 19, -16, -14, 16, -9, 2, 1, 25, 1, 24, -16, 45, 16, 16, -5, -19, -16, -40, -3, 34, 33, 0, 47, -43, -14, 2,
+  -17, -57, 39, 15, -30, -38, 32, -67, -16, -63, 10, -2, 9, -12, -43, -33, 2, -25, 29, -25, -33, -4, 15, 13, 50, -15, 16, -29, -8, 36, 37, 35,
+  -4, 35, 13, -12, 32, 15, 5, 35, -29, -26, -64, 13, 62, -36, -47, 38, -53, 20, 79, 19, 45, 28, 73, -18, -45, 38, 75, -35, 57, 18, -18, -15,
+  0, 41, -27, 38, -24, 42, 65, -14, 57, 7, -59, 27, 36, -22, 64, 32, -29, -36, -5, -50, 5, 0, -37, -26, -17, -16, 25, 29, -58, -40, 45, 42,
+  47, 28, 58, -44, 11, 34, 45, -62, 51, -18, -30, 12, 29, -92, 58, -7, 78, -16, 13, -62, 22, -4, -15, -80, 43, -40, -37, -95, 17, -5, 58, -43,
+  -72, -49, 29, -74, 63, -43, -85, -27, 48, -3, -26, -20, -11, -74, -24, 1, -4, 20, -23, -50, 44, 28, -62, 9, 35, 25, 48, 45, -40, 42, -13, 24,
+  42, 80, -77, 59, 23, -19, 67, 57, -15, -5, -57, -14, 6, 50, -30, -26, -25, 4, 13, 70, -2, 11, -43, -41, -35, -32, -15, 20, -13, -55, -7, 53,
+  -25, 9, -12, 31, -9, -6, 20, -73, 8, -26, 65, 37, -25, 5, -10, -34, -1, 54, 16, -3, 34, 22, 4, 8, -40, 35, -41, 10, 27, 49, 18, 27,
+  -25, 1, -27, 51, 14, 2, -10, 18, -26, 87, -85, -53, -22, 6, 9, -5, -54, -32, -17, -9, -18, 30, -35, -90, -40, -45, 12, 41, -56, -27, -64, 5,
+  -36, 6, -90, 29, -53, 23, 11, 36, -64, -5, -30, 64, 46, 91, -50, 28, -41, 33, 30, 87, -31, -46, -52, 40, 44, 37, 0, -5, -37, 17, 1, 7,
+  -18, -80, 34, 7, -31, 32, -49, -3, -42, -36, 4, 61, -28, -40, 20, -14, -73, 56, -29, -38, 16, -3, 9, 28, 59, -30, -14, -1, -28, -9, 40, 28,
+  3, 4, 5, 24, -42, 52, 52, -25, 58, -12, -59, -21, -18, -13, -33, 18, -6, 13, 67, -44, 36, 19, -15, 52, 29, -12, -28, 57, -36, -15, 6, -44,
+  24, 26, -69, -34, -21, 30, -19, 42, -19, 57, 4, -58, 3, 41, 17, -14, 6, 36, -36, 71, 17, 63, 13, -39, -62, 56, 17, 91, -27, 7, -56, -33,
+  -7, 55, 10, -2, -27, 41, -33, 4, 49, -24, -90, 27, -4, 21, -16, -15, -75, 15, 56, 65, 45, -21, -75, 15, -41, 17, 40, -18, -59, 43, -4, 12,
+  9, -46, 7, 4, -13, -31, -3, 61, 2, 21, -56, -36, 43, -10, -33, 90, -58, -46, -11, 64, -90, 94, 16, 18, -47, -10, -30, 76, -22, 0, -67, 3,
+  -46, 65, -40, 12, -41, 2, -23, 127, 14, 28, -109, -50, -74, 23, 68, -48, -88, -51, -61, 35, 30, -27, -65, -21, -57, -1, -28, 40, 14, -6, -49, 2,
+  -31, -5, -22, -32, 18, 44, -37, 41, -4, -98, -41, 75, -22, 36, -65, -63, -29, 70, 15, 25, -66, -47, -29, -6, -74, -34, -3, -9, -17, 71, -26, 15,
+  18, -48, 17, 13, -34, 25, -41, -8, -4, 57, 4, 25, -64, -22, -44, 39, 65, 19, -5, -74, 5, 58, 42, -65, -56, -43, 20, -21, -8, 15, 23, -98,
+  -56, 27, 32, -18, 1, 0, -47, 20, 21, 43, 12, -29, 1, 26, -7, 15, -55, -4, 0, -25, 13, -54, -56, -34, -77, 11, 36, 12, 36, 1, -2, 29,
+  -5, -10, 24, 21, -12, 73, -14, 50, -34, -27, -38, 44, -81, 38, -2, 26, -12, 12, -83, 4, -39, 13, -48, 47, -27, -19, -45, 16, -56, 34, -61, 50,
+  -9, -29, -21, -39, -23, 1, -1, 6, -52, -23, -11, -23, -12, 38, -17, -29, -34, 11, -15, 4, -90, 48, -70, -24, 6, 23, -32, -33, -9, -90, 38, 12,
+  -106, -8, 24, -54, 29, 29, -62, 2, -57, -32, 68, 13, -19, 30, -12, -5, 33, 21, -110, -22, -7, -35, 12, 7, -45, 9, 12, 67, 0, 44, -106, 71,
+  -31, 51, 0, 12, -39, 86, -27, 81, 61, -60, -52, 80, 12, -14, 55, -13, -80, 1, -67, 3, 61, 3, -88, 39, -3, 3, -12, -47, -87, 30, 7, -12,
+  -35, -50, -6, 31, 36, 10, -32, -31, -17, 12, 63, -18, -19, -35, -68, 66, 8, 16, -27, -4, -51, 49, 59, 31, -28, -2, -67, 69, -9, 34, 21, 9,
+  -55, 15, 24, -27, -10, -7, -47, 63, 7, -44, -3, -7, -25, 55, 60, -31, 37, 15, -76, 25, 14, 12, -20, 18, -39, 28, 93, -22, 18, -45, -69, 84,
+  37, -8, 27, 21, 32, -38, -43, -21, -43, -77, -18, 3, 35, -4, -35, -75, -4, -60, 8, 33, 47, 2, -48, -11, 15, -11, 17, -41, 43, -3, -56, -6,
+  -10, -34, -10, -34, -21, -22, 8, 35, -11, -26, -13, 28, -22, 10, -1, 24, 7, -20, -43, 27, -10, -20, -42, -23, 26, 16, 41, 13, 5, -24, 2, 6,
+  10, -29, 2, 12, 2, 15, -32, -17, -32, 99, -12, -53, 34, -68, 34, 108, 7, 18, 16, -51, 49, -19, -2, -36, 70, 10, 31, -57, -50, 15, 68, 32,
+  15, 18, -7, 46, 29, -15, 52, -36, 75, -13, 64, 32, 9, -37, 1, -58, 94, 5, -17, 1, 2, 8, 99, -34, -22, 54, -9, -61, 42, 6, 62, -7,
+  48, -9, 105, 15, 51, 15, 14, -60, 85, 5, -16, -5, 7, 22, 54, -28, 39, -23, -7, 6, 101, 22, -31, -44, 41, -14, 58, -24, 25, -9, 33, -6,
+  92, -53, 16, 3, 49, 12, 106, -5, 0, -31, 53, -3, 105, -41, 3, -13, -44, -1, 120, -13, 57, -1, 43, -12, 42, 14, -51, -3, -34, -29, -29, 0,
+  8, -34, 12, 10, -32, -16, 10, -18, 8, 8, -18, -16, -30, -23, -6, 7, -19, -79, -23, -46, -35, -33, -14, -58, -32, -3, 9, 22, -15, 26, 5, -68,
+  -20, -4, -38, -6, -2, -29, 20, -4, 9, 13, 16, -61, 43, 20, -8, 14, 21, -47, 48, -18, -27, -33, -14, 3, 39, 31, -50, 16, 0, 6, 23, 30,
+  -38, -23, -25, -47, 36, -29, 15, 8, -32, -30, 8, -6, 18, -24, -5, 10, -28, -62, 22, -1, -22, -20, -1, -54, 10, -43, 19, -44, -12, 6, 22, -32,
+  -6, -22, -12, 7, 4, 11, -11, 4, 8, 4, 9, 2, 20, 2, -22, -9, 7, 6, 8, 16, 1, 16, 9, -29, -16, -30, 14, -20, -10, -25, 18, -12,
+  -35, 33, -7, -26, 32, -12, 9, 46, -23, -13, 21, 18, -20, 54, 8, -5, -27, -11, -11, 63, 1, 27, 37, 59, 10, 40, 13, 2, -20, 42, 18, 53,
+  -22, 51, -37, 51, 2, 30, 30, 58, -42, 62, 53, 8, 21, -28, 56, -43, -27, 16, 16, -43, 51, -40, -23, -28, 16, -12, -7, -47, 28, -15, 39, -25,
+  30, 10, 8, -6, 34, 1, 0, 16, 11, 40, 61, -10, -40, 4, -44, 8, 7, 12, -16, -48, -3, -14, 43, 16, -44, -1, -19, 49, 39, -18, -51, -12,
+  -9, 24, 26, -30, -18, -66, -20, 36, -6, -46, -21, -52, -21, 27, -3, -70, 3, -28, 3, 22, 5, -74, 7, -47, -26, -29, 36, -77, -8, -34, -1, -27,
+  7, -16, -48, -44, 35, 0, 33, -10, -71, 5, 31, 49, -2, -61, -67, 26, 25, 49, 26, -4, -1, 28, -19, -5, 42, -36, -20, -21, -19, -17, -17, -4,
+  -26, 9, -36, 22, -8, -55, 0, 37, 14, 41, 36, -1, 32, 54, 2, 16, 46, -4, 47, 47, 2, 1, 23, -11, -13, 22, -2, 20, 55, 2, 9, 92,
+  -32, 67, 24, 14, -16, 37, -15, 3, 71, 15, 3, 63, 30, 47, 66, 36, -40, 28, 13, -1, 70, 10, -32, 23, 24, -16, 92, -25, -24, -31, 41, -54,
+  24, 24, -54, -16, -17, 16, -2, 20, -49, -15, 37, -8, 27, 45, -88, 49, -12, 34, 0, 36, -28, 7, -62, 21, -24, 27, -12, 36, -11, -23, 17, 40,
+  -42, 41, -57, -13, 13, 92, -15, -18, -84, 4, 23, 42, -37, -4, -21, 44, 12, 62, -9, -31, -5, 40, 20, 45, -60, 15, -42, -19, -18, 20, -23, -18,
+  -16, 14, 7, 60, 2, 29, -6, -12, -62, 31, -32, 28, -34, -27, -17, 30, -58, -18, -37, 18, -8, 48, -35, 30, -68, -1, -17, 41, 15, 11, -16, 21,
+  30, 30, -40, 58, -27, 39, 13, 33, 5, 4, -27, 17, 26, 37, 24, 15, -28, -16, 16, 18, -44, 17, -63, -4, -4, 30, -1, 9, -44, -52, -20, 11,
+  30, 18, -6, -34, -10, -36, -6, 28, -22, -22, -34, -9, -52, 50, -78, 9, -44, 12, -39, 50, -14, -15, -57, -24, -12, 61, -76, 4, -52, 1, -10, -1,
+  -36, -11, 4, 44, -1, 27, -27, -28, -62, 58, 14, 39, -40, -49, -52, -3, 14, -16, -32, -13, -5, -21, 58, -3, 10, -30, -43, -27, 35, 0, 38, -21,
+  -15, -25, -37, 4, -12, -15, -45, -20, -11, 17, 43, 30, -29, -5, -7, 54, -10, -21, -18, -6, -14, 13, -24, 27, -81, 28, -17, -11, -26, -7, -80, 42,
+  -26, 18, -20, -16, -48, 16, -17, -17, 9, -14, -79, 33, -30, -9, 1, -19, -61, 13, -49, -3, 3, -29, -36, 28, -49, 25, -22, -13, -38, -12, -32, -8,
+  16, 11, -47, 1, -15, 23, 27, 13, -55, 9, -5, -49, 29, -1, -49, 13, -39, -2, 42, 13, -35, 47, -45, -13, 26, -10, -65, 35, -20, 1, -8, -9,
+  -74, 47, -55, -39, 30, 12, -78, -6, -16, 30, -23, -22, -65, 9, -27, 32, 26, -25, -62, 50, -10, 16, -27, -20, -27, 28, -39, -16, 2, -24, -49, 11,
+  -23, 48, 30, -31, -45, 40, 18, 40, 15, -54, -9, 38, -8, 7, 12, -3, -49, -7, 25, 63, 19, -65, -7, 40, -15, -4, 21, -18, 3, 32, -4, 27,
+  58, 1, 12, 28, -3, 14, 88, -6, 29, 16, 39, 4, 1, -31, 25, -1, -11, -3, 12, 3, -14, -45, 44, -33, -19, 3, -24, -29, 19, -17, -12, -57,
+  -46, 13, 8, -4, -25, 9, -60, 23, 30, 58, 13, -10, -51, -1, -18, 38, 10, -19, -2, 24, -35, 16, 20, 24, -77, 32, 23, 39, 23, 3, -36, 2,
+  10, 5, 9, 17, -28, -14, -17, 9, 11, 2, -10, -52, -14, -4, 33, 4, -24, -1, 18, 21, 24, -20, -17, -12, 32, 49, -20, -44, 25, -24, 74, 56,
+  9, -54, 0, -32, 26, -2, 41, -38, -25, -9, -2, 11, 17, -43, 21, -14, 9, 53, 55, -72, 30, 12, 10, 10, 36, -78, 24, -20, 15, 7, 24, -4,
+  15, -17, 2, 38, 78, 2, 10, -26, 54, -20, 43, 7, -31, 28, 16, -31, 79, 21, -10, 8, -6, -19, 63, -27, 24, 7, 22, -34, 36, -30, -3, -9,
+  -25, -30, 61, -47, 15, -43, 7, -46, 79, -11, 55, 7, 7, -88, 42, -41, 40, -36, 13, -76, 65, -34, 82, -54, 36, -50, 127, 2, 14, -10, -3, 29,
+  36, -1, 39, -32, 22, 0, 50, -41, 9, -7, -11, -19, -1, 5, -8, -49, 11, -11, -23, -6, 6, -23, -15, 37, 14, 4, 36, -25, -3, 5, -9, -46,
+  2, -45, 24, 22, -70, 5, 29, -20, 61, 3, -16, -13, 25, -8, 60, -42, -12, -13, -1, -47, 43, -38, 17, 1, 0, -45, 8, -33, -9, -12, -16, -34,
+  50, -13, 27, -40, -10, -44, 42, -19, -13, -3, 38, 4, 12, -54, -18, -42, -2, -37, 15, -35, -31, 8, 12, -40, 19, -26, 10, -29, 47, -5, -5, 15,
+  -23, 38, 7, -23, 4, 33, -39, -9, -2, 18, 24, 50, -22, -5, 35, 20, 0, 46, -38, 2, 31, 8, 30, -7, -12, -30, 17, 9, 8, 46, -5, -5,
+  21, 2, 59, -2, 15, -29, -2, 22, 12, 6, 4, 0, -8, -3, 16, 5, 10, -26, 0, 7, -5, -5, 36, 9, 2, 20, -16, -3, -12, 19, 9, 49,
+  -1, -26, 4, 46, -20, 60, 22, 8, -16, -17, 29, 19, -38, -6, -3, -21, 127, -12, -25, -45, -57, -25, 122, 2, 5, -16, -28, 21, 100, -16, -56, -36,
+  -10, 21, 41, 2, -22, -27, -27, 6, 41, -10, -32, -30, -47, -1, 40, -2, -25, -14, -42, 23, 62, -6, -31, -1, 4, 12, 27, 11, -82, 5, -46, 45,
+  52, 49, -49, -25, -21, 48, 47, -2, -71, -36, -24, 46, 4, 34, -60, -19, 18, 33, 16, 31, -90, -10, 19, 39, -12, 6, -35, 5, -40, 6, 36, -6,
+  -33, 13, 1, 41, -28, 26, -45, -15, 28, 53, -31, 16, -40, 21, -5, 30, -9, 2, -45, 36, -10, 42, 18, -1, -34, 33, -8, 60, -41, 15, -33, -1,
+  -1, 8, 9, 1, -62, 23, 19, 29, -19, 17, -52, -14, -3, 13, 17, 11, -2, 9, 2, 29, 1, 22, 7, 7, -22, 40, -24, -10, -10, -14, 30, 67,
+  -29, 39, 19, 43, -33, 53, -2, 10, -6, 33, 6, 3, -30, -16, 3, 16, -24, 37, 10, 17, -13, -12, 13, 20, -39, -40, 6, 3, -2, -16, -8, 5,
+  -9, -2, 44, 5, -57, -29, -30, -13, 39, 11, -49, -3, -35, 1, 14, 24, -27, 4, 3, -18, 15, -19, -22, 18, -10, -21, 17, -1, -22, -20, -28, -18,
+  38, -8, -55, 34, 12, -11, -17, -32, -55, 35, 17, -7, -25, -28, -54, -13, -17, -7, 21, -6, -78, -33, 20, -1, -2, 2, -45, 6, -24, 19, 27, 27,
+  -75, 12, -46, -15, -7, -12, -85, 20, -48, 20, 19, 0, -28, 14, -25, -3, -20, 8, -31, 7, 13, 17, -72, 30, -64, 46, 13, -5, -44, 41, -21, 53,
+  18, -3, 25, 6, -62, 24, 7, -11, 31, -21, -16, 25, 25, -6, -4, -44, -60, -12, -19, -34, 13, -13, -33, 38, -19, -24, -6, -27, -36, 27, -33, -2,
+  34, 18, -36, 16, -15, -31, -4, -16, -10, 15, -28, 35, -31, -4, -14, 16, -12, 31, -1, 12, -29, -1, 5, 22, -28, -4, -6, 31, -47, -39, 9, -4,
+  18, 27, -37, -47, -24, -4, -26, 35, -5, 16, 19, 32, -17, 1, -36, 1, -30, 17, -23, 44, -2, 3, -46, 42, -13, 54, -38, -15, -36, 29, -41, 44,
+  21, -23, -8, -8, -16, 74, -47, 21, -6, -29, -38, 15, -52, -27, -10, 14, -48, 19, -35, 22, 38, -40, -33, 15, -48, -20, -12, -46, 11, 30, 7, -16,
+  37, -9, 12, -26, -17, 31, -5, 5, -17, -14, -15, 0, 19, -25, 6, 9, -11, 51, 8, -5, -15, 12, -49, 32, 37, -23, -53, 14, -31, 51, 40, 18,
+  -26, 28, -13, 31, -5, -20, -22, 7, -9, 38, 38, 32, -44, 14, 18, 20, 19, -29, -45, 26, -10, 13, 8, -30, -43, 18, 0, 0, 51, 9, -14, 23,
+  -7, 35, 22, 20, -65, 26, -16, 0, 33, 24, -7, -1, -8, 74, 24, -33, -2, 11, -52, 86, 20, -31, -22, -38, -4, 14, 15, -19, 17, 8, -36, 12,
+  -15, -11, 5, -19, -16, 40, -2, -37, -2, -20, -28, 23, 16, -40, -24, 11, -19, 24, -13, -12, -2, -34, -30, 15, 0, -4, 29, -26, -37, 15, -27, -27,
+  16, -16, -21, 1, 7, -41, 63, -19, 19, 18, -20, 1, -11, 29, -6, 3, 18, 1, -33, 50, 35, -26, -13, -58, -17, 31, -1, -18, -3, -37, -17, -26,
+  -6, 2, 61, -31, -11, 3, -43, -22, 37, -71, 33, -21, -37, 49, 15, -64, -2, -12, -5, 3, -4, -23, 23, -31, 8, 30, -6, -34, 0, 13, -16, 7,
+  -6, -11, 21, 31, -9, 18, -6, -63, 16, 12, -4, 18, 13, -29, 20, -24, 3, 3, 15, -31, 30, -5, 14, 12, 17, -46, 38, -26, -5, -19, -37, -45,
+  10, -37, 26, -20, -23, -49, 5, -53, -9, 0, -8, -39, 6, -30, 23, -4, 8, -48, 1, -24, 4, -2, -17, -8, 7, 10, 33, 24, 19, -27, 3, -18,
+  -22, 1, -36, -13, 18, 7, -6, 51, 16, -3, 31, 33, 2, -4, 7, -4, 69, 3, 2, -22, 7, -17, 51, 10, -13, -4, 14, -44, 55, -8, 9, -22,
+  10, -14, 62, -4, 27, -13, -5, -41, 75, -29, 49, 12, -2, -57, 53, -13, 22, 29, 7, -17, 91, 14, 19, 44, -46, -50, 85, 32, 20, 40, 15, -28,
+  74, 10, 15, 0, -57, 40, 28, 28, 14, -9, -20, 58, 50, -10, -5, 23, 8, -4, 10, 13, 11, 16, -22, -16, 25, -67, -53, 40, 37, 8, 15, -82,
+  29, 50, -5, -26, 4, -2, -21, -17, 46, 13, 21, 29, 7, -1, 10, -3, 29, -4, -3, -25, 37, -10, -32, 30, -37, -48, 37, 30, 34, -17, -61, -37,
+  14, -41, 14, -41, -10, -29, -25, -56, -29, -70, 44, 12, -9, -89, -22, -70, 40, -18, -26, -2, 41, -6, 49, -33, 0, -48, 51, -30, -7, -26, -51, 25,
+  46, -19, 26, 60, -7, 26, 31, 3, 12, 15, -20, -19, 35, -26, -25, -6, -17, -24, 30, 26, 8, 39, -18, -44, 24, -5, -29, 19, 8, -50, 9, -17,
+  59, -53, -18, -45, 11, -66, -15, -17, -6, 4, 25, 11, 35, -43, -22, -40, 18, 32, -41, 14, 35, -26, 26, 52, -13, 18, 27, 18, -35, 50, -21, -17,
+  23, 29, -43, 2, -4, 14, 6, 25, -53, 17, 10, -73, 10, 57, -40, 57, -76, -33, -38, -37, 127, 29, -10, -20, 10, -45, 121, 29, 3, 29, 9, -57,
+  71, 19, 8, 21, 25, -23, 50, 32, 17, -1, 3, 9, 102, 16, -9, -7, -23, -38, 84, 78, 42, 57, 13, -23, 5, 65, -3, 12, -22, 44, 91, 36,
+  36, -24, 33, 44, 16, 76, -8, -21, -14, -26, 40, 53, -53, 30, 37, 44, -18, 83, 10, 2, -22, 63, -40, 69, -24, -12, -32, 10, 17, 30, -5, -6,
+  -41, -3, -6, 31, 10, -30, -31, 25, 26, 8, 41, -10, 21, 51, -11, -20, -12, -53, 2, 41, -6, 16, 25, -2, 34, -11, -31, 46, 49, -32, 9, 60,
+  14, -7, 29, 26, 40, 41, 21, 2, 46, 17, -4, -18, 24, 37, 32, 20, -11, 42, -6, 4, 75, 6, 2, 49, 62, -18, 36, 43, 0, 1, 52, 18,
+  4, -7, 35, 15, 2, -37, 52, 22, 5, -2, 24, -1, 39, 59, -12, -62, 36, -11, 31, 6, -13, -47, -4, 30, 2, 21, -8, -38, 32, 13, -9, 0,
+  -24, -60, -14, -32, 40, 7, 12, 2, -31, 11, 61, -47, 4, -13, 2, -52, 14, -26, 35, 21, 40, -34, -39, 0, -1, 37, -1, 17, 32, -44, -7, -5,
+  -10, 41, 38, -48, 11, -48, -71, 71, 21, -11, -63, 14, -43, 47, 47, -26, -66, 23, -71, 34, -8, -26, -53, -5, -53, 72, 57, 11, -59, -1, -13, 70,
+  3, -31, -50, -24, -14, 18, 56, 17, -54, 46, -30, 36, -25, 4, -76, -9, 10, 66, -9, 14, -7, 9, -53, 44, 2, -14, -79, 11, -17, 38, 71, 4,
+  -99, 10, 50, -29, 21, -15, 55, 25, 12, 48, -18, 28, 52, -26, 4, -2, 57, -6, 17, -37, 36, -58, 55, -13, -6, 1, 8, 12, 45, -8, -42, -34,
+  -16, -20, 83, 20, 3, -13, 12, -30, 24, -50, 30, 21, -14, 28, 63, 37, -16, 0, 47, -12, -12, -6, 6, 22, 19, 4, 69, 11, 32, 20, -41, -31,
+  44, 7, -45, -35, 39, -21, 52, -13, 12, 27, -15, 38, -49, -14, -4, 20, -22, 43, -45, 58, 36, -4, 24, 43, -8, 41, -41, -14, -15, 45, 33, -11,
+  -41, -16, 60, -7, 48, -13, -16, -22, 52, -16, 3, -36, -42, -56, 0, 13, -11, -12, 12, 17, -6, 51, 31, -18, 14, -51, 3, -7, 13, -21, -37, 4,
+  -7, 46, -4, -17, -26, 13, 45, 23, -13, -67, 53, -28, 16, 33, -16, -18, 50, -25, 25, 6, -25, -41, -2, -26, -5, 22, -14, 47, 6, 18, -38, -12,
+  -38, 0, 9, 39, 16, 54, -30, 3, 19, 18, 9, 44, -1, 43, -29, -5, -20, 12, -28, 52, 27, 61, -1, 12, 39, 42, -43, 41, -75, -2, 34, 4,
+  4, -10, 19, 60, 17, 12, -31, 40, -24, 39, 35, -18, -46, 13, -49, 23, 23, -29, -5, -5, -14, 40, -20, 18, -2, -16, 40, 90, 6, 3, -4, -36,
+  13, -4, 5, 28, -34, -8, -11, 6, -26, -20, -37, -1, 1, 50, -32, -35, -28, 44, 15, -15, 19, -11, 7, -26, -14, 6, 54, 18, 54, 41, -34, 70,
+  16, -16, 30, 20, -52, 43, 8, 0, -25, 5, -16, 20, 9, 4, 17, -33, -29, -51, -64, 1, 9, -63, -33, 12, -64, -9, 39, -33, 10, -13, 11, -5,
+  -31, -64, 6, -25, 23, 2, -16, -7, 28, -18, -36, -17, -24, -31, 7, -24, 15, 33, -4, -74, 38, 37, 8, 12, -29, -25, -30, 19, -40, -8, -27, 52,
+  -17, 12, -57, -24, -21, 43, 25, 40, -35, -19, -40, -44, -14, 4, -32, 1, -28, -40, 29, -28, 17, -9, 12, -27, -22, -34, 34, -40, 53, -63, 13, -37,
+  10, -45, 26, -5, 18, 3, 22, 1, -1, 19, 56, -47, 13, 56, 22, 14, 40, -37, 10, 25, 9, 36, 45, -34, 21, 40, 6, 38, 14, 5, -27, 45,
+  -39, 26, 51, -21, -9, 90, 26, -36, -23, 58, 20, 41, 19, -43, 0, 31, 19, 60, 17, -15, 38, -11, 25, -29, 48, -47, 39, 21, 14, -24, 39, 12,
+  -6, -38, 11, -83, 8, -47, 2, -8, -17, -64, 34, -45, -47, -35, 71, -37, -3, -16, 17, 21, 21, -5, 63, 13, 29, -28, 41, -10, 44, -20, -26, 52,
+  49, 44, 26, 24, -38, -6, -19, 1, -40, 12, -33, 23, -76, -20, -47, 14, -22, 28, -6, 39, -40, 9, 13, 6, -48, 40, -20, 11, 13, -10, -32, 35,
+  -6, 13, 15, -74, -38, 38, 22, 38, 16, -28, -36, -34, 3, -34, -11, -5, -54, 15, 3, -27, -34, -66, 22, -9, -5, 26, -77, -28, -51, -45, -26, 55,
+  19, -43, 1, -15, -28, -13, 23, -2, -39, -7, 41, -27, 19, -13, -66, -54, -2, -29, -49, 36, -64, -4, -14, -17, -60, 29, 13, 41, -77, 6, -57, 9,
+  -14, -37, 6, -3, 27, 29, -17, 50, 3, -69, 13, 13, -10, -33, -8, -34, -23, 11, -28, 22, 6, 5, 12, -5, 15, -2, -39, -85, -63, -23, -43, -8,
+  -8, -32, 4, -10, -6, -45, -23, -60, 25, -28, -43, -53, -14, 8, 29, -10, -36, -2, -49, 18, 29, 5, 19, 4, -31, 5, -50, -25, -15, -27, -11, -41,
+  15, -46, 23, 16, 25, -7, -1, 4, 33, 41, -18, 19, -20, 27, 29, -2, 29, 6, -21, 57, -48, -27, -26, 0, -53, -33, -43, -67, -5, -61, -40, -97,
+  -39, -13, -25, -68, -89, -38, 1, -59, -31, 14, -93, -69, -31, 8, -57, -4, -82, -44, 9, -51, -89, 39, -90, -41, -24, -33, -36, -21, -45, -5, 8, -41,
+  -70, 58, -66, -38, -46, -36, 33, 56, -60, -28, 22, -44, -26, -22, 12, -2, 21, -52, -8, -6, -57, 11, 5, -39, 26, -33, -40, -60, 2, 12, -53, -45,
+  -2, -2, 10, -30, -33, -2, 16, -65, 35, -85, -2, 4, -33, -34, -59, 15, -2, -8, -15, -85, -45, 34, 0, -21, 13, -50, -18, -52, -33, -30, 33, -53,
+  -42, -17, 4, -46, -63, -28, -58, -35, -40, -42, 2, -6, -70, 5, -4, -57, 28, 45, 16, 33, -79, -61, -28, 23, -34, 71, -79, -59, 9, -11, -16, 26,
+  -7, -25, -40, 10, 8, 24, -93, -84, -22, 13, 0, 47, -98, -68, -13, 24, 25, 11, -74, -80, -79, 26, 38, 2, -32, -58, -27, 18, -44, 41, -55, -71,
+  40, 26, 32, 41, -13, -119, 30, -30, 11, -1, -78, -78, -35, 55, 26, 25, -56, -109, -10, 6, -5, 8, -28, -93, 25, 3, 16, 82, -56, -44, 44, -2,
+  -50, 26, -10, -23, -15, 42, -47, 23, -34, -32, 46, -17, -52, 41, -70, -44, 26, 67, 0, 26, -62, -5, 29, -1, -75, 76, -28, -85, 83, 30, -72, 25,
+  0, -79, 14, 35, -65, 46, 2, -77, 49, 3, -65, -38, -19, -44, -17, 37, -48, 17, -80, 31, 81, 26, -62, -26, -26, 0, -12, -3, -63, -24, -109, 17,
+  -16, 23, -78, -8, -34, -29, -13, 65, -4, 9, -49, -7, 61, 51, -14, -10, -13, 23, -28, 10, -22, 57, -64, 36, 3, 67, -37, -36, 20, 12, -11, 48,
+  -60, -16, -50, -51, -28, 29, -25, 43, -61, 3, -35, -11, -27, -29, 8, -27, -43, 39, -36, -38, -87, -33, -6, -31, -52, 39, -69, -35, -63, 8, -13, -16,
+  -72, 8, -84, 28, -88, -1, -119, 21, -72, 7, -30, -26, -94, -21, -1, 40, -99, 38, -26, 57, -16, 55, -92, -13, -96, -36, -6, 0, -20, 45, -32, -35,
+  -55, -14, -40, 33, -41, -60, -34, 64, -33, 50, -58, 23, -22, 41, -87, 27, -68, 31, -15, 40, -82, 26, -76, 2, 9, 26, -61, 37, -30, 21, -49, 39,
+  -40, 22, -56, -6, -23, 13, 25, -14, -32, -56, -80, 32, 1, -46, -24, -28, -97, 54, 24, -47, 4, 19, -74, 103, -55, -47, 38, -33, -125, 6, -30, -27,
+  -2, -2, -54, 29, -24, 10, -10, -11, -33, 52, -62, 48, 3, -27, -31, 16, -12, 34, 3, 17, -63, 15, -54, 52, -36, -40, -62, 19, -25, 51, -29, 7,
+  -119, 16, -19, -32, 35, -50, -84, 73, 34, -29, -45, -11, -73, 2, -58, -32, -33, -71, -101, 38, -14, -1, 32, -17, -82, -26, 18, -19, 56, 37, -14, 30,
+  -42, -44, 67, 38, 5, -18, 45, 9, 21, 35, 11, 12, 68, -10, 70, -29, 17, -39, 0, 4, 28, 18, -46, 45, 59, 57, 24, 22, -39, 21, 61, 33,
+  109, -28, -61, 24, 29, 54, 69, 10, 4, 20, 68, 46, 81, -43, -19, -61, 46, 1, 119, -70, 33, -3, 56, 11, 13, -13, 56, -43, 86, 5, 4, -36,
+  -25, -47, 78, -33, -6, -40, -27, -16, 13, 63, 68, 17, 12, 6, 76, 3, 50, -16, 36, -7, 53, 65, 47, -7, -22, 43, 69, 69, 12, -35, 3, -17,
+  15, 93, 25, -33, -5, -2, 86, 33, 82, -44, -14, -22, 51, 14, 93, -16, -28, 17, 11, -9, 95, 24, -28, -52, 20, 56, 13, -21, 61, 9, 7, -8,
+  3, -7, 21, -28, 56, -8, -5, -5, 5, 59, 32, 23, 8, -59, 50, -11, 28, -62, 28, -66, 3, -6, 51, 8, 24, -11, 40, -11, 18, 18, 17, -11,
+  72, 9, -26, 16, 42, -58, 43, -7, 12, -3, 24, 30, 46, -44, -28, -43, 32, 3, 85, -23, 33, -70, 56, -24, 21, 34, 46, -80, 12, -13, 73, -36,
+  63, -127, 67, 27, 57, 12, -23, -50, 28, 5, 55, 28, 53, -89, 80, 42, 64, -1, 20, -102, 9, 5, 85, 19, -34, -16, -7, 17, 56, -6, -24, -27,
+  -1, 90, 107, 54, 25, 19, 106, 68, 27, 54, 4, 41, -26, -59, 41, 77, 50, 47, 27, -72, -2, 74, -17, 89, -39, -26, 23, 64, 3, 29, -35, -41,
+  -5, 25, -2, 15, -8, -31, -14, -5, 84, -22, -64, -14, 28, 69, 32, -47, -56, -39, 43, -2, 80, -17, 61, -62, 33, 43, -9, -63, 36, -36, -20, 15,
+  6, -68, 100, -6, 48, 22, -7, -97, -28, -12, -1, 22, 6, -15, 0, -4, 33, -7, 82, -69, -65, -50, -5, -20, 96, -70, 8, 3, 14, 36, 56, -10,
+  44, 19, 10, 3, 12, -5, 42, -31, -26, 49, -47, 2, 25, -28, 41, 57, 6, 1, 9, 6, -10, 76, -20, -42, -21, 36, -1, 76, 41, 45, -35, -48,
+  -66, 56, 11, 30, 11, 10, -39, 33, 2, 48, 32, -34, -67, -4, 39, -15, 59, 14, 35, -41, 40, 28, -6, 11, 22, -32, -16, -39, 52, -23, 10, -20,
+  30, 46, -33, 20, -13, 31, 2, 25, 15, 88, 27, 67, 14, -47, -28, 63, 12, 44, 7, 9, 3, 41, 36, 70, 12, 38, 22, 39, -58, -2, -9, 19,
+  -38, -7, -95, 33, -79, 46, -60, 34, -49, -13, -76, 44, -32, 0, -81, -1, -25, 48, 2, 75, -72, 3, -13, -15, 30, 32, -58, -11, 10, 21, 50, 59,
+  -91, 6, -19, 22, 17, 11, -35, 9, -36, 21, -28, 61, -7, -6, -54, 38, -34, 76, -52, 47, 7, -26, 30, 31, 7, -33, -37, 33, 26, -2, -6, -30,
+  -32, -34, 37, -8, 6, -44, -43, -52, -29, -6, -66, -47, -49, -43, 8, 13, -10, 9, 33, -43, -16, 79, -38, -35, 5, -20, -12, 51, -35, -7, -25, -23,
+  14, 41, 9, -43, -11, 12, 63, 67, -48, 24, -14, -13, 22, 50, 8, 21, 15, 73, -1, 33, -39, 28, 37, 46, -32, 9, -13, 12, 17, 45, 65, 0,
+  -72, -52, 32, 121, 46, -14, -46, -59, 10, 53, 41, -44, -15, -32, -27, 31, 69, -36, -35, -33, 17, 18, 23, -11, 30, -25, 35, 57, 11, 22, 19, -1,
+  -38, 73, 39, 1, 24, 10, 12, 5, 8, -33, 77, -71, -35, -19, 5, -27, 6, 4, -52, 59, 13, 44, 29, -26, -35, 74, 48, 65, 2, 7, -17, 56,
+  45, -4, 24, -45, -37, 44, 28, 45, 70, -24, -42, 19, 47, -6, 48, -14, -10, -15, 29, 5, 49, 27, 7, -44, 45, 4, 63, 26, -34, -40, 17, -35,
+  68, 31, 1, 5, 2, -39, 60, -11, 1, -68, 42, -8, 8, -17, 27, -24, 44, 21, 105, 12, 45, 46, -31, -1, 96, -61, 21, 37, -52, 8, 46, -3,
+  -34, 48, 26, 26, 56, -30, 19, 12, 23, 5, 91, 33, 3, 84, -9, -15, 39, -23, -56, 29, 58, -9, 72, -21, -7, 97, -2, 4, 96, 22, -12, 0,
+  28, 41, 53, 16, -14, -14, 17, 31, 34, -5, 10, -3, -10, 46, 73, -28, 14, 62, -16, 40, 87, -40, -26, 63, -34, -18, 29, -3, -42, 31, -35, 35,
+  74, -5, 22, 62, 10, 61, 53, 42, 4, 58, -54, -2, 68, 10, -43, 49, 14, 47, 29, -14, -54, -30, -32, -21, 35, 16, -73, -13, -64, -39, 34, 11,
+  -72, 8, 16, -16, 3, 2, -42, 75, -35, -8, -6, 2, -38, 87, -19, 58, -7, 21, -99, 47, -30, 43, 42, 23, -46, -27, -44, 54, 12, 17, -80, 19,
+  -98, 37, 8, 62, -42, 21, -45, 93, 60, 57, -30, 28, -6, 28, 98, 85, -47, 49, -10, 12, 5, 31, -29, 70, -35, 71, 73, 39, -33, -8, -68, 83,
+  17, 46, -42, 4, -82, 5, 50, 47, -8, -73, -20, 41, 65, 90, -26, -5, -20, 34, 46, 56, -34, -2, -21, 25, 92, 81, -19, -28, 30, 37, 89, 98,
+  -14, -80, -17, 3, 13, 63, 10, -127, -23, 23, 15, 76, 8, -65, -76, -2, -10, 26, -65, -10, -66, -5, 66, 36, -17, -58, -72, 48, -34, 74, 1, -1,
+  -61, -6, 4, 35, -18, -15, -38, 61, -16, 5, -30, -72, -55, 29, 54, -12, -31, -30, -79, 66, 72, 69, -6, -35, -81, -20, 50, 52, -10, 11, -10, 32,
+  18, 82, -9, -13, -21, 40, -24, -1, 4, -70, -19, 49, 51, 4, -45, 21, 29, 28, 45, 95, -78, -13, -9, 3, -33, -43, -32, 18, 8, -50, 15, 28,
+  -29, 82, -26, 11, -70, 21, 42, 35, -73, -24, -34, 15, -1, -7, -10, 15, 27, -21, -42, -29, -36, 18, -11, 27, 15, 0, 32, -56, 2, 4, 30, -75,
+  -79, -32, 25, 29, -23, -8, -40, 20, -17, 80, 38, 58, -84, -41, 69, 82, 8, 25, -35, -50, 44, 57, 7, 16, -82, -60, 18, -14, 17, 80, -88, 15,
+  22, 51, 54, 68, -85, -9, 3, 17, -16, 8, -58, -20, -14, 62, 9, 7, -46, -19, 19, 20, 32, -20, -21, -19, 39, 97, 14, 8, 22, 55, -39, 37,
+  37, -25, 3, 8, -5, 13, -27, 17, 38, 42, -10, 35, -7, -23, -22, -10, -2, 25, -30, -22, 10, -3, -7, -6, -74, 48, 48, 57, -30, 62, -58, 37,
+  -5, 59, -51, 34, -51, 26, 46, 51, 8, 3, -17, 7, 90, -8, -37, 0, -27, 32, 30, 17, 14, 12, 38, -30, 31, -66, -61, -51, 23, 2, -29, -31,
+  5, -78, 12, 46, -46, -26, -24, -54, 51, 54, 38, 13, -20, -29, -28, 127, 108, 33, -48, -66, -1, 111, 101, -3, -1, -32, 8, 82, 81, 36, -52, -8,
+  4, 55, 15, 42, 20, 38, 24, 7, 30, 44, -2, -18, -19, 39, 1, 32, -29, 14, -28, 49, 61, -17, -32, -7, -33, 21, -8, -35, -38, -65, -8, 20,
+  -20, 8, 16, -60, 0, 21, 23, -48, -14, -9, 44, 59, -14, 24, -23, -7, 40, 73, 2, -5, 8, -6, 9, 18, -23, 4, 7, 24, -3, 81, -34, 28,
+  -11, -27, -24, 86, -21, 12, -58, 23, 9, 47, -48, -1, 0, -32, -4, 35, -39, -16, -48, -16, -6, 40, -13, 53, 40, 58, -12, 44, -52, 67, 55, 50,
+  -11, 6, -57, 46, 55, 25, -41, -10, -19, 40, 15, 40, -40, 37, -43, 51, 27, 52, 5, 45, -44, 13, 25, 85, -4, 53, -25, 8, 64, 66, 33, -14,
+  -73, -19, -2, 22, 17, 29, -36, -55, -6, -5, 24, -1, -2, -46, 33, 56, -27, -5, -31, -66, 46, 25, -26, -23, -27, -57, 52, 27, -4, -45, -40, -46,
+  -46, 18, 37, -2, 9, -61, -64, 24, 51, -25, 21, -44, -35, 56, 28, 5, 2, 26, -47, 6, 6, 0, -3, 14, -67, 41, -27, -15, 22, 18, -86, 15,
+  3, 8, 25, -44, -35, 38, -48, 24, -9, -40, -44, 28, -39, -55, 2, -24, -43, 7, 45, -11, -23, -25, -18, -19, 20, -56, 6, -9, -50, -23, 3, -55,
+  -23, -7, -30, 9, 20, 8, 40, -43, -10, -24, -9, -9, 9, 24, -28, 21, -2, -22, 39, -38, -17, 10, -57, 26, 7, -11, -37, 13, -12, 8, 26, -40,
+  -37, -17, -41, 25, -4, -52, -47, -38, -78, 79, -29, -33, 19, -29, -29, 37, -14, -34, -14, -11, -12, 24, 22, -31, -3, -47, -14, 16, -32, -24, 7, -56,
+  -22, -11, -40, 12, 17, -42, 19, -3, -19, -55, 21, -14, -35, -13, -4, -45, -16, -24, -15, 35, -3, -59, -8, -21, -25, 4, -58, -21, 7, -20, 15, -15,
+  -67, 3, 39, -18, -9, 14, -57, -23, 33, -29, 33, 11, -2, -8, 38, 36, 72, -55, -37, 5, 38, -8, 39, -23, 5, 26, -16, 20, -3, 0, -32, 10,
+  12, 2, 24, 4, 4, 34, 21, 11, 14, 13, -40, -26, 8, -33, -16, 52, 35, -26, 5, 8, 26, 6, 37, 37, 16, -10, -12, 33, 57, 44, -32, 16,
+  -35, 45, 10, 26, 13, 25, -27, 53, -24, 83, -9, 23, -27, -23, 44, 41, -23, 39, 4, -16, 12, 67, 30, -10, -26, -32, -10, 7, -20, 27, 22, -64,
+  -13, 16, -22, -24, -12, -59, 53, 47, -11, 7, -71, -37, 74, 48, -1, 27, 0, -64, 19, -26, 50, 26, -33, -20, -2, -15, -27, 24, -5, 6, -31, -9,
+  2, -31, 10, 94, 15, 4, -47, -28, -21, 56, 35, 30, -2, -41, 8, 91, 4, 29, -23, -18, -14, 73, -34, 53, -44, -50, 5, 13, 19, 7, 17, -53,
+  -27, 30, 4, 68, -27, 14, -2, -21, 35, -7, -30, -54, -3, -10, 57, 33, -43, 9, -14, 47, -3, -11, -1, -24, 23, 74, -21, -1, 16, -37, 15, -14,
+  11, 15, -14, -39, -2, 20, 51, 8, 3, -51, -36, 14, -3, -28, 0, -109, -26, 16, -28, 19, 19, -19, -31, 12, -34, 60, 59, -23, 16, -8, -43, 36,
+  25, 15, -37, 0, -23, 54, 32, -9, -32, -49, -48, 45, 17, 17, -40, -33, -48, 30, 35, -27, -20, 32, -43, 33, 55, 33, 17, -13, -40, -14, 54, -26,
+  -4, 12, -18, -26, 46, 27, 4, -11, -67, 9, -8, 39, 48, 7, -14, -23, 22, 50, 31, 25, 6, 43, 67, 0, -40, -26, -36, 18, -3, 24, -36, -3,
+  -17, 27, 8, -9, -57, -4, 0, 5, 22, 38, -6, 42, 1, 22, -39, -4, -29, 71, -40, -40, -59, -19, -15, 35, 14, -42, -3, -17, 6, 32, -9, 9,
+  -41, 4, -3, -38, 5, -13, -36, 60, -55, -14, -53, 5, -15, 26, 15, 47, -28, -8, -33, 56, -21, 15, 23, 14, -31, 30, -59, 20, 1, -48, -6, 43,
+  -42, -1, 0, -57, -15, 19, -8, -11, -52, -4, 15, 56, -6, 38, 16, -65, -48, -2, -24, 22, -31, -40, -32, 47, -22, -26, 18, -29, -16, -32, -6, -47,
+  12, -41, -36, -23, -45, -42, -5, -46, -15, -53, -1, -9, -3, -87, -27, -67, -47, -21, -6, -37, -35, -24, 0, -32, -13, -61, -28, 1, -49, -19, 16, -14,
+  -1, -2, -12, -27, -36, -64, -47, -39, -48, -29, 5, -35, -14, -37, 30, -25, 6, -86, 10, -55, -4, -42, -26, -23, 19, -79, 13, 5, -35, 19, 1, -36,
+  7, -47, -58, -11, 3, -24, 50, -6, -39, 63, -6, 1, 36, -13, -5, 26, -43, 7, 15, -30, 19, 54, 10, -8, -26, 11, -57, -8, -8, -12, -32, 51,
+  -11, 30, -11, -62, 26, 46, -23, -20, 13, -52, 30, -27, -5, 5, 8, -28, 18, 1, -43, 6, 38, 22, -5, -22, -30, 37, 52, 23, 13, -40, -34, 1,
+  18, -24, 65, 2, -44, -8, 58, 0, 60, 39, -41, 59, 51, 36, 35, 35, -71, 25, 60, 9, -24, 26, -7, 22, 10, 51, -32, -21, -21, 60, 34, 61,
+  -9, -35, -41, 15, 12, 44, -35, -50, -71, 19, 48, 16, -8, -41, -99, 23, -34, -62, -50, 88, -80, -62, -7, -67, -28, 25, -14, 7, 22, -4, -1, 17,
+  -17, -39, 38, 26, 29, 49, -68, -33, 48, -16, -39, 34, -25, -28, 54, 3, -37, 34, -1, -16, -21, 54, 39, 94, 16, -106, 13, -15, 46, 3, 20, -32,
+  48, -13, 34, -23, -17, -87, -24, 42, -1, 37, -9, -38, 43, 0, -20, 51, -21, -57, 27, 55, -8, 34, 24, -81, 16, 36, 32, 16, 8, -92, 32, 32,
+  -9, 38, -40, -10, 67, -55, 9, 19, 1, -68, 55, 4, 18, 45, -23, -80, 52, -21, -20, -3, -23, -95, -46, -18, 39, -48, -20, -95, -20, -17, 6, -20,
+  30, -60, -9, 17, 31, -13, 17, -69, -41, -37, 45, -19, -8, -53, 7, -29, 17, -27, 11, -58, 6, -86, 36, -55, -25, -15, 36, -24, 47, -21, -18, -12,
+  7, -69, -5, -18, -36, -38, 14, 11, 49, -16, 5, 59, -3, -7, 25, 16, 0, -32, 11, -37, 1, -16, -37, -6, -65, 9, -12, -20, 57, -1, 12, -50,
+  -36, -22, -41, 21, 33, -58, -121, -1, -14, 37, 26, -55, -80, -35, -57, 2, 8, -54, -86, -8, 1, 36, -22, -66, -36, -80, 23, 45, 19, -43, -58, -51,
+  -2, 19, -14, -43, -108, -73, 12, -12, 25, -31, -116, -90, 5, 55, -64, -25, -72, -12, 44, 57, -45, -5, -53, 13, 19, 6, -12, -79, -34, -46, 59, 11,
+  -53, -47, -56, -70, -13, 67, -15, 13, -34, -44, 18, 23, -21, 10, -91, 27, -24, 68, -20, -38, -56, -7, 56, 54, -15, 5, -55, 7, -8, 54, -40, -14,
+  -79, 67, 24, 1, -11, -60, -27, -8, 54, 48, -1, -9, -28, 18, 44, 99, -25, -29, -52, 40, 13, 75, 3, 29, -76, 58, 21, 15, -58, -8, -68, 19,
+  -6, 67, -54, -15, -40, 89, 51, 53, -25, -9, -59, 28, 17, 99, -11, -18, -43, 47, 4, 81, -55, 36, -63, 95, 74, 63, 23, 2, -36, 81, 13, 91,
+  -40, 9, -49, 24, 38, 29, 45, 26, -12, 85, 45, 40, 38, -14, -71, 2, 26, 27, 45, -14, -37, 20, 58, 61, -19, 2, -56, 4, -30, 6, 16, 22,
+  -78, 51, 10, -4, 8, 1, -12, 36, -14, 34, 4, 13, -78, 62, 5, 50, -11, -17, -10, 72, 44, -8, 48, -3, -72, 17, -20, -23, 77, -18, -24, 42,
+  19, -35, 18, -35, -58, 27, 32, 2, 15, -33, -47, -6, 31, 36, 19, 5, 6, 10, 68, 2, -2, 53, 2, 30, 13, 48, 21, -11, -29, 35, 40, 51,
+  39, 5, -37, 23, 34, -36, 24, 44, 6, 21, 88, 55, 59, -26, -6, 26, 43, 4, -42, -3, 25, -1, -70, -67, -18, -4, -49, -1, -78, 42, -60, 50,
+  -27, -43, -18, 41, 2, 65, -21, -90, -7, 72, -14, 35, -17, -58, 19, -10, -33, 109, -45, 4, -12, -50, -38, 24, -103, 9, -88, -37, 18, 20, -50, -5,
+  -30, -88, -59, -55, -26, 49, -93, -59, -53, -52, -21, -59, -48, -54, 23, -25, -36, -3, -24, -24, 5, 23, -18, -16, 28, 41, -36, -4, -6, -77, 76, -19,
+  19, -42, -15, -63, 47, -8, -35, -48, 0, -64, 50, -34, -67, -43, 10, -26, 84, 5, -23, -68, -49, -5, 96, 29, -43, 3, -124, -6, 95, -18, 26, -6,
+  -72, 39, 77, 47, 27, -61, -84, -19, 75, -8, 5, 12, -53, 83, 6, 46, -38, 15, -37, 74, -9, -22, -51, 11, -90, 52, -14, 65, -28, -46, -31, -6,
+  28, 22, 34, -19, -37, 4, -36, -22, -22, -8, -26, -66, 17, -23, 15, 18, -44, 23, -25, 9, 9, -24, -7, 3, -43, 18, -62, -5, 11, -27, 70, -14,
+  -48, 37, -70, 10, 76, -4, -49, 31, -46, -86, 91, -3, -37, -13, -85, -120, 44, 40, -7, 18, -28, -84, 31, 31, 2, -23, -63, -72, 4, 40, 25, -36,
+  -127, -34, 7, 2, -48, -9, -65, 5, 30, 26, 3, 28, -20, 15, 40, -36, 14, -50, -48, 11, -27, 33, -14, -5, -45, -59, 14, 3, -67, -53, -1, -18,
+  39, 56, 20, -11, -5, -61, 39, 56, -55, -14, -78, -8, 90, 29, -3, -3, -39, -69, 56, -19, 11, 58, -61, -55, 42, -8, 0, 53, -123, -22, 92, 43,
+  77, 61, 57, 13, 1, 50, 56, -30, 0, 1, 20, -26, 49, -13, 11, -7, -39, -30, -22, -45, 65, -31, 16, 30, 28, 28, -14, -45, 40, 28, 11, 8,
+  -24, 4, 40, -9, 23, 38, 47, -27, -49, -24, -14, 9, 30, -30, 14, 15, 15, -24, 30, 22, -41, 15, 40, -26, -36, -15, -9, 10, 43, 68, 13, -7,
+  -38, 18, -36, 9, -32, 70, -26, 34, 12, 24, 48, 82, -50, -37, 14, 18, 3, 50, -47, 21, -36, -49, 14, 73, -62, -15, -46, 28, 13, 86, -35, -25,
+  -14, -20, -35, 63, -61, -5, -58, 32, 35, 104, -62, 51, -25, -46, -26, 56, -36, 0, -67, 9, 40, 94, -66, 21, 22, 12, 27, 47, -57, 42, 5, 44,
+  24, 80, -61, -25, -4, 42, -10, 65, -79, 30, -35, 61, -47, 18, -70, 44, -31, 26, -21, 97, -65, -41, 7, 22, 6, 104, -21, -57, -28, -32, -67, 73,
+  -67, -43, 41, 16, 20, 124, -102, -3, 26, 17, 11, 98, -90, -14, -19, -14, -35, 122, -70, -78, 9, 3, 9, -35, 59, -67, 50, 27, 57, -36, 38, -33,
+  61, -26, -36, 4, 2, 0, 12, -40, -63, 7, 16, 33, -108, 35, -5, -27, -33, -4, -7, -9, -41, 20, 5, 15, 20, -28, 18, -56, 23, -26, -40, 6,
+  -4, -4, -12, 52, -4, 39, -23, 1, 86, -10, -16, -16, -31, -26, 17, 36, 54, -50, -16, -64, 50, -28, 55, -26, -21, -24, 19, 24, 18, 11, 23, 18,
+  30, -62, 22, -51, 37, -4, -11, -8, 52, 18, 14, -23, 59, -40, 36, -9, -78, -29, -5, 29, -36, 3, -13, -19, 19, 28, -29, 10, -3, -44, 48, -36,
+  -3, 13, -7, -19, -14, -35, -23, 37, -4, 58, -18, -22, 33, 36, -11, -40, 27, -28, 12, 25, 28, 52, -24, 17, -58, -55, -18, -11, 6, 0, 24, 38,
+  17, -3, 38, 43, 17, 13, 36, 77, -28, 27, -24, 26, -43, -13, 42, -43, -22, -17, 14, -11, 48, 20, 72, 22, 21, 12, -9, 39, 31, 62, 25, 8,
+  -3, 14, -7, 55, 6, -5, 49, 28, -10, -98, 80, -22, 19, 15, -11, -79, 60, 0, 16, 32, 22, -61, -2, -55, 72, 7, -23, -39, 13, -14, 60, 33,
+  -16, -53, 8, 11, 61, 9, 9, -26, -40, 51, -2, -16, -20, 27, -20, -5, 18, -14, 34, 4, 16, 53, -48, 4, 2, 0, -8, 34, 0, -48, 54, -54,
+  -43, -41, 1, 5, 12, -97, -25, -54, -54, -3, -13, -127, -24, -4, -8, -2, -29, -95, 40, -31, 28, -19, 7, -44, 88, -29, 10, 62, 60, 19, 38, 19,
+  18, 35, 11, -8, -3, 21, -1, 8, 33, -39, 22, 0, 58, -41, 15, -43, -38, 0, -10, 41, 28, -68, -5, -3, -34, 2, -5, 11, 21, -16, -26, 62,
+  19, -6, 40, 5, 32, 52, -6, -6, 17, -26, -15, -5, -12, -22, -34, 7, 65, 68, -20, 43, 23, 27, -12, 26, -21, -28, 41, 3, 9, 3, 18, -91,
+  -25, -1, 23, 13, -60, -75, -43, 57, 23, 31, 39, -71, 14, 77, -13, -23, 49, -35, 19, 14, -41, 17, 32, -50, 48, 13, 47, 39, 14, -16, 17, -2,
+  -31, -19, 43, -19, 2, 62, 41, -2, 13, -47, 27, 12, 21, -37, 14, -19, -48, -5, -32, 27, -7, -45, -36, 33, 27, 32, -5, -28, -27, 25, 22, 16,
+  53, -50, 19, -37, -12, -60, -3, -71, 49, 45, -35, 8, -20, -104, 69, 36, -39, 15, -40, -34, 39, 6, 49, -17, 21, -102, -17, 54, 12, -55, 58, -90,
+  -11, 3, 80, -2, 16, -53, -38, -2, 34, -49, 7, -77, -32, 21, 1, 12, -40, 23, -17, 3, 30, -32, -27, -76, 86, -46, -19, 125, -32, -27, 30, -1,
+  50, 94, 33, 11, 17, -8, 52, 101, -5, -30, 49, 8, 27, 82, 47, -41, 46, 52, 33, 39, 4, -10, 64, 4, -16, -12, 10, -65, 62, 81, 21, -39,
+  -7, -98, 8, 46, 46, -23, 19, -64, 12, 79, -30, 8, 25, -43, -8, -37, -31, -12, 0, 9, 32, -24, 18, 20, 19, -32, 6, 15, 3, -12, 7, -13,
+  -73, 5, -46, 22, 25, -35, -12, -30, -30, 34, 52, -49, -21, 28, -85, -37, -30, 0, -40, 8, -42, 32, 50, -44, -54, -19, -102, -36, 25, -62, -18, -28,
+  -92, -40, -40, -71, 19, -8, -60, 28, -4, -91, -66, -4, -41, -16, -26, -111, -33, -8, -23, 41, 16, -21, -7, -12, -51, 7, 10, -43, -21, -4, 4, 26,
+  -18, -74, -23, 34, -48, 15, -1, -58, 20, 9, 25, -11, 11, -55, 46, 16, 11, 35, 44, -92, 21, -7, -11, 40, 6, 18, 25, -43, 51, 60, -14, -37,
+  33, 12, 43, 51, -57, -1, 24, 2, 46, 28, -40, 24, 29, -37, 81, 56, -41, 12, -15, 33, 6, 10, -21, -24, 11, -25, -46, 23, -17, 26, -26, -9,
+  -47, -4, 36, -52, 61, 32, 1, -26, 46, -67, 36, 28, -35, 1, 13, -26, 1, -83, 50, -60, 53, 16, -44, -27, 18, 25, 0, -24, -67, -49, -33, 7,
+  2, -15, -48, 19, 54, 12, 60, -22, -47, -52, 8, 36, 61, -15, -44, -29, -31, -27, 81, 7, -42, -5, 15, -26, 23, -12, -7, 61, -22, -15, 95, 22,
+  41, -3, -75, -32, -66, 45, -21, 76, -26, -88, -47, 84, -42, 15, 1, -59, 30, 47, 28, 20, -22, -29, 20, 51, 2, -1, 30, -24, 36, -59, -23, 27,
+  8, -13, 38, -84, -47, -28, -26, 15, -4, -41, 11, 16, -20, -58, -52, 14, 12, -34, -35, -10, -30, -50, 12, 13, -45, 41, 37, -43, 13, 40, -5, -11,
+  35, -47, 31, 98, -63, 37, 8, -19, 40, 58, 0, 27, 18, 61, -1, 39, 25, 51, 37, 9, 25, 6, -7, -22, 62, -14, 51, -37, -7, 9, -11, -50,
+  76, 30, 70, -42, -36, -31, 9, 32, 49, 11, -21, -9, -31, 36, 59, 22, 37, 34, -31, -35, -2, -32, 35, -18, -61, -1, 2, -9, -14, 15, 29, 20,
+  -13, -64, 29, 59, 32, 69, 16, -18, 23, 26, -47, 8, -4, -66, 23, -8, -11, -54, -16, 6, 38, 34, -8, -57, 47, 19, 29, -21, -20, -60, -46, 48,
+  -27, 30, 6, -6, -49, -11, -24, -20, 0, -61, -37, -26, 5, 7, -7, -33, -117, -8, -9, 48, 18, -21, -43, 14, 0, -46, -28, -65, -58, -35, -35, -9,
+  3, -60, -38, -26, -8, 4, 36, -15, -25, 30, 33, -11, 27, 1, -5, 27, -2, 13, 55, -14, 0, -22, 34, 2, 19, -31, 37, -18, -19, -11, -4, -11,
+  -3, -49, -3, 30, -4, -27, 48, -66, -16, -5, 13, -18, -28, -77, 34, -1, 34, -16, -27, -12, -9, -32, 26, 1, 0, 17, 37, -21, -20, 28, 48, 4,
+  41, 56, 40, 16, 59, 2, -16, 40, 17, -39, 60, 40, -16, 55, -58, -2, 59, 39, 3, 14, 24, 12, 27, -10, -1, -21, 28, 24, 66, -10, -10, -43,
+  -10, -31, 57, 60, -20, -10, 26, -6, 11, 30, -62, -66, 37, -20, 55, 102, -7, -19, -44, -19, 60, 58, -55, 33, -3, 85, 44, 21, -7, -6, -8, 63,
+  3, 50, -34, -36, -68, 5, -18, 35, -2, 5, -33, 20, 15, 17, 44, -62, 18, 58, -39, 0, -23, 4, -21, 69, -58, 6, 20, -34, 19, 83, -30, 67,
+  -5, -17, -9, 39, 37, 91, 27, 22, 5, 2, -44, 84, -87, 48, -23, 35, 50, 32, -97, 18, -23, 13, 59, 27, -35, -9, -72, 74, 59, 38, -51, -60,
+  -42, 24, 6, -6, -48, -13, -34, 12, 38, -24, 12, -16, -17, 42, 23, 32, 9, -18, -51, 36, 52, 62, -68, -54, -72, 0, 47, 47, -10, -15, -56, 55,
+  47, 69, 3, 11, -32, 47, 51, 13, -3, -43, -3, 15, 33, 79, -4, 52, 2, -31, 54, 47, -55, 33, -52, -61, -7, 19, 27, 8, -7, -26, 6, 59,
+  5, 49, -43, -29, -13, -13, 14, 9, -15, 3, -33, -28, -27, 36, -18, 56, 17, -17, 47, -9, 9, 10, -11, -8, 41, 7, 13, 18, 41, 57, 10, 0,
+  14, 37, -4, -12, -7, -39, -31, 50, 12, -10, 57, 1, -91, 32, 12, -29, 47, 2, -52, -15, -42, 35, 8, 29, -14, -22, -49, 53, 48, -9, -62, -18,
+  -69, 33, 36, 57, -10, -74, -40, 15, 63, 22, 32, -8, -10, 19, 14, 59, -32, -91, -25, 2, -2, 66, 40, -36, 26, 1, 16, 65, 45, -53, -26, -2,
+  -1, 13, -24, -94, 38, -19, 43, -21, 3, -55, 4, -49, 7, -23, -22, -67, -15, -5, 25, 50, -4, -72, -14, -50, 1, 1, 30, -37, 32, -47, 71, -33,
+  37, -93, -24, -89, 14, -85, -8, -29, -2, -58, 74, -60, 60, -30, 7, -89, 32, -66, 19, -56, 53, -96, 6, -61, 63, -67, 79, -82, -27, -44, -10, -58,
+  68, -37, -31, -10, -2, -74, 42, -43, -25, -11, 4, -96, 28, -53, -30, -69, 24, -127, 49, -56, 0, 10, -24, -127, 29, -78, 63, 28, 35, 12, 56, -46,
+  -3, 34, 15, 45, -10, 20, 37, 17, 48, 4, 2, -54, -4, -25, -29, 53, 0, -60, -23, -21, -21, 84, -17, -2, 8, -36, -23, 75, 3, -53, 38, 1,
+  -4, 75, 9, -63, -23, -36, -5, 43, -33, -13, 35, -33, 52, 65, -2, -14, -13, -4, -12, 18, -36, -35, -36, -24, 21, -24, 26, 52, 20, -29, 57, 12,
+  19, -4, 22, -20, 6, -11, 29, -13, 57, -29, 10, -23, 65, 9, -29, -6, 38, -60, 100, 45, -31, 13, 14, -20, 115, 13, -8, -33, 32, -29, 63, 29,
+  -57, -49, 6, 10, 50, 9, 16, -20, -14, -13, 65, 25, -12, 28, 35, 49, 60, 62, -58, -5, -12, 66, 19, 43, -7, 45, 12, 51, 17, 12, -29, 5,
+  -18, 88, 56, 26, -6, 53, 29, 29, 2, 25, -26, 18, -25, 25, 39, 48, -19, 31, -13, 53, 1, 15, 8, -9, 12, 56, 16, 20, -7, -44, 2, 30,
+  -12, 12, -21, 4, 4, 61, 39, 7, 29, -57, -20, 58, -10, 49, -12, -21, -5, 84, -50, -7, -5, 16, -63, 80, -12, 44, -12, 18, -25, 32, 10, 49,
+  -42, 71, -2, 45, 10, 4, -41, 49, -57, 37, -2, 62, -16, 94, -5, 97, 16, 42, -68, 20, 0, 88, -57, 14, -15, 77, -64, 68, 23, 60, 0, 33,
+  -49, 11, -36, 7, 15, 106, 0, 50, -4, 9, -2, 108, -33, 15, -75, 9, -3, 38, 25, 59, -71, 9, 2, 78, 11, 17, -17, -24, -11, 32, -4, -25,
+  -38, 14, -31, 97, 2, -24, -80, -39, 46, -24, 55, 7, -19, -9, 50, 21, 57, 14, -21, 28, 29, -1, 11, 8, -12, -21, 38, 32, 43, -25, -70, -14,
+  65, 5, 24, 29, -29, -51, 27, -16, 58, -3, -56, -24, 36, 28, 45, -9, 19, -6, 53, -47, -6, -35, -41, -62, 92, -38, 8, 3, -12, -68, 90, -2,
+  -18, -22, -13, -43, 65, -28, 59, -5, 22, 14, 66, 0, 61, -46, -33, 9, 31, 64, 49, -43, 34, -23, 16, 3, -12, -20, 32, -48, 41, 47, -31, 48,
+  -34, -54, 7, 25, 14, 48, -36, -53, 41, 50, -64, -27, -4, -81, -49, 55, -26, 12, -39, -57, -32, -10, 1, 35, -18, -36, -55, 3, -1, -22, -54, -17,
+  -25, 14, 35, 52, -80, -18, -43, 17, 4, 75, -73, -27, -60, 1, 6, 85, 0, 7, -44, 15, -1, 84, -33, -35, -51, -3, -21, 103, 13, -18, -35, -26,
+  -9, 86, -6, -3, -43, 20, 55, 90, -56, -12, -19, 60, -18, 79, -73, 8, -18, 19, 4, 30, -48, 6, -79, -53, -54, 28, -13, -68, 11, -25, -20, -55,
+  77, -71, -22, 17, 35, -40, 57, -63, -17, -3, -5, -14, 5, -46, -15, 41, 16, -49, 13, -69, 8, 43, -10, -47, 49, -40, -33, 70, -2, -34, 56, -76,
+  0, 30, -13, -51, 53, -81, 31, 14, -15, -4, 18, -122, -21, -37, -6, -16, 14, -127, 3, -26, -1, -48, 15, -106, 24, -20, 16, -55, -5, -71, -8, -28,
+  28, -62, 36, -74, 23, 2, 44, -54, 74, -60, 1, -43, 19, -72, 83, -28, -22, -3, -17, -70, 89, -37, 8, 6, 11, -97, 85, -54, 2, 24, 22, -94,
+  46, 3, -6, 14, -28, -91, 32, -25, 0, 18, -18, -54, 28, 16, 0, -3, -12, -63, 64, 5, -9, -23, 5, -29, 77, -6, -7, -10, -15, -29, 28, -24,
+  40, -11, -18, 41, -6, 2, -13, -12, 14, 26, -3, -21, -1, 18, -21, 25, 31, -44, 14, 17, 19, -44, 41, -11, 21, -4, 36, -65, 31, -13, 26, -49,
+  9, -42, 39, 8, 51, -7, -8, -36, 46, -25, 29, -25, 37, 26, 31, -30, -33, -18, 41, -2, 20, 4, -35, 1, 13, -14, 39, -36, -4, 1, 9, 5,
+  12, -9, 0, 13, 11, -3, 38, 24, -13, -10, 12, -16, 62, 3, -45, -16, 34, -25, 69, -5, -18, -14, 15, 5, 14, -46, -37, 1, -13, -4, -3, -14,
+  -31, -21, -7, 8, -13, -31, 6, -9, 24, -33, -11, -8, -36, -26, 32, -10, -17, -15, -36, -28, 47, -52, 0, -5, 3, -12, 31, -47, -8, -25, 9, -11,
+  13, -28, 26, -11, 1, -23, 1, -16, -24, -51, -47, -57, -12, -24, -34, -22, -32, -18, -32, 31, -21, 0, 11, -4, -20, 18, 8, 33, 8, 11, -31, 25,
+  -17, 7, -1, 19, 39, 40, -56, 28, 17, 41, -16, -10, -16, 19, -11, 35, 21, -27, -30, 26, 14, 67, 28, -16, -16, 37, -7, 75, -23, -10, 10, 13,
+  31, -6, -29, -28, 7, 22, 25, 31, -14, -19, 22, -11, 1, -14, -37, -4, -1, 1, -38, -13, -22, -40, 14, -12, -31, -5, 14, -7, 0, 32, -19, 24,
+  5, -40, -6, -3, 20, 38, 37, -41, -8, 38, 29, -12, 26, -26, -31, 10, 4, 2, -1, -16, -6, 20, -4, 19, 17, 2, 14, 16, 40, 31, 17, -21,
+  20, 2, 60, 45, 19, -16, -14, 37, 10, 36, -8, 2, 22, 16, 7, 12, -5, -4, 26, -26, 54, -11, -23, 10, -2, -11, 2, 5, 11, -2, -25, 13,
+  10, -4, -31, 30, -32, -6, -14, -33, -35, 47, -51, -7, -21, -2, 6, 29, -59, 15, 25, -17, 16, 5, -35, 36, -12, -28, -15, -6, -3, 8, 12, 10,
+  -24, -29, -45, 3, 9, 7, -12, -51, -53, -8, -19, -48, 19, -67, -17, -35, -2, -48, 8, -62, -21, 17, -9, 1, -26, -18, -43, 30, 20, -10, -15, -33,
+  -17, 29, 22, -8, 27, -89, 21, -17, 23, 40, -7, -47, 35, 24, -3, 21, 5, -34, -3, 31, 7, 31, -46, -45, 1, -40, 13, 4, -23, -34, 32, 12,
+  26, 5, -18, -53, 25, -47, 36, 4, -46, -61, -19, -13, 40, -37, -18, -51, 28, -23, 9, -20, -10, -77, 30, -12, 48, -12, -40, -45, -13, -15, -7, -17,
+  -22, -59, 28, -30, 9, -27, -28, -3, 22, -4, -26, 2, 1, -21, -15, 29, -33, 3, -41, -13, -12, 7, 9, -2, -35, 11, 14, 37, 2, 5, -54, -20,
+  -28, -31, -36, 26, 5, 2, -14, 9, -8, -2, 20, -55, -23, -32, -40, -36, 12, -3, -42, -4, -10, 8, -18, -40, 7, -9, 3, -46, 11, -50, -23, 0,
+  4, -6, -17, -63, 9, 22, -19, -53, 14, -48, 15, 30, -10, -16, -13, 9, 13, 25, 25, -40, 5, -12, 0, 23, 2, -44, -29, -16, -1, 28, -23, -19,
+  -8, -7, -7, 34, -36, 11, 14, -6, 13, -9, 0, -22, 21, -1, -21, -1, -12, -12, -18, -17, 2, 9, -53, -46, 21, 34, 20, 22, -21, 5, 25, 22,
+  38, 26, 1, -2, -27, 8, 19, -5, -17, -46, -8, 13, -1, -19, -4, -53, -43, 3, 7, -5, 1, -53, 4, 0, -22, 38, 20, 14, -22, -1, -39, 7,
+  -1, 2, -45, -12, -36, 45, 63, 38, -51, 54, -31, 38, -35, -9, 42, -25, 10, 10, -28, -55, 31, 6, -25, 38, 24, -21, 48, 15, -8, 32, -17, -2,
+  10, 47, -43, 22, 3, -26, 35, 26, -45, -1, 37, -7, 15, 8, -6, 1, 39, -21, 12, -8, -28, -5, 12, 5, 25, -18, -43, 15, 24, 16, 72, -11,
+  -66, -28, 46, -10, 77, -8, -58, 38, 33, 38, 41, -7, -46, 42, -6, 50, 43, 7, -36, -6, -15, -1, 39, 2, -59, 16, -22, 38, -16, 21, -30, -36,
+  -3, 16, -22, -16, -54, -3, -1, 20, -21, -20, -13, -11, 17, 39, -25, -16, -41, -33, 6, 53, -24, 39, -32, 16, -8, 13, 38, 56, -27, -13, 5, 21,
+  4, 44, -22, -36, -12, -9, 7, 18, -9, -21, 1, -41, 32, 12, -28, -21, 50, -46, 3, 53, 21, -21, 35, -75, -33, 44, 9, -37, 50, -79, -40, 8,
+  22, 12, 11, -49, -7, -14, -19, 18, 59, -26, -25, 22, -40, 7, 36, -41, 15, 34, -10, 39, 1, -5, -26, 18, -35, 22, -37, -48, 3, 23, -44, 31,
+  71, -43, 14, -103, -44, -13, 54, -45, -3, -114, -41, 15, -12, -17, 13, -119, -34, -28, 51, 46, -49, -82, 33, -37, 16, -1, -43, -13, -6, 1, -7, -94,
+  -10, -78, -3, 55, 34, -44, -50, -49, -71, 52, 35, 10, -48, -30, -13, 37, 16, 2, 18, 6, -36, 19, 34, -74, 26, -90, -35, 53, 16, -41, 54, -24,
+  -49, -7, 5, -33, 58, -62, 41, 26, -44, 24, 13, -14, 7, 46, 24, -4, -31, -12, -24, 63, -13, 14, -22, -71, -15, 24, -3, -1, 57, -52, -23, 42,
+  -70, -63, -31, -40, 0, -9, -23, -39, -13, -8, -4, -10, 9, -60, 35, 12, -7, -31, -27, 21, 31, -15, -22, -7, -16, -19, -10, -22, 25, -17, 16, 9,
+  -16, -59, -29, 1, -27, 44, 28, 10, 12, 9, -24, 7, 7, -18, 33, 37, 30, 32, 28, -52, -1, 54, -41, 85, 6, -14, 39, 65, -59, 68, -25, -88,
+  21, -4, -6, 39, 9, 7, 34, 10, -29, 5, -72, -26, 8, 77, -1, 66, -37, -3, -24, 3, -95, 43, 68, -24, 5, 10, -66, -31, 59, -73, 57, -24,
+  -69, -25, -46, -127, 13, 24, -73, -1, 52, -79, -28, 12, -64, 31, 59, -109, -27, 30, -26, -18, 74, -22, -97, 31, -87, -34, 67, -3, -12, 29, 26, 48,
+  -13, -56, -12, 32, 32, 82, 26, -22, -31, 36, 40, 55, -6, -25, -42, 40, -15, 81, 28, -88, 43, 53, 8, 13, -6, -52, -48, 60, -32, 23, -29, -53,
+  15, -29, 63, -33, 27, -76, 34, -44, -34, 11, 13, -101, -15, -55, 24, 56, -72, -23, -21, -34, -32, 4, 17, -45, 0, 8, 2, -27, 7, 30, -28, -27,
+  -19, 30, 46, 8, 16, -40, -25, -32, 44, -17, -11, -14, -26, -38, 39, 39, 34, -20, 76, 17, -28, -16, -52, -22, 51, -60, 7, 44, -10, 5, 67, -76,
+  29, 73, -13, -29, 63, -48, -20, 60, -84, -64, 21, -44, 12, 2, -73, -41, 56, 55, 48, -68, 2, 9, 105, -12, 28, -18, -67, 7, 89, 33, 18, -13,
+  -23, -63, 89, 21, 44, 7, -52, -35, 22, -2, -2, -17, -41, -96, 33, 38, -8, 23, 9, -89, 76, -4, -62, 54, -21, -76, 51, -22, -19, 25, -79, -39,
+  61, 22, 39, 46, -46, -80, 46, -27, -37, 44, -3, -19, 99, -27, -43, 100, -30, 6, 48, 49, -4, 41, -11, -48, 73, -47, -64, -40, -23, 12, 93, 26,
+  -26, -84, -52, 24, 39, 11, -68, -38, 22, 28, 15, 31, -50, -111, 18, 35, 30, -17, -10, -65, -23, -11, 22, -66, -60, -80, -53, -7, -8, 10, -21, 23,
+  -24, -45, -13, -68, -40, 22, 7, -51, -10, -37, -29, -74, -35, -8, 59, -33, -37, -82, -42, 0, 16, -20, 32, -75, 6, -49, 0, -73, 50, -20, -40, -63,
+  28, -73, 5, -16, 32, -56, 31, -34, -13, -60, -11, -48, -47, -64, -14, 5, 4, -12, -48, -122, 4, -15, -30, 35, -55, -20, 33, -45, 29, -18, 8, -35,
+  48, -69, -24, -4, -20, 42, -22, -45, 14, -20, -46, -6, -8, 55, 26, 5, 15, 22, 17, 50, 54, 38, -33, -13, 52, -24, 63, -55, -31, 20, 53, -7,
+  63, -29, 39, 24, 13, 2, -9, -1, -14, 18, 55, 60, 70, -38, -38, 33, -10, 27, 42, -22, -26, 45, -39, 90, -34, 11, -93, 17, 50, 14, 13, -34,
+  -41, 11, 8, -18, 14, -6, -38, 47, -29, -54, 32, 28, -92, 4, 19, -74, -6, 11, -51, 20, 40, -20, 43, -32, -62, 26, 32, -1, 55, 26, -77, -26,
+  -72, 26, 59, 27, -30, 24, -22, 1, 35, 52, -14, -13, -17, 56, -9, 40, -101, -5, 17, -29, 32, -14, -113, 25, 16, -29, 18, 26, -9, -12, 32, 46,
+  39, 74, -72, 60, -26, 1, 43, 61, -76, 60, -62, 39, 30, -15, -23, 13, 25, 16, 33, -12, -26, 54, 35, -18, -2, -1, 52, 73, -43, -11, -11, 8,
+  23, 12, -39, 58, 59, -57, 55, 31, 7, 31, 66, -47, -38, 29, -24, 43, -4, -30, 56, 19, -1, 48, -9, -5, -42, -2, 47, 80, 17, 31, -9, 62,
+  -47, 16, 40, -19, 36, 34, -18, -17, 66, 4, 1, 32, 29, -48, 35, -23, 1, 64, -28, -2, -22, -73, 2, 30, -9, -73, 42, -16, -55, 28, -35, -92,
+  50, -66, -18, 49, -21, -32, 16, -22, -26, 84, -5, 6, -84, -35, -77, 69, 78, 45, -73, 20, -99, 14, 26, 38, 26, -68, -104, 47, -5, 26, -47, -15,
+  -58, 54, -5, -3, 40, -57, -40, -36, -15, 29, 8, -32, -19, 2, 71, -10, -60, -59, 8, 55, -12, 32, 18, -54, -17, 48, 57, -30, -9, -29, 11, -28,
+  50, -5, -43, -31, -25, -58, 39, -28, 26, -20, -4, -65, 16, -23, 50, -97, -5, -80, 16, -22, 22, -37, 14, -8, -1, 22, 42, 7, 27, 29, 34, 17,
+  1, -42, 58, -51, 53, 54, 28, 18, 61, -45, -36, -10, 94, -4, 56, -32, -6, -16, 12, -7, 6, -54, -4, -12, 86, -40, 40, -29, 15, 33, 64, -41,
+  13, 56, -26, -12, 18, 7, 65, -30, -48, 30, 37, -3, 93, 54, -63, 65, -21, -3, 29, 40, -51, -3, -15, -27, 98, -21, -30, -62, -21, -96, 125, 4,
+  -44, -32, 22, -62, -17, 58, -1, 13, 76, -11, -32, 83, 52, -4, 70, 24, -3, 65, 28, 2, 69, -32, -42, 64, 22, -9, 67, -19, 24, 79, -17, 5,
+  28, -68, 15, 38, 28, -58, 57, -69, -33, 61, -31, -37, -12, -38, 31, 44, 52, 57, 9, -94, -7, -36, -4, 2, 1, -89, 41, 47, 19, -10, 28, -66,
+  -29, 7, 67, 37, 25, -73, 38, 28, -9, 44, 24, -42, 4, -14, 58, 43, 96, -81, -27, -21, -10, 55, 65, -90, 19, -13, -19, 34, 73, -73, -9, -52,
+  28, 79, -2, -42, 52, -2, -35, 68, 60, -113, 3, -63, -1, 73, 53, -107, -14, -69, 7, 24, 27, -66, -31, -49, -28, 38, 66, -26, -3, -52, -15, 34,
+  35, -26, 28, -4, 29, 76, -11, -55, -6, -7, 42, 93, 5, -18, 45, -30, -15, 53, 19, -89, -35, -36, 9, -5, 18, -94, 14, -44, -31, 15, 31, -39,
+  -44, 15, -9, -4, 46, -21, 23, 9, -31, 20, 26, -3, 1, -14, -24, -8, 36, -64, 5, -61, 12, 48, 41, -25, -14, 20, 43, -29, 57, -73, -13, 38,
+  16, -48, 9, -44, 0, -34, 0, 15, 15, -24, 30, 43, -19, -55, 17, -5, -22, 41, 35, -40, 52, -68, -9, 70, 27, 11, 5, -14, 44, 41, 41, 10,
+  -32, -79, -34, 33, 1, 14, -51, -77, -17, 15, 56, -38, 0, -68, 17, -30, 35, 19, -18, -83, 0, -19, -29, -54, -21, -70, -22, -62, 0, 2, 10, -37,
+  44, -46, 24, -61, -2, -86, 24, -8, 44, -13, 8, -42, 22, -32, -49, -80, 51, -60, 1, 26, 32, -56, -8, -22, -18, -3, 44, -23, -35, -13, -31, 11,
+  -19, -28, 9, 34, -15, 42, 10, 38, -31, 3, 13, 21, 7, 27, 21, 7, 8, 27, 27, 50, 9, 2, 44, 22, 5, -25, -1, 3, 6, 89, 16, -32,
+  41, 19, -22, 14, -31, -28, -1, 38, -13, 19, 7, -1, 41, -21, -24, 38, -65, -67, -18, -25, 7, -26, -10, -72, 44, -52, -33, 9, -14, -72, -18, -23,
+  -47, -26, 8, -22, -7, -43, -43, 10, 51, -4, -41, 5, 34, -6, -31, 24, -70, -12, -28, 24, 34, 23, -63, 13, 2, -23, -38, 52, -40, -37, 35, 33,
+  -8, 16, -16, -3, -12, 33, -22, 77, -14, -18, 16, -31, -45, 91, -60, 6, 61, -55, -65, 67, -2, 26, 46, -22, -62, 75, 18, 47, 51, 62, -25, 26,
+  -46, 31, 48, 96, -16, -22, -33, 36, 37, 72, -21, 13, -83, 53, -7, 92, 5, 22, -79, -31, 42, 17, -75, 15, -38, 23, -16, 39, -12, -43, -76, -51,
+  30, 19, -3, 10, -114, -22, -23, -32, -7, -127, -64, -46, 35, -22, 23, -86, -77, -21, 4, 7, -14, -84, -67, -47, 6, 0, 27, -66, -43, -62, -46, 13,
+  -23, -59, -48, 24, -27, -24, -16, -90, -25, 9, 36, 34, -3, -92, 10, 36, 15, 7, 54, -105, 3, -12, 27, 31, -16, -103, -9, -9, 14, 17, -23, -15,
+  20, 4, 24, 4, -15, -28, 35, -82, 36, 50, 9, -15, -7, -29, 32, -21, 19, -19, 13, -43, 3, -42, 23, 0, 38, -81, -24, 2, 64, -32, 19, -100,
+  -17, -54, 68, 25, -35, -75, -5, -57, 20, 73, 27, -57, 2, 7, 37, 93, 18, -19, -16, -1, -26, 59, 38, -37, -10, -14, 11, 97, -31, -44, 11, -47,
+  15, 38, -46, -3, -4, -20, 29, -8, -60, -12, -22, -23, 18, 40, -29, -10, -28, -61, 73, -38, -44, -31, -21, 5, 43, -24, -12, -61, -14, -7, 67, 66,
+  -47, -15, 18, 18, 72, 63, -11, 17, -20, -39, 37, 74, -29, -26, -24, -2, 31, 32, 8, -27, -46, -36, 0, 60, -3, -1, -73, 24, -23, -1, -20, 26,
+  -63, -7, -2, 70, 14, 31, -33, -22, 50, 17, -30, -34, -28, 18, -16, 40, -10, 35, -11, 9, -27, -38, 65, 25, 38, -30, -54, -64, 5, -16, 27, -8,
+  23, -58, 76, 33, 1, 1, -62, 14, 20, -32, 26, -15, -14, 45, 79, -54, 7, -60, -54, -21, 3, -9, 23, -56, -19, -12, -3, -86, 22, -89, -53, 56,
+  56, -63, 61, -63, -40, -5, 16, -56, 14, -113, 11, 21, -18, 5, 21, -126, -57, 0, -45, -23, 9, -52, 26, -11, 42, -18, -27, -85, 5, -13, 16, 0,
+  -22, -7, -22, -18, -19, 20, 2, -38, -5, -69, 14, 44, 22, -48, 30, 17, -17, 12, 21, -17, 16, 4, -43, 31, 39, -45, 44, 28, 20, 19, -22, -49,
+  27, 20, 49, -26, -38, -69, 3, -15, -2, 33, -43, -38, 11, -16, -28, 66, 4, -70, 14, -38, 17, 28, -7, -47, -2, -77, -11, 87, 45, 43, -3, -89,
+  -11, 69, 14, 40, 10, -66, 14, 101, -32, 34, 16, -37, -45, 13, 34, 2, 16, 19, -7, 58, 46, 3, -2, -62, -13, -13, 37, 31, -22, -55, -38, 48,
+  41, -15, 50, -85, -26, 33, -19, -12, 55, -12, 32, 0, 12, 59, -22, -46, -8, -31, 0, 24, 38, 4, -1, 7, -16, 36, 15, 26, -26, 28, -18, 8,
+  24, 33, -31, 1, -42, 52, -22, 25, -57, 13, 0, 22, -32, 8, -35, 71, 9, 36, -64, 9, -64, 98, -57, 22, -62, 19, -70, 42, -6, 59, -38, -14,
+  -48, 41, -3, 32, -110, -40, -52, 10, -31, -35, 4, -31, -44, -92, 3, -48, -9, -44, -57, -11, -4, -12, 7, -22, -64, -14, -49, -27, 7, 54, -81, -40,
+  47, -23, -34, 67, -58, -56, 18, -29, -9, 90, -93, -75, 54, 18, 78, 101, -94, -62, 52, 42, 106, 15, -104, -8, 89, 3, 44, -23, 27, -12, 5, -16,
+  7, -23, 20, -15, 21, -52, -18, -36, -50, -40, 13, 35, -13, 3, -23, -15, -25, 44, 77, -13, -40, -14, 8, 14, 32, 20, 22, -31, 27, 13, -10, -39,
+  -34, -42, -30, -24, 28, -20, -27, -47, -27, -36, -10, -109, 2, -67, -33, -13, 75, -85, -7, -13, -6, -6, 16, -91, -32, -44, -68, 38, 80, -62, 14, -68,
+  -68, -45, 34, -16, -81, -80, -23, -10, 42, 17, 6, -87, -44, -11, 63, 12, -47, -24, -63, 47, 70, 18, -9, -97, -41, 21, 20, 55, -56, -122, -37, 10,
+  33, 2, -5, -79, -30, -38, 47, 83, -44, -2, 22, -62, 48, 51, 34, -53, -9, 8, 4, 2, -26, -82, 58, 16, -8, 19, -17, 18, -46, 19, -58, 8,
+  -13, -20, 10, 11, -85, -40, -101, -12, -36, -40, -20, -33, -50, 18, 28, -70, -16, 31, -106, -84, -53, -5, -8, -43, -112, 17, 37, 35, -5, -107, -42, -57,
+  -33, 61, -6, -87, -66, -53, -6, 26, -29, -19, -36, -8, 4, 30, -15, -65, -1, -38, -9, 40, -4, -45, -21, -72, -6, 71, 22, -32, -41, -24, -53, -11,
+  -50, -55, -9, -86, -57, 15, -48, -38, 26, -72, -23, 17, 19, 35, -38, -47, -40, 19, -29, 23, -24, -19, -33, -12, 31, -16, -30, -26, -48, 30, -22, 54,
+  48, 31, -66, 20, 36, 3, -11, -2, -71, 49, 4, -13, 30, -51, -82, 17, 1, 50, 16, 32, -76, -23, 1, -10, 41, 17, -45, -10, -3, 25, -9, -66,
+  -37, -22, 1, 17, 61, -24, -23, -5, -17, 30, 22, 9, -6, -32, -29, 23, 33, 27, -56, 9, -5, -24, -62, 15, -14, 18, 42, 59, -5, -34, -74, -66,
+  -6, 60, -8, -18, -4, -13, -10, 97, 16, -30, 22, -63, -4, 74, -22, -39, 1, -54, -7, 24, -24, -21, -48, 13, -26, 106, 19, -22, -4, 4, -22, 59,
+  19, 26, -67, 19, -34, 44, -9, -24, 3, 37, -20, 50, 24, 10, -81, -17, -48, 61, -40, -14, -71, 38, 37, 127, -38, -6, -8, 50, -50, 105, -6, 14,
+  -37, -18, -47, 96, 50, -11, -74, 22, -38, 122, -5, -8, -51, 13, -4, 68, 49, 13, -40, 34, -64, 49, 16, 24, -18, -9, -104, 71, -8, 55, 20, 63,
+  -3, 83, -31, -17, 15, 44, -10, 121, 15, 35, 8, 13, 24, 0, -17, -38, 36, -30, 6, -89, 5, -68, 35, 26, 20, -32, 67, -49, -21, -59, -54, -44,
+  56, -17, -10, -88, -30, 5, -3, -4, 41, -19, 10, 38, 29, 38, 24, -46, -64, -33, 19, 41, -50, -55, -6, 47, 54, -11, 26, -97, 27, -41, 9, -1,
+  -49, 10, 39, -4, 44, -20, -22, 11, 54, 14, 63, 26, -23, -35, 0, 21, 92, 41, 55, 29, -4, -43, 104, -5, -30, 7, -37, -17, 41, -12, -43, 46,
+  -91, 59, 100, 19, -38, 36, -70, 13, 52, -30, -25, 6, -44, 2, 71, -21, -1, 20, -6, -34, 71, 50, 45, -30, -29, -18, 71, 23, -5, -61, -93, 17,
+  60, 37, 14, -40, -29, -59, 37, 43, 52, -68, -39, -72, 5, 11, 12, -19, -25, 1, 3, 75, 93, 13, -52, 65, -11, 90, 86, -34, -76, 51, -11, 46,
+  38, -29, -57, 19, 35, 80, 36, -60, 8, -10, -2, 124, 16, -43, -64, -14, -1, 65, 28, 31, -81, -22, 73, 89, 84, -1, -33, 22, 30, 40, 47, -33,
+  -49, -16, -18, 92, 90, -20, -24, 41, 8, 67, 111, -4, -38, -8, 16, 30, 91, -26, -26, 44, 42, 28, 100, 29, -91, 92, 40, 60, 58, -33, -49, -6,
+  2, -5, 26, -29, -62, 74, -7, 50, 5, -11, -13, 40, 62, -29, -22, 59, -54, -15, 23, -17, -23, -8, -5, 67, -26, 11, -29, -5, -29, 97, 27, 25,
+  57, -14, -7, 31, -45, 27, 65, -13, -53, 58, -57, 8, 58, 0, -1, 94, -18, 96, 31, -14, -4, 44, -3, 77, 36, 8, 4, -20, -87, 54, -2, 38,
+  -25, 14, -30, 23, 9, 36, -34, 40, -52, 1, -2, -12, -9, 34, -14, -7, 72, 8, -25, 64, 39, -12, 23, -46, -20, 44, -26, -77, 8, -12, 46, 55,
+  -41, -26, 10, 45, 60, 49, 15, -25, -5, 51, 10, 88, 48, -31, -6, 14, 36, 95, 42, -1, 20, -5, 32, -47, -1, -45, -14, -15, -52, -73, -3, -113,
+  -36, -28, 7, -103, 53, -15, -23, -87, 34, -55, 47, -54, 50, 1, -50, -56, -18, -10, -6, 6, -18, -91, 30, -41, -20, 9, -30, -72, 24, 32, 0, 23,
+  1, -17, 34, -9, 29, 18, 18, 43, -49, -14, 33, -5, -27, 71, -13, 27, -15, 18, -17, 91, -30, 23, -34, 17, -10, 8, 42, 51, 48, 44, -45, 28,
+  34, -47, 27, -5, -47, 25, 11, 23, 14, -31, -60, -79, -6, -43, -44, -15, -39, -63, 35, -69, -55, -36, -47, -38, 43, -19, 44, 3, -27, 71, 31, -51,
+  49, 29, 25, 53, 61, -48, 37, -4, 61, 70, 28, -59, -53, -34, 1, 42, 7, -49, -27, 36, 31, 76, -7, -9, -21, 6, -7, 97, -6, 4, -10, 27,
+  -2, 33, -5, -45, -10, -4, 24, 52, 51, 3, -50, -8, -41, 14, 48, 11, -54, -22, -11, 56, 20, 46, -33, -31, -9, 57, 25, 26, 25, -44, -18, 50,
+  -18, 20, -1, -44, -46, 26, 34, -2, -15, -48, -15, 12, 54, -4, -42, -34, 11, 28, 61, 40, -33, 6, -6, 10, 54, 53, 10, 35, -31, 45, 60, 20,
+  35, 1, -47, 44, -10, 20, 10, -24, -14, 3, 10, -18, 2, -22, 22, 24, 3, 30, -19, 1, -4, -31, 6, -18, 46, -36, 30, 12, -39, 26, 19, -58,
+  -12, -37, -5, 51, 26, 3, -2, -44, 41, 25, -9, -48, -18, -26, 24, 67, 16, -30, 33, 26, 13, 17, 44, -18, 5, 32, 30, 15, 16, -7, -28, 21,
+  18, 16, 13, 8, 11, -11, 17, 9, 62, -2, 22, 37, -2, 42, 8, -35, 43, -24, 17, 10, 74, 20, -3, 10, 56, -13, 53, 15, 30, 27, 68, 18,
+  -34, -26, 17, -100, -29, 36, -55, -24, -7, -54, 16, 8, -54, -41, 23, -33, 4, 50, -28, -64, -7, -33, 20, 37, 10, -33, 34, 7, 44, 11, 11, -63,
+  -31, 27, -8, 35, 12, -15, -54, 11, -27, 23, -18, -48, -58, 49, -63, -1, 17, -57, 9, 62, -53, -20, 11, -31, -39, 65, -5, -18, 35, -53, -18, -22,
+  -10, -29, -32, -53, -29, 20, -56, -29, -5, -46, -5, -55, -40, -39, 68, -79, -22, 5, 35, -31, 46, -83, 9, 18, -5, -24, 19, -68, -40, 45, 2, 18,
+  22, -55, -16, 5, -2, 4, 71, -50, 3, -8, -73, -40, 66, 3, -29, 5, -39, -21, 46, -14, -8, -17, -5, -22, -29, -63, 17, 21, -64, 6, 9, -39,
+  -25, -21, -14, -27, 15, -16, 7, -33, -57, 7, -7, 3, -31, -17, -17, -17, -28, 32, -42, -10, -4, -32, 0, 31, -29, 16, -25, -39, -15, -4, -13, -38,
+  -28, -7, 28, 0, -33, -30, -43, 5, 23, 6, 23, -58, -55, -26, 42, 37, -45, -56, -40, -18, 47, -7, 14, -50, -26, -35, -30, 13, -48, -8, 22, -80,
+  39, 31, -26, -24, -40, -34, 13, -2, -49, 40, -11, -98, -12, -15, -39, -5, 6, -68, -13, 23, 5, -5, 27, -95, 38, 23, -25, 4, 21, -97, 35, -9,
+  -46, -14, -20, -96, -18, 18, -84, 9, -12, -95, -25, -12, -29, 34, -23, -29, 17, 1, -25, -10, -47, -63, -27, -44, -40, -31, -12, -27, -8, 18, -32, -64,
+  -29, -37, 12, -13, 2, -24, -59, -2, -16, 4, 21, -83, -36, 0, -11, 58, -33, -92, -5, 20, -11, -8, -25, -70, 15, 9, 44, 30, -35, -49, -17, -22,
+  15, -12, -7, 20, -24, -44, -28, 21, -18, -3, 13, -34, -34, -10, -21, -36, -34, 11, -43, 25, 27, -25, 26, 33, 0, -22, 1, -27, -14, 39, -67, -19,
+  -58, 37, -45, -1, -10, -26, -51, 58, -53, 9, -34, -7, -14, 69, -9, -1, -21, 11, -34, 7, -57, -10, 26, -15, 15, 25, -18, -4, 37, -7, 5, 15,
+  -40, 12, 25, 36, -35, 21, -3, 8, -19, 23, -51, 2, 6, 45, 11, 27, -32, 44, -42, 8, -17, -6, -6, 9, -66, 15, 14, 20, 2, 80, -69, 15,
+  28, 67, -15, 67, -66, 40, 40, 56, -20, 35, -8, -13, 15, 17, -39, 55, -83, -38, 27, 49, 9, 24, -44, -62, 13, 67, 30, -9, -45, -64, -27, 51,
+  1, 25, -40, -55, -67, 37, -23, 16, -50, -49, -55, 55, 11, 35, 13, -6, -20, -17, -26, 39, -46, -39, 30, 24, 21, 55, -9, 2, 12, 29, 24, 7,
+  -12, -45, -20, 43, -17, 83, -15, -13, -34, -2, 5, 88, 18, 4, -46, -5, -36, 62, -27, -40, -31, 13, 33, 64, -26, -12, -15, -12, 27, 95, -32, -1,
+  -21, -5, 24, 92, -10, -33, 20, 26, 36, 29, 12, 43, 22, 47, 60, 63, 16, -4, -2, 6, 56, 18, 37, -6, 24, 16, 34, 21, 46, -8, -23, 21,
+  33, 70, 19, -80, -22, 0, 26, 125, 84, -25, -10, -53, -17, 124, 3, -46, 15, -4, 64, 114, 57, -56, -19, -37, 61, 99, 37, -22, -62, -9, 43, -14,
+  -10, 34, -29, -32, 76, 2, 2, 28, 9, 14, 38, 53, 29, -11, -41, -44, 54, 5, 66, -27, -29, -28, 12, -1, 38, 48, 16, 58, 10, -38, 22, -1,
+  30, -1, 11, 34, 38, 4, 14, -6, -17, 34, 29, -3, -11, 28, 58, 58, 3, 7, -30, 38, 24, 31, 18, -6, -67, 18, -2, 2, 55, -49, -15, -2,
+  10, 61, 25, -23, 3, 19, -9, -34, -20, -48, 15, -6, 19, 35, 33, -28, 2, 15, 21, -32, 18, -8, -38, 40, 33, 33, -1, -33, 7, 18, 37, 12,
+  -26, -21, -28, -25, 11, -5, 26, -6, 14, -46, 12, -105, 83, -26, 34, -13, 21, -81, 69, -18, 7, -11, -6, -38, 76, 28, -10, -30, 13, -26, 58, 34,
+  -5, -26, 21, -26, 54, 53, 2, -27, 23, -63, 34, 60, -8, 52, -16, -2, 75, 11, 7, 0, -35, -79, 109, -5, 63, 32, -38, -53, 44, -14, 59, 15,
+  -5, -127, 58, 15, 72, -7, -12, -109, 40, 17, 35, -37, -37, -52, 72, 12, -62, -10, 28, -40, 18, -122, -26, 8, 12, -8, 23, -54, -50, -1, 34, 25,
+  0, -91, 28, -4, 19, 12, -18, -43, -29, -35, 2, -11, -28, -35, -51, -19, -7, -30, -10, -88, 24, 15, 35, -25, 0, -50, -21, -60, 23, 18, -28, -78,
+  -20, 5, 27, -22, -2, -13, 1, -40, -19, -25, -18, -19, -8, -11, -5, -42, -14, -62, 30, 27, 47, -5, -6, -25, 66, 16, 37, -12, -12, -38, 23, 29,
+  13, -85, 14, -22, 52, -15, -2, -60, 59, 5, 27, -38, -33, -99, 32, -35, 15, -6, -21, -42, 28, -9, -10, 51, -51, -47, 30, -44, 0, -2, 7, -102,
+  80, -56, 2, 14, -45, -89, 42, -2, -6, 13, -9, -83, 5, -55, 11, 48, -34, -15, 23, -34, -4, -23, -15, 42, -47, 20, 12, 41, 49, -18, -25, -9,
+  31, -12, -13, 18, -35, -50, -3, -9, 15, -66, 9, -20, 2, -8, 9, -97, -1, -30, 53, -7, 21, -64, -8, -30, 25, -28, 3, -51, 5, 14, 45, -51,
+  59, -62, 52, -2, -44, -45, 27, -80, 39, -10, -74, -30, 30, -105, 16, -14, -61, -8, 31, -60, 40, 50, -24, -36, 40, -47, 69, 8, -73, -54, 51, -91,
+  66, -1, -65, -20, -4, -80, 71, -19, -27, 8, -14, -41, 44, -21, -22, -62, 35, -32, 15, 0, -14, -18, 12, -22, 41, 7, -27, -6, 2, -24, -26, -42,
+  -8, 19, 73, -28, 1, -56, -23, -60, 80, -108, -21, -11, -13, -46, 54, -127, 23, -39, -60, -52, 4, -87, 29, -10, -47, -12, 7, -45, 0, -35, -55, -6,
+  7, 19, -8, -45, 7, 14, -39, -10, -35, 19, -15, -20, 27, 52, -46, 19, -54, -18, 40, 44, -15, 30, -50, -8, 17, 49, -44, 3, -1, -33, -7, 30,
+  1, -33, -46, -17, 6, 5, -23, 24, -74, 26, 16, -2, -40, 27, -23, 41, -29, -52, -16, -23, 15, -10, -8, -17, 7, 12, 18, 0, -2, -8, 27, 9,
+  13, -9, 10, -4, -15, -56, -45, -23, -1, -13, -10, -21, -17, -19, -7, -56, 1, -25, 26, -47, -9, -12, -33, -6, 10, -14, 2, 59, -38, -12, 7, -5,
+  -27, 28, -22, 24, 26, -46, 26, 34, -29, -5, 30, -8, -25, 2, -44, 39, 46, -6, 3, -5, -13, 54, 56, -50, 47, 26, -29, 37, 4, -61, 13, 45,
+  -34, 56, 59, -35, -4, 45, -75, 38, 70, 1, 23, 15, -101, 17, 39, 30, 75, 30, -97, 21, 18, 49, 22, 23, -46, -8, 51, 13, 51, -9, -83, 35,
+  16, -52, 26, 29, 3, 3, 19, 24, 48, -22, 32, -18, 48, 21, 13, 34, 19, -19, -2, 50, -33, 31, -74, 32, 40, 36, -65, 53, -67, 33, -4, 61,
+  -70, 25, -21, 31, 28, 44, -61, 41, 6, -16, -20, 39, -55, 32, -46, 44, 26, 38, -7, 106, -28, 19, -15, 58, 13, 97, -43, -11, -58, -15, -33, 62,
+  16, 6, 4, 39, -10, 45, -15, -24, 0, 15, -16, -2, -20, -66, 29, -30, -10, -3, 22, -61, -17, -17, -18, -31, -29, -48, 53, 14, 3, -17, 28, -18,
+  26, 22, -34, -25, -20, -19, 2, -21, -49, 23, 21, -63, -21, -18, -23, -7, -2, 1, 0, -56, -12, 34, 37, -49, -16, -51, -2, 59, -16, -14, 38, 23,
+  9, 43, -48, 21, 41, -44, 3, -26, -43, 44, -4, -7, -37, -1, 6, -25, 21, 14, -30, 22, -40, -37, 15, -10, -35, 27, -26, -11, 30, -37, -56, 49,
+  -53, 6, 12, -45, -1, 11, -72, -39, 6, -41, 17, -43, -79, 33, 8, -43, 0, -44, -50, 34, -13, 9, 8, -19, 29, 58, 27, 20, -14, -88, 25, -11,
+  -24, -4, -35, -48, 45, 20, 35, 7, -15, -8, 55, 21, -32, 29, -40, -59, 15, -19, 9, 29, -49, -47, -16, -34, -55, 40, -49, -75, 37, 14, -44, 31,
+  -45, -53, -1, 29, -6, 25, -22, -42, 47, -30, -57, 36, -38, -32, 36, -15, -60, 25, 0, -9, 84, -65, -38, -28, -60, -46, 50, -51, -34, 19, -63, -30,
+  27, 8, -11, -9, 0, -58, 52, -7, 26, 3, -56, -20, 21, -35, -15, -32, -6, -69, 22, 1, 9, 29, -37, -34, 29, -46, 20, 45, -55, -10, -19, 7,
+  -5, -34, 18, -31, 7, -32, -2, -35, -1, -20, 1, -43, -61, -5, -19, -51, -18, 7, -10, -10, 43, -21, -5, -14, -39, -3, 0, -14, -23, -44, -22, -11,
+  12, -70, -4, -16, 9, -22, -40, -50, 63, 35, 5, -45, -31, -59, 8, 0, 8, -43, 40, 0, 3, -11, -17, -42, 34, -31, -58, -14, 37, -31, 35, -15,
+  1, 34, 36, -22, 5, -30, 18, 3, 26, -48, 17, -1, -42, 23, 52, -49, 32, -29, -15, 12, 49, -2, -51, -22, 4, 57, 22, 41, -17, -19, -51, 35,
+  20, 33, 14, -38, -52, 37, 18, 25, 19, -18, -33, 48, 19, 17, 20, -42, -11, -7, 49, -32, -15, -17, -47, 37, 21, 12, 20, -50, -22, 9, 59, 13,
+  36, 25, -48, 42, 4, 23, 19, 55, -45, 37, -9, 15, 27, 53, -61, 15, -10, 82, 21, 42, -40, -16, 4, 53, 23, 60, 0, 14, -38, 43, 8, 8,
+  -68, 30, -20, 30, -51, -17, -65, -27, -24, -5, -40, 23, -29, 0, -32, -53, -21, -26, -99, -39, 25, -51, 6, 16, -18, -4, -23, 0, 65, 80, 35, -43,
+  53, -51, 37, 1, -7, -60, 19, -34, 27, -3, 35, -35, -22, -30, -14, 10, 31, 24, -28, -41, 28, 58, 42, 5, 23, -55, -19, 42, 42, 0, 44, 13,
+  -5, 43, 33, -31, -14, -33, -65, -3, 21, 1, -4, 12, -50, 20, 46, -16, 53, -52, -63, -11, 51, -56, 47, 25, -70, 5, 5, -51, -19, -12, -24, -9,
+  43, -27, 6, 4, -33, -3, 32, -27, -28, -56, -67, 13, -42, -38, 27, -55, -8, -29, -25, 6, -23, -33, -76, 44, 4, 26, -27, -27, -40, 33, 32, -56,
+  -24, -73, -47, 34, -15, -16, -4, 14, -33, 17, 0, -38, -7, -13, 24, 44, 4, 43, 28, 16, -28, 10, -6, 35, 15, 38, -12, -11, 40, -3, -37, 86,
+  66, -46, 1, -11, -35, 4, 24, 24, 26, 1, 30, 67, -20, -14, 58, 0, 47, 75, -10, 9, 55, -28, -6, 74, 15, -26, 6, 61, 39, 37, -38, -50,
+  33, -23, 39, 101, -24, -20, 77, -58, -127, 24, 5, 2, 51, 1, -72, 59, 6, 23, 72, -50, -112, 11, 24, -9, 21, -18, -71, 62, -22, 19, 13, 13,
+  -59, -14, -22, 30, -7, -22, -43, 47, -22, -42, -15, 47, -58, 5, -82, 46, -12, -7, -31, -9, -91, -12, -58, -27, -51, -31, -66, -26, -18, -80, -21, -9,
+  -22, -26, -28, -92, -48, -39, -32, 23, -9, -91, -28, 3, 49, 9, 6, -31, -19, -26, -5, -17, -5, -24, -41, -49, 11, 0, -6, 5, -13, -18, -7, -56,
+  -41, -39, -34, -69, 3, -36, 25, -15, -1, -79, 34, 8, -15, -20, -14, -66, -24, 50, 43, 18, 39, -28, 7, 68, 24, 6, 60, -1, 44, 67, -4, 13,
+  4, -10, 21, 63, -1, 27, 35, 53, -7, 17, -31, 29, -3, 23, 18, -19, 29, 59, -2, 26, -25, 33, 49, 9, 22, 51, 19, 11, 5, -11, 6, 36,
+  17, -10, 35, -45, -56, 14, 6, -19, 49, -46, -71, 16, 23, 42, 46, 15, -49, 20, 4, 40, -12, -21, -58, 50, 21, 5, 46, 12, -82, 16, 70, 42,
+  -40, -25, 5, -18, 46, -6, 2, 18, -55, 43, -27, -3, 87, -54, -20, 56, -15, -26, 70, -44, -53, 31, -19, -11, 34, -33, 25, -36, -9, -32, 30, 25,
+  38, -39, -79, -33, -52, -30, 26, -32, -67, 48, -32, -29, 5, -19, -65, 35, -16, -66, -5, -39, -23, 32, 29, -40, -21, -32, -72, 23, 34, -22, -26, -23,
+  -16, 24, -25, -61, -29, -66, -56, 11, 50, 1, -19, -22, -75, 40, -21, -4, -68, -17, -89, -34, 48, 11, -88, -122, -13, 23, 18, -40, -19, -87, -37, -9,
+  -28, 43, -64, -28, -89, -61, -2, -14, -50, -58, -33, -5, -19, 5, 17, -8, 4, -5, -15, 7, -20, -56, 27, -8, 3, -55, -48, -30, 13, 28, -31, -71,
+  21, -7, 15, -18, -30, 22, -16, -7, -10, 60, 34, 16, 2, 36, 5, -31, -26, -25, -29, -18, 22, -41, -28, -41, -33, -14, -2, -37, -12, 63, -44, -36,
+  15, -37, -5, -3, -1, 32, -43, 7, -52, 39, -81, -37, -11, 5, -50, 38, -107, 49, -41, -46, -63, -13, -99, 4, 25, 6, -30, 39, -31, 53, 33, -14,
+  -8, 50, -72, 64, -6, 28, -30, 50, -84, 17, 33, -34, -29, 10, -64, 39, -1, -31, 2, 41, -63, 21, -4, 40, 60, -2, -62, 44, -43, -2, 10, -65,
+  -75, -7, -29, 9, 52, -41, -39, -16, -92, 6, 95, -56, 7, -77, -93, -17, 71, -40, -30, -66, -125, -36, 50, -38, -31, -42, -79, 9, 8, 21, -64, -81,
+  -12, -39, -45, 27, -50, -26, -37, 2, -20, -15, 9, -11, -29, -7, -25, -22, -4, -15, 12, -11, -62, 20, 10, -19, -6, 26, -74, -19, -2, -50, 29, -20,
+  -94, -64, 25, -21, 34, -41, -79, -54, 52, -51, 66, -32, 8, -76, 19, -58, 19, -59, -15, -44, 0, -102, 23, -40, -10, 14, -20, -97, -52, -10, 42, 17,
+  -10, -62, -28, 32, 17, 11, 23, -66, 25, 0, -8, -8, -17, 14, 37, 5, -62, 8, 17, -15, -10, -32, -23, 12, -13, 2, 17, -52, -63, -39, -4, 40,
+  55, -51, -10, -28, 32, 16, 4, -26, -66, 15, -31, 32, 92, -5, -22, -53, 23, 20, 23, 18, -21, -37, 13, 4, 7, 9, -30, 59, 18, 23, -17, -36,
+  -24, 24, 9, -10, 0, -15, 6, 14, 42, -9, 44, -28, -33, -5, 16, 24, 39, -42, -57, 27, 16, 49, 27, -65, -66, -13, -28, 80, 34, -29, -40, 62,
+  8, 59, 47, -32, -47, 28, 12, 64, -11, 30, -29, -18, -19, 69, 11, -5, -63, 31, -22, 35, -19, 22, -49, 15, 49, 21, 35, -36, -14, -36, 25, 55,
+  -18, -55, -45, -33, 36, 53, -43, 21, 42, 31, 17, 21, -72, -45, -9, 5, 20, 7, -69, -25, -29, -70, -7, -8, -16, 2, -7, -52, -5, 18, 37, -22,
+  15, -119, 12, -30, -36, -22, 27, -88, -11, -93, 5, 34, 6, -15, 41, -113, -40, -36, 44, -68, 16, -92, -38, 14, -39, -29, 70, -36, 9, 47, -13, 35,
+  11, -16, 21, 27, -18, 52, 43, -58, 55, 44, -12, -6, -11, -7, -19, 9, -83, -7, 0, -61, -4, 50, -97, 31, -22, 39, 68, -56, -30, 54, 53, 30,
+  21, -30, 49, 98, -2, 8, 24, -70, 5, 54, -5, 74, -72, -47, 14, 12, 47, 52, 11, 1, -9, -24, 20, -10, -57, 3, -12, -10, 37, 1, 9, -8,
+  14, 9, -33, 67, -28, -46, -54, 68, 19, 65, -16, -12, -22, 20, 12, 27, -6, -27, -14, 70, -1, 49, -8, -28, 28, 16, -1, -22, 34, 52, 27, 50,
+  -27, 25, 1, -9, -29, 23, -41, 19, 1, 16, -50, -34, -53, -8, -9, 45, -43, 65, -29, 37, -12, 38, -53, -21, 38, -9, 10, -32, 22, 7, -12, -63,
+  36, -3, -47, 16, -43, -43, 41, -32, -35, 7, -11, -69, 14, 17, 5, -21, 7, -26, 12, 12, -56, 14, 18, -22, 17, -43, 29, -24, 13, 0, 24, 5,
+  -33, -17, -22, -49, -46, -15, -29, 9, 41, 3, 29, -41, -33, -66, 6, -12, -6, -35, -70, 15, -30, -25, 28, 37, -49, 25, -1, -21, -54, 20, -46, -25,
+  -50, -9, -8, 93, -7, 13, -53, -4, -34, 43, -56, 26, -19, 7, -29, 51, -26, -84, -3, 21, -15, 20, -22, -24, -61, 1, -64, -6, -77, -90, -50, 7,
+  -24, -39, -44, -41, -10, -12, -10, -54, -42, -75, -44, -61, 8, 40, -27, -16, -7, 33, -61, 4, 0, -34, -44, -25, 18, 32, -7, -43, -15, 37, -25, -49,
+  17, 4, -68, 55, 5, 49, -29, 50, -89, 68, -67, 46, -30, 39, -46, 68, -69, 48, -36, 45, -19, 30, -69, 112, -88, -11, -60, 50, 11, 36, -20, 33,
+  -44, 25, 7, -28, 1, 30, -11, 0, 20, -22, 10, 14, -105, 10, -16, -37, -45, 10, -79, -22, 62, -69, -36, 17, -88, 13, 56, -34, -12, -12, -88, -3,
+  -12, -46, 38, -30, -95, -30, 9, -64, 29, -40, -35, 2, -8, 8, -9, -41, -49, -72, 0, 40, -54, -11, -23, -80, 35, -17, -17, 11, -28, -62, -11, 86,
+  -101, 7, -31, 8, -14, -10, -51, -26, -49, -39, 63, 36, -30, -43, -40, 58, -19, -30, -5, -36, -52, -16, 3, 63, -66, -75, -41, 9, 18, 33, -43, -20,
+  -24, -28, -12, 32, -31, -36, -41, -18, -42, 8, -4, -43, -13, -5, -25, 24, -4, -43, -79, 23, 32, 7, -26, -112, -54, 39, 5, -4, -56, -41, -19, 16,
+  -8, 44, -21, -47, -62, -6, 19, 70, -48, -57, 35, 42, 18, 63, 3, -58, -25, -4, 2, 1, 5, -40, 15, -46, 54, 17, 29, 6, 16, 29, 23, -2,
+  32, -10, -32, -42, 32, -47, -53, -50, 13, 23, -19, -13, -3, -31, 17, -20, 26, 21, -83, -60, 78, 1, 86, 45, -47, -74, -6, -69, -6, 27, 26, -116,
+  33, -38, 0, -18, 2, -89, 10, -5, 20, -21, -26, -85, -15, -47, -8, 5, 39, -14, 5, 1, -17, -70, 53, -11, -8, -46, -38, -45, -6, -55, 7, 60,
+  15, -55, 53, 0, 10, -3, 2, -107, 14, -57, 52, -62, 41, -65, 21, -83, 16, -11, 10, -44, -23, -18, -4, -9, -5, 5, 2, -74, 49, -29, -3, -11,
+  56, -24, -2, 18, 31, 6, 58, -99, 40, -31, 35, 54, 31, -75, -6, -7, 28, 34, -13, -72, 68, 22, 6, -5, 46, -44, 26, -23, -50, -4, 6, -39,
+  55, 30, -32, 31, 34, 15, 60, -15, -71, -15, -9, -80, 11, 19, 18, 14, 42, -19, 59, 47, 5, -20, 17, -78, 84, -2, 2, -18, -5, -50, 96, -16,
+  -7, -5, 6, -21, 27, -19, -28, 2, 72, -64, 43, 17, -5, -43, 34, -31, 22, -28, 22, -11, 51, -10, 77, 42, 57, 10, -14, 37, 50, 63, 46, -73,
+  59, -13, 68, 8, -23, -57, 39, -21, 57, 70, 19, 22, 18, 4, 31, 0, 21, -44, 32, -3, 115, 26, 5, -57, 61, 34, 113, -5, -19, -34, 74, 57,
+  32, 20, 25, -14, 1, 1, 75, -6, -49, -29, 21, -3, 31, -32, -15, -98, 0, -21, 72, -11, -32, -46, 17, 98, 112, -12, -16, -64, -9, 30, 17, 10,
+  4, -1, 38, 8, 33, 3, -36, -68, 24, 57, 60, -20, -23, -15, 30, 69, -31, 22, -16, -25, -2, 56, 6, -19, -67, -39, 41, 109, -77, -5, 39, -51,
+  27, 41, -52, 47, -24, 6, 16, 39, 70, -26, -39, 29, -56, 34, 69, -9, -28, 1, -41, 90, 79, -1, -32, 2, -32, 41, 82, -13, -82, -47, -61, 42,
+  98, -24, -9, 2, -29, -14, -1, -12, -5, 76, -76, 35, 68, -3, -37, -24, -25, 55, 39, -15, -36, 25, -16, 111, -37, 46, -73, 27, -24, 103, -5, 14,
+  -16, 24, 14, 35, 45, 12, -56, -18, 5, -23, 0, 50, 15, -81, -39, -15, -48, -2, -15, -66, -41, 19, -8, 36, -39, -95, -19, -1, 5, 60, 69, -28,
+  57, 53, -18, -16, 76, -17, 52, 1, 67, -63, 6, -30, 13, -36, 43, -16, -44, -31, 10, 31, 7, 8, 25, -39, 59, 49, 17, 31, 5, 2, 74, 42,
+  19, 32, 14, 49, 68, 92, -21, 10, -8, -6, 27, 91, -5, 6, -67, 8, 20, 15, -46, -12, -49, -37, -49, 15, -78, 25, -13, 2, 11, -6, -50, -62,
+  7, -9, -28, 7, -88, -32, 73, -28, 19, 46, -57, 49, 22, 46, 24, 67, -90, 11, 127, 14, 59, 81, -60, 91, 48, -6, 58, 103, -31, 5, 71, -26,
+  56, -127, -5, -15, 20, -47, -18, -112, -25, -38, 66, -25, -7, -103, -2, -11, 82, 25, 29, -80, -32, 10, 68, 5, 4, -62, -7, 9, 80, 46, 8, -43,
+  -2, -14, 34, 48, 45, -69, 10, -19, 51, -1, -11, -14, -2, -7, 44, 16, 21, -51, 19, 8, 34, -6, 21, -35, 40, 29, 17, 45, 10, -20, 7, -17,
+  40, 17, 31, -14, 24, 18, -20, 12, 23, -12, 30, 10, -7, 1, 34, 55, 40, 28, -62, 0, 5, 11, -21, -8, -39, -8, -2, -4, -3, 20, -24, -6,
+  48, 14, 35, 15, 13, -5, 49, -27, -19, -12, -16, -38, 59, -22, 17, -8, -27, -71, 0, -1, -7, -10, -22, -61, 70, 35, 2, 33, -22, -21, 26, 46,
+  -6, 59, -6, 6, 26, 15, 22, 46, 21, 5, 25, 21, 7, 19, -43, 12, 29, -5, 1, 21, -27, -33, 24, 11, 27, -43, 11, -43, 47, -11, 27, -40,
+  -13, 29, 2, -27, 51, -28, 38, 43, 4, -58, 19, -83, 15, 13, 20, -32, -79, -57, 3, 5, 12, -17, -56, -46, -67, 19, 41, -30, 3, -64, -25, 37,
+  -23, -6, -17, -7, -17, 52, -21, 7, -21, -3, 13, -1, -47, 51, 17, -21, 6, 31, 2, 15, 2, -21, 14, 14, -37, 43, -21, -39, 15, 20, -54, 12,
+  -4, 1, -2, -26, -6, -13, -16, 12, -4, -2, -8, -5, 15, -64, -28, -25, 14, -15, -16, -33, -20, -51, -34, 30, 12, -9, -45, -48, 18, -5, 13, -4,
+  -3, 0, 40, -24, 22, -25, -15, -16, 3, 2, 5, 13, -12, -54, -17, -14, 19, -9, -43, -47, -40, 13, 38, 1, -44, -4, 10, -3, 16, -20, -20, 14,
+  -12, -8, -20, 19, -5, -11, -6, 8, -4, 17, -44, -31, -26, 53, -13, -23, -45, -55, -8, 53, -42, -18, -71, -48, -15, 40, -25, 43, -72, -23, 34, 51,
+  12, -1, -87, 2, 1, 12, 18, 18, -93, -4, -21, 3, -12, -1, -96, -11, -29, 10, -35, -30, -41, -45, -38, -9, -2, 4, -47, -23, -34, -20, -8, -7,
+  12, -33, -1, -19, -23, -42, -16, -14, -40, -15, -17, -69, -31, -38, 8, -5, -37, -33, -27, -35, 19, 31, 6, 0, -39, -28, -18, 23, -3, -31, 14, 4,
+  -44, 13, -28, -17, -12, -9, 8, -18, 13, -21, -39, -10, 25, 22, -35, 0, -30, 38, 8, -32, -24, -44, -59, -14, -10, 11, -24, -37, -34, 20, 2, -4,
+  -42, 4, -31, -42, -25, -13, 25, -27, -2, -52, -38, -26, -1, 12, -52, -36, -5, 29, -14, -6, -44, -11, 21, -30, 4, 11, -91, -78, -14, -30, -23, 6,
+  3, -10, -25, 27, -25, 41, -3, 25, -42, 10, -18, 5, -18, 9, -56, 37, -23, -14, -7, 15, -38, -22, -10, -14, 10, 68, -1, 34, -22, 34, -13, 41,
+  -44, 13, -27, 1, 20, -8, -22, -6, -11, 2, 6, -4, -55, -3, -3, 22, 17, -1, -26, 38, 3, 60, 38, 27, -52, 36, -8, 32, 18, -7, -30, 39,
+  -41, 12, -7, -18, -27, -9, 9, 8, 24, -33, -11, 23, 5, -4, -15, -40, -55, -4, -27, 24, 33, -22, -24, 19, -3, 21, -30, -32, -32, -9, 1, 11,
+  24, -16, -48, 38, -16, -15, 0, -22, -21, 47, -38, 30, -9, -26, -22, 32, -18, -7, 29, -25, 1, 60, -51, 5, 10, 5, -21, 43, -12, 28, -13, 34,
+  -25, 17, -22, 28, 21, 32, -59, -26, -11, 6, 36, -17, -72, -2, -25, 25, 49, -30, -6, 20, 6, 10, 41, 11, 11, 25, 25, -20, 39, 21, -23, 46,
+  36, 17, 79, -33, -3, 22, -7, -20, 52, 2, 2, 25, 53, -30, -9, 19, 0, 2, 35, -44, 1, 12, 33, 10, -5, -47, 10, -19, -32, 49, 40, -49,
+  13, 14, 23, 33, -8, -67, 28, -5, -5, 33, 52, 10, 5, -30, 0, 29, 54, -17, 34, -59, -49, 61, 7, 30, 52, -13, -35, 19, -18, 45, 12, 34,
+  -66, 11, 43, 6, 38, 57, -21, 46, 30, 63, 0, 19, -50, 39, 18, 32, 39, 12, -15, 32, 49, 12, 52, 26, -50, 21, 26, 60, 1, 18, -58, -23,
+  55, 58, 48, 37, -79, -2, 37, 37, -4, 1, -82, 16, 14, 64, 44, -40, -47, 30, 46, 53, 36, -28, -35, 39, 21, 31, 32, -45, -51, 19, 42, 12,
+  -2, -23, -2, 3, -13, 28, 20, 16, -30, 0, 15, -2, 0, 22, 11, -3, 35, -16, -24, 9, -35, 1, -2, -19, -3, -33, 4, -3, 4, 2, -15, 8,
+  -41, 10, 38, -28, 32, -10, -3, -4, -23, 10, 31, -28, -28, -38, -7, -53, 8, -21, -20, 3, 30, -17, 32, 28, -12, -30, -3, 11, 33, -11, -22, -49,
+  3, -40, 22, 5, -2, -33, -33, -38, -4, 38, 9, -48, -18, 2, 28, -3, 7, 12, -51, -23, 15, -13, -31, 7, -35, -35, -7, -1, 3, -1, -31, -1,
+  3, -9, -22, 0, -36, 10, 27, -7, -25, 2, -35, 34, -8, -51, -11, 56, 3, 33, -16, -21, 33, 22, 0, -24, 35, 14, 19, 52, 20, -26, 24, 34,
+  48, 29, 3, -4, -30, -25, 0, 48, -1, 20, -45, -7, 33, 7, -41, 42, -28, -43, -31, 39, -27, -20, -11, -13, -19, 33, 15, 20, -7, -29, 20, 0,
+  -69, -29, -42, -76, -16, -103, -39, -40, -46, -6, 14, -96, -56, 1, 6, -44, 6, -93, -1, -18, -4, -52, -11, -25, -58, -53, 10, -28, 6, -84, -50, -53,
+  -18, -78, -29, -15, 17, -43, -4, -18, -7, -3, -40, -7, -16, -43, -11, -14, 3, -19, 28, -62, 2, -11, 4, -50, 48, 36, -28, 21, -17, -5, -8, 47,
+  -4, 65, 18, -7, 0, 50, 42, 5, 18, 1, -45, 4, 67, 27, 3, 20, -47, -35, 38, 40, -17, 55, -13, -57, -4, 23, -27, 13, -12, -45, 54, 48,
+  10, 10, 22, -37, -10, 0, -38, -24, 9, -2, 38, 31, 2, -15, 18, -63, -5, 54, -21, -14, -18, -3, 2, 42, -7, 34, 4, -6, -44, 83, -27, 2,
+  -39, 32, -25, 45, 3, 73, -28, 9, -35, 87, 35, 15, 34, -4, -17, 103, 39, 9, -24, 14, -41, 73, -1, -14, 56, 27, -43, 71, 37, 10, 24, -3,
+  -25, 26, 38, 2, -5, -12, -15, 86, 67, -5, 32, -60, -71, 78, 38, 50, 35, -9, -17, 78, -33, -55, -58, -1, -72, 49, -24, -44, -66, 61, -4, 37,
+  10, -62, -71, 38, -7, 77, -60, -46, -95, 72, -66, 24, -47, -58, -22, 61, -43, 48, -29, -36, -108, 55, -36, 79, -16, -42, -127, 32, -8, 86, 17, 0,
+  -108, 60, -80, 98, -50, -40, -97, 94, -29, 69, -31, -54, -35, 89, -41, 91, 9, -5, -58, 43, -61, 51, -41, -47, -4, 68, -72, 17, -14, -59, -72, 86,
+  -66, 24, -38, -5, -59, 119, -58, 55, -39, -15, -35, 91, -9, -17, -6, -3, -69, 90, -54, -5, -41, -32, -50, 25, -30, 18, -46, -7, -55, 11, -34, 22,
+  -24, -52, -58, 2, -52, 16, 41, -18, 5, 34, -59, -17, -38, -68, -52, 17, 14, 20, -20, -19, -83, 26, -32, -17, -27, -31, -74, -3, -16, -31, -34, -47,
+  5, -38, -33, 9, -11, -1, -59, -71, -22, 57, -50, -7, -60, -19, 15, 32, 6, -6, -41, 4, -8, 44, 8, -23, -22, -15, -13, 0, -19, 41, -45, -26,
+  -8, 22, -37, 13, -77, 6, 14, 30, -44, -3, -95, 28, -35, 41, -42, 24, -26, -19, -6, -20, 2, 23, -46, 25, -79, 11, -2, -14, -55, 20, -30, -48,
+  5, -1, 14, -41, -25, -1, -17, -1, -30, 4, 10, -30, -50, -38, -51, -20, -23, -19, -10, -4, -24, -25, 0, 8, -43, 56, -61, 41, -35, -6, 4, -9,
+  -56, 31, 7, 7, -43, 37, -51, 21, -33, -10, 13, 38, 51, 43, -31, -45, -18, -15, 46, 15, 3, -59, -72, -35, -8, -20, -34, -25, -40, 3, 29, -21,
+  -18, -10, -7, 96, -98, -7, 20, 17, 44, 78, -109, 44, -40, 61, 74, 76, -88, 30, -7, 21, 25, 56, -115, -6, -59, 76, 34, 35, -87, 33, -48, 72,
+  -7, 38, -45, 8, -56, 45, 61, 64, -61, 54, -30, 16, 14, 9, -58, 51, 10, 8, 77, 61, -75, 46, -53, -3, 65, 44, -61, -15, -51, 27, 26, 17,
+  7, 2, -60, 59, 38, 58, -9, 7, 0, 30, 9, 49, -18, -18, -18, 6, 40, 11, -20, -37, -28, 63, 59, 36, -29, 23, 11, 38, 83, 25, -58, 5,
+  -65, 16, -3, 13, -31, 51, 7, 70, 7, 36, -39, 65, -74, 40, 50, 49, -18, -5, -26, 8, 13, 8, -52, 41, -17, -20, -4, 75, -13, -5, -63, -4,
+  47, 60, -1, 28, -58, 1, 49, 35, -37, 0, -55, -31, 20, 78, -40, 36, -14, 15, 3, 17, -5, 2, -21, -19, 16, 36, -10, 7, -89, -55, -26, 48,
+  -2, 18, -72, -52, -28, 11, -6, 41, -46, -21, 41, 75, -22, 29, -9, -15, 40, 56, -40, 30, -38, -13, 46, -6, 21, 58, -68, 27, 2, 12, 1, 28,
+  -13, -6, -18, 3, -9, 97, -22, -6, -10, 23, -59, 51, -59, 31, 1, 51, -38, 53, 4, 38, -15, 39, -6, 40, -63, -12, -12, -18, -19, -12, -35, 17,
+  16, -28, -35, 23, -64, -11, -60, 52, -45, 14, -47, 16, -10, 50, -24, 7, -40, -28, -59, 40, -56, 9, -36, -34, -64, 26, -74, -13, -20, 18, -50, -3,
+  -64, 1, -6, -15, -49, -11, -63, 54, -21, 16, -55, -10, -21, -17, -15, 0, 1, 39, 32, -1, 53, 37, 25, 25, 6, -21, 48, -1, 20, 28, -15, 20,
+  4, 33, 7, -5, 12, 33, 51, -28, 8, 3, -1, -40, 36, -1, -44, 29, -23, -26, 53, 47, -6, -19, -36, -74, -10, 46, -33, 11, -27, -28, -9, 24,
+  15, -32, -37, -2, 20, 12, -28, 8, 31, -6, 38, 30, 0, -16, -53, -4, 7, 47, -3, -34, -46, -12, 1, 9, 10, -5, 15, 33, -41, 44, -18, 23,
+  15, -21, -42, -13, -42, -3, -6, -4, -19, -13, 11, -40, 12, -70, -37, 39, -34, -2, 33, -43, -56, 11, -9, -62, 28, 11, 31, 29, -26, -29, 39, -48,
+  28, 18, 28, -11, 11, -49, 4, 1, 2, -14, -18, -93, 68, 38, -27, -47, -11, -44, 44, 42, 38, -19, -7, -74, -3, 26, -16, -21, 16, -71, 36, 15,
+  42, 7, 54, -74, -16, 34, -19, -38, -15, -78, 34, 11, 0, -31, 7, -42, 25, 44, -30, -55, 32, -76, 37, 79, -11, -28, 36, -25, 5, 91, -22, 3,
+  14, -81, 3, 36, -48, -2, 41, -26, 29, -69, -59, 32, 21, -52, -15, -50, -77, 20, -2, -32, 4, -62, -73, 25, 10, -52, 2, -42, -12, -63, 13, -60,
+  -39, -55, -29, -7, 6, -54, -34, -39, 0, -16, -3, -36, 4, -35, -1, 4, -28, -51, 1, -12, -28, -37, -5, -1, -39, 31, -5, -37, 9, -13, 0, -2,
+  12, -58, 18, 24, -32, 19, -22, -16, -8, -21, -43, 9, 8, 33, -23, -68, -33, 3, 31, 46, -37, -57, 46, -4, 3, -9, -20, -42, 12, -2, 12, 9,
+  -38, -87, 13, -11, 4, -49, -28, -52, -42, -38, -8, -6, 7, -62, -62, -36, -22, -14, 33, -64, -14, 31, 18, -14, -12, -46, -29, 31, -6, -13, -15, -13,
+  -3, 19, -11, -38, 22, 28, -64, -2, 45, 9, 17, 26, -29, -24, -1, 10, 18, 4, -39, 18, 70, -40, 34, 48, -23, -6, 44, -39, 39, 32, -52, 27,
+  6, 9, 1, 9, -27, 16, 46, 26, -6, 11, 16, -20, 62, -10, 20, 28, 26, 7, 17, 27, 6, 9, -1, -3, -4, 4, -2, 22, 0, 11, -31, -62,
+  -51, 40, 21, -19, -23, -31, -29, -30, -17, 11, -58, -23, 15, -6, -28, 18, -18, -47, 31, -22, -12, 10, -5, -59, 16, -5, -21, 35, -12, -8, 3, -1,
+  -12, 22, -47, 5, -45, -9, -18, 13, 5, 34, 13, -1, -50, 39, -31, 30, 2, 21, -79, -22, 39, -19, -11, -16, -34, 3, 13, 5, 7, -5, -29, -6,
+  -11, -40, -21, -18, -36, -16, 21, -56, -6, -28, -35, -28, -14, -44, -6, -29, -37, -11, -16, -23, -19, 37, -5, 2, 12, -3, 7, 22, -59, 6, 12, 18,
+  7, 23, -86, -28, -25, -3, 38, 20, -55, 11, -30, 16, 19, -23, -31, -27, -63, 7, 7, 32, -35, -56, -61, 26, 9, -17, -13, -40, -60, -17, -18, 19,
+  -30, -75, -43, -3, 8, 70, -2, -46, 10, 1, 21, 84, -7, -43, 14, -18, -19, 27, -42, -41, -7, -9, 21, -6, -31, -10, -36, -35, -18, 6, 15, -56,
+  3, -28, -22, 9, -26, -54, 11, 9, -10, -10, -20, -57, -43, 60, -5, 23, -14, -13, -53, -7, -6, 40, -18, -23, -39, 13, -58, 46, -7, -67, -45, -2,
+  17, 19, -22, -38, -27, 4, 1, 50, -43, -83, 7, -12, 4, 21, -16, -69, 16, -6, 13, 36, -19, -87, 18, 18, -24, 3, -11, -68, -6, 38, -26, 18,
+  5, -51, -1, 74, -3, 20, -12, -41, 0, 52, -3, 30, 5, 8, 32, 3, -12, 36, -2, -8, -8, 43, 3, 3, 44, -27, -6, 3, -27, 5, 37, -31,
+  -23, 58, -19, 25, 58, -55, 12, 104, -19, -7, -25, 35, -16, 79, -33, -1, -1, 15, -27, 49, -34, -46, -8, 2, 10, 54, -38, 34, -25, -31, 21, 42,
+  -5, -61, -7, -8, -10, 1, -37, -65, -27, -28, 7, 24, -14, -54, -12, 2, -18, 49, 17, -93, 14, -25, -38, -17, -44, -58, -2, 20, -24, -12, 7, -66,
+  -37, 12, 23, 29, 6, 14, 11, -2, 36, 2, 17, -43, 24, -56, 53, -11, 12, 2, 30, -16, 40, 4, 2, -45, -18, -41, 8, -3, -10, 11, -7, -39,
+  47, -3, -32, -18, 37, -73, 32, -24, -17, 1, 18, -65, 46, -19, -9, 7, 15, -79, 22, -8, 18, -6, 37, -35, -25, -14, 13, -32, 26, -32, -22, 46,
+  -5, 1, -7, -64, 19, 39, 6, -38, 35, -42, 12, 19, -25, -1, -20, -25, 26, 64, 14, -3, -11, 6, -17, 64, 5, -27, 29, -21, 26, 50, 57, -35,
+  11, -12, -47, 0, 1, -49, 9, -34, -14, 34, -27, -49, -12, -38, 27, 32, -5, -66, -1, -64, -2, 100, -21, -28, -2, -27, -26, 30, -27, -60, 61, -100,
+  -32, -7, 18, -43, 54, -51, -10, -25, 3, -16, 19, -71, 16, 19, -49, -40, 26, -74, 55, 8, -26, -48, 67, -40, 43, -14, -32, -16, 84, -47, 57, -12,
+  -5, -19, 102, -20, 33, -5, 10, 7, 60, 10, 26, 5, 2, 20, 45, 5, 24, -22, 3, 33, 33, -24, 13, 13, 11, 49, 104, -37, 5, -1, 8, 53,
+  67, -48, 64, 36, 2, 4, 90, 8, 58, 25, 32, 34, 81, 9, 8, 48, 2, 50, 98, 0, 5, 7, 31, -46, 116, 17, -31, 32, 30, -5, 85, 9,
+  14, -12, 7, -1, 127, -25, 3, -27, 5, -35, 114, 3, 22, 6, 14, 8, 115, 8, 6, -8, 2, -25, 81, 9, 18, 23, 6, 19, 28, 4, 33, 39,
+  -22, 32, 40, -5, -46, 25, 45, 27, 61, 34, 1, -20, -9, -12, 68, -3, 7, 40, 16, 29, 72, -2, -35, -4, 26, 8, 62, 11, -45, -30, -26, -20,
+  -6, 3, -26, -19, 14, -59, -7, 1, 13, 21, 64, -79, 18, 35, -22, 61, 7, -98, -19, 34, 30, 7, 68, -43, 1, 31, 38, -14, 21, -25, 25, 33,
+  34, -3, 22, -28, 23, 52, 17, -8, -1, -56, 46, 60, 23, 50, -5, -42, 28, 18, 31, 25, -22, -37, 2, 27, 2, -33, 16, -10, -7, 0, -13, 15,
+  -5, 4, 7, 15, 15, 10, 1, -39, -3, 26, 53, 12, -4, -61, 43, -13, 14, -25, 5, -12, 44, -6, 19, -69, -33, -15, 48, 36, 14, -48, -17, -18,
+  -1, 64, 71, -42, -4, -35, 23, 70, -25, 55, -36, -77, 40, 83, -13, 6, -57, -92, 18, -3, -10, -19, 40, -79, 88, 28, 4, 10, 39, -24, 104, 34,
+  -27, -1, -8, -17, 35, -21, -3, -54, 10, -15, 42, 11, -16, -66, -7, -4, 94, 25, 32, -55, 6, -11, 12, -33, -34, -58, 18, 21, 47, -30, 20, 32,
+  17, -45, 6, 53, -10, -26, -31, -21, 57, -12, -38, -24, -28, -47, 0, 37, -31, -17, 0, -56, 41, 63, -6, 48, -9, -28, 32, 19, 13, 88, 42, -5,
+  -7, 90, 11, 25, -12, 16, 33, 27, -65, 3, 30, -23, -18, 14, -20, 11, 18, 17, 9, 37, 16, -25, 4, 32, -25, 1, 10, -12, 24, -18, 22, -17,
+  24, -26, -26, -62, 17, -2, -21, 21, 3, 27, -24, 21, 47, 27, 21, 63, -10, 22, 36, 57, -21, 18, 2, 61, -40, 55, 39, -27, -6, 12, -36, 50,
+  16, 1, -52, 32, -40, 62, 24, -45, -61, 69, -9, -11, -52, 4, -42, 41, 33, -32, -43, -15, -9, 17, 18, 60, 1, 9, -56, 50, -6, 39, -56, -50,
+  -87, -28, -39, 38, 10, -26, -76, -45, 27, 33, -57, -6, -71, -7, -7, 25, -40, -23, -64, -20, -12, 62, -51, 46, -26, 11, -17, 8, 9, 31, -68, -40,
+  -36, 66, 27, -29, -33, -57, -46, 44, -46, -50, -58, -21, -16, 37, 6, -46, -5, -14, 18, -11, -23, -94, -50, -44, 9, -1, -1, -14, 14, 36, 57, 30,
+  64, -6, -9, 13, 7, -7, -17, -54, -35, -6, 2, 51, -33, 5, -81, -39, 1, 39, 4, -54, -66, -27, 28, -17, 5, -11, -8, -13, -10, 0, 55, -45,
+  3, -19, -31, -14, 6, -50, -5, -84, 45, -32, 36, -5, -12, -30, -24, -58, 0, -28, -8, -113, 31, -40, 39, 7, -22, -46, -16, 7, 59, -19, -62, -37,
+  5, -50, -21, -56, 6, -31, 56, -104, 13, -69, 3, -24, -3, -18, 50, -49, -26, -59, -34, -54, -20, -40, -3, -57, 28, -4, 26, -110, 24, -18, 34, -7,
+  -15, -12, 22, -16, -33, 7, 14, 15, -7, -83, -34, -51, 42, 25, -16, -13, -49, -66, 48, -54, -14, 14, 5, -18, 45, -58, 29, -37, -52, -30, -1, -17,
+  27, -19, 41, -20, 2, -2, -31, -22, 13, -86, -6, -12, 14, -37, -5, -47, 30, 62, -7, -55, -41, -113, 63, 31, -40, -20, 36, -75, 43, 20, -8, -10,
+  -12, -41, -5, 1, -35, 31, 30, -44, 17, -8, 39, -23, 56, -95, -22, 33, -32, 10, -27, -45, -12, -27, -20, 8, 26, -58, 24, -34, 35, -55, -9, -23,
+  9, 40, -18, -21, 50, -62, -20, -6, 12, 2, 15, 15, -58, 4, 5, -10, 43, -52, -59, 8, 31, -28, 5, -67, -30, 39, 34, 0, 13, -82, -16, 59,
+  37, -27, -29, -22, -32, 43, 19, 9, 9, -50, -23, 106, 52, 3, -50, -74, -62, 105, 37, -27, -1, 11, -50, 64, 59, -13, -29, -28, -3, 41, 15, 87,
+  -46, -19, -56, 3, -4, 41, 32, 48, -18, -30, 22, 25, 28, -19, -39, 37, 58, 60, 42, 15, -5, 38, -6, 59, -36, 18, 15, 36, 64, 18, 26, 57,
+  -20, 55, 74, 28, -25, 36, 28, 70, 30, 45, -50, 5, -7, 54, 22, 61, -86, 52, -32, -2, 26, 23, -34, 9, 6, 24, 10, 24, -11, 14, 9, 37,
+  71, -15, -53, 28, 40, -18, -10, -7, -60, 17, 15, 32, -7, 42, -33, 10, -11, 6, 53, 68, 35, -33, 38, 21, 41, 7, -20, 31, 28, -27, 14, 60,
+  47, 55, -32, 44, 9, 67, 9, 27, -49, 64, -2, 76, 11, 20, -4, 82, 42, 44, -46, 60, -38, 15, 49, 23, -32, 14, 35, -34, 47, -27, 35, 51,
+  -28, 44, -21, 12, -15, 7, 26, 26, -31, -16, -26, -2, -34, -21, -21, -9, 11, 67, -12, 9, 48, 64, 2, 77, -52, 41, 33, 31, -62, 12, -37, 42,
+  -16, 41, -9, 50, -52, 36, -59, 36, -33, 35, 13, 60, -92, 17, 38, 84, -21, 35, -56, 58, -1, 66, -39, -11, -16, 38, 14, 42, -42, 10, 10, -1,
+  -36, 70, -12, 8, 6, 60, -51, 49, 35, -34, -5, 22, -55, 54, 34, -63, 5, -5, -127, 66, 39, -40, -17, -24, 6, 0, 65, -51, -46, -40, -6, -17,
+  35, 20, -42, -59, 0, -1, 75, -6, -26, -37, 59, 35, 57, 20, -44, -6, -10, -22, 52, 30, -49, 7, 2, -19, 79, -21, 25, 1, -17, 26, -3, -59,
+  0, -38, 6, -33, 57, -40, -19, -30, 54, 24, 2, -5, 0, -81, 31, 46, -1, -21, -48, -40, 12, -22, -32, -31, -59, -78, -11, 16, 20, -60, -34, -67,
+  -4, 7, -33, -23, -59, -17, 9, -37, 32, 51, -24, -50, -41, -16, -2, 59, -41, -57, -6, -15, -9, 45, -71, -5, -47, -20, -35, 1, -39, -40, -9, -17,
+  -23, 8, -84, -1, -41, 25, 30, -45, -24, -19, -9, -16, -21, -28, -79, -75, -3, -7, 7, 18, -60, -69, 41, -8, -31, -25, -48, -47, -6, -8, -72, 61,
+  -77, -86, 38, -18, -47, 31, -43, -78, -28, 36, 5, 31, -53, -23, 40, 28, -8, -17, -28, -94, -6, 31, -17, -46, -1, -29, -7, 39, -23, 11, 11, -39,
+  -39, -34, 34, 21, -13, -38, -45, -8, -32, -25, 5, -112, -70, -43, -18, -89, 43, -43, -64, -67, -49, -44, 1, 22, -43, -12, -55, -59, -40, -14, -23, 5,
+  -45, -18, -17, -18, 14, -30, -25, 1, -36, -36, -18, 37, -12, -28, -30, -20, -22, 9, -58, -18, 0, -87, 12, 20, -3, 36, -28, -83, 28, 32, 6, -8,
+  -61, -76, 53, 23, 29, -21, -13, -28, 13, 11, -18, -44, 11, -48, -8, 13, 1, -24, -37, -49, 18, -42, 10, -58, 4, 9, 50, -18, 8, -59, 30, -5,
+  57, -8, -16, -37, 11, -32, 21, 18, 10, -88, 32, 4, 28, -27, 14, -106, 7, -4, -6, 37, 4, -81, 23, 23, 10, 20, 16, -127, 27, 5, 24, 11,
+  57, -74, 41, -41, 11, -42, 63, -63, -13, -47, 47, 6, 40, -47, 46, -77, 25, 7, 49, -19, 13, -18, 35, -29, 55, -24, 19, -37, 24, -44, 23, -52,
+  7, -27, -12, -33, 6, -54, -20, 2, 41, -47, 55, -66, 3, 15, 12, -33, 3, -17, 22, 8, 12, 6, 17, -10, 20, 2, 0, -48, 27, 4, -6, 51,
+  3, -10, -57, -8, -75, 23, -15, 32, -36, -51, -26, 47, -13, 48, -36, -43, -35, -31, -13, 23, 0, -64, -21, -29, -35, 32, 1, -76, 2, -10, -8, 4,
+  -52, -15, 24, -54, -41, 12, -33, -6, -4, -12, -52, -10, 2, -34, -4, 15, 18, -7, 28, -17, 1, -8, 9, -21, 10, -13, -15, 3, 13, -14, -19, -45,
+  -24, 23, -4, -38, -19, -10, -17, 9, -21, -17, -22, -4, 31, -31, 18, -9, -45, -57, 76, -39, 0, -20, -5, 0, 54, -7, -17, -3, -9, 19, 40, -5,
+  -19, 11, -28, 21, 54, -2, 30, -12, -51, -17, 31, -14, 22, -53, -24, -52, 41, -1, -15, -3, -3, 5, -24, 14, -10, -35, -10, -22, 41, 8, -7, -27,
+  -30, -53, 2, 30, -18, -35, -12, -53, 24, 24, -4, -12, -39, -18, -2, 29, 9, -22, -24, -29, 4, 1, -10, -30, 0, -25, -12, -6, -8, 2, -60, 49,
+  0, -25, -11, 24, -38, 34, 43, -17, 37, 2, -34, 26, 23, 26, 21, 12, -31, 46, 7, -2, 43, 22, -25, 104, 30, 69, 2, 9, -41, 54, 28, 67,
+  -3, 20, -7, 82, -16, 4, 49, -24, -47, 43, 2, 27, 51, -7, -1, -6, 44, 29, 26, -37, -46, 1, 4, 13, 57, 24, -3, 39, 9, 18, 48, -1,
+  -18, 9, 37, 22, 40, 44, -18, 67, -6, 57, 63, 45, -9, 67, -19, 48, 44, -18, -47, 46, 2, 34, 2, 10, -36, 51, -19, 31, 48, -16, 38, 20,
+  18, 47, 30, 25, 12, 76, -27, 24, 71, 9, 6, 70, -16, 44, -48, -1, 43, -69, -30, -1, -45, -35, 30, -72, 6, -21, -46, 17, 5, -85, -22, -9,
+  -38, -6, -9, -71, 61, -15, -53, 47, 29, -70, 20, 2, -3, 4, -45, -61, 31, 2, 1, 25, -49, -56, 46, -38, -38, 20, -40, -49, -8, -55, -28, -20,
+  5, -37, 25, -59, -29, -25, 5, -83, 57, -32, 32, -22, -30, -36, 9, 11, 17, 31, 18, -59, -2, -15, -13, 8, 15, -76, 34, -26, -18, -37, 24, -46,
+  66, -28, -22, 9, 34, -32, 56, -32, 2, 20, 40, -24, 78, 25, -24, 27, 0, -53, 60, -6, -45, -48, 39, -27, 91, 6, -5, -31, 23, -16, 35, -9,
+  19, -9, -7, -37, 50, 51, -34, 55, -4, -4, 29, 21, 11, 39, 44, -15, 48, 50, -37, 4, 8, -32, 2, 60, -2, 65, 19, 2, 34, 37, -21, 12,
+  15, -3, -15, 1, 27, -3, 16, 14, 24, 40, -35, 22, 11, 23, -28, 37, -16, -18, 15, 26, -28, -7, 33, -32, 26, 20, -33, 28, 43, -43, -39, 23,
+  4, 24, 28, -23, -5, 47, 23, -24, 27, -24, -14, 2, -30, 13, 22, -71, 5, -5, 23, 7, 6, -48, 8, 54, 6, 14, 12, 7, -62, 5, 30, 62,
+  28, 22, -33, 29, 16, 4, 6, 35, 3, 57, 29, 45, -25, -11, -14, 16, -13, 10, 11, -7, 4, -5, 29, 52, 10, 13, -26, -35, 59, -11, 10, 15,
+  -26, 38, 10, 4, -42, 12, -61, -20, 42, 24, 15, -22, -37, 28, -19, 67, -22, 42, -31, 51, 19, 47, -34, 16, -77, 49, 18, 78, 61, 6, 30, 12,
+  2, 87, 20, -47, 34, -2, 42, 73, -8, -19, 8, -14, 16, 14, 14, -44, 5, -21, 35, 82, -12, -31, 26, -1, -6, 21, -6, -11, 1, -45, -3, 8,
+  -17, 11, 30, -48, -24, 33, 3, -25, 17, -31, 0, 16, -6, -9, 29, 26, -3, -1, 63, -27, 34, 16, 18, 3, 3, 0, -4, 24, 5, 2, 17, -1,
+  -5, 31, 18, 10, 6, -42, 3, 28, 14, 54, 50, 34, -16, 29, 0, 28, 32, 40, -14, 32, -32, -18, 43, 32, -15, 40, -55, -18, 29, 25, -7, 52,
+  -38, -38, -37, 33, 21, 101, -64, -10, -50, 20, 52, 64, -70, -19, -6, -54, 31, 49, -34, 2, -17, 4, 20, 24, -39, 35, -40, 14, 51, 4, 5, 15,
+  -14, -20, 57, 64, 22, 36, -29, -13, 0, 61, 12, 32, -54, -14, -8, 44, 9, 6, -42, 12, -35, -26, 0, -9, -34, -22, -45, -42, 23, -1, -47, 31,
+  -26, -21, 18, -9, -23, -2, -31, 7, -14, -20, -74, 27, -27, -13, -34, 27, 59, -90, -46, 35, 52, 52, 39, -61, 30, 49, 5, 53, 67, -34, 11, 69,
+  55, -21, -15, 17, 6, -17, 75, -1, 50, -22, 86, -4, 7, 54, 43, -24, 96, -16, 98, -31, 15, -56, 24, 17, 36, 19, 7, -56, -19, 34, 98, -17,
+  -4, -20, -36, 29, 56, 9, 35, -63, 39, -14, 98, -61, -18, -52, 12, -34, 20, 18, -38, 6, -3, -10, -14, -36, 0, -52, -4, -76, -2, -18, -26, 19,
+  -6, -29, 26, -31, -10, -19, 68, -53, 27, -20, -18, -10, -24, -67, 68, -61, -23, -51, -22, -3, 58, -80, 40, 5, 23, 12, 84, -31, 14, 11, -26, 32,
+  29, -24, -27, 9, 8, 40, 44, -80, 30, -24, -35, 10, 15, -66, 33, 61, -35, 54, 27, 10, -16, 8, -44, 29, 37, -21, -11, -7, -46, -11, -2, -14,
+  -29, 49, -21, 1, 23, 0, -21, 60, -1, -32, 47, -36, -16, 49, 23, 48, 11, -79, 8, -16, -45, 26, -59, -11, 12, -18, -30, 9, 0, -26, -56, -20,
+  26, -65, 19, -70, -76, 18, 14, -42, -5, -104, -40, -37, -52, -26, -33, -49, -35, 36, -40, -66, -55, -18, -87, -40, -40, -3, 11, -9, -90, 21, -39, 30,
+  45, -46, -23, -1, 2, 70, 15, 13, -72, -59, -66, -1, 18, -38, -51, -81, 4, 33, -13, 14, -125, -85, -11, 21, 12, -55, -49, 4, -52, -46, 17, 9,
+  -85, 21, -48, -35, -8, -43, -97, 59, -24, -1, -56, -81, -81, 4, -8, -41, -30, -60, -106, 39, 13, -16, 14, -67, -28, 54, -49, 7, 26, -95, -20, 61,
+  -8, -52, -9, -9, -89, 8, -17, -8, -13, -75, -62, -24, -84, -43, -9, -40, 3, 21, -49, -44, -49, -39, -57, -18, 18, 16, 24, -72, -25, 10, -27, -20,
+  -29, -17, -14, 49, -92, 52, -43, 15, 35, 114, -28, 58, -60, 33, 9, 114, -83, -25, 25, -14, -15, 80, -23, 59, 26, -52, -33, 65, -47, 59, 57, -68,
+  -28, 67, -81, 48, -17, -4, -40, 50, -32, 3, -25, -70, -61, 63, -32, -57, 13, -46, -62, 0, 33, -33, -27, -64, -23, -28, 36, -5, -58, -41, -55, 29,
+  -22, 11, 15, -97, 21, -7, -60, -62, 14, -51, -33, 33, -59, -79, -17, -76, 28, -22, -69, 29, -27, -6, -42, 35, -31, -40, -14, -2, -47, -3, 3, 18,
+  5, -13, -45, -26, -10, -17, -54, -97, -64, 13, -12, -39, 15, -86, 7, 8, -5, -14, -74, -87, -44, -46, 46, -44, 10, -30, -10, -22, -7, 16, -28, -42,
+  -40, -33, 21, -42, -48, -68, -40, 18, -24, -43, 7, -13, 4, -5, -74, -56, 28, -86, -86, -65, -24, -22, -45, 50, -60, -58, -25, -8, -18, 46, -62, 14,
+  -71, -9, -50, -2, -46, -50, -11, -19, -52, -15, -30, -54, -3, -1, -15, -43, -8, -18, -46, 49, -85, -50, -12, -60, -11, 15, -70, -44, -43, -54, 12, 74,
+  -95, -18, -26, -41, -28, 47, -25, -42, 24, 39, -4, 27, -36, -36, 12, -60, 14, -25, -9, -8, -94, -43, 31, 8, -62, -35, -41, -71, -46, -11, 12, -4,
+  2, -89, -51, 70, 42, -52, -22, -22, -40, -35, 20, -86, -95, -65, 20, 18, -12, -59, -95, -55, 35, -10, -78, -3, -27, -18, -10, -65, -16, -10, -91, 11,
+  59, 12, 4, 56, -107, -63, -18, 5, -66, 46, -127, 5, 45, -20, -65, 25, -112, -26, 33, 9, -56, -71, -41, -35, -25, -42, -24, -10, -46, -73, 60, -21,
+  3, -54, -14, -69, 11, -54, 24, 22, -84, -110, 21, -25, 9, -27, 6, 9, 39, -51, -66, 65, -41, 41, -39, -45, -76, 17, -20, 12, 57, -66, -52, 37,
+  2, -10, -14, -43, -58, -3, 8, -6, 58, -22, -2, 14, 71, 15, 8, -39, -17, -17, 0, 69, 29, 22, -20, -15, 58, 41, 18, -18, -95, -18, 51, -22,
+  8, -57, -80, -96, 96, 44, 51, -34, -98, -62, 0, 16, -7, -61, -17, -32, 68, 4, 31, 50, 3, -4, 32, -3, -45, 49, -36, -62, 36, -33, -26, 50,
+  -22, -2, -1, -68, 8, 19, -2, 30, 33, -51, -19, -13, -59, -12, 12, -28, -25, -19, -52, 35, -18, -72, 43, 63, -64, -43, -3, -65, -7, -24, 14, -44,
+  23, -81, -37, 37, -29, -35, 13, -123, 45, 41, -15, -50, -8, -82, 41, 45, -24, 40, -3, -23, 32, 26, -23, 63, -41, -43, 82, 40, -58, 56, -19, 17,
+  60, 42, -18, 4, 9, -30, 76, -30, -39, 16, 27, -35, 91, 52, -7, 32, 72, 6, 75, 2, -50, -2, 3, -61, 56, 8, 6, -9, 6, -29, 19, -17,
+  -32, 32, -21, -11, -23, -46, 9, 68, 43, 36, 45, -25, -6, 62, -3, -21, 24, -5, -81, 74, -20, -1, -48, -32, -11, 37, 28, -32, -50, -62, -39, 6,
+  56, 34, 9, -31, -30, 65, -42, 72, -53, -20, -15, 58, -15, 57, 20, -26, 4, 2, -26, 78, -39, -35, -36, -23, -29, 95, -12, -23, 18, -13, 2, -7,
+  -28, -73, -59, -47, -62, 67, -8, -47, 32, -9, 21, 68, -29, 2, 19, -46, -57, -12, -31, 19, 27, 47, -13, 10, -1, 56, -25, -9, 25, 22, -39, 70,
+  32, -23, -44, 40, -83, 102, -1, 7, -6, 63, -47, 59, 40, -22, -7, 7, -36, 66, -4, -37, -14, 64, 28, 25, -6, -34, 45, 37, -28, 56, 2, 35,
+  30, -2, -23, 85, -40, 30, 30, -17, -39, 26, -48, -22, 42, -9, 12, 89, 1, 22, 46, 16, 13, 67, -34, 21, 5, 63, -25, 42, -60, -9, 40, 22,
+  -17, 23, -42, 23, -22, 70, 47, 57, 10, -11, 31, 23, 4, 4, 3, 12, 21, 18, -18, 1, 41, 37, -15, -14, -33, 41, 12, -7, 41, -16, 23, 2,
+  41, -18, -13, 16, 24, -22, -9, 9, -28, -39, 1, -8, 29, 33, 43, -15, -18, -45, 23, 40, -16, -23, 34, -12, 61, -17, 14, -50, -1, -34, 41, 7,
+  18, 5, 12, -56, 43, 45, 45, -26, 32, -13, -39, 20, 27, 20, 23, -24, 38, 44, 13, -47, 21, -58, -26, -17, 15, -15, 16, -41, 51, 29, 13, -11,
+  -31, -12, 0, 33, 12, 9, 40, -22, -12, 3, 24, -35, 14, 10, -5, 36, -38, -38, 31, 14, 8, 72, -24, -28, 9, 2, -33, 47, -55, -24, -12, -13,
+  10, 92, -45, 45, 47, 33, 25, 91, 61, -23, -9, -38, 14, 14, 10, -9, 25, 3, 15, 61, 28, -53, -23, -22, 9, 58, 62, -15, 19, -16, 23, 60,
+  7, -78, 21, -39, 20, 60, -8, -27, -12, -3, -11, 63, 65, -20, 36, 9, -33, 23, 35, 7, 22, 43, 6, 38, 45, -2, 15, -1, -31, 18, 6, -46,
+  4, 60, -51, 43, 3, -25, -16, 19, 1, 34, 42, -25, -37, -12, -54, 49, 21, -12, 21, 2, -61, 44, 38, -3, 12, -4, 10, 71, 0, 23, -10, -14,
+  -15, 83, -33, 20, -49, 18, 0, 46, -17, -34, 13, -5, -25, 35, -19, 26, -41, -18, -24, 35, -10, -37, -36, -11, -4, 83, 14, 11, -25, -22, -25, 54,
+  13, -14, -43, -42, -14, 92, -4, 0, -47, -6, 17, 74, 2, -5, 9, 20, 5, 23, 26, 13, -17, 5, -32, -4, 9, 71, 15, 13, -43, 19, -3, 42,
+  4, 10, -28, 30, -11, 1, -55, -18, -10, -5, 5, -8, -27, -40, -20, 17, 3, 23, -54, 12, -16, -15, 6, 12, -72, 3, -10, 44, -19, 9, 1, 12,
+  -62, 15, -37, 31, -52, 22, -50, 52, -3, 20, -64, 38, -41, 29, 19, 45, -17, 36, -36, 7, -9, 39, -38, 50, -21, 15, 20, 25, -21, 46, -37, 48,
+  -25, 69, 4, 31, 3, 5, -18, 90, -51, -12, -30, 13, 37, 127, -69, 19, -6, 25, 11, 108, -41, 9, 4, 61, -39, 50, -61, -38, -14, 40, -30, 65,
+  3, -42, -9, -4, -42, 41, -44, -15, -33, -2, -37, 13, -34, -1, -48, 17, 5, 0, -14, 25, 3, -38, 6, 29, -23, 1, -39, -36, -17, 5, 10, -14,
+  -14, -9, 24, 20, 23, -54, -19, -39, 4, 5, 45, -21, 32, -18, -32, 68, -20, -15, -27, -7, -7, -6, -55, -22, -23, -43, 44, 30, -40, -45, -24, -38,
+  -12, -2, -29, -34, -25, -44, -24, -13, 4, -29, -4, -53, -10, 21, -17, 43, -46, -36, 15, -28, -33, -7, -37, -53, 26, -34, 17, -7, -2, -11, 10, 19,
+  7, 2, -26, -5, -46, -5, -10, -37, 12, -73, -7, -35, 0, -24, -12, -18, -9, -23, 41, -34, 15, -17, -5, -22, -27, -15, -11, 12, -36, -19, -29, 27,
+  -13, -5, 15, -45, 3, -5, -19, -54, -23, -26, -25, 12, 17, -36, -56, -31, -10, 19, -38, -6, -61, 18, -19, 33, 0, -39, -24, -22, 5, 28, -53, -9,
+  -14, -12, 16, 32, -23, -25, -14, 42, -39, 54, -31, -30, -44, -3, 13, 57, 4, -46, -16, 8, 11, 12, 17, 1, -44, -40, 18, 9, -53, -69, 1, -23,
+  -3, 71, -54, -46, -46, 20, -10, 59, 6, -34, 12, 25, 7, 67, -19, -49, -1, -38, 9, 38, 35, -94, -22, -69, -7, 21, 0, -19, -4, -33, 34, 65,
+  50, -9, -8, -31, 44, 58, 53, -66, -44, -14, 32, 49, 45, -19, -6, -50, 53, 18, 25, -7, -9, -41, 22, 55, 27, -43, -21, -27, 54, 74, 57, -45,
+  31, -38, 76, 47, 18, -60, -17, -5, 43, 20, 24, -58, -2, -43, 6, 23, 64, -75, -42, 2, 58, 80, 84, -15, -21, -60, 62, 52, 63, -66, -7, -34,
+  25, 26, 66, -31, -62, -29, 63, -6, -2, -19, -63, 0, -1, -21, 74, 3, 0, -10, 10, 46, 57, -31, -8, 8, 15, 2, 76, 2, -10, -43, -2, 53,
+  81, -32, -8, 23, 18, 42, 16, -65, -18, -63, -51, 65, 48, -2, -40, -18, -18, 9, -1, 29, -51, 22, 10, 31, 39, 17, -32, 52, 1, 7, 49, -34,
+  -45, -11, -3, -28, 61, -8, -16, 7, -39, -17, 27, -26, -20, -33, -22, -18, 20, -62, -44, -6, -17, 10, -12, -33, -6, 20, 58, -30, -5, -23, 32, -28,
+  16, -62, 5, 6, 44, -32, 8, 36, 1, -38, 45, -54, 12, 41, -32, 1, -10, 29, 33, 29, 50, -35, -5, 9, 10, -20, 15, -5, -17, -32, 13, -7,
+  33, -16, 31, 45, 13, -11, 8, -28, 19, -3, 24, -28, 24, -26, 52, 5, 4, -27, 26, -67, 89, -5, -4, -48, 69, -28, 38, 57, -20, -64, -9, -10,
+  73, 28, 21, -26, 39, -68, 38, -26, -24, -62, 27, -51, 37, 47, 40, -20, -10, -31, 67, -23, 10, 1, 60, -13, 68, -81, -78, 5, 18, 40, 11, -40,
+  0, 20, -13, 21, -18, -89, 8, -40, 31, -16, -2, -74, -24, 4, 36, 66, 34, 17, 5, 30, 19, 74, -19, -37, -15, 3, 44, 64, 13, -55, 50, 36,
+  24, 53, -25, -43, 22, 28, 40, 19, -29, 7, 11, 96, 38, 15, -11, -27, 20, 80, 18, 4, -29, -3, 73, 51, -7, 45, 23, 2, 10, 69, 24, 24,
+  -36, 8, 33, 18, 30, 28, 3, 14, 45, 46, 13, 11, -28, 34, 36, -21, 49, -1, 29, -11, 57, 17, 9, 38, 14, -27, 11, -5, 66, -37, 28, 27,
+  46, 20, 35, 26, 18, 1, -35, 0, 85, 62, 22, 11, 30, -6, 59, 77, -16, 15, 22, 25, 23, 68, 33, 5, 4, -12, 26, 57, -27, 51, -35, 59,
+  41, 59, 36, 59, 19, -20, 17, 47, -7, 36, 29, -22, 71, -26, -6, 25, -34, -5, 45, -19, -43, -13, -49, -44, -28, -10, -22, 33, -16, -20, 14, 31,
+  1, 6, -26, 15, 3, 2, -46, 17, -25, 57, -8, -13, -27, -28, -12, 35, 5, -27, 8, -25, 13, -28, -79, 21, 26, -30, 80, 10, -22, 31, 19, -11,
+  26, -34, -7, 55, -8, 14, 47, -31, -21, 57, 27, 9, -3, 3, -50, 73, -10, -35, -13, 32, 25, 69, -15, 13, 30, 16, -9, 63, -12, 5, 13, 20,
+  -50, 14, -28, -22, -6, 39, -26, 81, -28, 39, 61, -1, -6, 58, -35, 37, 40, 37, 52, 53, -49, 53, 12, -45, 20, 52, -42, 56, -1, -24, 19, 46,
+  12, 102, 14, -11, -18, -1, -9, 54, -38, 18, -31, -23, 21, 32, -31, -38, 5, -51, -4, 38, 38, 5, -44, -57, -6, 39, -31, 35, -34, 24, 10, 47,
+  16, -8, -22, 56, 22, 28, -34, 43, -8, 13, -7, 53, -91, 13, 20, 38, 17, 45, -27, 14, 9, 26, 4, 59, -42, -60, 46, 28, -40, 61, -46, 40,
+  -26, -32, -27, 51, -20, 55, 36, -24, -4, -12, -87, 6, 14, 13, -45, 11, -63, 9, 35, -7, -20, 4, -28, -17, 15, -54, -27, -15, -2, 56, -30, -9,
+  -66, -65, -3, -10, 28, -53, -4, -51, -26, 41, 8, -27, 3, -70, -35, 27, -24, -75, 29, -25, -46, -8, -1, -28, 43, -49, 28, 3, -20, 6, -35, -53,
+  -3, -15, 8, -50, -28, -71, -27, 44, -4, 20, -30, -41, 42, 52, -20, 4, -34, -33, -41, -21, -2, -19, -11, -15, 33, -32, -1, 13, -41, 3, -21, 8,
+  -37, -4, -14, -59, -6, -9, 29, 28, 9, -17, 48, -47, -9, 1, -1, -28, -23, -95, 0, 50, 1, -18, -4, -90, 57, 62, 12, 6, -38, 13, 44, -31,
+  -18, -13, -53, -1, -1, -7, 25, -27, 25, -13, -28, -26, 31, -26, -9, 57, 6, -27, 38, -8, 41, 4, -10, -51, 6, -13, -44, 49, 17, 9, -11, 5,
+  -24, 56, 9, 10, 55, 34, 9, 8, -6, 17, -4, 24, 26, 24, -74, 54, -11, 12, 15, 50, -58, 71, 60, 48, 23, 30, 8, -16, -6, 53, 18, 46,
+  18, -1, 2, 64, -5, 11, -68, -11, 77, -9, -34, 67, 9, -32, 2, -13, -48, 29, 11, -58, 47, -2, 1, 35, -33, 9, 64, 35, 9, -45, -54, -4,
+  75, 1, -4, -19, -33, -30, 53, 6, 23, 11, -63, -49, 68, -24, -25, -5, -49, -1, 38, 36, 40, -23, -68, -17, 13, -13, 40, -19, -79, 4, -15, 33,
+  57, 43, -8, -56, 55, -33, 16, -41, -14, -32, -30, -24, 32, -44, 16, -41, -30, -32, 34, 35, -21, -9, -6, 25, 4, 29, 32, -23, 30, -38, -44, -31,
+  -33, -12, 16, -12, 4, -12, -32, -57, -3, 1, 16, 29, 0, -14, -21, 12, -23, 33, -23, 18, -1, -54, 9, -31, 2, -10, -3, -4, -47, 16, -18, -38,
+  -49, -52, -16, -36, -39, 4, -21, -24, -23, 1, -62, -5, -37, -24, 18, -7, -18, -28, -73, 26, -16, -12, -41, -12, -54, 31, -29, -59, 16, 23, -8, 27,
+  -31, -51, 39, 14, 0, 15, -15, -53, -7, 4, -16, 36, -15, 33, -4, -7, -28, 25, -64, 2, -26, -40, -22, -26, 13, 26, -46, -32, 27, 63, -18, 39,
+  -1, -16, -54, 13, 8, 15, -46, -28, 7, 23, 10, 48, -48, 3, -3, 74, -41, -8, 3, -48, -4, 57, -25, -12, 33, -63, -3, 13, -62, -20, -34, -28,
+  -1, 15, -41, 30, -2, -92, 48, -7, -15, 23, 0, -100, 9, -50, -11, -38, -1, -69, 35, -88, -20, -6, 20, -114, 12, -42, -48, -68, 62, -55, 46, -107,
+  33, -71, -18, -102, 72, -100, -39, -69, 9, -66, 12, -86, 12, 0, 8, -52, -5, -12, 12, 23, -1, -6, 42, -8, 23, 23, -10, -6, -2, 8, 39, 75,
+  14, 27, 68, -65, 40, 1, -29, -18, 67, -52, 41, 4, 7, -63, -16, -24, 39, 5, -4, -13, 31, -61, 17, -24, 14, -10, -32, 3, 54, -23, -23, -56,
+  25, -71, -13, 7, -2, 14, 10, -49, 31, -45, -31, -38, -28, 39, 28, -22, -37, -39, 18, 4, 13, -14, 1, 42, -55, 86, 52, -10, -69, 45, 8, 51,
+  -5, 25, 5, 41, -25, 45, 33, -2, -40, 80, -60, 42, 3, -28, 31, 22, -56, 22, 33, -62, -39, 30, -43, 47, 23, -127, 11, -3, -25, 18, 55, -81,
+  57, -123, 5, 14, 29, -102, 61, -32, 0, 70, 12, -117, 97, -66, 1, 118, 28, -33, 71, 5, 33, 112, 21, -97, 24, -7, -19, 91, 52, -47, 74, -74,
+  26, 48, -58, 36, 79, -78, -9, 45, -57, -64, 57, -46, -20, 30, 33, -42, 13, -102, 36, 6, -33, -4, 101, -64, 23, 4, -32, 17, 115, -39, -13, 16,
+  -17, -36, 81, 9, 3, 23, -12, -58, 40, -40, 25, -11, -64, -73, 41, -49, -38, -9, -30, -93, 69, 17, -13, -15, -42, -121, 66, -29, 1, 13, -7, -86,
+  12, -14, -53, -74, 38, -46, 8, -35, -55, -12, 42, -108, 104, 0, -40, -9, 22, -81, 115, 26, -43, -64, -9, -78, 111, 55, 34, -50, 10, 2, 92, 41,
+  -22, 30, -45, 30, 13, 40, 22, 12, 54, 7, 26, 27, 41, -56, -34, 28, 60, -33, -37, -29, 24, 41, 31, -3, -53, 3, -14, -24, 56, -5, -28, -90,
+  -1, 21, 98, 71, 8, -48, 52, 62, 103, 67, 36, 18, 16, 15, 115, 57, -106, -21, -26, -16, 77, 66, -77, -84, -61, 49, 53, 80, -57, -76, -70, 61,
+  100, 49, -96, -30, -58, 60, 35, 70, -14, 21, 16, 67, 19, 37, -21, -6, -48, 51, 35, 22, 14, -53, -48, 43, -32, 2, -49, -57, -22, 42, 28, -6,
+  -39, -83, 12, 38, 18, 14, -10, -30, 24, 55, -31, 10, 21, -82, 22, -38, -14, 11, -24, -30, -23, 12, -33, 68, 37, -75, 6, -3, -13, 38, -30, 0,
+  -18, -44, -39, 33, 32, -33, -41, 5, 4, -11, 10, 19, 51, 21, -47, 6, 51, 31, -16, 20, 1, 24, 27, 31, 32, 16, -3, 52, -10, 59, 45, 69,
+  2, 39, 57, 33, 59, 39, -28, 64, 17, 30, 14, 56, 23, 46, 23, 31, -8, 17, -52, 27, 15, 2, -63, -8, -18, 73, -48, 43, -72, -102, 14, 51,
+  17, 28, -63, -99, -13, -24, -45, 27, -80, -30, -28, -5, -41, -19, -48, -61, -7, 42, -16, 17, -53, -74, 23, -26, 25, 42, 30, -27, -61, 48, -18, 62,
+  31, -64, -30, 7, 34, 78, 47, -5, 25, 3, -14, 75, -27, -22, -41, 18, 51, 53, 37, 1, -22, -5, 32, 16, 33, -18, -30, 24, 7, -38, 65, -15,
+  35, 24, 91, -29, 17, 6, 51, -42, 65, -37, 54, -54, 10, 20, 30, -56, 28, -70, 17, -37, 56, -48, -16, -70, 26, 19, 26, 30, -1, -78, 13, -40,
+  23, -38, 24, -38, 44, -3, 59, 58, 61, -60, 5, -66, 54, 37, 6, -127, -5, -12, 46, 47, 13, -87, 97, -80, 44, 47, -10, -34, 48, -12, 22, -35,
+  2, -1, 67, 0, 34, -28, 72, -50, -43, 42, -22, -29, 94, -40, -2, -4, 1, -44, 88, 9, 45, 19, -63, 6, -51, 3, 92, 20, -10, 0, -12, -65,
+  25, 24, -39, -3, 24, -123, 57, 59, -63, 42, 55, -121, 86, 77, -13, 81, -11, -70, 74, 85, -73, 47, -2, -86, 83, 1, -35, 32, -26, 20, 4, -9,
+  -77, -8, -25, 11, -7, -66, 8, -37, 41, -43, -15, -36, 9, -60, 23, -53, 30, -55, 27, -93, 14, -17, 52, 22, -2, -51, 5, -5, -12, 27, 14, -44,
+  35, -63, 16, 11, -39, -58, 54, -70, -2, 72, 16, -62, -10, -70, 35, 108, 15, 7, 10, -47, 50, 98, -75, 53, -26, -46, 53, 101, -47, 21, 21, 17,
+  5, 94, -54, 34, -49, -18, -22, 25, -36, 62, -25, -29, 1, 13, -73, 61, -27, -35, -40, 69, 6, 52, -56, -47, -80, 42, -57, -16, 2, -23, -14, 42,
+  -2, 56, 24, -52, -13, 74, -36, 48, -55, 16, -91, -18, 40, 25, 12, -66, -20, 3, 74, 4, -4, 33, -53, -1, -14, 18, 12, 97, -79, 20, 45, -14,
+  20, 25, -63, -30, 55, 14, -25, 64, -25, 1, -15, -27, -58, -16, -73, 17, 70, 9, -3, -15, -3, -5, 40, 0, -28, 72, -23, 29, 59, 12, -19, 31,
+  -56, -44, 32, 42, -66, 54, -39, -63, -4, 15, 11, 18, -25, -44, 44, 46, 6, 56, -11, -29, 47, 20, 14, -40, 61, -19, -3, -7, -32, -4, -1, -44,
+  -58, 9, -76, 18, -4, -4, -4, 19, -1, 3, 10, -17, 10, -22, 53, -26, 41, -76, 17, -19, 20, 30, 5, -90, 2, 31, 42, 13, -25, -21, -27, 1,
+  61, 40, -3, -91, 32, 16, 84, 15, -51, -27, -44, 26, 41, -69, 62, -4, -12, -57, 11, -48, 37, -68, -14, -24, 38, -67, 48, -82, -18, -24, 71, -78,
+  50, -5, -39, -26, 77, 2, 36, -21, 18, -62, -6, 15, -17, 6, -38, 24, 46, 10, 42, 13, -44, -41, 4, -77, 34, 49, -49, -32, -82, -43, 26, 92,
+  -91, 24, -90, -54, 49, 96, 43, 0, -93, -44, 16, 16, 5, 48, -84, -41, -59, 11, -60, 6, 6, -99, -5, 11, -9, 51, -14, -127, -34, -10, 1, 54,
+  6, -81, -37, 56, 32, -3, -9, -69, 26, -25, -22, 12, 42, -17, -2, 30, 13, 14, 52, 36, 69, -38, 69, -31, -32, 20, 46, 20, 86, -19, 13, 29,
+  70, 14, 29, -9, -64, 31, -21, -21, 47, -68, -69, 56, -60, -26, 54, -31, -40, 82, -75, -4, 15, 9, -61, 63, -70, 29, -4, -34, -27, 36, -48, 10,
+};
+const ALIGN(16) int32_t layer0_weight_sums[80] = {
+  -4060, -2953, 390, -5240, -2065, -730, -322, -7933,
+  -42, -1232, -10388, -1048, -1631, 779, 390, -349,
+  -1818, -360, 4137, -1165, -1392, -1340, -3953, 1849,
+  628, -7571, -2986, 137, -2917, 2952, -1762, -1755,
+  -1740, -1950, -1499, 1917, -2025, -3316, -15, -2896,
+  2506, -8721, 1231, -2815, -3127, 3587, -2241, -766,
+  -45, -1263, -2242, 6127, 5393, -1095, -1380, -1235,
+  2949, -6757, 4690, -1747, -2996, -561, 2113, -3341,
+  -2881, -2747, -1735, -721, -5425, -6308, -1974, -2074,
+  -3658, -2004, -2711, -352, -9478, 999, -152, 279,
+};
+const ALIGN(16) int32_t layer0_bias[80] = {
+  -192, -995, -400, 55, -547, -837, -232, -257,
+  -380, -848, 142, -273, -585, -213, -254, -538,
+  -575, -961, -173, -751, -697, -878, -47, -1151,
+  -669, -112, -378, 0, -718, -357, -709, -256,
+  -411, 30, -167, -238, -397, -564, -470, -790,
+  -580, 21, -380, -867, -665, -408, -751, -105,
+  -651, -576, -808, -547, -429, -51, -175, -224,
+  -427, -193, -127, -696, 6, -366, -879, -383,
+  -665, -372, -411, -576, -737, -376, -791, -473,
+  16, -425, -1020, -799, -312, -447, -856, -776,
+};
+const ALIGN(16) int32_t layer0_multiplier[80] = {
+  1633482552, 1301083997, 1213588525, 1794974109, 1278261732, 1400229323, 1234679680, 1168534076,
+  1347776908, 1458114723, 1486916241, 1400675032, 1207957569, 1405084138, 1223873602, 1337450825,
+  1684287061, 1297837444, 1279949539, 1445631814, 1237229298, 1099005458, 1409220663, 1313992027,
+  1368734751, 1254013438, 1096314191, 1362565014, 1411450398, 1254847004, 1224274306, 2097192248,
+  1539437907, 1194432319, 1359417914, 1228458048, 1471005994, 1314852222, 1086751912, 1282786540,
+  1380489076, 1686693667, 1548871212, 1128519566, 1169049377, 1089791648, 1915708706, 1376306186,
+  1472823540, 1386099954, 2046296708, 1215002984, 1508048743, 1138436949, 1542833768, 1829522285,
+  1269371292, 1141892277, 1213982253, 1482196781, 1186051139, 1211626606, 1346610953, 1824995775,
+  1107723196, 1347271051, 1151209539, 1491463849, 1456896787, 1269306550, 1169358029, 1701668258,
+  1428983284, 1635400486, 1316398549, 1604375103, 1175144417, 1491013462, 1355949739, 1188063762,
+};
+const ALIGN(16) int32_t layer0_shift[80] = {
+  -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9,
+  -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9,
+  -9, -9, -9, -9, -9, -9, -8, -9, -9, -9, -9, -9, -9, -9, -10, -9,
+  -9, -9, -10, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9,
+  -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9,
+};
+
+const ALIGN(16) int8_t layer1_weights[3200] = {
+  -114, 127, -72, 0, -77, 11, -1, -111, 7, 25, -37, -31, -36, 69, 8, 16, -7, -66, 60, 58, -18, -71, 17, -2, 49, -74, -17, 0, 3, 17, 6, 30,
+  6, 70, 9, 22, 8, -12, 6, -8, 23, -12, 37, -27, 9, -27, 3, -69, 65, -83, 7, -56, 34, -8, 30, -18, -23, 23, -46, -53, 16, 38, -95, -42,
+  36, 53, 84, 76, 14, -52, 32, -34, -59, 85, -30, -23, -76, 77, -102, 11, -46, 5, 15, -30, -17, 19, -11, -4, 73, -27, -118, -39, 15, -78, 27, 36,
+  -66, -42, -45, 43, 70, -4, -27, -32, -27, 14, 33, -127, 49, 50, -2, 20, 54, 21, -115, -50, 72, -24, -23, 19, 19, -65, 13, 52, 65, -29, 39, -76,
+  -4, 5, 40, 27, 41, -9, 27, 64, 21, 52, -24, -52, -58, -13, -3, -24, 32, -12, -34, -33, -55, -59, 64, -93, -103, -54, 1, -55, 53, 42, 6, -37,
+  -46, 79, 21, -4, 5, 88, -9, -17, 10, 127, -11, 4, 30, -17, 5, -63, 29, 70, -25, 120, 78, 53, 0, 18, 27, -19, 14, -27, 103, 6, 52, 68,
+  99, 10, -18, -35, 111, 75, 70, 27, 18, -29, 13, -37, 61, 10, 9, -39, 77, -75, 88, -3, 2, -30, 0, -5, 3, 28, -28, 19, -41, -12, -36, -8,
+  88, 127, 12, 41, -40, -53, 105, 18, 3, 66, 19, -7, -56, 74, 73, 83, 6, -36, 7, -58, 39, -46, 22, -12, 6, 31, -25, -14, -15, -99, 54, -35,
+  -59, 28, -45, 2, -6, 59, 15, -32, -47, -87, 62, -42, 60, -8, 55, 11, -10, 18, -6, -52, 18, -5, 55, 47, -94, -18, -7, -2, 21, 42, 51, 16,
+  -56, -28, 64, -47, -47, 61, -66, -87, 73, -21, -31, 18, -127, 79, -52, 14, 21, 0, -49, 9, 16, 48, -50, 9, -93, -23, -61, -51, -16, -61, 10, -28,
+  109, -84, -8, 4, -2, 63, 56, 85, -17, -32, 52, 34, -54, 37, 2, 54, -41, -81, 10, -23, -15, -28, 17, -55, -77, -3, 34, 44, -57, 42, -66, -24,
+  -58, -10, 33, -46, 26, -62, -20, 56, -63, 0, -18, 67, -127, 58, -6, 87, -10, 15, 6, 73, -26, 19, -43, 21, -9, -32, 32, 6, 29, 21, 61, -69,
+  3, -90, -63, -55, 25, 56, -89, -57, -13, -85, -74, -39, 1, -32, -81, 8, 89, -76, 28, -10, -21, -1, -31, -25, 9, 35, 127, 27, -51, 19, -9, 44,
+  4, -10, 16, -84, -62, -16, 27, -55, 37, 48, 34, -9, 39, -108, -31, 0, -33, 29, -12, 13, -18, -8, -31, -22, -84, 1, -120, 28, -50, 34, -15, -58,
+  -65, 3, -119, -7, -17, 27, -6, -33, -53, 39, -5, 16, 6, 54, -88, 83, -76, -72, -70, -80, -32, 98, -85, 72, 81, -66, -59, 43, 80, -25, -92, 48,
+  32, -3, -27, -106, 42, 3, -57, 22, 70, -12, -16, -92, 29, -123, 86, -105, -76, -38, -15, -11, 1, 12, 70, -2, -73, -89, 60, -84, 39, -42, -34, -7,
+  -46, -8, -15, -22, 88, -24, -20, 48, -6, -32, 13, 26, 30, 7, -11, 12, 8, -64, 69, 14, -89, 35, 28, -82, -7, 1, -52, -18, -64, 92, -1, -60,
+  -12, -30, -27, 0, 20, 74, 2, 38, -127, -72, -11, -90, 3, -48, 51, -56, -40, 32, 67, -8, -42, 71, -58, -39, 15, -68, -87, -124, -8, -59, 26, 65,
+  22, -15, -40, 109, 78, 15, -6, 45, -54, -13, -1, -74, -30, 63, 12, -34, 20, -26, -109, 39, -25, -23, -29, -35, 86, -83, 57, -9, 35, 13, -6, -62,
+  61, 7, 19, -19, 14, -13, 87, 70, 8, 12, 8, -15, 54, 4, -7, -93, 72, 39, -24, -64, -102, -28, 108, -66, 0, 27, 81, -57, -50, 127, -37, -46,
+  -14, 11, 31, 71, -85, 3, -8, 67, 16, -49, -99, -74, -31, -52, 7, -6, -85, 4, -58, -11, -16, -84, -14, -27, -94, 5, 9, -115, -54, 61, -80, -96,
+  35, -69, -90, 33, 24, -94, -73, -58, -12, -127, 18, -56, -49, 71, 41, 27, -68, 43, 20, 22, -1, 4, -43, -17, 25, 4, -124, -48, 51, 1, 4, -32,
+  32, 6, -75, -119, -54, -32, 72, -42, -89, -38, 59, -63, -9, -19, 44, -23, -24, -65, 61, -87, 57, 55, -51, -26, -8, 42, 50, 40, -11, 67, -48, -11,
+  -11, -24, 44, 57, 16, 23, 4, 37, 89, 16, -73, 52, -21, -20, -68, 51, 5, -42, -50, 45, 10, -73, 20, -15, 99, -35, 27, 14, -3, -64, -16, 23,
+  -54, -22, 8, -82, -88, -122, -32, -43, -109, -41, -66, -30, 88, -66, -49, 48, -4, 14, -68, 4, 13, -50, 34, 29, -85, 80, -46, 112, -11, 27, -48, 127,
+  37, -60, -59, 59, 27, -26, -45, -10, -15, 48, 41, 1, -39, -63, 2, -57, -71, 77, -60, -35, -50, 53, -10, 27, -125, -25, -4, -6, -9, -52, 57, -73,
+  91, 6, 28, 43, 82, -26, 127, 48, 12, -49, -17, 39, 29, 12, 12, 12, -8, 88, 52, -14, 16, -14, -95, -55, 4, -64, -13, 102, -60, -30, 48, 67,
+  -30, 79, -60, 35, 20, -61, 1, 43, -28, -14, 28, -93, 73, 26, 58, 46, 7, 6, -70, -35, 67, 39, 54, 7, 54, 48, 55, 53, 22, 60, -8, -34,
+  49, 62, 8, -110, -51, 58, -16, 70, -36, -41, -3, 24, 77, -102, -29, 84, 45, 57, -11, -80, 68, -41, 117, 85, -54, -25, -93, 36, 1, -48, 11, 23,
+  17, -81, 32, -41, -99, -68, -31, -76, -6, -53, -36, 89, -40, 5, 36, 96, -66, 43, -71, 5, 81, 58, -74, 127, -64, 61, -35, 39, 40, -48, 21, 84,
+  10, 23, 58, -43, 45, 10, 5, 31, 1, -9, -52, -71, -33, -78, -36, -20, 9, 13, -26, 48, 127, -12, 18, -61, -51, 15, 7, -10, -23, 40, 18, -4,
+  44, -90, 11, -67, -39, -35, -71, 8, 49, -16, 88, 8, 48, -14, 30, -55, 14, 57, 8, -5, 22, 14, 69, 65, -6, 29, -1, -50, 7, -7, -13, -30,
+  77, -22, -18, 46, -101, -66, -13, -16, -72, 45, 34, 20, -27, 93, -41, 14, -55, 70, -49, -57, 31, 33, -28, -26, 19, 53, -47, -77, 91, -4, -29, -17,
+  86, 6, 12, 0, -4, 78, -19, -29, 127, -21, 4, 5, 9, -36, 71, -18, -36, 97, -87, -61, 40, 86, 62, -33, 28, 5, 50, -11, 14, 24, -5, -52,
+  1, -4, 49, 26, -66, -41, 23, -21, 2, -119, 75, -70, 28, 18, 46, 7, -47, -69, 73, -104, -16, -63, 66, -58, -46, 12, -14, 103, -89, -99, 8, -86,
+  28, 5, 68, 26, -63, 127, -43, -2, 1, 19, -25, -34, -24, -50, 4, 81, 16, 51, -95, -17, 11, 17, -10, 8, -1, 11, -22, 22, -10, 25, 54, -52,
+  99, -92, 35, -8, 25, -84, 10, 26, 49, -28, 39, 36, 59, 10, -4, 10, -74, 78, 34, 37, 30, -26, -12, -38, -24, -44, -72, 59, -19, -39, 124, -49,
+  -19, 43, -32, -67, 0, -14, 7, -4, 3, 4, 61, -35, 11, 14, 96, 82, 49, 15, -67, 13, 32, 56, -25, -45, -26, 127, -1, 47, 15, 39, -34, -5,
+  56, 101, 29, 13, -12, -42, 25, 57, 48, -30, -34, 23, 98, -68, 47, 24, -23, -31, 30, 23, -2, -21, 111, 0, -40, -26, 27, -57, 51, -43, -20, -46,
+  29, 46, 31, -21, -32, -117, -57, -65, -86, -19, -7, 71, -2, -22, 108, 15, -39, 5, -32, 83, 109, -29, -4, 110, 12, 73, 1, 115, -66, -6, 64, 111,
+  1, -58, 20, -50, 24, 1, -8, 46, 64, 16, -50, -2, 34, -95, -28, -77, -68, 63, -39, -57, 47, -42, 10, -3, -79, -81, -33, -79, 107, -60, -38, 1,
+  -38, -21, -81, 6, -32, -93, 44, -26, -32, -127, -64, 49, 63, 11, 69, -17, -22, -58, 48, 0, -72, 7, -52, -48, -18, -52, -43, 25, -95, 27, -43, 47,
+  -11, 40, -29, -23, 38, 93, -46, 47, -93, -113, 17, -59, 67, -77, 2, 10, 66, -85, 65, 51, -49, 57, -18, 84, 1, -71, -25, 51, -65, 17, 26, 69,
+  -63, -21, -10, -24, 33, -21, -7, -78, -107, 91, 10, -13, -66, 47, -4, -112, 36, -88, 64, 74, -41, -50, -113, -5, 1, -38, 1, 16, -14, 57, -22, 88,
+  -98, -14, -37, 69, 30, 14, -21, 1, 39, -15, -100, -25, 69, 0, 17, -127, -36, -80, -26, -103, -82, 30, 11, -68, 24, -124, 32, 4, 0, 12, 27, -18,
+  52, -16, -12, 86, 5, 59, -104, 19, -17, -43, -29, -81, -76, -106, 34, -41, -50, -34, -127, 8, -66, -31, -17, 30, -31, -87, 21, -91, -18, -5, 67, -68,
+  39, -118, -48, -37, 17, -25, -25, -25, 47, 9, -115, -12, -7, -54, 6, 73, -35, 63, 10, 69, 46, 32, -27, 9, 3, -88, -52, -60, -30, -24, -118, -58,
+  -103, 45, -28, -3, -78, -19, 31, -50, -44, 17, -1, -20, -29, 19, 2, -38, -9, 77, -3, -81, 1, -12, -4, -127, 64, -50, -127, -100, 51, -61, 34, 28,
+  -21, -66, -45, 14, 122, -11, -59, 13, -34, -26, 39, -49, -12, 82, -62, -72, -53, 10, -117, -10, -20, 82, -59, -77, 104, -48, 13, -71, 1, 20, 80, -38,
+  49, -24, -23, 33, 59, -33, 111, 56, 49, 37, -23, -65, 28, 4, -24, -58, 104, -26, 5, -50, -82, -74, -1, -94, -113, 21, 59, -61, -37, 44, 31, -65,
+  7, -4, -74, -109, 26, -85, 127, -56, 61, 28, -53, -16, -24, -67, 38, -112, -84, 22, -5, -35, 1, 32, 57, -50, -40, -111, 62, -60, 28, -20, 22, 42,
+  -15, 38, 1, -97, 47, 19, -40, 19, -32, -31, -8, 55, -10, 15, 7, -63, 4, -82, 1, -49, -34, 40, -4, -37, -4, 53, 12, 37, -82, 77, -55, -7,
+  -46, -20, 51, 46, 38, -21, -53, 56, -125, -7, -48, -74, -11, -58, 12, 29, -87, 127, -27, -66, 18, 16, -18, -74, 0, -11, -13, -1, 105, 35, -5, -30,
+  126, -41, 61, 84, 40, 19, -1, 5, 86, -41, 12, 9, 17, -37, 7, 40, 13, 56, -10, -71, 34, 83, 35, -14, 54, 25, 84, -68, -12, -21, -38, -92,
+  95, -66, -33, 15, 31, -53, -12, 2, 21, -3, -20, -68, -10, -50, 29, 15, -35, -1, 65, 113, 56, -86, 34, 37, 31, 91, -13, 99, -102, -6, 17, 21,
+  40, -22, -13, 78, -43, 13, -38, 65, -28, -2, 18, 76, -35, 94, -14, 27, 9, 26, 35, 11, 1, -50, -4, 76, 37, 110, -63, 117, 13, 21, -5, -7,
+  -33, 31, 127, 58, -51, -3, -7, -8, 33, 43, 47, -29, -55, 28, -51, 84, -38, 109, -10, -90, -5, -5, 17, -10, -25, -17, 30, 42, 51, 3, 31, 68,
+  -28, -74, -23, 8, 51, -49, 4, 14, 126, 17, 43, 47, -52, -18, 0, -31, 11, -13, 47, -20, 25, 118, -37, 21, 6, 67, -37, -47, -28, -12, 9, 41,
+  -98, 20, -26, -39, 6, 7, -28, 109, -55, -19, 6, -15, 8, -36, 14, -25, 59, -24, -25, 76, 36, -105, 68, 54, -25, -34, -25, 58, 17, 21, 3, 59,
+  -48, 99, 20, 12, 0, -43, -36, -28, 24, -46, -45, 28, 26, -25, 118, 93, 18, 52, -95, 22, 71, -8, 14, 6, 28, -33, 20, 38, 20, -30, 86, 127,
+  -32, 12, -28, 8, 4, -34, 23, 27, -13, 6, -43, 29, 79, 105, 18, -86, 72, -1, 102, 29, 11, -30, -27, 1, -41, -103, -5, 54, -55, 26, -64, 44,
+  -42, -3, 50, -60, -92, -43, -44, 1, -55, -19, -18, -62, -42, -18, 29, -14, -50, -29, -39, -42, 76, 75, 35, -25, -23, 45, 68, -19, 64, -29, -127, -71,
+  6, 48, -17, 71, 18, -2, -88, -44, -17, 64, -82, -55, -13, 3, -29, -39, -41, 16, -81, -34, -34, -23, -69, 63, 11, 127, 41, 79, 11, 81, -24, -44,
+  10, 5, -30, -2, -38, -7, -29, 50, -19, -39, -68, 38, -40, -10, -5, 57, 73, 36, 116, 42, 63, -10, 33, 15, -32, 57, -32, 65, 2, -47, -29, 69,
+  1, 19, 27, -14, -44, -61, 50, -62, -71, 22, 4, 25, -46, 20, 57, 96, -4, 20, 22, 20, 44, 15, 30, 7, 25, -46, -3, 58, -17, -11, 39, 55,
+  36, 34, -9, 21, 9, -10, -60, -47, -48, 37, 42, 126, 16, -28, -99, 22, 127, 25, -15, 57, 41, 37, -5, 109, 48, 24, -23, -5, -53, -76, -47, 14,
+  4, -52, 122, -9, -25, 71, 38, 13, 35, 107, -20, 65, -41, -96, -105, 84, 57, 37, -9, 30, -16, -80, -16, -1, -116, 27, 25, -52, 22, -71, 117, 43,
+  -14, 42, 7, -4, 61, -12, -47, -15, 19, 51, 78, 72, -58, 39, -30, -26, -66, 22, 9, -2, -33, 54, 7, -35, -55, 15, -42, -15, 51, 20, -18, -44,
+  24, 21, -4, -52, 34, -43, -54, 37, -53, -43, 29, 62, 10, -74, 18, -68, -17, 92, -41, -13, 42, 47, 66, 47, 37, -18, -15, -81, 4, 16, 5, -32,
+  89, -50, -52, 48, -51, -59, -39, 17, -14, 29, 8, 46, -64, -58, -33, -72, -21, -60, 74, 27, -53, -42, -3, -46, 18, 127, 62, -62, -37, -50, 33, -18,
+  36, -43, 48, 41, -62, 94, -60, 63, -5, -57, -42, -67, -56, -86, 18, 55, -76, -40, -120, -20, 1, -89, -34, 71, -98, 23, -28, -82, -35, -8, -27, -103,
+  64, -81, -54, 61, 0, -98, -42, -39, 16, -52, 25, 1, -3, 33, 24, 7, -84, 127, -19, 60, 35, 31, -19, -42, 42, -63, -53, 26, 70, -48, 81, -44,
+  22, -37, -85, -71, -39, 2, 36, -69, -48, -92, 53, -25, -5, -28, 28, -5, -33, 54, -33, -79, -28, -95, 36, -46, 32, -127, 17, 6, 51, 8, 16, -108,
+  -43, -54, 82, -15, -25, -83, 81, -95, 2, -88, 77, 63, -29, 49, 9, -17, -88, -5, -13, -75, -32, -23, -58, -116, 48, 92, 40, -54, -34, 5, 13, -17,
+  34, -35, -43, -18, 40, 59, 45, 22, 45, -41, 82, -79, 18, 45, -75, -125, -37, -60, 56, 8, -106, -35, -2, -52, -24, 7, -71, -52, -99, -37, -107, -100,
+  -68, 32, -72, -50, -10, -78, 34, -113, 20, -87, 7, 28, 46, -34, -5, -105, 37, -88, 94, 35, 19, -31, 66, -69, -28, -33, 60, 47, -31, 81, -41, 63,
+  -96, 63, -60, -117, -20, 11, -51, -102, -28, 18, 77, -59, -21, 12, 13, -95, 69, -101, 5, 14, -18, 54, 19, -31, 38, -36, 106, -94, 6, 69, -83, -119,
+  -40, -21, -6, 19, -127, -47, 10, -87, 6, 18, -85, -57, -113, 52, -86, -112, -26, 35, -77, -78, -82, -15, 38, -69, 11, -21, -33, 45, -69, 67, 3, -63,
+  -39, -13, 38, 61, 5, -57, 66, 22, -6, -40, -12, -30, 21, 17, -1, -17, -23, 52, 32, -51, -44, -1, -59, -13, -127, -38, 38, -28, -5, -16, -17, -79,
+  -4, -49, -34, -63, 32, 28, -39, -26, 6, 79, -103, 22, -51, 1, -93, -84, 19, 66, 24, 80, -45, 6, -47, -73, -29, 57, -72, -57, -6, 45, -23, -79,
+  -21, -18, -24, -36, 10, 13, -30, -66, 87, -39, -1, -93, 34, -98, -3, -9, -99, -8, -23, 5, 45, 51, -5, -53, -78, -18, 34, -122, 15, 41, 22, 46,
+  31, 16, -79, -29, -8, 21, -24, 25, 17, -120, -24, 33, 59, 18, 70, -71, 4, -13, 12, -14, -13, 44, 81, 47, 28, -22, -7, 22, -127, -1, -46, 13,
+  10, 40, -54, 44, -34, -4, 12, -18, -108, -3, 21, -25, 26, -35, 78, 15, 10, -26, 32, 23, -56, -17, 45, 21, -29, -73, 36, 23, -34, 31, -2, -5,
+  24, -21, 54, -54, -94, -32, 47, -83, -32, 44, 45, 16, -60, 23, -43, -48, -127, 23, 37, 36, -77, -38, -53, -29, -41, 26, -54, -45, -99, -3, -3, 14,
+  1, -24, -82, 11, 13, 27, -33, -47, 28, -6, 34, -41, 14, 34, -72, -65, -56, -119, 30, -32, 4, 43, -80, 1, 1, -14, -31, -41, 18, -56, -102, -53,
+  -21, -58, -58, -35, 50, 50, -79, -48, 22, 36, 70, -49, 1, -98, 0, 8, -57, 49, -48, -87, 4, 28, -6, -3, -76, 21, -11, -127, 16, 1, 38, 0,
+  25, -5, -88, -61, 34, -76, 61, 49, -72, -47, -98, 79, 33, 45, 18, 10, -33, -9, 76, -50, 16, 11, 3, -22, 41, -22, -108, 4, -103, 15, 0, -9,
+  18, -1, -71, -54, 31, 54, -43, 71, -63, -123, -37, -95, 14, -79, 75, 34, -5, 1, 15, 37, 13, 24, -30, 33, 0, -9, 110, 125, -6, 112, -19, 4,
+  14, -10, 69, -43, -30, 1, 29, 18, 58, -19, -59, 98, 14, -7, -32, 20, 23, 7, 77, 41, 9, 59, -14, 22, -18, 89, 14, 9, -36, -62, -18, 50,
+  -30, 30, -32, -43, -28, -51, -1, -54, -53, 27, 14, -24, 71, -10, -21, 26, -12, 38, 1, -5, 24, -17, -48, 34, 127, 50, 10, 52, 5, -25, -42, 6,
+  45, 72, 66, -32, -43, 121, -80, -27, -56, -61, -25, 76, -29, 48, -18, 47, 46, 4, -14, 18, -36, -21, -12, 61, -22, -31, -28, -32, -7, -10, -2, -29,
+  72, -79, -27, 35, -26, 87, 2, -84, 9, 1, 105, -3, -18, -53, -49, -43, 13, 95, -26, 90, -45, -54, -10, -77, -87, -9, 14, -28, 19, -47, 80, 29,
+  50, -27, -44, 14, 49, -32, -15, 46, 9, 67, 25, 127, -9, 68, 1, 40, -2, -77, 44, 2, -24, -83, 26, 42, -37, -44, 24, 20, -21, 50, -9, 1,
+  -6, -65, 56, -46, -92, -6, 86, -70, 43, -25, 46, 24, -83, -6, -114, -25, -125, 23, 15, 0, -88, -2, -96, -76, -75, 16, -52, -35, -122, 29, 6, -1,
+  -57, 24, -127, 12, 27, 16, -4, -2, 28, -14, 56, 6, 24, 12, -79, -1, -41, -80, 42, -10, -46, 6, -109, -54, 25, 20, -105, -75, -9, -49, -73, -72,
+  24, -37, 57, 40, -49, -14, 26, -3, 21, -127, -38, -9, 38, -5, 52, -3, -43, -63, -34, -25, 24, -69, 40, -42, -39, 24, 31, 13, -90, 29, -68, -34,
+  -64, 1, 9, -1, -9, -61, -70, -102, 18, 31, 0, -48, -25, 71, 31, 3, -74, 8, 1, 44, 70, 54, -11, 57, 80, 22, 56, -59, 23, 36, -52, -74,
+  -26, -57, 16, -52, -75, -22, 33, -103, -4, -27, -6, -32, 38, 26, -19, -70, 101, -104, 67, 119, -30, 105, -79, 6, -27, -28, -3, -74, -78, -46, 1, 96,
+  -108, -47, -107, -16, 22, -80, -48, 13, -64, 112, -37, 27, -47, 6, -59, -59, -41, -65, 57, 82, -23, -88, -3, -24, 1, 35, -11, 20, 0, 61, 28, 51,
+  -64, 116, -3, 85, 31, -19, -22, -5, 42, -59, -103, 30, 90, -41, 23, -12, -13, -16, -30, -91, -127, -33, 22, -12, 44, -98, 71, 57, 45, 27, 30, 65,
+};
+const ALIGN(16) int32_t layer1_weight_sums[40] = {
+  -312, -548, 1646, -707, -598, -762, -981, -160,
+  -1755, -374, 131, 405, -26, -175, 423, 837,
+  -1288, -800, -1603, -852, -908, 627, 943, 678,
+  -611, 650, 651, -455, -1189, -1469, -1507, -1210,
+  -533, -1363, -1019, 797, 244, -1663, -788, -356,
+};
+const ALIGN(16) int32_t layer1_bias[40] = {
+  -75, 98, -144, 158, 162, 191, 154, -84,
+  179, -349, -62, -160, -118, -94, -103, -262,
+  -39, 241, -10, 168, 173, -217, -111, -96,
+  110, -189, -409, -181, 60, 293, 187, 33,
+  33, 209, 47, -75, -365, 207, 409, 114,
+};
+const ALIGN(16) int32_t layer1_multiplier[40] = {
+  1297250862, 1297675226, 1468871519, 1504153390, 1461334812, 1254528073, 1279372894, 1272232526,
+  1345189636, 1111476894, 1282071599, 1132548625, 1634043036, 1255981124, 1379827539, 1104830999,
+  1302899999, 1168208283, 1429607502, 1089399617, 1367989581, 1193311569, 1363356046, 1446286783,
+  1409768926, 1259452394, 1985690977, 1270973690, 1343769393, 1197226830, 1233952279, 1558721655,
+  1442822934, 1677778108, 1268811250, 1644618936, 2000871802, 1584509528, 1341828021, 1256433610,
+};
+const ALIGN(16) int32_t layer1_shift[40] = {
+  -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9,
+  -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -10, -9, -9, -9, -9, -9,
+  -9, -9, -9, -9, -10, -9, -9, -9,
+};
+
+const ALIGN(16) int8_t layer2_weights[200] = {
+  -65, -35, -127, 16, 39, 62, -10, -98, 30, -27, -125, -2, -56, -82, -102, 6, -90, 74, -18, 15, 56, -46, 51, -53, 27, 34, 28, -82, 35, 53, 73, -8,
+  -67, 106, -46, 19, -60, 103, 64, 64, 36, -117, 69, -80, -2, 27, -127, 58, -97, 54, 67, 84, 57, 68, 11, 95, -67, 41, -50, 0, -64, 52, 73, 67,
+  -4, 58, 62, 44, 68, -117, -74, -5, -85, -14, -45, 13, 79, -20, -99, 90, -92, 76, 37, 2, 10, -65, 4, 77, 98, -68, 65, -81, 74, -125, 20, -54,
+  13, 91, 124, 71, -31, -91, 24, 53, -97, -55, -45, -101, 115, -88, -64, -108, 18, -103, 47, -127, -15, -31, 60, 95, -64, 17, 39, 46, 13, 28, 49, -92,
+  -92, -51, 64, 66, 3, 3, 0, 47, 69, -63, -28, -101, 86, -23, -20, 44, -67, 20, -43, -45, -64, -127, -34, -52, 26, -90, 74, -29, -77, -25, -52, 6,
+  42, 73, 52, 22, -127, -108, 36, 76, -11, -83, -65, -37, 64, 82, -87, -87, -21, -54, -29, 79, 77, 36, -116, -92, 15, -100, -79, 36, -86, 34, 74, 42,
+  33, -63, -90, -115, -88, -4, 60, -89,
+};
+const ALIGN(16) int32_t layer2_weight_sums[5] = {
+  -244, 206, -267, -539, -698,
+};
+const ALIGN(16) int32_t layer2_bias[5] = {
+  86, -199, -1, 20, 37,
+};
+const ALIGN(16) int32_t layer2_multiplier[5] = {
+  1150382605, 1580448200, 1851305802, 1186602322, 1977667836,
+};
+const ALIGN(16) int32_t layer2_shift[5] = {
+  -8, -9, -9, -8, -9,
+};
+
+const tflite::int8_simd::FullyConnectedParams layers[3] = {
+  { 900, 80, layer0_weights, layer0_weight_sums, layer0_bias, layer0_multiplier, layer0_shift, -31, -128, -128, 127 },
+  { 80, 40, layer1_weights, layer1_weight_sums, layer1_bias, layer1_multiplier, layer1_shift, 128, -128, -128, 127 },
+  { 40, 5, layer2_weights, layer2_weight_sums, layer2_bias, layer2_multiplier, layer2_shift, 128, 39, -128, 127 },
+};
+
+} // namespace
+
+const trained_model_int8_t trained_model_int8 = {
+  0.320358604, 31, 3.11518407, 39, 1, 3, layers
+};
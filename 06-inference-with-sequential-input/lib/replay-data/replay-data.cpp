@@ -0,0 +1,1207 @@
+/**
+ * Columnar loader definition
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+#include <vector>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#ifdef _WIN32
+    #include <windows.h>
+    #include <malloc.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
+
+#include "replay-data.h"
+
+// Columns are aligned to (and padded to a multiple of) one cache line
+#define COLUMN_ALIGN_BYTES      64
+#define COLUMN_ALIGN_FLOATS     (COLUMN_ALIGN_BYTES / sizeof(float))
+
+// Header names for each column (same order as ReplayData::Column)
+static const char *column_names[REPLAY_NUM_COLUMNS] = {
+    "timestamp",
+    "accX",
+    "accY",
+    "accZ",
+    "gyrX",
+    "gyrY",
+    "gyrZ"
+};
+
+// Powers of 10 that can be represented exactly by a double
+static const double pow10_table[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+// The binary format is written and read as-is, so the layout must not change
+static_assert(sizeof(ReplayBinHeader) == 64, "ReplayBinHeader must be 64 bytes");
+static_assert(sizeof(ReplayBinChannel) == 32, "ReplayBinChannel must be 32 bytes");
+
+// Copy-on-write view of a whole file (writes never reach the file)
+struct FileMap {
+    char *data;
+    size_t len;
+#ifdef _WIN32
+    HANDLE file;
+    HANDLE mapping;
+#endif
+};
+
+/*******************************************************************************
+ * Private functions
+ */
+
+// Map a file into memory. Returns 0 on success, -1 on failure.
+static int map_file(const char *path, FileMap &map) {
+
+    map.data = 0;
+    map.len = 0;
+
+#ifdef _WIN32
+    LARGE_INTEGER size;
+
+    map.file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL,
+                            OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    map.mapping = NULL;
+    if (map.file == INVALID_HANDLE_VALUE) {
+        return -1;
+    }
+    if (!GetFileSizeEx(map.file, &size)) {
+        CloseHandle(map.file);
+        return -1;
+    }
+    map.len = (size_t)size.QuadPart;
+    if (map.len == 0) {
+        return 0;
+    }
+    map.mapping = CreateFileMappingA(map.file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+    if (map.mapping == NULL) {
+        CloseHandle(map.file);
+        return -1;
+    }
+    map.data = (char *)MapViewOfFile(map.mapping, FILE_MAP_COPY, 0, 0, 0);
+    if (map.data == NULL) {
+        CloseHandle(map.mapping);
+        CloseHandle(map.file);
+        return -1;
+    }
+#else
+    struct stat st;
+    void *addr;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return -1;
+    }
+    map.len = (size_t)st.st_size;
+    if (map.len == 0) {
+        close(fd);
+        return 0;
+    }
+    addr = mmap(NULL, map.len, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        return -1;
+    }
+    madvise(addr, map.len, MADV_SEQUENTIAL);
+    map.data = (char *)addr;
+#endif
+
+    return 0;
+}
+
+// Release a mapping created by map_file()
+static void unmap_file(FileMap &map) {
+#ifdef _WIN32
+    if (map.data != 0) {
+        UnmapViewOfFile(map.data);
+        CloseHandle(map.mapping);
+    }
+    if (map.file != INVALID_HANDLE_VALUE) {
+        CloseHandle(map.file);
+    }
+#else
+    if (map.data != 0) {
+        munmap(map.data, map.len);
+    }
+#endif
+    map.data = 0;
+    map.len = 0;
+}
+
+// Allocate memory aligned to a cache line
+static float *alloc_aligned(size_t num_floats) {
+#ifdef _WIN32
+    return (float *)_aligned_malloc(num_floats * sizeof(float), COLUMN_ALIGN_BYTES);
+#else
+    void *ptr = 0;
+    if (posix_memalign(&ptr, COLUMN_ALIGN_BYTES, num_floats * sizeof(float)) != 0) {
+        return 0;
+    }
+    return (float *)ptr;
+#endif
+}
+
+// Free memory from alloc_aligned()
+static void free_aligned(float *ptr) {
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    free(ptr);
+#endif
+}
+
+// Let the OS drop the pages of a mapping that we have finished reading, from
+// released up to (but not including) the page that holds upto. Pages are read
+// back in from the file if they are touched again.
+static void release_pages(char *&released, const char *upto) {
+#ifndef _WIN32
+    static const uintptr_t page_mask = ~((uintptr_t)sysconf(_SC_PAGESIZE) - 1);
+    char *page = (char *)((uintptr_t)upto & page_mask);
+
+    if (page > released) {
+        madvise(released, page - released, MADV_DONTNEED);
+        released = page;
+    }
+#else
+    (void)released;
+    (void)upto;
+#endif
+}
+
+// Count the lines in a buffer (a last line without a newline still counts)
+static size_t count_lines(const char *data, size_t len) {
+
+    size_t num_lines = 0;
+    const char *p = data;
+    const char *end = data + len;
+
+    while (p < end) {
+        p = (const char *)memchr(p, '\n', end - p);
+        num_lines++;
+        if (p == 0) {
+            break;
+        }
+        p++;
+    }
+
+    return num_lines;
+}
+
+// Returns true if the mapped file is a binary recording
+static bool is_binary(const FileMap &map) {
+    return (map.len >= sizeof(ReplayBinHeader)) &&
+        (memcmp(map.data, REPLAY_BIN_MAGIC, 4) == 0);
+}
+
+// Return our column for a binary channel name (or -1 to ignore it)
+static int find_bin_column(const char *name) {
+    for (int i = 0; i < REPLAY_NUM_COLUMNS; i++) {
+        if (strncmp(name, column_names[i], REPLAY_BIN_NAME_LEN) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Bytes taken up by one (padded) column in a binary recording
+static size_t bin_column_bytes(const ReplayBinHeader &hdr) {
+    size_t elem_size = (hdr.sample_format == REPLAY_BIN_INT16) ? 
+                        sizeof(int16_t) : sizeof(float);
+    size_t len = hdr.num_frames * elem_size;
+    return (len + REPLAY_BIN_ALIGN - 1) & ~((size_t)REPLAY_BIN_ALIGN - 1);
+}
+
+// Make sure a binary recording is one we can read and has every channel.
+// Returns 0 if so, otherwise a description of the problem.
+static const char *check_bin_header(const char *data, size_t len) {
+
+    ReplayBinHeader hdr;
+    ReplayBinChannel chan;
+    bool found[REPLAY_NUM_COLUMNS] = {false};
+    int col;
+
+    memcpy(&hdr, data, sizeof(hdr));
+    if (hdr.version > REPLAY_BIN_VERSION) {
+        return "Unsupported binary format version in";
+    }
+    if (((hdr.sample_format != REPLAY_BIN_FLOAT32) && 
+            (hdr.sample_format != REPLAY_BIN_INT16)) ||
+        (hdr.num_channels > 64) ||
+        (hdr.header_size % REPLAY_BIN_ALIGN != 0) ||
+        (hdr.header_size < sizeof(hdr) + 
+            (hdr.num_channels * sizeof(ReplayBinChannel))) ||
+        (hdr.num_frames > (len / sizeof(int16_t))) ||
+        (hdr.header_size + (hdr.num_channels * bin_column_bytes(hdr)) > len)) {
+        return "Bad header in";
+    }
+
+    // Every channel (and the timestamps, if stored) must be there once
+    found[ReplayData::TIME] = (hdr.flags & REPLAY_BIN_FLAG_UNIFORM_TIME) != 0;
+    for (uint32_t i = 0; i < hdr.num_channels; i++) {
+        memcpy(&chan, data + sizeof(hdr) + (i * sizeof(chan)), sizeof(chan));
+        col = find_bin_column(chan.name);
+        if (col >= 0) {
+            if (found[col]) {
+                return "Duplicate column in";
+            }
+            found[col] = true;
+        }
+    }
+    for (int i = 0; i < REPLAY_NUM_COLUMNS; i++) {
+        if (!found[i]) {
+            return "Missing column in";
+        }
+    }
+
+    return 0;
+}
+
+// Timestamp i of a recording with uniform timestamps
+static inline float bin_uniform_time(const ReplayBinHeader &hdr, size_t i) {
+    return (float)(hdr.time_start_ms + ((double)hdr.time_step_ms * i));
+}
+
+// Convert a stored int16 back to a reading (in double, so that decimal scales
+// like 0.01 bring back the original float)
+static inline float int16_to_float(long raw, double scale, double offset) {
+    return (float)(((double)raw * scale) + offset);
+}
+
+// Pick the scale and offset for storing a column as int16. Decimal scales are
+// tried first (CSV readings usually have a fixed number of decimal places), and
+// the first one that brings back every value exactly is used. Otherwise the
+// values are spread over the full range of the type, which is lossy.
+static void choose_int16_scale(const float *vals, size_t count, 
+                                ReplayBinChannel &chan) {
+
+    static const double decimal_scales[] = {0.001, 0.01, 0.1, 1.0, 10.0};
+    float min_val = vals[0];
+    float max_val = vals[0];
+    double scale;
+    bool exact;
+
+    for (size_t i = 1; i < count; i++) {
+        min_val = (vals[i] < min_val) ? vals[i] : min_val;
+        max_val = (vals[i] > max_val) ? vals[i] : max_val;
+    }
+
+    // Try the decimal scales (finest first)
+    for (size_t s = 0; s < sizeof(decimal_scales) / sizeof(double); s++) {
+        scale = decimal_scales[s];
+        if ((fabs(min_val) / scale > 32767.0) ||
+            (fabs(max_val) / scale > 32767.0)) {
+            continue;
+        }
+        exact = true;
+        for (size_t i = 0; exact && (i < count); i++) {
+            exact = (int16_to_float(lrint(vals[i] / scale), scale, 0.0) == vals[i]);
+        }
+        if (exact) {
+            chan.scale = scale;
+            chan.offset = 0.0;
+            return;
+        }
+    }
+
+    // Fall back to the full range between the smallest and largest value
+    chan.offset = ((double)min_val + max_val) / 2.0;
+    chan.scale = ((double)max_val - min_val) / 65534.0;
+    if (chan.scale <= 0.0) {
+        chan.scale = 1.0;
+    }
+}
+
+// Returns true if c ends a field
+static inline bool is_field_end(char c) {
+    return (c == ',') || (c == '\r') || (c == '\n');
+}
+
+// Skip spaces and tabs
+static inline const char *skip_blanks(const char *p, const char *end) {
+    while ((p < end) && ((*p == ' ') || (*p == '\t'))) {
+        p++;
+    }
+    return p;
+}
+
+// Parse a decimal number ("-1.25", "3e-2", etc.) that ends at the end of the
+// field. Anything unusual (nan, inf, hex, very long mantissas or exponents) is
+// handed to strtod(). An empty field is read as 0. Returns a pointer to the
+// character after the field, or 0 if the field is not a number.
+static const char *parse_float(const char *p, const char *end, float &x) {
+
+    const char *start;
+    bool is_neg = false;
+    uint64_t mantissa = 0;
+    int num_digits = 0;
+    int exp10 = 0;
+    int exp_val = 0;
+    bool exp_neg = false;
+    char buf[64];
+    char *buf_end;
+    size_t len;
+    double val;
+
+    p = skip_blanks(p, end);
+    start = p;
+
+    // Sign
+    if ((p < end) && ((*p == '-') || (*p == '+'))) {
+        is_neg = (*p == '-');
+        p++;
+    }
+
+    // Integer part
+    while ((p < end) && (*p >= '0') && (*p <= '9')) {
+        if (num_digits < 19) {
+            mantissa = (mantissa * 10) + (*p - '0');
+            if (mantissa != 0) {
+                num_digits++;
+            }
+        } else {
+            exp10++;
+        }
+        p++;
+    }
+
+    // Fractional part
+    if ((p < end) && (*p == '.')) {
+        p++;
+        while ((p < end) && (*p >= '0') && (*p <= '9')) {
+            if (num_digits < 19) {
+                mantissa = (mantissa * 10) + (*p - '0');
+                if (mantissa != 0) {
+                    num_digits++;
+                }
+                exp10--;
+            }
+            p++;
+        }
+    }
+
+    // Exponent
+    if ((p < end) && ((*p == 'e') || (*p == 'E'))) {
+        p++;
+        if ((p < end) && ((*p == '-') || (*p == '+'))) {
+            exp_neg = (*p == '-');
+            p++;
+        }
+        while ((p < end) && (*p >= '0') && (*p <= '9')) {
+            if (exp_val < 10000) {
+                exp_val = (exp_val * 10) + (*p - '0');
+            }
+            p++;
+        }
+        exp10 += exp_neg ? -exp_val : exp_val;
+    }
+    p = skip_blanks(p, end);
+
+    // Fast path: the mantissa and power of 10 are exact, so one double
+    // operation gives the correctly rounded result
+    if (((p == end) || is_field_end(*p)) &&
+        (mantissa < (1ULL << 53)) &&
+        (exp10 >= -22) && (exp10 <= 22)) {
+        val = (double)mantissa;
+        if (exp10 < 0) {
+            val /= pow10_table[-exp10];
+        } else {
+            val *= pow10_table[exp10];
+        }
+        x = (float)(is_neg ? -val : val);
+        return p;
+    }
+
+    // Slow path: copy the field and let the C library deal with it
+    p = start;
+    while ((p < end) && !is_field_end(*p)) {
+        p++;
+    }
+    len = p - start;
+    while ((len > 0) && ((start[len - 1] == ' ') || (start[len - 1] == '\t'))) {
+        len--;
+    }
+    if (len >= sizeof(buf)) {
+        return 0;
+    }
+    memcpy(buf, start, len);
+    buf[len] = '\0';
+    val = strtod(buf, &buf_end);
+    if ((len > 0) && (*buf_end != '\0')) {
+        return 0;
+    }
+    x = (float)val;
+
+    return p;
+}
+
+// Skip line endings and blank lines
+static inline const char *skip_line_ends(const char *p, const char *end) {
+    while ((p < end) && ((*p == '\n') || (*p == '\r'))) {
+        p++;
+    }
+    return p;
+}
+
+// Map each field of a CSV header to one of our columns (or -1 to ignore it).
+// Returns a pointer to the end of the header line, or 0 on error (with a
+// description in err).
+static const char *parse_csv_header(const char *p, const char *end, 
+                                    std::vector<int> &field_cols, 
+                                    const char **err) {
+
+    const char *field_start;
+    const char *field_end;
+    bool found[REPLAY_NUM_COLUMNS] = {false};
+    int col;
+
+    // Skip a UTF-8 byte order mark if there is one
+    if ((end - p >= 3) && (memcmp(p, "\xEF\xBB\xBF", 3) == 0)) {
+        p += 3;
+    }
+
+    field_cols.clear();
+    while ((p < end) && (*p != '\n')) {
+        field_start = skip_blanks(p, end);
+        field_end = field_start;
+        while ((field_end < end) && !is_field_end(*field_end)) {
+            field_end++;
+        }
+        p = field_end;
+        while ((field_end > field_start) &&
+                ((field_end[-1] == ' ') || (field_end[-1] == '\t'))) {
+            field_end--;
+        }
+        col = -1;
+        for (int i = 0; i < REPLAY_NUM_COLUMNS; i++) {
+            if ((strlen(column_names[i]) == (size_t)(field_end - field_start)) &&
+                (memcmp(column_names[i], field_start, field_end - field_start) == 0)) {
+                if (found[i]) {
+                    *err = "Duplicate column in";
+                    return 0;
+                }
+                found[i] = true;
+                col = i;
+                break;
+            }
+        }
+        field_cols.push_back(col);
+        if ((p < end) && ((*p == ',') || (*p == '\r'))) {
+            p++;
+        }
+    }
+    for (int i = 0; i < REPLAY_NUM_COLUMNS; i++) {
+        if (!found[i]) {
+            *err = "Missing column in";
+            return 0;
+        }
+    }
+
+    return p;
+}
+
+// Parse one CSV row (starting at the first field), storing each value we have
+// a column for in *row[col]. Returns a pointer to the end of the line, or 0
+// on error (with a description in err).
+static const char *parse_csv_row(const char *p, const char *end, 
+                                const std::vector<int> &field_cols, 
+                                float **row, 
+                                const char **err) {
+
+    size_t field_idx = 0;
+    int col;
+
+    // Read every field, keeping the ones we have a column for
+    while (true) {
+        if (field_idx < field_cols.size()) {
+            col = field_cols[field_idx];
+        } else {
+            col = -1;
+        }
+        if (col >= 0) {
+            p = parse_float(p, end, *row[col]);
+            if (p == 0) {
+                *err = "Bad number in";
+                return 0;
+            }
+        } else {
+            while ((p < end) && !is_field_end(*p)) {
+                p++;
+            }
+        }
+        field_idx++;
+        if ((p < end) && (*p == ',')) {
+            p++;
+        } else {
+            break;
+        }
+    }
+    if (field_idx < field_cols.size()) {
+        *err = "Too few columns in";
+        return 0;
+    }
+
+    return p;
+}
+
+/*******************************************************************************
+ * Public methods
+ */
+
+// Constructor
+ReplayData::ReplayData() {
+
+}
+
+// Destructor
+ReplayData::~ReplayData() {
+    releaseMap();
+    free_aligned(block);
+}
+
+// Replace the current readings with the rows of all the given files
+int ReplayData::load(char **paths, int num_paths) {
+
+    std::vector<FileMap> maps(num_paths);
+    ReplayBinHeader hdr;
+    size_t max_rows = 0;
+    int ret = 0;
+
+    clear();
+
+    // Map every file and count readings to find out how much room we need
+    for (int i = 0; i < num_paths; i++) {
+        if (map_file(paths[i], maps[i]) != 0) {
+            setError("Could not open", paths[i]);
+            ret = -1;
+        } else if (is_binary(maps[i])) {
+            ret = checkBinary(paths[i], maps[i].data, maps[i].len);
+            memcpy(&hdr, maps[i].data, sizeof(hdr));
+            max_rows += hdr.num_frames;
+        } else {
+            max_rows += count_lines(maps[i].data, maps[i].len);
+        }
+        if (ret != 0) {
+            for (int j = 0; j < i; j++) {
+                unmap_file(maps[j]);
+            }
+            return -1;
+        }
+    }
+
+    // A single float32 recording can be replayed without copying anything
+    if ((num_paths == 1) && is_binary(maps[0])) {
+        memcpy(&hdr, maps[0].data, sizeof(hdr));
+        if (hdr.sample_format == REPLAY_BIN_FLOAT32) {
+            ret = mapBinary(paths[0], maps[0].data, maps[0].len);
+            if (ret == 0) {
+                zero_copy_map = new FileMap(maps[0]);
+            } else {
+                unmap_file(maps[0]);
+            }
+            return ret;
+        }
+    }
+
+    // Allocate all the columns at once
+    if (reserve(max_rows, REPLAY_NUM_COLUMNS) != 0) {
+        setError("Out of memory loading", paths[0]);
+        ret = -1;
+    }
+
+    // Parse (or copy) the files in order
+    for (int i = 0; i < num_paths; i++) {
+        if (ret == 0) {
+            if (is_binary(maps[i])) {
+                ret = parseBinary(paths[i], maps[i].data, maps[i].len);
+            } else {
+                ret = parseCsv(paths[i], maps[i].data, maps[i].len);
+            }
+        }
+        unmap_file(maps[i]);
+    }
+    if (ret != 0) {
+        count = 0;
+    }
+
+    return ret;
+}
+
+// Throw away all readings (memory is kept for the next load)
+void ReplayData::clear() {
+    releaseMap();
+    for (int col = 0; col < REPLAY_NUM_COLUMNS; col++) {
+        columns[col] = 0;
+    }
+    count = 0;
+    error_msg[0] = '\0';
+}
+
+// Write the current readings as a binary recording
+int ReplayData::saveBinary(const char *path, int sample_format, const char *label) {
+
+    ReplayBinHeader hdr;
+    ReplayBinChannel chans[REPLAY_NUM_COLUMNS];
+    int chan_cols[REPLAY_NUM_COLUMNS];
+    uint32_t num_chans = 0;
+    const float *times = columns[TIME];
+    static const char zeros[REPLAY_BIN_ALIGN] = {0};
+    size_t col_bytes, pad_bytes;
+    bool ok;
+    int16_t raw;
+    FILE *fp;
+
+    if (count == 0) {
+        setError("No readings to save to", path);
+        return -1;
+    }
+    if ((sample_format != REPLAY_BIN_FLOAT32) && 
+        (sample_format != REPLAY_BIN_INT16)) {
+        setError("Unknown sample format for", path);
+        return -1;
+    }
+
+    // Fill out the header (the sample rate comes from the first two readings,
+    // the same way the harness works it out)
+    memset(&hdr, 0, sizeof(hdr));
+    memcpy(hdr.magic, REPLAY_BIN_MAGIC, 4);
+    hdr.version = REPLAY_BIN_VERSION;
+    hdr.sample_format = sample_format;
+    hdr.num_frames = count;
+    hdr.time_start_ms = times[0];
+    if (count > 1) {
+        hdr.time_step_ms = times[1] - times[0];
+    }
+    if (label != 0) {
+        strncpy(hdr.label, label, REPLAY_BIN_LABEL_LEN - 1);
+    }
+
+    // Don't store timestamps if they can be recreated exactly
+    hdr.flags = REPLAY_BIN_FLAG_UNIFORM_TIME;
+    for (size_t i = 0; i < count; i++) {
+        if (times[i] != bin_uniform_time(hdr, i)) {
+            hdr.flags &= ~REPLAY_BIN_FLAG_UNIFORM_TIME;
+            break;
+        }
+    }
+    hdr.sample_rate_hz = (hdr.time_step_ms > 0.0f) ? 
+                            (1000.0f / hdr.time_step_ms) : 0.0f;
+
+    // Describe each stored column
+    memset(chans, 0, sizeof(chans));
+    for (int col = 0; col < REPLAY_NUM_COLUMNS; col++) {
+        if ((col == TIME) && (hdr.flags & REPLAY_BIN_FLAG_UNIFORM_TIME)) {
+            continue;
+        }
+        strncpy(chans[num_chans].name, column_names[col], REPLAY_BIN_NAME_LEN);
+        chans[num_chans].scale = 1.0;
+        chans[num_chans].offset = 0.0;
+        if (sample_format == REPLAY_BIN_INT16) {
+            choose_int16_scale(columns[col], count, chans[num_chans]);
+        }
+        chan_cols[num_chans] = col;
+        num_chans++;
+    }
+    hdr.num_channels = num_chans;
+    hdr.header_size = (sizeof(hdr) + (num_chans * sizeof(ReplayBinChannel)) + 
+                        REPLAY_BIN_ALIGN - 1) & ~(REPLAY_BIN_ALIGN - 1);
+
+    // Write the header and channel descriptions
+    fp = fopen(path, "wb");
+    if (fp == 0) {
+        setError("Could not create", path);
+        return -1;
+    }
+    ok = (fwrite(&hdr, sizeof(hdr), 1, fp) == 1);
+    ok = ok && (fwrite(chans, sizeof(ReplayBinChannel), num_chans, fp) == num_chans);
+    pad_bytes = hdr.header_size - sizeof(hdr) - (num_chans * sizeof(ReplayBinChannel));
+    ok = ok && (fwrite(zeros, 1, pad_bytes, fp) == pad_bytes);
+
+    // Write each column followed by its padding
+    col_bytes = bin_column_bytes(hdr);
+    for (uint32_t c = 0; ok && (c < num_chans); c++) {
+        if (sample_format == REPLAY_BIN_FLOAT32) {
+            ok = (fwrite(columns[chan_cols[c]], sizeof(float), count, fp) == count);
+            pad_bytes = col_bytes - (count * sizeof(float));
+        } else {
+            for (size_t i = 0; ok && (i < count); i++) {
+                raw = (int16_t)lrint((columns[chan_cols[c]][i] - chans[c].offset) / 
+                                        chans[c].scale);
+                ok = (fwrite(&raw, sizeof(raw), 1, fp) == 1);
+            }
+            pad_bytes = col_bytes - (count * sizeof(int16_t));
+        }
+        ok = ok && (fwrite(zeros, 1, pad_bytes, fp) == pad_bytes);
+    }
+    if ((fclose(fp) != 0) || !ok) {
+        setError("Could not write", path);
+        return -1;
+    }
+
+    return 0;
+}
+
+/*******************************************************************************
+ * Private methods
+ */
+
+// Make room for the given number of rows in the first num_columns columns
+int ReplayData::reserve(size_t rows, int num_columns) {
+
+    size_t col_stride;
+
+    // Pad each column to a multiple of a cache line
+    col_stride = (rows + COLUMN_ALIGN_FLOATS - 1) & ~(COLUMN_ALIGN_FLOATS - 1);
+    if (col_stride == 0) {
+        col_stride = COLUMN_ALIGN_FLOATS;
+    }
+
+    // Only allocate if the old block is too small
+    if ((col_stride * num_columns) > capacity) {
+        free_aligned(block);
+        block = alloc_aligned(col_stride * num_columns);
+        capacity = (block != 0) ? (col_stride * num_columns) : 0;
+        if (block == 0) {
+            return -1;
+        }
+    }
+    for (int col = 0; col < num_columns; col++) {
+        columns[col] = &block[col * col_stride];
+    }
+
+    return 0;
+}
+
+// Parse the header and rows of a CSV file and append them to the columns
+int ReplayData::parseCsv(const char *path, const char *data, size_t len) {
+
+    std::vector<int> field_cols;
+    float *row[REPLAY_NUM_COLUMNS];
+    const char *p = data;
+    const char *end = data + len;
+    const char *err = 0;
+
+    // Map each header field to one of our columns
+    p = parse_csv_header(p, end, field_cols, &err);
+
+    // Parse one row per line
+    while ((p != 0) && ((p = skip_line_ends(p, end)) < end)) {
+        for (int col = 0; col < REPLAY_NUM_COLUMNS; col++) {
+            row[col] = &columns[col][count];
+        }
+        p = parse_csv_row(p, end, field_cols, row, &err);
+        if (p != 0) {
+            count++;
+        }
+    }
+    if (p == 0) {
+        setError(err, path);
+        return -1;
+    }
+
+    return 0;
+}
+
+// Make sure a binary recording is one we can read and has every channel
+int ReplayData::checkBinary(const char *path, const char *data, size_t len) {
+
+    const char *err = check_bin_header(data, len);
+
+    if (err != 0) {
+        setError(err, path);
+        return -1;
+    }
+
+    return 0;
+}
+
+// Point the columns straight into a float32 recording (already checked)
+int ReplayData::mapBinary(const char *path, const char *data, size_t len) {
+
+    ReplayBinHeader hdr;
+    ReplayBinChannel chan;
+    size_t col_bytes;
+    int col;
+
+    memcpy(&hdr, data, sizeof(hdr));
+    col_bytes = bin_column_bytes(hdr);
+
+    // Uniform timestamps have to be recreated in memory
+    if (hdr.flags & REPLAY_BIN_FLAG_UNIFORM_TIME) {
+        if (reserve(hdr.num_frames, 1) != 0) {
+            setError("Out of memory loading", path);
+            return -1;
+        }
+        for (size_t i = 0; i < hdr.num_frames; i++) {
+            columns[TIME][i] = bin_uniform_time(hdr, i);
+        }
+    }
+
+    // Everything else is used in place (columns are aligned in the file)
+    for (uint32_t i = 0; i < hdr.num_channels; i++) {
+        memcpy(&chan, data + sizeof(hdr) + (i * sizeof(chan)), sizeof(chan));
+        col = find_bin_column(chan.name);
+        if (col >= 0) {
+            columns[col] = (float *)(data + hdr.header_size + (i * col_bytes));
+        }
+    }
+    count = hdr.num_frames;
+
+    return 0;
+}
+
+// Copy (and convert) the columns of a binary recording (already checked)
+int ReplayData::parseBinary(const char *path, const char *data, size_t len) {
+
+    ReplayBinHeader hdr;
+    ReplayBinChannel chan;
+    const char *src;
+    const int16_t *raw;
+    size_t col_bytes;
+    float *dst;
+    int col;
+
+    memcpy(&hdr, data, sizeof(hdr));
+    col_bytes = bin_column_bytes(hdr);
+
+    // Recreate uniform timestamps
+    if (hdr.flags & REPLAY_BIN_FLAG_UNIFORM_TIME) {
+        for (size_t i = 0; i < hdr.num_frames; i++) {
+            columns[TIME][count + i] = bin_uniform_time(hdr, i);
+        }
+    }
+
+    // Copy or convert each stored column
+    for (uint32_t i = 0; i < hdr.num_channels; i++) {
+        memcpy(&chan, data + sizeof(hdr) + (i * sizeof(chan)), sizeof(chan));
+        col = find_bin_column(chan.name);
+        if (col < 0) {
+            continue;
+        }
+        src = data + hdr.header_size + (i * col_bytes);
+        dst = &columns[col][count];
+        if (hdr.sample_format == REPLAY_BIN_FLOAT32) {
+            memcpy(dst, src, hdr.num_frames * sizeof(float));
+        } else {
+            raw = (const int16_t *)src;
+            for (size_t j = 0; j < hdr.num_frames; j++) {
+                dst[j] = int16_to_float(raw[j], chan.scale, chan.offset);
+            }
+        }
+    }
+    count += hdr.num_frames;
+
+    return 0;
+}
+
+// Release the recording that the columns point into (if any)
+void ReplayData::releaseMap() {
+    if (zero_copy_map != 0) {
+        unmap_file(*(FileMap *)zero_copy_map);
+        delete (FileMap *)zero_copy_map;
+        zero_copy_map = 0;
+    }
+}
+
+// Remember what went wrong
+void ReplayData::setError(const char *msg, const char *path) {
+    snprintf(error_msg, sizeof(error_msg), "%s %s", msg, path);
+}
+
+/*******************************************************************************
+ * Streaming
+ */
+
+// Constructor
+ReplayStream::ReplayStream() {
+
+}
+
+// Destructor
+ReplayStream::~ReplayStream() {
+    close();
+}
+
+// Start reading the given files on a background thread
+int ReplayStream::open(char **paths, int num_paths, size_t window_rows) {
+
+    FILE *fp;
+
+    close();
+    error_msg[0] = '\0';
+
+    // Complain about missing files now rather than part way through a replay
+    for (int i = 0; i < num_paths; i++) {
+        fp = fopen(paths[i], "rb");
+        if (fp == 0) {
+            setError("Could not open", paths[i]);
+            return -1;
+        }
+        fclose(fp);
+    }
+
+    // Rows are stored one after the other in a ring buffer
+    if (window_rows < 16) {
+        window_rows = 16;
+    }
+    ring = alloc_aligned(window_rows * REPLAY_NUM_COLUMNS);
+    if (ring == 0) {
+        setError("Out of memory streaming", paths[0]);
+        return -1;
+    }
+    this->paths = paths;
+    this->num_paths = num_paths;
+    window = window_rows;
+    written = 0;
+    write_limit = window;
+    produced = 0;
+    oldest = 0;
+    end_of_stream = false;
+    closing = false;
+    reader = std::thread(&ReplayStream::readerMain, this);
+
+    // Wait for the first two rows to work out the sample rate
+    std::unique_lock<std::mutex> guard(lock);
+    while (!end_of_stream && (produced < 2)) {
+        rows_ready.wait(guard);
+    }
+    if (produced == 0) {
+        if (error_msg[0] == '\0') {
+            setError("No readings in", paths[0]);
+        }
+        guard.unlock();
+        close();
+        return -1;
+    }
+    if (produced >= 2) {
+        sample_rate = ring[REPLAY_NUM_COLUMNS + ReplayData::TIME] - 
+                        ring[ReplayData::TIME];
+    } else {
+        sample_rate = 0.0f;
+    }
+
+    return 0;
+}
+
+// Stop the reader and free the window
+void ReplayStream::close() {
+
+    if (reader.joinable()) {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            closing = true;
+        }
+        space_ready.notify_all();
+        reader.join();
+    }
+    free_aligned(ring);
+    ring = 0;
+    window = 0;
+    produced = 0;
+}
+
+// Copy a row out of the window, waiting for the reader if needed
+int ReplayStream::read(size_t idx, float *row) {
+
+    std::unique_lock<std::mutex> guard(lock);
+    size_t keep_from;
+
+    if (ring == 0) {
+        return -1;
+    }
+
+    // Let the reader reuse rows we won't go back to (before waiting, so there
+    // is always room for the row we want)
+    keep_from = (idx > (window / 4)) ? idx - (window / 4) : 0;
+    if (keep_from > oldest) {
+        oldest = keep_from;
+        space_ready.notify_one();
+    }
+
+    // Wait until we know whether this is the last row
+    while (!end_of_stream && (idx + 1 >= produced)) {
+        rows_ready.wait(guard);
+    }
+    if (produced == 0) {
+        return -1;
+    }
+
+    // Past the end gives the last row (the reader has stopped, so it is still
+    // in the window)
+    if (idx >= produced) {
+        idx = produced - 1;
+    } else if (idx < oldest) {
+        idx = oldest;
+    }
+    memcpy(row, &ring[(idx % window) * REPLAY_NUM_COLUMNS], 
+            REPLAY_NUM_COLUMNS * sizeof(float));
+
+    return (idx + 1 < produced) ? 1 : 0;
+}
+
+// Background thread that reads every file into the window
+void ReplayStream::readerMain() {
+
+    FileMap map;
+    int ret = 0;
+
+    for (int i = 0; (i < num_paths) && (ret == 0); i++) {
+        if (map_file(paths[i], map) != 0) {
+            setError("Could not open", paths[i]);
+            break;
+        }
+        if (is_binary(map)) {
+            ret = streamBinary(paths[i], map.data, map.len);
+        } else {
+            ret = streamCsv(paths[i], map.data, map.len);
+        }
+        unmap_file(map);
+    }
+
+    // Hand over whatever is left and let read() know there is no more
+    std::lock_guard<std::mutex> guard(lock);
+    produced = written;
+    end_of_stream = true;
+    rows_ready.notify_all();
+}
+
+// Parse the rows of a CSV file into the window
+int ReplayStream::streamCsv(const char *path, char *data, size_t len) {
+
+    std::vector<int> field_cols;
+    float *row[REPLAY_NUM_COLUMNS];
+    float *slot;
+    char *released = data;
+    const char *p = data;
+    const char *end = data + len;
+    const char *err = 0;
+
+    // Map each header field to one of our columns
+    p = parse_csv_header(p, end, field_cols, &err);
+
+    // Parse one row per line, giving back the file pages as we go
+    while ((p != 0) && ((p = skip_line_ends(p, end)) < end)) {
+        slot = nextSlot();
+        if (slot == 0) {
+            return -1;
+        }
+        if (written % REPLAY_STREAM_BATCH_ROWS == 0) {
+            release_pages(released, p);
+        }
+        for (int col = 0; col < REPLAY_NUM_COLUMNS; col++) {
+            row[col] = &slot[col];
+        }
+        p = parse_csv_row(p, end, field_cols, row, &err);
+        if (p != 0) {
+            written++;
+        }
+    }
+    if (p == 0) {
+        setError(err, path);
+        return -1;
+    }
+
+    return 0;
+}
+
+// Copy (and convert) the rows of a binary recording into the window
+int ReplayStream::streamBinary(const char *path, char *data, size_t len) {
+
+    ReplayBinHeader hdr;
+    ReplayBinChannel chans[64];
+    char *srcs[64];
+    char *released[64];
+    int cols[64];
+    const char *err;
+    size_t col_bytes, elem_size;
+    float *slot;
+
+    err = check_bin_header(data, len);
+    if (err != 0) {
+        setError(err, path);
+        return -1;
+    }
+    memcpy(&hdr, data, sizeof(hdr));
+    col_bytes = bin_column_bytes(hdr);
+    elem_size = (hdr.sample_format == REPLAY_BIN_INT16) ? 
+                sizeof(int16_t) : sizeof(float);
+    for (uint32_t i = 0; i < hdr.num_channels; i++) {
+        memcpy(&chans[i], data + sizeof(hdr) + (i * sizeof(chans[i])), 
+                sizeof(chans[i]));
+        cols[i] = find_bin_column(chans[i].name);
+        srcs[i] = data + hdr.header_size + (i * col_bytes);
+        released[i] = srcs[i];
+    }
+
+    // Gather one reading from each column at a time
+    for (size_t j = 0; j < hdr.num_frames; j++) {
+        slot = nextSlot();
+        if (slot == 0) {
+            return -1;
+        }
+        if (hdr.flags & REPLAY_BIN_FLAG_UNIFORM_TIME) {
+            slot[ReplayData::TIME] = bin_uniform_time(hdr, j);
+        }
+        for (uint32_t i = 0; i < hdr.num_channels; i++) {
+            if (cols[i] < 0) {
+                continue;
+            }
+            if (written % REPLAY_STREAM_BATCH_ROWS == 0) {
+                release_pages(released[i], srcs[i] + (j * elem_size));
+            }
+            if (hdr.sample_format == REPLAY_BIN_FLOAT32) {
+                memcpy(&slot[cols[i]], srcs[i] + (j * sizeof(float)), 
+                        sizeof(float));
+            } else {
+                slot[cols[i]] = int16_to_float(
+                    ((const int16_t *)srcs[i])[j], chans[i].scale, chans[i].offset);
+            }
+        }
+        written++;
+    }
+
+    return 0;
+}
+
+// Return the slot for the next row. Every batch (or when the window is full)
+// the rows so far are handed to read(), and we wait for room if needed.
+// Returns 0 if the stream is being closed.
+float *ReplayStream::nextSlot() {
+
+    if ((written % REPLAY_STREAM_BATCH_ROWS == 0) || (written >= write_limit)) {
+        std::unique_lock<std::mutex> guard(lock);
+        produced = written;
+        rows_ready.notify_all();
+        while (!closing && (written >= oldest + window)) {
+            space_ready.wait(guard);
+        }
+        if (closing) {
+            return 0;
+        }
+        write_limit = oldest + window;
+    }
+
+    return &ring[(written % window) * REPLAY_NUM_COLUMNS];
+}
+
+// Remember what went wrong
+void ReplayStream::setError(const char *msg, const char *path) {
+    snprintf(error_msg, sizeof(error_msg), "%s %s", msg, path);
+}
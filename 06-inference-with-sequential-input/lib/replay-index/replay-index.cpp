@@ -0,0 +1,144 @@
+/**
+ * Timestamp index definition
+ */
+
+#include <float.h>
+#include <math.h>
+
+#include "replay-index.h"
+
+// Constructor
+ReplayIndex::ReplayIndex() {
+
+}
+
+// Examine the timestamps and choose the fastest lookup method that is exact
+void ReplayIndex::build(const float *times, size_t count, size_t stride) {
+
+    double grid_time;
+
+    this->times = times;
+    this->count = count;
+    this->stride = stride;
+
+    // Nothing to look up
+    if ((times == 0) || (count == 0)) {
+        this->count = 0;
+        index_mode = MODE_EMPTY;
+        return;
+    }
+
+    // Timestamps that go backwards can only be searched linearly
+    for (size_t i = 1; i < count; i++) {
+        if (timeAt(i) < timeAt(i - 1)) {
+            index_mode = MODE_UNSORTED;
+            return;
+        }
+    }
+
+    // Fit a sampling grid through the first and last timestamps
+    first_time = timeAt(0);
+    period = (count > 1) ? (timeAt(count - 1) - first_time) / (count - 1) : 0.0;
+    if (period <= 0.0) {
+        index_mode = (count > 1) ? MODE_SORTED : MODE_UNIFORM;
+        return;
+    }
+
+    // The grid is only worth using if every reading sits within half a period
+    // of its grid point (plus float rounding for very long recordings), so
+    // the estimate is at most a reading or two away from the answer
+    index_mode = MODE_UNIFORM;
+    for (size_t i = 0; i < count; i++) {
+        grid_time = first_time + (period * i);
+        if (fabs(timeAt(i) - grid_time) > 
+            ((period / 2) + (fabs(grid_time) * FLT_EPSILON))) {
+            index_mode = MODE_SORTED;
+            break;
+        }
+    }
+}
+
+// Return the index of the reading closest to the given time
+size_t ReplayIndex::findClosest(double time_ms) const {
+
+    double pos;
+    size_t idx;
+
+    switch (index_mode) {
+        case MODE_UNIFORM:
+
+            // Estimate the position on the sampling grid
+            if ((count == 1) || (time_ms <= first_time)) {
+                idx = 0;
+            } else {
+                pos = (time_ms - first_time) / period;
+                if (pos >= (double)(count - 1)) {
+                    idx = count - 1;
+                } else {
+                    idx = (size_t)ceil(pos - 0.5);
+                }
+            }
+            return refine(time_ms, idx);
+        case MODE_SORTED:
+            return searchSorted(time_ms);
+        case MODE_UNSORTED:
+            return searchLinear(time_ms);
+        default:
+            return 0;
+    }
+}
+
+// Walk from an estimate to the closest reading. Distances to sorted timestamps
+// only fall and then rise, so walking downhill from anywhere finds the answer.
+size_t ReplayIndex::refine(double time_ms, size_t idx) const {
+
+    // Walk right to the last of the closest readings
+    while ((idx + 1 < count) &&
+        (fabs(time_ms - timeAt(idx + 1)) <= fabs(time_ms - timeAt(idx)))) {
+        idx++;
+    }
+
+    // Walk back left to the first of the closest readings (ties go earliest)
+    while ((idx > 0) &&
+        (fabs(time_ms - timeAt(idx - 1)) <= fabs(time_ms - timeAt(idx)))) {
+        idx--;
+    }
+
+    return idx;
+}
+
+// Binary search for the first reading at or after the given time
+size_t ReplayIndex::searchSorted(double time_ms) const {
+
+    size_t lo = 0;
+    size_t hi = count;
+    size_t mid;
+
+    while (lo < hi) {
+        mid = lo + ((hi - lo) / 2);
+        if (timeAt(mid) < time_ms) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo >= count) {
+        lo = count - 1;
+    }
+
+    return refine(time_ms, lo);
+}
+
+// Check every reading (same behavior as the original harness)
+size_t ReplayIndex::searchLinear(double time_ms) const {
+
+    size_t closest_idx = 0;
+
+    for (size_t i = 1; i < count; i++) {
+        if (fabs(time_ms - timeAt(i)) < fabs(time_ms - timeAt(closest_idx))) {
+            closest_idx = i;
+        }
+    }
+
+    return closest_idx;
+}
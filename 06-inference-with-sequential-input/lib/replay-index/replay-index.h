@@ -0,0 +1,65 @@
+/**
+ * Timestamp index for replaying recorded IMU readings.
+ *
+ * Finds the reading whose timestamp is closest to a requested time without
+ * scanning the whole recording. Recordings sampled at a fixed rate (which is
+ * what the harness produces) are looked up in constant time by computing the
+ * position on the sampling grid and checking its neighbors. Irregular but
+ * sorted timestamps fall back to a binary search, and unsorted timestamps to a
+ * linear scan. Ties always resolve to the earliest reading.
+ *
+ * License: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REPLAY_INDEX_H
+#define REPLAY_INDEX_H
+
+#include <stddef.h>
+
+class ReplayIndex {
+    public:
+        enum Mode {
+            MODE_EMPTY = 0,
+            MODE_UNIFORM,       // O(1) lookup on the sampling grid
+            MODE_SORTED,        // O(log n) binary search
+            MODE_UNSORTED       // O(n) linear scan
+        };
+
+        ReplayIndex();
+
+        // Index count timestamps spaced stride floats apart (the table is not
+        // copied, so it must outlive the index)
+        void build(const float *times, size_t count, size_t stride = 1);
+        size_t findClosest(double time_ms) const;
+
+        Mode mode() const { return index_mode; }
+        size_t size() const { return count; }
+    private:
+        inline double timeAt(size_t idx) const {
+            return times[idx * stride];
+        }
+        size_t refine(double time_ms, size_t idx) const;
+        size_t searchSorted(double time_ms) const;
+        size_t searchLinear(double time_ms) const;
+
+        const float *times = 0;
+        size_t count = 0;
+        size_t stride = 1;
+        Mode index_mode = MODE_EMPTY;
+        double first_time = 0.0;
+        double period = 0.0;
+};
+
+#endif // REPLAY_INDEX_H
@@ -0,0 +1,195 @@
+/**
+ * Batched classification benchmark
+ *
+ * Cuts every recording into overlapping windows (one window per slice, the
+ * way continuous inference sees them), standardizes them like submission.cpp
+ * and classifies every window twice: once with run_classifier() per window
+ * and once with run_classifier_batch(). Checks that both give exactly the
+ * same results and prints the throughput of each.
+ *
+ * Build and run with:
+ *
+ *  make batch
+ *  ./build/batch.out tests/alpha.2942e6abeec9.csv tests/beta.67ca58f8af8c.csv
+ *  ./build/batch.out --batch 8 --repeat 10 tests/alpha.2942e6abeec9.csv
+ *
+ * License: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+
+#include <chrono>
+#include <vector>
+
+#include "replay-data.h"
+#include "edge-impulse-sdk/classifier/ei_run_classifier.h"
+
+// Settings
+#define DEFAULT_BATCH       EI_CLASSIFIER_BATCH_SIZE    // Signals per call
+#define DEFAULT_REPEAT      3                           // Passes over the windows
+#define SLICES_PER_WINDOW   6                           // Same as submission.cpp
+
+// Constants
+#define CONVERT_G_TO_MS2    9.80665f
+#define NUM_CHANNELS        EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME
+#define NUM_READINGS        EI_CLASSIFIER_RAW_SAMPLE_COUNT
+#define NUM_CLASSES         EI_CLASSIFIER_LABEL_COUNT
+#define WINDOW_SIZE         EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE
+#define READINGS_PER_SLICE  (NUM_READINGS / SLICES_PER_WINDOW)
+
+// Means and standard deviations from our dataset curation (same as
+// submission.cpp)
+static const float means[] = {-0.2238, -0.3129, 5.6543, -4.8021, 4.0536, -6.4238};
+static const float std_devs[] = {5.6031, 7.5372, 7.6538, 149.2136, 125.0134, 133.8875};
+
+/*******************************************************************************
+ * Functions
+ */
+
+// Append every window of a recording (one per slice) to windows
+static size_t cutWindows(const ReplayData &rec, std::vector<float> &windows) {
+
+    size_t num_windows = 0;
+    float val;
+
+    for (size_t start = 0; start + NUM_READINGS <= rec.size();
+            start += READINGS_PER_SLICE) {
+        for (size_t i = 0; i < NUM_READINGS; i++) {
+            for (int ch = 0; ch < NUM_CHANNELS; ch++) {
+                val = rec.column(ReplayData::ACC_X + ch)[start + i];
+                if (ch < 3) {
+                    val *= CONVERT_G_TO_MS2;
+                }
+                windows.push_back((val - means[ch]) / std_devs[ch]);
+            }
+        }
+        num_windows++;
+    }
+
+    return num_windows;
+}
+
+// Seconds since the given time point
+static double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************************
+ * Main
+ */
+
+int main(int argc, char **argv) {
+
+    static struct option long_options[] = {
+        {"batch", required_argument, 0, 'b'},
+        {"repeat", required_argument, 0, 'r'},
+        {0, 0, 0, 0}
+    };
+    std::vector<float> windows;
+    std::vector<signal_t> signals;
+    std::vector<ei_impulse_result_t> single;
+    std::vector<ei_impulse_result_t> batched;
+    size_t batch_size = DEFAULT_BATCH;
+    size_t repeat = DEFAULT_REPEAT;
+    size_t num_windows = 0;
+    size_t count;
+    unsigned long mismatches = 0;
+    double single_s, batch_s;
+    int opt;
+
+    // Parse command line options (input files follow the options)
+    while ((opt = getopt_long(argc, argv, "b:r:", long_options, NULL)) != -1) {
+        switch (opt) {
+            case 'b':
+                batch_size = strtoul(optarg, NULL, 10);
+                break;
+            case 'r':
+                repeat = strtoul(optarg, NULL, 10);
+                break;
+            default:
+                optind = argc;
+                break;
+        }
+    }
+    if ((optind >= argc) || (batch_size == 0) || (repeat == 0)) {
+        printf("Usage: %s [--batch <n>] [--repeat <n>] "
+                "<file.csv|file.imub> ...\r\n", argv[0]);
+        return 1;
+    }
+
+    // Cut every recording into windows
+    for (int i = optind; i < argc; i++) {
+        ReplayData rec;
+        if (rec.load(&argv[i], 1) != 0) {
+            printf("ERROR: %s\r\n", rec.error());
+            return 1;
+        }
+        num_windows += cutWindows(rec, windows);
+    }
+    if (num_windows == 0) {
+        printf("ERROR: Recordings are shorter than one window\r\n");
+        return 1;
+    }
+
+    // One signal per window
+    signals.resize(num_windows);
+    single.resize(num_windows);
+    batched.resize(num_windows);
+    for (size_t i = 0; i < num_windows; i++) {
+        numpy::signal_from_buffer(&windows[i * WINDOW_SIZE], WINDOW_SIZE,
+                                    &signals[i]);
+    }
+
+    // Classify every window on its own
+    auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < repeat; r++) {
+        for (size_t i = 0; i < num_windows; i++) {
+            if (run_classifier(&signals[i], &single[i], false) != EI_IMPULSE_OK) {
+                printf("ERROR: run_classifier failed\r\n");
+                return 1;
+            }
+        }
+    }
+    single_s = secondsSince(start);
+
+    // Classify the windows in batches
+    start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < repeat; r++) {
+        for (size_t i = 0; i < num_windows; i += batch_size) {
+            count = (num_windows - i < batch_size) ? (num_windows - i) : batch_size;
+            if (run_classifier_batch(&signals[i], count, &batched[i], false) !=
+                    EI_IMPULSE_OK) {
+                printf("ERROR: run_classifier_batch failed\r\n");
+                return 1;
+            }
+        }
+    }
+    batch_s = secondsSince(start);
+
+    // Both must agree exactly
+    for (size_t i = 0; i < num_windows; i++) {
+        for (int c = 0; c < NUM_CLASSES; c++) {
+            if (memcmp(&single[i].classification[c].value,
+                        &batched[i].classification[c].value, sizeof(float)) != 0) {
+                mismatches++;
+            }
+        }
+    }
+
+    printf("%zu windows, %zu passes, batches of %zu\r\n",
+        num_windows, repeat, batch_size);
+    printf("run_classifier:        %10.1f windows/s  %8.1f us/window\r\n",
+        (num_windows * repeat) / single_s,
+        1000000.0 * single_s / (num_windows * repeat));
+    printf("run_classifier_batch:  %10.1f windows/s  %8.1f us/window\r\n",
+        (num_windows * repeat) / batch_s,
+        1000000.0 * batch_s / (num_windows * repeat));
+    printf("Speedup: %.2fx, mismatched outputs: %lu\r\n",
+        single_s / batch_s, mismatches);
+
+    return (mismatches == 0) ? 0 : 1;
+}
@@ -0,0 +1,274 @@
+/**
+ * Continuous classification benchmark for IMU blocks
+ *
+ * Streams the recordings (one after the other) one slice at a time through
+ * run_classifier_continuous(), which extracts the raw features of the new
+ * slice only (see extract_raw_per_slice_features() in ei_run_dsp.h), and
+ * checks that every full window gets exactly the same results as
+ * run_classifier() on the whole window. Then does the same for a flatten
+ * block with every statistic turned on: extract_flatten_per_slice_features()
+ * only visits the new slice, and its features must match
+ * extract_flatten_features() on the whole window up to rounding. Prints how
+ * long each takes per slice.
+ *
+ * The model's DSP block passes the standardized readings straight through,
+ * so they go into the model as they are.
+ *
+ * Build and run with:
+ *
+ *  make continuous
+ *  ./build/continuous.out tests/alpha.2942e6abeec9.csv tests/beta.67ca58f8af8c.csv
+ *
+ * Returns 1 if any result is off.
+ *
+ * License: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include <chrono>
+#include <vector>
+
+// Must match the slices used below before the SDK sets its default
+#define EI_CLASSIFIER_SLICES_PER_MODEL_WINDOW   6
+
+#include "replay-data.h"
+#include "edge-impulse-sdk/classifier/ei_run_classifier.h"
+
+// Settings
+#define REPEAT              50          // Passes over the slices when timing
+#define SLICES_PER_WINDOW   EI_CLASSIFIER_SLICES_PER_MODEL_WINDOW
+#define FLATTEN_REL_TOL     1e-4f       // Largest flatten difference allowed
+
+// Constants
+#define CONVERT_G_TO_MS2    9.80665f
+#define NUM_CHANNELS        EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME
+#define NUM_READINGS        EI_CLASSIFIER_RAW_SAMPLE_COUNT
+#define NUM_CLASSES         EI_CLASSIFIER_LABEL_COUNT
+#define WINDOW_SIZE         EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE
+#define SLICE_SIZE          (WINDOW_SIZE / SLICES_PER_WINDOW)
+#define READINGS_PER_SLICE  (NUM_READINGS / SLICES_PER_WINDOW)
+#define NUM_STATS           7
+
+// Means and standard deviations from our dataset curation (same as
+// submission.cpp)
+static const float means[] = {-0.2238, -0.3129, 5.6543, -4.8021, 4.0536, -6.4238};
+static const float std_devs[] = {5.6031, 7.5372, 7.6538, 149.2136, 125.0134, 133.8875};
+
+// Flatten block over every axis with every statistic
+static ei_dsp_config_flatten_t flatten_config = {
+    1, NUM_CHANNELS, 1.0f, true, true, true, true, true, true, true
+};
+
+/*******************************************************************************
+ * Functions
+ */
+
+// Append the standardized slices of a recording to slices
+static size_t cutSlices(const ReplayData &rec, std::vector<float> &slices) {
+
+    size_t num_slices = 0;
+    float val;
+
+    for (size_t start = 0; start + READINGS_PER_SLICE <= rec.size();
+            start += READINGS_PER_SLICE) {
+        for (size_t i = 0; i < READINGS_PER_SLICE; i++) {
+            for (int ch = 0; ch < NUM_CHANNELS; ch++) {
+                val = rec.column(ReplayData::ACC_X + ch)[start + i];
+                if (ch < 3) {
+                    val *= CONVERT_G_TO_MS2;
+                }
+                slices.push_back((val - means[ch]) / std_devs[ch]);
+            }
+        }
+        num_slices++;
+    }
+
+    return num_slices;
+}
+
+// Seconds since the given time point
+static double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+// Classify the recording slice by slice. Checks every full window against
+// run_classifier() if check is set. Returns the number of windows that
+// differ, or -1 on error.
+static int classifySlices(const float *slices, size_t num_slices, bool check) {
+
+    ei_impulse_result_t result;
+    ei_impulse_result_t expected;
+    signal_t sig;
+    int mismatches = 0;
+
+    run_classifier_init();
+    for (size_t s = 0; s < num_slices; s++) {
+        numpy::signal_from_buffer(&slices[s * SLICE_SIZE], SLICE_SIZE, &sig);
+        if (run_classifier_continuous(&sig, &result, false, false) !=
+                EI_IMPULSE_OK) {
+            return -1;
+        }
+        if (!check || (s + 1 < SLICES_PER_WINDOW)) {
+            continue;
+        }
+        numpy::signal_from_buffer(&slices[(s + 1 - SLICES_PER_WINDOW) * SLICE_SIZE],
+            WINDOW_SIZE, &sig);
+        if (run_classifier(&sig, &expected, false) != EI_IMPULSE_OK) {
+            return -1;
+        }
+        for (int c = 0; c < NUM_CLASSES; c++) {
+            if (result.classification[c].value != expected.classification[c].value) {
+                mismatches++;
+                break;
+            }
+        }
+    }
+
+    return mismatches;
+}
+
+// Flatten the recording slice by slice. Returns the largest difference from
+// the whole window relative to the feature's size (or 1 if the features
+// were not reported as written when they should have been), or -1 on error.
+static float flattenSlices(const float *slices, size_t num_slices, bool check) {
+
+    float features[NUM_STATS * NUM_CHANNELS];
+    float expected[NUM_STATS * NUM_CHANNELS];
+    signal_t sig;
+    matrix_size_t written;
+    float worst = 0.0f;
+
+    ei_dsp_clear_continuous_flatten_state();
+    for (size_t s = 0; s < num_slices; s++) {
+        matrix_t fm(1, NUM_STATS * NUM_CHANNELS, features);
+        numpy::signal_from_buffer(&slices[s * SLICE_SIZE], SLICE_SIZE, &sig);
+        if (extract_flatten_per_slice_features(&sig, &fm, &flatten_config,
+                EI_CLASSIFIER_FREQUENCY, &written) != EIDSP_OK) {
+            return -1.0f;
+        }
+        if (!check) {
+            continue;
+        }
+        if ((written.rows * written.cols != 0) != (s + 1 >= SLICES_PER_WINDOW)) {
+            worst = 1.0f;
+        }
+        if (s + 1 < SLICES_PER_WINDOW) {
+            continue;
+        }
+        matrix_t em(1, NUM_STATS * NUM_CHANNELS, expected);
+        numpy::signal_from_buffer(&slices[(s + 1 - SLICES_PER_WINDOW) * SLICE_SIZE],
+            WINDOW_SIZE, &sig);
+        if (extract_flatten_features(&sig, &em, &flatten_config,
+                EI_CLASSIFIER_FREQUENCY) != EIDSP_OK) {
+            return -1.0f;
+        }
+        for (int i = 0; i < NUM_STATS * NUM_CHANNELS; i++) {
+            worst = fmaxf(worst,
+                fabsf(features[i] - expected[i]) / fmaxf(1.0f, fabsf(expected[i])));
+        }
+    }
+    ei_dsp_clear_continuous_flatten_state();
+
+    return worst;
+}
+
+/*******************************************************************************
+ * Main
+ */
+
+int main(int argc, char **argv) {
+
+    std::vector<float> slices;
+    size_t num_slices = 0;
+    size_t num_windows;
+    int mismatches;
+    float flatten_worst;
+    double continuous_s, window_s, flatten_slice_s, flatten_window_s;
+    ei_impulse_result_t result;
+    float features[NUM_STATS * NUM_CHANNELS];
+    signal_t sig;
+
+    if (argc < 2) {
+        printf("Usage: %s <file.csv|file.imub> ...\r\n", argv[0]);
+        return 1;
+    }
+
+    // The recordings make up one stream, so that most slices end a window
+    for (int i = 1; i < argc; i++) {
+        ReplayData rec;
+        if (rec.load(&argv[i], 1) != 0) {
+            printf("ERROR: %s\r\n", rec.error());
+            return 1;
+        }
+        num_slices += cutSlices(rec, slices);
+    }
+    if (num_slices < SLICES_PER_WINDOW) {
+        printf("ERROR: The recordings are shorter than a window\r\n");
+        return 1;
+    }
+    num_windows = num_slices - (SLICES_PER_WINDOW - 1);
+
+    // Check
+    mismatches = classifySlices(slices.data(), num_slices, true);
+    flatten_worst = flattenSlices(slices.data(), num_slices, true);
+    if ((mismatches < 0) || (flatten_worst < 0.0f)) {
+        printf("ERROR: Classification failed\r\n");
+        return 1;
+    }
+
+    // Time slice by slice and whole windows
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < REPEAT; r++) {
+        classifySlices(slices.data(), num_slices, false);
+    }
+    continuous_s = secondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < REPEAT; r++) {
+        for (size_t s = SLICES_PER_WINDOW - 1; s < num_slices; s++) {
+            numpy::signal_from_buffer(
+                &slices[(s + 1 - SLICES_PER_WINDOW) * SLICE_SIZE], WINDOW_SIZE, &sig);
+            run_classifier(&sig, &result, false);
+        }
+    }
+    window_s = secondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < REPEAT; r++) {
+        flattenSlices(slices.data(), num_slices, false);
+    }
+    flatten_slice_s = secondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < REPEAT; r++) {
+        for (size_t s = SLICES_PER_WINDOW - 1; s < num_slices; s++) {
+            matrix_t fm(1, NUM_STATS * NUM_CHANNELS, features);
+            numpy::signal_from_buffer(
+                &slices[(s + 1 - SLICES_PER_WINDOW) * SLICE_SIZE], WINDOW_SIZE, &sig);
+            extract_flatten_features(&sig, &fm, &flatten_config,
+                EI_CLASSIFIER_FREQUENCY);
+        }
+    }
+    flatten_window_s = secondsSince(start);
+
+    printf("%lu slices (%lu windows) from %d recording(s), %d slices per "
+        "window\r\n", (unsigned long)num_slices, (unsigned long)num_windows,
+        argc - 1, SLICES_PER_WINDOW);
+    printf("Raw: %d windows differ from run_classifier()\r\n", mismatches);
+    printf("Flatten: largest relative difference from the whole window: %g\r\n",
+        flatten_worst);
+    printf("run_classifier_continuous():  %8.2f us/slice\r\n",
+        1000000.0 * continuous_s / (num_slices * REPEAT));
+    printf("run_classifier() on window:   %8.2f us/slice\r\n",
+        1000000.0 * window_s / (num_windows * REPEAT));
+    printf("Flatten per slice:            %8.2f us/slice\r\n",
+        1000000.0 * flatten_slice_s / (num_slices * REPEAT));
+    printf("Flatten on window:            %8.2f us/slice\r\n",
+        1000000.0 * flatten_window_s / (num_windows * REPEAT));
+
+    return ((mismatches == 0) && (flatten_worst <= FLATTEN_REL_TOL)) ? 0 : 1;
+}
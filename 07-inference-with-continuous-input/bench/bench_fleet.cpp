@@ -0,0 +1,346 @@
+/**
+ * Fleet load simulation for continuous inference
+ *
+ * Emulates N wands (each an ImuEmu with its own FIFO, recording and phase
+ * offset) on one thread, the way a gateway would service them on one core.
+ * Every time a device has a full slice in its FIFO, the slice is read out,
+ * standardized into that device's window and classified, just like
+ * do_sampling_fifo() and do_inference() in submission.cpp. If the core can't
+ * keep up, slices are serviced late and the FIFOs overrun.
+ *
+ * By default the fleet runs against the virtual clock (see time-emulator.h)
+ * and each slice is charged the wall time it actually took to classify, so a
+ * long soak finishes quickly. Pass --real-time to run against the real clock.
+ * Without --devices, the fleet size is doubled until FIFOs overrun and then
+ * narrowed down to the largest fleet that kept up.
+ *
+ * Build and run with:
+ *
+ *  make fleet
+ *  ./build/fleet.out tests/alpha.2942e6abeec9.csv tests/beta.2942ea15bea0.csv
+ *  ./build/fleet.out --devices 64 --real-time tests/alpha.2942e6abeec9.csv
+ *
+ * License: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+
+#include <chrono>
+#include <vector>
+
+#include "time-emulator.h"
+#include "imu-emulator.h"
+#include "imu-fleet.h"
+#include "replay-data.h"
+#include "edge-impulse-sdk/classifier/ei_run_classifier.h"
+
+// Settings (slices match submission.cpp)
+#define DEFAULT_SECONDS     10          // Simulated time per fleet size
+#define MAX_DEVICES         65536       // Upper limit for the sweep
+#define BISECT_STEPS        4           // Refinement steps after the sweep
+#define SLICES_PER_WINDOW   6           // Inferences per window
+
+// Constants
+#define CONVERT_G_TO_MS2    9.80665f
+#define SAMPLING_FREQ_HZ    EI_CLASSIFIER_FREQUENCY
+#define SAMPLING_PERIOD_US  (1000000 / SAMPLING_FREQ_HZ)
+#define NUM_CHANNELS        EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME
+#define NUM_READINGS        EI_CLASSIFIER_RAW_SAMPLE_COUNT
+#define NUM_CLASSES         EI_CLASSIFIER_LABEL_COUNT
+#define READINGS_PER_SLICE  (NUM_READINGS / SLICES_PER_WINDOW)
+#define SLICE_SIZE          (READINGS_PER_SLICE * NUM_CHANNELS)
+
+// Means and standard deviations from our dataset curation (same as
+// submission.cpp)
+static const float means[] = {-0.2238, -0.3129, 5.6543, -4.8021, 4.0536, -6.4238};
+static const float std_devs[] = {5.6031, 7.5372, 7.6538, 149.2136, 125.0134, 133.8875};
+
+// State of one emulated wand
+struct Device {
+    const ReplayData *recording;
+    float raw_buf[SLICE_SIZE];
+    float input_buf[NUM_CHANNELS * NUM_READINGS];
+    int input_buf_slice;
+};
+
+// Results for one fleet size
+struct FleetStats {
+    unsigned long slices;
+    unsigned long short_slices;
+    unsigned long overruns;
+    unsigned long max_late_us;
+    double busy_us;
+    double elapsed_us;
+};
+
+// Settings from the command line
+static std::vector<ReplayData *> recordings;
+static unsigned long run_seconds = DEFAULT_SECONDS;
+static bool aligned_phases = false;
+
+/*******************************************************************************
+ * Functions
+ */
+
+// Supply the frame a device's sensor sampled at the given time. Recordings
+// loop so that a fleet can run for longer than they last.
+static int readDeviceFrame(void *ctx, unsigned long time_us, float *frame) {
+
+    Device *dev = (Device *)ctx;
+    const ReplayData *rec = dev->recording;
+    size_t idx = (time_us / SAMPLING_PERIOD_US) % rec->size();
+
+    for (int i = 0; i < NUM_CHANNELS; i++) {
+        frame[i] = rec->column(ReplayData::ACC_X + i)[idx];
+    }
+
+    return 1;
+}
+
+// Standardize a device's slice into its window and classify the window
+static int classifyDevice(Device *dev) {
+
+    ei_impulse_result_t result;
+    signal_t sig;
+    float *dst = &dev->input_buf[dev->input_buf_slice * SLICE_SIZE];
+    float val;
+    int max_idx = 0;
+
+    // Transform and copy the slice into the ring buffer
+    for (int i = 0; i < SLICE_SIZE; i++) {
+        val = dev->raw_buf[i];
+        if ((i % NUM_CHANNELS) < 3) {
+            val *= CONVERT_G_TO_MS2;
+        }
+        dst[i] = (val - means[i % NUM_CHANNELS]) / std_devs[i % NUM_CHANNELS];
+    }
+    dev->input_buf_slice = (dev->input_buf_slice + 1) % SLICES_PER_WINDOW;
+
+    // Read the window starting with the oldest slice
+    sig.total_length = EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE;
+    sig.get_data = [dev](size_t offset, size_t length, float *out_ptr) {
+        size_t start = dev->input_buf_slice * SLICE_SIZE;
+        for (size_t i = 0; i < length; i++) {
+            out_ptr[i] = dev->input_buf[(start + offset + i) %
+                                        (NUM_CHANNELS * NUM_READINGS)];
+        }
+        return EIDSP_OK;
+    };
+    if (run_classifier(&sig, &result, false) != EI_IMPULSE_OK) {
+        return -1;
+    }
+
+    // Find the label with the highest classification value
+    for (int i = 1; i < NUM_CLASSES; i++) {
+        if (result.classification[i].value >
+            result.classification[max_idx].value) {
+            max_idx = i;
+        }
+    }
+
+    return max_idx;
+}
+
+// Run a fleet of the given size. Returns 0 on success, -1 on failure.
+static int runFleet(size_t num_devices, FleetStats &stats) {
+
+    ImuFleet fleet;
+    std::vector<Device> devs(num_devices);
+    unsigned long start_us, end_us, due_us, now_us, phase_us;
+    double cost_us;
+    size_t num_frames;
+    int id, label;
+
+    memset(&stats, 0, sizeof(stats));
+
+    // Spread the devices evenly over a slice period (or line them all up)
+    if (fleet.begin(num_devices, SAMPLING_FREQ_HZ, READINGS_PER_SLICE) != 0) {
+        printf("ERROR: Could not create a fleet of %zu devices\r\n", num_devices);
+        return -1;
+    }
+    for (size_t i = 0; i < num_devices; i++) {
+        devs[i].recording = recordings[i % recordings.size()];
+        devs[i].input_buf_slice = 0;
+        memset(devs[i].input_buf, 0, sizeof(devs[i].input_buf));
+        phase_us = aligned_phases ? 0 :
+                    (unsigned long)((fleet.slicePeriodUs() * i) / num_devices);
+        fleet.addDevice(readDeviceFrame, &devs[i], phase_us);
+    }
+
+    // Service slices in the order they come due
+    start_us = micros();
+    end_us = start_us + (run_seconds * 1000000);
+    fleet.start();
+    while (true) {
+        id = fleet.nextSlice(&due_us);
+        now_us = micros();
+        if ((id < 0) || ((long)(now_us - end_us) >= 0)) {
+            break;
+        }
+        if (now_us - due_us > stats.max_late_us) {
+            stats.max_late_us = now_us - due_us;
+        }
+
+        // Read and classify the slice (timed on the real clock)
+        auto t_start = std::chrono::steady_clock::now();
+        num_frames = fleet.device(id).readFifoBurst(devs[id].raw_buf,
+                                                    READINGS_PER_SLICE);
+        if (num_frames < READINGS_PER_SLICE) {
+            stats.short_slices++;
+        }
+        label = classifyDevice(&devs[id]);
+        if (label < 0) {
+            printf("ERROR: run_classifier failed\r\n");
+            return -1;
+        }
+        auto t_end = std::chrono::steady_clock::now();
+        cost_us = std::chrono::duration<double, std::micro>(t_end - t_start).count();
+
+        // On the virtual clock, the core is busy for as long as that took
+        if (time_emu_is_virtual_clock()) {
+            delayMicroseconds((unsigned long)cost_us);
+        }
+        stats.busy_us += cost_us;
+        stats.slices++;
+    }
+    stats.overruns = fleet.totalOverruns();
+    stats.elapsed_us = (double)(micros() - start_us);
+    fleet.stop();
+
+    return 0;
+}
+
+// Print one line of results
+static void printStats(size_t num_devices, const FleetStats &stats) {
+    printf("%8zu  %10lu  %12.1f  %10.1f  %12.1f  %9lu  %6lu  %5.1f%%\r\n",
+        num_devices,
+        stats.slices,
+        stats.slices / (stats.elapsed_us / 1000000.0),
+        (stats.slices > 0) ? stats.busy_us / stats.slices : 0.0,
+        stats.max_late_us / 1000.0,
+        stats.overruns,
+        stats.short_slices,
+        100.0 * stats.busy_us / stats.elapsed_us);
+}
+
+// A fleet keeps up if no device ever drops or misses a frame
+static bool keptUp(const FleetStats &stats) {
+    return (stats.overruns == 0) && (stats.short_slices == 0);
+}
+
+/*******************************************************************************
+ * Main
+ */
+
+int main(int argc, char **argv) {
+
+    static struct option long_options[] = {
+        {"devices", required_argument, 0, 'd'},
+        {"seconds", required_argument, 0, 's'},
+        {"aligned", no_argument, 0, 'a'},
+        {"real-time", no_argument, 0, 'r'},
+        {0, 0, 0, 0}
+    };
+    FleetStats stats;
+    size_t num_devices = 0;
+    size_t good = 0;
+    size_t bad = 0;
+    size_t mid;
+    bool real_time = false;
+    int opt;
+
+    // Parse command line options (input files follow the options)
+    while ((opt = getopt_long(argc, argv, "d:s:ar", long_options, NULL)) != -1) {
+        switch (opt) {
+            case 'd':
+                num_devices = strtoul(optarg, NULL, 10);
+                break;
+            case 's':
+                run_seconds = strtoul(optarg, NULL, 10);
+                break;
+            case 'a':
+                aligned_phases = true;
+                break;
+            case 'r':
+                real_time = true;
+                break;
+            default:
+                optind = argc;
+                break;
+        }
+    }
+    if ((optind >= argc) || (run_seconds == 0)) {
+        printf("Usage: %s [--devices <n>] [--seconds <s>] [--aligned] "
+                "[--real-time] <file.csv|file.imub> ...\r\n", argv[0]);
+        return 1;
+    }
+
+    // Each file is a separate recording, handed out to the devices in turn
+    for (int i = optind; i < argc; i++) {
+        recordings.push_back(new ReplayData());
+        if (recordings.back()->load(&argv[i], 1) != 0) {
+            printf("ERROR: %s\r\n", recordings.back()->error());
+            return 1;
+        }
+        if (recordings.back()->empty()) {
+            printf("ERROR: No readings in %s\r\n", argv[i]);
+            return 1;
+        }
+    }
+
+    // Only this thread drives the clock
+    if (!real_time) {
+        time_emu_set_virtual_clock(1);
+    }
+    time_emu_thread_enter();
+
+    printf("%8s  %10s  %12s  %10s  %12s  %9s  %6s  %6s\r\n",
+        "devices", "slices", "slices/s", "us/slice", "max late ms",
+        "overruns", "short", "load");
+
+    // Run one fleet size
+    if (num_devices > 0) {
+        if (runFleet(num_devices, stats) != 0) {
+            return 1;
+        }
+        printStats(num_devices, stats);
+        return keptUp(stats) ? 0 : 1;
+    }
+
+    // Double the fleet until it falls behind
+    for (num_devices = 1; num_devices <= MAX_DEVICES; num_devices *= 2) {
+        if (runFleet(num_devices, stats) != 0) {
+            return 1;
+        }
+        printStats(num_devices, stats);
+        if (!keptUp(stats)) {
+            bad = num_devices;
+            break;
+        }
+        good = num_devices;
+    }
+
+    // Narrow down the largest fleet that keeps up
+    for (int i = 0; (i < BISECT_STEPS) && (bad > good + 1); i++) {
+        mid = good + ((bad - good) / 2);
+        if (runFleet(mid, stats) != 0) {
+            return 1;
+        }
+        printStats(mid, stats);
+        if (keptUp(stats)) {
+            good = mid;
+        } else {
+            bad = mid;
+        }
+    }
+    if (bad == 0) {
+        printf("Kept up with %zu devices (the most tried)\r\n", good);
+    } else {
+        printf("Kept up with %zu devices, fell behind with %zu\r\n", good, bad);
+    }
+
+    return 0;
+}
@@ -0,0 +1,429 @@
+/**
+ * Int8 kernel check and int8 vs. float model comparison
+ *
+ * First runs the int8 fully connected kernel (see
+ * edge-impulse-sdk/tensorflow/lite/micro/kernels/int8_simd.h) at every SIMD
+ * level this CPU supports on random layers, in the model's shapes and some
+ * awkward ones, and checks that every level matches
+ * reference_integer_ops::FullyConnected() (run one output channel at a time,
+ * with that channel's multiplier) bit for bit, whether rows are run one at a
+ * time or all at once (and that int8_simd::Quantize() follows its
+ * definition). Then it times the model's largest layer (900 -> 80) at
+ * each level, next to the float kernel.
+ *
+ * Given recordings, it also concatenates them like the application does,
+ * cuts them into windows (one per slice), standardizes them like
+ * submission.cpp and classifies every window with both the float model and
+ * the int8 model (see trained_model_int8.h). It prints how often the two agree
+ * on the top class, how far apart their probabilities are and the throughput
+ * of each (the int8 model at every level). Every time is the fastest of a few rounds, so other load on the
+ * machine skews it less.
+ *
+ * Build and run with:
+ *
+ *  make int8
+ *  ./build/int8.out
+ *  ./build/int8.out tests/alpha.2942e6abeec9.csv tests/beta.67ca58f8af8c.csv
+ *
+ * Returns 1 if any kernel check fails.
+ *
+ * License: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <float.h>
+#include <math.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include "replay-data.h"
+#include "edge-impulse-sdk/classifier/ei_run_classifier.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/common.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/quantization_util.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/fully_connected.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/float_simd.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/int8_simd.h"
+#include "tflite-model/trained_model_compiled.h"
+#include "tflite-model/trained_model_int8.h"
+
+using namespace tflite;
+
+// Settings
+#define TIMING_CALLS        20000       // Calls per timed kernel
+#define MODEL_REPEAT        20          // Passes over the windows per model
+#define TIMING_ROUNDS       5           // Rounds per timing (the fastest counts)
+#define SLICES_PER_WINDOW   6           // Same as submission.cpp
+
+// Constants
+#define CONVERT_G_TO_MS2    9.80665f
+#define NUM_CHANNELS        EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME
+#define NUM_READINGS        EI_CLASSIFIER_RAW_SAMPLE_COUNT
+#define NUM_CLASSES         EI_CLASSIFIER_LABEL_COUNT
+#define INPUT_SIZE          EI_CLASSIFIER_NN_INPUT_FRAME_SIZE
+#define READINGS_PER_SLICE  (NUM_READINGS / SLICES_PER_WINDOW)
+
+// Means and standard deviations from our dataset curation (same as
+// submission.cpp)
+static const float means[] = {-0.2238, -0.3129, 5.6543, -4.8021, 4.0536, -6.4238};
+static const float std_devs[] = {5.6031, 7.5372, 7.6538, 149.2136, 125.0134, 133.8875};
+
+// A quantized fully connected layer to check
+struct FcCase {
+    int rows;
+    int depth;
+    int outputs;
+    bool relu;
+};
+
+// The model's layers, a batch, and shapes that leave partial vectors
+static const FcCase fc_cases[] = {
+    {1, 900, 80, true},
+    {1, 80, 40, true},
+    {1, 40, 5, false},
+    {32, 900, 80, true},
+    {7, 33, 13, false},
+    {5, 3, 6, true},
+    {3, 17, 1, false},
+    {6, 130, 9, false},
+};
+
+// A random layer and its input
+struct RandomLayer {
+    std::vector<int8_t> input;
+    std::vector<int8_t> weights;
+    std::vector<int32_t> weight_sums;
+    std::vector<int32_t> bias;
+    std::vector<int32_t> multiplier;
+    std::vector<int32_t> shift;
+    int8_simd::FullyConnectedParams params;
+};
+
+// Uniform random integer in [lo, hi] (repeatable)
+static int32_t randomInt(int32_t lo, int32_t hi) {
+    static uint32_t state = 12345;
+    state = state * 1664525u + 1013904223u;
+    return lo + (int32_t)((state >> 8) % (uint32_t)(hi - lo + 1));
+}
+
+static void makeLayer(const FcCase &fc, RandomLayer &layer) {
+
+    layer.input.resize(fc.rows * fc.depth);
+    layer.weights.resize(fc.outputs * fc.depth);
+    layer.weight_sums.resize(fc.outputs);
+    layer.bias.resize(fc.outputs);
+    layer.multiplier.resize(fc.outputs);
+    layer.shift.resize(fc.outputs);
+
+    for (size_t i = 0; i < layer.input.size(); i++) {
+        layer.input[i] = (int8_t)randomInt(-128, 127);
+    }
+    for (size_t i = 0; i < layer.weights.size(); i++) {
+        layer.weights[i] = (int8_t)randomInt(-127, 127);
+    }
+    for (int o = 0; o < fc.outputs; o++) {
+        int shift;
+        layer.bias[o] = randomInt(-100000, 100000);
+        QuantizeMultiplier(randomInt(1, 1000) / (256.0 * fc.depth),
+                            &layer.multiplier[o], &shift);
+        layer.shift[o] = shift;
+    }
+    int8_simd::WeightSums(layer.weights.data(), fc.depth, fc.outputs,
+                            layer.weight_sums.data());
+
+    int8_simd::FullyConnectedParams &p = layer.params;
+    p.depth = fc.depth;
+    p.outputs = fc.outputs;
+    p.weights = layer.weights.data();
+    p.weight_sums = layer.weight_sums.data();
+    p.bias = layer.bias.data();
+    p.output_multiplier = layer.multiplier.data();
+    p.output_shift = layer.shift.data();
+    p.input_offset = -randomInt(-128, 127);
+    p.output_offset = randomInt(-128, 127);
+    p.activation_min = fc.relu ? p.output_offset : -128;
+    p.activation_max = 127;
+}
+
+// Check the kernel at the current level against the reference kernel.
+// Returns true if both the batch and the rows run one at a time match.
+static bool checkFullyConnected(const FcCase &fc) {
+
+    RandomLayer layer;
+    makeLayer(fc, layer);
+    const int8_simd::FullyConnectedParams &p = layer.params;
+
+    std::vector<int8_t> ref(fc.rows * fc.outputs);
+    std::vector<int8_t> out(fc.rows * fc.outputs);
+    std::vector<int8_t> row_out(fc.rows * fc.outputs);
+    std::vector<int8_t> channel(fc.rows);
+
+    // The reference kernel has one multiplier per layer, so run it once per
+    // output channel
+    for (int o = 0; o < fc.outputs; o++) {
+        FullyConnectedParams params;
+        params.input_offset = p.input_offset;
+        params.weights_offset = 0;
+        params.output_offset = p.output_offset;
+        params.output_multiplier = layer.multiplier[o];
+        params.output_shift = layer.shift[o];
+        params.quantized_activation_min = p.activation_min;
+        params.quantized_activation_max = p.activation_max;
+        reference_integer_ops::FullyConnected(params,
+            RuntimeShape({fc.rows, fc.depth}), layer.input.data(),
+            RuntimeShape({1, fc.depth}), &layer.weights[o * fc.depth],
+            RuntimeShape({1}), &layer.bias[o], RuntimeShape({fc.rows, 1}),
+            channel.data());
+        for (int r = 0; r < fc.rows; r++) {
+            ref[r * fc.outputs + o] = channel[r];
+        }
+    }
+
+    int8_simd::FullyConnected(p, layer.input.data(), fc.rows, out.data());
+    for (int r = 0; r < fc.rows; r++) {
+        int8_simd::FullyConnected(p, &layer.input[r * fc.depth], 1,
+                                    &row_out[r * fc.outputs]);
+    }
+
+    return (memcmp(out.data(), ref.data(), ref.size()) == 0) &&
+            (memcmp(row_out.data(), ref.data(), ref.size()) == 0);
+}
+
+// Check int8_simd::Quantize() at the current level against its definition,
+// on values that include exact halves and values far out of range
+static bool checkQuantize() {
+
+    const float scale = 0.25f;
+    const int32_t zero_point = 3;
+    const int size = 203;
+    std::vector<float> input(size);
+    std::vector<int8_t> out(size);
+
+    for (int i = 0; i < size; i++) {
+        input[i] = randomInt(-8000, 8000) / 1000.0f;
+    }
+    input[0] = 0.125f;
+    input[1] = -0.375f;
+    input[2] = 1e30f;
+    input[3] = -1e30f;
+
+    int8_simd::Quantize(input.data(), size, scale, zero_point, out.data());
+    for (int i = 0; i < size; i++) {
+        float q = nearbyintf(input[i] * (1.0f / scale)) + zero_point;
+        q = std::min(std::max(q, -128.0f), 127.0f);
+        if (out[i] != (int8_t)q) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Average time of one call of fn in nanoseconds, in the fastest of
+// TIMING_ROUNDS rounds of calls (after one untimed call, so first-time setup
+// and cold caches aren't counted)
+template <typename Fn>
+static double timeCalls(Fn fn, int calls) {
+    double best_ns = 0.0;
+
+    fn();
+    for (int round = 0; round < TIMING_ROUNDS; round++) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < calls; i++) {
+            fn();
+        }
+        double ns = std::chrono::duration<double, std::nano>(
+            std::chrono::steady_clock::now() - start).count() / calls;
+        if ((round == 0) || (ns < best_ns)) {
+            best_ns = ns;
+        }
+    }
+
+    return best_ns;
+}
+
+// Append every window of a recording (one per slice) to windows
+static size_t cutWindows(const ReplayData &rec, std::vector<float> &windows) {
+
+    size_t num_windows = 0;
+    float val;
+
+    for (size_t start = 0; start + NUM_READINGS <= rec.size();
+            start += READINGS_PER_SLICE) {
+        for (size_t i = 0; i < NUM_READINGS; i++) {
+            for (int ch = 0; ch < NUM_CHANNELS; ch++) {
+                val = rec.column(ReplayData::ACC_X + ch)[start + i];
+                if (ch < 3) {
+                    val *= CONVERT_G_TO_MS2;
+                }
+                windows.push_back((val - means[ch]) / std_devs[ch]);
+            }
+        }
+        num_windows++;
+    }
+
+    return num_windows;
+}
+
+// Index of the largest of n values
+static int argMax(const float *values, int n) {
+    int best = 0;
+    for (int i = 1; i < n; i++) {
+        if (values[i] > values[best]) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+// Classify the recordings with both models and print how they compare
+static int compareModels(char **paths, int num_paths) {
+
+    std::vector<float> windows;
+    std::vector<float> features;
+    size_t num_windows;
+
+#if EI_CLASSIFIER_STUDIO_VERSION < 3
+    const ei_impulse_t impulse = ei_construct_impulse();
+#else
+    const ei_impulse_t impulse = ei_default_impulse;
+#endif
+
+    ReplayData rec;
+    if (rec.load(paths, num_paths) != 0) {
+        printf("ERROR: %s\r\n", rec.error());
+        return 1;
+    }
+    num_windows = cutWindows(rec, windows);
+    if (num_windows == 0) {
+        printf("ERROR: Recordings are shorter than one window\r\n");
+        return 1;
+    }
+
+    features.resize(num_windows * INPUT_SIZE);
+    for (size_t i = 0; i < num_windows; i++) {
+        signal_t signal;
+        ei::matrix_t fm(1, INPUT_SIZE, &features[i * INPUT_SIZE]);
+        numpy::signal_from_buffer(&windows[i * EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE],
+                                    EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE, &signal);
+        if (extract_impulse_features(&impulse, &signal, &fm) != EI_IMPULSE_OK) {
+            printf("ERROR: Could not extract features\r\n");
+            return 1;
+        }
+    }
+
+    std::vector<float> float_probs(num_windows * NUM_CLASSES);
+    std::vector<float> int8_probs(num_windows * NUM_CLASSES);
+    double float_ns = timeCalls([&]() {
+        trained_model_invoke_batch(features.data(), float_probs.data(), num_windows);
+    }, MODEL_REPEAT) / num_windows;
+    trained_model_int8_invoke_batch(features.data(), int8_probs.data(), num_windows);
+
+    size_t agree = 0;
+    double max_diff = 0.0;
+    double sum_diff = 0.0;
+    for (size_t i = 0; i < num_windows; i++) {
+        const float *f = &float_probs[i * NUM_CLASSES];
+        const float *q = &int8_probs[i * NUM_CLASSES];
+        if (argMax(f, NUM_CLASSES) == argMax(q, NUM_CLASSES)) {
+            agree++;
+        }
+        for (int c = 0; c < NUM_CLASSES; c++) {
+            double diff = fabs((double)f[c] - q[c]);
+            max_diff = fmax(max_diff, diff);
+            sum_diff += diff;
+        }
+    }
+
+    size_t int8_bytes = 0;
+    for (size_t i = 0; i < trained_model_int8.layer_count; i++) {
+        const int8_simd::FullyConnectedParams &p = trained_model_int8.layers[i];
+        int8_bytes += p.depth * p.outputs;
+    }
+
+    printf("\r\n%zu windows from %d recording(s)\r\n", num_windows, num_paths);
+    printf("Weights: %zu bytes float, %zu bytes int8\r\n",
+        int8_bytes * sizeof(float), int8_bytes);
+    printf("Same top class: %zu of %zu windows (%.1f%%)\r\n", agree,
+        num_windows, 100.0 * agree / num_windows);
+    printf("Probability difference: %.4f max, %.4f mean\r\n", max_diff,
+        sum_diff / (num_windows * NUM_CLASSES));
+    printf("float model: %8.2f us/window\r\n", float_ns / 1000.0);
+
+    // The int8 model at every level (the gain depends on VNNI)
+    int8_simd::SimdLevel best = int8_simd::GetSimdLevel();
+    for (int lvl = int8_simd::kSimdPortable; lvl <= best; lvl++) {
+        int8_simd::SetSimdLevel((int8_simd::SimdLevel)lvl);
+        double int8_ns = timeCalls([&]() {
+            trained_model_int8_invoke_batch(features.data(), int8_probs.data(), num_windows);
+        }, MODEL_REPEAT) / num_windows;
+        printf("int8 model:  %8.2f us/window (%s, %.2fx)\r\n", int8_ns / 1000.0,
+            int8_simd::SimdLevelName((int8_simd::SimdLevel)lvl), float_ns / int8_ns);
+    }
+    int8_simd::SetSimdLevel(best);
+
+    return 0;
+}
+
+/*******************************************************************************
+ * Main
+ */
+
+int main(int argc, char **argv) {
+
+    int8_simd::SimdLevel best = int8_simd::DetectedSimdLevel();
+    RandomLayer timed;
+    std::vector<float> input(900), weights(80 * 900), bias(80), out(80);
+    std::vector<int8_t> timed_out(80);
+    bool failed = false;
+
+    for (size_t i = 0; i < input.size(); i++) {
+        input[i] = randomInt(-1000, 1000) / 1000.0f;
+    }
+    for (size_t i = 0; i < weights.size(); i++) {
+        weights[i] = randomInt(-200, 200) / 1000.0f;
+    }
+    makeLayer(fc_cases[0], timed);
+
+    double float_ns = timeCalls([&]() {
+        float_simd::FullyConnected(input.data(), 1, 900, weights.data(),
+            bias.data(), 80, 0.0f, FLT_MAX, out.data());
+    }, TIMING_CALLS);
+
+    printf("Best int8 SIMD level on this CPU: %s\r\n",
+        int8_simd::SimdLevelName(best));
+    printf("Float kernel (%s): %.1f ns for fc 900x80\r\n\r\n",
+        float_simd::SimdLevelName(float_simd::GetSimdLevel()), float_ns);
+    printf("%-12s  %10s  %14s  %12s\r\n", "level", "exact", "fc 900x80 ns",
+        "vs float");
+
+    for (int lvl = int8_simd::kSimdPortable; lvl <= best; lvl++) {
+        int8_simd::SimdLevel level = (int8_simd::SimdLevel)lvl;
+        bool ok = true;
+
+        int8_simd::SetSimdLevel(level);
+        for (const FcCase &fc : fc_cases) {
+            ok &= checkFullyConnected(fc);
+        }
+        ok &= checkQuantize();
+        failed |= !ok;
+
+        double int8_ns = timeCalls([&]() {
+            int8_simd::FullyConnected(timed.params, timed.input.data(), 1,
+                                        timed_out.data());
+        }, TIMING_CALLS);
+
+        printf("%-12s  %10s  %14.1f  %11.2fx  %s\r\n",
+            int8_simd::SimdLevelName(level), ok ? "yes" : "NO", int8_ns,
+            float_ns / int8_ns, ok ? "OK" : "FAIL");
+    }
+    int8_simd::SetSimdLevel(best);
+
+    if ((argc > 1) && (compareModels(&argv[1], argc - 1) != 0)) {
+        return 1;
+    }
+
+    return failed ? 1 : 0;
+}
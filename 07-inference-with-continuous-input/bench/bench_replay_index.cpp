@@ -0,0 +1,168 @@
+/**
+ * Benchmark for the replay harness timestamp lookup
+ *
+ * Measures the average cost of finding the closest reading for recordings of
+ * 1k to 10M rows, both for a uniform sample rate (what the harness produces)
+ * and for irregular timestamps (binary search fallback). The original linear
+ * scan is timed for the smaller recordings for comparison.
+ *
+ * Build and run with:
+ *
+ *  make bench
+ *  ./build/bench.out
+ *
+ * License: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include <array>
+#include <chrono>
+#include <vector>
+
+#include "replay-index.h"
+
+// Settings
+#define SAMPLE_PERIOD_MS        10.0f
+#define NUM_LOOKUPS             1000000
+#define NUM_LINEAR_LOOKUPS      1000
+#define MAX_LINEAR_ROWS         100000
+
+// Rows laid out the same way as the harness (timestamp + 6 axes)
+typedef std::array<float, 7> Row;
+
+// Original harness lookup (scans every row)
+static size_t linearClosest(const std::vector<Row>& rows, unsigned long time_ms) {
+
+    unsigned long closest_time = rows[0][0];
+    size_t closest_time_idx = 0;
+    unsigned long num;
+
+    for (size_t i = 0; i < rows.size(); i++) {
+        num = rows[i][0];
+        if (llabs((long long)time_ms - (long long)num) <
+            llabs((long long)time_ms - (long long)closest_time)) {
+                closest_time = num;
+                closest_time_idx = i;
+        }
+    }
+
+    return closest_time_idx;
+}
+
+// Fill a recording with whole millisecond timestamps, optionally with jitter
+static void makeRows(std::vector<Row>& rows, size_t count, bool jitter) {
+
+    float t = 0.0f;
+
+    rows.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        rows[i].fill(0.0f);
+        rows[i][0] = t;
+        if (jitter) {
+            t += floorf(SAMPLE_PERIOD_MS * (0.5f + (float)rand() / RAND_MAX));
+        } else {
+            t = SAMPLE_PERIOD_MS * (i + 1);
+        }
+    }
+}
+
+// Average nanoseconds per lookup, walking forward through the recording like
+// the sampling thread does
+static double timeIndex(const ReplayIndex& index, double duration_ms,
+                        size_t& checksum) {
+
+    double step = duration_ms / NUM_LOOKUPS;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < NUM_LOOKUPS; i++) {
+        checksum += index.findClosest(i * step);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() /
+        NUM_LOOKUPS;
+}
+
+// Average nanoseconds per lookup for the linear scan
+static double timeLinear(const std::vector<Row>& rows, double duration_ms,
+                        size_t& checksum) {
+
+    double step = duration_ms / NUM_LINEAR_LOOKUPS;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < NUM_LINEAR_LOOKUPS; i++) {
+        checksum += linearClosest(rows, (unsigned long)(i * step));
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() /
+        NUM_LINEAR_LOOKUPS;
+}
+
+// Confirm the index agrees with the linear scan on whole millisecond times
+static bool checkIndex(const ReplayIndex& index, const std::vector<Row>& rows) {
+
+    unsigned long duration_ms = rows.back()[0];
+
+    for (unsigned long t = 0; t <= duration_ms + 20; t += 3) {
+        if (index.findClosest(t) != linearClosest(rows, t)) {
+            printf("MISMATCH at %lu ms\r\n", t);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, char **argv) {
+
+    static const size_t sizes[] = {1000, 10000, 100000, 1000000, 10000000};
+    static const char *mode_names[] = {"empty", "uniform", "sorted", "unsorted"};
+    std::vector<Row> rows;
+    ReplayIndex index;
+    size_t checksum = 0;
+    double index_ns, linear_ns;
+    bool ok = true;
+
+    srand(42);
+
+    printf("%10s  %-9s  %-8s  %12s  %12s\r\n",
+        "rows", "spacing", "mode", "index ns", "linear ns");
+    for (int jitter = 0; jitter <= 1; jitter++) {
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+
+            // Build the recording and index it the same way main.cpp does
+            makeRows(rows, sizes[s], jitter);
+            index.build(&rows[0][0], rows.size(), sizeof(Row) / sizeof(float));
+            double duration_ms = rows.back()[0];
+
+            // Make sure we still return the same readings as before
+            if (sizes[s] <= 10000) {
+                ok = checkIndex(index, rows) && ok;
+            }
+
+            // Time the lookups
+            index_ns = timeIndex(index, duration_ms, checksum);
+            printf("%10zu  %-9s  %-8s  %12.1f  ",
+                sizes[s],
+                jitter ? "irregular" : "uniform",
+                mode_names[index.mode()],
+                index_ns);
+            if (sizes[s] <= MAX_LINEAR_ROWS) {
+                linear_ns = timeLinear(rows, duration_ms, checksum);
+                printf("%12.1f\r\n", linear_ns);
+            } else {
+                printf("%12s\r\n", "-");
+            }
+        }
+    }
+
+    // Print checksum so the compiler can't drop the lookups
+    printf("checksum: %zu\r\n", checksum);
+    printf("%s\r\n", ok ? "All lookups match the linear scan" : "FAILED");
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,309 @@
+/**
+ * SIMD kernel check and benchmark
+ *
+ * Runs the float fully connected, multiply-accumulate and softmax kernels (see
+ * edge-impulse-sdk/tensorflow/lite/micro/kernels/float_simd.h) at every SIMD
+ * level this CPU supports and compares them with the TFLite reference kernels
+ * on random data, in the model's layer shapes and some awkward ones:
+ *
+ *  - The portable kernels must match the reference bit for bit.
+ *  - The SIMD fully connected kernels must be within the usual error bound of
+ *    a float dot product (depth * FLT_EPSILON * sum |x * w|) of the reference.
+ *  - Every multiply-accumulate kernel must be within the same bound of a
+ *    double precision sum (there is no reference kernel for it).
+ *  - The SIMD softmax must be within SOFTMAX_REL_TOL of the reference.
+ *  - Every level must give the same results whether rows are run one at a
+ *    time or all at once (so run_classifier_batch() matches run_classifier()).
+ *
+ * Then it times the model's largest layer (900 -> 80) and its softmax at each
+ * level. Returns 1 if any check fails.
+ *
+ * Build and run with:
+ *
+ *  make simd
+ *  ./build/simd.out
+ *
+ * License: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <float.h>
+#include <math.h>
+
+#include <chrono>
+#include <vector>
+
+#include "edge-impulse-sdk/tensorflow/lite/c/builtin_op_data.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/common.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/fully_connected.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/softmax.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/kernel_util.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/float_simd.h"
+
+using namespace tflite;
+
+// Settings
+#define SOFTMAX_REL_TOL     1e-5        // Largest relative softmax error
+#define TIMING_CALLS        20000       // Calls per timed kernel
+
+// A fully connected layer to check
+struct FcCase {
+    int rows;
+    int depth;
+    int outputs;
+    TfLiteFusedActivation activation;
+};
+
+// A multiply-accumulate to check
+struct MacCase {
+    int depth;
+    int outputs;
+};
+
+// A softmax to check
+struct SoftmaxCase {
+    int rows;
+    int depth;
+    float beta;
+};
+
+// The model's layers, a batch, and shapes that leave partial vectors
+static const FcCase fc_cases[] = {
+    {1, 900, 80, kTfLiteActRelu},
+    {1, 80, 40, kTfLiteActRelu},
+    {1, 40, 5, kTfLiteActNone},
+    {32, 900, 80, kTfLiteActRelu},
+    {7, 33, 13, kTfLiteActNone},
+    {5, 3, 6, kTfLiteActRelu6},
+    {3, 17, 1, kTfLiteActReluN1To1},
+};
+static const MacCase mac_cases[] = {
+    {150, 80},
+    {150, 400},
+    {17, 13},
+    {3, 129},
+    {1, 1},
+};
+static const SoftmaxCase softmax_cases[] = {
+    {1, 5, 1.0f},
+    {3, 17, 1.0f},
+    {2, 40, 0.5f},
+    {4, 1, 1.0f},
+};
+
+// Uniform random float in [lo, hi) (repeatable)
+static float randomFloat(float lo, float hi) {
+    static uint32_t state = 12345;
+    state = state * 1664525u + 1013904223u;
+    return lo + (hi - lo) * ((state >> 8) / 16777216.0f);
+}
+
+static void fill(std::vector<float> &v, float lo, float hi) {
+    for (size_t i = 0; i < v.size(); i++) {
+        v[i] = randomFloat(lo, hi);
+    }
+}
+
+// Worst error of the fully connected kernel as a fraction of its error bound
+// (0 if it matches the reference exactly). Sets rows_match to false if
+// running the rows one at a time gives different results.
+static double checkFullyConnected(const FcCase &fc, bool &rows_match) {
+
+    std::vector<float> input(fc.rows * fc.depth);
+    std::vector<float> weights(fc.outputs * fc.depth);
+    std::vector<float> bias(fc.outputs);
+    std::vector<float> ref(fc.rows * fc.outputs);
+    std::vector<float> out(fc.rows * fc.outputs);
+    std::vector<float> row_out(fc.rows * fc.outputs);
+    FullyConnectedParams params;
+    double worst = 0.0;
+
+    fill(input, -1.0f, 1.0f);
+    fill(weights, -0.2f, 0.2f);
+    fill(bias, -0.5f, 0.5f);
+    CalculateActivationRange(fc.activation, &params.float_activation_min,
+                                &params.float_activation_max);
+
+    const RuntimeShape input_shape({fc.rows, fc.depth});
+    const RuntimeShape weights_shape({fc.outputs, fc.depth});
+    const RuntimeShape bias_shape({fc.outputs});
+    const RuntimeShape output_shape({fc.rows, fc.outputs});
+    reference_ops::FullyConnected(params, input_shape, input.data(),
+        weights_shape, weights.data(), bias_shape, bias.data(),
+        output_shape, ref.data());
+
+    float_simd::FullyConnected(input.data(), fc.rows, fc.depth, weights.data(),
+        bias.data(), fc.outputs, params.float_activation_min,
+        params.float_activation_max, out.data());
+    for (int r = 0; r < fc.rows; r++) {
+        float_simd::FullyConnected(&input[r * fc.depth], 1, fc.depth,
+            weights.data(), bias.data(), fc.outputs,
+            params.float_activation_min, params.float_activation_max,
+            &row_out[r * fc.outputs]);
+    }
+    if (memcmp(out.data(), row_out.data(), out.size() * sizeof(float)) != 0) {
+        rows_match = false;
+    }
+
+    for (int r = 0; r < fc.rows; r++) {
+        for (int o = 0; o < fc.outputs; o++) {
+            double magnitude = fabs(bias[o]);
+            for (int d = 0; d < fc.depth; d++) {
+                magnitude += fabs(input[r * fc.depth + d] *
+                                    weights[o * fc.depth + d]);
+            }
+            double bound = (fc.depth + 1) * FLT_EPSILON * magnitude;
+            double err = fabs((double)out[r * fc.outputs + o] -
+                                ref[r * fc.outputs + o]);
+            if (err > 0.0) {
+                worst = fmax(worst, (bound > 0.0) ? err / bound : INFINITY);
+            }
+        }
+    }
+
+    return worst;
+}
+
+// Worst error of the multiply-accumulate kernel as a fraction of its error
+// bound (0 if it matches a double precision sum exactly)
+static double checkMultiplyAccumulate(const MacCase &mac) {
+
+    std::vector<float> input(mac.depth);
+    std::vector<float> weights(mac.depth * mac.outputs);
+    std::vector<float> out(mac.outputs);
+    double worst = 0.0;
+
+    fill(input, -1.0f, 1.0f);
+    fill(weights, -0.2f, 0.2f);
+    fill(out, -0.5f, 0.5f);
+
+    std::vector<float> start(out);
+    float_simd::MultiplyAccumulate(input.data(), mac.depth, weights.data(),
+        mac.outputs, out.data());
+
+    for (int o = 0; o < mac.outputs; o++) {
+        double sum = start[o];
+        double magnitude = fabs(start[o]);
+        for (int d = 0; d < mac.depth; d++) {
+            sum += (double)input[d] * weights[d * mac.outputs + o];
+            magnitude += fabs((double)input[d] * weights[d * mac.outputs + o]);
+        }
+        double bound = (mac.depth + 1) * FLT_EPSILON * magnitude;
+        double err = fabs(out[o] - sum);
+        if (err > 0.0) {
+            worst = fmax(worst, (bound > 0.0) ? err / bound : INFINITY);
+        }
+    }
+
+    return worst;
+}
+
+// Worst relative error of the softmax kernel (0 if it matches exactly)
+static double checkSoftmax(const SoftmaxCase &sm) {
+
+    std::vector<float> input(sm.rows * sm.depth);
+    std::vector<float> ref(sm.rows * sm.depth);
+    std::vector<float> out(sm.rows * sm.depth);
+    SoftmaxParams params;
+    double worst = 0.0;
+
+    fill(input, -20.0f, 20.0f);
+    params.beta = sm.beta;
+
+    const RuntimeShape shape({sm.rows, sm.depth});
+    reference_ops::Softmax(params, shape, input.data(), shape, ref.data());
+    float_simd::Softmax(input.data(), sm.rows, sm.depth, sm.beta, out.data());
+
+    for (size_t i = 0; i < out.size(); i++) {
+        double err = fabs((double)out[i] - ref[i]);
+        if (ref[i] > FLT_MIN) {
+            worst = fmax(worst, err / ref[i]);
+        } else if (err > FLT_MIN) {
+            worst = INFINITY;
+        }
+    }
+
+    return worst;
+}
+
+// Average time of one call of fn in nanoseconds
+template <typename Fn>
+static double timeCalls(Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < TIMING_CALLS; i++) {
+        fn();
+    }
+    return std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - start).count() / TIMING_CALLS;
+}
+
+/*******************************************************************************
+ * Main
+ */
+
+int main(int argc, char **argv) {
+
+    float_simd::SimdLevel best = float_simd::DetectedSimdLevel();
+    std::vector<float> input(900), weights(80 * 900), bias(80), out(80);
+    std::vector<float> logits(5), probs(5);
+    bool failed = false;
+
+    fill(input, -1.0f, 1.0f);
+    fill(weights, -0.2f, 0.2f);
+    fill(bias, -0.5f, 0.5f);
+    fill(logits, -5.0f, 5.0f);
+
+    printf("Best SIMD level on this CPU: %s\r\n\r\n",
+        float_simd::SimdLevelName(best));
+    printf("%-10s  %14s  %14s  %14s  %10s  %14s  %12s\r\n", "level",
+        "fc err/bound", "mac err/bound", "softmax err", "rows", "fc 900x80 ns",
+        "softmax5 ns");
+
+    for (int lvl = float_simd::kSimdPortable; lvl <= best; lvl++) {
+        float_simd::SimdLevel level = (float_simd::SimdLevel)lvl;
+        double fc_worst = 0.0;
+        double mac_worst = 0.0;
+        double softmax_worst = 0.0;
+        bool rows_match = true;
+        bool ok;
+
+        float_simd::SetSimdLevel(level);
+
+        for (const FcCase &fc : fc_cases) {
+            fc_worst = fmax(fc_worst, checkFullyConnected(fc, rows_match));
+        }
+        for (const MacCase &mac : mac_cases) {
+            mac_worst = fmax(mac_worst, checkMultiplyAccumulate(mac));
+        }
+        for (const SoftmaxCase &sm : softmax_cases) {
+            softmax_worst = fmax(softmax_worst, checkSoftmax(sm));
+        }
+
+        // The portable kernels must be exact, the others within tolerance
+        if (level == float_simd::kSimdPortable) {
+            ok = (fc_worst == 0.0) && (softmax_worst == 0.0) && rows_match;
+        } else {
+            ok = (fc_worst <= 1.0) && (softmax_worst <= SOFTMAX_REL_TOL) &&
+                    rows_match;
+        }
+        ok &= (mac_worst <= 1.0);
+        failed |= !ok;
+
+        double fc_ns = timeCalls([&]() {
+            float_simd::FullyConnected(input.data(), 1, 900, weights.data(),
+                bias.data(), 80, 0.0f, FLT_MAX, out.data());
+        });
+        double softmax_ns = timeCalls([&]() {
+            float_simd::Softmax(logits.data(), 1, 5, 1.0f, probs.data());
+        });
+
+        printf("%-10s  %14.3g  %14.3g  %14.3g  %10s  %14.1f  %12.1f  %s\r\n",
+            float_simd::SimdLevelName(level), fc_worst, mac_worst, softmax_worst,
+            rows_match ? "same" : "DIFFERENT", fc_ns, softmax_ns,
+            ok ? "OK" : "FAIL");
+    }
+
+    return failed ? 1 : 0;
+}
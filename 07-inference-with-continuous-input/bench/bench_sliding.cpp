@@ -0,0 +1,237 @@
+/**
+ * Sliding window model benchmark
+ *
+ * Streams every recording through the sliding window model (see
+ * trained_model_sliding_init() in trained_model_compiled.h) one slice at a
+ * time, like submission.cpp does, and checks every output against invoking
+ * the model on the whole window (with zeros before the start of the
+ * recording, like the application's ring buffer). Also checks the model with
+ * the unit conversion and standardization folded into its first layer (see
+ * trained_model_sliding_fold_input()), fed with the readings as they come
+ * from the IMU. Prints the largest differences and times each step per
+ * slice: the push (what
+ * stands between a slice and its answer), the advance (done while waiting for
+ * the next slice) and invoking the whole window.
+ *
+ * The model's DSP block passes the standardized readings straight through,
+ * so they go into the model as they are.
+ *
+ * Build and run with:
+ *
+ *  make sliding
+ *  ./build/sliding.out tests/alpha.2942e6abeec9.csv tests/beta.67ca58f8af8c.csv
+ *
+ * Returns 1 if any output is off by more than rounding.
+ *
+ * License: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include <chrono>
+#include <vector>
+
+#include "replay-data.h"
+#include "edge-impulse-sdk/classifier/ei_run_classifier.h"
+#include "tflite-model/trained_model_compiled.h"
+
+// Settings
+#define REPEAT              200         // Passes over the slices when timing
+#define SLICES_PER_WINDOW   6           // Same as submission.cpp
+#define MAX_DIFF            1e-4f       // Largest difference allowed
+
+// Constants
+#define CONVERT_G_TO_MS2    9.80665f
+#define NUM_CHANNELS        EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME
+#define NUM_READINGS        EI_CLASSIFIER_RAW_SAMPLE_COUNT
+#define NUM_CLASSES         EI_CLASSIFIER_LABEL_COUNT
+#define WINDOW_SIZE         EI_CLASSIFIER_NN_INPUT_FRAME_SIZE
+#define SLICE_SIZE          (WINDOW_SIZE / SLICES_PER_WINDOW)
+#define READINGS_PER_SLICE  (NUM_READINGS / SLICES_PER_WINDOW)
+
+// Means and standard deviations from our dataset curation (same as
+// submission.cpp)
+static const float means[] = {-0.2238, -0.3129, 5.6543, -4.8021, 4.0536, -6.4238};
+static const float std_devs[] = {5.6031, 7.5372, 7.6538, 149.2136, 125.0134, 133.8875};
+
+/*******************************************************************************
+ * Functions
+ */
+
+// Append the standardized slices of a recording to slices, and the same
+// slices in sensor units to raw
+static size_t cutSlices(const ReplayData &rec, std::vector<float> &slices,
+                        std::vector<float> &raw) {
+
+    size_t num_slices = 0;
+    float val;
+
+    for (size_t start = 0; start + READINGS_PER_SLICE <= rec.size();
+            start += READINGS_PER_SLICE) {
+        for (size_t i = 0; i < READINGS_PER_SLICE; i++) {
+            for (int ch = 0; ch < NUM_CHANNELS; ch++) {
+                val = rec.column(ReplayData::ACC_X + ch)[start + i];
+                raw.push_back(val);
+                if (ch < 3) {
+                    val *= CONVERT_G_TO_MS2;
+                }
+                slices.push_back((val - means[ch]) / std_devs[ch]);
+            }
+        }
+        num_slices++;
+    }
+
+    return num_slices;
+}
+
+// Window that ends with slice last (zeros before the first slice)
+static void makeWindow(const float *slices, size_t last, float *window) {
+
+    for (int p = 0; p < SLICES_PER_WINDOW; p++) {
+        long s = (long)last - (SLICES_PER_WINDOW - 1) + p;
+        if (s < 0) {
+            memset(&window[p * SLICE_SIZE], 0, SLICE_SIZE * sizeof(float));
+        } else {
+            memcpy(&window[p * SLICE_SIZE], &slices[s * SLICE_SIZE],
+                    SLICE_SIZE * sizeof(float));
+        }
+    }
+}
+
+// Seconds since the given time point
+static double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+/*******************************************************************************
+ * Main
+ */
+
+int main(int argc, char **argv) {
+
+    trained_model_sliding_t sw;
+    std::vector<float> slices;
+    std::vector<float> raw;
+    float scale[NUM_CHANNELS];
+    float offset[NUM_CHANNELS];
+    std::vector<float> windows;
+    float sliding_out[NUM_CLASSES];
+    float window_out[NUM_CLASSES];
+    float max_diff = 0.0f;
+    float max_folded_diff = 0.0f;
+    size_t num_slices;
+    double push_s = 0.0, advance_s = 0.0, window_s;
+    unsigned long total_slices = 0;
+
+    if (argc < 2) {
+        printf("Usage: %s <file.csv|file.imub> ...\r\n", argv[0]);
+        return 1;
+    }
+
+    // Conversion and standardization to fold into the first layer
+    for (int ch = 0; ch < NUM_CHANNELS; ch++) {
+        scale[ch] = ((ch < 3) ? CONVERT_G_TO_MS2 : 1.0f) / std_devs[ch];
+        offset[ch] = -means[ch] / std_devs[ch];
+    }
+
+    // Every recording is a stream of its own
+    for (int i = 1; i < argc; i++) {
+        ReplayData rec;
+        if (rec.load(&argv[i], 1) != 0) {
+            printf("ERROR: %s\r\n", rec.error());
+            return 1;
+        }
+        slices.clear();
+        raw.clear();
+        num_slices = cutSlices(rec, slices, raw);
+
+        // Check every output against the whole window
+        if (trained_model_sliding_init(&sw, SLICES_PER_WINDOW) != kTfLiteOk) {
+            printf("ERROR: Could not set up the sliding window model\r\n");
+            return 1;
+        }
+        for (size_t s = 0; s < num_slices; s++) {
+            windows.resize((total_slices + s + 1) * WINDOW_SIZE);
+            makeWindow(slices.data(), s, &windows[(total_slices + s) * WINDOW_SIZE]);
+            if ((trained_model_sliding_push(&sw, &slices[s * SLICE_SIZE],
+                    sliding_out) != kTfLiteOk) ||
+                    (trained_model_invoke_batch(
+                    &windows[(total_slices + s) * WINDOW_SIZE], window_out, 1) !=
+                    kTfLiteOk)) {
+                printf("ERROR: Inference failed\r\n");
+                return 1;
+            }
+            for (int c = 0; c < NUM_CLASSES; c++) {
+                max_diff = fmaxf(max_diff, fabsf(sliding_out[c] - window_out[c]));
+            }
+        }
+        trained_model_sliding_free(&sw);
+
+        // Same with the readings in sensor units
+        if ((trained_model_sliding_init(&sw, SLICES_PER_WINDOW) != kTfLiteOk) ||
+                (trained_model_sliding_fold_input(&sw, scale, offset, NUM_CHANNELS) !=
+                kTfLiteOk)) {
+            printf("ERROR: Could not set up the folded sliding window model\r\n");
+            return 1;
+        }
+        for (size_t s = 0; s < num_slices; s++) {
+            if ((trained_model_sliding_push(&sw, &raw[s * SLICE_SIZE],
+                    sliding_out) != kTfLiteOk) ||
+                    (trained_model_invoke_batch(
+                    &windows[(total_slices + s) * WINDOW_SIZE], window_out, 1) !=
+                    kTfLiteOk)) {
+                printf("ERROR: Inference failed\r\n");
+                return 1;
+            }
+            for (int c = 0; c < NUM_CLASSES; c++) {
+                max_folded_diff = fmaxf(max_folded_diff, 
+                                        fabsf(sliding_out[c] - window_out[c]));
+            }
+        }
+        trained_model_sliding_free(&sw);
+
+        // Time the two steps separately
+        if (trained_model_sliding_init(&sw, SLICES_PER_WINDOW) != kTfLiteOk) {
+            printf("ERROR: Could not set up the sliding window model\r\n");
+            return 1;
+        }
+        for (int r = 0; r < REPEAT; r++) {
+            for (size_t s = 0; s < num_slices; s++) {
+                auto start = std::chrono::steady_clock::now();
+                trained_model_sliding_push(&sw, &slices[s * SLICE_SIZE], sliding_out);
+                push_s += secondsSince(start);
+                start = std::chrono::steady_clock::now();
+                trained_model_sliding_advance(&sw);
+                advance_s += secondsSince(start);
+            }
+        }
+        trained_model_sliding_free(&sw);
+        total_slices += num_slices;
+    }
+
+    // Whole windows, one at a time
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < REPEAT; r++) {
+        for (unsigned long s = 0; s < total_slices; s++) {
+            trained_model_invoke_batch(&windows[s * WINDOW_SIZE], window_out, 1);
+        }
+    }
+    window_s = secondsSince(start);
+
+    printf("%lu slices from %d recording(s), %d slices per window\r\n",
+        total_slices, argc - 1, SLICES_PER_WINDOW);
+    printf("Largest difference from the whole window: %g\r\n", max_diff);
+    printf("Largest difference with the preprocessing folded in: %g\r\n",
+        max_folded_diff);
+    printf("Whole window:     %8.2f us/slice\r\n",
+        1000000.0 * window_s / (total_slices * REPEAT));
+    printf("Sliding push:     %8.2f us/slice (before the answer)\r\n",
+        1000000.0 * push_s / (total_slices * REPEAT));
+    printf("Sliding advance:  %8.2f us/slice (after the answer)\r\n",
+        1000000.0 * advance_s / (total_slices * REPEAT));
+
+    return ((max_diff <= MAX_DIFF) && (max_folded_diff <= MAX_DIFF)) ? 0 : 1;
+}
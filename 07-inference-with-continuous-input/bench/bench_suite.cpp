@@ -0,0 +1,640 @@
+/**
+ * Benchmark suite for the inference SDK
+ *
+ * Times the steps of an inference on their own and together: loading the
+ * recordings, run_classifier() on every window of them, trained_model_invoke()
+ * on its own, the numpy primitives the DSP blocks are built from (scale, dot,
+ * transpose and rfft) and the raw and spectral analysis DSP blocks.
+ *
+ * Each benchmark is warmed up first, then run in batches long enough for the
+ * clock to time accurately, and each batch is one sample of the time per call.
+ * The samples are taken in rounds, one batch of every benchmark per round, so
+ * each benchmark's samples are spread over the whole run and their spread
+ * includes the machine getting faster or slower while it lasts (clock
+ * frequency, other load), not just the jitter of a few milliseconds.
+ * The samples are summarized as the median, mean with its 95% confidence
+ * interval, percentiles and the number of outliers (more than 3 scaled median
+ * absolute deviations from the median). Compare medians: they hold up best
+ * when the machine is busy.
+ *
+ * The results can be written as JSON (one benchmark per line) and compared
+ * with an earlier run, e.g. before and after an optimization or an SDK update.
+ * A median only counts as a regression if it got more than the threshold
+ * slower and the 95% confidence intervals of the two medians don't overlap.
+ * The interval is estimated from the spread of the samples: +-
+ * 1.96 * 1.2533 * MAD / sqrt(samples), with MAD the scaled median absolute
+ * deviation. For a 10% threshold to mean anything, each interval has to be
+ * under 5% of the median, which takes (49 * MAD / median)^2 samples: about 25
+ * when the MAD is 10% of the median and 100 when it's 20%. The comparison
+ * prints the samples a benchmark would need when it has fewer. The spread
+ * within a run doesn't show a machine that is slower for the whole run, so
+ * the benchmarks that look slower are timed again, and only count if they
+ * still are.
+ *
+ * Build and run with:
+ *
+ *  make suite
+ *  ./build/suite.out [--samples <n>] [--filter <text>] [--json <file>]
+ *      [--compare <file> [--threshold <percent>]] <file.csv|file.imub> ...
+ *
+ * Returns 1 if a benchmark fails, or if a median is more than the threshold
+ * (10% by default) slower than in the file given to --compare, beyond the
+ * noise of either run.
+ *
+ * License: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <getopt.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <vector>
+
+#include "replay-data.h"
+#include "edge-impulse-sdk/classifier/ei_run_classifier.h"
+#include "tflite-model/trained_model_compiled.h"
+
+// Settings
+#define DEFAULT_SAMPLES     30          // Timed samples per benchmark
+#define DEFAULT_THRESHOLD   10.0        // Slowdown (%) that counts as a regression
+#define WARMUP_NS           50000000    // Time to run each benchmark before timing it
+#define MIN_SAMPLE_NS       1000000     // Shortest a sample can take
+#define MAX_BATCH           (1 << 24)   // Most calls in one sample
+#define OUTLIER_MADS        3.0         // Scaled MADs from the median to be an outlier
+#define MEDIAN_CI95_MADS    (1.96 * 1.2533) // Scaled MADs / sqrt(samples) in the median's 95% CI
+
+// Constants
+#define CONVERT_G_TO_MS2    9.80665f
+#define NUM_CHANNELS        EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME
+#define NUM_READINGS        EI_CLASSIFIER_RAW_SAMPLE_COUNT
+#define WINDOW_SIZE         EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE
+#define WINDOW_STRIDE       (NUM_READINGS / 6)  // Readings between windows
+#define RFFT_SIZE           128
+#define DOT_COLS            80          // Output columns of the dot product (first layer)
+#define SPECTRAL_FFT_SIZE   64
+
+// Means and standard deviations from our dataset curation (same as
+// submission.cpp)
+static const float means[] = {-0.2238, -0.3129, 5.6543, -4.8021, 4.0536, -6.4238};
+static const float std_devs[] = {5.6031, 7.5372, 7.6538, 149.2136, 125.0134, 133.8875};
+
+// Spectral analysis block as Studio sets it up for motion: low-pass filter,
+// then the RMS, skewness, kurtosis and log power spectrum of each axis
+static ei_dsp_config_spectral_analysis_t spectral_config = {
+    2, NUM_CHANNELS, 1.0f, "low", 20.0f, 6, "FFT", SPECTRAL_FFT_SIZE, 3, 0.1f,
+    "0.1, 0.5, 1.0, 2.0, 5.0", true, true, 1, "db4"
+};
+
+// Results of the benchmarks go here so that they can't be optimized away
+static volatile float sink;
+
+// A benchmark: body() makes one call of whatever is timed and returns false
+// on error
+typedef struct {
+    const char *name;
+    std::function<bool()> body;
+} Benchmark;
+
+// Summary of a benchmark's samples (ns per call)
+typedef struct {
+    const char *name;
+    unsigned long batch;
+    double median, mean, ci95, stddev, min, p90, p99, max;
+    double mad, median_ci95;
+    int outliers;
+} BenchResult;
+
+/*******************************************************************************
+ * Functions
+ */
+
+// Real clock in nanoseconds
+static inline uint64_t nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Append every window of a recording (one every WINDOW_STRIDE readings) to
+// windows, standardized like submission.cpp does
+static size_t cutWindows(const ReplayData &rec, std::vector<float> &windows) {
+
+    size_t num_windows = 0;
+    float val;
+
+    for (size_t start = 0; start + NUM_READINGS <= rec.size();
+            start += WINDOW_STRIDE) {
+        for (size_t i = 0; i < NUM_READINGS; i++) {
+            for (int ch = 0; ch < NUM_CHANNELS; ch++) {
+                val = rec.column(ReplayData::ACC_X + ch)[start + i];
+                if (ch < 3) {
+                    val *= CONVERT_G_TO_MS2;
+                }
+                windows.push_back((val - means[ch]) / std_devs[ch]);
+            }
+        }
+        num_windows++;
+    }
+
+    return num_windows;
+}
+
+// Call body() batch times. Returns how long that took (ns), or 0 on error.
+static uint64_t timeBatch(const Benchmark &bench, unsigned long batch) {
+
+    uint64_t start = nowNs();
+    for (unsigned long i = 0; i < batch; i++) {
+        if (!bench.body()) {
+            return 0;
+        }
+    }
+
+    return std::max<uint64_t>(nowNs() - start, 1);
+}
+
+// Value at fraction q of the sorted samples (linear interpolation)
+static double percentile(const std::vector<double> &sorted, double q) {
+
+    double pos = q * (sorted.size() - 1);
+    size_t lo = (size_t)pos;
+    size_t hi = std::min(lo + 1, sorted.size() - 1);
+
+    return sorted[lo] + (sorted[hi] - sorted[lo]) * (pos - lo);
+}
+
+// Warm up and pick a batch size. Returns 0 if the benchmark fails.
+static unsigned long calibrateBenchmark(const Benchmark &bench) {
+
+    unsigned long batch = 1;
+    uint64_t start, elapsed;
+
+    // Warm up caches, branch predictors, the DSP workspace and the CPU clock
+    start = nowNs();
+    do {
+        if (timeBatch(bench, 1) == 0) {
+            return 0;
+        }
+    } while (nowNs() - start < WARMUP_NS);
+
+    // Double the batch until one takes long enough to time accurately
+    while ((elapsed = timeBatch(bench, batch)) < MIN_SAMPLE_NS) {
+        if ((elapsed == 0) || (batch >= MAX_BATCH)) {
+            break;
+        }
+        batch *= 2;
+    }
+
+    return (elapsed == 0) ? 0 : batch;
+}
+
+// Summarize the samples (ns per call) of a benchmark
+static void summarize(const char *name, unsigned long batch,
+                        std::vector<double> &samples, BenchResult *res) {
+
+    std::vector<double> deviations;
+    int num_samples = (int)samples.size();
+    double sum = 0.0, sq_sum = 0.0, mad;
+
+    std::sort(samples.begin(), samples.end());
+    for (double x : samples) {
+        sum += x;
+        sq_sum += x * x;
+    }
+    res->name = name;
+    res->batch = batch;
+    res->mean = sum / num_samples;
+    res->stddev = (num_samples > 1) ?
+        sqrt(std::max(0.0, (sq_sum - sum * res->mean) / (num_samples - 1))) : 0.0;
+    res->ci95 = 1.96 * res->stddev / sqrt((double)num_samples);
+    res->min = samples.front();
+    res->median = percentile(samples, 0.5);
+    res->p90 = percentile(samples, 0.9);
+    res->p99 = percentile(samples, 0.99);
+    res->max = samples.back();
+
+    // Outliers by median absolute deviation (scaled to match the standard
+    // deviation for normally distributed samples)
+    for (double x : samples) {
+        deviations.push_back(fabs(x - res->median));
+    }
+    std::sort(deviations.begin(), deviations.end());
+    mad = 1.4826 * percentile(deviations, 0.5);
+    res->mad = mad;
+    res->median_ci95 = MEDIAN_CI95_MADS * mad / sqrt((double)num_samples);
+    res->outliers = 0;
+    for (double x : samples) {
+        if ((mad > 0.0) && (fabs(x - res->median) > OUTLIER_MADS * mad)) {
+            res->outliers++;
+        }
+    }
+}
+
+// Time the benchmarks in rounds of one batch each, so that the samples of
+// each are spread over the whole run, and summarize them. Returns false if
+// one fails (it's left out of the results).
+static bool timeBenchmarks(const std::vector<const Benchmark *> &benches,
+                            const std::vector<unsigned long> &batches,
+                            int num_samples, std::vector<BenchResult> &results) {
+
+    std::vector<std::vector<double>> samples(benches.size());
+    BenchResult res;
+    bool ok = true;
+
+    for (int round = 0; round < num_samples; round++) {
+        for (size_t i = 0; i < benches.size(); i++) {
+            if (samples[i].size() < (size_t)round) {
+                continue;
+            }
+            uint64_t elapsed = timeBatch(*benches[i], batches[i]);
+            if (elapsed == 0) {
+                printf("ERROR: %s failed\r\n", benches[i]->name);
+                ok = false;
+                continue;
+            }
+            samples[i].push_back((double)elapsed / batches[i]);
+        }
+    }
+
+    for (size_t i = 0; i < benches.size(); i++) {
+        if (samples[i].size() == (size_t)num_samples) {
+            summarize(benches[i]->name, batches[i], samples[i], &res);
+            results.push_back(res);
+        }
+    }
+
+    return ok;
+}
+
+// Write the results as JSON, one benchmark per line
+static bool writeJson(const char *path, const std::vector<BenchResult> &results,
+                        int num_samples) {
+
+    FILE *file = fopen(path, "w");
+    if (file == NULL) {
+        return false;
+    }
+
+    fprintf(file, "{\"suite\":\"ei-sdk\",\"time\":%ld,\"compiler\":\"%s\","
+            "\"samples\":%d,\"benchmarks\":[\n", (long)time(NULL), __VERSION__,
+            num_samples);
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchResult &r = results[i];
+        fprintf(file, "{\"name\":\"%s\",\"batch\":%lu,\"median_ns\":%.1f,"
+                "\"median_ci95_ns\":%.1f,\"mad_ns\":%.1f,"
+                "\"mean_ns\":%.1f,\"ci95_ns\":%.1f,\"stddev_ns\":%.1f,"
+                "\"min_ns\":%.1f,\"p90_ns\":%.1f,\"p99_ns\":%.1f,\"max_ns\":%.1f,"
+                "\"outliers\":%d}%s\n", r.name, r.batch, r.median, r.median_ci95,
+                r.mad, r.mean, r.ci95, r.stddev, r.min, r.p90, r.p99, r.max,
+                r.outliers, (i + 1 < results.size()) ? "," : "");
+    }
+    fprintf(file, "]}\n");
+
+    return fclose(file) == 0;
+}
+
+// Compare the medians with the ones in a file written by writeJson(). Returns
+// the number of benchmarks that got slower by more than threshold percent,
+// with confidence intervals that don't overlap (and adds their names to
+// regressed, if given), or -1 if the file can't be read. Files written before
+// the intervals were saved count as noiseless.
+static int compareJson(const char *path, const std::vector<BenchResult> &results,
+                        int num_samples, double threshold,
+                        std::vector<const char *> *regressed) {
+
+    char line[1024];
+    char name[128];
+    const char *field;
+    double old_median, old_ci95, change, noise, needed;
+    int regressions = 0;
+
+    FILE *file = fopen(path, "r");
+    if (file == NULL) {
+        return -1;
+    }
+
+    printf("\r\nCompared with %s (change, and the noise of both runs):\r\n", path);
+    while (fgets(line, sizeof(line), file) != NULL) {
+        if ((sscanf(line, "{\"name\":\"%127[^\"]\"", name) != 1) ||
+                ((field = strstr(line, "\"median_ns\":")) == NULL) ||
+                (sscanf(field, "\"median_ns\":%lf", &old_median) != 1) ||
+                (old_median <= 0.0)) {
+            continue;
+        }
+        if (((field = strstr(line, "\"median_ci95_ns\":")) == NULL) ||
+                (sscanf(field, "\"median_ci95_ns\":%lf", &old_ci95) != 1)) {
+            old_ci95 = 0.0;
+        }
+        for (const BenchResult &r : results) {
+            if (strcmp(r.name, name) != 0) {
+                continue;
+            }
+
+            // Slower beyond the threshold, and beyond where either median
+            // could be by chance
+            change = 100.0 * (r.median - old_median) / old_median;
+            noise = 100.0 * (old_ci95 + r.median_ci95) / old_median;
+            bool regression = (change > threshold) &&
+                (r.median - r.median_ci95 > old_median + old_ci95);
+            printf("  %-40s %12.1f -> %12.1f ns %+7.1f%% +- %5.1f%%%s\r\n", name,
+                    old_median, r.median, change, noise,
+                    regression ? "  REGRESSION" :
+                    (change > threshold) ? "  within noise" : "");
+
+            // Samples for the noise to be under the threshold (it shrinks
+            // with the square root of the samples)
+            if (noise >= threshold) {
+                needed = num_samples * (noise / threshold) * (noise / threshold);
+                printf("  %-40s needs about %.0f samples to resolve %.1f%%\r\n",
+                        "", ceil(needed), threshold);
+            }
+            if (regression) {
+                regressions++;
+                if (regressed != NULL) {
+                    regressed->push_back(r.name);
+                }
+            }
+        }
+    }
+    fclose(file);
+
+    return regressions;
+}
+
+/*******************************************************************************
+ * Main
+ */
+
+int main(int argc, char **argv) {
+
+    int num_samples = DEFAULT_SAMPLES;
+    double threshold = DEFAULT_THRESHOLD;
+    const char *filter = NULL;
+    const char *json_path = NULL;
+    const char *compare_path = NULL;
+    std::vector<float> windows;
+    size_t num_windows = 0;
+    std::vector<Benchmark> benchmarks;
+    std::vector<const Benchmark *> selected;
+    std::vector<unsigned long> batches;
+    std::vector<BenchResult> results;
+    std::vector<const char *> regressed;
+    bool failed = false;
+    int regressions = 0;
+
+    // Parse command line options (recordings follow the options)
+    static struct option long_options[] = {
+        {"samples", required_argument, 0, 'n'},
+        {"filter", required_argument, 0, 'f'},
+        {"json", required_argument, 0, 'j'},
+        {"compare", required_argument, 0, 'c'},
+        {"threshold", required_argument, 0, 't'},
+        {0, 0, 0, 0}
+    };
+    int opt;
+    while ((opt = getopt_long(argc, argv, "n:f:j:c:t:", long_options, NULL)) != -1) {
+        switch (opt) {
+            case 'n':
+                num_samples = atoi(optarg);
+                break;
+            case 'f':
+                filter = optarg;
+                break;
+            case 'j':
+                json_path = optarg;
+                break;
+            case 'c':
+                compare_path = optarg;
+                break;
+            case 't':
+                threshold = atof(optarg);
+                break;
+            default:
+                optind = argc;
+                break;
+        }
+    }
+    if ((optind >= argc) || (num_samples < 1)) {
+        printf("Usage: %s [--samples <n>] [--filter <text>] [--json <file>] "
+                "[--compare <file> [--threshold <percent>]] "
+                "<file.csv|file.imub> ...\r\n", argv[0]);
+        return 1;
+    }
+    char **paths = &argv[optind];
+    int num_paths = argc - optind;
+
+    // Cut the recordings into windows
+    {
+        ReplayData rec;
+        if (rec.load(paths, num_paths) != 0) {
+            printf("ERROR: %s\r\n", rec.error());
+            return 1;
+        }
+        num_windows = cutWindows(rec, windows);
+    }
+    if (num_windows == 0) {
+        printf("ERROR: Recordings are shorter than one window\r\n");
+        return 1;
+    }
+
+#if EI_CLASSIFIER_STUDIO_VERSION < 3
+    ei_impulse_t impulse = ei_construct_impulse();
+#else
+    ei_impulse_t impulse = ei_default_impulse;
+#endif
+
+    // Loading the recordings
+    benchmarks.push_back({"replay_load", [&]() {
+        ReplayData rec;
+        if (rec.load(paths, num_paths) != 0) {
+            return false;
+        }
+        sink = rec.column(ReplayData::ACC_X)[0];
+        return true;
+    }});
+
+    // Whole inference, one window after the other
+    size_t next_window = 0;
+    benchmarks.push_back({"run_classifier", [&]() {
+        ei_impulse_result_t result;
+        signal_t sig;
+        numpy::signal_from_buffer(&windows[next_window * WINDOW_SIZE], WINDOW_SIZE, &sig);
+        next_window = (next_window + 1) % num_windows;
+        if (run_classifier(&sig, &result, false) != EI_IMPULSE_OK) {
+            return false;
+        }
+        sink = result.classification[0].value;
+        return true;
+    }});
+
+    // The model alone, set up once in a context of its own (run_classifier()
+    // sets the default one up and frees it for every inference), on the
+    // first window
+    trained_model_ctx_t model_ctx;
+    uint8_t *model_arena = (uint8_t *)ei_aligned_calloc(16, TRAINED_MODEL_ARENA_SIZE);
+    if ((model_arena == NULL) ||
+            (trained_model_ctx_init(&model_ctx, model_arena, TRAINED_MODEL_ARENA_SIZE) != kTfLiteOk) ||
+            (trained_model_ctx_set_input_data(&model_ctx, 0, windows.data()) != kTfLiteOk)) {
+        printf("ERROR: Could not set up the model\r\n");
+        return 1;
+    }
+    benchmarks.push_back({"trained_model_invoke", [&]() {
+        if (trained_model_ctx_invoke(&model_ctx) != kTfLiteOk) {
+            return false;
+        }
+        sink = trained_model_ctx_output(&model_ctx, 0)->data.f[0];
+        return true;
+    }});
+
+    // Numpy primitives on a window and on the first layer
+    ei::matrix_t scale_matrix(NUM_READINGS, NUM_CHANNELS);
+    memcpy(scale_matrix.buffer, windows.data(), WINDOW_SIZE * sizeof(float));
+    benchmarks.push_back({"numpy_scale_150x6", [&]() {
+        if (numpy::scale(&scale_matrix, 1.0001f) != EIDSP_OK) {
+            return false;
+        }
+        sink = scale_matrix.buffer[0];
+        return true;
+    }});
+
+    ei::matrix_t dot_in(1, WINDOW_SIZE, windows.data());
+    ei::matrix_t dot_weights(WINDOW_SIZE, DOT_COLS);
+    ei::matrix_t dot_out(1, DOT_COLS);
+    for (size_t i = 0; i < WINDOW_SIZE * DOT_COLS; i++) {
+        dot_weights.buffer[i] = (float)((i * 37) % 101) / 101.0f - 0.5f;
+    }
+    benchmarks.push_back({"numpy_dot_1x900_900x80", [&]() {
+        if (numpy::dot(&dot_in, &dot_weights, &dot_out) != EIDSP_OK) {
+            return false;
+        }
+        sink = dot_out.buffer[0];
+        return true;
+    }});
+
+    ei::matrix_t transpose_matrix(NUM_READINGS, NUM_CHANNELS);
+    memcpy(transpose_matrix.buffer, windows.data(), WINDOW_SIZE * sizeof(float));
+    benchmarks.push_back({"numpy_transpose_150x6", [&]() {
+        if (numpy::transpose(&transpose_matrix) != EIDSP_OK) {
+            return false;
+        }
+        sink = transpose_matrix.buffer[1];
+        return true;
+    }});
+
+    float rfft_out[RFFT_SIZE / 2 + 1];
+    benchmarks.push_back({"numpy_rfft_128", [&]() {
+        if (numpy::rfft(windows.data(), NUM_READINGS, rfft_out, RFFT_SIZE / 2 + 1,
+                RFFT_SIZE) != EIDSP_OK) {
+            return false;
+        }
+        sink = rfft_out[1];
+        return true;
+    }});
+
+    // DSP blocks on a window, with their scratch from the DSP workspace like
+    // process_impulse() does
+    std::vector<float> raw_out(impulse.dsp_blocks[0].n_output_features);
+    benchmarks.push_back({"extract_raw_features", [&]() {
+        signal_t sig;
+        ei::matrix_t out(1, raw_out.size(), raw_out.data());
+        ei::ei_dsp_workspace_scope dsp_workspace;
+        numpy::signal_from_buffer(windows.data(), WINDOW_SIZE, &sig);
+        if (extract_raw_features(&sig, &out, impulse.dsp_blocks[0].config,
+                impulse.frequency) != EIDSP_OK) {
+            return false;
+        }
+        sink = raw_out[0];
+        return true;
+    }});
+
+    std::vector<float> spectral_out(NUM_CHANNELS * (3 + SPECTRAL_FFT_SIZE / 2));
+    benchmarks.push_back({"extract_spectral_analysis_features", [&]() {
+        signal_t sig;
+        ei::matrix_t out(1, spectral_out.size(), spectral_out.data());
+        ei::ei_dsp_workspace_scope dsp_workspace;
+        numpy::signal_from_buffer(windows.data(), WINDOW_SIZE, &sig);
+        if (extract_spectral_analysis_features(&sig, &out, &spectral_config,
+                impulse.frequency) != EIDSP_OK) {
+            return false;
+        }
+        sink = spectral_out[0];
+        return true;
+    }});
+
+    printf("%lu windows from %d recording(s), %d samples per benchmark\r\n",
+        (unsigned long)num_windows, num_paths, num_samples);
+    printf("%-36s %12s %22s %12s %12s %12s %4s\r\n", "benchmark", "median ns",
+        "mean ns (95% CI)", "p90 ns", "p99 ns", "min ns", "out");
+
+    // Warm up and size the batches of the benchmarks to run
+    for (const Benchmark &bench : benchmarks) {
+        if ((filter != NULL) && (strstr(bench.name, filter) == NULL)) {
+            continue;
+        }
+        unsigned long batch = calibrateBenchmark(bench);
+        if (batch == 0) {
+            printf("ERROR: %s failed\r\n", bench.name);
+            failed = true;
+            continue;
+        }
+        selected.push_back(&bench);
+        batches.push_back(batch);
+    }
+
+    // Time them
+    if (!timeBenchmarks(selected, batches, num_samples, results)) {
+        failed = true;
+    }
+    for (const BenchResult &r : results) {
+        printf("%-36s %12.1f %12.1f +- %7.1f %12.1f %12.1f %12.1f %4d\r\n",
+            r.name, r.median, r.mean, r.ci95, r.p90, r.p99, r.min, r.outliers);
+    }
+
+    if ((json_path != NULL) && !writeJson(json_path, results, num_samples)) {
+        printf("ERROR: Could not write %s\r\n", json_path);
+        return 1;
+    }
+    if (compare_path != NULL) {
+        regressions = compareJson(compare_path, results, num_samples, threshold,
+                                    &regressed);
+        if (regressions < 0) {
+            printf("ERROR: Could not read %s\r\n", compare_path);
+            return 1;
+        }
+
+        // The machine can be slower for a whole run (other load, clock
+        // frequency, the page cache), which the spread within the run doesn't
+        // show: time the benchmarks that got slower again, and only count the
+        // ones that still are
+        if (regressions > 0) {
+            std::vector<const Benchmark *> again;
+            std::vector<unsigned long> again_batches;
+            std::vector<BenchResult> again_results;
+            for (size_t i = 0; i < selected.size(); i++) {
+                for (const char *name : regressed) {
+                    if (strcmp(selected[i]->name, name) == 0) {
+                        again.push_back(selected[i]);
+                        again_batches.push_back(batches[i]);
+                    }
+                }
+            }
+            printf("\r\nTiming %d benchmark(s) again\r\n", regressions);
+            if (!timeBenchmarks(again, again_batches, num_samples, again_results)) {
+                failed = true;
+            }
+            regressions = compareJson(compare_path, again_results, num_samples,
+                                        threshold, NULL);
+        }
+        printf("%d benchmark(s) more than %.1f%% slower\r\n", regressions, threshold);
+    }
+
+    trained_model_ctx_reset(&model_ctx);
+    ei_aligned_free(model_arena);
+    run_classifier_deinit();
+
+    return (failed || (regressions > 0)) ? 1 : 0;
+}
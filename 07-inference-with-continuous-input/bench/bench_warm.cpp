@@ -0,0 +1,217 @@
+/**
+ * Warm model benchmark
+ *
+ * Built with EI_CLASSIFIER_KEEP_WARM=1, so run_classifier() sets up the model,
+ * its arena, the impulse and the features matrix on the first inference and
+ * keeps them. Classifies every window of the recordings twice: cold (with
+ * run_classifier_deinit() before every inference, so each one sets everything
+ * up and frees it again, like the SDK does without EI_CLASSIFIER_KEEP_WARM)
+ * and warm. Checks that both give exactly the same results, counts the SDK's
+ * allocations (ei_malloc() and ei_calloc(), overridden below) per inference
+ * and prints how long each inference takes. With this project's raw block, a
+ * cold inference allocates the model's arena and the features matrix (the
+ * block needs no DSP workspace), and a warm one allocates nothing.
+ *
+ * Build and run with:
+ *
+ *  make warm
+ *  ./build/warm.out tests/alpha.2942e6abeec9.csv tests/beta.67ca58f8af8c.csv
+ *
+ * Returns 1 if the results differ or a warm inference allocates memory.
+ *
+ * License: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <vector>
+
+#include "replay-data.h"
+#include "edge-impulse-sdk/classifier/ei_run_classifier.h"
+
+#if !EI_CLASSIFIER_KEEP_WARM
+#error "Build with -DEI_CLASSIFIER_KEEP_WARM=1 (make warm)"
+#endif
+
+// Settings
+#define REPEAT              1000        // Passes over the windows when timing
+#define SLICES_PER_WINDOW   6           // Same as submission.cpp
+
+// Constants
+#define CONVERT_G_TO_MS2    9.80665f
+#define NUM_CHANNELS        EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME
+#define NUM_READINGS        EI_CLASSIFIER_RAW_SAMPLE_COUNT
+#define NUM_CLASSES         EI_CLASSIFIER_LABEL_COUNT
+#define WINDOW_SIZE         EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE
+#define READINGS_PER_SLICE  (NUM_READINGS / SLICES_PER_WINDOW)
+
+// Means and standard deviations from our dataset curation (same as
+// submission.cpp)
+static const float means[] = {-0.2238, -0.3129, 5.6543, -4.8021, 4.0536, -6.4238};
+static const float std_devs[] = {5.6031, 7.5372, 7.6538, 149.2136, 125.0134, 133.8875};
+
+// Allocations made through the SDK's porting layer
+static unsigned long num_allocs = 0;
+
+/*******************************************************************************
+ * SDK allocation hooks (override the weak ones in the porting layer)
+ */
+
+void *ei_malloc(size_t size) {
+    num_allocs++;
+    return malloc(size);
+}
+
+void *ei_calloc(size_t nitems, size_t size) {
+    num_allocs++;
+    return calloc(nitems, size);
+}
+
+void ei_free(void *ptr) {
+    free(ptr);
+}
+
+/*******************************************************************************
+ * Functions
+ */
+
+// Append every window of a recording (one per slice) to windows
+static size_t cutWindows(const ReplayData &rec, std::vector<float> &windows) {
+
+    size_t num_windows = 0;
+    float val;
+
+    for (size_t start = 0; start + NUM_READINGS <= rec.size();
+            start += READINGS_PER_SLICE) {
+        for (size_t i = 0; i < NUM_READINGS; i++) {
+            for (int ch = 0; ch < NUM_CHANNELS; ch++) {
+                val = rec.column(ReplayData::ACC_X + ch)[start + i];
+                if (ch < 3) {
+                    val *= CONVERT_G_TO_MS2;
+                }
+                windows.push_back((val - means[ch]) / std_devs[ch]);
+            }
+        }
+        num_windows++;
+    }
+
+    return num_windows;
+}
+
+// Seconds since the given time point
+static double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+// Classify every window, cold (everything set up and freed again for each
+// window) or warm. Writes the scores to scores if it isn't NULL. Returns
+// false on error.
+static bool classifyWindows(std::vector<float> &windows, size_t num_windows,
+                            bool cold, float *scores) {
+
+    ei_impulse_result_t result;
+    signal_t sig;
+
+    for (size_t w = 0; w < num_windows; w++) {
+        if (cold) {
+            run_classifier_deinit();
+        }
+        numpy::signal_from_buffer(&windows[w * WINDOW_SIZE], WINDOW_SIZE, &sig);
+        if (run_classifier(&sig, &result, false) != EI_IMPULSE_OK) {
+            return false;
+        }
+        if (scores != NULL) {
+            for (int c = 0; c < NUM_CLASSES; c++) {
+                scores[w * NUM_CLASSES + c] = result.classification[c].value;
+            }
+        }
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+ * Main
+ */
+
+int main(int argc, char **argv) {
+
+    std::vector<float> windows;
+    std::vector<float> cold_scores;
+    std::vector<float> warm_scores;
+    size_t num_windows = 0;
+    unsigned long cold_allocs, warm_allocs;
+    unsigned long mismatches = 0;
+    double cold_s, warm_s;
+
+    if (argc < 2) {
+        printf("Usage: %s <file.csv|file.imub> ...\r\n", argv[0]);
+        return 1;
+    }
+
+    // Cut every recording into windows
+    for (int i = 1; i < argc; i++) {
+        ReplayData rec;
+        if (rec.load(&argv[i], 1) != 0) {
+            printf("ERROR: %s\r\n", rec.error());
+            return 1;
+        }
+        num_windows += cutWindows(rec, windows);
+    }
+    if (num_windows == 0) {
+        printf("ERROR: Recordings are shorter than one window\r\n");
+        return 1;
+    }
+    cold_scores.resize(num_windows * NUM_CLASSES);
+    warm_scores.resize(num_windows * NUM_CLASSES);
+
+    // Check (the last cold inference leaves everything set up for the warm
+    // ones)
+    num_allocs = 0;
+    if (!classifyWindows(windows, num_windows, true, cold_scores.data())) {
+        printf("ERROR: Classification failed\r\n");
+        return 1;
+    }
+    cold_allocs = num_allocs;
+    num_allocs = 0;
+    if (!classifyWindows(windows, num_windows, false, warm_scores.data())) {
+        printf("ERROR: Classification failed\r\n");
+        return 1;
+    }
+    warm_allocs = num_allocs;
+    for (size_t i = 0; i < num_windows * NUM_CLASSES; i++) {
+        if (cold_scores[i] != warm_scores[i]) {
+            mismatches++;
+        }
+    }
+
+    // Time both
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < REPEAT; r++) {
+        classifyWindows(windows, num_windows, true, NULL);
+    }
+    cold_s = secondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < REPEAT; r++) {
+        classifyWindows(windows, num_windows, false, NULL);
+    }
+    warm_s = secondsSince(start);
+    run_classifier_deinit();
+
+    printf("%lu windows from %d recording(s)\r\n", (unsigned long)num_windows,
+        argc - 1);
+    printf("Scores that differ between cold and warm: %lu\r\n", mismatches);
+    printf("Cold: %8.2f us/inference, %.2f allocations/inference\r\n",
+        1000000.0 * cold_s / (num_windows * REPEAT),
+        (double)cold_allocs / num_windows);
+    printf("Warm: %8.2f us/inference, %.2f allocations/inference\r\n",
+        1000000.0 * warm_s / (num_windows * REPEAT),
+        (double)warm_allocs / num_windows);
+
+    return ((mismatches == 0) && (warm_allocs == 0)) ? 0 : 1;
+}
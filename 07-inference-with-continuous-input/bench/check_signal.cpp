@@ -0,0 +1,167 @@
+/**
+ * Signal reuse check
+ *
+ * Reuses one signal_t the ways an application might: pointed at a buffer
+ * with numpy::signal_from_buffer(), then given a get_data callback by hand
+ * (and its segments cleared with numpy::signal_clear_span()), then pointed at
+ * a wrapped ring buffer with numpy::signal_from_ring(), then at a buffer
+ * again. After each change, checks that numpy::signal_read(), a
+ * SignalWithRange wrapper and run_classifier() all see the new samples: the
+ * scores must be exactly the same as for a fresh signal with those samples.
+ *
+ * Build and run with:
+ *
+ *  make check
+ *  ./build/check.out
+ *
+ * Returns 1 if any check fails.
+ *
+ * License: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include <vector>
+
+#include "edge-impulse-sdk/classifier/ei_run_classifier.h"
+#include "edge-impulse-sdk/classifier/ei_signal_with_range.h"
+
+// Constants
+#define NUM_CLASSES         EI_CLASSIFIER_LABEL_COUNT
+#define WINDOW_SIZE         EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE
+#define RING_SPLIT          (WINDOW_SIZE / 3)   // Samples before the ring wraps
+
+// Samples for the get_data callback
+static const float *callback_data = NULL;
+
+// Checks that failed
+static int failures = 0;
+
+/*******************************************************************************
+ * Functions
+ */
+
+// get_data callback that reads from callback_data
+static int getCallbackData(size_t offset, size_t length, float *out_ptr) {
+    memcpy(out_ptr, callback_data + offset, length * sizeof(float));
+    return 0;
+}
+
+// Fill a window with a different wave on each axis
+static void makeWindow(std::vector<float> &window, float freq) {
+    window.resize(WINDOW_SIZE);
+    for (size_t i = 0; i < WINDOW_SIZE; i++) {
+        window[i] = sinf(freq * (float)i) * (1.0f + (float)(i % 6));
+    }
+}
+
+// Classify a signal and return the scores (empty on error)
+static std::vector<float> classify(signal_t *sig) {
+
+    ei_impulse_result_t result;
+    std::vector<float> scores;
+
+    if (run_classifier(sig, &result, false) != EI_IMPULSE_OK) {
+        return scores;
+    }
+    for (int c = 0; c < NUM_CLASSES; c++) {
+        scores.push_back(result.classification[c].value);
+    }
+
+    return scores;
+}
+
+// Check that a signal has the expected samples and gets the expected scores
+static void checkSignal(const char *name, signal_t *sig,
+                        const std::vector<float> &expected,
+                        const std::vector<float> &expected_scores) {
+
+    std::vector<float> samples(WINDOW_SIZE);
+    std::vector<float> range_samples(WINDOW_SIZE / 2);
+    bool ok = true;
+
+    // Read it
+    if ((numpy::signal_read(sig, 0, WINDOW_SIZE, samples.data()) != EIDSP_OK) ||
+            (memcmp(samples.data(), expected.data(), WINDOW_SIZE * sizeof(float)) != 0)) {
+        printf("ERROR: %s: signal_read() doesn't give the samples\r\n", name);
+        ok = false;
+    }
+
+    // Read the second half through a wrapper
+    SignalWithRange range(sig, WINDOW_SIZE / 2, WINDOW_SIZE);
+    if ((numpy::signal_read(range.get_signal(), 0, WINDOW_SIZE / 2,
+                range_samples.data()) != EIDSP_OK) ||
+            (memcmp(range_samples.data(), &expected[WINDOW_SIZE / 2],
+                (WINDOW_SIZE / 2) * sizeof(float)) != 0)) {
+        printf("ERROR: %s: SignalWithRange doesn't give the samples\r\n", name);
+        ok = false;
+    }
+
+    // Classify it
+    if (classify(sig) != expected_scores) {
+        printf("ERROR: %s: run_classifier() scores differ\r\n", name);
+        ok = false;
+    }
+
+    printf("%-32s %s\r\n", name, ok ? "ok" : "FAILED");
+    if (!ok) {
+        failures++;
+    }
+}
+
+/*******************************************************************************
+ * Main
+ */
+
+int main() {
+
+    std::vector<float> window_a, window_b, ring;
+    std::vector<float> scores_a, scores_b;
+    signal_t fresh;
+    signal_t sig;
+
+    // Two windows and what a fresh signal gets for each
+    makeWindow(window_a, 0.05f);
+    makeWindow(window_b, 0.31f);
+    numpy::signal_from_buffer(window_a.data(), WINDOW_SIZE, &fresh);
+    scores_a = classify(&fresh);
+    numpy::signal_from_buffer(window_b.data(), WINDOW_SIZE, &fresh);
+    scores_b = classify(&fresh);
+    if (scores_a.empty() || scores_b.empty()) {
+        printf("ERROR: Classification failed\r\n");
+        return 1;
+    }
+
+    // Window b in a ring buffer that wraps: the newest samples are at the start
+    ring.resize(WINDOW_SIZE);
+    memcpy(ring.data(), &window_b[WINDOW_SIZE - RING_SPLIT], RING_SPLIT * sizeof(float));
+    memcpy(&ring[RING_SPLIT], window_b.data(), (WINDOW_SIZE - RING_SPLIT) * sizeof(float));
+
+    // One signal, reused
+    numpy::signal_from_buffer(window_a.data(), WINDOW_SIZE, &sig);
+    checkSignal("buffer (a)", &sig, window_a, scores_a);
+
+    callback_data = window_b.data();
+    sig.total_length = WINDOW_SIZE;
+    sig.get_data = &getCallbackData;
+    numpy::signal_clear_span(&sig);
+    checkSignal("callback after buffer (b)", &sig, window_b, scores_b);
+
+    numpy::signal_from_ring(&ring[RING_SPLIT], WINDOW_SIZE - RING_SPLIT,
+                            ring.data(), RING_SPLIT, &sig);
+    checkSignal("ring after callback (b)", &sig, window_b, scores_b);
+
+    callback_data = window_a.data();
+    sig.get_data = &getCallbackData;
+    numpy::signal_clear_span(&sig);
+    checkSignal("callback after ring (a)", &sig, window_a, scores_a);
+
+    numpy::signal_from_buffer(window_b.data(), WINDOW_SIZE, &sig);
+    checkSignal("buffer after callback (b)", &sig, window_b, scores_b);
+
+    run_classifier_deinit();
+
+    return (failures == 0) ? 0 : 1;
+}
@@ -27,6 +27,7 @@ using namespace ei;
 #include "edge-impulse-sdk/classifier/ei_model_types.h"
 #include "edge-impulse-sdk/classifier/ei_classifier_types.h"
 #include "edge-impulse-sdk/classifier/ei_nms.h"
+#include "edge-impulse-sdk/dsp/ei_profiler.h"
 
 #ifndef EI_HAS_OBJECT_DETECTION
     #if (EI_CLASSIFIER_OBJECT_DETECTION_LAST_LAYER == EI_CLASSIFIER_LAST_LAYER_SSD)
@@ -326,6 +327,8 @@ __attribute__((unused)) static EI_IMPULSE_ERROR fill_result_struct_i8(const ei_i
                                                                       float zero_point,
                                                                       float scale,
                                                                       bool debug) {
+    EI_PROFILER_SCOPE("postprocess");
+
     for (uint32_t ix = 0; ix < impulse->label_count; ix++) {
         float value = static_cast<float>(data[ix] - zero_point) * scale;
 
@@ -348,6 +351,8 @@ __attribute__((unused)) static EI_IMPULSE_ERROR fill_result_struct_f32(const ei_
                                                                        ei_impulse_result_t *result,
                                                                        float *data,
                                                                        bool debug) {
+    EI_PROFILER_SCOPE("postprocess");
+
     for (uint32_t ix = 0; ix < impulse->label_count; ix++) {
         float value = data[ix];
 
@@ -20,12 +20,14 @@
 
 #include "model-parameters/model_metadata.h"
 
+#include "ei_classifier_config.h"
 #include "ei_run_dsp.h"
 #include "ei_classifier_types.h"
 #include "ei_signal_with_axes.h"
 #include "ei_performance_calibration.h"
 
 #include "edge-impulse-sdk/porting/ei_classifier_porting.h"
+#include "edge-impulse-sdk/dsp/ei_profiler.h"
 
 // for the release we'll put an actual studio version here
 #ifndef EI_CLASSIFIER_STUDIO_VERSION
@@ -87,6 +89,11 @@ void*   __dso_handle = (void*) &__dso_handle;
 #define EI_CLASSIFIER_CALIBRATION_ENABLED 0
 #endif
 
+// Signals run_classifier_batch() extracts features for and classifies at once
+#ifndef EI_CLASSIFIER_BATCH_SIZE
+#define EI_CLASSIFIER_BATCH_SIZE 32
+#endif
+
 #ifdef __cplusplus
 namespace {
 #endif // __cplusplus
@@ -101,11 +108,44 @@ static EI_IMPULSE_ERROR can_run_classifier_image_quantized(const ei_impulse_t *i
 static uint64_t classifier_continuous_features_written = 0;
 static RecognizeEvents *avg_scores = NULL;
 
+#if EI_CLASSIFIER_KEEP_WARM
+static ei::matrix_t *warm_features_matrix = NULL;
+static ei::matrix_t *warm_classify_matrix = NULL;
+#endif
+
 /* Private functions ------------------------------------------------------- */
 
 /* These functions (up to Public functions section) are not exposed to end-user,
 therefore changes are allowed. */
 
+#if EI_CLASSIFIER_KEEP_WARM
+/**
+ * @brief      Get a features matrix that is kept between inferences. It is
+ *             allocated on first use, and again if the impulse has a different
+ *             number of features.
+ *
+ * @param      matrix  Where the matrix is kept
+ * @param[in]  cols    Number of features
+ *
+ * @return     The matrix, or NULL if it could not be allocated
+ */
+static ei::matrix_t *get_warm_matrix(ei::matrix_t **matrix, size_t cols)
+{
+    if (*matrix && (*matrix)->cols != cols) {
+        delete *matrix;
+        *matrix = NULL;
+    }
+    if (!*matrix) {
+        *matrix = new ei::matrix_t(1, cols);
+        if (!(*matrix)->buffer) {
+            delete *matrix;
+            *matrix = NULL;
+        }
+    }
+    return *matrix;
+}
+#endif // EI_CLASSIFIER_KEEP_WARM
+
 /**
  * @brief      Do inferencing over the processed feature matrix
  *
@@ -122,6 +162,8 @@ extern "C" EI_IMPULSE_ERROR run_inference(
     ei_impulse_result_t *result,
     bool debug = false)
 {
+    EI_PROFILER_SCOPE("inference");
+
 #if (EI_CLASSIFIER_INFERENCING_ENGINE != EI_CLASSIFIER_NONE && EI_CLASSIFIER_INFERENCING_ENGINE != EI_CLASSIFIER_DRPAI)
     EI_IMPULSE_ERROR nn_res = run_nn_inference(impulse, fmatrix, result, debug);
     if (nn_res != EI_IMPULSE_OK) {
@@ -146,33 +188,50 @@ extern "C" EI_IMPULSE_ERROR run_inference(
 }
 
 /**
- * @brief      Process a complete impulse
+ * @brief      Size of the DSP workspace for an impulse: room for the features
+ *             (unless they are kept elsewhere), plus scratch for the block
+ *             that needs the most. Raw blocks read the signal straight into
+ *             the features and need none, and flatten blocks need the window
+ *             twice (a copy and its transpose). Other blocks start out with
+ *             the same as flatten, and the workspace grows to what they use
+ *             after their first inference. An impulse with only raw blocks
+ *             and its features kept elsewhere needs no workspace at all.
  *
- * @param      impulse  struct with information about model and DSP
- * @param      signal   Sample data
- * @param      result   Output classifier results
- * @param[in]  debug    Debug output enable
+ * @param      impulse   struct with information about model and DSP
+ * @param[in]  features  Whether the features come from the workspace
  *
- * @return     The ei impulse error.
+ * @return     Workspace size in bytes
  */
-extern "C" EI_IMPULSE_ERROR process_impulse(const ei_impulse_t *impulse,
-                                            signal_t *signal,
-                                            ei_impulse_result_t *result,
-                                            bool debug = false)
+static size_t impulse_workspace_bytes(const ei_impulse_t *impulse, bool features)
 {
+    const size_t align = EI_DSP_WORKSPACE_ALIGN;
+    size_t features_bytes = features ? (impulse->nn_input_frame_size * sizeof(float) + align) : 0;
+    size_t window_bytes = impulse->dsp_input_frame_size * sizeof(float);
+    size_t scratch_bytes = 0;
 
-#if (EI_CLASSIFIER_TFLITE_INPUT_QUANTIZED == 1 && (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE || EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TENSAIFLOW)) || EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_DRPAI
-    // Shortcut for quantized image models
-    if (can_run_classifier_image_quantized(impulse) == EI_IMPULSE_OK) {
-        return run_classifier_image_quantized(impulse, signal, result, debug);
+    for (size_t ix = 0; ix < impulse->dsp_blocks_size; ix++) {
+        if (impulse->dsp_blocks[ix].extract_fn != extract_raw_features) {
+            scratch_bytes = 2 * (window_bytes + align);
+        }
     }
-#endif
 
-    memset(result, 0, sizeof(ei_impulse_result_t));
-
-    ei::matrix_t features_matrix(1, impulse->nn_input_frame_size);
+    return features_bytes + scratch_bytes;
+}
 
-    uint64_t dsp_start_us = ei_read_timer_us();
+/**
+ * @brief      Run all DSP blocks over a signal into one row of features
+ *
+ * @param      impulse          struct with information about model and DSP
+ * @param      signal           Sample data
+ * @param      features_matrix  Output features (1 x nn_input_frame_size)
+ *
+ * @return     The ei impulse error.
+ */
+static EI_IMPULSE_ERROR extract_impulse_features(const ei_impulse_t *impulse,
+                                                 signal_t *signal,
+                                                 ei::matrix_t *features_matrix)
+{
+    EI_PROFILER_SCOPE("dsp");
 
     size_t out_features_index = 0;
 
@@ -184,7 +243,7 @@ extern "C" EI_IMPULSE_ERROR process_impulse(const ei_impulse_t *impulse,
             return EI_IMPULSE_DSP_ERROR;
         }
 
-        ei::matrix_t fm(1, block.n_output_features, features_matrix.buffer + out_features_index);
+        ei::matrix_t fm(1, block.n_output_features, features_matrix->buffer + out_features_index);
 
 #if EIDSP_SIGNAL_C_FN_POINTER
         if (block.axes_size != impulse->raw_samples_per_frame) {
@@ -209,6 +268,63 @@ extern "C" EI_IMPULSE_ERROR process_impulse(const ei_impulse_t *impulse,
         out_features_index += block.n_output_features;
     }
 
+    return EI_IMPULSE_OK;
+}
+
+/**
+ * @brief      Process a complete impulse
+ *
+ * @param      impulse  struct with information about model and DSP
+ * @param      signal   Sample data
+ * @param      result   Output classifier results
+ * @param[in]  debug    Debug output enable
+ *
+ * @return     The ei impulse error.
+ */
+extern "C" EI_IMPULSE_ERROR process_impulse(const ei_impulse_t *impulse,
+                                            signal_t *signal,
+                                            ei_impulse_result_t *result,
+                                            bool debug = false)
+{
+
+#if (EI_CLASSIFIER_TFLITE_INPUT_QUANTIZED == 1 && (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE || EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TENSAIFLOW)) || EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_DRPAI
+    // Shortcut for quantized image models
+    if (can_run_classifier_image_quantized(impulse) == EI_IMPULSE_OK) {
+        return run_classifier_image_quantized(impulse, signal, result, debug);
+    }
+#endif
+
+    memset(result, 0, sizeof(ei_impulse_result_t));
+
+#if EI_CLASSIFIER_KEEP_WARM
+    ei::matrix_t *warm_matrix = get_warm_matrix(&warm_features_matrix, impulse->nn_input_frame_size);
+    if (!warm_matrix) {
+        return EI_IMPULSE_ALLOC_FAILED;
+    }
+    ei::matrix_t &features_matrix = *warm_matrix;
+#endif
+
+    // The features (unless kept warm) and the DSP blocks' scratch come from
+    // the workspace, which gets it all back when the inference is done
+    if (!ei::ei_dsp_workspace_reserve(impulse_workspace_bytes(impulse, !EI_CLASSIFIER_KEEP_WARM))) {
+        return EI_IMPULSE_ALLOC_FAILED;
+    }
+    ei::ei_dsp_workspace_scope dsp_workspace;
+
+#if !EI_CLASSIFIER_KEEP_WARM
+    ei::matrix_t features_matrix(1, impulse->nn_input_frame_size);
+    if (!features_matrix.buffer) {
+        return EI_IMPULSE_ALLOC_FAILED;
+    }
+#endif
+
+    uint64_t dsp_start_us = ei_read_timer_us();
+
+    EI_IMPULSE_ERROR dsp_res = extract_impulse_features(impulse, signal, &features_matrix);
+    if (dsp_res != EI_IMPULSE_OK) {
+        return dsp_res;
+    }
+
     result->timing.dsp_us = ei_read_timer_us() - dsp_start_us;
     result->timing.dsp = (int)(result->timing.dsp_us / 1000);
 
@@ -225,6 +341,9 @@ extern "C" EI_IMPULSE_ERROR process_impulse(const ei_impulse_t *impulse,
         ei_printf("Running impulse...\n");
     }
 
+    // The model allocates from the heap
+    ei::ei_dsp_workspace_end();
+
     return run_inference(impulse, &features_matrix, result, debug);
 
 }
@@ -253,6 +372,21 @@ extern "C" EI_IMPULSE_ERROR process_impulse_continuous(const ei_impulse_t *impul
 
     memset(result, 0, sizeof(ei_impulse_result_t));
 
+#if EI_CLASSIFIER_KEEP_WARM
+    ei::matrix_t *warm_matrix = get_warm_matrix(&warm_classify_matrix, impulse->nn_input_frame_size);
+    if (!warm_matrix) {
+        return EI_IMPULSE_ALLOC_FAILED;
+    }
+#endif
+
+    // The DSP blocks' scratch and the copy of the features to classify (unless
+    // kept warm) come from the workspace, which gets it all back when the
+    // inference is done
+    if (!ei::ei_dsp_workspace_reserve(impulse_workspace_bytes(impulse, !EI_CLASSIFIER_KEEP_WARM))) {
+        return EI_IMPULSE_ALLOC_FAILED;
+    }
+    ei::ei_dsp_workspace_scope dsp_workspace;
+
     EI_IMPULSE_ERROR ei_impulse_error = EI_IMPULSE_OK;
 
     uint64_t dsp_start_us = ei_read_timer_us();
@@ -263,6 +397,7 @@ extern "C" EI_IMPULSE_ERROR process_impulse_continuous(const ei_impulse_t *impul
     bool is_spectrogram = false;
 
     for (size_t ix = 0; ix < impulse->dsp_blocks_size; ix++) {
+        EI_PROFILER_SCOPE("dsp slice");
         ei_model_dsp_t block = impulse->dsp_blocks[ix];
 
         if (out_features_index + block.n_output_features > impulse->nn_input_frame_size) {
@@ -288,8 +423,14 @@ extern "C" EI_IMPULSE_ERROR process_impulse_continuous(const ei_impulse_t *impul
             extract_fn_slice = &extract_mfe_per_slice_features;
             is_mfe = true;
         }
+        else if (block.extract_fn == extract_raw_features) {
+            extract_fn_slice = &extract_raw_per_slice_features;
+        }
+        else if (block.extract_fn == extract_flatten_features) {
+            extract_fn_slice = &extract_flatten_per_slice_features;
+        }
         else {
-            ei_printf("ERR: Unknown extract function, only MFCC, MFE and spectrogram supported\n");
+            ei_printf("ERR: Unknown extract function, only MFCC, MFE, spectrogram, raw and flatten supported\n");
             return EI_IMPULSE_DSP_ERROR;
         }
 
@@ -334,7 +475,11 @@ extern "C" EI_IMPULSE_ERROR process_impulse_continuous(const ei_impulse_t *impul
 
     if (classifier_continuous_features_written >= impulse->nn_input_frame_size) {
         dsp_start_us = ei_read_timer_us();
+#if EI_CLASSIFIER_KEEP_WARM
+        ei::matrix_t &classify_matrix = *warm_matrix;
+#else
         ei::matrix_t classify_matrix(1, impulse->nn_input_frame_size);
+#endif
 
         /* Create a copy of the matrix for normalization */
         for (size_t m_ix = 0; m_ix < impulse->nn_input_frame_size; m_ix++) {
@@ -357,6 +502,9 @@ extern "C" EI_IMPULSE_ERROR process_impulse_continuous(const ei_impulse_t *impul
             ei_printf("Running impulse...\n");
         }
 
+        // The model allocates from the heap
+        ei::ei_dsp_workspace_end();
+
         ei_impulse_error = run_inference(impulse, &classify_matrix, result, debug);
 
 #if EI_CLASSIFIER_CALIBRATION_ENABLED
@@ -409,6 +557,113 @@ extern "C" EI_IMPULSE_ERROR process_impulse_continuous(const ei_impulse_t *impul
 
 }
 
+/**
+ * @brief      Process a batch of complete impulses. Features are extracted
+ *             for up to EI_CLASSIFIER_BATCH_SIZE signals at a time and the
+ *             neural network runs over all of them at once, if the inferencing
+ *             engine supports it (EON compiled float classification models);
+ *             otherwise every signal goes through process_impulse().
+ *
+ * @param      impulse  struct with information about model and DSP
+ * @param      signals  Sample data, one signal per result
+ * @param      count    Number of signals
+ * @param      results  Output classifier results
+ * @param[in]  debug    Debug output enable
+ *
+ * @return     The ei impulse error.
+ */
+extern "C" EI_IMPULSE_ERROR process_impulse_batch(const ei_impulse_t *impulse,
+                                                  signal_t *signals,
+                                                  size_t count,
+                                                  ei_impulse_result_t *results,
+                                                  bool debug = false)
+{
+#if (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE) && (EI_CLASSIFIER_COMPILED == 1)
+    bool batched = !impulse->object_detection &&
+        (impulse->tflite_input_datatype == EI_CLASSIFIER_DATATYPE_FLOAT32) &&
+        (impulse->tflite_output_datatype == EI_CLASSIFIER_DATATYPE_FLOAT32);
+#else
+    bool batched = false;
+#endif
+
+    if (!batched) {
+        for (size_t ix = 0; ix < count; ix++) {
+            EI_IMPULSE_ERROR res = process_impulse(impulse, &signals[ix], &results[ix], debug);
+            if (res != EI_IMPULSE_OK) {
+                return res;
+            }
+        }
+        return EI_IMPULSE_OK;
+    }
+
+#if (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE) && (EI_CLASSIFIER_COMPILED == 1)
+    ei::matrix_t batch_matrix(EI_CLASSIFIER_BATCH_SIZE, impulse->nn_input_frame_size);
+    if (!batch_matrix.buffer) {
+        return EI_IMPULSE_ALLOC_FAILED;
+    }
+
+    for (size_t first = 0; first < count; first += EI_CLASSIFIER_BATCH_SIZE) {
+        size_t rows = count - first;
+        if (rows > EI_CLASSIFIER_BATCH_SIZE) {
+            rows = EI_CLASSIFIER_BATCH_SIZE;
+        }
+        ei_impulse_result_t *batch_results = &results[first];
+
+        for (size_t row = 0; row < rows; row++) {
+            ei::matrix_t features_matrix(1, impulse->nn_input_frame_size,
+                batch_matrix.buffer + (row * impulse->nn_input_frame_size));
+
+            memset(&batch_results[row], 0, sizeof(ei_impulse_result_t));
+
+            uint64_t dsp_start_us = ei_read_timer_us();
+
+            // The DSP blocks' scratch comes from the workspace, one row at a time
+            if (!ei::ei_dsp_workspace_reserve(impulse_workspace_bytes(impulse, false))) {
+                return EI_IMPULSE_ALLOC_FAILED;
+            }
+            ei::ei_dsp_workspace_scope dsp_workspace;
+
+            EI_IMPULSE_ERROR dsp_res = extract_impulse_features(impulse, &signals[first + row], &features_matrix);
+            if (dsp_res != EI_IMPULSE_OK) {
+                return dsp_res;
+            }
+
+            batch_results[row].timing.dsp_us = ei_read_timer_us() - dsp_start_us;
+            batch_results[row].timing.dsp = (int)(batch_results[row].timing.dsp_us / 1000);
+        }
+
+        if (debug) {
+            ei_printf("Running impulse on %d signals...\n", (int)rows);
+        }
+
+        ei::matrix_t fmatrix(rows, impulse->nn_input_frame_size, batch_matrix.buffer);
+        EI_IMPULSE_ERROR nn_res = run_nn_inference_batch(impulse, &fmatrix, batch_results, debug);
+        if (nn_res != EI_IMPULSE_OK) {
+            return nn_res;
+        }
+
+#if EI_CLASSIFIER_HAS_ANOMALY == 1
+        if (impulse->has_anomaly) {
+            for (size_t row = 0; row < rows; row++) {
+                ei::matrix_t features_matrix(1, impulse->nn_input_frame_size,
+                    batch_matrix.buffer + (row * impulse->nn_input_frame_size));
+                EI_IMPULSE_ERROR anomaly_res = inference_anomaly_invoke(impulse, &features_matrix, &batch_results[row], debug);
+                if (anomaly_res != EI_IMPULSE_OK) {
+                    return anomaly_res;
+                }
+            }
+        }
+#endif
+
+        if (ei_run_impulse_check_canceled() == EI_IMPULSE_CANCELED) {
+            return EI_IMPULSE_CANCELED;
+        }
+    }
+#endif
+
+    return EI_IMPULSE_OK;
+}
+
 #if EI_CLASSIFIER_STUDIO_VERSION < 3
 /**
  * @brief      Construct impulse from macros - for run_classifer compatibility
@@ -604,6 +859,7 @@ extern "C" void run_classifier_init()
 
     classifier_continuous_features_written = 0;
     ei_dsp_clear_continuous_audio_state();
+    ei_dsp_clear_continuous_flatten_state();
 
 #if EI_CLASSIFIER_CALIBRATION_ENABLED
 
@@ -629,6 +885,7 @@ __attribute__((unused)) void run_classifier_init(const ei_impulse_t *impulse)
 {
     classifier_continuous_features_written = 0;
     ei_dsp_clear_continuous_audio_state();
+    ei_dsp_clear_continuous_flatten_state();
 
 #if EI_CLASSIFIER_CALIBRATION_ENABLED
     const ei_model_performance_calibration_t *calibration = &ei_calibration;
@@ -645,6 +902,21 @@ extern "C" void run_classifier_deinit(void)
     if((void *)avg_scores != NULL) {
         delete avg_scores;
     }
+
+    ei::ei_dsp_workspace_release();
+    ei_dsp_clear_continuous_audio_state();
+    ei_dsp_clear_continuous_flatten_state();
+
+#if EI_CLASSIFIER_KEEP_WARM
+    delete warm_features_matrix;
+    warm_features_matrix = NULL;
+    delete warm_classify_matrix;
+    warm_classify_matrix = NULL;
+#endif // EI_CLASSIFIER_KEEP_WARM
+
+#if (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE) && (EI_CLASSIFIER_COMPILED == 1)
+    inference_tflite_release();
+#endif
 }
 
 /**
@@ -664,7 +936,11 @@ extern "C" EI_IMPULSE_ERROR run_classifier_continuous(
     bool enable_maf = true)
 {
 #if EI_CLASSIFIER_STUDIO_VERSION < 3
+#if EI_CLASSIFIER_KEEP_WARM
+        static const ei_impulse_t impulse = ei_construct_impulse();
+#else
         const ei_impulse_t impulse = ei_construct_impulse();
+#endif
 #else
        const ei_impulse_t impulse = ei_default_impulse;
 #endif
@@ -705,7 +981,11 @@ extern "C" EI_IMPULSE_ERROR run_classifier(
     bool debug = false)
 {
 #if EI_CLASSIFIER_STUDIO_VERSION < 3
+#if EI_CLASSIFIER_KEEP_WARM
+        static const ei_impulse_t impulse = ei_construct_impulse();
+#else
         const ei_impulse_t impulse = ei_construct_impulse();
+#endif
 #else
        const ei_impulse_t impulse = ei_default_impulse;
 #endif
@@ -730,6 +1010,52 @@ __attribute__((unused)) EI_IMPULSE_ERROR run_classifier(
     return process_impulse(impulse, signal, result, debug);
 }
 
+/**
+ * Run the classifier over a batch of signals. Gives the same results as
+ * calling run_classifier() on each signal, but the neural network runs over
+ * many signals at once, which is a lot faster when there are many windows to
+ * classify (offline evaluation, or a gateway serving many devices).
+ * @param signals Sample data, one signal per result
+ * @param count Number of signals
+ * @param results Array of count objects to store the results in
+ * @param debug Whether to show debug messages (default: false)
+ */
+extern "C" EI_IMPULSE_ERROR run_classifier_batch(
+    signal_t *signals,
+    size_t count,
+    ei_impulse_result_t *results,
+    bool debug = false)
+{
+#if EI_CLASSIFIER_STUDIO_VERSION < 3
+#if EI_CLASSIFIER_KEEP_WARM
+        static const ei_impulse_t impulse = ei_construct_impulse();
+#else
+        const ei_impulse_t impulse = ei_construct_impulse();
+#endif
+#else
+       const ei_impulse_t impulse = ei_default_impulse;
+#endif
+    return process_impulse_batch(&impulse, signals, count, results, debug);
+}
+
+/**
+ * Run the impulse over a batch of signals
+ * @param impulse struct with information about model and DSP
+ * @param signals Sample data, one signal per result
+ * @param count Number of signals
+ * @param results Array of count objects to store the results in
+ * @param debug Whether to show debug messages (default: false)
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR run_classifier_batch(
+    const ei_impulse_t *impulse,
+    signal_t *signals,
+    size_t count,
+    ei_impulse_result_t *results,
+    bool debug = false)
+{
+    return process_impulse_batch(impulse, signals, count, results, debug);
+}
+
 /* Deprecated functions ------------------------------------------------------- */
 
 /* These functions are being deprecated and possibly will be removed or moved in future.
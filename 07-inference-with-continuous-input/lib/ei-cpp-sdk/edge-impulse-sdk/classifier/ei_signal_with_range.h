@@ -19,6 +19,7 @@
 #define _EI_CLASSIFIER_SIGNAL_WITH_RANGE_H_
 
 #include "edge-impulse-sdk/dsp/numpy_types.h"
+#include "edge-impulse-sdk/dsp/numpy.hpp"
 #include "edge-impulse-sdk/dsp/returntypes.hpp"
 
 #if !EIDSP_SIGNAL_C_FN_POINTER
@@ -46,6 +47,7 @@ public:
             return this->get_data(offset, length, out_ptr);
         };
 #endif
+        numpy::signal_clear_span(&wrapped_signal);
         return &wrapped_signal;
     }
 
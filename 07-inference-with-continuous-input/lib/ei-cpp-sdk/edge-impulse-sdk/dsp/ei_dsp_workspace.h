@@ -0,0 +1,106 @@
+/*
+ * Scratch memory for the DSP blocks
+ *
+ * A bump allocator that the DSP blocks draw their matrices and buffers from
+ * while an impulse runs (between ei_dsp_workspace_begin() and
+ * ei_dsp_workspace_end()), and that gets all of it back at once with
+ * ei_dsp_workspace_reset() when the inference is done. Freeing workspace
+ * memory does nothing. The workspace is allocated once, so the hot path
+ * doesn't go through malloc() and free(), and the memory the DSP uses is the
+ * same for every inference.
+ *
+ * When the workspace isn't in use, or doesn't have room left, allocations go
+ * to the heap (ei_calloc()) as before. The workspace keeps track of how much
+ * an inference would have needed, and grows to that on the next reset, so it
+ * only overflows on the first inferences of a block it wasn't sized for.
+ *
+ * There is one workspace per thread on platforms with thread-local storage
+ * (one per process otherwise).
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an "AS
+ * IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef _EIDSP_WORKSPACE_H_
+#define _EIDSP_WORKSPACE_H_
+
+#include <stddef.h>
+
+// Allocations from the workspace are rounded up to this many bytes
+#define EI_DSP_WORKSPACE_ALIGN      16
+
+#ifdef __cplusplus
+namespace ei {
+
+/**
+ * Make the workspace at least bytes big. It only grows while nothing is
+ * allocated from it.
+ * @returns false if out of memory
+ */
+bool ei_dsp_workspace_reserve(size_t bytes);
+
+/**
+ * Send allocations to the workspace (begin) or back to the heap (end).
+ * Memory allocated in between stays valid until ei_dsp_workspace_reset().
+ */
+void ei_dsp_workspace_begin();
+void ei_dsp_workspace_end();
+
+/**
+ * Take back everything allocated from the workspace, and grow it if the
+ * allocations since the last reset didn't fit.
+ */
+void ei_dsp_workspace_reset();
+
+/**
+ * Free the workspace.
+ */
+void ei_dsp_workspace_release();
+
+/**
+ * Zeroed memory, from the workspace while it's in use and has room, from the
+ * heap otherwise. Free it with ei_dsp_workspace_free().
+ */
+void *ei_dsp_workspace_calloc(size_t bytes);
+void ei_dsp_workspace_free(void *ptr);
+
+/**
+ * Size of the workspace, and the most of it that was in use (or would have
+ * been if it had been big enough) since it was allocated.
+ */
+size_t ei_dsp_workspace_size();
+size_t ei_dsp_workspace_peak();
+
+/**
+ * Uses the workspace while in scope, then takes everything back.
+ */
+class ei_dsp_workspace_scope {
+public:
+    ei_dsp_workspace_scope() {
+        ei_dsp_workspace_begin();
+    }
+
+    ~ei_dsp_workspace_scope() {
+        ei_dsp_workspace_end();
+        ei_dsp_workspace_reset();
+    }
+
+private:
+    ei_dsp_workspace_scope(const ei_dsp_workspace_scope&);
+    ei_dsp_workspace_scope& operator=(const ei_dsp_workspace_scope&);
+};
+
+} // namespace ei
+#endif // __cplusplus
+
+#endif // _EIDSP_WORKSPACE_H_
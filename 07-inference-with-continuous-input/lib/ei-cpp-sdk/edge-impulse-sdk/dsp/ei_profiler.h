@@ -18,8 +18,170 @@
 #ifndef __EIPROFILER__H__
 #define __EIPROFILER__H__
 
+/*
+ * Scoped tracing
+ *
+ * An EiProfilerScope (or EI_PROFILER_SCOPE()) records a span from where it is
+ * created to where it goes out of scope (or end() is called): its name, when
+ * it started and how long it took on the monotonic clock, and how much CPU
+ * time the thread spent in it. Spans nest like the scopes they come from.
+ * EI_PROFILER_FLOW_BEGIN() and EI_PROFILER_FLOW_END() link the spans they
+ * are in with an arrow, e.g. a slice handed from one thread to another.
+ *
+ * Nothing is recorded until ei_profiler_start(). Each thread then writes to
+ * a ring buffer of its own (the oldest events are overwritten once it's
+ * full), so recording takes no locks. ei_profiler_write_chrome_trace() writes
+ * everything out as Chrome trace JSON, which chrome://tracing and Perfetto
+ * (ui.perfetto.dev) show as a timeline with one track per thread. Stop the
+ * threads that record (or call ei_profiler_stop() and let them finish their
+ * spans) before writing the trace.
+ *
+ * Span and thread names must outlive the trace (string literals or other
+ * static strings): only the pointer is kept.
+ *
+ * Tracing needs the POSIX clocks, so it's only built on Linux and macOS. With
+ * EI_PROFILER_ENABLED 0, all of the functions and the scope do nothing.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
 #include "edge-impulse-sdk/porting/ei_classifier_porting.h"
 
+#ifndef EI_PROFILER_ENABLED
+#if defined(__linux__) || defined(__APPLE__)
+#define EI_PROFILER_ENABLED             1
+#else
+#define EI_PROFILER_ENABLED             0
+#endif
+#endif
+
+// Events kept per thread (each takes 48 bytes, allocated when the thread
+// records its first event)
+#ifndef EI_PROFILER_EVENTS_PER_THREAD
+#define EI_PROFILER_EVENTS_PER_THREAD   16384
+#endif
+
+#if EI_PROFILER_ENABLED
+
+#include <atomic>
+#include <time.h>
+
+// Set while recording (see ei_profiler_start())
+extern std::atomic<bool> ei_profiler_recording;
+
+/**
+ * Monotonic clock, and CPU time of the calling thread, in nanoseconds
+ */
+static inline uint64_t ei_profiler_now_ns() {
+    struct timespec spec;
+    clock_gettime(CLOCK_MONOTONIC, &spec);
+    return ((uint64_t)spec.tv_sec * 1000000000ULL) + spec.tv_nsec;
+}
+
+static inline uint64_t ei_profiler_thread_cpu_ns() {
+    struct timespec spec;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &spec);
+    return ((uint64_t)spec.tv_sec * 1000000000ULL) + spec.tv_nsec;
+}
+
+static inline bool ei_profiler_enabled() {
+    return ei_profiler_recording.load(std::memory_order_relaxed);
+}
+
+/**
+ * Throw away what was recorded and start recording, or stop
+ */
+void ei_profiler_start();
+void ei_profiler_stop();
+
+/**
+ * Name the calling thread's track in the trace
+ */
+void ei_profiler_set_thread_name(const char *name);
+
+/**
+ * Record a span that started at start_ns (monotonic clock) and cpu_start_ns
+ * (thread CPU time) and ends now, or one end of a flow arrow (see
+ * EI_PROFILER_FLOW_BEGIN())
+ */
+void ei_profiler_record_span(const char *name, uint64_t start_ns, uint64_t cpu_start_ns);
+void ei_profiler_record_flow(const char *name, uint64_t id, bool end);
+
+/**
+ * Write everything recorded as Chrome trace JSON
+ * @returns 0 if successful, -1 if the file couldn't be written
+ */
+int ei_profiler_write_chrome_trace(const char *path);
+
+/**
+ * Records a span while in scope (or until end())
+ */
+class EiProfilerScope {
+public:
+    explicit EiProfilerScope(const char *name) : name(name), active(ei_profiler_enabled())
+    {
+        if (active) {
+            start_ns = ei_profiler_now_ns();
+            cpu_start_ns = ei_profiler_thread_cpu_ns();
+        }
+    }
+    ~EiProfilerScope()
+    {
+        end();
+    }
+    void end()
+    {
+        if (active) {
+            ei_profiler_record_span(name, start_ns, cpu_start_ns);
+            active = false;
+        }
+    }
+
+private:
+    EiProfilerScope(const EiProfilerScope&);
+    EiProfilerScope& operator=(const EiProfilerScope&);
+
+    const char *name;
+    bool active;
+    uint64_t start_ns;
+    uint64_t cpu_start_ns;
+};
+
+#define EI_PROFILER_FLOW_BEGIN(name, id) \
+    do { if (ei_profiler_enabled()) ei_profiler_record_flow((name), (id), false); } while (0)
+#define EI_PROFILER_FLOW_END(name, id) \
+    do { if (ei_profiler_enabled()) ei_profiler_record_flow((name), (id), true); } while (0)
+
+#else
+
+static inline bool ei_profiler_enabled() { return false; }
+static inline void ei_profiler_start() { }
+static inline void ei_profiler_stop() { }
+static inline void ei_profiler_set_thread_name(const char *name) { (void)name; }
+static inline int ei_profiler_write_chrome_trace(const char *path) { (void)path; return -1; }
+
+class EiProfilerScope {
+public:
+    explicit EiProfilerScope(const char *name) { (void)name; }
+    void end() { }
+};
+
+#define EI_PROFILER_FLOW_BEGIN(name, id) do { } while (0)
+#define EI_PROFILER_FLOW_END(name, id)   do { } while (0)
+
+#endif // EI_PROFILER_ENABLED
+
+#define EI_PROFILER_CONCAT_(a, b)   a ## b
+#define EI_PROFILER_CONCAT(a, b)    EI_PROFILER_CONCAT_(a, b)
+
+// Record a span from here to the end of the enclosing scope
+#define EI_PROFILER_SCOPE(name) \
+    EiProfilerScope EI_PROFILER_CONCAT(ei_profiler_scope_, __LINE__)(name)
+
+/**
+ * Prints how long each step took since the last one (in microseconds), and
+ * records it as a span while tracing (so the message has to be static too)
+ */
 class EiProfiler {
 public:
     EiProfiler()
@@ -28,16 +190,30 @@ public:
     }
     void reset()
     {
-        timestamp = ei_read_timer_ms();
+        timestamp = ei_read_timer_us();
+#if EI_PROFILER_ENABLED
+        start_ns = ei_profiler_now_ns();
+        cpu_start_ns = ei_profiler_thread_cpu_ns();
+#endif
     }
     void report(const char *message)
     {
-        ei_printf("%s took %llu\r\n", message, ei_read_timer_ms() - timestamp);
-        timestamp = ei_read_timer_ms(); //read again to not count printf time
+#if EI_PROFILER_ENABLED
+        if (ei_profiler_enabled()) {
+            ei_profiler_record_span(message, start_ns, cpu_start_ns);
+        }
+#endif
+        ei_printf("%s took %llu us\r\n", message,
+            (unsigned long long)(ei_read_timer_us() - timestamp));
+        reset(); //read again to not count printf time
     }
 
 private:
     uint64_t timestamp;
+#if EI_PROFILER_ENABLED
+    uint64_t start_ns;
+    uint64_t cpu_start_ns;
+#endif
 };
 
 #endif  //!__EIPROFILER__H__
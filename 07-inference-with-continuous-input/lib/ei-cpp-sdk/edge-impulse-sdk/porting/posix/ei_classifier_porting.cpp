@@ -47,7 +47,8 @@ uint64_t ei_read_timer_us() {
     uint64_t s;  // Seconds
     struct timespec spec;
 
-    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &spec);
+    // Wall clock time: the process CPU time would add up every thread
+    clock_gettime(CLOCK_MONOTONIC, &spec);
 
     s  = spec.tv_sec;
     us = round(spec.tv_nsec / 1.0e3); // Convert nanoseconds to micros
@@ -0,0 +1,94 @@
+/* Per-channel quantized int8 fully connected kernel with runtime SIMD
+dispatch.
+
+Uses the TFLite int8 scheme: activations are asymmetric int8 (one scale and
+zero point per tensor), weights are symmetric int8 with one scale per output
+channel, and biases are int32 in units of input scale * weight scale. Each
+output is requantized with its own multiplier and shift, like
+reference_integer_ops::FullyConnected() does with a single one.
+
+On x86 hosts (EI_CLASSIFIER_TFLITE_ENABLE_X86_SIMD == 1) the best of AVX2,
+AVX-VNNI and AVX-512 VNNI that the CPU and OS support is picked the first time
+the kernel runs (cpuid, via __builtin_cpu_supports). The VNNI instructions
+multiply unsigned by signed bytes, so those kernels flip the inputs to
+unsigned (x + 128) and take 128 * sum(weights) back off, which is why every
+layer needs the sums of its weights. All the arithmetic before requantizing
+is exact 32-bit integer math, so every level gives bit-identical results.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_KERNELS_INT8_SIMD_H_
+#define TENSORFLOW_LITE_MICRO_KERNELS_INT8_SIMD_H_
+
+#include <stdint.h>
+
+namespace tflite {
+namespace int8_simd {
+
+// Kernel variants, from slowest to fastest
+enum SimdLevel {
+  kSimdPortable = 0,
+  kSimdAvx2,
+  kSimdAvxVnni,
+  kSimdAvx512Vnni,
+  kSimdLevelCount
+};
+
+// One quantized fully connected layer
+struct FullyConnectedParams {
+  int depth;                         // Inputs per row
+  int outputs;                       // Output channels
+  const int8_t* weights;             // [outputs][depth]
+  const int32_t* weight_sums;        // Sum of each channel's weights
+  const int32_t* bias;               // [outputs], may be null
+  const int32_t* output_multiplier;  // [outputs]
+  const int32_t* output_shift;       // [outputs]
+  int32_t input_offset;              // Minus the input zero point
+  int32_t output_offset;             // Output zero point
+  int32_t activation_min;            // Quantized output range
+  int32_t activation_max;
+};
+
+// The best level this CPU supports, and the level the kernel uses (the best
+// one unless changed with SetSimdLevel()).
+SimdLevel DetectedSimdLevel();
+SimdLevel GetSimdLevel();
+
+// Makes the kernel use the given level, or the best supported one below it.
+// Returns the level now in use. Meant for tests and benchmarks: don't call it
+// while kernels are running on other threads.
+SimdLevel SetSimdLevel(SimdLevel level);
+
+const char* SimdLevelName(SimdLevel level);
+
+// Fills weight_sums[o] with the sum of weights[o][0..depth).
+void WeightSums(const int8_t* weights, int depth, int outputs,
+                int32_t* weight_sums);
+
+// Quantizes size floats: output[i] = clamp(round(input[i] * (1 / scale)) +
+// zero_point, -128, 127), rounding halves to even. Unlike TFLite's Quantize
+// op (input / scale, halves away from zero) this gives the same results on
+// every level.
+void Quantize(const float* input, int size, float scale, int32_t zero_point,
+              int8_t* output);
+
+// Runs the layer on rows rows of params.depth inputs. output gets rows rows of
+// params.outputs values.
+void FullyConnected(const FullyConnectedParams& params, const int8_t* input,
+                    int rows, int8_t* output);
+
+}  // namespace int8_simd
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_KERNELS_INT8_SIMD_H_
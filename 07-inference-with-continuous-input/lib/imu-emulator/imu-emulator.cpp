@@ -2,6 +2,9 @@
  * IMU emulator class definition
  */
 
+#include <string.h>
+
+#include "time-emulator.h"
 #include "imu-emulator.h"
 
 // Global ImuEmu object (to emulate the Arduino LSM9DS1 library)
@@ -38,6 +41,34 @@ int ImuEmu::registerGyroCallback(gyro_func_ptr cb) {
     return 0;
 }
 
+// Register frame callback function (supplies all 6 axes for a given time)
+int ImuEmu::registerFrameCallback(frame_func_ptr cb) {
+
+    // Assign callback if there is not one already
+    if ((frame_cb_ptr != 0) || (frame_ctx_cb_ptr != 0)) {
+        return -1;
+    } else {
+        frame_cb_ptr = cb;
+    }
+    
+    return 0;
+}
+
+// Register frame callback function that is also given a context pointer (so
+// that each emulated device can supply its own readings)
+int ImuEmu::registerFrameCallback(frame_ctx_func_ptr cb, void *ctx) {
+
+    // Assign callback if there is not one already
+    if ((frame_cb_ptr != 0) || (frame_ctx_cb_ptr != 0)) {
+        return -1;
+    } else {
+        frame_ctx_cb_ptr = cb;
+        frame_ctx = ctx;
+    }
+    
+    return 0;
+}
+
 // Blank begin that does nothing
 int ImuEmu::begin() {
     return 1;
@@ -49,7 +80,7 @@ int ImuEmu::begin() {
 int ImuEmu::readAcceleration(float& x, float& y, float& z) {
     
     // Call the callback function (implemented by the autograder)
-    if (accel_cb_ptr == 0) {
+    if ((accel_cb_ptr == 0) || dropReading()) {
         return 0;
     }
     int ret = accel_cb_ptr(x, y, z);
@@ -63,10 +94,190 @@ int ImuEmu::readAcceleration(float& x, float& y, float& z) {
 int ImuEmu::readGyroscope(float& x, float& y, float& z) {
     
     // Call the callback function (implemented by the autograder)
-    if (gyro_cb_ptr == 0) {
+    if ((gyro_cb_ptr == 0) || dropReading()) {
         return 0;
     }
     int ret = gyro_cb_ptr(x, y, z);
 
     return ret;
-}
\ No newline at end of file
+}
+
+// Start capturing frames into the FIFO at the given rate (first frame is
+// captured one sample period plus phase_us from now)
+// Returns 0 on failure, 1 on success
+int ImuEmu::beginFifo(float sample_rate_hz, unsigned long phase_us) {
+
+    if ((sample_rate_hz <= 0.0f) || (sample_rate_hz > IMU_EMU_MAX_ODR_HZ)) {
+        return 0;
+    }
+
+    fifo_period_us = (unsigned long)(1000000.0f / sample_rate_hz);
+    if (fifo_period_us == 0) {
+        return 0;
+    }
+    fifo_next_us = micros() + fifo_period_us + phase_us;
+    fifo_head = 0;
+    fifo_count = 0;
+    fifo_overruns = 0;
+    fifo_rate_hz = sample_rate_hz;
+    fifo_enabled = true;
+
+    return 1;
+}
+
+// Stop capturing frames and throw away anything left in the FIFO
+void ImuEmu::endFifo() {
+    fifo_enabled = false;
+    fifo_head = 0;
+    fifo_count = 0;
+}
+
+// Set the FIFO level (in frames) that raises the watermark flag
+void ImuEmu::setFifoWatermark(size_t frames) {
+    if (frames < 1) {
+        frames = 1;
+    } else if (frames > IMU_EMU_FIFO_SIZE) {
+        frames = IMU_EMU_FIFO_SIZE;
+    }
+    fifo_watermark = frames;
+}
+
+// Return the number of frames waiting in the FIFO
+size_t ImuEmu::fifoAvailable() {
+    fillFifo();
+    return fifo_count;
+}
+
+// Copy up to max_frames of the oldest frames out of the FIFO into out
+// (IMU_EMU_FRAME_SIZE interleaved floats per frame). If watermark is given, it
+// is set to whether the FIFO had reached the watermark level before the read.
+// Returns the number of frames copied.
+size_t ImuEmu::readFifoBurst(float *out, size_t max_frames, bool *watermark) {
+
+    size_t num_frames;
+    size_t tail;
+
+    // Bring the FIFO up to date
+    fillFifo();
+    if (watermark != nullptr) {
+        *watermark = (fifo_count >= fifo_watermark);
+    }
+
+    // Copy oldest frames first
+    num_frames = (max_frames < fifo_count) ? max_frames : fifo_count;
+    tail = (fifo_head + IMU_EMU_FIFO_SIZE - fifo_count) % IMU_EMU_FIFO_SIZE;
+    for (size_t i = 0; i < num_frames; i++) {
+        memcpy(&out[i * IMU_EMU_FRAME_SIZE], 
+                &fifo[tail * IMU_EMU_FRAME_SIZE], 
+                IMU_EMU_FRAME_SIZE * sizeof(float));
+        tail = (tail + 1) % IMU_EMU_FIFO_SIZE;
+    }
+    fifo_count -= num_frames;
+
+    return num_frames;
+}
+
+// Capture every frame that the sensor would have sampled by now
+void ImuEmu::fillFifo() {
+
+    unsigned long now_us;
+    unsigned long num_frames;
+    unsigned long skip;
+    unsigned long sample_us;
+    long offset_us;
+
+    if (!fifo_enabled) {
+        return;
+    }
+
+    // See how many sample periods have elapsed
+    now_us = micros();
+    if ((long)(now_us - fifo_next_us) < 0) {
+        return;
+    }
+    num_frames = ((now_us - fifo_next_us) / fifo_period_us) + 1;
+
+    // Frames that would be overwritten before anyone reads them are never
+    // captured, but they still count as overruns
+    if (num_frames > IMU_EMU_FIFO_SIZE) {
+        skip = num_frames - IMU_EMU_FIFO_SIZE;
+        fifo_overruns += skip + fifo_count;
+        fifo_next_us += skip * fifo_period_us;
+        fifo_count = 0;
+        num_frames = IMU_EMU_FIFO_SIZE;
+    }
+
+    // Capture frames (overwrite the oldest one if the FIFO is full)
+    for (unsigned long i = 0; i < num_frames; i++) {
+        if (dropReading()) {
+            fifo_next_us += fifo_period_us;
+            continue;
+        }
+        sample_us = fifo_next_us;
+        if (jitter_us > 0) {
+            offset_us = (long)(nextRand() % ((2 * jitter_us) + 1)) - (long)jitter_us;
+            if ((offset_us >= 0) || ((unsigned long)-offset_us < sample_us)) {
+                sample_us += offset_us;
+            }
+        }
+        captureFrame(sample_us, &fifo[fifo_head * IMU_EMU_FRAME_SIZE]);
+        fifo_head = (fifo_head + 1) % IMU_EMU_FIFO_SIZE;
+        if (fifo_count < IMU_EMU_FIFO_SIZE) {
+            fifo_count++;
+        } else {
+            fifo_overruns++;
+        }
+        fifo_next_us += fifo_period_us;
+    }
+}
+
+// Get the frame sampled at the given time from the autograder
+void ImuEmu::captureFrame(unsigned long time_us, float *frame) {
+
+    // Prefer the frame callbacks, as they know when the frame was sampled
+    if (frame_ctx_cb_ptr != 0) {
+        if (frame_ctx_cb_ptr(frame_ctx, time_us, frame)) {
+            return;
+        }
+    } else if (frame_cb_ptr != 0) {
+        if (frame_cb_ptr(time_us, frame)) {
+            return;
+        }
+    } else if ((accel_cb_ptr != 0) && (gyro_cb_ptr != 0)) {
+        if (accel_cb_ptr(frame[0], frame[1], frame[2]) && 
+            gyro_cb_ptr(frame[3], frame[4], frame[5])) {
+            return;
+        }
+    }
+
+    // No data available
+    memset(frame, 0, IMU_EMU_FRAME_SIZE * sizeof(float));
+}
+
+// Jitter FIFO sample times by up to +/- jitter_us and drop the given fraction
+// of readings. The same seed gives the same impairments every run.
+void ImuEmu::setImpairments(unsigned long jitter_us, float drop_probability, 
+                            uint32_t seed) {
+    this->jitter_us = jitter_us;
+    this->drop_probability = drop_probability;
+    rand_state = (seed != 0) ? seed : 1;
+    dropped_readings = 0;
+}
+
+// Decide whether the next reading is lost
+bool ImuEmu::dropReading() {
+    if ((drop_probability <= 0.0f) || 
+        ((nextRand() / 4294967296.0) >= drop_probability)) {
+        return false;
+    }
+    dropped_readings++;
+    return true;
+}
+
+// Xorshift random number generator
+uint32_t ImuEmu::nextRand() {
+    rand_state ^= rand_state << 13;
+    rand_state ^= rand_state >> 17;
+    rand_state ^= rand_state << 5;
+    return rand_state;
+}
@@ -1,6 +1,25 @@
 /**
  * Emulate the IMU class in Arduino.
  * 
+ * Besides the one-shot readAcceleration()/readGyroscope() calls, this emulates
+ * the LSM9DS1 on-chip FIFO (32 slots, continuous mode). Once enabled with
+ * beginFifo(), 6-axis frames (accX, accY, accZ, gyrX, gyrY, gyrZ) are captured
+ * at the given sample rate and can be read out several at a time with
+ * readFifoBurst(). If the FIFO fills up, the oldest frame is overwritten and
+ * the overrun counter is incremented, just like on the real sensor.
+ * 
+ * The global IMU object stands in for the Arduino library, but more ImuEmu
+ * objects can be created to emulate several devices in one process (see
+ * imu-fleet.h). Frame callbacks can be given a context pointer so that each
+ * device can replay its own recording, and beginFifo() takes a phase offset
+ * so that devices don't all sample at the same instant.
+ * 
+ * The FIFO can run at any output data rate up to IMU_EMU_MAX_ODR_HZ (the
+ * callbacks are given the exact sample times, so they can interpolate between
+ * the rows of a recording). Sensor impairments can be injected with
+ * setImpairments(): FIFO sample times can be jittered, and any reading can be
+ * dropped (the read fails, or the frame never makes it into the FIFO).
+ * 
  * Author: Shawn Hymel (Edge Impulse)
  * Date: August 26, 2022
  * License: Apache-2.0
@@ -24,23 +43,75 @@
 #ifndef IMUEMU_H
 #define IMUEMU_H
 
+#include <stddef.h>
+#include <stdint.h>
+
+// Emulated FIFO settings
+#define IMU_EMU_FIFO_SIZE       32      // Number of frames the FIFO can hold
+#define IMU_EMU_FRAME_SIZE      6       // Floats per frame (accel + gyro)
+#define IMU_EMU_MAX_ODR_HZ      1600    // Fastest FIFO rate (LSM9DS1 accel)
+
 // Callback function pointer types
 typedef int (*accel_func_ptr)(float&, float&, float&);
 typedef int (*gyro_func_ptr)(float&, float&, float&);
+typedef int (*frame_func_ptr)(unsigned long time_us, float *frame);
+typedef int (*frame_ctx_func_ptr)(void *ctx, unsigned long time_us, float *frame);
 
 class ImuEmu {
     public:
         ImuEmu();
         int registerAccelCallback(accel_func_ptr cb);
         int registerGyroCallback(gyro_func_ptr cb);
+        int registerFrameCallback(frame_func_ptr cb);
+        int registerFrameCallback(frame_ctx_func_ptr cb, void *ctx);
 
         // Arduino interface
         int begin();
         int readAcceleration(float& x, float& y, float& z);
         int readGyroscope(float& x, float& y, float& z);
+
+        // Emulated FIFO interface
+        int beginFifo(float sample_rate_hz, unsigned long phase_us = 0);
+        void endFifo();
+        void setFifoWatermark(size_t frames);
+        size_t fifoAvailable();
+        size_t readFifoBurst(float *out, size_t max_frames, bool *watermark = nullptr);
+        unsigned long fifoOverruns() const { return fifo_overruns; }
+        unsigned long fifoNextFrameUs() const { return fifo_next_us; }
+        float fifoSampleRate() const { return fifo_rate_hz; }
+
+        // Injected impairments (off by default)
+        void setImpairments(unsigned long jitter_us, float drop_probability, 
+                            uint32_t seed = 1);
+        unsigned long droppedReadings() const { return dropped_readings; }
     private:
+        void fillFifo();
+        void captureFrame(unsigned long time_us, float *frame);
+        bool dropReading();
+        uint32_t nextRand();
+
         accel_func_ptr accel_cb_ptr = 0;
         gyro_func_ptr gyro_cb_ptr = 0;
+        frame_func_ptr frame_cb_ptr = 0;
+        frame_ctx_func_ptr frame_ctx_cb_ptr = 0;
+        void *frame_ctx = 0;
+
+        // FIFO state (frames are captured lazily when the FIFO is accessed)
+        float fifo[IMU_EMU_FIFO_SIZE * IMU_EMU_FRAME_SIZE];
+        size_t fifo_head = 0;
+        size_t fifo_count = 0;
+        size_t fifo_watermark = IMU_EMU_FIFO_SIZE;
+        bool fifo_enabled = false;
+        unsigned long fifo_period_us = 0;
+        unsigned long fifo_next_us = 0;
+        unsigned long fifo_overruns = 0;
+        float fifo_rate_hz = 0.0f;
+
+        // Impairment state
+        unsigned long jitter_us = 0;
+        float drop_probability = 0.0f;
+        unsigned long dropped_readings = 0;
+        uint32_t rand_state = 1;
 };
 
 // Declare global object (to emulate Arduino LSM9DS1 library)
@@ -0,0 +1,214 @@
+/**
+ * IMU fleet definition
+ */
+
+#include "time-emulator.h"
+#include "imu-fleet.h"
+
+// Constructor
+ImuFleet::ImuFleet() {
+    for (int i = 0; i < IMU_FLEET_WHEEL_SLOTS; i++) {
+        slot_head[i] = -1;
+    }
+}
+
+// Destructor
+ImuFleet::~ImuFleet() {
+    end();
+}
+
+// Make room for the devices
+int ImuFleet::begin(size_t max_devices, float sample_rate_hz,
+                    size_t frames_per_slice, unsigned long tick_us) {
+
+    end();
+    if ((max_devices == 0) || (sample_rate_hz <= 0.0f) || 
+        (frames_per_slice == 0) || (frames_per_slice > IMU_EMU_FIFO_SIZE) ||
+        (tick_us == 0)) {
+        return -1;
+    }
+
+    devices = new ImuEmu[max_devices];
+    phase_us = new unsigned long[max_devices];
+    due_us = new unsigned long[max_devices];
+    due_tick = new unsigned long[max_devices];
+    next_in_slot = new int[max_devices];
+    ready = new int[max_devices];
+    this->max_devices = max_devices;
+    this->sample_rate_hz = sample_rate_hz;
+    this->frames_per_slice = frames_per_slice;
+    this->tick_us = tick_us;
+
+    // Same sample period as the emulated FIFO works out
+    slice_period_us = (unsigned long)(1000000.0f / sample_rate_hz) * 
+                        frames_per_slice;
+
+    return 0;
+}
+
+// Stop the devices and free everything
+void ImuFleet::end() {
+    stop();
+    delete[] devices;
+    delete[] phase_us;
+    delete[] due_us;
+    delete[] due_tick;
+    delete[] next_in_slot;
+    delete[] ready;
+    devices = 0;
+    phase_us = 0;
+    due_us = 0;
+    due_tick = 0;
+    next_in_slot = 0;
+    ready = 0;
+    max_devices = 0;
+    num_devices = 0;
+}
+
+// Add a device with its own frame source and phase offset
+int ImuFleet::addDevice(frame_ctx_func_ptr cb, void *ctx, unsigned long phase_us) {
+
+    int id;
+
+    if (running || (num_devices >= max_devices)) {
+        return -1;
+    }
+    id = (int)num_devices;
+    if (devices[id].registerFrameCallback(cb, ctx) != 0) {
+        return -1;
+    }
+    devices[id].setFifoWatermark(frames_per_slice);
+    this->phase_us[id] = phase_us;
+    num_devices++;
+
+    return id;
+}
+
+// Start every device's FIFO and schedule its first slice
+int ImuFleet::start() {
+
+    if (running || (num_devices == 0)) {
+        return -1;
+    }
+
+    // Empty the wheel
+    for (int i = 0; i < IMU_FLEET_WHEEL_SLOTS; i++) {
+        slot_head[i] = -1;
+    }
+    current_tick = 0;
+    ready_head = 0;
+    ready_count = 0;
+    start_us = micros();
+
+    // A slice is complete once its last frame has been captured
+    for (size_t i = 0; i < num_devices; i++) {
+        if (!devices[i].beginFifo(sample_rate_hz, phase_us[i])) {
+            stop();
+            return -1;
+        }
+        schedule((int)i, devices[i].fifoNextFrameUs() + 
+                ((frames_per_slice - 1) * (slice_period_us / frames_per_slice)));
+    }
+    running = true;
+
+    return 0;
+}
+
+// Stop every device's FIFO
+void ImuFleet::stop() {
+    for (size_t i = 0; i < num_devices; i++) {
+        devices[i].endFifo();
+    }
+    running = false;
+}
+
+// Sleep until the next slice is due and return the device it belongs to
+int ImuFleet::nextSlice(unsigned long *due_us) {
+
+    unsigned long now_us;
+    int id;
+
+    if (!running) {
+        return -1;
+    }
+
+    // Turn the wheel until at least one device is due
+    while (ready_count == 0) {
+        collectDue();
+        if (ready_count == 0) {
+            current_tick++;
+        }
+    }
+    id = ready[ready_head];
+    ready_head = (ready_head + 1) % max_devices;
+    ready_count--;
+
+    // Wait for the last frame of the slice (no wait at all if we're behind).
+    // Sleep most of the way with delay() and finish off with the finer (but
+    // busier) delayMicroseconds().
+    now_us = micros();
+    if ((long)(this->due_us[id] - now_us) > 2000) {
+        delay(((this->due_us[id] - now_us) / 1000) - 1);
+        now_us = micros();
+    }
+    if ((long)(this->due_us[id] - now_us) > 0) {
+        delayMicroseconds(this->due_us[id] - now_us);
+    }
+    if (due_us != nullptr) {
+        *due_us = this->due_us[id];
+    }
+
+    // The next slice is one slice period later, however late this one is
+    schedule(id, this->due_us[id] + slice_period_us);
+
+    return id;
+}
+
+// Frames dropped by every device so far
+unsigned long ImuFleet::totalOverruns() const {
+
+    unsigned long overruns = 0;
+
+    for (size_t i = 0; i < num_devices; i++) {
+        overruns += devices[i].fifoOverruns();
+    }
+
+    return overruns;
+}
+
+// Put a device in the wheel slot for the tick its slice is due in
+void ImuFleet::schedule(int id, unsigned long due_us) {
+
+    unsigned long tick = (due_us - start_us) / tick_us;
+    size_t slot;
+
+    // Anything overdue goes in the current slot
+    if (((long)(due_us - start_us) < 0) || (tick < current_tick)) {
+        tick = current_tick;
+    }
+    this->due_us[id] = due_us;
+    due_tick[id] = tick;
+    slot = tick % IMU_FLEET_WHEEL_SLOTS;
+    next_in_slot[id] = slot_head[slot];
+    slot_head[slot] = id;
+}
+
+// Move the devices that are due in the current tick to the ready list (devices
+// in the same slot but a later turn of the wheel stay put)
+void ImuFleet::collectDue() {
+
+    size_t slot = current_tick % IMU_FLEET_WHEEL_SLOTS;
+    int *link = &slot_head[slot];
+    int id;
+
+    while (*link >= 0) {
+        id = *link;
+        if (due_tick[id] <= current_tick) {
+            *link = next_in_slot[id];
+            ready[(ready_head + ready_count) % max_devices] = id;
+            ready_count++;
+        } else {
+            link = &next_in_slot[id];
+        }
+    }
+}
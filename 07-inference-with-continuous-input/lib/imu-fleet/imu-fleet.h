@@ -0,0 +1,102 @@
+/**
+ * Drive a fleet of emulated IMUs from one thread.
+ *
+ * Each device is its own ImuEmu with an emulated FIFO, its own frame callback
+ * (and context, usually the device's recording) and its own phase offset. A
+ * hashed timing wheel keeps track of when each device next has a full slice
+ * waiting in its FIFO, so nextSlice() can sleep until the earliest one is due
+ * without looking at every device. Devices are handed out in deadline order;
+ * if the caller can't keep up, slices are handed out late and the devices'
+ * FIFOs eventually overrun, which is what a fleet load test looks for.
+ *
+ * License: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IMU_FLEET_H
+#define IMU_FLEET_H
+
+#include <stddef.h>
+
+#include "imu-emulator.h"
+
+// Timing wheel settings
+#define IMU_FLEET_WHEEL_SLOTS   256     // Slots in the wheel (one tick each)
+#define IMU_FLEET_TICK_US       1000    // Default tick length (us)
+
+class ImuFleet {
+    public:
+        ImuFleet();
+        ~ImuFleet();
+
+        // Make room for max_devices devices that sample at sample_rate_hz and
+        // are serviced every frames_per_slice frames. Returns 0 on success, -1
+        // on failure.
+        int begin(size_t max_devices, float sample_rate_hz,
+                    size_t frames_per_slice,
+                    unsigned long tick_us = IMU_FLEET_TICK_US);
+        void end();
+
+        // Add a device that gets its frames from cb (called with ctx) and
+        // samples phase_us later than a device with no offset. Returns the
+        // device ID, or -1 if the fleet is full.
+        int addDevice(frame_ctx_func_ptr cb, void *ctx, unsigned long phase_us);
+
+        // Start every device's FIFO at the same time (plus its phase offset)
+        int start();
+        void stop();
+
+        // Sleep until a device has a full slice waiting and return its ID
+        // (-1 if there are no devices). due_us is set to when the slice was
+        // complete. The device is rescheduled for its next slice.
+        int nextSlice(unsigned long *due_us = nullptr);
+
+        size_t size() const { return num_devices; }
+        ImuEmu &device(int id) { return devices[id]; }
+        size_t framesPerSlice() const { return frames_per_slice; }
+        unsigned long slicePeriodUs() const { return slice_period_us; }
+        unsigned long totalOverruns() const;
+    private:
+        ImuFleet(const ImuFleet&);
+        ImuFleet& operator=(const ImuFleet&);
+
+        void schedule(int id, unsigned long due_us);
+        void collectDue();
+
+        ImuEmu *devices = 0;
+        size_t max_devices = 0;
+        size_t num_devices = 0;
+        float sample_rate_hz = 0.0f;
+        size_t frames_per_slice = 0;
+        unsigned long slice_period_us = 0;
+        unsigned long tick_us = IMU_FLEET_TICK_US;
+        unsigned long start_us = 0;
+        bool running = false;
+
+        // Per device: phase offset, when the next slice is complete, the tick
+        // that falls in, and the next device in the same wheel slot
+        unsigned long *phase_us = 0;
+        unsigned long *due_us = 0;
+        unsigned long *due_tick = 0;
+        int *next_in_slot = 0;
+
+        // Timing wheel (device lists) and the devices that are due now
+        int slot_head[IMU_FLEET_WHEEL_SLOTS];
+        unsigned long current_tick = 0;
+        int *ready = 0;
+        size_t ready_head = 0;
+        size_t ready_count = 0;
+};
+
+#endif // IMU_FLEET_H
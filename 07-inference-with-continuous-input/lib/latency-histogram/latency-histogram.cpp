@@ -0,0 +1,127 @@
+/**
+ * Latency histogram definition
+ */
+
+#include <math.h>
+
+#include "latency-histogram.h"
+
+// Constructor
+LatencyHistogram::LatencyHistogram() {
+    for (size_t i = 0; i < LATENCY_HIST_NUM_BUCKETS; i++) {
+        buckets[i].store(0, std::memory_order_relaxed);
+    }
+    total.store(0, std::memory_order_relaxed);
+    sum.store(0, std::memory_order_relaxed);
+    largest.store(0, std::memory_order_relaxed);
+}
+
+// Average of every value
+double LatencyHistogram::mean() const {
+
+    uint64_t n = count();
+
+    if (n == 0) {
+        return 0.0;
+    }
+
+    return (double)sum.load(std::memory_order_relaxed) / n;
+}
+
+// Walk the buckets until enough values have been seen
+uint32_t LatencyHistogram::valueAtPercentile(double percent) const {
+
+    uint64_t n = count();
+    uint64_t target;
+    uint64_t seen = 0;
+    uint32_t top;
+
+    if (n == 0) {
+        return 0;
+    }
+
+    // Counters are read one at a time while values are being recorded, so
+    // stop at the end even if we never quite reach the target
+    target = (uint64_t)ceil((percent / 100.0) * n);
+    if (target < 1) {
+        target = 1;
+    }
+    for (size_t i = 0; i < LATENCY_HIST_NUM_BUCKETS; i++) {
+        seen += buckets[i].load(std::memory_order_relaxed);
+        if (seen >= target) {
+            top = bucketTop(i);
+            return (top < max()) ? top : max();
+        }
+    }
+
+    return max();
+}
+
+// Print count, mean, percentiles and max on one line
+void LatencyHistogram::print(FILE *fp, const char *name, const char *unit) const {
+    fprintf(fp, "%-14s n=%llu mean=%.1f p50=%u p90=%u p99=%u p99.9=%u max=%u %s\r\n",
+        name,
+        (unsigned long long)count(),
+        mean(),
+        valueAtPercentile(50.0),
+        valueAtPercentile(90.0),
+        valueAtPercentile(99.0),
+        valueAtPercentile(99.9),
+        max(),
+        unit);
+}
+
+// Print the same numbers as a JSON object
+void LatencyHistogram::printJson(FILE *fp) const {
+    fprintf(fp, "{\"count\":%llu,\"mean\":%.1f,\"p50\":%u,\"p90\":%u,"
+                "\"p99\":%u,\"p999\":%u,\"max\":%u}",
+        (unsigned long long)count(),
+        mean(),
+        valueAtPercentile(50.0),
+        valueAtPercentile(90.0),
+        valueAtPercentile(99.0),
+        valueAtPercentile(99.9),
+        max());
+}
+
+// Small values get a bucket each. Larger ones are split by their top bit
+// (which power of two) and the LATENCY_HIST_SUB_BITS bits below it.
+size_t LatencyHistogram::bucketOf(uint32_t value) {
+
+    int top_bit;
+
+    if (value < LATENCY_HIST_SUB_BUCKETS) {
+        return value;
+    }
+    top_bit = 31 - __builtin_clz(value);
+
+    return ((top_bit - LATENCY_HIST_SUB_BITS + 1) * LATENCY_HIST_SUB_BUCKETS) +
+        ((value >> (top_bit - LATENCY_HIST_SUB_BITS)) - LATENCY_HIST_SUB_BUCKETS);
+}
+
+// Largest value that goes in a bucket
+uint32_t LatencyHistogram::bucketTop(size_t bucket) {
+
+    int shift;
+    uint64_t low;
+
+    if (bucket < LATENCY_HIST_SUB_BUCKETS) {
+        return (uint32_t)bucket;
+    }
+    shift = (int)(bucket / LATENCY_HIST_SUB_BUCKETS) - 1;
+    low = (uint64_t)(LATENCY_HIST_SUB_BUCKETS + (bucket % LATENCY_HIST_SUB_BUCKETS)) 
+            << shift;
+
+    return (uint32_t)(low + ((uint64_t)1 << shift) - 1);
+}
+
+// Raise the max without a lock (only loops if another thread raced us)
+void LatencyHistogram::updateMax(uint32_t value) {
+
+    uint32_t current = largest.load(std::memory_order_relaxed);
+
+    while ((value > current) && 
+            !largest.compare_exchange_weak(current, value, 
+                                            std::memory_order_relaxed)) {
+    }
+}
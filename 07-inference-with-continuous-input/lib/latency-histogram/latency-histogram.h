@@ -0,0 +1,78 @@
+/**
+ * Lock-free latency histogram.
+ *
+ * Values are counted in log-linear buckets (like HdrHistogram): values below
+ * 2^LATENCY_HIST_SUB_BITS get a bucket each, and every power of two above
+ * that is split into 2^LATENCY_HIST_SUB_BITS buckets, so any value is known to
+ * within about 6%. Every counter is a relaxed atomic, so one thread can
+ * record() (a handful of instructions, no locks) while another reads the
+ * percentiles or prints the histogram. Units are up to the caller.
+ *
+ * License: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include <atomic>
+
+// Buckets per power of two (as a power of two) and number of buckets needed
+// to cover every 32-bit value (larger values go in the last bucket)
+#define LATENCY_HIST_SUB_BITS       4
+#define LATENCY_HIST_SUB_BUCKETS    (1 << LATENCY_HIST_SUB_BITS)
+#define LATENCY_HIST_NUM_BUCKETS    ((32 - LATENCY_HIST_SUB_BITS + 1) * \
+                                        LATENCY_HIST_SUB_BUCKETS)
+
+class LatencyHistogram {
+    public:
+        LatencyHistogram();
+
+        // Count one value
+        void record(uint32_t value) {
+            buckets[bucketOf(value)].fetch_add(1, std::memory_order_relaxed);
+            total.fetch_add(1, std::memory_order_relaxed);
+            sum.fetch_add(value, std::memory_order_relaxed);
+            updateMax(value);
+        }
+
+        uint64_t count() const { return total.load(std::memory_order_relaxed); }
+        uint32_t max() const { return largest.load(std::memory_order_relaxed); }
+        double mean() const;
+
+        // Smallest value that at least the given percent (0-100) of the
+        // values are less than or equal to (within the bucket resolution)
+        uint32_t valueAtPercentile(double percent) const;
+
+        // One line of text, or a JSON object (no newline)
+        void print(FILE *fp, const char *name, const char *unit) const;
+        void printJson(FILE *fp) const;
+    private:
+        LatencyHistogram(const LatencyHistogram&);
+        LatencyHistogram& operator=(const LatencyHistogram&);
+
+        static size_t bucketOf(uint32_t value);
+        static uint32_t bucketTop(size_t bucket);
+        void updateMax(uint32_t value);
+
+        std::atomic<uint32_t> buckets[LATENCY_HIST_NUM_BUCKETS];
+        std::atomic<uint64_t> total;
+        std::atomic<uint64_t> sum;
+        std::atomic<uint32_t> largest;
+};
+
+#endif // LATENCY_HISTOGRAM_H
@@ -0,0 +1,174 @@
+/**
+ * Ring buffer of floats that can be read and written as contiguous spans.
+ *
+ * On Linux, the ring's pages are mapped twice, back to back (a memfd mapped
+ * at two neighbouring addresses), so that the floats just past the end of the
+ * ring are the ones at its start. Any run of up to capacity() floats, starting
+ * anywhere in the ring, is then one contiguous span that can be handed
+ * straight to preprocessing and inference, with no wrap checks and no
+ * staging copy. The capacity is rounded up to whole pages.
+ *
+ * Elsewhere (or if the mapping fails), the ring is a buffer twice the
+ * capacity and commit() copies what was written to the other half, which
+ * costs one copy of each slice instead of one of each window.
+ *
+ * The producer writes up to capacity() floats at writePtr() and calls
+ * commit(); last() returns the newest floats, oldest first. The ring starts
+ * out as zeros. It is not thread-safe: use it from one thread.
+ *
+ * Header only, so it can be copied next to an Arduino sketch as-is.
+ *
+ * License: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MIRROR_RING_H
+#define MIRROR_RING_H
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+class MirrorRing {
+    public:
+        MirrorRing() : buf(nullptr), cap(0), head(0), map_bytes(0) {}
+        ~MirrorRing() { release(); }
+
+        // Set up a ring of at least min_size floats, all zeros. Returns false
+        // if there isn't enough memory.
+        bool init(size_t min_size) {
+            release();
+            if (min_size == 0) {
+                return false;
+            }
+            if (initMirrored(min_size)) {
+                return true;
+            }
+            buf = (float *)calloc(2 * min_size, sizeof(float));
+            if (buf == nullptr) {
+                return false;
+            }
+            cap = min_size;
+            return true;
+        }
+
+        // Give the memory back
+        void release() {
+#ifdef __linux__
+            if (map_bytes != 0) {
+                munmap(buf, 2 * map_bytes);
+                map_bytes = 0;
+                buf = nullptr;
+            }
+#endif
+            free(buf);
+            buf = nullptr;
+            cap = 0;
+            head = 0;
+        }
+
+        // Floats in the ring, and whether its pages are mapped twice
+        size_t capacity() const { return cap; }
+        bool mirrored() const { return map_bytes != 0; }
+
+        // Producer: where the next floats go (room for capacity() of them),
+        // and move past the n floats written there
+        float *writePtr() { return buf + head; }
+        void commit(size_t n) {
+            if (map_bytes == 0) {
+                mirror(head, n);
+            }
+            head = (head + n) % cap;
+        }
+
+        // The last n (up to capacity()) floats committed, oldest first
+        const float *last(size_t n) const {
+            return buf + ((head + cap - n) % cap);
+        }
+
+    private:
+        MirrorRing(const MirrorRing&);
+        MirrorRing& operator=(const MirrorRing&);
+
+        // Map the same pages twice in a row (Linux only)
+        bool initMirrored(size_t min_size) {
+#ifdef __linux__
+            size_t page = (size_t)sysconf(_SC_PAGESIZE);
+            size_t bytes = ((min_size * sizeof(float) + page - 1) / page) * page;
+            void *base;
+            void *first;
+            void *second;
+            int fd;
+
+            fd = memfd_create("mirror-ring", 0);
+            if (fd < 0) {
+                return false;
+            }
+            if (ftruncate(fd, bytes) != 0) {
+                close(fd);
+                return false;
+            }
+
+            // Reserve both halves in one go so that nothing else ends up
+            // between them, then put the pages in each half
+            base = mmap(nullptr, 2 * bytes, PROT_NONE,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (base == MAP_FAILED) {
+                close(fd);
+                return false;
+            }
+            first = mmap(base, bytes, PROT_READ | PROT_WRITE,
+                            MAP_SHARED | MAP_FIXED, fd, 0);
+            second = mmap((char *)base + bytes, bytes, PROT_READ | PROT_WRITE,
+                            MAP_SHARED | MAP_FIXED, fd, 0);
+            close(fd);
+            if ((first == MAP_FAILED) || (second == MAP_FAILED)) {
+                munmap(base, 2 * bytes);
+                return false;
+            }
+
+            buf = (float *)base;
+            cap = bytes / sizeof(float);
+            map_bytes = bytes;
+            return true;
+#else
+            (void)min_size;
+            return false;
+#endif
+        }
+
+        // Copy floats [start, start + n) written past either end of the
+        // first half to the other half
+        void mirror(size_t start, size_t n) {
+            size_t end = start + n;
+            if (end <= cap) {
+                memcpy(buf + cap + start, buf + start, n * sizeof(float));
+            } else {
+                memcpy(buf + cap + start, buf + start, (cap - start) * sizeof(float));
+                memcpy(buf, buf + cap, (end - cap) * sizeof(float));
+            }
+        }
+
+        float *buf;
+        size_t cap;
+        size_t head;
+        size_t map_bytes;
+};
+
+#endif // MIRROR_RING_H
@@ -0,0 +1,197 @@
+/**
+ * nRF52 timer emulator definition
+ */
+
+#include <errno.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+
+#include "time-emulator.h"
+#include "nrf52-timer-emulator.h"
+
+// Constructor
+NRF52_Timer::NRF52_Timer() :
+    running(false),
+    real_time(false),
+    num_ticks(0),
+    num_overruns(0) {
+}
+
+// Destructor: stop and join the timer thread
+NRF52_Timer::~NRF52_Timer() {
+    detachInterrupt();
+}
+
+// Start calling cb every interval_us
+bool NRF52_Timer::attachInterruptInterval(unsigned long interval_us,
+                                            nrf52_timer_callback cb) {
+
+    struct itimerspec spec;
+    unsigned long first_us;
+
+    if (running || (interval_us == 0) || (cb == 0)) {
+        return false;
+    }
+    this->interval_us = interval_us;
+    callback = cb;
+    num_ticks = 0;
+    num_overruns = 0;
+    start_us = micros();
+    tick_due_us = start_us;
+
+    // On the real clock, arm a timerfd with absolute deadlines (the kernel
+    // keeps the period, so the ticks can't drift) and make an eventfd to
+    // wake the thread up when it's time to stop
+    if (!time_emu_is_virtual_clock()) {
+        timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+        stop_fd = eventfd(0, EFD_CLOEXEC);
+        if ((timer_fd < 0) || (stop_fd < 0)) {
+            detachInterrupt();
+            return false;
+        }
+        first_us = start_us + interval_us;
+        memset(&spec, 0, sizeof(spec));
+        spec.it_value.tv_sec = first_us / 1000000;
+        spec.it_value.tv_nsec = (first_us % 1000000) * 1000;
+        spec.it_interval.tv_sec = interval_us / 1000000;
+        spec.it_interval.tv_nsec = (interval_us % 1000000) * 1000;
+        if (timerfd_settime(timer_fd, TFD_TIMER_ABSTIME, &spec, NULL) != 0) {
+            detachInterrupt();
+            return false;
+        }
+    }
+
+    // Count the thread before it starts so the virtual clock waits for it
+    running = true;
+    time_emu_thread_enter();
+    thread = std::thread(&NRF52_Timer::timerMain, this);
+
+    return true;
+}
+
+// Stop ticking (the thread ends at its next wake-up)
+void NRF52_Timer::stopTimer() {
+
+    uint64_t one = 1;
+
+    running = false;
+    if (stop_fd >= 0) {
+        if (write(stop_fd, &one, sizeof(one)) != sizeof(one)) {
+            // The thread still sees running == false at its next tick
+        }
+    }
+}
+
+// Stop the timer
+void NRF52_Timer::detachInterrupt() {
+
+    stopTimer();
+    if (thread.joinable()) {
+        thread.join();
+    }
+    if (timer_fd >= 0) {
+        close(timer_fd);
+        timer_fd = -1;
+    }
+    if (stop_fd >= 0) {
+        close(stop_fd);
+        stop_fd = -1;
+    }
+}
+
+// Wait for the timerfd to expire. Returns the number of ticks that came due
+// (0 if the timer is being stopped).
+unsigned long NRF52_Timer::waitTimerFd() {
+
+    struct pollfd fds[2];
+    uint64_t expirations = 0;
+    unsigned long late_us;
+
+    fds[0].fd = timer_fd;
+    fds[0].events = POLLIN;
+    fds[1].fd = stop_fd;
+    fds[1].events = POLLIN;
+    while (true) {
+        if (poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return 0;
+        }
+        if (!running || (fds[1].revents & POLLIN)) {
+            return 0;
+        }
+        if (fds[0].revents & POLLIN) {
+            break;
+        }
+    }
+
+    // Make the "interrupt" late if asked to. Read the timerfd afterwards so
+    // that any ticks that came due in the meantime are counted as missed.
+    late_us = time_emu_next_wakeup_delay_us();
+    if (late_us > 0) {
+        time_emu_sleep_until_us(micros() + late_us);
+    }
+    if (read(timer_fd, &expirations, sizeof(expirations)) != sizeof(expirations)) {
+        return 0;
+    }
+
+    return (unsigned long)expirations;
+}
+
+// Sleep on the virtual clock until the next tick. Returns the number of ticks
+// that came due (0 if the timer is being stopped).
+unsigned long NRF52_Timer::waitVirtual() {
+
+    unsigned long ticks = num_ticks;
+    unsigned long due_us = start_us + ((ticks + 1) * interval_us);
+    unsigned long elapsed;
+
+    time_emu_sleep_until_us(due_us + time_emu_next_wakeup_delay_us());
+    if (!running) {
+        return 0;
+    }
+
+    // Every deadline that passed while we slept (or while the callback ran)
+    elapsed = (micros() - start_us) / interval_us;
+    return (elapsed > ticks) ? (elapsed - ticks) : 1;
+}
+
+// Timer thread: wait for each tick and call the callback
+void NRF52_Timer::timerMain() {
+
+    struct sched_param param;
+    unsigned long expirations;
+
+    // Preempt everything else, like an ISR (needs CAP_SYS_NICE or root)
+    memset(&param, 0, sizeof(param));
+    param.sched_priority = sched_get_priority_max(SCHED_FIFO);
+    real_time = (pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0);
+
+    while (running) {
+        if (time_emu_is_virtual_clock()) {
+            expirations = waitVirtual();
+        } else {
+            expirations = waitTimerFd();
+        }
+        if (expirations == 0) {
+            break;
+        }
+
+        // Handle the latest tick once, and count the rest as missed
+        num_overruns += expirations - 1;
+        num_ticks += expirations;
+        tick_due_us = start_us + (num_ticks * interval_us);
+        callback();
+    }
+
+    // Let the emulated clock run without this thread
+    time_emu_thread_exit();
+}
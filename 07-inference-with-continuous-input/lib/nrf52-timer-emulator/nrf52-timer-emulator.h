@@ -0,0 +1,99 @@
+/**
+ * Emulate a periodic nRF52 hardware timer interrupt.
+ *
+ * Works like NRF52_TimerInterrupt's attachInterruptInterval(): the callback is
+ * called every interval_us, as if from the timer's ISR. Ticks fall on absolute
+ * deadlines (start + n * interval), so they never drift no matter how late
+ * any one callback runs. If the callback is still running when the next tick
+ * (or several) comes due, the missed ticks are counted as overruns and the
+ * callback is called once, like a pending interrupt that can only be latched
+ * once.
+ *
+ * The callback runs on a dedicated thread that waits on a timerfd armed with
+ * absolute CLOCK_MONOTONIC deadlines. The thread asks for real-time (FIFO)
+ * scheduling at the highest priority so that it preempts everything else, the
+ * way an ISR would; without the privileges for that, it runs at normal
+ * priority. With the time emulator's virtual clock, the thread sleeps on the
+ * virtual clock instead. Injected wake-up delays (see time-emulator.h) make
+ * the callback late in either mode.
+ *
+ * In virtual clock mode, the timer thread is counted by the clock, so only
+ * call detachInterrupt() (or destroy the timer) from a thread that is not:
+ * the timer thread only notices at its next tick, which can't come while the
+ * caller is waiting for it. A counted thread can call stopTimer() first, so
+ * that the timer stops at the same virtual time on every run, then stop
+ * being counted and call detachInterrupt().
+ *
+ * License: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NRF52_TIMER_EMULATOR_H
+#define NRF52_TIMER_EMULATOR_H
+
+#include <atomic>
+#include <thread>
+
+// Timer callback (called from the timer thread, like an ISR)
+typedef void (*nrf52_timer_callback)(void);
+
+class NRF52_Timer {
+    public:
+        NRF52_Timer();
+        ~NRF52_Timer();
+
+        // Call cb every interval_us, starting one interval from now. Returns
+        // false if the timer could not be started (or is already running).
+        bool attachInterruptInterval(unsigned long interval_us,
+                                        nrf52_timer_callback cb);
+
+        // Stop the timer without waiting for the thread (no more callbacks
+        // start after this, but one might still be running)
+        void stopTimer();
+
+        // Stop the timer and wait for the callback to finish
+        void detachInterrupt();
+
+        // When the tick being handled was due (call from the callback)
+        unsigned long tickDueUs() const { return tick_due_us; }
+
+        // Ticks so far (including overruns) and ticks that were missed
+        // because the callback was still running or woke up too late
+        unsigned long ticks() const { return num_ticks.load(); }
+        unsigned long overruns() const { return num_overruns.load(); }
+
+        // True if the timer thread got real-time scheduling
+        bool isRealTime() const { return real_time.load(); }
+    private:
+        NRF52_Timer(const NRF52_Timer&);
+        NRF52_Timer& operator=(const NRF52_Timer&);
+
+        void timerMain();
+        unsigned long waitTimerFd();
+        unsigned long waitVirtual();
+
+        std::thread thread;
+        std::atomic<bool> running;
+        std::atomic<bool> real_time;
+        std::atomic<unsigned long> num_ticks;
+        std::atomic<unsigned long> num_overruns;
+        nrf52_timer_callback callback = 0;
+        unsigned long interval_us = 0;
+        unsigned long start_us = 0;
+        unsigned long tick_due_us = 0;
+        int timer_fd = -1;
+        int stop_fd = -1;
+};
+
+#endif // NRF52_TIMER_EMULATOR_H
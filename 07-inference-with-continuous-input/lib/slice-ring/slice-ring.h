@@ -0,0 +1,121 @@
+/**
+ * Wait-free single-producer, single-consumer queue of fixed-size slices.
+ *
+ * The producer (the sampling thread) fills the slot returned by writeSlot()
+ * in place and calls commit() once it is full. The consumer (the inference
+ * thread) reads the oldest committed slot from readSlot() in place and calls
+ * release() when it is done with it. Up to NUM_SLOTS - 1 slices can wait in
+ * the queue while the producer fills the next one, so a consumer that falls
+ * behind for a few slices catches up without losing anything.
+ *
+ * If the queue is full when the producer commits, the slice is dropped (the
+ * producer keeps the same slot and fills it again) and counted as an overrun.
+ * The producer never waits for the consumer, and neither side takes a lock:
+ * the head and tail counters are atomics, written with release and read with
+ * acquire ordering, so the contents of a slot are visible to the other side
+ * before the slot changes hands. The counters and slots each start on their
+ * own cache line so that the two threads don't fight over one.
+ *
+ * Header only, so it can be copied next to an Arduino sketch as-is.
+ *
+ * License: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SLICE_RING_H
+#define SLICE_RING_H
+
+#include <stddef.h>
+
+#include <atomic>
+
+// Keep data written by different threads on different cache lines
+#define SLICE_RING_CACHE_LINE   64
+
+template <typename T, size_t SLOT_SIZE, size_t NUM_SLOTS>
+class SliceRing {
+    static_assert(NUM_SLOTS >= 2, "SliceRing needs at least two slots");
+    static_assert((NUM_SLOTS & (NUM_SLOTS - 1)) == 0,
+                    "SliceRing slots must be a power of two");
+
+    public:
+        SliceRing() : head(0), dropped(0), deepest(0), tail(0) {}
+
+        // Producer: the slot to fill, its index, and publish it once it's
+        // full. Returns false if the queue was full and the slice was dropped.
+        T *writeSlot() { return slots[writeIndex()]; }
+        size_t writeIndex() const {
+            return head.load(std::memory_order_relaxed) % NUM_SLOTS;
+        }
+        bool commit() {
+            unsigned int h = head.load(std::memory_order_relaxed);
+            unsigned int depth = h - tail.load(std::memory_order_acquire);
+            if (depth >= NUM_SLOTS - 1) {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            if (depth + 1 > deepest.load(std::memory_order_relaxed)) {
+                deepest.store(depth + 1, std::memory_order_relaxed);
+            }
+            head.store(h + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer: the oldest committed slot (nullptr if there is none), its
+        // index, and hand it back to the producer once it has been read
+        const T *readSlot() const {
+            unsigned int t = tail.load(std::memory_order_relaxed);
+            if (t == head.load(std::memory_order_acquire)) {
+                return nullptr;
+            }
+            return slots[t % NUM_SLOTS];
+        }
+        size_t readIndex() const {
+            return tail.load(std::memory_order_relaxed) % NUM_SLOTS;
+        }
+        void release() {
+            tail.store(tail.load(std::memory_order_relaxed) + 1,
+                        std::memory_order_release);
+        }
+
+        // Slices waiting for the consumer, slices dropped because the queue
+        // was full, and the most slices that have ever been waiting
+        size_t size() const {
+            return head.load(std::memory_order_acquire) -
+                    tail.load(std::memory_order_acquire);
+        }
+        static constexpr size_t capacity() { return NUM_SLOTS - 1; }
+        unsigned long overruns() const {
+            return dropped.load(std::memory_order_relaxed);
+        }
+        unsigned int highWater() const {
+            return deepest.load(std::memory_order_relaxed);
+        }
+    private:
+        SliceRing(const SliceRing&);
+        SliceRing& operator=(const SliceRing&);
+
+        // Written by the producer
+        alignas(SLICE_RING_CACHE_LINE) std::atomic<unsigned int> head;
+        std::atomic<unsigned long> dropped;
+        std::atomic<unsigned int> deepest;
+
+        // Written by the consumer
+        alignas(SLICE_RING_CACHE_LINE) std::atomic<unsigned int> tail;
+
+        // Slices
+        alignas(SLICE_RING_CACHE_LINE) T slots[NUM_SLOTS][SLOT_SIZE];
+};
+
+#endif // SLICE_RING_H
@@ -1,55 +1,403 @@
-#define _POSIX_C_SOURCE 199309L
+#define _POSIX_C_SOURCE 200112L
 
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdint.h>
 #include <time.h>
 #include <unistd.h>
+#include <sys/eventfd.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <list>
+#include <mutex>
+#include <set>
 
 #include "time-emulator.h"
 
+// Virtual clock state (only used if virtual clock mode is enabled)
+static bool virtual_clock = false;
+static std::mutex clock_mutex;
+static std::condition_variable clock_cond;
+static unsigned long virtual_now_us = 0;
+static int num_threads = 0;
+static int num_blocked = 0;
+static std::multiset<unsigned long> wake_times_us;
+static int num_idle_waiters = 0;
+
+// Injected scheduling delays (see time_emu_set_wakeup_jitter())
+static unsigned long wakeup_jitter_us = 0;
+static float wakeup_stall_probability = 0.0f;
+static unsigned long wakeup_stall_us = 0;
+static thread_local uint32_t wakeup_rand_state = 2463534242u;
+
+// A thread waiting on a semaphore with the virtual clock
+struct sem_waiter {
+    unsigned long deadline_us;
+    bool has_deadline;
+    bool granted;
+};
+
+// Counting semaphore: an eventfd on the system clock, or a count and a queue
+// of waiters (protected by clock_mutex) with the virtual clock
+struct time_emu_sem {
+    bool virtual_clock;
+    unsigned int max_count;
+    unsigned int count;
+    std::list<sem_waiter *> waiters;
+    int fd;
+    std::atomic<unsigned int> pending;
+};
+
+// Return elapsed time in microseconds from the system clock
+static unsigned long monotonic_us(void) {
+    struct timespec time_now;
+    if (clock_gettime(CLOCK_MONOTONIC, &time_now) == -1) {
+        return 0;
+    }
+    return time_now.tv_sec * 1000000 + time_now.tv_nsec / 1e3;
+}
+
+// Xorshift random number generator (one sequence per thread, so runs on the
+// virtual clock repeat exactly)
+static uint32_t wakeup_rand(void) {
+    wakeup_rand_state ^= wakeup_rand_state << 13;
+    wakeup_rand_state ^= wakeup_rand_state >> 17;
+    wakeup_rand_state ^= wakeup_rand_state << 5;
+    return wakeup_rand_state;
+}
+
+// How much later than asked the next wake-up should be
+static unsigned long wakeup_delay_us(void) {
+
+    unsigned long delay_us = 0;
+
+    if (wakeup_jitter_us > 0) {
+        delay_us += wakeup_rand() % (wakeup_jitter_us + 1);
+    }
+    if ((wakeup_stall_probability > 0.0f) && 
+        ((wakeup_rand() / 4294967296.0) < wakeup_stall_probability)) {
+        delay_us += wakeup_stall_us;
+    }
+
+    return delay_us;
+}
+
+// Sleep on the system clock until the given number of microseconds from now
+static void monotonic_sleep_us(unsigned long us) {
+    struct timespec deadline;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &deadline) == -1) {
+        return;
+    }
+    deadline.tv_sec += us / 1000000;
+    deadline.tv_nsec += (us % 1000000) * 1000;
+    if (deadline.tv_nsec >= 1000000000) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000;
+    }
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR);
+}
+
+// Move the virtual clock to the next wake-up time if every thread is blocked.
+// Must be called with clock_mutex held.
+static void advance_virtual_clock(void) {
+
+    // Someone is still running, so time stands still (but a thread in
+    // time_emu_wait_for_idle() might be waiting for everyone else to block)
+    if ((num_blocked < num_threads) || wake_times_us.empty()) {
+        if (num_idle_waiters > 0) {
+            clock_cond.notify_all();
+        }
+        return;
+    }
+
+    // Jump to the earliest deadline and release every thread waiting on it
+    virtual_now_us = *wake_times_us.begin();
+    while (!wake_times_us.empty() && (*wake_times_us.begin() <= virtual_now_us)) {
+        wake_times_us.erase(wake_times_us.begin());
+        num_blocked--;
+    }
+    clock_cond.notify_all();
+}
+
+// Block the calling thread until the virtual clock reaches the given time
+static void virtual_sleep_until(unsigned long deadline_us) {
+    std::unique_lock<std::mutex> lock(clock_mutex);
+
+    if (deadline_us <= virtual_now_us) {
+        return;
+    }
+
+    wake_times_us.insert(deadline_us);
+    num_blocked++;
+    advance_virtual_clock();
+    clock_cond.wait(lock, [deadline_us] {
+        return virtual_now_us >= deadline_us;
+    });
+}
+
+// Use the simulated clock instead of the system clock (call before threads)
+void time_emu_set_virtual_clock(int enable) {
+    std::lock_guard<std::mutex> lock(clock_mutex);
+    virtual_clock = (enable != 0);
+    virtual_now_us = 0;
+}
+
+// Returns 1 if the simulated clock is being used
+int time_emu_is_virtual_clock(void) {
+    return virtual_clock ? 1 : 0;
+}
+
+// Make every wake-up late by a random amount from 0 to max_jitter_us
+void time_emu_set_wakeup_jitter(unsigned long max_jitter_us) {
+    wakeup_jitter_us = max_jitter_us;
+}
+
+// Make the given fraction of wake-ups late by an extra stall_us
+void time_emu_set_wakeup_stalls(float probability, unsigned long stall_us) {
+    wakeup_stall_probability = probability;
+    wakeup_stall_us = stall_us;
+}
+
+// Sleep until micros() reaches the given time (no injected delays)
+void time_emu_sleep_until_us(unsigned long deadline_us) {
+    struct timespec deadline;
+
+    if (virtual_clock) {
+        virtual_sleep_until(deadline_us);
+        return;
+    }
+
+    // micros() is the monotonic clock, so the deadline can be used as-is
+    deadline.tv_sec = deadline_us / 1000000;
+    deadline.tv_nsec = (deadline_us % 1000000) * 1000;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR);
+}
+
+// How late the calling thread's next wake-up should be (see
+// time_emu_set_wakeup_jitter() and time_emu_set_wakeup_stalls())
+unsigned long time_emu_next_wakeup_delay_us(void) {
+    return wakeup_delay_us();
+}
+
+// Create a semaphore that starts with count releases (and holds at most
+// max_count). Call after choosing the clock. Returns NULL on failure.
+time_emu_sem_t *time_emu_sem_create(unsigned int count, unsigned int max_count) {
+
+    time_emu_sem_t *sem = new time_emu_sem_t();
+
+    sem->virtual_clock = virtual_clock;
+    sem->max_count = (max_count > 0) ? max_count : 1;
+    sem->count = (count < sem->max_count) ? count : sem->max_count;
+    sem->fd = -1;
+    sem->pending = 0;
+    if (!sem->virtual_clock) {
+        sem->pending = sem->count;
+        sem->fd = eventfd(sem->count, EFD_SEMAPHORE | EFD_NONBLOCK | EFD_CLOEXEC);
+        if (sem->fd < 0) {
+            delete sem;
+            return NULL;
+        }
+    }
+
+    return sem;
+}
+
+// Free a semaphore (no thread may be waiting on it)
+void time_emu_sem_destroy(time_emu_sem_t *sem) {
+    if (sem == NULL) {
+        return;
+    }
+    if (sem->fd >= 0) {
+        close(sem->fd);
+    }
+    delete sem;
+}
+
+// Release the semaphore, waking up one waiting thread (releases past
+// max_count are dropped)
+void time_emu_sem_release(time_emu_sem_t *sem) {
+
+    uint64_t one = 1;
+    unsigned int pending;
+    sem_waiter *waiter;
+
+    // Hand the release straight to the first waiter. It stops counting as
+    // blocked now, so the clock can't move on before it gets to run.
+    if (sem->virtual_clock) {
+        std::lock_guard<std::mutex> lock(clock_mutex);
+        if (sem->waiters.empty()) {
+            if (sem->count < sem->max_count) {
+                sem->count++;
+            }
+            return;
+        }
+        waiter = sem->waiters.front();
+        sem->waiters.pop_front();
+        waiter->granted = true;
+        if (!waiter->has_deadline) {
+            num_blocked--;
+        } else if (waiter->deadline_us > virtual_now_us) {
+            wake_times_us.erase(wake_times_us.find(waiter->deadline_us));
+            num_blocked--;
+        }
+        clock_cond.notify_all();
+        return;
+    }
+
+    // Count releases ourselves, as an eventfd can't be capped
+    pending = sem->pending.load();
+    do {
+        if (pending >= sem->max_count) {
+            return;
+        }
+    } while (!sem->pending.compare_exchange_weak(pending, pending + 1));
+    if (write(sem->fd, &one, sizeof(one)) != sizeof(one)) {
+        sem->pending--;
+    }
+}
+
+// Wait for the semaphore to be released, for up to timeout_us (0 waits
+// forever). Returns 1 if it was acquired, 0 on timeout.
+int time_emu_sem_acquire(time_emu_sem_t *sem, unsigned long timeout_us) {
+
+    struct pollfd pfd;
+    struct timespec wait_ts;
+    struct timespec *wait_ptr = NULL;
+    sem_waiter waiter;
+    uint64_t value;
+    unsigned long deadline_us = 0;
+    unsigned long now_us;
+
+    // Block on the virtual clock until we're handed a release or time is up
+    if (sem->virtual_clock) {
+        std::unique_lock<std::mutex> lock(clock_mutex);
+        if (sem->count > 0) {
+            sem->count--;
+            return 1;
+        }
+        waiter.deadline_us = virtual_now_us + timeout_us;
+        waiter.has_deadline = (timeout_us > 0);
+        waiter.granted = false;
+        sem->waiters.push_back(&waiter);
+        if (waiter.has_deadline) {
+            wake_times_us.insert(waiter.deadline_us);
+        }
+        num_blocked++;
+        advance_virtual_clock();
+        clock_cond.wait(lock, [&waiter] {
+            return waiter.granted || 
+                (waiter.has_deadline && (virtual_now_us >= waiter.deadline_us));
+        });
+        if (!waiter.granted) {
+            sem->waiters.remove(&waiter);
+            return 0;
+        }
+        return 1;
+    }
+
+    // Sleep in the kernel until the eventfd has a count we can take
+    pfd.fd = sem->fd;
+    pfd.events = POLLIN;
+    if (timeout_us > 0) {
+        deadline_us = monotonic_us() + timeout_us;
+    }
+    while (true) {
+        if (read(sem->fd, &value, sizeof(value)) == sizeof(value)) {
+            sem->pending--;
+            return 1;
+        }
+        if (timeout_us > 0) {
+            now_us = monotonic_us();
+            if ((long)(deadline_us - now_us) <= 0) {
+                return 0;
+            }
+            wait_ts.tv_sec = (deadline_us - now_us) / 1000000;
+            wait_ts.tv_nsec = ((deadline_us - now_us) % 1000000) * 1000;
+            wait_ptr = &wait_ts;
+        }
+        if ((ppoll(&pfd, 1, wait_ptr, NULL) < 0) && (errno != EINTR)) {
+            return 0;
+        }
+    }
+}
+
+// Count another thread that must be blocked before the virtual clock advances
+void time_emu_thread_enter(void) {
+    std::lock_guard<std::mutex> lock(clock_mutex);
+    num_threads++;
+}
+
+// Stop counting the calling thread (it will no longer call delay())
+void time_emu_thread_exit(void) {
+    std::lock_guard<std::mutex> lock(clock_mutex);
+    if (num_threads > 0) {
+        num_threads--;
+    }
+    advance_virtual_clock();
+}
+
+// Wait until every other counted thread is blocked, without letting the
+// clock move on (the caller must be counted). Does nothing on the system
+// clock.
+void time_emu_wait_for_idle(void) {
+
+    if (!virtual_clock) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(clock_mutex);
+    num_idle_waiters++;
+    clock_cond.wait(lock, [] {
+        return num_blocked >= num_threads - 1;
+    });
+    num_idle_waiters--;
+}
+
 // Sleeps the program by the number of milliseconds specified
 // Note: Linux is NOT (by default) a real-time OS. Delay is best effort.
 void delay(unsigned long ms) {
-    struct timespec req, rem;
-    req.tv_sec = 0;
-    req.tv_nsec = 500000;
+    unsigned long late_us = wakeup_delay_us();
 
-    // Wake up every half millisecond to check timer
-    unsigned long t_start = millis();
-    while (millis() - t_start < ms) {
-        nanosleep(&req, &rem);
+    // Let the virtual clock decide when we wake up
+    if (virtual_clock) {
+        virtual_sleep_until(micros() + (ms * 1000) + late_us);
+        return;
     }
+
+    // Sleep until an absolute deadline (waking up to check the time would
+    // keep an idle thread busy)
+    monotonic_sleep_us((ms * 1000) + late_us);
 }
 
 // Sleeps the program by the number of microseconds specified
 // Note: Linux is NOT (by default) a real-time OS. Delay is best effort.
 void delayMicroseconds(unsigned long us) {
-    struct timespec req, rem;
-    req.tv_sec = 0;
-    req.tv_nsec = 500;
+    unsigned long late_us = wakeup_delay_us();
 
-    // Wake up every half microsecond to check timer
-    unsigned long t_start = micros();
-    while (micros() - t_start < us) {
-        nanosleep(&req, &rem);
+    // Let the virtual clock decide when we wake up
+    if (virtual_clock) {
+        virtual_sleep_until(micros() + us + late_us);
+        return;
     }
+
+    // Sleep until an absolute deadline (polling would burn a whole core at
+    // high sample rates)
+    monotonic_sleep_us(us + late_us);
 }
 
 // Return elapsed time in microseconds
 unsigned long micros(void) {
-    struct timespec time_now;
-    if (clock_gettime(CLOCK_MONOTONIC, &time_now) == -1) {
-        return 0;
+    if (virtual_clock) {
+        std::lock_guard<std::mutex> lock(clock_mutex);
+        return virtual_now_us;
     }
-    return time_now.tv_sec * 1000000 + time_now.tv_nsec / 1e3;
+    return monotonic_us();
 }
 
 // Return elapsed time in milliseconds
 unsigned long millis(void) {
-    struct timespec time_now;
-    if (clock_gettime(CLOCK_MONOTONIC, &time_now) == -1) {
-        return 0;
-    }
-    return time_now.tv_sec * 1000 + time_now.tv_nsec / 1e6;
+    return micros() / 1000;
 }
-
-
-
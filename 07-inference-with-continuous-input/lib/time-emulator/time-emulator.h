@@ -2,6 +2,40 @@
  * Emulate the delay(), delayMicroseconds(), millis(), and micros() functions 
  * from Arduino
  * 
+ * By default, time comes from the system's monotonic clock. Call
+ * time_emu_set_virtual_clock(1) before starting any threads to switch to a
+ * simulated clock instead: time only moves forward when every participating
+ * thread is blocked in delay() or delayMicroseconds(), at which point the clock
+ * jumps straight to the earliest wake-up time. This lets recordings be replayed
+ * much faster than real time with the same sequence of readings.
+ * 
+ * Each thread (including main) that calls delay() in virtual clock mode must be
+ * counted with time_emu_thread_enter() and time_emu_thread_exit(). Call
+ * time_emu_thread_enter() from the parent *before* spawning the thread so that
+ * the clock cannot advance before the new thread gets a chance to run.
+ * 
+ * Scheduling delays can be injected into every delay() and delayMicroseconds()
+ * (in either clock mode) to see how the sampling threads cope: each wake-up is
+ * late by a random amount up to the configured jitter, and now and then by a
+ * longer stall, like a thread that gets preempted. The random sequence is the
+ * same on every run.
+ * 
+ * time_emu_wait_for_idle() waits until every other thread is blocked, without
+ * letting the clock move on, so that a thread can look at what the others did
+ * at the current time (e.g. to decide when to stop) and see the same thing on
+ * every run.
+ * 
+ * time_emu_sleep_until_us() sleeps until an absolute time on either clock
+ * (without any injected delay), for periodic timers that must not drift.
+ * time_emu_next_wakeup_delay_us() hands out the next injected delay so that
+ * such timers can be made late like everything else.
+ * 
+ * time_emu_sem_t is a counting semaphore for handing work between threads
+ * without polling. On the system clock it is an eventfd, so a waiting thread
+ * uses no CPU and wakes up as soon as the semaphore is released. With the
+ * virtual clock, a thread waiting on a semaphore counts as blocked (until its
+ * timeout, if it has one), so time keeps moving while it waits.
+ * 
  * Author: Shawn Hymel (Edge Impulse)
  * Date: August 26, 2022
  * License: Apache-2.0
@@ -28,11 +62,28 @@
 extern "C" {
 #endif
 
+typedef struct time_emu_sem time_emu_sem_t;
+
 void delay(unsigned long ms);
 void delayMicroseconds(unsigned long us);
 unsigned long micros(void);
 unsigned long millis(void);
 
+void time_emu_set_virtual_clock(int enable);
+int time_emu_is_virtual_clock(void);
+void time_emu_thread_enter(void);
+void time_emu_thread_exit(void);
+void time_emu_wait_for_idle(void);
+void time_emu_set_wakeup_jitter(unsigned long max_jitter_us);
+void time_emu_set_wakeup_stalls(float probability, unsigned long stall_us);
+void time_emu_sleep_until_us(unsigned long deadline_us);
+unsigned long time_emu_next_wakeup_delay_us(void);
+
+time_emu_sem_t *time_emu_sem_create(unsigned int count, unsigned int max_count);
+void time_emu_sem_destroy(time_emu_sem_t *sem);
+void time_emu_sem_release(time_emu_sem_t *sem);
+int time_emu_sem_acquire(time_emu_sem_t *sem, unsigned long timeout_us);
+
 #ifdef __cplusplus
 }
 #endif
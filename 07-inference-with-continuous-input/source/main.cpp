@@ -1,7 +1,8 @@
 /**
  * Main application entrypoint for the continuous inferencing assignment
  *
- * Reads CSV files from tests/ and constructs a vector of raw readings. The 
+ * Reads CSV files from tests/ (or binary .imub recordings made from them with
+ * csv2imub) into columns of raw readings (replay-data.h). The 
  * student implements setup() and loop() functions in submission.cpp. The IMU
  * object can read from a virtual accelerometer and gyroscope, which pull
  * values from the CSV files.
@@ -12,31 +13,57 @@
  * inference in the background every time one of the raw_buf double buffers
  * fills up.
  * 
+ * Pass --virtual-clock (-v) before the CSV files to replay them against a
+ * simulated clock instead of in real time (see time-emulator.h). Pass
+ * --stream (-s) to read the files on a background thread, keeping only a
+ * window of rows in memory, so recordings of any length can be replayed.
+ * 
+ * Pass --resample (-r) to linearly interpolate between rows at the exact time
+ * of each reading instead of returning the closest row, for sampling faster
+ * than the recordings (build with e.g. make SAMPLING_FREQ_HZ=400). Timing
+ * problems can be injected with --sample-jitter <us> and --drop-rate <0..1>
+ * (IMU emulator), and --wakeup-jitter <us> and --stall <probability>,<us>
+ * (delays in delay() and delayMicroseconds(), see time-emulator.h).
+ * 
+ * Pass --trace <file.json> to record what each thread does (sampling, slice
+ * hand-off, DSP, each layer of the model and post-processing) and write it
+ * out as a Chrome trace, which chrome://tracing and ui.perfetto.dev can show
+ * as a timeline (see ei_profiler.h).
+ * 
  * Author: Shawn Hymel (EdgeImpulse, Inc.)
  * Date: November 11, 2022
  * License: Apache-2.0
  */
 
 #include <stdio.h>
+#include <math.h>
+#include <getopt.h>
 #include <cstdlib>
-#include <array>
 #include <string>
 #include <iostream>
 
-#include "csv.h"
+#include "replay-data.h"
 #include "time-emulator.h"
 #include "imu-emulator.h"
+#include "replay-index.h"
 #include "submission.h"
+#include "edge-impulse-sdk/dsp/ei_profiler.h"
 
 // End program if we reach the end of our readings
 #define STOP_IF_END_OF_READINGS     1
 
 // Declare our helper functions
+void buildReadingIndex();
 int findClosestIdx(unsigned long time_ms);
+size_t findClosestStreamIdx(unsigned long time_ms);
+void readClosestRow(unsigned long elapsed, float *row);
+void readInterpolatedRow(double elapsed, float *row);
+void readRow(unsigned long time_us, float *row);
 int readAccelerometerCallback(float& x, float& y, float& z);
 int readGyroscopeCallback(float& x, float& y, float& z);
+int readFrameCallback(unsigned long time_us, float *frame);
 
-// How the arrays in the raw readings vector are indexed
+// How the columns of raw readings are indexed
 enum VectorIDXs {
     TIME_IDX = 0,
     ACC_X_IDX,
@@ -47,13 +74,23 @@ enum VectorIDXs {
     GYR_Z_IDX
 };
 
-// Vector of raw readings to be supplied to the user via callbacks
-static std::vector<std::array<float, 7>> raw_readings;
+// Columns of raw readings to be supplied to the user via callbacks
+static ReplayData raw_readings;
 
-// Current timestamp (milliseconds) of user's IMU readings
+// Rows read on a background thread instead (--stream)
+static ReplayStream replay_stream;
+
+// Lookup table for finding the reading closest to a given timestamp
+static ReplayIndex reading_index;
+
+// Current timestamp (microseconds) of user's IMU readings
 static unsigned long first_reading_timestamp = 0;
 static bool is_first_reading = true;
 
+// Time between (rewritten) timestamps and whether to interpolate between them
+static float reading_period_ms = 0.0;
+static bool resample_readings = false;
+
 // Flag to notify that we've hit the end of the readings
 static volatile bool main_running = true;
 
@@ -64,79 +101,162 @@ static volatile bool main_running = true;
 // Read accelerometer callback function
 int readAccelerometerCallback(float& x, float& y, float& z) {
 
-    // Return 0's if the readings vector is empty
-    if (raw_readings.empty()) {
-        x = 0.0;
-        y = 0.0;
-        z = 0.0;
+    float row[REPLAY_NUM_COLUMNS];
 
-        return 1;
-    }
+    // Assign values from the row for the current time
+    readRow(micros(), row);
+    x = row[ACC_X_IDX];
+    y = row[ACC_Y_IDX];
+    z = row[ACC_Z_IDX];
 
-    // Update timestamp
-    if (is_first_reading) {
-        is_first_reading = false;
-        first_reading_timestamp = millis();
-    }
+    return 1;
+}
+
+// Read gyroscope callback function
+int readGyroscopeCallback(float& x, float& y, float& z) {
 
-    // Calculated elapsed time
-    unsigned long elapsed = millis() - first_reading_timestamp;
-    int closest_time_idx = findClosestIdx(elapsed);
+    float row[REPLAY_NUM_COLUMNS];
 
-    // Assign values from the row closest to the requested elapsed timestamp
-    x = raw_readings[closest_time_idx][ACC_X_IDX];
-    y = raw_readings[closest_time_idx][ACC_Y_IDX];
-    z = raw_readings[closest_time_idx][ACC_Z_IDX];
+    // Assign values from the row for the current time
+    readRow(micros(), row);
+    x = row[GYR_X_IDX];
+    y = row[GYR_Y_IDX];
+    z = row[GYR_Z_IDX];
 
     return 1;
 }
 
-// Read gyroscope callback function
-int readGyroscopeCallback(float& x, float& y, float& z) {
+// Read a full accelerometer + gyroscope frame for the emulated FIFO. Unlike the
+// callbacks above, the FIFO tells us when the frame was sampled.
+int readFrameCallback(unsigned long time_us, float *frame) {
 
-    // Return 0's if the readings vector is empty
-    if (raw_readings.empty()) {
-        x = 0.0;
-        y = 0.0;
-        z = 0.0;
+    float row[REPLAY_NUM_COLUMNS];
 
-        return 1;
+    // Assign values from the row for the time the frame was sampled
+    readRow(time_us, row);
+    for (int i = 0; i < 6; i++) {
+        frame[i] = row[ACC_X_IDX + i];
     }
 
+    return 1;
+}
+
+// Copy the row for the given time (microseconds), measured from the first
+// reading. Whole milliseconds are used unless we're resampling.
+void readRow(unsigned long time_us, float *row) {
+
+    long elapsed;
+
     // Update timestamp
     if (is_first_reading) {
         is_first_reading = false;
-        first_reading_timestamp = millis();
+        first_reading_timestamp = time_us;
     }
 
-    // Calculated elapsed time
-    unsigned long elapsed = millis() - first_reading_timestamp;
-    int closest_time_idx = findClosestIdx(elapsed);
+    // Calculate elapsed time (jittered sample times can come before the first)
+    if (resample_readings) {
+        elapsed = (long)(time_us - first_reading_timestamp);
+        readInterpolatedRow((elapsed > 0) ? elapsed / 1000.0 : 0.0, row);
+    } else {
+        elapsed = (long)((time_us / 1000) - (first_reading_timestamp / 1000));
+        readClosestRow((elapsed > 0) ? elapsed : 0, row);
+    }
+}
 
-    // Assign values from the row closest to the requested elapsed timestamp
-    x = raw_readings[closest_time_idx][GYR_X_IDX];
-    y = raw_readings[closest_time_idx][GYR_Y_IDX];
-    z = raw_readings[closest_time_idx][GYR_Z_IDX];
+// Copy the row closest to the elapsed time (milliseconds) since the first
+// reading. Gives 0's if there are no readings.
+void readClosestRow(unsigned long elapsed, float *row) {
 
-    return 1;
+    int closest_time_idx;
+
+    // Streamed rows are fetched from the reader thread's window
+    if (replay_stream.isOpen()) {
+        if (replay_stream.read(findClosestStreamIdx(elapsed), row) <= 0) {
+#if STOP_IF_END_OF_READINGS
+            main_running = false;
+#endif
+        }
+        return;
+    }
+
+    // Return 0's if there are no readings
+    if (raw_readings.empty()) {
+        for (int i = 0; i < REPLAY_NUM_COLUMNS; i++) {
+            row[i] = 0.0;
+        }
+        return;
+    }
+
+    // Otherwise every row is already in memory
+    closest_time_idx = findClosestIdx(elapsed);
+    for (int i = 0; i < REPLAY_NUM_COLUMNS; i++) {
+        row[i] = raw_readings.column(i)[closest_time_idx];
+    }
 }
 
-// Get closest reading from vector of readings
-int findClosestIdx(unsigned long time_ms) {
+// Interpolate between the two rows either side of the elapsed time
+// (milliseconds) since the first reading. Gives 0's if there are no readings.
+void readInterpolatedRow(double elapsed, float *row) {
+
+    float next_row[REPLAY_NUM_COLUMNS];
+    double pos;
+    size_t idx;
+    float frac;
+
+    // Find the row at or before the elapsed time on the grid of timestamps
+    pos = (reading_period_ms > 0.0) ? elapsed / reading_period_ms : 0.0;
+    idx = (size_t)pos;
+    frac = (float)(pos - idx);
+
+    // Streamed rows are fetched from the reader thread's window
+    if (replay_stream.isOpen()) {
+        if (replay_stream.read(idx, row) <= 0) {
+#if STOP_IF_END_OF_READINGS
+            main_running = false;
+#endif
+            return;
+        }
+        replay_stream.read(idx + 1, next_row);
+
+    // Return 0's if there are no readings
+    } else if (raw_readings.empty()) {
+        for (int i = 0; i < REPLAY_NUM_COLUMNS; i++) {
+            row[i] = 0.0;
+        }
+        return;
 
-    unsigned long closest_time = raw_readings[0][TIME_IDX];
-    int closest_time_idx = 0;
-    unsigned long num;
-
-    // Loop through timestamps in vector to find closest
-    for (long unsigned int i = 0; i < raw_readings.size(); i++) {
-        num = raw_readings[i][TIME_IDX];
-        if (abs((long long)time_ms - (long long)num) < 
-            abs((long long)time_ms - (long long)closest_time)) {
-                closest_time = num;
-                closest_time_idx = i;
+    // Otherwise every row is already in memory
+    } else {
+        if (idx >= raw_readings.size() - 1) {
+            for (int i = 0; i < REPLAY_NUM_COLUMNS; i++) {
+                row[i] = raw_readings.column(i)[raw_readings.size() - 1];
+            }
+#if STOP_IF_END_OF_READINGS
+            main_running = false;
+#endif
+            return;
         }
+        for (int i = 0; i < REPLAY_NUM_COLUMNS; i++) {
+            row[i] = raw_readings.column(i)[idx];
+            next_row[i] = raw_readings.column(i)[idx + 1];
+        }
+    }
+
+    // Straight line between the two rows
+    for (int i = 0; i < REPLAY_NUM_COLUMNS; i++) {
+        row[i] += (next_row[i] - row[i]) * frac;
     }
+}
+
+// Index the timestamps of the raw readings (call after they change)
+void buildReadingIndex() {
+    reading_index.build(raw_readings.column(TIME_IDX), raw_readings.size());
+}
+
+// Get index of the closest reading
+int findClosestIdx(unsigned long time_ms) {
+
+    int closest_time_idx = (int)reading_index.findClosest(time_ms);
 
     // Notify the main thread that we've run out of readings
 #if STOP_IF_END_OF_READINGS
@@ -148,6 +268,34 @@ int findClosestIdx(unsigned long time_ms) {
     return closest_time_idx;
 }
 
+// Get index of the streamed reading closest to the given time. Streamed
+// timestamps are replaced with the same grid as the loaded ones, so the
+// closest reading can be worked out without looking at them.
+size_t findClosestStreamIdx(unsigned long time_ms) {
+
+    float sample_rate = replay_stream.sampleRate();
+    size_t idx;
+
+    // Every timestamp is 0 if we don't have a sample rate
+    if (sample_rate <= 0.0) {
+        return 0;
+    }
+
+    // Estimate, then walk to the closest grid point (ties go earliest)
+    idx = (size_t)ceil(((double)time_ms / sample_rate) - 0.5);
+    while (fabs(time_ms - (double)(sample_rate * (idx + 1))) <= 
+            fabs(time_ms - (double)(sample_rate * idx))) {
+        idx++;
+    }
+    while ((idx > 0) && 
+            (fabs(time_ms - (double)(sample_rate * (idx - 1))) <= 
+            fabs(time_ms - (double)(sample_rate * idx)))) {
+        idx--;
+    }
+
+    return idx;
+}
+
 /*******************************************************************************
  * Main
  */
@@ -155,63 +303,138 @@ int findClosestIdx(unsigned long time_ms) {
 // Main function to call setup and loop
 int main(int argc, char **argv) {
 
-    float timestamp, accX, accY, accZ, gyrX, gyrY, gyrZ;
-    std::array<float, 7> reading;
-    
+    float *timestamps;
     float sample_rate = 0.0;
     int reading_idx = 0;
+    bool use_virtual_clock = false;
+    bool use_stream = false;
+    unsigned long sample_jitter_us = 0;
+    float drop_rate = 0.0;
+    unsigned long wakeup_jitter_us = 0;
+    float stall_probability = 0.0;
+    unsigned long stall_us = 0;
+    const char *trace_path = NULL;
+
+    // Parse command line options (input files follow the options)
+    enum LongOnlyOptions {
+        OPT_SAMPLE_JITTER = 256,
+        OPT_DROP_RATE,
+        OPT_WAKEUP_JITTER,
+        OPT_STALL,
+        OPT_TRACE
+    };
+    static struct option long_options[] = {
+        {"virtual-clock", no_argument, 0, 'v'},
+        {"stream", no_argument, 0, 's'},
+        {"resample", no_argument, 0, 'r'},
+        {"sample-jitter", required_argument, 0, OPT_SAMPLE_JITTER},
+        {"drop-rate", required_argument, 0, OPT_DROP_RATE},
+        {"wakeup-jitter", required_argument, 0, OPT_WAKEUP_JITTER},
+        {"stall", required_argument, 0, OPT_STALL},
+        {"trace", required_argument, 0, OPT_TRACE},
+        {0, 0, 0, 0}
+    };
+    int opt;
+    while ((opt = getopt_long(argc, argv, "vsr", long_options, NULL)) != -1) {
+        switch (opt) {
+            case 'v':
+                use_virtual_clock = true;
+                break;
+            case 's':
+                use_stream = true;
+                break;
+            case 'r':
+                resample_readings = true;
+                break;
+            case OPT_SAMPLE_JITTER:
+                sample_jitter_us = strtoul(optarg, NULL, 10);
+                break;
+            case OPT_DROP_RATE:
+                drop_rate = strtof(optarg, NULL);
+                break;
+            case OPT_WAKEUP_JITTER:
+                wakeup_jitter_us = strtoul(optarg, NULL, 10);
+                break;
+            case OPT_STALL:
+                if (sscanf(optarg, "%f,%lu", &stall_probability, &stall_us) != 2) {
+                    printf("ERROR: --stall expects <probability>,<us>\r\n");
+                    return 1;
+                }
+                break;
+            case OPT_TRACE:
+                trace_path = optarg;
+                break;
+            default:
+                printf("Usage: %s [--virtual-clock] [--stream] [--resample] "
+                        "[--sample-jitter <us>] [--drop-rate <0..1>] "
+                        "[--wakeup-jitter <us>] [--stall <probability>,<us>] "
+                        "[--trace <file.json>] <file.csv|file.imub> ...\r\n", 
+                        argv[0]);
+                return 1;
+        }
+    }
 
     // Check to make sure we've beens supplied at least one input file
-    if (argc < 2) {
+    if (optind >= argc) {
     printf("ERROR: No input file specified\r\n");
         return 1;
     }
 
-    // Loop through all files provided as arguments
-    for (int file_idx = 1; file_idx < argc; file_idx++) {
-
-        // Read CSV header
-        io::CSVReader<7> csv_reader(argv[file_idx]);
-        csv_reader.read_header( io::ignore_extra_column, 
-                                "timestamp", 
-                                "accX", 
-                                "accY",
-                                "accZ",
-                                "gyrX",
-                                "gyrY",
-                                "gyrZ");
-
-        // Construct vector of raw values
-        while (csv_reader.read_row(timestamp, accX, accY, accZ, gyrX, gyrY, gyrZ)) {
+    // Stream the files, or load all of them into one set of columns
+    if (use_stream) {
+        if (replay_stream.open(&argv[optind], argc - optind) != 0) {
+            printf("ERROR: %s\r\n", replay_stream.error());
+            return 1;
+        }
+        reading_period_ms = replay_stream.sampleRate();
+    } else {
+        // Load all files provided as arguments into one set of columns
+        if (raw_readings.load(&argv[optind], argc - optind) != 0) {
+            printf("ERROR: %s\r\n", raw_readings.error());
+            return 1;
+        }
 
-            // Calculate sample rate (and use that instead of what's in CSV)
+        // Calculate sample rate (and use that instead of what's in CSV)
+        timestamps = raw_readings.column(TIME_IDX);
+        for (size_t i = 0; i < raw_readings.size(); i++) {
             if (reading_idx == 0) {
-                sample_rate = timestamp;
+                sample_rate = timestamps[i];
             } else if (reading_idx == 1) {
-                sample_rate = timestamp - sample_rate;
+                sample_rate = timestamps[i] - sample_rate;
             }
-            timestamp = sample_rate * raw_readings.size();
-
-            // Read values into array
-            reading[TIME_IDX] = timestamp;
-            reading[ACC_X_IDX] = accX;
-            reading[ACC_Y_IDX] = accY;
-            reading[ACC_Z_IDX] = accZ;
-            reading[GYR_X_IDX] = gyrX;
-            reading[GYR_Y_IDX] = gyrY;
-            reading[GYR_Z_IDX] = gyrZ;
-
-            // Push array onto vector
-            raw_readings.push_back(reading);
+            timestamps[i] = sample_rate * i;
 
             // Increment our index
             reading_idx++;
         }
+
+        // Index the timestamps so the callbacks don't have to scan every reading
+        buildReadingIndex();
+        reading_period_ms = sample_rate;
     }
 
     // Register the callback functions to simulate reading from the IMU
     IMU.registerAccelCallback(readAccelerometerCallback);
     IMU.registerGyroCallback(readGyroscopeCallback);
+    IMU.registerFrameCallback(readFrameCallback);
+
+    // Inject timing problems (all off by default)
+    IMU.setImpairments(sample_jitter_us, drop_rate);
+    time_emu_set_wakeup_jitter(wakeup_jitter_us);
+    time_emu_set_wakeup_stalls(stall_probability, stall_us);
+
+    // Switch to the simulated clock before any threads are started. The main
+    // thread counts as one of the threads that drive the clock.
+    if (use_virtual_clock) {
+        time_emu_set_virtual_clock(1);
+    }
+    time_emu_thread_enter();
+
+    // Record traces from the start (setup() loads the model)
+    if (trace_path != NULL) {
+        ei_profiler_set_thread_name("main");
+        ei_profiler_start();
+    }
 
     // Run user submission
     setup();
@@ -219,11 +442,39 @@ int main(int argc, char **argv) {
 
         // Call user's loop function in submission
         loop();
+
+        // On the virtual clock, let the other threads finish what they do at
+        // this time first, so that every run sees the end of the readings at
+        // the same loop and stops at the same time
+        time_emu_wait_for_idle();
     }
 
-    // Wait for the threads to end in the user submission code
+    // Wait for the threads to end in the user submission code (this stops
+    // counting main for the clock once the threads have been told to stop)
     stop_threads();
 
-    // Note that NRF52_Timer should stop/join thread on destruction
+    // Write the trace once nothing else is recording
+    if (trace_path != NULL) {
+        ei_profiler_stop();
+        if (ei_profiler_write_chrome_trace(trace_path) != 0) {
+            printf("ERROR: Could not write trace to %s\r\n", trace_path);
+            return 1;
+        }
+        printf("Trace written to %s\r\n", trace_path);
+    }
+
+    // Let the user know how many readings the emulated IMU lost
+    if (IMU.droppedReadings() > 0) {
+        printf("IMU emulator dropped %lu readings\r\n", IMU.droppedReadings());
+    }
+
+    // Let the user know if a streamed file turned out to be bad part way
+    if (replay_stream.isOpen() && (replay_stream.error()[0] != '\0')) {
+        printf("ERROR: %s\r\n", replay_stream.error());
+        return 1;
+    }
+
+    // Note that an NRF52_Timer still attached stops and joins its thread when
+    // it is destroyed
     return 0;
 }
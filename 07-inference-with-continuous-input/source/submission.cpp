@@ -10,22 +10,55 @@
     #include <mbed.h>
     #include <Arduino_LSM9DS1.h>
     #include <magic-wand-capstone_inferencing.h>
+
+    // Copy these from lib/ into the sketch folder (see README.md)
+    #include "slice-ring.h"
+    #include "mirror-ring.h"
+
+    // The SDK exported for Arduino doesn't have the tracer (see ei_profiler.h
+    // in lib/ei-cpp-sdk), so tracing does nothing there
+    #ifndef EI_PROFILER_SCOPE
+        class EiProfilerScope {
+        public:
+            explicit EiProfilerScope(const char *name) { (void)name; }
+            void end() { }
+        };
+        static inline void ei_profiler_set_thread_name(const char *name) { (void)name; }
+        #define EI_PROFILER_SCOPE(name)             do { } while (0)
+        #define EI_PROFILER_FLOW_BEGIN(name, id)    do { } while (0)
+        #define EI_PROFILER_FLOW_END(name, id)      do { } while (0)
+    #endif
 #else
+    #include <atomic>
+    #include <chrono>
     #include <thread>
     #include "time-emulator.h"
     #include "imu-emulator.h"
+    #include "nrf52-timer-emulator.h"
+    #include "latency-histogram.h"
+    #include "slice-ring.h"
+    #include "mirror-ring.h"
     #include "edge-impulse-sdk/classifier/ei_run_classifier.h"
+    #include "tflite-model/trained_model_compiled.h"
 #endif
 
 // Settings
 #define LED_R_PIN           22        // Red LED pin
 #define ANOMALY_THRESHOLD   0.3       // Anything over this is an anomaly
+#define USE_IMU_FIFO        1         // Read a slice at a time from the FIFO (computer only)
+#define FIFO_WATERMARK      28        // Most frames to wait for in the FIFO (of 32)
+#define USE_SAMPLING_TIMER  1         // Poll the IMU from a timer tick, not a sleep loop (computer only)
+#define STATS_PERIOD_MS     5000      // How often to print sampling stats (0 = only at the end, computer only)
+#define RAW_BUF_SLOTS       4         // Slices in the raw queue (power of two, one is being filled)
+#define USE_SLIDING_MODEL   1         // Classify each slice with the sliding window model (computer only)
 
 // Constants
 #define CONVERT_G_TO_MS2    9.80665f  // Used to convert G to m/s^2
+#ifndef SAMPLING_FREQ_HZ
 #define SAMPLING_FREQ_HZ    EI_CLASSIFIER_FREQUENCY     // 100 Hz sampling rate
-#define SAMPLING_PERIOD_MS  1000 / SAMPLING_FREQ_HZ     // Sampling period (ms)
-#define SAMPLING_PERIOD_US  1000 * SAMPLING_PERIOD_MS   // Sampling period (us)
+#endif
+#define SAMPLING_PERIOD_US  (1000000 / SAMPLING_FREQ_HZ) // Sampling period (us)
+#define DECIMATION          (SAMPLING_FREQ_HZ / EI_CLASSIFIER_FREQUENCY) // Readings per model input
 #define NUM_CHANNELS        EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME // 6 channels
 #define NUM_READINGS        EI_CLASSIFIER_RAW_SAMPLE_COUNT      // 150 readings
 #define NUM_CLASSES         EI_CLASSIFIER_LABEL_COUNT           // 4 classes
@@ -35,33 +68,69 @@
 
 // Raw buffer (half of the double buffer) should be big enough for 1 slice
 // This is also the "number of readings per slice"
-#define RAW_BUF_SIZE        (NUM_CHANNELS * NUM_READINGS) / SLICES_PER_WINDOW
+#define RAW_BUF_SIZE        ((NUM_CHANNELS * NUM_READINGS * DECIMATION) / SLICES_PER_WINDOW)
+#define READINGS_PER_SLICE  (RAW_BUF_SIZE / NUM_CHANNELS)   // 25 readings at 100 Hz
+
+// Each slice of the window only holds readings at the model's sampling rate
+#define INPUT_SLICE_SIZE    ((NUM_CHANNELS * NUM_READINGS) / SLICES_PER_WINDOW)
+
+// Higher sampling rates are averaged down to the model's rate
+#if (SAMPLING_FREQ_HZ % EI_CLASSIFIER_FREQUENCY) != 0
+#error "SAMPLING_FREQ_HZ must be a multiple of the model's sampling rate"
+#endif
 
 // Function declarations
-static int get_signal_data(size_t offset, size_t length, float *out_ptr);
 void do_sampling();
+void do_sampling_fifo();
+void sampling_timer_isr();
 void do_inference();
+void print_sampling_stats();
 
 // Means and standard deviations from our dataset curation
 static const float means[] = {-0.2238, -0.3129, 5.6543, -4.8021, 4.0536, -6.4238};
 static const float std_devs[] = {5.6031, 7.5372, 7.6538, 149.2136, 125.0134, 133.8875};
 
-// Double buffer (used to capture raw samples from sensor)
-static float raw_buf_0[RAW_BUF_SIZE];
-static float raw_buf_1[RAW_BUF_SIZE];
+// Queue of raw slices from the sensor. The sampling thread fills the write
+// slot and commits it once it's full; the inference thread works through the
+// committed slices in order, so it can fall behind by a few slices without
+// losing any.
+static SliceRing<float, RAW_BUF_SIZE, RAW_BUF_SLOTS> raw_slices;
 static float *raw_buf_wr;
-static float *raw_buf_rd;
 static int raw_buf_count = 0;
-static bool raw_buf_ready = false;
 
-// Buffer that contains a full window for inference. Note that this is now a 
-// ring buffer where older samples are overwritten!
-static float input_buf[NUM_CHANNELS * NUM_READINGS];
-static int input_buf_slice = 0;
+// Slices handed to the inference thread, to link each commit to the
+// inference that picks the slice up in traces (see ei_profiler.h)
+static uint64_t slices_committed = 0;
 
-// Wrapper for raw input buffer
+// Released on every commit so that the inference thread can sleep until a
+// slice is ready instead of polling the queue
+#if ARDUINO
+    static rtos::Semaphore slice_ready(0, 1);
+#else
+    static time_emu_sem_t *slice_ready = NULL;
+#endif
+
+// Ring buffer that holds the latest window for inference: older slices are 
+// overwritten, and the latest window is always one contiguous span (see 
+// mirror-ring.h), so it can be classified where it is
+static MirrorRing window_ring;
+
+// Wrapper for the latest window
 static signal_t sig;
 
+// The model split into slices, so that only the newest slice's share of the
+// first layer has to be computed before each answer (computer only). Falls
+// back to run_classifier() if the model can't be split.
+#if !defined(ARDUINO) && USE_SLIDING_MODEL
+static ei_impulse_t impulse;
+static trained_model_sliding_t sliding_model;
+static bool sliding_ready = false;
+#endif
+
+// Set if the sliding window model converts and standardizes the readings in
+// its first layer, so that window_ring gets the averaged readings as they are
+static bool standardize_in_model = false;
+
 // Handles to threads
 #if ARDUINO
     static rtos::Thread thread_sampling(osPriorityHigh);
@@ -69,55 +138,271 @@ static signal_t sig;
 #else
     static std::thread thread_sampling;
     static std::thread thread_inference;
+    static NRF52_Timer sampling_timer;
 #endif
 
 // Global flag that controls the threads
 static volatile bool running = true;
 
+// Set once the sampling thread has stopped, so that the inference thread
+// knows that nothing more will be queued
+static volatile bool sampling_stopped = false;
+
+// Sampling statistics (reported by stop_threads())
+static unsigned long sampling_readings = 0;
+static unsigned long sampling_dropped = 0;
+static unsigned long sampling_start_us = 0;
+static unsigned long sampling_end_us = 0;
+
+// Sampling instrumentation (computer only): how late the sampling thread woke
+// up (emulated clock), how long reading the IMU and committing each slice to
+// the queue took and how long each slice waited for the inference thread (real
+// clock), and how many sampling periods were missed (readings taken a whole
+// period or more late, or lost to FIFO overruns)
+#ifndef ARDUINO
+static LatencyHistogram hist_wake_late_us;
+static LatencyHistogram hist_imu_read_ns;
+static LatencyHistogram hist_commit_ns;
+static LatencyHistogram hist_handoff_ns;
+static uint64_t raw_buf_commit_ns[RAW_BUF_SLOTS];
+static std::atomic<unsigned long> missed_periods(0);
+#endif
+
 /*******************************************************************************
  * Functions
  */
 
-// Callback: fill a section of the out_ptr buffer when requested.
-// Note that we must now start at the correct slice in the ring buffer.
-static int get_signal_data(size_t offset, size_t length, float *out_ptr) {
+// Set up the sliding window model (computer only). Each slice's features
+// are extracted on their own, so this needs a DSP block that works on every
+// reading by itself (raw data).
+#if !defined(ARDUINO) && USE_SLIDING_MODEL
+static bool init_sliding_model() {
 
-    // Find where to start reading from the ring buffer
-    size_t idx = offset + (input_buf_slice * RAW_BUF_SIZE);
+    // The int8 model (make INT8_MODEL=1) only runs through run_classifier()
+#if EI_CLASSIFIER_TFLITE_USE_INT8_MODEL == 1
+    return false;
+#endif
 
-    // Copy the elements in the ring buffer to the output buffer
-    for (size_t i = 0; i < length; i++) {
+#if EI_CLASSIFIER_STUDIO_VERSION < 3
+    impulse = ei_construct_impulse();
+#else
+    impulse = ei_default_impulse;
+#endif
 
-        // Copy element
-        out_ptr[i] = input_buf[idx];     
+    if ((impulse.dsp_blocks_size != 1) || 
+        (impulse.dsp_blocks[0].extract_fn != &extract_raw_features) ||
+        (impulse.dsp_blocks[0].axes_size != NUM_CHANNELS)) {
+        ei_printf("ERROR: Sliding window model needs a raw data block on all "
+                    "axes\r\n");
+        return false;
+    }
+    if (trained_model_sliding_init(&sliding_model, SLICES_PER_WINDOW) != kTfLiteOk) {
+        return false;
+    }
+    if (sliding_model.slice_size != INPUT_SLICE_SIZE) {
+        ei_printf("ERROR: Sliding window model has the wrong slice size\r\n");
+        trained_model_sliding_free(&sliding_model);
+        return false;
+    }
 
-        // Increment and wrap the ring buffer pointer
-        idx++;
-        if (idx >= (NUM_CHANNELS * NUM_READINGS)) {
-            idx = offset;
-        }
+    // Fold the G to m/s^2 conversion and the standardization into the first
+    // layer. The raw block scales after them, so its scale goes on the
+    // offsets too.
+    float scale[NUM_CHANNELS];
+    float offset[NUM_CHANNELS];
+    float scale_axes = ((ei_dsp_config_raw_t *)impulse.dsp_blocks[0].config)->scale_axes;
+    for (int i = 0; i < NUM_CHANNELS; i++) {
+        scale[i] = ((i < 3) ? CONVERT_G_TO_MS2 : 1.0f) / std_devs[i];
+        offset[i] = -scale_axes * means[i] / std_devs[i];
+    }
+    if (trained_model_sliding_fold_input(&sliding_model, scale, offset, 
+                                        NUM_CHANNELS) != kTfLiteOk) {
+        trained_model_sliding_free(&sliding_model);
+        return false;
+    }
+    standardize_in_model = true;
+
+    return true;
+}
+
+// Classify the window that ends with the given slice of window_ring with the
+// sliding window model (computer only)
+static EI_IMPULSE_ERROR classify_slice(const float *slice, 
+                                        ei_impulse_result_t *result) {
+
+    float features[INPUT_SLICE_SIZE];
+    float probs[NUM_CLASSES];
+    const ei_model_dsp_t *block = &impulse.dsp_blocks[0];
+    signal_t slice_sig;
+    uint64_t start_us;
+
+    memset(result, 0, sizeof(ei_impulse_result_t));
+
+    // Features of the new slice only
+    EiProfilerScope dsp_span("dsp");
+    start_us = ei_read_timer_us();
+    numpy::signal_from_buffer(slice, INPUT_SLICE_SIZE, &slice_sig);
+    ei::matrix_t features_matrix(1, INPUT_SLICE_SIZE, features);
+    if (block->extract_fn(&slice_sig, &features_matrix, block->config, 
+                            impulse.frequency) != EIDSP_OK) {
+        return EI_IMPULSE_DSP_ERROR;
+    }
+    dsp_span.end();
+    result->timing.dsp_us = ei_read_timer_us() - start_us;
+    result->timing.dsp = (int)(result->timing.dsp_us / 1000);
+
+    // Finish the window
+    start_us = ei_read_timer_us();
+    if (trained_model_sliding_push(&sliding_model, features, probs) != kTfLiteOk) {
+        return EI_IMPULSE_TFLITE_ERROR;
+    }
+    result->timing.classification_us = ei_read_timer_us() - start_us;
+    result->timing.classification = (int)(result->timing.classification_us / 1000);
+
+    EI_PROFILER_SCOPE("postprocess");
+    for (int i = 0; i < NUM_CLASSES; i++) {
+        result->classification[i].label = ei_classifier_inferencing_categories[i];
+        result->classification[i].value = probs[i];
+    }
+
+    return EI_IMPULSE_OK;
+}
+#endif
+
+// Real clock in nanoseconds, for timing short sections of code (computer only)
+#ifndef ARDUINO
+static inline uint64_t stats_now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+#endif
+
+// Hand the full slice to the inference thread and start filling the next
+// one. If the queue is full, the slice is dropped (and counted as an overrun)
+// and its slot is filled again.
+static void commit_raw_buf() {
+
+    EI_PROFILER_SCOPE("slice commit");
+
+#ifndef ARDUINO
+    raw_buf_commit_ns[raw_slices.writeIndex()] = stats_now_ns();
+#endif
+    raw_buf_count = 0;
+    if (!raw_slices.commit()) {
+        return;
     }
+    raw_buf_wr = raw_slices.writeSlot();
+    slices_committed++;
+    EI_PROFILER_FLOW_BEGIN("slice", slices_committed);
 
-    // Uncomment this section to print the whole inference buffer
-    // int timestamp = 0;
-    // int counter = 0;
-    // for (int i = 0; i < length / 6; i++) {
-    //     ei_printf("%i, ", timestamp);
-    //     timestamp += 10;
-    //     for (int j = 0; j < 5; j++) {
-    //         ei_printf("%.2f, ", out_ptr[(i * 6) + j]);
-    //     }
-    //     ei_printf("%.2f\r\n", out_ptr[(i * 6) + 5]);
-    // }
-
-    return EIDSP_OK;
+    // Wake up the inference thread
+#if ARDUINO
+    slice_ready.release();
+#else
+    time_emu_sem_release(slice_ready);
+#endif
 }
 
 // Call this if you want to stop the threads
 void stop_threads() {
+
+    float seconds;
+
+    // Main doesn't sleep from here on, so stop counting it for the emulated
+    // clock, but only once running is down: until then the clock can't move
+    // on, so the threads stop at the same time on every run
     running = false;
+#if !defined(ARDUINO) && !USE_IMU_FIFO && USE_SAMPLING_TIMER
+    sampling_timer.stopTimer();
+#endif
+#ifndef ARDUINO
+    time_emu_thread_exit();
+#endif
+#if !defined(ARDUINO) && !USE_IMU_FIFO && USE_SAMPLING_TIMER
+    sampling_timer.detachInterrupt();
+#else
     thread_sampling.join();
+#endif
+    
+    // Nothing more will be queued. Wake up the inference thread in case it's
+    // waiting for a slice, so that it finishes the queue and stops.
+    sampling_stopped = true;
+#if ARDUINO
+    slice_ready.release();
+#else
+    time_emu_sem_release(slice_ready);
+#endif
     thread_inference.join();
+
+    // Final sampling stats
+#ifndef ARDUINO
+    print_sampling_stats();
+#endif
+
+    // Report the sampling rate we actually achieved
+    seconds = (sampling_end_us - sampling_start_us) / 1000000.0f;
+    ei_printf("Sampling: %lu readings in %.2f s (%.1f Hz, target %d Hz), "
+                "%lu dropped\r\n",
+                sampling_readings,
+                seconds,
+                (seconds > 0.0f) ? sampling_readings / seconds : 0.0f,
+                SAMPLING_FREQ_HZ,
+                sampling_dropped);
+}
+
+// Take one reading from the IMU and store it in the double buffer (called
+// by the sampling thread or the sampling timer)
+static void take_reading() {
+
+    float acc_x, acc_y, acc_z, gyr_x, gyr_y, gyr_z;
+    static bool led_state = false;
+#ifndef ARDUINO
+    uint64_t t_ns;
+#endif
+    EI_PROFILER_SCOPE("reading");
+
+    // Toggle LED to show that sampling is happening
+#if ARDUINO
+    led_state = !led_state;
+    digitalWrite(LED_R_PIN, led_state);
+#endif
+    
+    // Get raw readings from the sensors (skip the reading if either fails)
+#ifndef ARDUINO
+    t_ns = stats_now_ns();
+#endif
+    if (!IMU.readAcceleration(acc_x, acc_y, acc_z) ||
+        !IMU.readGyroscope(gyr_x, gyr_y, gyr_z)) {
+        sampling_dropped++;
+        return;
+    }
+#ifndef ARDUINO
+    hist_imu_read_ns.record(stats_now_ns() - t_ns);
+#endif
+    sampling_readings++;
+    sampling_end_us = micros();
+
+    // Store the raw readings in the buffer (use the write pointer)
+    raw_buf_wr[raw_buf_count + 0] = acc_x;
+    raw_buf_wr[raw_buf_count + 1] = acc_y;
+    raw_buf_wr[raw_buf_count + 2] = acc_z;
+    raw_buf_wr[raw_buf_count + 3] = gyr_x;
+    raw_buf_wr[raw_buf_count + 4] = gyr_y;
+    raw_buf_wr[raw_buf_count + 5] = gyr_z;
+
+    // Increment the counter by the number of readings you stored
+    raw_buf_count += NUM_CHANNELS;
+
+    // Queue the slice if it's full
+    if (raw_buf_count >= RAW_BUF_SIZE) {
+#ifndef ARDUINO
+        t_ns = stats_now_ns();
+        commit_raw_buf();
+        hist_commit_ns.record(stats_now_ns() - t_ns);
+#else
+        commit_raw_buf();
+#endif
+    }
 }
 
 /******************************************************************************* 
@@ -128,141 +413,287 @@ void stop_threads() {
 void do_sampling() {
     
     unsigned long time_start, time_target, time_actual, to_sleep;
-    float acc_x, acc_y, acc_z, gyr_x, gyr_y, gyr_z;
-    static bool led_state = false;
+#ifndef ARDUINO
+    unsigned long late_us;
+#endif
   
     // Initialize times
-    time_start = millis();
+    time_start = micros();
     time_target = 0;
+    sampling_start_us = time_start;
+    ei_profiler_set_thread_name("sampling");
 
     // Run this thread forever
     while (running) {
 
         // Determine how long to sleep to meet target
-        time_target += SAMPLING_PERIOD_MS;
-        time_actual = millis() - time_start;
+        time_target += SAMPLING_PERIOD_US;
+        time_actual = micros() - time_start;
         if (time_actual < time_target) {
             to_sleep = time_target - time_actual;
         } else {
             to_sleep = 0;
         }
     
-        // Sleep before sampling
+        // Sleep before sampling (delay() also drives the emulator's virtual clock)
 #if ARDUINO
-        rtos::ThisThread::sleep_for(to_sleep);
+        rtos::ThisThread::sleep_for(to_sleep / 1000);
+        wait_us(to_sleep % 1000);
 #else
-        std::this_thread::sleep_for(std::chrono::milliseconds(to_sleep));
+        delayMicroseconds(to_sleep);
+
+        // Record how late we woke up
+        late_us = micros() - (time_start + time_target);
+        hist_wake_late_us.record(late_us);
+        if (late_us >= SAMPLING_PERIOD_US) {
+            missed_periods++;
+        }
 #endif
     
-        // Toggle LED to show that sampling is happening
-#if ARDUINO
-        led_state = !led_state;
-        digitalWrite(LED_R_PIN, led_state);
+        // Read the IMU and store the reading
+        take_reading();
+    }
+
+    // Let the emulated clock run without this thread
+#ifndef ARDUINO
+    time_emu_thread_exit();
 #endif
-        
-        // Get raw readings from the sensors
-        IMU.readAcceleration(acc_x, acc_y, acc_z);
-        IMU.readGyroscope(gyr_x, gyr_y, gyr_z);
-    
-        // Store the raw readings in the buffer (use the write pointer)
-        raw_buf_wr[raw_buf_count + 0] = acc_x;
-        raw_buf_wr[raw_buf_count + 1] = acc_y;
-        raw_buf_wr[raw_buf_count + 2] = acc_z;
-        raw_buf_wr[raw_buf_count + 3] = gyr_x;
-        raw_buf_wr[raw_buf_count + 4] = gyr_y;
-        raw_buf_wr[raw_buf_count + 5] = gyr_z;
-    
-        // Increment the counter by the number of readings you stored
-        raw_buf_count += NUM_CHANNELS;
-    
-        // Swap pointers if buffer is full
+}
+
+// High-priority thread that lets the IMU's FIFO collect samples and wakes up
+// once per slice to read them out in a burst (computer only)
+#ifndef ARDUINO
+void do_sampling_fifo() {
+
+    unsigned long overruns = 0;
+    unsigned long wake_target;
+    size_t frames_needed, frames_wanted, num_frames;
+    uint64_t t_ns;
+
+    // Raise the watermark when a full slice (or as much of one as we're
+    // willing to let the FIFO hold) is waiting
+    ei_profiler_set_thread_name("sampling");
+    IMU.setFifoWatermark((READINGS_PER_SLICE < FIFO_WATERMARK) ? 
+                            READINGS_PER_SLICE : FIFO_WATERMARK);
+    if (!IMU.beginFifo(SAMPLING_FREQ_HZ)) {
+        ei_printf("ERROR: Failed to start IMU FIFO!\r\n");
+        time_emu_thread_exit();
+        return;
+    }
+    sampling_start_us = micros();
+
+    // Run this thread forever
+    while (running) {
+
+        // Sleep until the FIFO should hold the rest of the slice (at high
+        // sampling rates, a slice takes several trips to the FIFO)
+        frames_needed = READINGS_PER_SLICE - (raw_buf_count / NUM_CHANNELS);
+        frames_wanted = (frames_needed < FIFO_WATERMARK) ? 
+                        frames_needed : FIFO_WATERMARK;
+        num_frames = IMU.fifoAvailable();
+        if (num_frames < frames_wanted) {
+            wake_target = micros() + ((frames_wanted - num_frames) * SAMPLING_PERIOD_US);
+            delayMicroseconds((frames_wanted - num_frames) * SAMPLING_PERIOD_US);
+            hist_wake_late_us.record(micros() - wake_target);
+        }
+        if (!running) {
+            break;
+        }
+
+        // Read no more than one slice so that we never commit twice in a row.
+        // Anything left over stays in the FIFO until the next wakeup.
+        EiProfilerScope read_span("IMU FIFO read");
+        t_ns = stats_now_ns();
+        num_frames = IMU.readFifoBurst(&raw_buf_wr[raw_buf_count], 
+                                        frames_needed);
+        hist_imu_read_ns.record(stats_now_ns() - t_ns);
+        read_span.end();
+        raw_buf_count += num_frames * NUM_CHANNELS;
+        if (num_frames > 0) {
+            sampling_readings += num_frames;
+            sampling_end_us = micros();
+        }
         if (raw_buf_count >= RAW_BUF_SIZE) {
-            raw_buf_count = 0;
-            raw_buf_ready = true;
-            if (raw_buf_wr == &raw_buf_0[0]) {
-                raw_buf_wr = raw_buf_1;
-                raw_buf_rd = raw_buf_0;
-            } else {
-                raw_buf_wr = raw_buf_0;
-                raw_buf_rd = raw_buf_1;
-            }
+            t_ns = stats_now_ns();
+            commit_raw_buf();
+            hist_commit_ns.record(stats_now_ns() - t_ns);
+        }
+
+        // Let the user know if we were too slow to empty the FIFO (every lost
+        // frame is a missed sampling period)
+        if (IMU.fifoOverruns() != overruns) {
+            missed_periods += IMU.fifoOverruns() - overruns;
+            overruns = IMU.fifoOverruns();
+            ei_printf("ERROR: IMU FIFO overrun\r\n");
         }
     }
+
+    // Stop sampling and let the emulated clock run without this thread
+    IMU.endFifo();
+    time_emu_thread_exit();
 }
 
+// Sampling timer "ISR": takes one reading every sampling period. The ticks
+// come from absolute deadlines, so there is no sleep target to recompute and
+// nothing can drift (computer only).
+void sampling_timer_isr() {
+
+    static unsigned long overruns = 0;
+    static bool thread_named = false;
+
+    if (!running) {
+        return;
+    }
+    if (!thread_named) {
+        ei_profiler_set_thread_name("sampling timer");
+        thread_named = true;
+    }
+
+    // Record how late the tick was handled (ticks that were skipped entirely
+    // are missed periods)
+    hist_wake_late_us.record(micros() - sampling_timer.tickDueUs());
+    if (sampling_timer.overruns() != overruns) {
+        missed_periods += sampling_timer.overruns() - overruns;
+        overruns = sampling_timer.overruns();
+    }
+
+    take_reading();
+}
+#endif
+
 // Low-priority thread that performs inference
 void do_inference() {
   
     float acc_x, acc_y, acc_z, gyr_x, gyr_y, gyr_z;
+    const float *raw_buf_rd;    // Oldest slice in the raw queue
+    const float *raw;           // Reading in the raw (read) buffer
     ei_impulse_result_t result; // Used to store inference output
     EI_IMPULSE_ERROR res;       // Return code from inference
-    int start_slice_offset;     // Index of the current slice in input_buf
+    float *slice_buf;           // Current slice in window_ring
+    unsigned long overruns = 0; // Slices we've reported as dropped
+    uint64_t slices_received = 0;   // Slices picked up (for traces)
 
-    // Do inference forever
-    while (running) {
-    
-        // If buffer is already full, it has been overrun
-        if (raw_buf_ready) {
-            ei_printf("ERROR: Buffer overrun\r\n");
-            continue;
-        }
+    ei_profiler_set_thread_name("inference");
+
+    // Do inference until sampling stops and every slice it queued is done
+    while (true) {
     
-        // Wait until buffer is full
-        while (!raw_buf_ready) {
-            delay(10);
-            if (!running) {
+        // Sleep until the sampling thread hands over a full slice (the
+        // semaphore is also released to wake us up when it's time to stop)
+        raw_buf_rd = raw_slices.readSlot();
+        if (raw_buf_rd == nullptr) {
+            if (sampling_stopped) {
                 break;
             }
+            EI_PROFILER_SCOPE("wait for slice");
+#if ARDUINO
+            slice_ready.acquire();
+#else
+            time_emu_sem_acquire(slice_ready, 0);
+#endif
+            continue;
         }
-        raw_buf_ready = false;
-    
-        // Compute the index of the current slice for input_buf
-        start_slice_offset = RAW_BUF_SIZE * input_buf_slice;
+#ifndef ARDUINO
+        hist_handoff_ns.record(stats_now_ns() - 
+                                raw_buf_commit_ns[raw_slices.readIndex()]);
+#endif
+
+        // Everything done with this slice goes in one span, which the
+        // commit that handed it over points to in traces
+        EI_PROFILER_SCOPE("slice");
+        slices_received++;
+        EI_PROFILER_FLOW_END("slice", slices_received);
+
+        // Let the user know if slices were dropped because we fell too far
+        // behind
+        if (raw_slices.overruns() != overruns) {
+            overruns = raw_slices.overruns();
+            ei_printf("ERROR: Buffer overrun\r\n");
+        }
+
+        // The current slice goes after the latest one in window_ring
+        EiProfilerScope preprocess_span("preprocess");
+        slice_buf = window_ring.writePtr();
     
         // Transform and copy contents of raw (read) buffer to input (ring) buffer
-        for (int i = 0; i < (RAW_BUF_SIZE / NUM_CHANNELS); i++) {
-    
-            // Get accelerometer and gyroscope data from raw (read) buffer
-            acc_x = raw_buf_rd[(NUM_CHANNELS * i) + 0];
-            acc_y = raw_buf_rd[(NUM_CHANNELS * i) + 1];
-            acc_z = raw_buf_rd[(NUM_CHANNELS * i) + 2];
-            gyr_x = raw_buf_rd[(NUM_CHANNELS * i) + 3];
-            gyr_y = raw_buf_rd[(NUM_CHANNELS * i) + 4];
-            gyr_z = raw_buf_rd[(NUM_CHANNELS * i) + 5];
+        for (int i = 0; i < (INPUT_SLICE_SIZE / NUM_CHANNELS); i++) {
     
-            // Convert accelerometer units from G to m/s^s
-            acc_x *= CONVERT_G_TO_MS2;
-            acc_y *= CONVERT_G_TO_MS2;
-            acc_z *= CONVERT_G_TO_MS2;
+            // Get accelerometer and gyroscope data from raw (read) buffer,
+            // averaging readings down to the model's sampling rate
+            acc_x = 0.0f;
+            acc_y = 0.0f;
+            acc_z = 0.0f;
+            gyr_x = 0.0f;
+            gyr_y = 0.0f;
+            gyr_z = 0.0f;
+            for (int j = 0; j < DECIMATION; j++) {
+                raw = &raw_buf_rd[NUM_CHANNELS * ((DECIMATION * i) + j)];
+                acc_x += raw[0];
+                acc_y += raw[1];
+                acc_z += raw[2];
+                gyr_x += raw[3];
+                gyr_y += raw[4];
+                gyr_z += raw[5];
+            }
+            acc_x /= DECIMATION;
+            acc_y /= DECIMATION;
+            acc_z /= DECIMATION;
+            gyr_x /= DECIMATION;
+            gyr_y /= DECIMATION;
+            gyr_z /= DECIMATION;
     
-            // Perform standardization on each reading
-            // Use the values from means[] and std_devs[]
-            acc_x = (acc_x - means[0]) / std_devs[0];
-            acc_y = (acc_y - means[1]) / std_devs[1];
-            acc_z = (acc_z - means[2]) / std_devs[2];
-            gyr_x = (gyr_x - means[3]) / std_devs[3];
-            gyr_y = (gyr_y - means[4]) / std_devs[4];
-            gyr_z = (gyr_z - means[5]) / std_devs[5];
+            // Convert accelerometer units from G to m/s^s and perform 
+            // standardization on each reading with the values from means[]
+            // and std_devs[] (unless the model does both)
+            if (!standardize_in_model) {
+                acc_x *= CONVERT_G_TO_MS2;
+                acc_y *= CONVERT_G_TO_MS2;
+                acc_z *= CONVERT_G_TO_MS2;
+
+                acc_x = (acc_x - means[0]) / std_devs[0];
+                acc_y = (acc_y - means[1]) / std_devs[1];
+                acc_z = (acc_z - means[2]) / std_devs[2];
+                gyr_x = (gyr_x - means[3]) / std_devs[3];
+                gyr_y = (gyr_y - means[4]) / std_devs[4];
+                gyr_z = (gyr_z - means[5]) / std_devs[5];
+            }
     
-            // Fill the correct slice in input_buf with the standardized readings
-            input_buf[start_slice_offset + (NUM_CHANNELS * i) + 0] = acc_x;
-            input_buf[start_slice_offset + (NUM_CHANNELS * i) + 1] = acc_y;
-            input_buf[start_slice_offset + (NUM_CHANNELS * i) + 2] = acc_z;
-            input_buf[start_slice_offset + (NUM_CHANNELS * i) + 3] = gyr_x;
-            input_buf[start_slice_offset + (NUM_CHANNELS * i) + 4] = gyr_y;
-            input_buf[start_slice_offset + (NUM_CHANNELS * i) + 5] = gyr_z;
+            // Fill the current slice with the readings
+            slice_buf[(NUM_CHANNELS * i) + 0] = acc_x;
+            slice_buf[(NUM_CHANNELS * i) + 1] = acc_y;
+            slice_buf[(NUM_CHANNELS * i) + 2] = acc_z;
+            slice_buf[(NUM_CHANNELS * i) + 3] = gyr_x;
+            slice_buf[(NUM_CHANNELS * i) + 4] = gyr_y;
+            slice_buf[(NUM_CHANNELS * i) + 5] = gyr_z;
         }
+
+        // Give the slot back to the sampling thread
+        raw_slices.release();
     
-        // Increment and wrap slice counter
-        input_buf_slice++;
-        if (input_buf_slice >= SLICES_PER_WINDOW) {
-            input_buf_slice = 0;
+        // Add the slice to the ring buffer and point the signal at the 
+        // window that ends with it (oldest slice first)
+        window_ring.commit(INPUT_SLICE_SIZE);
+        numpy::signal_from_buffer(window_ring.last(NUM_CHANNELS * NUM_READINGS),
+                                    NUM_CHANNELS * NUM_READINGS, 
+                                    &sig);
+        preprocess_span.end();
+
+        // Call run_classifier() to perform preprocessing and inferece (or
+        // only add the new slice to the sliding window model)
+        EiProfilerScope classify_span("classify");
+#if !defined(ARDUINO) && USE_SLIDING_MODEL
+        if (sliding_ready) {
+            res = classify_slice(slice_buf, &result);
+        } else {
+            res = run_classifier(&sig, &result, false);
         }
-    
-        // Call run_classifier() to perform preprocessing and inferece
+#else
         res = run_classifier(&sig, &result, false);
+#endif
+        classify_span.end();
     
         // Find the label with the highest classification value
+        EiProfilerScope report_span("report");
         float max_val = 0.0;
         int max_idx = -1;
         for (int i = 0; i < NUM_CLASSES; i++) {
@@ -312,9 +743,60 @@ void do_inference() {
         }
 #endif
         ei_printf("---\r\n");
+        report_span.end();
+
+        // Add the slice to the later windows now rather than when the next
+        // slice comes in
+#if !defined(ARDUINO) && USE_SLIDING_MODEL
+        if (sliding_ready) {
+            trained_model_sliding_advance(&sliding_model);
+        }
+#endif
     }
+
+    // Let the emulated clock run without this thread
+#ifndef ARDUINO
+    time_emu_thread_exit();
+#endif
 }
 
+/*******************************************************************************
+ * Instrumentation
+ */
+
+// Print the sampling histograms as text (stdout) and as one line of JSON
+// (stderr) so that they can be collected by a script (computer only)
+#ifndef ARDUINO
+void print_sampling_stats() {
+
+    unsigned long now_ms = millis();
+
+    // Human-readable
+    printf("Sampling stats at %lu ms: %lu missed periods, %lu slices dropped, "
+            "%u of %u queued at most\r\n", 
+            now_ms, missed_periods.load(), raw_slices.overruns(),
+            raw_slices.highWater(), (unsigned int)raw_slices.capacity());
+    hist_wake_late_us.print(stdout, "  wake late", "us");
+    hist_imu_read_ns.print(stdout, "  IMU read", "ns");
+    hist_commit_ns.print(stdout, "  slice commit", "ns");
+    hist_handoff_ns.print(stdout, "  handoff", "ns");
+
+    // Machine-readable
+    fprintf(stderr, "{\"time_ms\":%lu,\"missed_periods\":%lu,"
+            "\"slices_dropped\":%lu,\"queue_high_water\":%u,\"wake_late_us\":", 
+            now_ms, missed_periods.load(), raw_slices.overruns(),
+            raw_slices.highWater());
+    hist_wake_late_us.printJson(stderr);
+    fprintf(stderr, ",\"imu_read_ns\":");
+    hist_imu_read_ns.printJson(stderr);
+    fprintf(stderr, ",\"commit_ns\":");
+    hist_commit_ns.printJson(stderr);
+    fprintf(stderr, ",\"handoff_ns\":");
+    hist_handoff_ns.printJson(stderr);
+    fprintf(stderr, "}\n");
+}
+#endif
+
 /*******************************************************************************
  * Main
  * Note: setup and loop are not in a thread!
@@ -331,12 +813,14 @@ void setup() {
     Serial.begin(115200);
 #endif
 
-    // Initialize double buffer pointers
-    raw_buf_wr = raw_buf_0;
-    raw_buf_rd = raw_buf_1;
+    // Start filling the first slot of the raw queue
+    raw_buf_wr = raw_slices.writeSlot();
 
-    // Clear ring buffer
-    memset(input_buf, 0, (NUM_CHANNELS * NUM_READINGS) * sizeof(float));
+    // Set up the ring buffer (starts out as zeros)
+    if (!window_ring.init(NUM_CHANNELS * NUM_READINGS)) {
+        ei_printf("ERROR: Failed to allocate ring buffer!\r\n");
+        while (1);
+    }
 
     // Start IMU
     if (!IMU.begin()) {
@@ -347,16 +831,36 @@ void setup() {
     ei_printf("Raw size: %i\r\n", RAW_BUF_SIZE);
     ei_printf("Ring size: %i\r\n", NUM_CHANNELS * NUM_READINGS);
 
-    // Assign callback function to fill buffer used for preprocessing/inference
-    sig.total_length = EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE;
-    sig.get_data = &get_signal_data;
+    // Set up the sliding window model (computer only)
+#if !defined(ARDUINO) && USE_SLIDING_MODEL
+    sliding_ready = init_sliding_model();
+#endif
 
     // Start threads
 #if ARDUINO
     thread_sampling.start(mbed::callback(&do_sampling));
     thread_inference.start(mbed::callback(&do_inference));
 #else
+    slice_ready = time_emu_sem_create(0, 1);
+    if (slice_ready == NULL) {
+        ei_printf("ERROR: Failed to create slice semaphore!\r\n");
+        while (1);
+    }
+#if USE_IMU_FIFO
+    time_emu_thread_enter();
+    thread_sampling = std::thread(do_sampling_fifo);
+#elif USE_SAMPLING_TIMER
+    sampling_start_us = micros();
+    if (!sampling_timer.attachInterruptInterval(SAMPLING_PERIOD_US, 
+                                                sampling_timer_isr)) {
+        ei_printf("ERROR: Failed to start sampling timer!\r\n");
+        while (1);
+    }
+#else
+    time_emu_thread_enter();
     thread_sampling = std::thread(do_sampling);
+#endif
+    time_emu_thread_enter();
     thread_inference = std::thread(do_inference);
 #endif
 }
@@ -367,6 +871,17 @@ void loop() {
 #if ARDUINO
     rtos::ThisThread::sleep_for(100);
 #else
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    delay(100);
+
+    // Print the sampling stats every so often
+    static unsigned long stats_last_ms = 0;
+    if ((STATS_PERIOD_MS > 0) && (millis() - stats_last_ms >= STATS_PERIOD_MS)) {
+        stats_last_ms = millis();
+
+        // On the virtual clock, wait for the sampling thread to finish what
+        // it does at this time, so that the stats are the same on every run
+        time_emu_wait_for_idle();
+        print_sampling_stats();
+    }
 #endif
 }
\ No newline at end of file
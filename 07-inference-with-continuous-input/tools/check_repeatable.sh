@@ -0,0 +1,51 @@
+#!/bin/sh
+#
+# Repeat-run check for the virtual clock
+#
+# Replays the recordings against the virtual clock several times and checks
+# that every run prints exactly the same thing. The only lines left out are
+# the histograms of real (not emulated) times, which are never the same
+# twice. Extra options for the app go in APP_ARGS, e.g.
+# APP_ARGS="--resample --wakeup-jitter 500".
+#
+# Run with:
+#
+#  make repeat
+#  sh tools/check_repeatable.sh [-n <runs>] [<file.csv|file.imub> ...]
+#
+# Returns 1 if any run differs from the first one.
+#
+# License: Apache-2.0
+
+APP=${APP:-./build/app.out}
+RUNS=5
+if [ "$1" = "-n" ]; then
+    RUNS=$2
+    shift 2
+fi
+if [ $# -eq 0 ]; then
+    set -- tests/*.csv
+fi
+
+TMP_DIR=$(mktemp -d) || exit 1
+trap 'rm -rf "$TMP_DIR"' EXIT
+
+# Real-clock histograms printed with the sampling stats
+REAL_CLOCK_LINES='^  (IMU read|slice commit|handoff) '
+
+run=1
+while [ $run -le $RUNS ]; do
+    if ! "$APP" --virtual-clock $APP_ARGS "$@" 2>/dev/null | \
+            grep -Ev "$REAL_CLOCK_LINES" > "$TMP_DIR/run$run.txt"; then
+        echo "ERROR: Run $run failed"
+        exit 1
+    fi
+    if [ $run -gt 1 ] && ! cmp -s "$TMP_DIR/run1.txt" "$TMP_DIR/run$run.txt"; then
+        echo "ERROR: Run $run differs from run 1:"
+        diff "$TMP_DIR/run1.txt" "$TMP_DIR/run$run.txt" | head -20
+        exit 1
+    fi
+    run=$((run + 1))
+done
+
+echo "$RUNS runs printed the same $(grep -c '^ANS: ' "$TMP_DIR/run1.txt") answers"
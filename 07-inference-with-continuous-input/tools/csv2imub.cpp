@@ -0,0 +1,128 @@
+/**
+ * Convert CSV recordings into the binary replay format (see replay-data.h)
+ *
+ * The CSV files are concatenated in the order given. The label defaults to
+ * the part of the first file name before the first '.' (e.g. "alpha" for
+ * tests/alpha.2942e6abeec9.csv). Use --int16 to store the readings as scaled
+ * 16-bit integers (lossy, about a third of the size of the CSV).
+ *
+ * Build and run with:
+ *
+ *  make tools
+ *  ./build/csv2imub.out -o alpha.imub tests/alpha.2942e6abeec9.csv
+ *  ./build/csv2imub.out --info alpha.imub
+ *
+ * License: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <getopt.h>
+
+#include "replay-data.h"
+
+// Print usage
+static void print_usage(const char *name) {
+    printf("Usage: %s [--int16] [--label <label>] -o <out.imub> <in.csv> ...\r\n", name);
+    printf("       %s --info <file.imub>\r\n", name);
+}
+
+// Print the header of a binary recording
+static int print_info(const char *path) {
+
+    ReplayBinHeader hdr;
+    ReplayBinChannel chan;
+    FILE *fp;
+
+    fp = fopen(path, "rb");
+    if (fp == 0) {
+        printf("ERROR: Could not open %s\r\n", path);
+        return 1;
+    }
+    if ((fread(&hdr, sizeof(hdr), 1, fp) != 1) ||
+        (memcmp(hdr.magic, REPLAY_BIN_MAGIC, 4) != 0)) {
+        printf("ERROR: %s is not a binary recording\r\n", path);
+        fclose(fp);
+        return 1;
+    }
+    hdr.label[REPLAY_BIN_LABEL_LEN - 1] = '\0';
+    printf("Version: %u\r\n", hdr.version);
+    printf("Label: %s\r\n", hdr.label);
+    printf("Format: %s\r\n",
+        (hdr.sample_format == REPLAY_BIN_INT16) ? "int16" : "float32");
+    printf("Frames: %llu\r\n", (unsigned long long)hdr.num_frames);
+    printf("Sample rate: %.3f Hz\r\n", hdr.sample_rate_hz);
+    printf("Uniform timestamps: %s\r\n",
+        (hdr.flags & REPLAY_BIN_FLAG_UNIFORM_TIME) ? "yes" : "no");
+    for (uint32_t i = 0; i < hdr.num_channels; i++) {
+        if (fread(&chan, sizeof(chan), 1, fp) != 1) {
+            break;
+        }
+        chan.name[REPLAY_BIN_NAME_LEN - 1] = '\0';
+        printf("  %-12s scale %g, offset %g\r\n", chan.name, chan.scale, chan.offset);
+    }
+    fclose(fp);
+
+    return 0;
+}
+
+int main(int argc, char **argv) {
+
+    static struct option long_options[] = {
+        {"int16", no_argument, 0, 'i'},
+        {"label", required_argument, 0, 'l'},
+        {"output", required_argument, 0, 'o'},
+        {"info", required_argument, 0, 'n'},
+        {0, 0, 0, 0}
+    };
+    int opt;
+    int sample_format = REPLAY_BIN_FLOAT32;
+    const char *out_path = 0;
+    const char *base;
+    char label[REPLAY_BIN_LABEL_LEN] = {0};
+    ReplayData data;
+
+    // Parse command line options (input files follow the options)
+    while ((opt = getopt_long(argc, argv, "il:o:", long_options, NULL)) != -1) {
+        switch (opt) {
+            case 'i':
+                sample_format = REPLAY_BIN_INT16;
+                break;
+            case 'l':
+                strncpy(label, optarg, REPLAY_BIN_LABEL_LEN - 1);
+                break;
+            case 'o':
+                out_path = optarg;
+                break;
+            case 'n':
+                return print_info(optarg);
+            default:
+                print_usage(argv[0]);
+                return 1;
+        }
+    }
+    if ((out_path == 0) || (optind >= argc)) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    // Use the start of the first file name as the label
+    if (label[0] == '\0') {
+        base = strrchr(argv[optind], '/');
+        base = (base != 0) ? base + 1 : argv[optind];
+        strncpy(label, base, REPLAY_BIN_LABEL_LEN - 1);
+        if (strchr(label, '.') != 0) {
+            *strchr(label, '.') = '\0';
+        }
+    }
+
+    // Read all of the CSV files and write them out in one go
+    if ((data.load(&argv[optind], argc - optind) != 0) ||
+        (data.saveBinary(out_path, sample_format, label) != 0)) {
+        printf("ERROR: %s\r\n", data.error());
+        return 1;
+    }
+    printf("Wrote %zu readings to %s\r\n", data.size(), out_path);
+
+    return 0;
+}
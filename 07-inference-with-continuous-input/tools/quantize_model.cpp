@@ -0,0 +1,456 @@
+/**
+ * Quantize the compiled float model to int8 (see trained_model_int8.h)
+ *
+ * Concatenates the recordings like the application does, cuts them into
+ * windows (one per slice, like continuous inference sees them), standardizes them like submission.cpp and runs the float model
+ * over every window to find the range of each layer's inputs and outputs.
+ * Then it quantizes the model the way the TFLite converter does for int8:
+ *
+ *  - Weights: symmetric int8 with one scale per output channel
+ *    (max |w| / 127).
+ *  - Activations: asymmetric int8 over the calibrated range (which always
+ *    includes 0), one scale and zero point per tensor.
+ *  - Biases: int32 in units of input scale * weight scale.
+ *  - Each output channel gets a fixed-point multiplier and shift for
+ *    input scale * weight scale / output scale.
+ *
+ * and writes the parameters as C++ source. The model must be a chain of
+ * fully connected layers that ends in a softmax.
+ *
+ * Build and run with:
+ *
+ *  make quantize
+ *  ./build/quantize.out tests/alpha.2942e6abeec9.csv tests/beta.67ca58f8af8c.csv
+ *  ./build/quantize.out -o my_model_int8_data.cpp tests/alpha.2942e6abeec9.csv
+ *
+ * Then rebuild the application (and make int8 to check the new model).
+ *
+ * License: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include <math.h>
+#include <getopt.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "replay-data.h"
+#include "edge-impulse-sdk/classifier/ei_run_classifier.h"
+#include "edge-impulse-sdk/tensorflow/lite/c/builtin_op_data.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/quantization_util.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/kernel_util.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/float_simd.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/kernels/int8_simd.h"
+#include "tflite-model/trained_model_compiled.h"
+
+// Settings
+#define DEFAULT_OUTPUT      "lib/ei-cpp-sdk/tflite-model/trained_model_int8_data.cpp"
+#define SLICES_PER_WINDOW   6           // Same as submission.cpp
+#define VALUES_PER_LINE     32          // Int8 values per line of output
+
+// Constants
+#define CONVERT_G_TO_MS2    9.80665f
+#define NUM_CHANNELS        EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME
+#define NUM_READINGS        EI_CLASSIFIER_RAW_SAMPLE_COUNT
+#define READINGS_PER_SLICE  (NUM_READINGS / SLICES_PER_WINDOW)
+
+// Means and standard deviations from our dataset curation (same as
+// submission.cpp)
+static const float means[] = {-0.2238, -0.3129, 5.6543, -4.8021, 4.0536, -6.4238};
+static const float std_devs[] = {5.6031, 7.5372, 7.6538, 149.2136, 125.0134, 133.8875};
+
+// One fully connected layer of the float model, and what it becomes
+struct Layer {
+    int depth;
+    int outputs;
+    const float *weights;
+    const float *bias;
+    TfLiteFusedActivation activation;
+
+    // Calibrated range of the layer's output
+    float out_min;
+    float out_max;
+
+    // Quantized parameters
+    std::vector<int8_t> q_weights;
+    std::vector<int32_t> q_weight_sums;
+    std::vector<int32_t> q_bias;
+    std::vector<int32_t> q_multiplier;
+    std::vector<int32_t> q_shift;
+    float out_scale;
+    int32_t out_zero_point;
+    int32_t act_min;
+    int32_t act_max;
+};
+
+/*******************************************************************************
+ * Functions
+ */
+
+// Append every window of a recording (one per slice) to windows
+static size_t cutWindows(const ReplayData &rec, std::vector<float> &windows) {
+
+    size_t num_windows = 0;
+    float val;
+
+    for (size_t start = 0; start + NUM_READINGS <= rec.size();
+            start += READINGS_PER_SLICE) {
+        for (size_t i = 0; i < NUM_READINGS; i++) {
+            for (int ch = 0; ch < NUM_CHANNELS; ch++) {
+                val = rec.column(ReplayData::ACC_X + ch)[start + i];
+                if (ch < 3) {
+                    val *= CONVERT_G_TO_MS2;
+                }
+                windows.push_back((val - means[ch]) / std_devs[ch]);
+            }
+        }
+        num_windows++;
+    }
+
+    return num_windows;
+}
+
+// Read the layers of the float model from a context. Returns false if the
+// model is not a chain of float fully connected layers ending in a softmax.
+static bool readLayers(trained_model_ctx_t *mctx, std::vector<Layer> &layers,
+                        float *beta) {
+
+    for (size_t n = 0; n < TRAINED_MODEL_NODE_COUNT; n++) {
+        const TfLiteNode &node = mctx->nodes[n];
+
+        // Softmax (last)
+        if (node.inputs->size == 1) {
+            if ((n != TRAINED_MODEL_NODE_COUNT - 1) || layers.empty()) {
+                return false;
+            }
+            *beta = ((const TfLiteSoftmaxParams *)node.builtin_data)->beta;
+            return true;
+        }
+
+        // Fully connected
+        if (node.inputs->size != 3) {
+            return false;
+        }
+        const TfLiteTensor &input = mctx->tensors[node.inputs->data[0]];
+        const TfLiteTensor &weights = mctx->tensors[node.inputs->data[1]];
+        if ((input.type != kTfLiteFloat32) || (weights.type != kTfLiteFloat32) ||
+                (weights.allocation_type != kTfLiteMmapRo) ||
+                (weights.dims->size != 2)) {
+            return false;
+        }
+
+        Layer layer;
+        layer.outputs = weights.dims->data[0];
+        layer.depth = weights.dims->data[1];
+        layer.weights = weights.data.f;
+        layer.bias = (node.inputs->data[2] >= 0) ?
+            mctx->tensors[node.inputs->data[2]].data.f : NULL;
+        layer.activation =
+            ((const TfLiteFullyConnectedParams *)node.builtin_data)->activation;
+        layer.out_min = 0.0f;
+        layer.out_max = 0.0f;
+        if (!layers.empty() && (layers.back().outputs != layer.depth)) {
+            return false;
+        }
+        layers.push_back(layer);
+    }
+
+    return false;
+}
+
+// Scale and zero point of an asymmetric int8 tensor over [min, max] (widened
+// to include 0, so that 0 is exact)
+static void chooseQuantization(float min, float max, float *scale,
+                                int32_t *zero_point) {
+
+    min = std::min(min, 0.0f);
+    max = std::max(max, 0.0f);
+    *scale = (max > min) ? (max - min) / 255.0f : 1.0f;
+    *zero_point = (int32_t)roundf(-128.0f - min / *scale);
+    *zero_point = std::min(std::max(*zero_point, (int32_t)-128), (int32_t)127);
+}
+
+// Quantized value of x (clamped to int8)
+static int32_t quantize(float x, float scale, int32_t zero_point) {
+    double q = round((double)x / scale) + zero_point;
+    return (int32_t)std::min(std::max(q, -128.0), 127.0);
+}
+
+// Quantize a layer whose input is quantized with in_scale
+static void quantizeLayer(Layer &layer, float in_scale) {
+
+    float act_min, act_max;
+
+    chooseQuantization(layer.out_min, layer.out_max, &layer.out_scale,
+                        &layer.out_zero_point);
+    tflite::CalculateActivationRange(layer.activation, &act_min, &act_max);
+    layer.act_min = (act_min > -FLT_MAX) ?
+        quantize(act_min, layer.out_scale, layer.out_zero_point) : -128;
+    layer.act_max = (act_max < FLT_MAX) ?
+        quantize(act_max, layer.out_scale, layer.out_zero_point) : 127;
+
+    layer.q_weights.resize(layer.outputs * layer.depth);
+    layer.q_weight_sums.resize(layer.outputs);
+    layer.q_bias.resize(layer.outputs);
+    layer.q_multiplier.resize(layer.outputs);
+    layer.q_shift.resize(layer.outputs);
+
+    for (int o = 0; o < layer.outputs; o++) {
+        const float *w = &layer.weights[o * layer.depth];
+        float w_max = 0.0f;
+        for (int d = 0; d < layer.depth; d++) {
+            w_max = std::max(w_max, fabsf(w[d]));
+        }
+        float w_scale = (w_max > 0.0f) ? w_max / 127.0f : 1.0f;
+        for (int d = 0; d < layer.depth; d++) {
+            layer.q_weights[o * layer.depth + d] =
+                (int8_t)std::min(std::max(roundf(w[d] / w_scale), -127.0f), 127.0f);
+        }
+
+        double bias_scale = (double)in_scale * w_scale;
+        layer.q_bias[o] = layer.bias ?
+            (int32_t)round(layer.bias[o] / bias_scale) : 0;
+
+        int shift;
+        tflite::QuantizeMultiplier(bias_scale / layer.out_scale,
+                                    &layer.q_multiplier[o], &shift);
+        layer.q_shift[o] = shift;
+    }
+    tflite::int8_simd::WeightSums(layer.q_weights.data(), layer.depth,
+                                    layer.outputs, layer.q_weight_sums.data());
+}
+
+// Write an array as a C++ definition
+template <typename T>
+static void writeArray(FILE *fp, const char *type, const char *name, int index,
+                        const std::vector<T> &values, int per_line) {
+
+    fprintf(fp, "const ALIGN(16) %s layer%d_%s[%zu] = {", type, index, name,
+            values.size());
+    for (size_t i = 0; i < values.size(); i++) {
+        fprintf(fp, "%s%ld,", (i % per_line == 0) ? "\n  " : " ", (long)values[i]);
+    }
+    fprintf(fp, "\n};\n");
+}
+
+// Write the quantized model as C++ source
+static int writeModel(const char *path, const std::vector<Layer> &layers,
+                        float in_scale, int32_t in_zero_point, float beta,
+                        size_t num_windows, int num_files) {
+
+    FILE *fp = fopen(path, "w");
+    if (fp == 0) {
+        printf("ERROR: Could not open %s\r\n", path);
+        return 1;
+    }
+
+    fprintf(fp,
+        "/* Generated by tools/quantize_model.cpp from the float model in\n"
+        " * trained_model_compiled.cpp, calibrated on %zu windows from %d\n"
+        " * recording(s). Do not edit: regenerate with make quantize.\n"
+        " *\n"
+        " * License: Apache-2.0\n"
+        " */\n\n"
+        "#include \"tflite-model/trained_model_int8.h\"\n\n"
+        "#if defined __GNUC__\n"
+        "#define ALIGN(X) __attribute__((aligned(X)))\n"
+        "#elif defined _MSC_VER\n"
+        "#define ALIGN(X) __declspec(align(X))\n"
+        "#elif defined __TASKING__\n"
+        "#define ALIGN(X) __align(X)\n"
+        "#endif\n\n"
+        "namespace {\n\n", num_windows, num_files);
+
+    for (size_t i = 0; i < layers.size(); i++) {
+        const Layer &layer = layers[i];
+        writeArray(fp, "int8_t", "weights", (int)i, layer.q_weights, VALUES_PER_LINE);
+        writeArray(fp, "int32_t", "weight_sums", (int)i, layer.q_weight_sums, 8);
+        writeArray(fp, "int32_t", "bias", (int)i, layer.q_bias, 8);
+        writeArray(fp, "int32_t", "multiplier", (int)i, layer.q_multiplier, 8);
+        writeArray(fp, "int32_t", "shift", (int)i, layer.q_shift, 16);
+        fprintf(fp, "\n");
+    }
+
+    // Layer table
+    fprintf(fp, "const tflite::int8_simd::FullyConnectedParams layers[%zu] = {\n",
+            layers.size());
+    int32_t offset = -in_zero_point;
+    for (size_t i = 0; i < layers.size(); i++) {
+        const Layer &layer = layers[i];
+        fprintf(fp, "  { %d, %d, layer%zu_weights, layer%zu_weight_sums, "
+                "layer%zu_bias, layer%zu_multiplier, layer%zu_shift, %ld, %ld, "
+                "%ld, %ld },\n", layer.depth, layer.outputs, i, i, i, i, i,
+                (long)offset, (long)layer.out_zero_point, (long)layer.act_min,
+                (long)layer.act_max);
+        offset = -layer.out_zero_point;
+    }
+    fprintf(fp, "};\n\n} // namespace\n\n");
+
+    fprintf(fp, "const trained_model_int8_t trained_model_int8 = {\n"
+            "  %.9g, %ld, %.9g, %ld, %.9g, %zu, layers\n};\n", in_scale,
+            (long)in_zero_point, layers.back().out_scale,
+            (long)layers.back().out_zero_point, beta, layers.size());
+
+    if (fclose(fp) != 0) {
+        printf("ERROR: Could not write %s\r\n", path);
+        return 1;
+    }
+
+    return 0;
+}
+
+/*******************************************************************************
+ * Main
+ */
+
+int main(int argc, char **argv) {
+
+    static struct option long_options[] = {
+        {"output", required_argument, 0, 'o'},
+        {0, 0, 0, 0}
+    };
+    const char *out_path = DEFAULT_OUTPUT;
+    std::vector<float> windows;
+    std::vector<float> features;
+    std::vector<Layer> layers;
+    size_t num_windows = 0;
+    float beta = 1.0f;
+    float in_min = 0.0f;
+    float in_max = 0.0f;
+    float in_scale;
+    int32_t in_zero_point;
+    int opt;
+
+#if EI_CLASSIFIER_STUDIO_VERSION < 3
+    const ei_impulse_t impulse = ei_construct_impulse();
+#else
+    const ei_impulse_t impulse = ei_default_impulse;
+#endif
+
+    // Parse command line options (input files follow the options)
+    while ((opt = getopt_long(argc, argv, "o:", long_options, NULL)) != -1) {
+        switch (opt) {
+            case 'o':
+                out_path = optarg;
+                break;
+            default:
+                optind = argc;
+                break;
+        }
+    }
+    if (optind >= argc) {
+        printf("Usage: %s [-o <out.cpp>] <file.csv|file.imub> ...\r\n", argv[0]);
+        return 1;
+    }
+
+    // Read the float model
+    trained_model_ctx_t *mctx = new trained_model_ctx_t;
+    alignas(16) static uint8_t arena[TRAINED_MODEL_ARENA_SIZE];
+    if (trained_model_ctx_init(mctx, arena, sizeof(arena)) != kTfLiteOk) {
+        printf("ERROR: Could not set up the float model\r\n");
+        return 1;
+    }
+    if (!readLayers(mctx, layers, &beta)) {
+        printf("ERROR: Only chains of float fully connected layers ending in a "
+                "softmax can be quantized\r\n");
+        return 1;
+    }
+    const int input_size = layers.front().depth;
+    const int output_size = layers.back().outputs;
+
+    // Cut the recordings (concatenated, the way the application replays
+    // them) into windows and extract their features
+    ReplayData rec;
+    if (rec.load(&argv[optind], argc - optind) != 0) {
+        printf("ERROR: %s\r\n", rec.error());
+        return 1;
+    }
+    num_windows = cutWindows(rec, windows);
+    if (num_windows == 0) {
+        printf("ERROR: Recordings are shorter than one window\r\n");
+        return 1;
+    }
+    features.resize(num_windows * input_size);
+    for (size_t i = 0; i < num_windows; i++) {
+        signal_t signal;
+        ei::matrix_t fm(1, input_size, &features[i * input_size]);
+        numpy::signal_from_buffer(&windows[i * EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE],
+                                    EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE, &signal);
+        if (extract_impulse_features(&impulse, &signal, &fm) != EI_IMPULSE_OK) {
+            printf("ERROR: Could not extract features\r\n");
+            return 1;
+        }
+    }
+
+    // Calibrate: run the float layers over every window, keeping the range of
+    // each layer's input and output. The result must match the float model.
+    std::vector<float> in, out, probs(output_size), expected(output_size);
+    unsigned long mismatches = 0;
+    for (size_t i = 0; i < num_windows; i++) {
+        in.assign(&features[i * input_size], &features[(i + 1) * input_size]);
+        for (int d = 0; d < input_size; d++) {
+            in_min = std::min(in_min, in[d]);
+            in_max = std::max(in_max, in[d]);
+        }
+        for (Layer &layer : layers) {
+            float act_min, act_max;
+            tflite::CalculateActivationRange(layer.activation, &act_min, &act_max);
+            out.resize(layer.outputs);
+            tflite::float_simd::FullyConnected(in.data(), 1, layer.depth,
+                layer.weights, layer.bias, layer.outputs, act_min, act_max,
+                out.data());
+            for (int o = 0; o < layer.outputs; o++) {
+                layer.out_min = std::min(layer.out_min, out[o]);
+                layer.out_max = std::max(layer.out_max, out[o]);
+            }
+            in.swap(out);
+        }
+        tflite::float_simd::Softmax(in.data(), 1, output_size, beta, probs.data());
+        trained_model_invoke_batch(&features[i * input_size], expected.data(), 1);
+        if (memcmp(probs.data(), expected.data(), output_size * sizeof(float)) != 0) {
+            mismatches++;
+        }
+    }
+    if (mismatches != 0) {
+        printf("ERROR: Calibration pass differs from the float model in %lu "
+                "windows\r\n", mismatches);
+        return 1;
+    }
+
+    // Quantize
+    chooseQuantization(in_min, in_max, &in_scale, &in_zero_point);
+    printf("%zu windows, input range [%g, %g]: scale %g, zero point %ld\r\n",
+        num_windows, in_min, in_max, in_scale, (long)in_zero_point);
+    float layer_in_scale = in_scale;
+    size_t float_bytes = 0;
+    size_t int8_bytes = 0;
+    for (size_t i = 0; i < layers.size(); i++) {
+        Layer &layer = layers[i];
+        quantizeLayer(layer, layer_in_scale);
+        layer_in_scale = layer.out_scale;
+        float_bytes += (layer.depth + 1) * layer.outputs * sizeof(float);
+        int8_bytes += layer.depth * layer.outputs +
+                        4 * layer.outputs * sizeof(int32_t);
+        printf("Layer %zu: %d -> %d, output range [%g, %g]: scale %g, "
+            "zero point %ld\r\n", i, layer.depth, layer.outputs, layer.out_min,
+            layer.out_max, layer.out_scale, (long)layer.out_zero_point);
+    }
+    printf("Parameters: %zu bytes float, %zu bytes int8\r\n", float_bytes,
+        int8_bytes);
+
+    if (writeModel(out_path, layers, in_scale, in_zero_point, beta, num_windows,
+            argc - optind) != 0) {
+        return 1;
+    }
+    printf("Wrote %s\r\n", out_path);
+
+    trained_model_ctx_reset(mctx);
+    delete mctx;
+
+    return 0;
+}